@@ -11,6 +11,11 @@
 #if defined(CONFIG_DATA_GRANT_SEND_ON_CONNECTION_QUALITY)
 #include <modem/lte_lc.h>
 #endif
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/fcb.h>
+#include <zephyr/storage/flash_map.h>
+#endif
 
 #include "cloud/cloud_codec/cloud_codec.h"
 
@@ -81,6 +86,36 @@ static int head_ui_buf;
 static int head_impact_buf;
 static int head_bat_buf;
 
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+/* GNSS entries that would be overwritten in the ringbuffer are appended to a flash circular
+ * buffer instead of being dropped, and are read back in batches once the cloud connection is
+ * available. Entries are written sequentially and the oldest sector is erased only when the
+ * store is full or has been read, which spreads the erase cycles over the whole partition.
+ */
+#define GNSS_STORE_MAGIC	0x474e5353
+
+/* Compact flash representation of a GNSS ringbuffer entry. */
+struct gnss_store_record {
+	int64_t ts;
+	double longi;
+	double lat;
+	float alt;
+	float acc;
+	float spd;
+	float hdg;
+} __packed;
+
+static struct flash_sector gnss_store_sectors[CONFIG_DATA_GNSS_FLASH_STORE_SECTORS];
+static struct fcb gnss_store = {
+	.f_magic = GNSS_STORE_MAGIC,
+};
+
+/* Location of the last entry read back from flash. */
+static struct fcb_entry gnss_store_loc;
+static size_t gnss_store_count;
+static bool gnss_store_ready;
+#endif /* CONFIG_DATA_GNSS_FLASH_STORE */
+
 static K_SEM_DEFINE(config_load_sem, 0, 1);
 
 /* Default device configuration. */
@@ -407,6 +442,219 @@ static int save_config(const void *buf, size_t buf_len)
 	return 0;
 }
 
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+static int gnss_store_count_cb(struct fcb_entry_ctx *loc_ctx, void *arg)
+{
+	gnss_store_count++;
+	return 0;
+}
+
+static int gnss_store_init(void)
+{
+	int err;
+	uint32_t sector_cnt = ARRAY_SIZE(gnss_store_sectors);
+	const struct flash_area *fa;
+	const struct flash_parameters *fparam;
+
+	err = flash_area_open(FIXED_PARTITION_ID(data_gnss_store), &fa);
+	if (err) {
+		LOG_ERR("flash_area_open, error: %d", err);
+		return err;
+	}
+
+	fparam = flash_get_parameters(flash_area_get_device(fa));
+	flash_area_close(fa);
+
+	err = flash_area_get_sectors(FIXED_PARTITION_ID(data_gnss_store), &sector_cnt,
+				     gnss_store_sectors);
+	if (err) {
+		LOG_ERR("flash_area_get_sectors, error: %d", err);
+		return err;
+	}
+
+	gnss_store.f_erase_value = fparam->erase_value;
+	gnss_store.f_sector_cnt = sector_cnt;
+	gnss_store.f_sectors = gnss_store_sectors;
+
+	err = fcb_init(FIXED_PARTITION_ID(data_gnss_store), &gnss_store);
+	if (err) {
+		LOG_ERR("fcb_init, error: %d", err);
+		return err;
+	}
+
+	err = fcb_walk(&gnss_store, NULL, gnss_store_count_cb, NULL);
+	if (err) {
+		LOG_ERR("fcb_walk, error: %d", err);
+		return err;
+	}
+
+	gnss_store_ready = true;
+
+	LOG_DBG("%d GNSS entries stored in flash", gnss_store_count);
+
+	return 0;
+}
+
+static int gnss_store_unread_cb(struct fcb_entry_ctx *loc_ctx, void *arg)
+{
+	if ((loc_ctx->loc.fe_sector == gnss_store_loc.fe_sector) &&
+	    (loc_ctx->loc.fe_elem_off <= gnss_store_loc.fe_elem_off)) {
+		return 0;
+	}
+
+	gnss_store_count--;
+	return 0;
+}
+
+/* Erase the oldest sector, including entries that have not been read back yet. */
+static int gnss_store_drop_oldest(void)
+{
+	int err;
+
+	err = fcb_walk(&gnss_store, gnss_store.f_oldest, gnss_store_unread_cb, NULL);
+	if (err) {
+		LOG_ERR("fcb_walk, error: %d", err);
+		return err;
+	}
+
+	if (gnss_store_loc.fe_sector == gnss_store.f_oldest) {
+		gnss_store_loc.fe_sector = NULL;
+		gnss_store_loc.fe_elem_off = 0;
+	}
+
+	err = fcb_rotate(&gnss_store);
+	if (err) {
+		LOG_ERR("fcb_rotate, error: %d", err);
+	}
+
+	return err;
+}
+
+static void gnss_store_write(const struct cloud_data_gnss *data)
+{
+	int err;
+	struct fcb_entry loc;
+	struct gnss_store_record record = {
+		.ts = data->gnss_ts,
+		.longi = data->pvt.longi,
+		.lat = data->pvt.lat,
+		.alt = data->pvt.alt,
+		.acc = data->pvt.acc,
+		.spd = data->pvt.spd,
+		.hdg = data->pvt.hdg,
+	};
+
+	if (!gnss_store_ready) {
+		return;
+	}
+
+	err = fcb_append(&gnss_store, sizeof(record), &loc);
+	if (err == -ENOSPC) {
+		LOG_WRN("GNSS flash store full, dropping oldest sector");
+
+		err = gnss_store_drop_oldest();
+		if (!err) {
+			err = fcb_append(&gnss_store, sizeof(record), &loc);
+		}
+	}
+
+	if (err) {
+		LOG_ERR("fcb_append, error: %d", err);
+		return;
+	}
+
+	err = flash_area_write(gnss_store.fap, FCB_ENTRY_FA_DATA_OFF(loc), &record,
+			       sizeof(record));
+	if (err) {
+		LOG_ERR("flash_area_write, error: %d", err);
+		return;
+	}
+
+	err = fcb_append_finish(&gnss_store, &loc);
+	if (err) {
+		LOG_ERR("fcb_append_finish, error: %d", err);
+		return;
+	}
+
+	gnss_store_count++;
+}
+
+/* Move up to one ringbuffer worth of GNSS entries from flash to the ringbuffer.
+ * Must only be called when the ringbuffer has been emptied by batch encoding.
+ */
+static size_t gnss_store_load(void)
+{
+	int err;
+	size_t loaded = 0;
+	struct flash_sector *sector = gnss_store_loc.fe_sector;
+	struct gnss_store_record record;
+
+	if (!gnss_store_ready) {
+		return 0;
+	}
+
+	while ((loaded < ARRAY_SIZE(gnss_buf)) && (gnss_store_count > 0)) {
+		err = fcb_getnext(&gnss_store, &gnss_store_loc);
+		if (err) {
+			break;
+		}
+
+		/* Erase the previous sector once all of its entries have been read. */
+		if (sector && (sector != gnss_store_loc.fe_sector)) {
+			err = fcb_rotate(&gnss_store);
+			if (err) {
+				LOG_ERR("fcb_rotate, error: %d", err);
+				break;
+			}
+		}
+
+		sector = gnss_store_loc.fe_sector;
+		gnss_store_count--;
+
+		if (gnss_store_loc.fe_data_len != sizeof(record)) {
+			continue;
+		}
+
+		err = flash_area_read(gnss_store.fap, FCB_ENTRY_FA_DATA_OFF(gnss_store_loc),
+				      &record, sizeof(record));
+		if (err) {
+			LOG_ERR("flash_area_read, error: %d", err);
+			break;
+		}
+
+		struct cloud_data_gnss data = {
+			.gnss_ts = record.ts,
+			.pvt.longi = record.longi,
+			.pvt.lat = record.lat,
+			.pvt.alt = record.alt,
+			.pvt.acc = record.acc,
+			.pvt.spd = record.spd,
+			.pvt.hdg = record.hdg,
+			.queued = true
+		};
+
+		cloud_codec_populate_gnss_buffer(gnss_buf, &data, &head_gnss_buf,
+						 ARRAY_SIZE(gnss_buf));
+		loaded++;
+	}
+
+	/* Everything has been read, release the remaining sector. */
+	if ((gnss_store_count == 0) && sector) {
+		err = fcb_rotate(&gnss_store);
+		if (err) {
+			LOG_ERR("fcb_rotate, error: %d", err);
+		}
+
+		gnss_store_loc.fe_sector = NULL;
+		gnss_store_loc.fe_elem_off = 0;
+	}
+
+	LOG_DBG("Loaded %d GNSS entries from flash, %d left", loaded, gnss_store_count);
+
+	return loaded;
+}
+#endif /* CONFIG_DATA_GNSS_FLASH_STORE */
+
 static void cloud_codec_event_handler(const struct cloud_codec_evt *evt)
 {
 	if (evt->type == CLOUD_CODEC_EVT_CONFIG_UPDATE) {
@@ -445,6 +693,14 @@ static int setup(void)
 		return err;
 	}
 
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+	/* The ringbuffers still work without the flash store, do not treat this as fatal. */
+	err = gnss_store_init();
+	if (err) {
+		LOG_WRN("GNSS flash store not available, error: %d", err);
+	}
+#endif
+
 	date_time_register_handler(date_time_event_handler);
 	return 0;
 }
@@ -527,6 +783,49 @@ static void data_send(enum data_module_event_type event,
 	memset(data, 0, sizeof(struct cloud_codec_data));
 }
 
+static int batch_encode(struct cloud_codec_data *codec)
+{
+	return cloud_codec_encode_batch_data(codec,
+					     gnss_buf,
+					     sensors_buf,
+					     &modem_stat,
+					     modem_dyn_buf,
+					     ui_buf,
+					     impact_buf,
+					     bat_buf,
+					     ARRAY_SIZE(gnss_buf),
+					     ARRAY_SIZE(sensors_buf),
+					     MODEM_STATIC_ARRAY_SIZE,
+					     ARRAY_SIZE(modem_dyn_buf),
+					     ARRAY_SIZE(ui_buf),
+					     ARRAY_SIZE(impact_buf),
+					     ARRAY_SIZE(bat_buf));
+}
+
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+/* Send GNSS entries stored in flash as additional batch messages, one ringbuffer worth of
+ * entries per message. Entries that are not sent now are sent on the next data update.
+ */
+static void gnss_store_send(struct cloud_codec_data *codec)
+{
+	int err;
+
+	for (int i = 0; i < CONFIG_DATA_GNSS_FLASH_STORE_BATCH_COUNT; i++) {
+		if (gnss_store_load() == 0) {
+			return;
+		}
+
+		err = batch_encode(codec);
+		if (err) {
+			LOG_ERR("Error batch-enconding stored GNSS data: %d", err);
+			return;
+		}
+
+		data_send(DATA_EVT_DATA_SEND_BATCH, codec);
+	}
+}
+#endif /* CONFIG_DATA_GNSS_FLASH_STORE */
+
 /* This function allocates buffer on the heap, which needs to be freed after use. */
 static void data_encode(void)
 {
@@ -618,21 +917,7 @@ static void data_encode(void)
 	}
 
 	if (grant_send(BATCH, &coneval, override)) {
-		err = cloud_codec_encode_batch_data(&codec,
-						    gnss_buf,
-						    sensors_buf,
-						    &modem_stat,
-						    modem_dyn_buf,
-						    ui_buf,
-						    impact_buf,
-						    bat_buf,
-						    ARRAY_SIZE(gnss_buf),
-						    ARRAY_SIZE(sensors_buf),
-						    MODEM_STATIC_ARRAY_SIZE,
-						    ARRAY_SIZE(modem_dyn_buf),
-						    ARRAY_SIZE(ui_buf),
-						    ARRAY_SIZE(impact_buf),
-						    ARRAY_SIZE(bat_buf));
+		err = batch_encode(&codec);
 		switch (err) {
 		case 0:
 			LOG_DBG("Batch data encoded successfully");
@@ -649,6 +934,12 @@ static void data_encode(void)
 			SEND_ERROR(data, DATA_EVT_ERROR, err);
 			return;
 		}
+
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+		if (err != -ENOTSUP) {
+			gnss_store_send(&codec);
+		}
+#endif
 	}
 }
 
@@ -1211,6 +1502,15 @@ static void on_all_states(struct data_msg_data *msg)
 		new_location_data.pvt.longi = msg->module.location.data.location.pvt.longitude;
 		new_location_data.pvt.spd = msg->module.location.data.location.pvt.speed;
 
+#if defined(CONFIG_DATA_GNSS_FLASH_STORE)
+		/* Move the entry about to be overwritten to flash if it has not been sent. */
+		int next = (head_gnss_buf + 1) % ARRAY_SIZE(gnss_buf);
+
+		if (gnss_buf[next].queued) {
+			gnss_store_write(&gnss_buf[next]);
+		}
+#endif
+
 		cloud_codec_populate_gnss_buffer(gnss_buf, &new_location_data,
 						&head_gnss_buf,
 						ARRAY_SIZE(gnss_buf));
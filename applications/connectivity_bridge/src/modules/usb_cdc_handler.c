@@ -26,7 +26,7 @@ static const struct device *devices[] = {
 
 #define USB_CDC_DTR_POLL_MS 500
 #define USB_CDC_RX_BLOCK_SIZE CONFIG_BRIDGE_BUF_SIZE
-#define USB_CDC_RX_BLOCK_COUNT (CDC_DEVICE_COUNT * 3)
+#define USB_CDC_RX_BLOCK_COUNT (CDC_DEVICE_COUNT * CONFIG_BRIDGE_CDC_BUF_COUNT)
 #define USB_CDC_SLAB_ALIGNMENT 4
 
 static void cdc_dtr_timer_handler(struct k_timer *timer);
@@ -38,8 +38,8 @@ static K_WORK_DEFINE(cdc_dtr_work, cdc_dtr_work_handler);
 K_MEM_SLAB_DEFINE(cdc_rx_slab, USB_CDC_RX_BLOCK_SIZE, USB_CDC_RX_BLOCK_COUNT, USB_CDC_SLAB_ALIGNMENT);
 
 static uint32_t cdc_ready[CDC_DEVICE_COUNT];
-
-static uint8_t overflow_buf[64];
+/* RX is paused while no buffer is available, so the host is flow controlled */
+static atomic_t cdc_rx_paused;
 
 static void cdc_dtr_timer_handler(struct k_timer *timer)
 {
@@ -108,27 +108,37 @@ static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data
 
 		err = k_mem_slab_alloc(&cdc_rx_slab, &rx_buf, K_NO_WAIT);
 		if (err) {
-			data_length = uart_fifo_read(
-				dev,
-				overflow_buf,
-				sizeof(overflow_buf));
-			LOG_WRN("CDC_%d RX overflow", dev_idx);
+			/* Leave data in the CDC ACM FIFO until a buffer is released */
+			LOG_DBG("CDC_%d RX paused", dev_idx);
+			uart_irq_rx_disable(dev);
+			atomic_set_bit(&cdc_rx_paused, dev_idx);
+			break;
+		}
+
+		data_length = uart_fifo_read(
+			dev,
+			rx_buf,
+			USB_CDC_RX_BLOCK_SIZE);
+
+		if (data_length) {
+			struct cdc_data_event *event = new_cdc_data_event();
+
+			event->dev_idx = dev_idx;
+			event->buf = rx_buf;
+			event->len = data_length;
+			APP_EVENT_SUBMIT(event);
 		} else {
-			data_length = uart_fifo_read(
-				dev,
-				rx_buf,
-				USB_CDC_RX_BLOCK_SIZE);
-
-			if (data_length) {
-				struct cdc_data_event *event = new_cdc_data_event();
-
-				event->dev_idx = dev_idx;
-				event->buf = rx_buf;
-				event->len = data_length;
-				APP_EVENT_SUBMIT(event);
-			} else {
-				k_mem_slab_free(&cdc_rx_slab, rx_buf);
-			}
+			k_mem_slab_free(&cdc_rx_slab, rx_buf);
+		}
+	}
+}
+
+static void resume_rx(void)
+{
+	for (int i = 0; i < CDC_DEVICE_COUNT; ++i) {
+		if (atomic_test_and_clear_bit(&cdc_rx_paused, i)) {
+			LOG_DBG("CDC_%d RX resumed", i);
+			uart_irq_rx_enable(devices[i]);
 		}
 	}
 }
@@ -208,6 +218,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 
 		/* All subscribers have gotten a chance to copy data at this point */
 		k_mem_slab_free(&cdc_rx_slab, (void *)event->buf);
+		resume_rx();
 
 		return true;
 	}
@@ -230,6 +241,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 				LOG_ERR("usb_enable: %d", err);
 				return false;
 			}
+			atomic_clear(&cdc_rx_paused);
 			for (int i = 0; i < CDC_DEVICE_COUNT; ++i) {
 				cdc_ready[i] = 0;
 				if (device_is_ready(devices[i])) {
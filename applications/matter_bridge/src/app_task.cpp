@@ -26,6 +26,14 @@
 #include "dfu/ota/ota_util.h"
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+#include "migration/migration_manager.h"
+#endif
+
+#ifdef CONFIG_BRIDGE_BENCHMARK
+#include "bridge_benchmark.h"
+#endif
+
 #include <app-common/zap-generated/ids/Attributes.h>
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app/server/OnboardingCodesUtil.h>
@@ -35,6 +43,8 @@
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 #include <zephyr/logging/log.h>
 
+#include <algorithm>
+
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
 using namespace ::chip;
@@ -86,6 +96,53 @@ void BLEStateChangeCallback(Nrf::BLEConnectivityManager::State state)
 
 #endif /* CONFIG_BRIDGED_DEVICE_BT */
 
+struct RestoreContext {
+	const uint8_t *mIndexes;
+	size_t mIndexesCount;
+	size_t mRestoredCount;
+	bool mRestored[Nrf::BridgeManager::kMaxBridgedDevices];
+};
+
+bool RestoreBridgedDevice(Nrf::BridgeStorageManager::BridgedDeviceRecord &record, uint8_t index, void *context)
+{
+	RestoreContext &ctx = *static_cast<RestoreContext *>(context);
+	const uint8_t *position = std::find(ctx.mIndexes, ctx.mIndexes + ctx.mIndexesCount, index);
+
+	/* Skip the records left behind by devices that are no longer on the list of bridged devices. */
+	if (position == ctx.mIndexes + ctx.mIndexesCount || ctx.mRestored[position - ctx.mIndexes]) {
+		return true;
+	}
+
+	ctx.mRestored[position - ctx.mIndexes] = true;
+
+	/* The label is not null-terminated in the record. */
+	record.mNodeLabel[record.mNodeLabelLength] = '\0';
+
+	LOG_INF("Loaded bridged device on endpoint id %d from the storage", record.mEndpointId);
+
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	BleBridgedDeviceFactory::CreateDevice(record.mDeviceType, record.mBtAddress, record.mNodeLabel, index,
+					      record.mEndpointId);
+#else
+	SimulatedBridgedDeviceFactory::CreateDevice(record.mDeviceType, record.mNodeLabel,
+						    chip::Optional<uint8_t>(index),
+						    chip::Optional<uint16_t>(record.mEndpointId));
+#endif
+	ctx.mRestoredCount++;
+
+	return true;
+}
+
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+void CompleteMigration()
+{
+	if (Nrf::Matter::Migration::CompleteBridgedDevicesMigration() != CHIP_NO_ERROR) {
+		/* The migration is retried on the next boot, so this does not prevent loading the devices. */
+		LOG_ERR("Failed to complete migration of bridged devices to the current storage layout");
+	}
+}
+#endif
+
 } /* namespace */
 
 CHIP_ERROR AppTask::RestoreBridgedDevices()
@@ -96,6 +153,10 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 
 	if (!Nrf::BridgeStorageManager::Instance().LoadBridgedDevicesCount(count)) {
 		LOG_INF("No bridged devices to load from the storage.");
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+		/* Nothing has been stored yet, so there is no legacy data to migrate. */
+		CompleteMigration();
+#endif
 		return CHIP_NO_ERROR;
 	}
 
@@ -104,40 +165,33 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 		return CHIP_NO_ERROR;
 	}
 
-	/* Load all devices based on the read count number. */
-	for (size_t i = 0; i < indexesCount; i++) {
-		uint16_t endpointId;
-		char label[Nrf::MatterBridgedDevice::kNodeLabelSize] = { 0 };
-		size_t labelSize;
-		uint16_t deviceType;
+	/* Load all devices stored under the read indexes in a single pass over the records. */
+	RestoreContext ctx{ indexes, indexesCount, 0, {} };
 
-		if (!Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceEndpointId(endpointId, indexes[i])) {
-			return CHIP_ERROR_NOT_FOUND;
-		}
+	Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceRecords(RestoreBridgedDevice, &ctx);
 
-		/* Ignore an error, as node label is optional, so it may not be found. */
-		Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceNodeLabel(label, sizeof(label), labelSize,
-										 indexes[i]);
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+	/* The devices without a record may still be stored using the legacy layout, loading them one by one migrates
+	 * them on the first access. */
+	for (size_t i = 0; i < indexesCount && ctx.mRestoredCount != indexesCount; i++) {
+		Nrf::BridgeStorageManager::BridgedDeviceRecord record;
 
-		if (!Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceType(deviceType, indexes[i])) {
-			return CHIP_ERROR_NOT_FOUND;
+		if (!ctx.mRestored[i] &&
+		    Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceRecord(record, indexes[i])) {
+			RestoreBridgedDevice(record, indexes[i], &ctx);
 		}
+	}
+#endif
 
-		LOG_INF("Loaded bridged device on endpoint id %d from the storage", endpointId);
-
-#ifdef CONFIG_BRIDGED_DEVICE_BT
-		bt_addr_le_t addr;
-
-		if (!Nrf::BridgeStorageManager::Instance().LoadBtAddress(addr, indexes[i])) {
-			return CHIP_ERROR_NOT_FOUND;
-		}
+	if (ctx.mRestoredCount != indexesCount) {
+		return CHIP_ERROR_NOT_FOUND;
+	}
 
-		BleBridgedDeviceFactory::CreateDevice(deviceType, addr, label, indexes[i], endpointId);
-#else
-		SimulatedBridgedDeviceFactory::CreateDevice(deviceType, label, chip::Optional<uint8_t>(indexes[i]),
-							    chip::Optional<uint16_t>(endpointId));
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+	/* All devices use the record layout now. */
+	CompleteMigration();
 #endif
-	}
+
 	return CHIP_NO_ERROR;
 }
 
@@ -163,6 +217,14 @@ CHIP_ERROR AppTask::Init()
 			LOG_ERR("BridgeManager initialization failed");
 			return bridgeMgrInitError;
 		}
+
+#ifdef CONFIG_BRIDGE_BENCHMARK
+		CHIP_ERROR benchmarkError = BridgeBenchmark::Start();
+		if (benchmarkError != CHIP_NO_ERROR) {
+			LOG_ERR("Bridge benchmark start failed");
+			return benchmarkError;
+		}
+#endif
 		return CHIP_NO_ERROR;
 	} }));
 
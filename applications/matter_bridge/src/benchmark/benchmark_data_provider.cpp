@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "benchmark_data_provider.h"
+#include "bridge_benchmark.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+void BenchmarkDataProvider::Init()
+{
+	k_timer_init(&mTimer, BenchmarkDataProvider::TimerTimeoutCallback, nullptr);
+	k_timer_user_data_set(&mTimer, this);
+	k_timer_start(&mTimer, K_MSEC(mStartDelayMs), K_MSEC(kUpdateIntervalMs));
+}
+
+void BenchmarkDataProvider::NotifyUpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, void *data,
+					      size_t dataSize)
+{
+	if (mUpdateAttributeCallback) {
+		mUpdateAttributeCallback(*this, Clusters::TemperatureMeasurement::Id,
+					 Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id, data,
+					 dataSize);
+	}
+}
+
+void BenchmarkDataProvider::TimerTimeoutCallback(k_timer *timer)
+{
+	if (!timer || !timer->user_data) {
+		return;
+	}
+
+	BenchmarkDataProvider *provider = reinterpret_cast<BenchmarkDataProvider *>(timer->user_data);
+
+	/* Change the value every time, as the unchanged attributes are not reported. */
+	provider->mTemperature = provider->mTemperature < kMaxTemperature ? provider->mTemperature + 1 : kMinTemperature;
+
+	/* Keep the timestamp of the oldest unreported update, the value 0 is reserved for no pending update. */
+	atomic_cas(&provider->mPendingUpdateTimestamp, 0, static_cast<atomic_val_t>(k_cycle_get_32() | 1));
+
+	BridgeBenchmark::NotifyUpdateScheduled();
+	DeviceLayer::PlatformMgr().ScheduleWork(NotifyAttributeChange, reinterpret_cast<intptr_t>(provider));
+}
+
+void BenchmarkDataProvider::NotifyAttributeChange(intptr_t context)
+{
+	BenchmarkDataProvider *provider = reinterpret_cast<BenchmarkDataProvider *>(context);
+
+	BridgeBenchmark::NotifyUpdateExecuted();
+	provider->NotifyUpdateState(Clusters::TemperatureMeasurement::Id,
+				    Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id,
+				    &provider->mTemperature, sizeof(provider->mTemperature));
+}
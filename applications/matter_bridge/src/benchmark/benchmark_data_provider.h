@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "bridged_device_data_provider.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/* Simulated temperature sensor data provider that updates the measured value with the configurable rate and tracks
+ * the time of the oldest update that has not been reported yet. */
+class BenchmarkDataProvider : public Nrf::BridgedDeviceDataProvider {
+public:
+	BenchmarkDataProvider(UpdateAttributeCallback updateCallback, InvokeCommandCallback commandCallback)
+		: Nrf::BridgedDeviceDataProvider(updateCallback, commandCallback)
+	{
+	}
+	~BenchmarkDataProvider() { k_timer_stop(&mTimer); }
+
+	void Init() override;
+	void NotifyUpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, void *data,
+			       size_t dataSize) override;
+	CHIP_ERROR UpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, uint8_t *buffer) override
+	{
+		return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+	}
+
+	/**
+	 * @brief Set the delay of the first update, so that the updates of multiple providers can be spread over the
+	 * update interval. Must be called before Init().
+	 *
+	 * @param delayMs delay of the first update in milliseconds
+	 */
+	void SetStartDelay(uint32_t delayMs) { mStartDelayMs = delayMs; }
+
+	/**
+	 * @brief Get and clear the time of the oldest update that has not been reported yet.
+	 *
+	 * @return value of the hardware cycle counter captured at the update, or 0 if there is no pending update
+	 */
+	uint32_t TakePendingUpdateTimestamp() { return static_cast<uint32_t>(atomic_set(&mPendingUpdateTimestamp, 0)); }
+
+private:
+	static constexpr uint32_t kUpdateIntervalMs = CONFIG_BRIDGE_BENCHMARK_UPDATE_INTERVAL_MS;
+	static constexpr int16_t kMinTemperature = -1000;
+	static constexpr int16_t kMaxTemperature = 1000;
+
+	static void TimerTimeoutCallback(k_timer *timer);
+	static void NotifyAttributeChange(intptr_t context);
+
+	k_timer mTimer;
+	uint32_t mStartDelayMs = 0;
+	int16_t mTemperature = kMinTemperature;
+	atomic_t mPendingUpdateTimestamp = ATOMIC_INIT(0);
+};
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bridge_benchmark.h"
+#include "benchmark_data_provider.h"
+#include "bridge_manager.h"
+#include "temperature_sensor.h"
+
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/DiagnosticDataProvider.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace Nrf;
+
+namespace
+{
+constexpr uint8_t kProvidersNumber = CONFIG_BRIDGE_BENCHMARK_PROVIDERS_NUMBER;
+constexpr uint32_t kUpdateIntervalMs = CONFIG_BRIDGE_BENCHMARK_UPDATE_INTERVAL_MS;
+constexpr uint32_t kStatisticsIntervalSec = CONFIG_BRIDGE_BENCHMARK_STATISTICS_INTERVAL;
+
+struct BenchmarkDevice {
+	chip::EndpointId mEndpointId;
+	BenchmarkDataProvider *mProvider;
+};
+
+/* Statistics collected within the single statistics interval. */
+struct Statistics {
+	uint32_t mReports;
+	uint64_t mLatencySumUs;
+	uint32_t mLatencyMinUs;
+	uint32_t mLatencyMaxUs;
+	atomic_val_t mMaxQueueDepth;
+};
+
+BenchmarkDevice sDevices[kProvidersNumber];
+uint8_t sDevicesCount;
+Statistics sStatistics;
+atomic_t sUpdates = ATOMIC_INIT(0);
+atomic_t sQueueDepth = ATOMIC_INIT(0);
+k_thread_runtime_stats_t sLastCpuStats;
+
+void ResetStatistics()
+{
+	sStatistics = {};
+	sStatistics.mLatencyMinUs = UINT32_MAX;
+	atomic_set(&sUpdates, 0);
+}
+
+BenchmarkDataProvider *FindProvider(chip::EndpointId endpointId)
+{
+	for (uint8_t i = 0; i < sDevicesCount; i++) {
+		if (sDevices[i].mEndpointId != endpointId) {
+			continue;
+		}
+
+		/* Make sure the device has not been removed, e.g. using the shell command. */
+		uint16_t deviceType;
+		if (BridgeManager::Instance().GetProvider(endpointId, deviceType) != sDevices[i].mProvider) {
+			return nullptr;
+		}
+		return sDevices[i].mProvider;
+	}
+	return nullptr;
+}
+
+void ReportCallback(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId)
+{
+	if (clusterId != app::Clusters::TemperatureMeasurement::Id) {
+		return;
+	}
+
+	BenchmarkDataProvider *provider = FindProvider(endpointId);
+	if (!provider) {
+		return;
+	}
+
+	uint32_t timestamp = provider->TakePendingUpdateTimestamp();
+	if (timestamp == 0) {
+		return;
+	}
+
+	uint32_t latencyUs = k_cyc_to_us_floor32(k_cycle_get_32() - timestamp);
+
+	sStatistics.mReports++;
+	sStatistics.mLatencySumUs += latencyUs;
+	sStatistics.mLatencyMinUs = MIN(sStatistics.mLatencyMinUs, latencyUs);
+	sStatistics.mLatencyMaxUs = MAX(sStatistics.mLatencyMaxUs, latencyUs);
+}
+
+void PrintStatistics()
+{
+	uint32_t latencyAvgUs = sStatistics.mReports ? sStatistics.mLatencySumUs / sStatistics.mReports : 0;
+
+	LOG_INF("Benchmark: %ld updates, %u reports, latency min/avg/max %u/%u/%u us", atomic_get(&sUpdates),
+		sStatistics.mReports, sStatistics.mReports ? sStatistics.mLatencyMinUs : 0, latencyAvgUs,
+		sStatistics.mLatencyMaxUs);
+	LOG_INF("Benchmark: queue depth %ld (max %ld)", atomic_get(&sQueueDepth), sStatistics.mMaxQueueDepth);
+
+	uint64_t heapUsed = 0;
+	uint64_t heapHighWatermark = 0;
+	DeviceLayer::DiagnosticDataProvider &diagnostics = DeviceLayer::GetDiagnosticDataProvider();
+
+	if (diagnostics.GetCurrentHeapUsed(heapUsed) == CHIP_NO_ERROR &&
+	    diagnostics.GetCurrentHeapHighWatermark(heapHighWatermark) == CHIP_NO_ERROR) {
+		LOG_INF("Benchmark: heap used %u B (high watermark %u B)", static_cast<uint32_t>(heapUsed),
+			static_cast<uint32_t>(heapHighWatermark));
+	} else {
+		LOG_INF("Benchmark: heap statistics not supported");
+	}
+
+	k_thread_runtime_stats_t cpuStats;
+
+	if (k_thread_runtime_stats_all_get(&cpuStats) == 0) {
+		/* The execution cycles include the idle ones, while the total cycles do not. */
+		uint64_t allCycles = cpuStats.execution_cycles - sLastCpuStats.execution_cycles;
+		uint64_t busyCycles = cpuStats.total_cycles - sLastCpuStats.total_cycles;
+		uint32_t loadPermille = allCycles ? busyCycles * 1000 / allCycles : 0;
+
+		LOG_INF("Benchmark: CPU load %u.%u%%", loadPermille / 10, loadPermille % 10);
+		sLastCpuStats = cpuStats;
+	}
+}
+
+void StatisticsTimerTimeoutCallback(System::Layer *layer, void *context)
+{
+	PrintStatistics();
+	ResetStatistics();
+	DeviceLayer::SystemLayer().StartTimer(System::Clock::Seconds32(kStatisticsIntervalSec),
+					      StatisticsTimerTimeoutCallback, nullptr);
+}
+
+} /* namespace */
+
+namespace BridgeBenchmark
+{
+
+CHIP_ERROR Start()
+{
+	for (uint8_t i = 0; i < kProvidersNumber; i++) {
+		char nodeLabel[MatterBridgedDevice::kNodeLabelSize] = { 0 };
+		snprintf(nodeLabel, sizeof(nodeLabel), "Benchmark %u", i);
+
+		BenchmarkDataProvider *provider = BridgeManager::Instance().GetDataProviderPool().New<BenchmarkDataProvider>(
+			BridgeManager::HandleUpdate, BridgeManager::HandleCommand);
+		VerifyOrReturnError(provider, CHIP_ERROR_NO_MEMORY, LOG_ERR("Cannot allocate benchmark data provider"));
+
+		MatterBridgedDevice *device =
+			BridgeManager::Instance().GetBridgedDevicePool().New<TemperatureSensorDevice>(nodeLabel);
+		if (!device) {
+			BridgeManager::Instance().GetDataProviderPool().Delete(provider);
+			LOG_ERR("Cannot allocate benchmark bridged device");
+			return CHIP_ERROR_NO_MEMORY;
+		}
+
+		/* Spread the updates of all providers evenly over the update interval. */
+		provider->SetStartDelay(kUpdateIntervalMs * i / kProvidersNumber);
+
+		MatterBridgedDevice *devices[] = { device };
+		uint8_t index[] = { 0 };
+
+		/* The benchmark devices are not stored in the persistent storage. */
+		ReturnErrorOnFailure(
+			BridgeManager::Instance().AddBridgedDevices(devices, provider, ARRAY_SIZE(devices), index));
+
+		sDevices[sDevicesCount++] = { device->GetEndpointId(), provider };
+	}
+
+	LOG_INF("Benchmark: started %u providers updated every %u ms", sDevicesCount, kUpdateIntervalMs);
+
+	BridgeManager::Instance().SetReportCallback(ReportCallback);
+	ResetStatistics();
+	k_thread_runtime_stats_all_get(&sLastCpuStats);
+
+	return DeviceLayer::SystemLayer().StartTimer(System::Clock::Seconds32(kStatisticsIntervalSec),
+						     StatisticsTimerTimeoutCallback, nullptr);
+}
+
+void NotifyUpdateScheduled()
+{
+	atomic_inc(&sUpdates);
+	atomic_inc(&sQueueDepth);
+}
+
+void NotifyUpdateExecuted()
+{
+	/* The depth observed by the update also includes the update itself. */
+	atomic_val_t depth = atomic_dec(&sQueueDepth);
+
+	sStatistics.mMaxQueueDepth = MAX(sStatistics.mMaxQueueDepth, depth);
+}
+
+} /* namespace BridgeBenchmark */
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+namespace BridgeBenchmark
+{
+
+/**
+ * @brief Create the fleet of simulated bridged devices and start collecting the benchmark statistics.
+ *
+ * The statistics are printed to the log periodically. This method must be called from the Matter thread.
+ *
+ * @return CHIP_NO_ERROR on success
+ * @return other error code on failure
+ */
+CHIP_ERROR Start();
+
+/**
+ * @brief Notify that the data provider has scheduled the update to be processed in the Matter thread.
+ *
+ * This method can be called from the interrupt context.
+ */
+void NotifyUpdateScheduled();
+
+/**
+ * @brief Notify that the update scheduled by the data provider is being processed in the Matter thread.
+ */
+void NotifyUpdateExecuted();
+
+} /* namespace BridgeBenchmark */
@@ -72,27 +72,20 @@ CHIP_ERROR BleServiceToMatterDeviceType(BleBridgedDeviceFactory::ServiceUuid ser
 
 CHIP_ERROR StoreDevice(MatterBridgedDevice *device, BridgedDeviceDataProvider *provider, uint8_t index)
 {
-	uint16_t endpointId;
+	BridgeStorageManager::BridgedDeviceRecord record;
 	uint8_t count = 0;
 	uint8_t indexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	bool deviceRefresh = false;
 
 	/* Check if a device is already present in the storage. */
-	if (BridgeStorageManager::Instance().LoadBridgedDeviceEndpointId(endpointId, index)) {
+	if (BridgeStorageManager::Instance().LoadBridgedDeviceRecord(record, index)) {
 		deviceRefresh = true;
 	}
 
-	if (!BridgeStorageManager::Instance().StoreBridgedDevice(device, index)) {
-		LOG_ERR("Failed to store bridged device");
-		return CHIP_ERROR_INTERNAL;
-	}
-
 	BLEBridgedDeviceProvider *bleProvider = static_cast<BLEBridgedDeviceProvider *>(provider);
 
-	bt_addr_le_t addr = bleProvider->GetBtAddress();
-
-	if (!BridgeStorageManager::Instance().StoreBtAddress(addr, index)) {
-		LOG_ERR("Failed to store bridged device's Bluetooth address");
+	if (!BridgeStorageManager::Instance().StoreBridgedDevice(device, bleProvider->GetBtAddress(), index)) {
+		LOG_ERR("Failed to store bridged device");
 		return CHIP_ERROR_INTERNAL;
 	}
 
@@ -124,7 +117,8 @@ CHIP_ERROR AddMatterDevices(MatterBridgedDevice::DeviceType deviceTypes[], uint8
 			    uint16_t endpointIds[] = nullptr)
 {
 	VerifyOrReturnError(provider != nullptr, CHIP_ERROR_INVALID_ARGUMENT, LOG_ERR("No valid data provider!"));
-	chip::Platform::UniquePtr<BridgedDeviceDataProvider> providerPtr(provider);
+	BridgeManager::DataProviderPool::UniquePtr providerPtr =
+		BridgeManager::Instance().GetDataProviderPool().MakeUnique(provider);
 	VerifyOrReturnError(count <= BridgeManager::kMaxBridgedDevicesPerProvider, CHIP_ERROR_BUFFER_TOO_SMALL,
 			    LOG_ERR("Trying to add too many endpoints for single provider device."));
 
@@ -157,7 +151,7 @@ CHIP_ERROR AddMatterDevices(MatterBridgedDevice::DeviceType deviceTypes[], uint8
 	/* Not all requested devices were created successfully, delete all previously created objects and return. */
 	if (err != CHIP_NO_ERROR) {
 		for (uint8_t i = 0; i < addedDevicesCount; i++) {
-			chip::Platform::Delete(newBridgedDevices[i]);
+			BridgeManager::Instance().GetBridgedDevicePool().Delete(newBridgedDevices[i]);
 		}
 		return err;
 	}
@@ -210,7 +204,7 @@ CHIP_ERROR BluetoothDeviceConnected(bool success, void *context)
 	BluetoothConnectionContext *ctx = reinterpret_cast<BluetoothConnectionContext *>(context);
 
 	if (!success) {
-		chip::Platform::Delete(ctx->provider);
+		BridgeManager::Instance().GetDataProviderPool().Delete(ctx->provider);
 		chip::Platform::Delete(ctx);
 		return CHIP_ERROR_INTERNAL;
 	}
@@ -225,86 +219,72 @@ CHIP_ERROR BluetoothDeviceConnected(bool success, void *context)
 
 	return err;
 }
-} // namespace
 
-BleBridgedDeviceFactory::BridgedDeviceFactory &BleBridgedDeviceFactory::GetBridgedDeviceFactory()
+using BridgedDeviceCreator = BleBridgedDeviceFactory::BridgedDeviceFactory::Creator;
+using DataProviderCreator = BleBridgedDeviceFactory::BleDataProviderFactory::Creator;
+
+template <typename T> MatterBridgedDevice *CreateBridgedDevice(const char *nodeLabel)
 {
-	auto checkLabel = [](const char *nodeLabel) {
-		/* If node label is provided it must fit the maximum defined length */
-		if (!nodeLabel || (nodeLabel && (strlen(nodeLabel) < MatterBridgedDevice::kNodeLabelSize))) {
-			return true;
-		}
-		return false;
-	};
+	/* If node label is provided it must fit the maximum defined length */
+	if (nodeLabel && strlen(nodeLabel) >= MatterBridgedDevice::kNodeLabelSize) {
+		return nullptr;
+	}
+	return BridgeManager::Instance().GetBridgedDevicePool().New<T>(nodeLabel);
+}
+
+template <typename T>
+BridgedDeviceDataProvider *CreateDataProvider(BleBridgedDeviceFactory::UpdateAttributeCallback updateClb,
+					      BleBridgedDeviceFactory::InvokeCommandCallback commandClb)
+{
+	return BridgeManager::Instance().GetDataProviderPool().New<T>(updateClb, commandClb);
+}
 
-	static BridgedDeviceFactory sBridgedDeviceFactory{
+constexpr std::initializer_list<BridgedDeviceCreator> kBridgedDeviceCreators{
 #ifdef CONFIG_BRIDGE_HUMIDITY_SENSOR_BRIDGED_DEVICE
-		{ MatterBridgedDevice::DeviceType::HumiditySensor,
-		  [checkLabel](const char *nodeLabel) -> MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<HumiditySensorDevice>(nodeLabel);
-		  } },
+	{ MatterBridgedDevice::DeviceType::HumiditySensor, &CreateBridgedDevice<HumiditySensorDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_BRIDGED_DEVICE
-		{ MatterBridgedDevice::DeviceType::OnOffLight,
-		  [checkLabel](const char *nodeLabel) -> MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<OnOffLightDevice>(nodeLabel);
-		  } },
+	{ MatterBridgedDevice::DeviceType::OnOffLight, &CreateBridgedDevice<OnOffLightDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_TEMPERATURE_SENSOR_BRIDGED_DEVICE
-		{ MatterBridgedDevice::DeviceType::TemperatureSensor,
-		  [checkLabel](const char *nodeLabel) -> MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<TemperatureSensorDevice>(nodeLabel);
-		  } },
+	{ MatterBridgedDevice::DeviceType::TemperatureSensor, &CreateBridgedDevice<TemperatureSensorDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-		{ MatterBridgedDevice::DeviceType::GenericSwitch,
-		  [checkLabel](const char *nodeLabel) -> MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<GenericSwitchDevice>(nodeLabel);
-		  } },
+	{ MatterBridgedDevice::DeviceType::GenericSwitch, &CreateBridgedDevice<GenericSwitchDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE
-		{ MatterBridgedDevice::DeviceType::OnOffLightSwitch,
-		  [checkLabel](const char *nodeLabel) -> MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<OnOffLightSwitchDevice>(nodeLabel);
-		  } },
+	{ MatterBridgedDevice::DeviceType::OnOffLightSwitch, &CreateBridgedDevice<OnOffLightSwitchDevice> },
 #endif
-	};
-	return sBridgedDeviceFactory;
-}
+};
 
-BleBridgedDeviceFactory::BleDataProviderFactory &BleBridgedDeviceFactory::GetDataProviderFactory()
-{
-	static BleDataProviderFactory sDeviceDataProvider
-	{
+constexpr std::initializer_list<DataProviderCreator> kDataProviderCreators{
 #if defined(CONFIG_BRIDGE_ONOFF_LIGHT_BRIDGED_DEVICE) && (defined(CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE) ||      \
 							  defined(CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE))
-		{ ServiceUuid::LedButtonService,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<BleLBSDataProvider>(updateClb, commandClb);
-		  } },
+	{ BleBridgedDeviceFactory::ServiceUuid::LedButtonService, &CreateDataProvider<BleLBSDataProvider> },
 #endif
 #if defined(CONFIG_BRIDGE_TEMPERATURE_SENSOR_BRIDGED_DEVICE) && defined(CONFIG_BRIDGE_HUMIDITY_SENSOR_BRIDGED_DEVICE)
-			{ ServiceUuid::EnvironmentalSensorService,
-			  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-				  return chip::Platform::New<BleEnvironmentalDataProvider>(updateClb, commandClb);
-			  } },
+	{ BleBridgedDeviceFactory::ServiceUuid::EnvironmentalSensorService,
+	  &CreateDataProvider<BleEnvironmentalDataProvider> },
 #endif
-	};
+};
+
+constexpr auto kBridgedDeviceCreatorTable =
+	BleBridgedDeviceFactory::BridgedDeviceFactory::MakeCreatorTable<kBridgedDeviceCreators.size()>(
+		kBridgedDeviceCreators);
+constexpr auto kDataProviderCreatorTable =
+	BleBridgedDeviceFactory::BleDataProviderFactory::MakeCreatorTable<kDataProviderCreators.size()>(
+		kDataProviderCreators);
+} // namespace
+
+const BleBridgedDeviceFactory::BridgedDeviceFactory &BleBridgedDeviceFactory::GetBridgedDeviceFactory()
+{
+	static constexpr BridgedDeviceFactory sBridgedDeviceFactory{ kBridgedDeviceCreatorTable };
+	return sBridgedDeviceFactory;
+}
+
+const BleBridgedDeviceFactory::BleDataProviderFactory &BleBridgedDeviceFactory::GetDataProviderFactory()
+{
+	static constexpr BleDataProviderFactory sDeviceDataProvider{ kDataProviderCreatorTable };
 	return sDeviceDataProvider;
 }
 
@@ -350,7 +330,7 @@ CHIP_ERROR BleBridgedDeviceFactory::CreateDevice(int deviceType, bt_addr_le_t bt
 
 exit:
 	if (err != CHIP_NO_ERROR) {
-		chip::Platform::Delete(provider);
+		BridgeManager::Instance().GetDataProviderPool().Delete(provider);
 	}
 
 	return err;
@@ -409,7 +389,7 @@ CHIP_ERROR BleBridgedDeviceFactory::CreateDevice(uint16_t uuid, bt_addr_le_t btA
 
 exit:
 	if (err != CHIP_NO_ERROR) {
-		chip::Platform::Delete(provider);
+		BridgeManager::Instance().GetDataProviderPool().Delete(provider);
 	}
 
 	return err;
@@ -445,21 +425,8 @@ CHIP_ERROR BleBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	if (!BridgeStorageManager::Instance().RemoveBridgedDeviceEndpointId(index)) {
-		LOG_ERR("Failed to remove bridged device endpoint id.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
-	/* Ignore error, as node label may not be present in the storage. */
-	BridgeStorageManager::Instance().RemoveBridgedDeviceNodeLabel(index);
-
-	if (!BridgeStorageManager::Instance().RemoveBridgedDeviceType(index)) {
-		LOG_ERR("Failed to remove bridged device type.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
-	if (!BridgeStorageManager::Instance().RemoveBtAddress(index)) {
-		LOG_ERR("Failed to remove bridged device Bluetooth address.");
+	if (!BridgeStorageManager::Instance().RemoveBridgedDeviceRecord(index)) {
+		LOG_ERR("Failed to remove bridged device.");
 		return CHIP_ERROR_INTERNAL;
 	}
 
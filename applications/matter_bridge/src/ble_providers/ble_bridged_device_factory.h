@@ -52,8 +52,8 @@ using DeviceType = uint16_t;
 using BridgedDeviceFactory = Nrf::DeviceFactory<Nrf::MatterBridgedDevice, DeviceType, const char *>;
 using BleDataProviderFactory = Nrf::DeviceFactory<Nrf::BridgedDeviceDataProvider, ServiceUuid, UpdateAttributeCallback, InvokeCommandCallback>;
 
-BridgedDeviceFactory &GetBridgedDeviceFactory();
-BleDataProviderFactory &GetDataProviderFactory();
+const BridgedDeviceFactory &GetBridgedDeviceFactory();
+const BleDataProviderFactory &GetDataProviderFactory();
 
 /**
  * @brief Create a bridged device using a specific device type, index and endpoint ID.
@@ -47,7 +47,7 @@ uint8_t BleEnvironmentalDataProvider::GattTemperatureNotifyCallback(bt_conn *con
 
 	/* Save data received in notification. */
 	memcpy(&provider->mTemperatureValue, data, length);
-	DeviceLayer::PlatformMgr().ScheduleWork(NotifyTemperatureAttributeChange, reinterpret_cast<intptr_t>(provider));
+	provider->ScheduleNotification(kTemperatureNotificationPending, NotifyTemperatureAttributeChange);
 
 exit:
 
@@ -64,7 +64,7 @@ uint8_t BleEnvironmentalDataProvider::GattHumidityNotifyCallback(bt_conn *conn,
 
 	/* Save data received in notification. */
 	memcpy(&provider->mHumidityValue, data, length);
-	DeviceLayer::PlatformMgr().ScheduleWork(NotifyHumidityAttributeChange, reinterpret_cast<intptr_t>(provider));
+	provider->ScheduleNotification(kHumidityNotificationPending, NotifyHumidityAttributeChange);
 
 exit:
 
@@ -110,6 +110,33 @@ int BleEnvironmentalDataProvider::ParseDiscoveredData(bt_gatt_dm *discoveredData
 	return 0;
 }
 
+uint8_t BleEnvironmentalDataProvider::GetGattHandles(uint16_t *handles, uint8_t maxCount)
+{
+	const uint16_t discoveredHandles[] = { mTemperatureCharacteristicHandle, mCccTemperatureHandle,
+					       mHumidityCharacteristicHandle, mCccHumidityHandle };
+
+	VerifyOrReturnValue(handles && maxCount >= ARRAY_SIZE(discoveredHandles), 0);
+
+	memcpy(handles, discoveredHandles, sizeof(discoveredHandles));
+
+	return ARRAY_SIZE(discoveredHandles);
+}
+
+int BleEnvironmentalDataProvider::RestoreGattHandles(const uint16_t *handles, uint8_t count)
+{
+	VerifyOrReturnError(handles && count == 4, -EINVAL);
+
+	mTemperatureCharacteristicHandle = handles[0];
+	mCccTemperatureHandle = handles[1];
+	mHumidityCharacteristicHandle = handles[2];
+	mCccHumidityHandle = handles[3];
+
+	/* All characteristics are restored so start the new subscription */
+	Subscribe();
+
+	return 0;
+}
+
 CHIP_ERROR BleEnvironmentalDataProvider::ParseTemperatureCharacteristic(bt_gatt_dm *discoveredData)
 {
 	const bt_gatt_dm_attr *gatt_chrc = bt_gatt_dm_char_by_uuid(discoveredData, sUuidTemperature);
@@ -221,10 +248,25 @@ bool BleEnvironmentalDataProvider::CheckSubscriptionParameters(bt_gatt_subscribe
 	return true;
 }
 
+void BleEnvironmentalDataProvider::ScheduleNotification(int pendingBit, void (*notifyHandler)(intptr_t))
+{
+	/* The work is already scheduled and it will pick the latest received value, do not flood the CHIP work queue
+	 * with the duplicated items. */
+	if (atomic_test_and_set_bit(&mPendingNotifications, pendingBit)) {
+		return;
+	}
+
+	if (CHIP_NO_ERROR != DeviceLayer::PlatformMgr().ScheduleWork(notifyHandler, reinterpret_cast<intptr_t>(this))) {
+		atomic_clear_bit(&mPendingNotifications, pendingBit);
+	}
+}
+
 void BleEnvironmentalDataProvider::NotifyTemperatureAttributeChange(intptr_t context)
 {
 	BleEnvironmentalDataProvider *provider = reinterpret_cast<BleEnvironmentalDataProvider *>(context);
 
+	atomic_clear_bit(&provider->mPendingNotifications, kTemperatureNotificationPending);
+
 	provider->NotifyUpdateState(Clusters::TemperatureMeasurement::Id,
 				    Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id,
 				    &provider->mTemperatureValue, sizeof(provider->mTemperatureValue));
@@ -234,6 +276,8 @@ void BleEnvironmentalDataProvider::NotifyHumidityAttributeChange(intptr_t contex
 {
 	BleEnvironmentalDataProvider *provider = reinterpret_cast<BleEnvironmentalDataProvider *>(context);
 
+	atomic_clear_bit(&provider->mPendingNotifications, kHumidityNotificationPending);
+
 	provider->NotifyUpdateState(Clusters::RelativeHumidityMeasurement::Id,
 				    Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id,
 				    &provider->mHumidityValue, sizeof(provider->mHumidityValue));
@@ -279,8 +323,7 @@ uint8_t BleEnvironmentalDataProvider::HumidityGATTReadCallback(bt_conn *conn, ui
 		memcpy(&newValue, data, sizeof(newValue));
 		if (newValue != provider->mHumidityValue) {
 			provider->mHumidityValue = newValue;
-			DeviceLayer::PlatformMgr().ScheduleWork(NotifyHumidityAttributeChange,
-								reinterpret_cast<intptr_t>(provider));
+			provider->ScheduleNotification(kHumidityNotificationPending, NotifyHumidityAttributeChange);
 		}
 	} else {
 		LOG_ERR("Unsuccessful GATT read operation (err %d)", att_err);
@@ -10,6 +10,8 @@
 #include "ble_connectivity_manager.h"
 #include "bridged_device_data_provider.h"
 
+#include <zephyr/sys/atomic.h>
+
 class BleEnvironmentalDataProvider : public Nrf::BLEBridgedDeviceProvider {
 public:
 	explicit BleEnvironmentalDataProvider(UpdateAttributeCallback updateCallback, InvokeCommandCallback commandCallback) : Nrf::BLEBridgedDeviceProvider(updateCallback, commandCallback) {}
@@ -21,10 +23,15 @@ public:
 	CHIP_ERROR UpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, uint8_t *buffer) override;
 	bt_uuid *GetServiceUuid() override;
 	int ParseDiscoveredData(bt_gatt_dm *discoveredData) override;
+	uint8_t GetGattHandles(uint16_t *handles, uint8_t maxCount) override;
+	int RestoreGattHandles(const uint16_t *handles, uint8_t count) override;
 
 private:
 	static constexpr uint32_t kMeasurementsIntervalMs{ CONFIG_BRIDGE_BLE_DEVICE_POLLING_INTERVAL };
+	static constexpr int kTemperatureNotificationPending{ 0 };
+	static constexpr int kHumidityNotificationPending{ 1 };
 
+	void ScheduleNotification(int pendingBit, void (*notifyHandler)(intptr_t));
 	void StartHumidityTimer();
 	void StopHumidityTimer() { k_timer_stop(&mHumidityTimer); }
 	void Subscribe();
@@ -60,5 +67,8 @@ private:
 
 	k_timer mHumidityTimer;
 
+	/* Bits of the attribute notifications already scheduled on the CHIP thread. */
+	atomic_t mPendingNotifications{ ATOMIC_INIT(0) };
+
 	static bt_gatt_read_params sHumidityReadParams;
 };
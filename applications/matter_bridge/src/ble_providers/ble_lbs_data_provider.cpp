@@ -248,6 +248,35 @@ int BleLBSDataProvider::ParseDiscoveredData(bt_gatt_dm *discoveredData)
 	return 0;
 }
 
+uint8_t BleLBSDataProvider::GetGattHandles(uint16_t *handles, uint8_t maxCount)
+{
+	const uint16_t discoveredHandles[] = { mLedCharacteristicHandle, mButtonCharacteristicHandle, mCccHandle };
+
+	if (!handles || maxCount < ARRAY_SIZE(discoveredHandles)) {
+		return 0;
+	}
+
+	memcpy(handles, discoveredHandles, sizeof(discoveredHandles));
+
+	return ARRAY_SIZE(discoveredHandles);
+}
+
+int BleLBSDataProvider::RestoreGattHandles(const uint16_t *handles, uint8_t count)
+{
+	if (!handles || count != 3) {
+		return -EINVAL;
+	}
+
+	mLedCharacteristicHandle = handles[0];
+	mButtonCharacteristicHandle = handles[1];
+	mCccHandle = handles[2];
+
+	/* All characteristics are restored so start the new subscription */
+	Subscribe();
+
+	return 0;
+}
+
 void BleLBSDataProvider::NotifyOnOffAttributeChange(intptr_t context)
 {
 	BleLBSDataProvider *provider = reinterpret_cast<BleLBSDataProvider *>(context);
@@ -35,6 +35,8 @@ public:
 
 	bt_uuid *GetServiceUuid() override;
 	int ParseDiscoveredData(bt_gatt_dm *discoveredData) override;
+	uint8_t GetGattHandles(uint16_t *handles, uint8_t maxCount) override;
+	int RestoreGattHandles(const uint16_t *handles, uint8_t count) override;
 
 private:
 	void Subscribe();
@@ -113,6 +113,23 @@ static int RemoveBridgedDeviceHandler(const struct shell *shell, size_t argc, ch
 	return 0;
 }
 
+template <typename Pool> static void PrintPoolStatistics(const struct shell *shell, const char *name, Pool &pool)
+{
+	shell_fprintf(shell, SHELL_INFO, "%s: used %zu/%zu blocks of %zu B", name, pool.Used(), pool.Capacity(),
+		      Pool::kBlockSize);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	shell_fprintf(shell, SHELL_INFO, ", peak %zu", pool.MaxUsed());
+#endif
+	shell_fprintf(shell, SHELL_INFO, ", failed allocations %zu\n", pool.FailedAllocations());
+}
+
+static int PoolStatisticsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	PrintPoolStatistics(shell, "Bridged devices", Nrf::BridgeManager::Instance().GetBridgedDevicePool());
+	PrintPoolStatistics(shell, "Data providers", Nrf::BridgeManager::Instance().GetDataProviderPool());
+	return 0;
+}
+
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 static int SimulatedBridgedDeviceOnOffWriteHandler(const struct shell *shell, size_t argc, char **argv)
 {
@@ -251,6 +268,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		"Usage: remove <bridged_device_endpoint_id>\n"
 		"* bridged_device_endpoint_id - the bridged device's endpoint on which it was previously created\n",
 		RemoveBridgedDeviceHandler, 2, 0),
+	SHELL_CMD_ARG(pool, NULL,
+		      "Prints occupancy statistics of the bridged devices and data providers pools. \n"
+		      "Usage: pool\n",
+		      PoolStatisticsHandler, 1, 0),
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 	SHELL_CMD_ARG(
 		onoff, NULL,
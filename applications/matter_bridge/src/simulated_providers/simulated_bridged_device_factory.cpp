@@ -16,13 +16,13 @@ namespace
 {
 CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataProvider *provider, uint8_t index)
 {
-	uint16_t endpointId;
+	Nrf::BridgeStorageManager::BridgedDeviceRecord record;
 	uint8_t count = 0;
 	uint8_t indexes[Nrf::BridgeManager::kMaxBridgedDevices] = { 0 };
 	bool deviceRefresh = false;
 
 	/* Check if a device is already present in the storage. */
-	if (Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceEndpointId(endpointId, index)) {
+	if (Nrf::BridgeStorageManager::Instance().LoadBridgedDeviceRecord(record, index)) {
 		deviceRefresh = true;
 	}
 
@@ -53,102 +53,84 @@ CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataP
 
 	return CHIP_NO_ERROR;
 }
-} /* namespace */
 
-SimulatedBridgedDeviceFactory::BridgedDeviceFactory &SimulatedBridgedDeviceFactory::GetBridgedDeviceFactory()
+using BridgedDeviceCreator = SimulatedBridgedDeviceFactory::BridgedDeviceFactory::Creator;
+using DataProviderCreator = SimulatedBridgedDeviceFactory::SimulatedDataProviderFactory::Creator;
+
+template <typename T> Nrf::MatterBridgedDevice *CreateBridgedDevice(const char *nodeLabel)
 {
-	auto checkLabel = [](const char *nodeLabel) {
-		/* If node label is provided it must fit the maximum defined length */
-		if (!nodeLabel || (nodeLabel && (strlen(nodeLabel) < Nrf::MatterBridgedDevice::kNodeLabelSize))) {
-			return true;
-		}
-		return false;
-	};
+	/* If node label is provided it must fit the maximum defined length */
+	if (nodeLabel && strlen(nodeLabel) >= Nrf::MatterBridgedDevice::kNodeLabelSize) {
+		return nullptr;
+	}
+	return Nrf::BridgeManager::Instance().GetBridgedDevicePool().New<T>(nodeLabel);
+}
 
-	static BridgedDeviceFactory sBridgedDeviceFactory{
+template <typename T>
+Nrf::BridgedDeviceDataProvider *CreateDataProvider(SimulatedBridgedDeviceFactory::UpdateAttributeCallback updateClb,
+						   SimulatedBridgedDeviceFactory::InvokeCommandCallback commandClb)
+{
+	return Nrf::BridgeManager::Instance().GetDataProviderPool().New<T>(updateClb, commandClb);
+}
+
+constexpr std::initializer_list<BridgedDeviceCreator> kBridgedDeviceCreators{
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::OnOffLight,
-		  [checkLabel](const char *nodeLabel) -> Nrf::MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<OnOffLightDevice>(nodeLabel);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::OnOffLight, &CreateBridgedDevice<OnOffLightDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::GenericSwitch,
-		  [checkLabel](const char *nodeLabel) -> Nrf::MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<GenericSwitchDevice>(nodeLabel);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::GenericSwitch, &CreateBridgedDevice<GenericSwitchDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::OnOffLightSwitch,
-		  [checkLabel](const char *nodeLabel) -> Nrf::MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<OnOffLightSwitchDevice>(nodeLabel);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::OnOffLightSwitch, &CreateBridgedDevice<OnOffLightSwitchDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_TEMPERATURE_SENSOR_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::TemperatureSensor,
-		  [checkLabel](const char *nodeLabel) -> Nrf::MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<TemperatureSensorDevice>(nodeLabel);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::TemperatureSensor, &CreateBridgedDevice<TemperatureSensorDevice> },
 #endif
 #ifdef CONFIG_BRIDGE_HUMIDITY_SENSOR_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::HumiditySensor,
-		  [checkLabel](const char *nodeLabel) -> Nrf::MatterBridgedDevice * {
-			  if (!checkLabel(nodeLabel)) {
-				  return nullptr;
-			  }
-			  return chip::Platform::New<HumiditySensorDevice>(nodeLabel);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::HumiditySensor, &CreateBridgedDevice<HumiditySensorDevice> },
 #endif
-	};
-	return sBridgedDeviceFactory;
-}
+};
 
-SimulatedBridgedDeviceFactory::SimulatedDataProviderFactory &SimulatedBridgedDeviceFactory::GetDataProviderFactory()
-{
-	static SimulatedDataProviderFactory sDeviceDataProvider{
+constexpr std::initializer_list<DataProviderCreator> kDataProviderCreators{
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::OnOffLight,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<SimulatedOnOffLightDataProvider>(updateClb, commandClb);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::OnOffLight, &CreateDataProvider<SimulatedOnOffLightDataProvider> },
 #endif
 #ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::GenericSwitch,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<SimulatedGenericSwitchDataProvider>(updateClb, commandClb);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::GenericSwitch,
+	  &CreateDataProvider<SimulatedGenericSwitchDataProvider> },
 #endif
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::OnOffLightSwitch,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<SimulatedOnOffLightSwitchDataProvider>(updateClb, commandClb);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::OnOffLightSwitch,
+	  &CreateDataProvider<SimulatedOnOffLightSwitchDataProvider> },
 #endif
 #ifdef CONFIG_BRIDGE_TEMPERATURE_SENSOR_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::TemperatureSensor,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<SimulatedTemperatureSensorDataProvider>(updateClb, commandClb);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::TemperatureSensor,
+	  &CreateDataProvider<SimulatedTemperatureSensorDataProvider> },
 #endif
 #ifdef CONFIG_BRIDGE_HUMIDITY_SENSOR_BRIDGED_DEVICE
-		{ Nrf::MatterBridgedDevice::DeviceType::HumiditySensor,
-		  [](UpdateAttributeCallback updateClb, InvokeCommandCallback commandClb) {
-			  return chip::Platform::New<SimulatedHumiditySensorDataProvider>(updateClb, commandClb);
-		  } },
+	{ Nrf::MatterBridgedDevice::DeviceType::HumiditySensor,
+	  &CreateDataProvider<SimulatedHumiditySensorDataProvider> },
 #endif
-	};
+};
+
+constexpr auto kBridgedDeviceCreatorTable =
+	SimulatedBridgedDeviceFactory::BridgedDeviceFactory::MakeCreatorTable<kBridgedDeviceCreators.size()>(
+		kBridgedDeviceCreators);
+constexpr auto kDataProviderCreatorTable =
+	SimulatedBridgedDeviceFactory::SimulatedDataProviderFactory::MakeCreatorTable<kDataProviderCreators.size()>(
+		kDataProviderCreators);
+} /* namespace */
+
+const SimulatedBridgedDeviceFactory::BridgedDeviceFactory &SimulatedBridgedDeviceFactory::GetBridgedDeviceFactory()
+{
+	static constexpr BridgedDeviceFactory sBridgedDeviceFactory{ kBridgedDeviceCreatorTable };
+	return sBridgedDeviceFactory;
+}
+
+const SimulatedBridgedDeviceFactory::SimulatedDataProviderFactory &
+SimulatedBridgedDeviceFactory::GetDataProviderFactory()
+{
+	static constexpr SimulatedDataProviderFactory sDeviceDataProvider{ kDataProviderCreatorTable };
 	return sDeviceDataProvider;
 }
 
@@ -170,6 +152,7 @@ CHIP_ERROR SimulatedBridgedDeviceFactory::CreateDevice(int deviceType, const cha
 
 	if (!newBridgedDevice) {
 		LOG_ERR("Cannot allocate Matter device of given type");
+		Nrf::BridgeManager::Instance().GetDataProviderPool().Delete(provider);
 		return CHIP_ERROR_NO_MEMORY;
 	}
 
@@ -231,16 +214,8 @@ CHIP_ERROR SimulatedBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	if (!Nrf::BridgeStorageManager::Instance().RemoveBridgedDeviceEndpointId(index)) {
-		LOG_ERR("Failed to remove bridged device endpoint id.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
-	/* Ignore error, as node label may not be present in the storage. */
-	Nrf::BridgeStorageManager::Instance().RemoveBridgedDeviceNodeLabel(index);
-
-	if (!Nrf::BridgeStorageManager::Instance().RemoveBridgedDeviceType(index)) {
-		LOG_ERR("Failed to remove bridged device type.");
+	if (!Nrf::BridgeStorageManager::Instance().RemoveBridgedDeviceRecord(index)) {
+		LOG_ERR("Failed to remove bridged device.");
 		return CHIP_ERROR_INTERNAL;
 	}
 
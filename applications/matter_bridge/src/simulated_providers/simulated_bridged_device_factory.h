@@ -44,8 +44,8 @@ using DeviceType = uint16_t;
 using BridgedDeviceFactory = Nrf::DeviceFactory<Nrf::MatterBridgedDevice, DeviceType, const char *>;
 using SimulatedDataProviderFactory = Nrf::DeviceFactory<Nrf::BridgedDeviceDataProvider, DeviceType, UpdateAttributeCallback, InvokeCommandCallback>;
 
-BridgedDeviceFactory &GetBridgedDeviceFactory();
-SimulatedDataProviderFactory &GetDataProviderFactory();
+const BridgedDeviceFactory &GetBridgedDeviceFactory();
+const SimulatedDataProviderFactory &GetDataProviderFactory();
 
 /**
  * @brief Create a bridged device.
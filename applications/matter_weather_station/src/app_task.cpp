@@ -27,6 +27,8 @@
 #include <app/server/OnboardingCodesUtil.h>
 #include <app/server/Server.h>
 
+#include <cstdlib>
+
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/logging/log.h>
 
@@ -45,7 +47,8 @@ enum class LedState { kAlive, kAdvertisingBle, kConnectedBle, kProvisioned };
 #error Invalid CONFIG_AVERAGE_CURRENT_CONSUMPTION value set
 #endif
 
-constexpr size_t kMeasurementsIntervalMs = 3000;
+constexpr uint32_t kMeasurementMinIntervalMs = CONFIG_MEASUREMENT_MIN_INTERVAL_MS;
+constexpr uint32_t kMeasurementMaxIntervalMs = CONFIG_MEASUREMENT_MAX_INTERVAL_MS;
 constexpr uint8_t kTemperatureMeasurementEndpointId = 1;
 constexpr int16_t kTemperatureMeasurementAttributeMaxValue = 0x7fff;
 constexpr int16_t kTemperatureMeasurementAttributeMinValue = 0x954d;
@@ -75,9 +78,67 @@ constexpr uint32_t kFullBatteryOperationTime = kBatteryCapacityUaH / kDeviceAver
 /* It is recommended to toggle the signalled state with 0.5 s interval. */
 constexpr size_t kIdentifyTimerIntervalMs = 500;
 
+/*
+ * Sampling schedule of a single measurement.
+ *
+ * The sampling interval is doubled, up to the maximum interval, each time the sampled value does not differ
+ * from the last reported one by at least the report threshold, and it drops back to the minimum interval
+ * once the value changes. The attribute is updated only if the value has changed by at least the threshold,
+ * or if it has not been updated for the maximum interval.
+ */
+class MeasurementSchedule {
+public:
+	explicit MeasurementSchedule(uint32_t reportThreshold) : mReportThreshold(reportThreshold) {}
+
+	int64_t GetNextSampleTime() const { return mNextSampleMs; }
+
+	/* Measurements that are due within half of their interval are sampled along with the due ones. */
+	bool IsDue(int64_t now) const { return mNextSampleMs - now <= static_cast<int64_t>(mIntervalMs / 2); }
+
+	bool OnSample(int32_t value, int64_t now)
+	{
+		const bool changed =
+			!mReported || abs(value - mLastReportedValue) >= static_cast<int32_t>(mReportThreshold);
+		const bool stale = now - mLastReportMs >= kMeasurementMaxIntervalMs;
+
+		mIntervalMs = changed ? kMeasurementMinIntervalMs : MIN(mIntervalMs * 2, kMeasurementMaxIntervalMs);
+		mNextSampleMs = now + mIntervalMs;
+
+		if (!changed && !stale) {
+			return false;
+		}
+
+		mReported = true;
+		mLastReportedValue = value;
+		mLastReportMs = now;
+
+		return true;
+	}
+
+	void OnSampleFailed(int64_t now)
+	{
+		mIntervalMs = kMeasurementMinIntervalMs;
+		mNextSampleMs = now + mIntervalMs;
+	}
+
+private:
+	const uint32_t mReportThreshold;
+	uint32_t mIntervalMs = kMeasurementMinIntervalMs;
+	int64_t mNextSampleMs = 0;
+	int64_t mLastReportMs = 0;
+	int32_t mLastReportedValue = 0;
+	bool mReported = false;
+};
+
 k_timer sMeasurementsTimer;
 k_timer sIdentifyTimer;
 
+MeasurementSchedule sTemperatureSchedule{ CONFIG_TEMPERATURE_REPORT_THRESHOLD };
+MeasurementSchedule sPressureSchedule{ CONFIG_PRESSURE_REPORT_THRESHOLD };
+MeasurementSchedule sHumiditySchedule{ CONFIG_HUMIDITY_REPORT_THRESHOLD };
+MeasurementSchedule sPowerSourceSchedule{ CONFIG_BATTERY_VOLTAGE_REPORT_THRESHOLD };
+Clusters::PowerSource::BatChargeStateEnum sBatteryChargeState = Clusters::PowerSource::BatChargeStateEnum::kUnknown;
+
 const device *sBme688SensorDev = DEVICE_DT_GET_ONE(bosch_bme680);
 
 /* Add identify for all endpoints */
@@ -113,7 +174,7 @@ void AppTask::IdentifyTimerHandler()
 	BuzzerToggleState();
 }
 
-void AppTask::UpdateTemperatureClusterState()
+void AppTask::UpdateTemperatureClusterState(int64_t now)
 {
 	struct sensor_value sTemperature;
 	EmberAfStatus status;
@@ -130,17 +191,22 @@ void AppTask::UpdateTemperatureClusterState()
 			newValue = kTemperatureMeasurementAttributeInvalidValue;
 		}
 
+		if (!sTemperatureSchedule.OnSample(newValue, now)) {
+			return;
+		}
+
 		status = Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Set(
 			kTemperatureMeasurementEndpointId, newValue);
 		if (status != EMBER_ZCL_STATUS_SUCCESS) {
 			LOG_ERR("Updating temperature measurement %x", status);
 		}
 	} else {
+		sTemperatureSchedule.OnSampleFailed(now);
 		LOG_ERR("Getting temperature measurement data from BME688 failed with: %d", result);
 	}
 }
 
-void AppTask::UpdatePressureClusterState()
+void AppTask::UpdatePressureClusterState(int64_t now)
 {
 	struct sensor_value sPressure;
 	EmberAfStatus status;
@@ -157,17 +223,22 @@ void AppTask::UpdatePressureClusterState()
 			newValue = kPressureMeasurementAttributeInvalidValue;
 		}
 
+		if (!sPressureSchedule.OnSample(newValue, now)) {
+			return;
+		}
+
 		status = Clusters::PressureMeasurement::Attributes::MeasuredValue::Set(kPressureMeasurementEndpointId,
 										       newValue);
 		if (status != EMBER_ZCL_STATUS_SUCCESS) {
 			LOG_ERR("Updating pressure measurement %x", status);
 		}
 	} else {
+		sPressureSchedule.OnSampleFailed(now);
 		LOG_ERR("Getting pressure measurement data from BME688 failed with: %d", result);
 	}
 }
 
-void AppTask::UpdateRelativeHumidityClusterState()
+void AppTask::UpdateRelativeHumidityClusterState(int64_t now)
 {
 	struct sensor_value sHumidity;
 	EmberAfStatus status;
@@ -184,17 +255,22 @@ void AppTask::UpdateRelativeHumidityClusterState()
 			newValue = kHumidityMeasurementAttributeInvalidValue;
 		}
 
+		if (!sHumiditySchedule.OnSample(newValue, now)) {
+			return;
+		}
+
 		status = Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Set(
 			kHumidityMeasurementEndpointId, newValue);
 		if (status != EMBER_ZCL_STATUS_SUCCESS) {
 			LOG_ERR("Updating relative humidity measurement %x", status);
 		}
 	} else {
+		sHumiditySchedule.OnSampleFailed(now);
 		LOG_ERR("Getting humidity measurement data from BME688 failed with: %d", result);
 	}
 }
 
-void AppTask::UpdatePowerSourceClusterState()
+void AppTask::UpdatePowerSourceClusterState(int64_t now)
 {
 	EmberAfStatus status;
 	int32_t voltage = BatteryMeasurementReadVoltageMv();
@@ -243,6 +319,16 @@ void AppTask::UpdatePowerSourceClusterState()
 		batteryCharged = Clusters::PowerSource::BatChargeStateEnum::kIsNotCharging;
 	}
 
+	/* Report a change of the charging state immediately, regardless of the voltage change. */
+	if (batteryCharged != sBatteryChargeState) {
+		sPowerSourceSchedule = MeasurementSchedule{ CONFIG_BATTERY_VOLTAGE_REPORT_THRESHOLD };
+		sBatteryChargeState = batteryCharged;
+	}
+
+	if (!sPowerSourceSchedule.OnSample(voltage, now)) {
+		return;
+	}
+
 	status = Clusters::PowerSource::Attributes::BatVoltage::Set(kPowerSourceEndpointId, voltage);
 	if (status != EMBER_ZCL_STATUS_SUCCESS) {
 		LOG_ERR("Updating battery voltage failed %x", status);
@@ -281,17 +367,43 @@ void AppTask::UpdatePowerSourceClusterState()
 
 void AppTask::UpdateClustersState()
 {
-	const int result = sensor_sample_fetch(sBme688SensorDev);
+	const int64_t now = k_uptime_get();
+	const bool temperatureDue = sTemperatureSchedule.IsDue(now);
+	const bool pressureDue = sPressureSchedule.IsDue(now);
+	const bool humidityDue = sHumiditySchedule.IsDue(now);
+
+	/* A single fetch reads all channels of the BME688 sensor in one burst, so share it between measurements. */
+	if (temperatureDue || pressureDue || humidityDue) {
+		const int result = sensor_sample_fetch(sBme688SensorDev);
+
+		if (result == 0) {
+			if (temperatureDue) {
+				UpdateTemperatureClusterState(now);
+			}
+			if (pressureDue) {
+				UpdatePressureClusterState(now);
+			}
+			if (humidityDue) {
+				UpdateRelativeHumidityClusterState(now);
+			}
+		} else {
+			sTemperatureSchedule.OnSampleFailed(now);
+			sPressureSchedule.OnSampleFailed(now);
+			sHumiditySchedule.OnSampleFailed(now);
+			LOG_ERR("Fetching data from BME688 sensor failed with: %d", result);
+		}
+	}
 
-	if (result == 0) {
-		UpdateTemperatureClusterState();
-		UpdatePressureClusterState();
-		UpdateRelativeHumidityClusterState();
-	} else {
-		LOG_ERR("Fetching data from BME688 sensor failed with: %d", result);
+	if (sPowerSourceSchedule.IsDue(now)) {
+		UpdatePowerSourceClusterState(now);
 	}
 
-	UpdatePowerSourceClusterState();
+	/* Wake up only when the next measurement is due */
+	const int64_t nextSampleTime =
+		MIN(MIN(sTemperatureSchedule.GetNextSampleTime(), sPressureSchedule.GetNextSampleTime()),
+		    MIN(sHumiditySchedule.GetNextSampleTime(), sPowerSourceSchedule.GetNextSampleTime()));
+
+	k_timer_start(&sMeasurementsTimer, K_MSEC(MAX(nextSampleTime - k_uptime_get(), 0)), K_NO_WAIT);
 }
 
 void AppTask::UpdateLedState()
@@ -389,7 +501,7 @@ CHIP_ERROR AppTask::Init()
 		&sMeasurementsTimer, [](k_timer *) { Nrf::PostTask([] { MeasurementsTimerHandler(); }); }, nullptr);
 	k_timer_init(
 		&sIdentifyTimer, [](k_timer *) { Nrf::PostTask([] { IdentifyTimerHandler(); }); }, nullptr);
-	k_timer_start(&sMeasurementsTimer, K_MSEC(kMeasurementsIntervalMs), K_MSEC(kMeasurementsIntervalMs));
+	k_timer_start(&sMeasurementsTimer, K_MSEC(kMeasurementMinIntervalMs), K_NO_WAIT);
 
 	return Nrf::Matter::StartServer();
 }
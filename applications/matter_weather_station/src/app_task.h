@@ -29,10 +29,10 @@ public:
 private:
 	CHIP_ERROR Init();
 
-	void UpdateTemperatureClusterState();
-	void UpdatePressureClusterState();
-	void UpdateRelativeHumidityClusterState();
-	void UpdatePowerSourceClusterState();
+	void UpdateTemperatureClusterState(int64_t now);
+	void UpdatePressureClusterState(int64_t now);
+	void UpdateRelativeHumidityClusterState(int64_t now);
+	void UpdatePowerSourceClusterState(int64_t now);
 
 	static void MeasurementsTimerHandler();
 	static void IdentifyTimerHandler();
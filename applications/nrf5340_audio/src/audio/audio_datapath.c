@@ -19,6 +19,7 @@
 #include "led.h"
 #include "audio_i2s.h"
 #include "sw_codec_select.h"
+#include "sample_rate_converter.h"
 #include "audio_system.h"
 #include "tone.h"
 #include "contin_array.h"
@@ -84,6 +85,13 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 /* To get smaller corrections */
 #define DRIFT_REGULATOR_DIV_FACTOR 2
 
+/* Scaled sample rate given to the drift compensation ASRC, giving a resolution of 0.1 ppm */
+#define DRIFT_ASRC_RATE_NOMINAL 10000000
+/* One HFCLKAUDIO frequency step changes the audio clock by 3.31 ppm */
+/* clang-format off */
+#define DRIFT_ASRC_RATE_ADJ(f) (((f)*331) / 10)
+/* clang-format on */
+
 /* To allow BLE transmission and (host -> HCI -> controller) */
 #if defined(CONFIG_BT_LL_ACS_NRF53)
 #define JUST_IN_TIME_TARGET_DLY_US (CONFIG_AUDIO_FRAME_DURATION_US - 3000)
@@ -95,6 +103,15 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 /* How often to print under-run warning */
 #define UNDERRUN_LOG_INTERVAL_BLKS 5000
 
+/* Decay of the adaptive jitter buffer's peak jitter per frame, as a right shift */
+#define JITTER_BUF_PEAK_DECAY_SHIFT 6
+/* Number of frames between two depth adjustments of the adaptive jitter buffer */
+#define JITTER_BUF_ADJ_INTERVAL	    4
+/* Block of a frame where the time-stretch splice is made */
+#define JITTER_BUF_SPLICE_BLK	    (NUM_BLKS_IN_FRAME / 2)
+/* Maximum depth of the adaptive jitter buffer, leaving room for a stretched frame */
+#define JITTER_BUF_MAX_BLKS	    (FIFO_NUM_BLKS - NUM_BLKS_IN_FRAME - 2)
+
 enum drift_comp_state {
 	DRIFT_STATE_INIT,   /* Waiting for data to be received */
 	DRIFT_STATE_CALIB,  /* Calibrate and zero out local delay */
@@ -155,6 +172,10 @@ static struct {
 		uint32_t meas_start_time_us;
 		uint32_t center_freq;
 		bool enabled;
+		/* Input rate of the ASRC, set instead of the frequency of HFCLKAUDIO */
+		uint32_t asrc_rate_input;
+		/* Time the resampling has shifted the audio by, modulo one block */
+		uint32_t asrc_shift_ns;
 	} drift_comp;
 
 	struct {
@@ -164,8 +185,30 @@ static struct {
 		uint32_t pres_delay_us;
 		bool enabled;
 	} pres_comp;
+
+	struct {
+		uint32_t prev_recv_ts_us;
+		uint32_t prev_blk_underruns;
+		uint32_t jitter_peak_us; /* Peak frame arrival jitter, decaying */
+		uint16_t target_blks;	 /* Wanted number of blocks in FIFO when a frame arrives */
+		uint16_t ctr;		 /* Count frames since the last depth adjustment */
+		/* Statistics */
+		uint32_t blks_inserted;
+		uint32_t blks_removed;
+	} jitter_buf;
 } ctrl_blk;
 
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+static struct {
+	struct sample_rate_converter_polyphase_ctx ctx;
+	/* Resampled audio not yet added to the output FIFO. Room for a frame plus one block of
+	 * stretched audio and one block of remainder from the previous frame.
+	 */
+	uint8_t buf[(NUM_BLKS_IN_FRAME + 2) * BLK_STEREO_SIZE_OCTETS] __aligned(4);
+	size_t buf_size;
+} drift_asrc;
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
+
 static bool tone_active;
 /* Buffer which can hold max 1 period test tone at 100 Hz */
 static uint16_t test_tone_buf[CONFIG_AUDIO_SAMPLE_RATE_HZ / 100];
@@ -228,6 +271,29 @@ static void hfclkaudio_set(uint16_t freq_value)
 	nrfx_clock_hfclkaudio_config_set(freq_val);
 }
 
+/**
+ * @brief	Set the audio clock to a HFCLKAUDIO frequency value.
+ *
+ * @details	With CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC the clock is not tuned. The offset
+ *		from the center frequency is instead applied as the ratio of the ASRC on the
+ *		output stream, by the stream thread before the next frame is resampled.
+ *
+ * @param	freq_value	HFCLKAUDIO frequency value.
+ */
+static void drift_comp_freq_set(uint16_t freq_value)
+{
+	if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC)) {
+		int32_t freq_adj =
+			CLAMP(freq_value, APLL_FREQ_MIN, APLL_FREQ_MAX) - APLL_FREQ_CENTER;
+
+		/* A faster clock would play the frames faster, so fewer samples are produced */
+		ctrl_blk.drift_comp.asrc_rate_input =
+			DRIFT_ASRC_RATE_NOMINAL + DRIFT_ASRC_RATE_ADJ(freq_adj);
+	} else {
+		hfclkaudio_set(freq_value);
+	}
+}
+
 static void drift_comp_state_set(enum drift_comp_state new_state)
 {
 	if (new_state == ctrl_blk.drift_comp.state) {
@@ -244,6 +310,9 @@ static void drift_comp_state_set(enum drift_comp_state new_state)
  *
  * @note	The audio sync is based on sdu_ref_us.
  *
+ * @note	With CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC the output stream is resampled instead,
+ *		see drift_comp_freq_set().
+ *
  * @param	frame_start_ts_us	I2S frame start timestamp.
  */
 static void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
@@ -287,7 +356,7 @@ static void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 			return;
 		}
 
-		hfclkaudio_set(ctrl_blk.drift_comp.center_freq);
+		drift_comp_freq_set(ctrl_blk.drift_comp.center_freq);
 
 		drift_comp_state_set(DRIFT_STATE_OFFSET);
 
@@ -307,7 +376,7 @@ static void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 		err_us /= DRIFT_REGULATOR_DIV_FACTOR;
 		int32_t freq_adj = APLL_FREQ_ADJ(err_us);
 
-		hfclkaudio_set(ctrl_blk.drift_comp.center_freq + freq_adj);
+		drift_comp_freq_set(ctrl_blk.drift_comp.center_freq + freq_adj);
 
 		if ((err_us < DRIFT_ERR_THRESH_LOCK) && (err_us > -DRIFT_ERR_THRESH_LOCK)) {
 			drift_comp_state_set(DRIFT_STATE_LOCKED);
@@ -329,7 +398,7 @@ static void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 		err_us /= DRIFT_REGULATOR_DIV_FACTOR;
 		int32_t freq_adj = APLL_FREQ_ADJ(err_us);
 
-		hfclkaudio_set(ctrl_blk.drift_comp.center_freq + freq_adj);
+		drift_comp_freq_set(ctrl_blk.drift_comp.center_freq + freq_adj);
 
 		if ((err_us > DRIFT_ERR_THRESH_UNLOCK) || (err_us < -DRIFT_ERR_THRESH_UNLOCK)) {
 			drift_comp_state_set(DRIFT_STATE_INIT);
@@ -494,6 +563,178 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 	}
 }
 
+/**
+ * @brief	Get the number of audio blocks in the output FIFO.
+ */
+static uint32_t out_fifo_num_blks_get(void)
+{
+	return (ctrl_blk.out.prod_blk_idx + FIFO_NUM_BLKS - ctrl_blk.out.cons_blk_idx) %
+	       FIFO_NUM_BLKS;
+}
+
+/**
+ * @brief	Update the adaptive jitter buffer with a new frame.
+ *
+ * @details	The arrival jitter is the deviation of the time between two frames from the
+ *		frame duration. The FIFO shall hold enough blocks when a frame arrives to bridge
+ *		the peak jitter, so the target depth follows the slowly decaying peak. Under-runs
+ *		raise the peak. The depth is moved towards the target by at most one block every
+ *		JITTER_BUF_ADJ_INTERVAL frames.
+ *
+ * @param	recv_frame_ts_us	Timestamp of when frame was received.
+ * @param	num_blks_in_fifo	Number of blocks in the output FIFO.
+ * @param	sdu_ref_not_consecutive	True if the frame does not follow the previous frame.
+ *
+ * @return	Number of blocks to insert into (positive) or remove from (negative) the frame.
+ */
+static int32_t jitter_buf_adjust(uint32_t recv_frame_ts_us, uint32_t num_blks_in_fifo,
+				 bool sdu_ref_not_consecutive)
+{
+	if (ctrl_blk.jitter_buf.prev_recv_ts_us != 0 && !sdu_ref_not_consecutive) {
+		uint32_t delta_us = recv_frame_ts_us - ctrl_blk.jitter_buf.prev_recv_ts_us;
+		int32_t jitter_us = (int32_t)delta_us - CONFIG_AUDIO_FRAME_DURATION_US;
+
+		ctrl_blk.jitter_buf.jitter_peak_us -=
+			ctrl_blk.jitter_buf.jitter_peak_us >> JITTER_BUF_PEAK_DECAY_SHIFT;
+		ctrl_blk.jitter_buf.jitter_peak_us =
+			MAX(ctrl_blk.jitter_buf.jitter_peak_us, (uint32_t)abs(jitter_us));
+	}
+
+	ctrl_blk.jitter_buf.prev_recv_ts_us = recv_frame_ts_us;
+
+	if (ctrl_blk.out.total_blk_underruns != ctrl_blk.jitter_buf.prev_blk_underruns) {
+		ctrl_blk.jitter_buf.prev_blk_underruns = ctrl_blk.out.total_blk_underruns;
+		ctrl_blk.jitter_buf.jitter_peak_us += BLK_PERIOD_US;
+	}
+
+	ctrl_blk.jitter_buf.target_blks =
+		CLAMP(DIV_ROUND_UP(ctrl_blk.jitter_buf.jitter_peak_us, BLK_PERIOD_US) +
+			      CONFIG_AUDIO_DATAPATH_JITTER_BUFFER_MIN_BLKS,
+		      CONFIG_AUDIO_DATAPATH_JITTER_BUFFER_MIN_BLKS, JITTER_BUF_MAX_BLKS);
+
+	if (ctrl_blk.jitter_buf.ctr < JITTER_BUF_ADJ_INTERVAL) {
+		ctrl_blk.jitter_buf.ctr++;
+		return 0;
+	}
+
+	if (num_blks_in_fifo < ctrl_blk.jitter_buf.target_blks) {
+		ctrl_blk.jitter_buf.ctr = 0;
+		ctrl_blk.jitter_buf.blks_inserted++;
+		return 1;
+	}
+
+	/* One block of hysteresis to not toggle between stretching and compressing */
+	if (num_blks_in_fifo > (ctrl_blk.jitter_buf.target_blks + 1)) {
+		ctrl_blk.jitter_buf.ctr = 0;
+		ctrl_blk.jitter_buf.blks_removed++;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief	Cross-fade between two stereo audio blocks.
+ *
+ * @param	out		Output block.
+ * @param	fade_out	Block faded out, starts at full level.
+ * @param	fade_in		Block faded in, ends at full level.
+ */
+static void blk_crossfade(void *out, void const *fade_out, void const *fade_in)
+{
+	for (uint32_t i = 0; i < BLK_STEREO_NUM_SAMPS; i++) {
+		/* Both samples of a stereo pair have the same weight */
+		int32_t weight = i / 2;
+
+		if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
+			int16_t const *a = fade_out;
+			int16_t const *b = fade_in;
+
+			((int16_t *)out)[i] =
+				(a[i] * (BLK_MONO_NUM_SAMPS - weight) + b[i] * weight) /
+				BLK_MONO_NUM_SAMPS;
+		} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
+			int32_t const *a = fade_out;
+			int32_t const *b = fade_in;
+
+			((int32_t *)out)[i] = ((int64_t)a[i] * (BLK_MONO_NUM_SAMPS - weight) +
+					       (int64_t)b[i] * weight) /
+					      BLK_MONO_NUM_SAMPS;
+		}
+	}
+}
+
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+static int drift_asrc_open(void)
+{
+	drift_asrc.buf_size = 0;
+	ctrl_blk.drift_comp.asrc_shift_ns = 0;
+
+	return sample_rate_converter_polyphase_open(&drift_asrc.ctx,
+						    ctrl_blk.drift_comp.asrc_rate_input,
+						    DRIFT_ASRC_RATE_NOMINAL, 2);
+}
+
+/**
+ * @brief	Resample a decoded frame by the ratio set by the drift compensation.
+ *
+ * @details	The resampled audio is added to what is left from the previous frame, so a
+ *		frame gives one block more or less whenever the drift adds up to a block.
+ *
+ * @param	pcm		Decoded stereo frame.
+ * @param	pcm_size	Size of the frame in bytes.
+ *
+ * @return	Number of complete blocks of resampled audio, or a negative error code.
+ */
+static int drift_asrc_process(void const *pcm, size_t pcm_size)
+{
+	int ret;
+	size_t written;
+	uint32_t rate_input = ctrl_blk.drift_comp.asrc_rate_input;
+
+	if (rate_input != drift_asrc.ctx.sample_rate_input) {
+		ret = sample_rate_converter_polyphase_ratio_set(&drift_asrc.ctx, rate_input,
+								DRIFT_ASRC_RATE_NOMINAL);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	ret = sample_rate_converter_polyphase_process(
+		&drift_asrc.ctx, pcm, pcm_size, &drift_asrc.buf[drift_asrc.buf_size],
+		sizeof(drift_asrc.buf) - drift_asrc.buf_size, &written);
+	if (ret) {
+		return ret;
+	}
+
+	drift_asrc.buf_size += written;
+
+	/* Keep track of how much later (or earlier) the audio is played */
+	int64_t shift_ns = ((int64_t)CONFIG_AUDIO_FRAME_DURATION_US * 1000 *
+			    ((int64_t)DRIFT_ASRC_RATE_NOMINAL - rate_input)) /
+			   rate_input;
+
+	ctrl_blk.drift_comp.asrc_shift_ns =
+		(ctrl_blk.drift_comp.asrc_shift_ns + (BLK_PERIOD_US * 1000) + shift_ns) %
+		(BLK_PERIOD_US * 1000);
+
+	return drift_asrc.buf_size / BLK_STEREO_SIZE_OCTETS;
+}
+
+/**
+ * @brief	Remove blocks from the start of the resampled audio.
+ *
+ * @param	num_blks	Number of blocks to remove.
+ */
+static void drift_asrc_consume(uint32_t num_blks)
+{
+	size_t size = num_blks * BLK_STEREO_SIZE_OCTETS;
+
+	memmove(drift_asrc.buf, &drift_asrc.buf[size], drift_asrc.buf_size - size);
+	drift_asrc.buf_size -= size;
+}
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
+
 static void tone_stop_worker(struct k_work *work)
 {
 	tone_active = false;
@@ -570,6 +811,25 @@ static struct {
 	bool buf_1_in_use;
 } alt;
 
+#if CONFIG_DATA_FIFO_SPSC
+/* Receives the I2S RX data that is dropped while in.fifo is full */
+static uint32_t rx_overrun_buf[BLOCK_SIZE_BYTES / sizeof(uint32_t)];
+#endif
+
+/**
+ * @brief	Checks if an I2S RX buffer holds data that is to be dropped.
+ *
+ * @param	p_buffer	Released I2S RX buffer.
+ */
+static bool rx_buffer_is_dropped(uint32_t const *const p_buffer)
+{
+#if CONFIG_DATA_FIFO_SPSC
+	return p_buffer == rx_overrun_buf;
+#else
+	return false;
+#endif
+}
+
 /**
  * @brief	Get first available alternative-buffer.
  *
@@ -693,7 +953,7 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 
 	if (IS_ENABLED(CONFIG_STREAM_BIDIRECTIONAL) || (CONFIG_AUDIO_DEV == GATEWAY)) {
 		/* Lock last filled buffer into message queue */
-		if (rx_buf_released != NULL) {
+		if ((rx_buf_released != NULL) && !rx_buffer_is_dropped(rx_buf_released)) {
 			ret = data_fifo_block_lock(ctrl_blk.in.fifo, (void **)&rx_buf_released,
 						   BLOCK_SIZE_BYTES);
 
@@ -710,14 +970,21 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 
 		/* If RX FIFO is filled up */
 		if (ret == -ENOMEM) {
-			void *data;
-			size_t size;
-
 			if (ret != prev_ret) {
 				LOG_WRN("I2S RX overrun. Single msg");
 				prev_ret = ret;
 			}
 
+#if CONFIG_DATA_FIFO_SPSC
+			/* Only the encoder thread reads from an SPSC FIFO, so drop the incoming
+			 * block instead of the oldest one.
+			 */
+			rx_buf = rx_overrun_buf;
+			ret = 0;
+#else
+			void *data;
+			size_t size;
+
 			ret = data_fifo_pointer_last_filled_get(ctrl_blk.in.fifo, &data, &size,
 								K_NO_WAIT);
 			ERR_CHK(ret);
@@ -726,6 +993,7 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 
 			ret = data_fifo_pointer_first_vacant_get(ctrl_blk.in.fifo, (void **)&rx_buf,
 								 K_NO_WAIT);
+#endif
 		}
 
 		ERR_CHK_MSG(ret, "RX failed to get block");
@@ -736,6 +1004,11 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 
 	/*** Drift compensation ***/
 	if (ctrl_blk.drift_comp.enabled) {
+		if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC)) {
+			/* The I2S frames do not move when resampling, but the audio in them does */
+			frame_start_ts_us += ctrl_blk.drift_comp.asrc_shift_ns / 1000;
+		}
+
 		audio_datapath_drift_compensation(frame_start_ts_us);
 	}
 }
@@ -986,27 +1259,60 @@ void audio_datapath_stream_out(const uint8_t *buf, size_t size, uint32_t sdu_ref
 		return;
 	}
 
+	/*** Drift compensation resampling ***/
+
+	uint8_t const *pcm_out = ctrl_blk.decoded_data;
+	uint32_t num_blks_out = NUM_BLKS_IN_FRAME;
+
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+	ret = drift_asrc_process(ctrl_blk.decoded_data, pcm_size);
+	if (ret < 0) {
+		LOG_WRN("Drift compensation resampling failed: %d", ret);
+		drift_asrc.buf_size = 0;
+		/* Discard frame */
+		return;
+	}
+
+	pcm_out = drift_asrc.buf;
+	num_blks_out = ret;
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
+
 	/*** Add audio data to FIFO buffer ***/
 
-	int32_t num_blks_in_fifo = ctrl_blk.out.prod_blk_idx - ctrl_blk.out.cons_blk_idx;
+	uint32_t num_blks_in_fifo = out_fifo_num_blks_get();
+	int32_t adj_blks = 0;
+
+	if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_JITTER_BUFFER)) {
+		adj_blks = jitter_buf_adjust(recv_frame_ts_us, num_blks_in_fifo,
+					     sdu_ref_not_consecutive);
+	}
 
-	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
+	if ((num_blks_in_fifo + num_blks_out + adj_blks) > FIFO_NUM_BLKS) {
 		LOG_WRN("Output audio stream overrun - Discarding audio frame");
 
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+		drift_asrc_consume(num_blks_out);
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
+
 		/* Discard frame to allow consumer to catch up */
 		return;
 	}
 
 	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
 
-	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
-		if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
-			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_STEREO_NUM_SAMPS],
-			       &((int16_t *)ctrl_blk.decoded_data)[i * BLK_STEREO_NUM_SAMPS],
-			       BLK_STEREO_SIZE_OCTETS);
-		} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
+	/* A time-stretched frame repeats (adj_blks = 1) or skips (adj_blks = -1) one block by
+	 * cross-fading into the block before or after the splice block.
+	 */
+	for (uint32_t i = 0; i < (num_blks_out + adj_blks); i++) {
+		uint32_t src_blk_idx = (i < JITTER_BUF_SPLICE_BLK) ? i : (i - adj_blks);
+
+		if (adj_blks != 0 && i == JITTER_BUF_SPLICE_BLK) {
+			blk_crossfade(&ctrl_blk.out.fifo[out_blk_idx * BLK_STEREO_NUM_SAMPS],
+				      &pcm_out[i * BLK_STEREO_SIZE_OCTETS],
+				      &pcm_out[src_blk_idx * BLK_STEREO_SIZE_OCTETS]);
+		} else {
 			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_STEREO_NUM_SAMPS],
-			       &((int32_t *)ctrl_blk.decoded_data)[i * BLK_STEREO_NUM_SAMPS],
+			       &pcm_out[src_blk_idx * BLK_STEREO_SIZE_OCTETS],
 			       BLK_STEREO_SIZE_OCTETS);
 		}
 
@@ -1017,6 +1323,10 @@ void audio_datapath_stream_out(const uint8_t *buf, size_t size, uint32_t sdu_ref
 	}
 
 	ctrl_blk.out.prod_blk_idx = out_blk_idx;
+
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+	drift_asrc_consume(num_blks_out);
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
 }
 
 int audio_datapath_start(struct data_fifo *fifo_rx)
@@ -1033,6 +1343,16 @@ int audio_datapath_start(struct data_fifo *fifo_rx)
 
 		/* Clear counters and mute initial audio */
 		memset(&ctrl_blk.out, 0, sizeof(ctrl_blk.out));
+		memset(&ctrl_blk.jitter_buf, 0, sizeof(ctrl_blk.jitter_buf));
+
+#if CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC
+		int ret = drift_asrc_open();
+
+		if (ret) {
+			LOG_ERR("Failed to open drift compensation ASRC: %d", ret);
+			return ret;
+		}
+#endif /* CONFIG_AUDIO_DATAPATH_DRIFT_COMP_ASRC */
 
 		audio_datapath_i2s_start();
 		ctrl_blk.stream_started = true;
@@ -1066,8 +1386,12 @@ int audio_datapath_init(void)
 	audio_i2s_init();
 	ctrl_blk.datapath_initialized = true;
 	ctrl_blk.drift_comp.enabled = true;
-	if (IS_ENABLED(CONFIG_STREAM_BIDIRECTIONAL) && (CONFIG_AUDIO_DEV == GATEWAY) &&
-	    IS_ENABLED(CONFIG_BT_LL_ACS_NRF53)) {
+	ctrl_blk.drift_comp.asrc_rate_input = DRIFT_ASRC_RATE_NOMINAL;
+	if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_JITTER_BUFFER)) {
+		/* The adaptive jitter buffer sets the output FIFO depth instead */
+		ctrl_blk.pres_comp.enabled = false;
+	} else if (IS_ENABLED(CONFIG_STREAM_BIDIRECTIONAL) && (CONFIG_AUDIO_DEV == GATEWAY) &&
+		   IS_ENABLED(CONFIG_BT_LL_ACS_NRF53)) {
 		/* Disable presentation compensation feature for microphone return on gateway when
 		 * using Audio Controller Subsystem. Also, since there's only one stream output from
 		 * gateway for now, so no need to have presentation compensation.
@@ -1183,7 +1507,9 @@ static int cmd_audio_pres_comp_enable(const struct shell *shell, size_t argc, co
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
-	if (ctrl_blk.drift_comp.enabled) {
+	if (IS_ENABLED(CONFIG_AUDIO_DATAPATH_JITTER_BUFFER)) {
+		shell_print(shell, "Pres comp is not used with the adaptive jitter buffer");
+	} else if (ctrl_blk.drift_comp.enabled) {
 		ctrl_blk.pres_comp.enabled = true;
 
 		shell_print(shell, "Presentation compensation enabled");
@@ -1207,6 +1533,21 @@ static int cmd_audio_pres_comp_disable(const struct shell *shell, size_t argc, c
 	return 0;
 }
 
+static int cmd_jitter_buf_show(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "Jitter peak: %d us, target depth: %d blocks, depth: %d blocks",
+		    ctrl_blk.jitter_buf.jitter_peak_us, ctrl_blk.jitter_buf.target_blks,
+		    out_fifo_num_blks_get());
+	shell_print(shell, "Blocks inserted: %d, removed: %d, under-runs: %d",
+		    ctrl_blk.jitter_buf.blks_inserted, ctrl_blk.jitter_buf.blks_removed,
+		    ctrl_blk.out.total_blk_underruns);
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, nrf_tone_start, NULL,
 					      "Start local tone from nRF5340", cmd_i2s_tone_play),
@@ -1224,6 +1565,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, pll_pres_comp_disable, NULL,
 					      "Disable audio presentation compensation",
 					      cmd_audio_pres_comp_disable),
+			       SHELL_COND_CMD(CONFIG_AUDIO_DATAPATH_JITTER_BUFFER, jitter_buf, NULL,
+					      "Show adaptive jitter buffer status",
+					      cmd_jitter_buf_show),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(test, &test_cmd, "Test mode commands", NULL);
@@ -7,6 +7,7 @@
 #include "sw_codec_select.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
 #include <errno.h>
 
 #include "channel_assignment.h"
@@ -24,6 +25,39 @@ static struct sw_codec_config m_config;
 static struct sample_rate_converter_ctx encoder_converters[AUDIO_CH_NUM];
 static struct sample_rate_converter_ctx decoder_converters[AUDIO_CH_NUM];
 
+#if CONFIG_SW_CODEC_TIMING
+static struct sw_codec_timing encoder_timing;
+static struct sw_codec_timing decoder_timing;
+static struct k_spinlock timing_lock;
+
+/**
+ * @brief	Account the processing time of one frame.
+ *
+ * @param[in,out]	timing		Timing statistics to update.
+ * @param[in]		start_cyc	Cycle count when the processing of the frame started.
+ */
+static void timing_update(struct sw_codec_timing *timing, uint32_t start_cyc)
+{
+	uint32_t time_us = k_cyc_to_us_floor32(k_cycle_get_32() - start_cyc);
+	k_spinlock_key_t key = k_spin_lock(&timing_lock);
+
+	timing->frames++;
+	timing->time_us_last = time_us;
+	timing->time_us_max = MAX(timing->time_us_max, time_us);
+
+	if (time_us > CONFIG_AUDIO_FRAME_DURATION_US) {
+		timing->overruns++;
+	}
+
+	k_spin_unlock(&timing_lock, key);
+
+	if (time_us > CONFIG_AUDIO_FRAME_DURATION_US) {
+		LOG_WRN("Codec used %d us of a %d us frame", time_us,
+			CONFIG_AUDIO_FRAME_DURATION_US);
+	}
+}
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 /**
  * @brief	Converts the sample rate of the uncompressed audio stream if needed.
  *
@@ -93,7 +127,8 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 	/* Make sure we have enough space for two frames (stereo) */
 	static uint8_t m_encoded_data[ENC_MAX_FRAME_SIZE * AUDIO_CH_NUM];
 
-	char pcm_data_mono_converted_buf[AUDIO_CH_NUM][PCM_NUM_BYTES_MONO] = {0};
+	/* Channels are processed one at a time, so one conversion buffer is enough */
+	char pcm_data_mono_converted_buf[PCM_NUM_BYTES_MONO];
 
 	size_t pcm_block_size_mono_system_sample_rate;
 	size_t pcm_block_size_mono;
@@ -103,11 +138,23 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 		return -ENXIO;
 	}
 
+#if CONFIG_SW_CODEC_TIMING
+	uint32_t start_cyc = k_cycle_get_32();
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 	switch (m_config.sw_codec) {
 	case SW_CODEC_LC3: {
 #if (CONFIG_SW_CODEC_LC3)
 		uint16_t encoded_bytes_written;
-		char *pcm_data_mono_ptrs[m_config.encoder.channel_mode];
+		size_t encoded_offset = 0;
+		char *pcm_data_mono_ptr;
+
+		if (m_config.encoder.channel_mode != SW_CODEC_MONO &&
+		    m_config.encoder.channel_mode != SW_CODEC_STEREO) {
+			LOG_ERR("Unsupported channel mode for encoder: %d",
+				m_config.encoder.channel_mode);
+			return -ENODEV;
+		}
 
 		/* Since LC3 is a single channel codec, we must split the
 		 * stereo PCM stream
@@ -120,59 +167,33 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 			return ret;
 		}
 
+		/* Each channel is converted and encoded before moving on to the next channel */
 		for (int i = 0; i < m_config.encoder.channel_mode; ++i) {
 			ret = sw_codec_sample_rate_convert(
 				&encoder_converters[i], CONFIG_AUDIO_SAMPLE_RATE_HZ,
 				m_config.encoder.sample_rate_hz,
 				pcm_data_mono_system_sample_rate[i],
-				pcm_block_size_mono_system_sample_rate,
-				pcm_data_mono_converted_buf[i], &pcm_data_mono_ptrs[i],
-				&pcm_block_size_mono);
+				pcm_block_size_mono_system_sample_rate, pcm_data_mono_converted_buf,
+				&pcm_data_mono_ptr, &pcm_block_size_mono);
 			if (ret) {
 				LOG_ERR("Sample rate conversion failed for channel %d: %d", i, ret);
 				return ret;
 			}
-		}
 
-		switch (m_config.encoder.channel_mode) {
-		case SW_CODEC_MONO: {
-			ret = sw_codec_lc3_enc_run(pcm_data_mono_ptrs[AUDIO_CH_L],
-						   pcm_block_size_mono, LC3_USE_BITRATE_FROM_INIT,
-						   0, sizeof(m_encoded_data), m_encoded_data,
+			ret = sw_codec_lc3_enc_run(pcm_data_mono_ptr, pcm_block_size_mono,
+						   LC3_USE_BITRATE_FROM_INIT, i,
+						   sizeof(m_encoded_data) - encoded_offset,
+						   m_encoded_data + encoded_offset,
 						   &encoded_bytes_written);
 			if (ret) {
 				return ret;
 			}
-			break;
-		}
-		case SW_CODEC_STEREO: {
-			ret = sw_codec_lc3_enc_run(pcm_data_mono_ptrs[AUDIO_CH_L],
-						   pcm_block_size_mono, LC3_USE_BITRATE_FROM_INIT,
-						   AUDIO_CH_L, sizeof(m_encoded_data),
-						   m_encoded_data, &encoded_bytes_written);
-			if (ret) {
-				return ret;
-			}
 
-			ret = sw_codec_lc3_enc_run(
-				pcm_data_mono_ptrs[AUDIO_CH_R], pcm_block_size_mono,
-				LC3_USE_BITRATE_FROM_INIT, AUDIO_CH_R,
-				sizeof(m_encoded_data) - encoded_bytes_written,
-				m_encoded_data + encoded_bytes_written, &encoded_bytes_written);
-			if (ret) {
-				return ret;
-			}
-			encoded_bytes_written += encoded_bytes_written;
-			break;
-		}
-		default:
-			LOG_ERR("Unsupported channel mode for encoder: %d",
-				m_config.encoder.channel_mode);
-			return -ENODEV;
+			encoded_offset += encoded_bytes_written;
 		}
 
 		*encoded_data = m_encoded_data;
-		*encoded_size = encoded_bytes_written;
+		*encoded_size = encoded_offset;
 
 #endif /* (CONFIG_SW_CODEC_LC3) */
 		break;
@@ -182,6 +203,10 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 		return -ENODEV;
 	}
 
+#if CONFIG_SW_CODEC_TIMING
+	timing_update(&encoder_timing, start_cyc);
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 	return 0;
 }
 
@@ -204,38 +229,55 @@ int sw_codec_decode(uint8_t const *const encoded_data, size_t encoded_size, bool
 	size_t pcm_size_mono = 0;
 	size_t decoded_data_size = 0;
 
+#if CONFIG_SW_CODEC_TIMING
+	uint32_t start_cyc = k_cycle_get_32();
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 	switch (m_config.sw_codec) {
 	case SW_CODEC_LC3: {
 #if (CONFIG_SW_CODEC_LC3)
-		char *pcm_in_data_ptrs[m_config.decoder.channel_mode];
+		char *pcm_in_data_ptrs[AUDIO_CH_NUM];
+		size_t encoded_size_mono;
+
+		if (m_config.decoder.channel_mode != SW_CODEC_MONO &&
+		    m_config.decoder.channel_mode != SW_CODEC_STEREO) {
+			LOG_ERR("Unsupported channel mode for decoder: %d",
+				m_config.decoder.channel_mode);
+			return -ENODEV;
+		}
+
+		encoded_size_mono = encoded_size / m_config.decoder.channel_mode;
 
-		switch (m_config.decoder.channel_mode) {
-		case SW_CODEC_MONO: {
+		/* Each channel is decoded and converted before moving on to the next channel */
+		for (int i = 0; i < m_config.decoder.channel_mode; ++i) {
 			if (bad_frame && IS_ENABLED(CONFIG_SW_CODEC_OVERRIDE_PLC)) {
-				memset(decoded_data_mono[AUDIO_CH_L], 0, PCM_NUM_BYTES_MONO);
-				decoded_data_size = PCM_NUM_BYTES_MONO;
-			} else {
-				ret = sw_codec_lc3_dec_run(
-					encoded_data, encoded_size, LC3_PCM_NUM_BYTES_MONO, 0,
-					decoded_data_mono[AUDIO_CH_L],
-					(uint16_t *)&decoded_data_size, bad_frame);
-				if (ret) {
-					return ret;
-				}
-
-				ret = sw_codec_sample_rate_convert(
-					&decoder_converters[AUDIO_CH_L],
-					m_config.decoder.sample_rate_hz,
-					CONFIG_AUDIO_SAMPLE_RATE_HZ, decoded_data_mono[AUDIO_CH_L],
-					decoded_data_size,
-					decoded_data_mono_system_sample_rate[AUDIO_CH_L],
-					&pcm_in_data_ptrs[AUDIO_CH_L], &pcm_size_mono);
-				if (ret) {
-					LOG_ERR("Sample rate conversion failed for mono: %d", ret);
-					return ret;
-				}
+				memset(decoded_data_mono[i], 0, PCM_NUM_BYTES_MONO);
+				pcm_in_data_ptrs[i] = decoded_data_mono[i];
+				pcm_size_mono = PCM_NUM_BYTES_MONO;
+				continue;
+			}
+
+			ret = sw_codec_lc3_dec_run(encoded_data + (i * encoded_size_mono),
+						   encoded_size_mono, LC3_PCM_NUM_BYTES_MONO, i,
+						   decoded_data_mono[i],
+						   (uint16_t *)&decoded_data_size, bad_frame);
+			if (ret) {
+				return ret;
 			}
 
+			ret = sw_codec_sample_rate_convert(
+				&decoder_converters[i], m_config.decoder.sample_rate_hz,
+				CONFIG_AUDIO_SAMPLE_RATE_HZ, decoded_data_mono[i],
+				decoded_data_size, decoded_data_mono_system_sample_rate[i],
+				&pcm_in_data_ptrs[i], &pcm_size_mono);
+			if (ret) {
+				LOG_ERR("Sample rate conversion failed for channel %d : %d", i,
+					ret);
+				return ret;
+			}
+		}
+
+		if (m_config.decoder.channel_mode == SW_CODEC_MONO) {
 			/* For now, i2s is only stereo, so in order to send
 			 * just one channel, we need to insert 0 for the
 			 * other channel
@@ -243,66 +285,14 @@ int sw_codec_decode(uint8_t const *const encoded_data, size_t encoded_size, bool
 			ret = pscm_zero_pad(pcm_in_data_ptrs[AUDIO_CH_L], pcm_size_mono,
 					    m_config.decoder.audio_ch, CONFIG_AUDIO_BIT_DEPTH_BITS,
 					    pcm_data_stereo, &pcm_size_stereo);
-			if (ret) {
-				return ret;
-			}
-			break;
-		}
-		case SW_CODEC_STEREO: {
-			if (bad_frame && IS_ENABLED(CONFIG_SW_CODEC_OVERRIDE_PLC)) {
-				memset(decoded_data_mono[AUDIO_CH_L], 0, PCM_NUM_BYTES_MONO);
-				memset(decoded_data_mono[AUDIO_CH_R], 0, PCM_NUM_BYTES_MONO);
-				decoded_data_size = PCM_NUM_BYTES_MONO;
-			} else {
-				/* Decode left channel */
-				ret = sw_codec_lc3_dec_run(
-					encoded_data, encoded_size / 2, LC3_PCM_NUM_BYTES_MONO,
-					AUDIO_CH_L, decoded_data_mono[AUDIO_CH_L],
-					(uint16_t *)&decoded_data_size, bad_frame);
-				if (ret) {
-					return ret;
-				}
-
-				/* Decode right channel */
-				ret = sw_codec_lc3_dec_run(
-					(encoded_data + (encoded_size / 2)), encoded_size / 2,
-					LC3_PCM_NUM_BYTES_MONO, AUDIO_CH_R,
-					decoded_data_mono[AUDIO_CH_R],
-					(uint16_t *)&decoded_data_size, bad_frame);
-				if (ret) {
-					return ret;
-				}
-
-				for (int i = 0; i < m_config.decoder.channel_mode; ++i) {
-					ret = sw_codec_sample_rate_convert(
-						&decoder_converters[i],
-						m_config.decoder.sample_rate_hz,
-						CONFIG_AUDIO_SAMPLE_RATE_HZ, decoded_data_mono[i],
-						decoded_data_size,
-						decoded_data_mono_system_sample_rate[i],
-						&pcm_in_data_ptrs[i], &pcm_size_mono);
-					if (ret) {
-						LOG_ERR("Sample rate conversion failed for channel "
-							"%d : %d",
-							i, ret);
-						return ret;
-					}
-				}
-			}
-
+		} else {
 			ret = pscm_combine(pcm_in_data_ptrs[AUDIO_CH_L],
 					   pcm_in_data_ptrs[AUDIO_CH_R], pcm_size_mono,
 					   CONFIG_AUDIO_BIT_DEPTH_BITS, pcm_data_stereo,
 					   &pcm_size_stereo);
-			if (ret) {
-				return ret;
-			}
-			break;
 		}
-		default:
-			LOG_ERR("Unsupported channel mode for decoder: %d",
-				m_config.decoder.channel_mode);
-			return -ENODEV;
+		if (ret) {
+			return ret;
 		}
 
 		*decoded_size = pcm_size_stereo;
@@ -314,9 +304,41 @@ int sw_codec_decode(uint8_t const *const encoded_data, size_t encoded_size, bool
 		LOG_ERR("Unsupported codec: %d", m_config.sw_codec);
 		return -ENODEV;
 	}
+
+#if CONFIG_SW_CODEC_TIMING
+	timing_update(&decoder_timing, start_cyc);
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 	return 0;
 }
 
+#if CONFIG_SW_CODEC_TIMING
+int sw_codec_timing_get(struct sw_codec_timing *encoder, struct sw_codec_timing *decoder)
+{
+	k_spinlock_key_t key;
+
+	if (encoder == NULL || decoder == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&timing_lock);
+	*encoder = encoder_timing;
+	*decoder = decoder_timing;
+	k_spin_unlock(&timing_lock, key);
+
+	return 0;
+}
+
+void sw_codec_timing_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&timing_lock);
+
+	memset(&encoder_timing, 0, sizeof(encoder_timing));
+	memset(&decoder_timing, 0, sizeof(decoder_timing));
+	k_spin_unlock(&timing_lock, key);
+}
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 int sw_codec_uninit(struct sw_codec_config sw_codec_cfg)
 {
 	int ret;
@@ -463,3 +485,50 @@ int sw_codec_init(struct sw_codec_config sw_codec_cfg)
 
 	return 0;
 }
+
+#if CONFIG_SW_CODEC_TIMING && CONFIG_SHELL
+static int cmd_sw_codec_timing(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct sw_codec_timing encoder;
+	struct sw_codec_timing decoder;
+
+	(void)sw_codec_timing_get(&encoder, &decoder);
+
+	shell_print(shell, "Encoder: %d frames, last %d us, max %d us, %d overruns", encoder.frames,
+		    encoder.time_us_last, encoder.time_us_max, encoder.overruns);
+	shell_print(shell, "Decoder: %d frames, last %d us, max %d us, %d overruns", decoder.frames,
+		    decoder.time_us_last, decoder.time_us_max, decoder.overruns);
+	shell_print(shell, "Headroom: last %d us, worst case %d us of a %d us frame",
+		    CONFIG_AUDIO_FRAME_DURATION_US - (int)(encoder.time_us_last +
+							   decoder.time_us_last),
+		    CONFIG_AUDIO_FRAME_DURATION_US - (int)(encoder.time_us_max +
+							   decoder.time_us_max),
+		    CONFIG_AUDIO_FRAME_DURATION_US);
+
+	return 0;
+}
+
+static int cmd_sw_codec_timing_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sw_codec_timing_reset();
+
+	shell_print(shell, "Codec timing reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sw_codec_cmd,
+			       SHELL_CMD(timing, NULL, "Show codec time and headroom per frame",
+					 cmd_sw_codec_timing),
+			       SHELL_CMD(timing_reset, NULL, "Reset codec timing",
+					 cmd_sw_codec_timing_reset),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(sw_codec, &sw_codec_cmd, "SW codec commands", NULL);
+#endif /* CONFIG_SW_CODEC_TIMING && CONFIG_SHELL */
@@ -63,6 +63,14 @@ struct sw_codec_decoder {
 /**
  * @brief  Sw_codec configuration structure.
  */
+/* Processing time of the codec per frame */
+struct sw_codec_timing {
+	uint32_t frames;       /* Number of frames processed. */
+	uint32_t time_us_last; /* Processing time of the last frame. */
+	uint32_t time_us_max;  /* Longest processing time of a frame. */
+	uint32_t overruns;     /* Number of frames that took longer than the frame duration. */
+};
+
 struct sw_codec_config {
 	enum sw_codec_select sw_codec;	 /* sw_codec to be used, e.g. LC3, etc. */
 	struct sw_codec_decoder decoder; /* Struct containing settings for decoder. */
@@ -107,6 +115,26 @@ int sw_codec_encode(void *pcm_data, size_t pcm_size, uint8_t **encoded_data, siz
 int sw_codec_decode(uint8_t const *const encoded_data, size_t encoded_size, bool bad_frame,
 		    void **pcm_data, size_t *pcm_size);
 
+#if CONFIG_SW_CODEC_TIMING
+/**
+ * @brief	Get the processing time of the encoder and the decoder per frame.
+ *
+ * @note	The headroom of a frame is the frame duration minus the time used by the
+ *		encoder and the decoder for that frame.
+ *
+ * @param[out]	encoder		Timing of the encoder.
+ * @param[out]	decoder		Timing of the decoder.
+ *
+ * @return	0 if success, -EINVAL on NULL pointers.
+ */
+int sw_codec_timing_get(struct sw_codec_timing *encoder, struct sw_codec_timing *decoder);
+
+/**
+ * @brief	Reset the timing of the encoder and the decoder.
+ */
+void sw_codec_timing_reset(void);
+#endif /* CONFIG_SW_CODEC_TIMING */
+
 /**
  * @brief	Uninitialize the software codec and free the allocated space.
  *
@@ -105,20 +105,28 @@ static void data_received(const struct device *dev, struct net_buf *buffer, size
 
 	/* RX FIFO can fill up due to retransmissions or disconnect */
 	if (ret == -ENOMEM) {
-		void *temp;
-		size_t temp_size;
-
 		rx_num_overruns++;
 		if ((rx_num_overruns % 100) == 1) {
 			LOG_WRN("USB RX overrun. Num: %d", rx_num_overruns);
 		}
 
+#if CONFIG_DATA_FIFO_SPSC
+		/* Only the encoder thread reads from an SPSC FIFO, so drop the incoming frame
+		 * instead of the oldest one.
+		 */
+		net_buf_unref(buffer);
+		return;
+#else
+		void *temp;
+		size_t temp_size;
+
 		ret = data_fifo_pointer_last_filled_get(fifo_rx, &temp, &temp_size, K_NO_WAIT);
 		ERR_CHK(ret);
 
 		data_fifo_block_free(fifo_rx, temp);
 
 		ret = data_fifo_pointer_first_vacant_get(fifo_rx, &data_in, K_NO_WAIT);
+#endif
 	}
 
 	ERR_CHK_MSG(ret, "RX failed to get block");
@@ -27,6 +27,16 @@ LOG_MODULE_REGISTER(sd_card_playback, CONFIG_MODULE_SD_CARD_PLAYBACK_LOG_LEVEL);
 #define WAV_FORMAT_PCM	    1
 #define WAV_SAMPLE_RATE_48K 48000
 
+#define LC3_FILE_ID	   0xCC1C
+/* Largest LC3 frame: 400 octets per channel */
+#define LC3_FRAME_SIZE_MAX 400
+
+#define PREFETCH_BUF_SIZE  CONFIG_SD_CARD_PLAYBACK_PREFETCH_BUF_SIZE
+#define PREFETCH_READ_SIZE CONFIG_SD_CARD_PLAYBACK_PREFETCH_READ_SIZE
+
+BUILD_ASSERT((PREFETCH_BUF_SIZE % PREFETCH_READ_SIZE) == 0,
+	     "Prefetch buffer size must be a multiple of the read size");
+
 /* WAV header */
 struct wav_header {
 	/* RIFF Header */
@@ -78,9 +88,28 @@ K_MUTEX_DEFINE(mtx_ringbuf);
 K_SEM_DEFINE(m_sem_playback, 0, 1);
 K_THREAD_STACK_DEFINE(sd_card_playback_thread_stack, CONFIG_SD_CARD_PLAYBACK_STACK_SIZE);
 
+K_MUTEX_DEFINE(mtx_prefetch);
+K_SEM_DEFINE(m_sem_prefetch_start, 0, 1);
+K_SEM_DEFINE(m_sem_prefetch_primed, 0, 1);
+K_SEM_DEFINE(m_sem_prefetch_stopped, 0, 1);
+K_SEM_DEFINE(m_sem_prefetch_data, 0, 1);
+K_SEM_DEFINE(m_sem_prefetch_space, 0, 1);
+K_THREAD_STACK_DEFINE(sd_card_prefetch_thread_stack, CONFIG_SD_CARD_PLAYBACK_PREFETCH_STACK_SIZE);
+
 /* Thread */
 static struct k_thread sd_card_playback_thread_data;
 static k_tid_t sd_card_playback_thread_id;
+static struct k_thread sd_card_prefetch_thread_data;
+static k_tid_t sd_card_prefetch_thread_id;
+
+/* Prefetch */
+static uint8_t prefetch_buf[PREFETCH_BUF_SIZE] __aligned(4);
+static struct ring_buf prefetch_ringbuf;
+/* Set by the prefetch thread when the whole file is read */
+static volatile bool prefetch_eof;
+/* Set by the playback thread to stop prefetching before the file is closed */
+static volatile bool prefetch_stop;
+static int prefetch_err;
 
 /* Playback */
 static bool sd_card_playback_active;
@@ -162,6 +191,151 @@ static int sd_card_playback_ringbuf_write(uint8_t *buffer, size_t numbytes)
 	return numbytes;
 }
 
+/**
+ * @brief	Read file data ahead of playback.
+ *
+ * @details	The file is read in large chunks into the prefetch ring buffer, so that the
+ *		playback thread only waits for the SD card if the buffer runs empty. The buffer
+ *		is a whole number of chunks, so a chunk never wraps around the end of the buffer
+ *		and every read goes to an aligned address.
+ */
+static void sd_card_playback_prefetch_thread(void *arg1, void *arg2, void *arg3)
+{
+	int ret;
+	uint8_t *buf_ptr;
+	size_t read_size;
+	bool primed;
+
+	while (1) {
+		k_sem_take(&m_sem_prefetch_start, K_FOREVER);
+		primed = false;
+
+		while (!prefetch_stop) {
+			k_mutex_lock(&mtx_prefetch, K_FOREVER);
+
+			if (ring_buf_space_get(&prefetch_ringbuf) < PREFETCH_READ_SIZE) {
+				k_mutex_unlock(&mtx_prefetch);
+
+				if (!primed) {
+					/* Buffer full, playback can start */
+					primed = true;
+					k_sem_give(&m_sem_prefetch_primed);
+				}
+
+				k_sem_take(&m_sem_prefetch_space, K_FOREVER);
+				continue;
+			}
+
+			read_size =
+				ring_buf_put_claim(&prefetch_ringbuf, &buf_ptr, PREFETCH_READ_SIZE);
+			k_mutex_unlock(&mtx_prefetch);
+
+			/* The claimed area is not touched by the reader until it is finished */
+			ret = sd_card_read((char *)buf_ptr, &read_size, &f_seg_read_entry);
+			if (ret) {
+				LOG_ERR("SD card read err: %d", ret);
+				prefetch_err = ret;
+				read_size = 0;
+			}
+
+			k_mutex_lock(&mtx_prefetch, K_FOREVER);
+			ret = ring_buf_put_finish(&prefetch_ringbuf, read_size);
+			k_mutex_unlock(&mtx_prefetch);
+			if (ret) {
+				LOG_ERR("Ring buf put finish err: %d", ret);
+				prefetch_err = ret;
+			}
+
+			k_sem_give(&m_sem_prefetch_data);
+
+			if (prefetch_err || read_size < PREFETCH_READ_SIZE) {
+				/* End of file or error */
+				break;
+			}
+		}
+
+		prefetch_eof = true;
+		k_sem_give(&m_sem_prefetch_data);
+
+		if (!primed) {
+			k_sem_give(&m_sem_prefetch_primed);
+		}
+
+		k_sem_give(&m_sem_prefetch_stopped);
+	}
+}
+
+/**
+ * @brief	Start prefetching from the open playback file.
+ *
+ * @note	Waits until the prefetch buffer is full, or the whole file is read.
+ */
+static void sd_card_playback_prefetch_start(void)
+{
+	ring_buf_reset(&prefetch_ringbuf);
+	prefetch_eof = false;
+	prefetch_stop = false;
+	prefetch_err = 0;
+
+	k_sem_reset(&m_sem_prefetch_data);
+	k_sem_reset(&m_sem_prefetch_space);
+	k_sem_reset(&m_sem_prefetch_primed);
+	k_sem_reset(&m_sem_prefetch_stopped);
+	k_sem_give(&m_sem_prefetch_start);
+
+	k_sem_take(&m_sem_prefetch_primed, K_FOREVER);
+}
+
+/**
+ * @brief	Stop prefetching. The playback file can be closed when this returns.
+ */
+static void sd_card_playback_prefetch_stop(void)
+{
+	prefetch_stop = true;
+	k_sem_give(&m_sem_prefetch_space);
+
+	k_sem_take(&m_sem_prefetch_stopped, K_FOREVER);
+}
+
+/**
+ * @brief	Read prefetched file data.
+ *
+ * @details	Waits for the prefetch thread if the buffer does not hold enough data.
+ *
+ * @param[out]		buf	Buffer to read the data into.
+ * @param[in, out]	size	Number of bytes to read. Returns the number of bytes read,
+ *				which is only less than requested at the end of the file.
+ *
+ * @return	0 on success, otherwise the error from reading the SD card.
+ */
+static int sd_card_playback_prefetch_read(uint8_t *buf, size_t *size)
+{
+	size_t read_size = 0;
+
+	while (read_size < *size) {
+		/* Check before reading, as the last data is added before end of file is set */
+		bool eof = prefetch_eof;
+
+		k_mutex_lock(&mtx_prefetch, K_FOREVER);
+		uint32_t num_bytes =
+			ring_buf_get(&prefetch_ringbuf, &buf[read_size], *size - read_size);
+		k_mutex_unlock(&mtx_prefetch);
+
+		if (num_bytes > 0) {
+			read_size += num_bytes;
+			k_sem_give(&m_sem_prefetch_space);
+		} else if (eof) {
+			break;
+		} else {
+			k_sem_take(&m_sem_prefetch_data, K_FOREVER);
+		}
+	}
+
+	*size = read_size;
+
+	return prefetch_err;
+}
+
 static int sd_card_playback_check_wav_header(struct wav_header wav_file_header)
 {
 	if (wav_file_header.audio_format != WAV_FORMAT_PCM) {
@@ -187,14 +361,16 @@ static int sd_card_playback_check_wav_header(struct wav_header wav_file_header)
 	return 0;
 }
 
-static int sd_card_playback_play_wav(void)
+/**
+ * @brief	Open a WAV file and parse its header.
+ *
+ * @note	On success, the file is left open with the read position at the audio data.
+ */
+static int sd_card_playback_open_wav(void)
 {
 	int ret;
 	int ret_sd_card_close;
-	size_t wav_read_size;
 	size_t wav_file_header_size = sizeof(wav_file_header);
-	int audio_length_bytes;
-	int n_iter;
 
 	ret = sd_card_open(playback_file_name, &f_seg_read_entry);
 	if (ret) {
@@ -203,8 +379,18 @@ static int sd_card_playback_play_wav(void)
 	}
 
 	ret = sd_card_read((char *)&wav_file_header, &wav_file_header_size, &f_seg_read_entry);
+	if (ret == 0 && wav_file_header_size != sizeof(wav_file_header)) {
+		LOG_ERR("File is too short for a WAV header");
+		ret = -EPERM;
+	}
+
+	if (ret == 0) {
+		/* Verify that there is support for playing the specified file */
+		ret = sd_card_playback_check_wav_header(wav_file_header);
+	}
+
 	if (ret) {
-		LOG_ERR("Read SD card err: %d", ret);
+		LOG_ERR("WAV header err: %d", ret);
 		ret_sd_card_close = sd_card_close(&f_seg_read_entry);
 		if (ret_sd_card_close) {
 			LOG_ERR("Close SD card err: %d", ret_sd_card_close);
@@ -213,10 +399,40 @@ static int sd_card_playback_play_wav(void)
 		return ret;
 	}
 
-	/* Verify that there is support for playing the specified file */
-	ret = sd_card_playback_check_wav_header(wav_file_header);
+	/* Size corresponding to frame size of audio BT stream */
+	pcm_frame_size = wav_file_header.byte_rate * FRAME_DURATION_MS / 1000;
+
+	return 0;
+}
+
+/**
+ * @brief	Open an LC3 file and parse its header.
+ *
+ * @note	On success, the file is left open with the read position at the first frame.
+ */
+static int sd_card_playback_open_lc3(void)
+{
+	int ret;
+	int ret_sd_card_close;
+	size_t lc3_file_header_size = sizeof(lc3_file_header);
+
+	ret = sd_card_open(playback_file_name, &f_seg_read_entry);
 	if (ret) {
-		LOG_ERR("WAV header check failed. Ret: %d", ret);
+		LOG_ERR("Open SD card file err: %d", ret);
+		return ret;
+	}
+
+	ret = sd_card_read((char *)&lc3_file_header, &lc3_file_header_size, &f_seg_read_entry);
+	if (ret == 0 && (lc3_file_header_size != sizeof(lc3_file_header) ||
+			 lc3_file_header.file_id != LC3_FILE_ID ||
+			 lc3_file_header.hdr_size != sizeof(lc3_file_header) ||
+			 lc3_file_header.sample_rate == 0 || lc3_file_header.frame_duration == 0)) {
+		LOG_ERR("This is not a supported LC3 file");
+		ret = -EPERM;
+	}
+
+	if (ret) {
+		LOG_ERR("LC3 header err: %d", ret);
 		ret_sd_card_close = sd_card_close(&f_seg_read_entry);
 		if (ret_sd_card_close) {
 			LOG_ERR("Close SD card err: %d", ret_sd_card_close);
@@ -225,19 +441,69 @@ static int sd_card_playback_play_wav(void)
 		return ret;
 	}
 
-	/* Size corresponding to frame size of audio BT stream */
-	pcm_frame_size = wav_file_header.byte_rate * FRAME_DURATION_MS / 1000;
-	wav_read_size = pcm_frame_size;
-	uint8_t pcm_mono_frame[wav_read_size];
+	pcm_frame_size = sizeof(uint16_t) * lc3_file_header.sample_rate *
+			 lc3_file_header.frame_duration / 1000;
+	lc3_playback_cfg.lc3_frames_num =
+		sizeof(uint16_t) *
+		((lc3_file_header.signal_len_msb << 16) + lc3_file_header.signal_len_lsb) /
+		pcm_frame_size;
+
+	return 0;
+}
+
+/**
+ * @brief	Stop prefetching and close the playback file.
+ *
+ * @param	ret	Result of the playback.
+ *
+ * @return	Result of the playback if it failed, otherwise the result of closing the file.
+ */
+static int sd_card_playback_close(int ret)
+{
+	int ret_sd_card_close;
+
+	sd_card_playback_active = false;
+
+	sd_card_playback_prefetch_stop();
+
+	ret_sd_card_close = sd_card_close(&f_seg_read_entry);
+	if (ret_sd_card_close) {
+		LOG_ERR("SD card close err: %d", ret_sd_card_close);
+	}
+
+	return ret ? ret : ret_sd_card_close;
+}
+
+static int sd_card_playback_play_wav(void)
+{
+	int ret;
+	size_t wav_read_size;
+	int audio_length_bytes;
+	int n_iter;
+
+	ret = sd_card_playback_open_wav();
+	if (ret) {
+		return ret;
+	}
+
+	uint8_t pcm_mono_frame[pcm_frame_size];
 
 	audio_length_bytes = wav_file_header.wav_size + 8 - sizeof(wav_file_header);
-	n_iter = ceil((float)audio_length_bytes / (float)wav_read_size);
+	n_iter = ceil((float)audio_length_bytes / (float)pcm_frame_size);
+
+	sd_card_playback_prefetch_start();
 
 	for (int i = 0; i < n_iter; i++) {
-		/* Read a chunk of audio data from file */
-		ret = sd_card_read(pcm_mono_frame, &wav_read_size, &f_seg_read_entry);
+		/* Take a chunk of audio data from the prefetched file data */
+		wav_read_size = pcm_frame_size;
+		ret = sd_card_playback_prefetch_read(pcm_mono_frame, &wav_read_size);
 		if (ret < 0) {
-			LOG_ERR("SD card read err: %d", ret);
+			LOG_ERR("Prefetch read err: %d", ret);
+			break;
+		}
+
+		if (wav_read_size == 0) {
+			/* End of file */
 			break;
 		}
 
@@ -254,75 +520,53 @@ static int sd_card_playback_play_wav(void)
 		}
 	}
 
-	sd_card_playback_active = false;
-
-	ret_sd_card_close = sd_card_close(&f_seg_read_entry);
-	/* Check if something inside the for loop failed */
-	if (ret < 0) {
-		LOG_ERR("WAV playback err: %d", ret);
-		return ret;
-	}
-
-	if (ret_sd_card_close) {
-		LOG_ERR("SD card close err: %d", ret);
-		return ret;
-	}
-
-	return 0;
+	return sd_card_playback_close(MIN(ret, 0));
 }
 
 static int sd_card_playback_play_lc3(void)
 {
 	int ret;
-	int ret_sd_card_close;
 	uint16_t pcm_mono_write_size;
 	uint8_t decoder_num_ch = audio_system_decoder_num_ch_get();
-	size_t lc3_file_header_size = sizeof(lc3_file_header);
-	size_t lc3_frame_header_size = sizeof(uint16_t);
+	size_t lc3_frame_header_size;
+	uint8_t *lc3_frame_header = (uint8_t *)&lc3_playback_cfg.lc3_frame_length_bytes;
 
-	ret = sd_card_open(playback_file_name, &f_seg_read_entry);
+	ret = sd_card_playback_open_lc3();
 	if (ret) {
-		LOG_ERR("Open SD card file err: %d", ret);
-		return ret;
-	}
-
-	/* Read the file header */
-	ret = sd_card_read((char *)&lc3_file_header, &lc3_file_header_size, &f_seg_read_entry);
-	if (ret < 0) {
-		LOG_ERR("Read SD card file err: %d", ret);
-		ret_sd_card_close = sd_card_close(&f_seg_read_entry);
-		if (ret_sd_card_close) {
-			LOG_ERR("Close SD card err: %d", ret_sd_card_close);
-			return ret_sd_card_close;
-		}
 		return ret;
 	}
 
-	pcm_frame_size = sizeof(uint16_t) * lc3_file_header.sample_rate *
-			 lc3_file_header.frame_duration / 1000;
-	lc3_playback_cfg.lc3_frames_num =
-		sizeof(uint16_t) *
-		((lc3_file_header.signal_len_msb << 16) + lc3_file_header.signal_len_lsb) /
-		pcm_frame_size;
-
 	uint8_t pcm_mono_frame[pcm_frame_size];
+	char lc3_frame[LC3_FRAME_SIZE_MAX];
+
+	sd_card_playback_prefetch_start();
 
 	for (int i = 0; i < lc3_playback_cfg.lc3_frames_num; i++) {
 		/* Read the frame header */
-		ret = sd_card_read((char *)&lc3_playback_cfg.lc3_frame_length_bytes,
-				   &lc3_frame_header_size, &f_seg_read_entry);
+		lc3_frame_header_size = sizeof(lc3_playback_cfg.lc3_frame_length_bytes);
+		ret = sd_card_playback_prefetch_read(lc3_frame_header, &lc3_frame_header_size);
 		if (ret < 0) {
-			LOG_ERR("SD card read err: %d", ret);
+			LOG_ERR("Prefetch read err: %d", ret);
+			break;
+		}
+
+		if (lc3_frame_header_size != sizeof(lc3_playback_cfg.lc3_frame_length_bytes)) {
+			/* End of file */
+			break;
+		}
+
+		if (lc3_playback_cfg.lc3_frame_length_bytes > sizeof(lc3_frame)) {
+			LOG_ERR("LC3 frame too large: %d", lc3_playback_cfg.lc3_frame_length_bytes);
+			ret = -EPERM;
 			break;
 		}
 
-		char lc3_frame[lc3_playback_cfg.lc3_frame_length_bytes];
 		size_t lc3_fr_len = lc3_playback_cfg.lc3_frame_length_bytes;
 
 		/* Read the audio data frame to be decoded */
-		ret = sd_card_read(lc3_frame, &lc3_fr_len, &f_seg_read_entry);
+		ret = sd_card_playback_prefetch_read((uint8_t *)lc3_frame, &lc3_fr_len);
 		if (ret < 0) {
-			LOG_ERR("SD card read err: %d", ret);
+			LOG_ERR("Prefetch read err: %d", ret);
 			break;
 		}
 
@@ -353,21 +597,7 @@ static int sd_card_playback_play_lc3(void)
 		}
 	}
 
-	sd_card_playback_active = false;
-	ret_sd_card_close = sd_card_close(&f_seg_read_entry);
-	if (ret < 0) {
-		LOG_ERR("LC3 playback err: %d", ret);
-		sd_card_playback_active = false;
-		return ret;
-	}
-
-	if (ret_sd_card_close) {
-		LOG_ERR("SD card close err: %d", ret);
-		sd_card_playback_active = false;
-		return ret;
-	}
-
-	return 0;
+	return sd_card_playback_close(MIN(ret, 0));
 }
 
 static void sd_card_playback_thread(void *arg1, void *arg2, void *arg3)
@@ -469,6 +699,18 @@ int sd_card_playback_init(void)
 {
 	int ret;
 
+	ring_buf_init(&prefetch_ringbuf, sizeof(prefetch_buf), prefetch_buf);
+
+	sd_card_prefetch_thread_id = k_thread_create(
+		&sd_card_prefetch_thread_data, sd_card_prefetch_thread_stack,
+		CONFIG_SD_CARD_PLAYBACK_PREFETCH_STACK_SIZE,
+		(k_thread_entry_t)sd_card_playback_prefetch_thread, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(CONFIG_SD_CARD_PLAYBACK_PREFETCH_THREAD_PRIORITY), 0, K_NO_WAIT);
+	ret = k_thread_name_set(sd_card_prefetch_thread_id, "sd_card_prefetch");
+	if (ret) {
+		return ret;
+	}
+
 	sd_card_playback_thread_id = k_thread_create(
 		&sd_card_playback_thread_data, sd_card_playback_thread_stack,
 		CONFIG_SD_CARD_PLAYBACK_STACK_SIZE, (k_thread_entry_t)sd_card_playback_thread, NULL,
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+
+#include <stdio.h>
+
+#include "input_latency_event.h"
+
+
+static void log_input_latency_event(const struct app_event_header *aeh)
+{
+	const struct input_latency_event *event = cast_input_latency_event(aeh);
+
+	APP_EVENT_MANAGER_LOG(aeh, "key_id: 0x%x latency: %u us",
+			event->key_id, event->latency);
+}
+
+static void profile_input_latency_event(struct log_event_buf *buf,
+					const struct app_event_header *aeh)
+{
+	const struct input_latency_event *event = cast_input_latency_event(aeh);
+
+	nrf_profiler_log_encode_uint16(buf, event->key_id);
+	nrf_profiler_log_encode_uint32(buf, event->latency);
+}
+
+APP_EVENT_INFO_DEFINE(input_latency_event,
+		  ENCODE(NRF_PROFILER_ARG_U16, NRF_PROFILER_ARG_U32),
+		  ENCODE("key_id", "latency_us"),
+		  profile_input_latency_event);
+
+APP_EVENT_TYPE_DEFINE(input_latency_event,
+		  log_input_latency_event,
+		  &input_latency_event_info,
+		  APP_EVENT_FLAGS_CREATE(
+			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_INPUT_LATENCY_EVENT,
+				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _INPUT_LATENCY_EVENT_H_
+#define _INPUT_LATENCY_EVENT_H_
+
+/**
+ * @brief Input Latency Event
+ * @defgroup input_latency_event Input Latency Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Input latency event. */
+struct input_latency_event {
+	struct app_event_header header; /**< Event header. */
+
+	uint16_t key_id; /**< ID of the pressed button. */
+	uint32_t latency; /**< Time from button press to HID report sent [us]. */
+};
+
+APP_EVENT_TYPE_DECLARE(input_latency_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* _INPUT_LATENCY_EVENT_H_ */
@@ -35,3 +35,5 @@ APP_EVENT_TYPE_DEFINE(motion_event,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_MOTION_EVENT,
 				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
+
+APP_EVENT_TYPE_POOL_DEFINE(motion_event, 4);
@@ -21,3 +21,5 @@ APP_EVENT_TYPE_DEFINE(wheel_event,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_WHEEL_EVENT,
 				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
+
+APP_EVENT_TYPE_POOL_DEFINE(wheel_event, 4);
@@ -36,6 +36,10 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_MOTION_LOG_LEVEL);
 
 #define MAX_KEY_LEN 20
 
+#define REPORT_SYNC_LEAD_US		CONFIG_DESKTOP_MOTION_SENSOR_REPORT_SYNC_LEAD_US
+/* Longer gaps between reports are not treated as the report interval. */
+#define REPORT_SYNC_INTERVAL_MAX_US	20000
+
 enum state {
 	STATE_DISABLED,
 	STATE_DISABLED_SUSPENDED,
@@ -54,6 +58,8 @@ struct sensor_state {
 	uint8_t peer_count;
 	uint32_t option[MOTION_SENSOR_OPTION_COUNT];
 	uint32_t option_mask;
+	uint32_t last_report_us;
+	uint32_t report_interval_us;
 };
 
 enum sensor_opt {
@@ -70,6 +76,9 @@ static K_SEM_DEFINE(sem, 1, 1);
 static K_THREAD_STACK_DEFINE(thread_stack, THREAD_STACK_SIZE);
 static struct k_thread thread;
 
+static void sample_timer_handler(struct k_timer *timer);
+static K_TIMER_DEFINE(sample_timer, sample_timer_handler, NULL);
+
 static const struct device *sensor_dev =
 	DEVICE_DT_GET_ONE(MOTION_SENSOR_COMPATIBLE);
 
@@ -516,6 +525,60 @@ static void motion_thread_fn(void)
 	module_set_state(MODULE_STATE_ERROR);
 }
 
+static void sample_timer_handler(struct k_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&state.lock);
+
+	if (state.state == STATE_FETCHING) {
+		k_sem_give(&sem);
+	}
+
+	k_spin_unlock(&state.lock, key);
+}
+
+static uint32_t report_sync_delay_us(void)
+{
+	/* Must be called with state lock held. */
+	uint32_t now = k_cyc_to_us_floor32(k_cycle_get_32());
+	uint32_t interval = now - state.last_report_us;
+
+	state.last_report_us = now;
+
+	if (interval > REPORT_SYNC_INTERVAL_MAX_US) {
+		/* First report after a break in motion. */
+		return 0;
+	}
+
+	if (state.report_interval_us == 0) {
+		state.report_interval_us = interval;
+	} else {
+		/* Smooth out jitter of the transport. */
+		state.report_interval_us = (3 * state.report_interval_us + interval) / 4;
+	}
+
+	if (state.report_interval_us <= REPORT_SYNC_LEAD_US) {
+		return 0;
+	}
+
+	return state.report_interval_us - REPORT_SYNC_LEAD_US;
+}
+
+static void sample_request(void)
+{
+	/* Must be called with state lock held. */
+	uint32_t delay_us = 0;
+
+	if (IS_ENABLED(CONFIG_DESKTOP_MOTION_SENSOR_REPORT_SYNC)) {
+		delay_us = report_sync_delay_us();
+	}
+
+	if (delay_us > 0) {
+		k_timer_start(&sample_timer, K_USEC(delay_us), K_NO_WAIT);
+	} else {
+		k_sem_give(&sem);
+	}
+}
+
 static bool handle_usb_state_event(const struct usb_state_event *event)
 {
 	switch (event->state) {
@@ -545,7 +608,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			k_spinlock_key_t key = k_spin_lock(&state.lock);
 			if (state.state == STATE_FETCHING) {
 				state.sample = true;
-				k_sem_give(&sem);
+				sample_request();
 			}
 			k_spin_unlock(&state.lock, key);
 		}
@@ -155,6 +155,7 @@ static bool bt_stack_id_lut_valid;
 
 
 static struct k_work_delayable timeout;
+static uint8_t peer_id_to_store;
 
 static uint8_t get_app_id(void)
 {
@@ -409,7 +410,7 @@ static void select_next(void)
 	APP_EVENT_SUBMIT(event);
 }
 
-static int store_peer_id(uint8_t peer_id)
+static int store_peer_id_now(uint8_t peer_id)
 {
 	if (IS_ENABLED(CONFIG_SETTINGS)) {
 		char key[] = MODULE_NAME "/" PEER_ID_STORAGE_NAME;
@@ -425,6 +426,42 @@ static int store_peer_id(uint8_t peer_id)
 	return 0;
 }
 
+static void peer_id_store_fn(struct k_work *work)
+{
+	int err = store_peer_id_now(peer_id_to_store);
+
+	if (err) {
+		module_set_state(MODULE_STATE_ERROR);
+	}
+}
+
+static K_WORK_DELAYABLE_DEFINE(peer_id_store, peer_id_store_fn);
+
+static int store_peer_id(uint8_t peer_id)
+{
+	if (CONFIG_DESKTOP_BLE_PEER_ID_STORE_DELAY == 0) {
+		return store_peer_id_now(peer_id);
+	}
+
+	/* Write-behind the selection. Flash write does not delay connecting to the selected
+	 * peer and subsequent selections done within the delay result in a single write.
+	 */
+	peer_id_to_store = peer_id;
+	(void)k_work_reschedule(&peer_id_store, K_MSEC(CONFIG_DESKTOP_BLE_PEER_ID_STORE_DELAY));
+
+	return 0;
+}
+
+static void flush_peer_id(void)
+{
+	struct k_work_sync sync;
+
+	if ((CONFIG_DESKTOP_BLE_PEER_ID_STORE_DELAY > 0) &&
+	    k_work_cancel_delayable_sync(&peer_id_store, &sync)) {
+		peer_id_store_fn(NULL);
+	}
+}
+
 static void select_confirm(void)
 {
 	LOG_INF("Select peer");
@@ -1011,6 +1048,8 @@ static void config_fetch(const uint8_t opt_id, uint8_t *data, size_t *size)
 
 static bool handle_power_down_event(const struct power_down_event *event)
 {
+	flush_peer_id();
+
 	switch (state) {
 	case STATE_DISABLED:
 		state = STATE_DISABLED_STANDBY;
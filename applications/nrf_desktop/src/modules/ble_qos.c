@@ -55,6 +55,12 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_BLE_QOS_LOG_LEVEL);
 
 #define MAX_KEY_LEN 20
 
+/* CRC error ratio is stored as a fraction of UINT16_MAX. */
+#define CRC_ERR_RATIO_MAX		UINT16_MAX
+#define CRC_ERR_EWMA_SHIFT		3
+#define BURST_THRESHOLD \
+	((CRC_ERR_RATIO_MAX * CONFIG_DESKTOP_BLE_QOS_BURST_THRESHOLD) / 100)
+
 static K_THREAD_STACK_DEFINE(thread_stack, THREAD_STACK_SIZE);
 static struct k_thread thread;
 
@@ -84,6 +90,14 @@ struct params_blacklist {
 	uint16_t wifi_chn_bitmask;
 } __packed;
 
+struct params_crc_stats {
+	uint8_t worst_chn;
+	uint8_t worst_chn_err;
+	uint8_t avg_err;
+	uint16_t burst_updates;
+	uint16_t chmap_updates;
+} __packed;
+
 static uint8_t chmap_instance_buf[CHMAP_FILTER_INST_SIZE] __aligned(CHMAP_FILTER_INST_ALIGN);
 static struct chmap_instance *chmap_inst;
 static uint8_t current_chmap[CHMAP_BLE_BITMASK_SIZE] = CHMAP_BLE_BITMASK_DEFAULT;
@@ -92,6 +106,10 @@ static atomic_t new_blacklist;
 static atomic_t params_updated;
 static struct chmap_filter_params filter_params;
 static struct k_mutex data_access_mutex;
+static K_SEM_DEFINE(process_sem, 0, 1);
+static uint16_t crc_err_ewma[CHMAP_BLE_CHANNEL_COUNT];
+static uint16_t burst_update_cnt;
+static uint16_t chmap_update_cnt;
 
 BUILD_ASSERT(sizeof(struct bt_hci_cp_le_set_host_chan_classif) ==
 	     sizeof(struct params_chmap));
@@ -109,6 +127,7 @@ enum ble_qos_opt {
 	BLE_QOS_OPT_CHMAP,
 	BLE_QOS_OPT_PARAM_BLE,
 	BLE_QOS_OPT_PARAM_WIFI,
+	BLE_QOS_OPT_CRC_STATS,
 
 	BLE_QOS_OPT_COUNT
 };
@@ -117,7 +136,8 @@ static const char * const opt_descr[] = {
 	[BLE_QOS_OPT_BLACKLIST] = "blacklist",
 	[BLE_QOS_OPT_CHMAP] = "chmap",
 	[BLE_QOS_OPT_PARAM_BLE]	= "param_ble",
-	[BLE_QOS_OPT_PARAM_WIFI] = "param_wifi"
+	[BLE_QOS_OPT_PARAM_WIFI] = "param_wifi",
+	[BLE_QOS_OPT_CRC_STATS] = "crc_stats"
 };
 
 
@@ -400,6 +420,29 @@ static void hid_pkt_stats_print(uint32_t ble_recv)
 	send_uart_data(cdc_dev, (uint8_t *)str, str_len);
 }
 
+static void crc_stats_update(uint8_t chn, uint16_t crc_ok, uint16_t crc_err)
+{
+	uint32_t total = (uint32_t)crc_ok + crc_err;
+
+	if ((total == 0) || (chn >= ARRAY_SIZE(crc_err_ewma))) {
+		return;
+	}
+
+	int32_t ratio = ((uint32_t)crc_err * CRC_ERR_RATIO_MAX) / total;
+	int32_t prev = crc_err_ewma[chn];
+	int32_t ewma = prev + (ratio - prev) / (1 << CRC_ERR_EWMA_SHIFT);
+
+	crc_err_ewma[chn] = ewma;
+
+	/* A channel crossing the threshold indicates an interference burst. Do not wait for
+	 * the periodic processing to update the channel map.
+	 */
+	if (IS_ENABLED(CONFIG_DESKTOP_BLE_QOS_BURST_DETECT) &&
+	    (prev < BURST_THRESHOLD) && (ewma >= BURST_THRESHOLD)) {
+		k_sem_give(&process_sem);
+	}
+}
+
 static bool on_vs_evt(struct net_buf_simple *buf)
 {
 	uint8_t *subevent_code;
@@ -419,6 +462,10 @@ static bool on_vs_evt(struct net_buf_simple *buf)
 
 		evt = (void *)buf->data;
 
+		crc_stats_update(evt->channel_index,
+				 evt->crc_ok_count,
+				 evt->crc_error_count);
+
 		chmap_filter_crc_update(
 			chmap_inst,
 			evt->channel_index,
@@ -501,6 +548,11 @@ static void update_config(const uint8_t opt_id, const uint8_t *data,
 		LOG_WRN("Not supported");
 		break;
 
+	case BLE_QOS_OPT_CRC_STATS:
+		/* Statistics are read-only. */
+		LOG_WRN("Not supported");
+		break;
+
 	case BLE_QOS_OPT_PARAM_BLE:
 		if (size != sizeof(struct params_ble)) {
 			LOG_WRN("Invalid size");
@@ -599,6 +651,45 @@ static void fill_qos_blacklist(uint8_t *data, size_t *size)
 	*size = sizeof(struct params_blacklist);
 }
 
+static void fill_qos_crc_stats(uint8_t *data, size_t *size)
+{
+	struct params_crc_stats stats;
+	uint32_t err_sum = 0;
+	uint16_t worst_err = 0;
+	size_t pos = 0;
+
+	BUILD_ASSERT(sizeof(stats) <= CONFIG_CHANNEL_FETCHED_DATA_MAX_SIZE);
+
+	stats.worst_chn = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(crc_err_ewma); i++) {
+		uint16_t err = crc_err_ewma[i];
+
+		err_sum += err;
+		if (err > worst_err) {
+			worst_err = err;
+			stats.worst_chn = i;
+		}
+	}
+
+	data[pos] = stats.worst_chn;
+	pos += sizeof(stats.worst_chn);
+
+	data[pos] = ROUNDED_DIV(worst_err * 100, CRC_ERR_RATIO_MAX);
+	pos += sizeof(stats.worst_chn_err);
+
+	data[pos] = ROUNDED_DIV(err_sum * 100, CRC_ERR_RATIO_MAX * ARRAY_SIZE(crc_err_ewma));
+	pos += sizeof(stats.avg_err);
+
+	sys_put_le16(burst_update_cnt, &data[pos]);
+	pos += sizeof(stats.burst_updates);
+
+	sys_put_le16(chmap_update_cnt, &data[pos]);
+	pos += sizeof(stats.chmap_updates);
+
+	*size = pos;
+}
+
 static void fetch_config(const uint8_t opt_id, uint8_t *data, size_t *size)
 {
 	switch (opt_id) {
@@ -618,6 +709,10 @@ static void fetch_config(const uint8_t opt_id, uint8_t *data, size_t *size)
 		fill_qos_wifi_params(data, size);
 		break;
 
+	case BLE_QOS_OPT_CRC_STATS:
+		fill_qos_crc_stats(data, size);
+		break;
+
 	default:
 		LOG_WRN("Unknown opt: %" PRIu8, opt_id);
 	}
@@ -738,13 +833,33 @@ static void apply_new_params(void)
 	}
 }
 
+static bool wait_for_processing(void)
+{
+	static int64_t last_process_time;
+
+	/* Semaphore is given on interference burst. */
+	bool burst = !k_sem_take(&process_sem, K_MSEC(CONFIG_DESKTOP_BLE_QOS_INTERVAL));
+
+	if (burst) {
+		int64_t elapsed = k_uptime_get() - last_process_time;
+
+		if (elapsed < CONFIG_DESKTOP_BLE_QOS_BURST_MIN_INTERVAL) {
+			k_sleep(K_MSEC(CONFIG_DESKTOP_BLE_QOS_BURST_MIN_INTERVAL - elapsed));
+		}
+	}
+
+	last_process_time = k_uptime_get();
+
+	return burst;
+}
+
 static void ble_qos_thread_fn(void)
 {
 	while (true) {
 		bool update_channel_map;
 		int err;
 
-		k_sleep(K_MSEC(CONFIG_DESKTOP_BLE_QOS_INTERVAL));
+		bool burst = wait_for_processing();
 
 		/* Check and apply new parameters received via config channel */
 		if (atomic_get(&params_updated)) {
@@ -777,6 +892,11 @@ static void ble_qos_thread_fn(void)
 			continue;
 		}
 
+		chmap_update_cnt++;
+		if (burst) {
+			burst_update_cnt++;
+		}
+
 		uint8_t *chmap;
 
 		chmap = chmap_filter_suggested_map_get(chmap_inst);
@@ -5,18 +5,53 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
 #include <debug/cpu_load.h>
 
 #define MODULE cpu_meas
 #include <caf/events/module_state_event.h>
+#include <caf/events/button_event.h>
 
 #include "cpu_load_event.h"
+#include "input_latency_event.h"
+#include "hid_event.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_CPU_MEAS_LOG_LEVEL);
 
+#define LOAD_MAX	100000 /* 0,001% units */
+
 static struct k_work_delayable cpu_load_read;
 
+#if CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS
+struct thread_load {
+	const struct k_thread *thread;
+	uint64_t prev_cycles;
+	uint32_t load;
+	bool alive;
+};
+
+static struct thread_load thread_loads[CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS_MAX];
+static size_t thread_load_cnt;
+static uint64_t prev_total_cycles;
+static struct k_spinlock thread_loads_lock;
+#endif /* CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS */
+
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+struct latency_stats {
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t cnt;
+};
+
+static struct latency_stats latency_stats;
+static struct k_spinlock latency_stats_lock;
+static uint32_t press_timestamp;
+static uint16_t press_key_id;
+static bool press_pending;
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
 
 static void send_cpu_load_event(uint32_t load)
 {
@@ -26,11 +61,159 @@ static void send_cpu_load_event(uint32_t load)
 	APP_EVENT_SUBMIT(event);
 }
 
+#if CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS
+static struct thread_load *thread_load_get(const struct k_thread *thread)
+{
+	for (size_t i = 0; i < thread_load_cnt; i++) {
+		if (thread_loads[i].thread == thread) {
+			return &thread_loads[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void thread_load_update_fn(const struct k_thread *thread, void *user_data)
+{
+	const uint64_t *period = user_data;
+	k_thread_runtime_stats_t stats;
+
+	if (k_thread_runtime_stats_get((k_tid_t)thread, &stats)) {
+		return;
+	}
+
+	struct thread_load *tl = thread_load_get(thread);
+
+	if (!tl) {
+		if (thread_load_cnt == ARRAY_SIZE(thread_loads)) {
+			return;
+		}
+
+		/* Start measuring the new thread in the next period. */
+		tl = &thread_loads[thread_load_cnt];
+		thread_load_cnt++;
+
+		tl->thread = thread;
+		tl->prev_cycles = stats.execution_cycles;
+		tl->load = 0;
+		tl->alive = true;
+		return;
+	}
+
+	uint64_t delta = stats.execution_cycles - tl->prev_cycles;
+
+	tl->prev_cycles = stats.execution_cycles;
+	tl->load = (*period > 0) ? MIN(delta * LOAD_MAX / *period, LOAD_MAX) : 0;
+	tl->alive = true;
+}
+
+static void thread_loads_update(void)
+{
+	k_thread_runtime_stats_t total;
+
+	if (k_thread_runtime_stats_all_get(&total)) {
+		return;
+	}
+
+	uint64_t period = total.execution_cycles - prev_total_cycles;
+
+	prev_total_cycles = total.execution_cycles;
+
+	k_spinlock_key_t key = k_spin_lock(&thread_loads_lock);
+
+	for (size_t i = 0; i < thread_load_cnt; i++) {
+		thread_loads[i].alive = false;
+	}
+
+	k_thread_foreach(thread_load_update_fn, &period);
+
+	/* Drop threads that were aborted. */
+	size_t cnt = 0;
+
+	for (size_t i = 0; i < thread_load_cnt; i++) {
+		if (thread_loads[i].alive) {
+			thread_loads[cnt] = thread_loads[i];
+			cnt++;
+		}
+	}
+	thread_load_cnt = cnt;
+
+	k_spin_unlock(&thread_loads_lock, key);
+}
+#endif /* CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS */
+
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+static void send_input_latency_event(uint16_t key_id, uint32_t latency)
+{
+	struct input_latency_event *event = new_input_latency_event();
+
+	event->key_id = key_id;
+	event->latency = latency;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void handle_button_event(const struct button_event *event)
+{
+	/* Measure a single press at a time. A press that is not followed by
+	 * a HID report within the timeout is replaced by the subsequent press.
+	 */
+	if (!event->pressed) {
+		return;
+	}
+
+	uint32_t now = k_cycle_get_32();
+
+	if (press_pending &&
+	    (k_cyc_to_ms_floor32(now - press_timestamp) <
+	     CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY_TIMEOUT)) {
+		return;
+	}
+
+	press_timestamp = now;
+	press_key_id = event->key_id;
+	press_pending = true;
+}
+
+static void handle_hid_report_sent_event(const struct hid_report_sent_event *event)
+{
+	if (!press_pending || event->error) {
+		return;
+	}
+
+	press_pending = false;
+
+	uint32_t latency = k_cyc_to_us_floor32(k_cycle_get_32() - press_timestamp);
+
+	if (latency >= CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY_TIMEOUT * USEC_PER_MSEC) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&latency_stats_lock);
+
+	if ((latency_stats.cnt == 0) || (latency < latency_stats.min)) {
+		latency_stats.min = latency;
+	}
+	if (latency > latency_stats.max) {
+		latency_stats.max = latency;
+	}
+	latency_stats.sum += latency;
+	latency_stats.cnt++;
+
+	k_spin_unlock(&latency_stats_lock, key);
+
+	send_input_latency_event(press_key_id, latency);
+}
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
 static void cpu_load_read_fn(struct k_work *work)
 {
 	send_cpu_load_event(cpu_load_get());
 	cpu_load_reset();
 
+#if CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS
+	thread_loads_update();
+#endif
+
 	k_work_reschedule(&cpu_load_read,
 		K_MSEC(CONFIG_DESKTOP_CPU_MEAS_PERIOD));
 }
@@ -72,6 +255,18 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+	if (is_button_event(aeh)) {
+		handle_button_event(cast_button_event(aeh));
+		return false;
+	}
+
+	if (is_hid_report_sent_event(aeh)) {
+		handle_hid_report_sent_event(cast_hid_report_sent_event(aeh));
+		return false;
+	}
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
 	/* If event is unhandled, unsubscribe. */
 	__ASSERT_NO_MSG(false);
 
@@ -80,3 +275,82 @@ static bool app_event_handler(const struct app_event_header *aeh)
 
 APP_EVENT_LISTENER(MODULE, app_event_handler);
 APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+APP_EVENT_SUBSCRIBE_EARLY(MODULE, button_event);
+APP_EVENT_SUBSCRIBE(MODULE, hid_report_sent_event);
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int shell_show_threads(const struct shell *shell, size_t argc, char **argv)
+{
+#if CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS
+	struct thread_load loads[ARRAY_SIZE(thread_loads)];
+	size_t cnt;
+
+	k_spinlock_key_t key = k_spin_lock(&thread_loads_lock);
+
+	cnt = thread_load_cnt;
+	memcpy(loads, thread_loads, cnt * sizeof(loads[0]));
+
+	k_spin_unlock(&thread_loads_lock, key);
+
+	shell_print(shell, "Thread CPU load in last %d ms period:", CONFIG_DESKTOP_CPU_MEAS_PERIOD);
+
+	for (size_t i = 0; i < cnt; i++) {
+		const char *name = k_thread_name_get((k_tid_t)loads[i].thread);
+
+		shell_print(shell, "\t%p %-24s %3u,%03u%%", (void *)loads[i].thread,
+			    name ? name : "", loads[i].load / 1000, loads[i].load % 1000);
+	}
+#else
+	shell_print(shell, "Thread statistics disabled");
+#endif /* CONFIG_DESKTOP_CPU_MEAS_THREAD_STATS */
+
+	return 0;
+}
+
+static int shell_show_latency(const struct shell *shell, size_t argc, char **argv)
+{
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+	k_spinlock_key_t key = k_spin_lock(&latency_stats_lock);
+	struct latency_stats stats = latency_stats;
+
+	k_spin_unlock(&latency_stats_lock, key);
+
+	if (stats.cnt == 0) {
+		shell_print(shell, "No input latency measurements");
+	} else {
+		shell_print(shell, "Input latency [us]: min %u avg %u max %u (%u samples)",
+			    stats.min, (uint32_t)(stats.sum / stats.cnt), stats.max,
+			    stats.cnt);
+	}
+#else
+	shell_print(shell, "Input latency measurement disabled");
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
+	return 0;
+}
+
+static int shell_reset_latency(const struct shell *shell, size_t argc, char **argv)
+{
+#if CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY
+	k_spinlock_key_t key = k_spin_lock(&latency_stats_lock);
+
+	memset(&latency_stats, 0, sizeof(latency_stats));
+
+	k_spin_unlock(&latency_stats_lock, key);
+#endif /* CONFIG_DESKTOP_CPU_MEAS_INPUT_LATENCY */
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_cpu_meas,
+	SHELL_CMD_ARG(threads, NULL, "Show CPU load of threads", shell_show_threads, 0, 0),
+	SHELL_CMD_ARG(latency, NULL, "Show input latency", shell_show_latency, 0, 0),
+	SHELL_CMD_ARG(latency_reset, NULL, "Reset input latency statistics",
+		      shell_reset_latency, 0, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(cpu_meas, &sub_cpu_meas, "CPU measurement commands", NULL);
+#endif /* CONFIG_SHELL */
@@ -8,6 +8,7 @@
 
 #include <zephyr/types.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/sys/reboot.h>
 
@@ -295,6 +296,56 @@ static void background_erase_handler(struct k_work *work)
 	}
 }
 
+static bool is_image_valid(void)
+{
+	/* Initial CRC value used by the host. */
+	uint32_t crc = 1;
+
+	/* Whole image is already stored, sync buffer can be reused. */
+	__ASSERT_NO_MSG(sync_offset == 0);
+
+	for (uint32_t off = 0; off < img_length; off += sizeof(sync_buffer)) {
+		size_t len = MIN(sizeof(sync_buffer), img_length - off);
+		int err = flash_area_read(flash_area, off, sync_buffer, len);
+
+		if (err) {
+			LOG_ERR("Cannot read image (%d)", err);
+			return false;
+		}
+
+		crc = crc32_ieee_update(crc, sync_buffer, len);
+	}
+
+	if (crc != img_csum) {
+		LOG_ERR("Image checksum mismatch: 0x%" PRIx32 " != 0x%" PRIx32, crc, img_csum);
+		return false;
+	}
+
+	return true;
+}
+
+static void drop_dfu_image(void)
+{
+	__ASSERT_NO_MSG(flash_area != NULL);
+
+	flash_area_close(flash_area);
+	/* Cancel cannot fail if executed from another work's context. */
+	(void)k_work_cancel_delayable(&dfu_timeout);
+	flash_area = NULL;
+	sync_offset = 0;
+
+	if (IS_ENABLED(CONFIG_CAF_POWER_MANAGER_EVENTS)) {
+		power_manager_restrict(MODULE_IDX(MODULE), POWER_MANAGER_LEVEL_MAX);
+	}
+
+	/* DFU lock is released after the update slot is erased. */
+	is_flash_area_clean = false;
+	cur_offset = 0;
+	img_length = 0;
+	img_csum = 0;
+	k_work_reschedule(&background_erase, K_NO_WAIT);
+}
+
 static void complete_dfu_data_store(void)
 {
 	cur_offset += sync_offset;
@@ -304,6 +355,12 @@ static void complete_dfu_data_store(void)
 	LOG_DBG("DFU data store complete: %" PRIu32, cur_offset);
 
 	if (cur_offset == img_length) {
+		if (IS_ENABLED(CONFIG_DESKTOP_CONFIG_CHANNEL_DFU_IMAGE_CRC_CHECK) &&
+		    !is_image_valid()) {
+			drop_dfu_image();
+			return;
+		}
+
 		LOG_INF("DFU image written");
 #if CONFIG_BOOTLOADER_MCUBOOT && !CONFIG_DESKTOP_CONFIG_CHANNEL_DFU_MCUBOOT_DIRECT_XIP
 		int err = boot_request_upgrade(false);
@@ -88,6 +88,14 @@ static struct hids_peripheral peripherals[CONFIG_BT_MAX_CONN];
 static uint8_t peripheral_cache[CONFIG_BT_MAX_CONN];
 static bool suspended;
 
+/* Reports are enqueued at peripherals and may be migrated to subscribers on disconnection. */
+#define ENQUEUED_SLAB_BLOCK_COUNT \
+	((CONFIG_BT_MAX_CONN + CONFIG_USB_HID_DEVICE_COUNT) * ARRAY_SIZE(input_reports) * \
+	 MAX_ENQUEUED_ITEMS)
+K_MEM_SLAB_DEFINE_STATIC(enqueued_slab, sizeof(struct enqueued_report),
+			 ENQUEUED_SLAB_BLOCK_COUNT, __alignof__(struct enqueued_report));
+static size_t enqueued_slab_peak;
+
 
 static void hogp_out_rep_write_cb(struct bt_hogp *hogp, struct bt_hogp_rep_info *rep, uint8_t err);
 static int send_hid_out_report(struct bt_hogp *hogp, const uint8_t *data, size_t size);
@@ -266,7 +274,7 @@ static void drop_enqueued_reports(struct enqueued_reports *enqueued_reports,
 		item = get_enqueued_report(enqueued_reports, irep_idx);
 
 		app_event_manager_free(item->report);
-		k_free(item);
+		k_mem_slab_free(&enqueued_slab, item);
 	}
 }
 
@@ -343,6 +351,65 @@ static void migrate_enqueued_reports(struct enqueued_reports *dst_reports,
 	}
 }
 
+static int16_t mouse_xy_decode(uint16_t raw)
+{
+	/* Sign extend 12-bit value. */
+	return (raw & BIT(11)) ? (int16_t)(raw | 0xf000) : (int16_t)raw;
+}
+
+static bool mouse_report_merge(uint8_t *dst, const uint8_t *src)
+{
+	/* Report ID is placed in front of the mouse report data. */
+	BUILD_ASSERT(REPORT_SIZE_MOUSE == 5, "Invalid report size");
+
+	if (dst[1] != src[1]) {
+		/* Merging motion across a button change would alter a drag. */
+		return false;
+	}
+
+	int32_t wheel = (int8_t)dst[2] + (int8_t)src[2];
+	int32_t x = mouse_xy_decode(dst[3] | ((dst[4] & 0x0f) << 8)) +
+		    mouse_xy_decode(src[3] | ((src[4] & 0x0f) << 8));
+	int32_t y = mouse_xy_decode((dst[4] >> 4) | (dst[5] << 4)) +
+		    mouse_xy_decode((src[4] >> 4) | (src[5] << 4));
+
+	if ((wheel < MOUSE_REPORT_WHEEL_MIN) || (wheel > MOUSE_REPORT_WHEEL_MAX) ||
+	    (x < MOUSE_REPORT_XY_MIN) || (x > MOUSE_REPORT_XY_MAX) ||
+	    (y < MOUSE_REPORT_XY_MIN) || (y > MOUSE_REPORT_XY_MAX)) {
+		return false;
+	}
+
+	dst[2] = wheel;
+	dst[3] = x;
+	dst[4] = ((y & 0x0f) << 4) | ((x >> 8) & 0x0f);
+	dst[5] = y >> 4;
+
+	return true;
+}
+
+static bool merge_hid_report(struct counted_list *reports, struct hid_report_event *report)
+{
+	if (!IS_ENABLED(CONFIG_DESKTOP_HID_FORWARD_MOUSE_MOTION_MERGE) ||
+	    (report->dyndata.data[0] != REPORT_ID_MOUSE) ||
+	    (report->dyndata.size != sizeof(uint8_t) + REPORT_SIZE_MOUSE)) {
+		return false;
+	}
+
+	sys_snode_t *node = sys_slist_peek_tail(&reports->list);
+
+	if (!node) {
+		return false;
+	}
+
+	struct enqueued_report *item = CONTAINER_OF(node, struct enqueued_report, node);
+
+	if (item->report->dyndata.size != report->dyndata.size) {
+		return false;
+	}
+
+	return mouse_report_merge(item->report->dyndata.data, report->dyndata.data);
+}
+
 static void enqueue_hid_report(struct enqueued_reports *enqueued_reports,
 			       size_t irep_idx,
 			       struct hid_report_event *report)
@@ -351,10 +418,26 @@ static void enqueue_hid_report(struct enqueued_reports *enqueued_reports,
 
 	struct counted_list *reports = &enqueued_reports->reports[irep_idx];
 
-	struct enqueued_report *item;
+	struct enqueued_report *item = NULL;
+
+	if (merge_hid_report(reports, report)) {
+		/* Motion was added to the newest enqueued report. */
+		app_event_manager_free(report);
+		return;
+	}
 
 	if (reports->count < MAX_ENQUEUED_ITEMS) {
-		item = k_malloc(sizeof(*item));
+		if (k_mem_slab_alloc(&enqueued_slab, (void **)&item, K_NO_WAIT)) {
+			item = NULL;
+		} else {
+			size_t used = k_mem_slab_num_used_get(&enqueued_slab);
+
+			if (used > enqueued_slab_peak) {
+				enqueued_slab_peak = used;
+				LOG_DBG("Enqueued reports peak occupancy: %zu/%zu",
+					used, ENQUEUED_SLAB_BLOCK_COUNT);
+			}
+		}
 	} else {
 		LOG_WRN("Enqueue dropped the oldest report");
 		item = get_enqueued_report(enqueued_reports, irep_idx);
@@ -362,9 +445,11 @@ static void enqueue_hid_report(struct enqueued_reports *enqueued_reports,
 	}
 
 	if (!item) {
-		LOG_ERR("Dropped HID report");
-		/* Should never happen. */
-		__ASSERT_NO_MSG(false);
+		/* Reports migrated to a busy subscriber on peripheral disconnection can
+		 * temporarily exhaust the pool.
+		 */
+		LOG_WRN("Enqueued reports pool full, dropped HID report");
+		app_event_manager_free(report);
 	} else {
 		item->report = report;
 		sys_slist_append(&reports->list, &item->node);
@@ -1225,7 +1310,7 @@ static void send_enqueued_report(struct subscriber *sub)
 	if (item) {
 		APP_EVENT_SUBMIT(item->report);
 
-		k_free(item);
+		k_mem_slab_free(&enqueued_slab, item);
 
 		sub->busy = true;
 	}
@@ -144,6 +144,12 @@ static uint8_t report_data_index[REPORT_ID_COUNT];
 static uint8_t report_state_index[REPORT_ID_COUNT];
 static struct hid_state state;
 
+/* Every event queue holds up to CONFIG_DESKTOP_HID_EVENT_QUEUE_SIZE events. */
+#define EVENTQ_SLAB_BLOCK_COUNT (INPUT_REPORT_DATA_COUNT * CONFIG_DESKTOP_HID_EVENT_QUEUE_SIZE)
+K_MEM_SLAB_DEFINE_STATIC(eventq_slab, sizeof(struct item_event), EVENTQ_SLAB_BLOCK_COUNT,
+			 __alignof__(struct item_event));
+static size_t eventq_slab_peak;
+
 
 static bool report_send(struct report_state *rs,
 			struct report_data *rd,
@@ -188,6 +194,45 @@ static void *bsearch(const void *key, const uint8_t *base,
 	return NULL;
 }
 
+#if CONFIG_DESKTOP_HID_STATE_KEYMAP_LUT
+/* Open addressing hash table with index of the HID keymap entry increased by one.
+ * Zero marks an empty slot. The table is at most half full, so the probe
+ * sequence is short.
+ */
+#define KEYMAP_LUT_SIZE (2 * ARRAY_SIZE(hid_keymap) + 1)
+BUILD_ASSERT(ARRAY_SIZE(hid_keymap) < UINT16_MAX);
+static uint16_t keymap_lut[KEYMAP_LUT_SIZE];
+
+static void keymap_lut_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(hid_keymap); i++) {
+		size_t pos = hid_keymap[i].key_id % KEYMAP_LUT_SIZE;
+
+		while (keymap_lut[pos] != 0) {
+			pos = (pos + 1) % KEYMAP_LUT_SIZE;
+		}
+
+		keymap_lut[pos] = i + 1;
+	}
+}
+
+static struct hid_keymap *keymap_lut_get(uint16_t key_id)
+{
+	size_t pos = key_id % KEYMAP_LUT_SIZE;
+
+	while (keymap_lut[pos] != 0) {
+		const struct hid_keymap *map = &hid_keymap[keymap_lut[pos] - 1];
+
+		if (map->key_id == key_id) {
+			return (struct hid_keymap *)map;
+		}
+
+		pos = (pos + 1) % KEYMAP_LUT_SIZE;
+	}
+
+	return NULL;
+}
+#else
 /**@brief Compare Key ID in HID Keymap entries. */
 static int hid_keymap_compare(const void *a, const void *b)
 {
@@ -196,10 +241,14 @@ static int hid_keymap_compare(const void *a, const void *b)
 
 	return (p_a->key_id - p_b->key_id);
 }
+#endif /* CONFIG_DESKTOP_HID_STATE_KEYMAP_LUT */
 
 /**@brief Translate Key ID to HID Usage ID and target report. */
 static struct hid_keymap *hid_keymap_get(uint16_t key_id)
 {
+#if CONFIG_DESKTOP_HID_STATE_KEYMAP_LUT
+	return keymap_lut_get(key_id);
+#else
 	struct hid_keymap key = {
 		.key_id = key_id
 	};
@@ -211,6 +260,7 @@ static struct hid_keymap *hid_keymap_get(uint16_t key_id)
 					 hid_keymap_compare);
 
 	return map;
+#endif
 }
 
 /**@brief Compare two usage values. */
@@ -230,7 +280,7 @@ static void eventq_reset(struct eventq *eventq)
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&eventq->root, event, tmp, node) {
 		sys_slist_remove(&eventq->root, NULL, &event->node);
 
-		k_free(event);
+		k_mem_slab_free(&eventq_slab, event);
 	}
 
 	sys_slist_init(&eventq->root);
@@ -267,15 +317,23 @@ static struct item_event *eventq_get(struct eventq *eventq)
 
 static void eventq_append(struct eventq *eventq, uint16_t usage_id, int16_t value)
 {
-	struct item_event *hid_event = k_malloc(sizeof(*hid_event));
+	struct item_event *hid_event;
+	int err = k_mem_slab_alloc(&eventq_slab, (void **)&hid_event, K_NO_WAIT);
 
-	if (!hid_event) {
+	if (err) {
 		LOG_ERR("Failed to allocate HID event");
 		/* Should never happen. */
 		__ASSERT_NO_MSG(false);
 		return;
 	}
 
+	size_t used = k_mem_slab_num_used_get(&eventq_slab);
+
+	if (used > eventq_slab_peak) {
+		eventq_slab_peak = used;
+		LOG_DBG("HID event queues peak occupancy: %zu/%d", used, EVENTQ_SLAB_BLOCK_COUNT);
+	}
+
 	hid_event->item.usage_id = usage_id;
 	hid_event->item.value = value;
 	hid_event->timestamp = k_uptime_get_32();
@@ -296,7 +354,7 @@ static void eventq_region_purge(struct eventq *eventq,
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&eventq->root, tmp, tmp_safe) {
 		sys_slist_remove(&eventq->root, NULL, tmp);
 
-		k_free(CONTAINER_OF(tmp, struct item_event, node));
+		k_mem_slab_free(&eventq_slab, CONTAINER_OF(tmp, struct item_event, node));
 		cnt++;
 
 		if (tmp == last_to_purge) {
@@ -403,20 +461,19 @@ static void eventq_cleanup(struct eventq *eventq, uint32_t timestamp)
 
 static void sort_by_usage_id(struct item items[], size_t array_size)
 {
-	for (size_t k = 0; k < array_size; k++) {
-		size_t id = k;
+	/* Insertion sort. Only one item changes between the calls, so the array
+	 * is almost sorted and a single pass is needed.
+	 */
+	for (size_t k = 1; k < array_size; k++) {
+		struct item tmp = items[k];
+		size_t l = k;
 
-		for (size_t l = k + 1; l < array_size; l++) {
-			if (items[l].usage_id < items[id].usage_id) {
-				id = l;
-			}
+		while ((l > 0) && (items[l - 1].usage_id > tmp.usage_id)) {
+			items[l] = items[l - 1];
+			l--;
 		}
-		if (id != k) {
-			struct item tmp = items[k];
 
-			items[k] = items[id];
-			items[id] = tmp;
-		}
+		items[l] = tmp;
 	}
 }
 
@@ -843,8 +900,7 @@ static bool update_report(struct report_data *rd)
 
 		rd->linked_rs->update_needed = rd->linked_rs->update_needed || update_needed;
 
-
-		k_free(event);
+		k_mem_slab_free(&eventq_slab, event);
 
 		/* If no item was changed, try next event. */
 	}
@@ -1356,6 +1412,10 @@ static void init(void)
 		}
 	}
 
+#if CONFIG_DESKTOP_HID_STATE_KEYMAP_LUT
+	keymap_lut_init();
+#endif
+
 	/* Mark unused report IDs. */
 	for (size_t i = 0; i < ARRAY_SIZE(report_data_index); i++) {
 		report_data_index[i] = INPUT_REPORT_DATA_COUNT;
@@ -17,9 +17,11 @@
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_LED_STREAM_LOG_LEVEL);
 
 #define INCOMING_LED_COLOR_COUNT 3
-#define LED_STREAM_DATA_SIZE 8
+#define LED_STREAM_STEP_SIZE 7
+#define LED_STREAM_DATA_SIZE (LED_STREAM_STEP_SIZE + 1)
 #define FETCH_CONFIG_SIZE 2
 #define LED_ID_POS 7
+#define BULK_LED_ID_POS 0
 
 #define LED_ID(led) ((led) - &leds[0])
 
@@ -31,6 +33,7 @@ struct led {
 	struct led_effect_step steps_queue[STEPS_QUEUE_ARRAY_SIZE];
 	uint8_t rx_idx;
 	uint8_t tx_idx;
+	uint8_t playing_cnt;
 	bool streaming;
 };
 
@@ -46,6 +49,7 @@ static bool initialized;
 enum led_stream_opt {
 	LED_STREAM_OPT_SET_LED_EFFECT,
 	LED_STREAM_OPT_GET_LEDS_STATE,
+	LED_STREAM_OPT_SET_LED_EFFECTS,
 
 	LED_STREAM_OPT_COUNT,
 };
@@ -53,6 +57,7 @@ enum led_stream_opt {
 const static char * const opt_descr[] = {
 	[LED_STREAM_OPT_SET_LED_EFFECT] = "set_led_effect",
 	[LED_STREAM_OPT_GET_LEDS_STATE] = "get_leds_state",
+	[LED_STREAM_OPT_SET_LED_EFFECTS] = "set_led_effects",
 };
 
 
@@ -61,37 +66,32 @@ static size_t next_index(size_t index)
 	return (index + 1) % STEPS_QUEUE_ARRAY_SIZE;
 }
 
-static bool queue_data(const uint8_t *data, const size_t size, struct led *led)
+static bool queue_data(const uint8_t *data, struct led *led)
 {
-	BUILD_ASSERT(ARRAY_SIZE(led->steps_queue[led->rx_idx].color.c) == INCOMING_LED_COLOR_COUNT,
-		     "");
+	struct led_effect_step *step = &led->steps_queue[led->rx_idx];
 
-	static const size_t min_len = sizeof(led->steps_queue[led->rx_idx].color.c)
-				    + sizeof(led->steps_queue[led->rx_idx].substep_count)
-				    + sizeof(led->steps_queue[led->rx_idx].substep_time)
-				    + sizeof(uint8_t); /* LED ID */
+	BUILD_ASSERT(ARRAY_SIZE(step->color.c) == INCOMING_LED_COLOR_COUNT, "");
 
-	BUILD_ASSERT(min_len <= LED_STREAM_DATA_SIZE, "");
+	static const size_t min_len = sizeof(step->color.c)
+				    + sizeof(step->substep_count)
+				    + sizeof(step->substep_time);
 
-	if (size != LED_STREAM_DATA_SIZE) {
-		LOG_WRN("Invalid stream data size (%zu)", size);
-		return false;
-	}
+	BUILD_ASSERT(min_len <= LED_STREAM_STEP_SIZE, "");
 
 	LOG_DBG("Enqueue effect data");
 
 	size_t pos = 0;
 
-	for (size_t i = 0; i < ARRAY_SIZE(led->steps_queue[led->rx_idx].color.c); i++, pos++) {
-		led->steps_queue[led->rx_idx].color.c[i] = COLOR_BRIGHTNESS_TO_PCT(data[pos]);
+	for (size_t i = 0; i < ARRAY_SIZE(step->color.c); i++, pos++) {
+		step->color.c[i] = COLOR_BRIGHTNESS_TO_PCT(data[pos]);
 	}
 
-	led->steps_queue[led->rx_idx].substep_count = sys_get_le16(&data[pos]);
-	pos += sizeof(led->steps_queue[led->rx_idx].substep_count);
+	step->substep_count = sys_get_le16(&data[pos]);
+	pos += sizeof(step->substep_count);
 
-	led->steps_queue[led->rx_idx].substep_time = sys_get_le16(&data[pos]);
+	step->substep_time = sys_get_le16(&data[pos]);
 
-	if (led->steps_queue[led->rx_idx].substep_count == 0) {
+	if (step->substep_count == 0) {
 		LOG_WRN("Dropped led_effect with substep count equal 0");
 		return false;
 	}
@@ -127,7 +127,7 @@ static bool is_queue_empty(struct led *led)
 	return led->rx_idx == led->tx_idx;
 }
 
-static bool store_data(const uint8_t *data, const size_t size, struct led *led)
+static bool store_data(const uint8_t *data, struct led *led)
 {
 	size_t free_places = count_free_places(led);
 
@@ -135,7 +135,7 @@ static bool store_data(const uint8_t *data, const size_t size, struct led *led)
 		LOG_DBG("Insert data on position %" PRIu8
 			", free places %zu", led->rx_idx, free_places);
 
-		if (!queue_data(data, size, led)) {
+		if (!queue_data(data, led)) {
 			return false;
 		}
 	} else {
@@ -145,15 +145,30 @@ static bool store_data(const uint8_t *data, const size_t size, struct led *led)
 	return true;
 }
 
+static size_t count_contiguous_steps(struct led *led)
+{
+	if (led->rx_idx >= led->tx_idx) {
+		return led->rx_idx - led->tx_idx;
+	}
+
+	return STEPS_QUEUE_ARRAY_SIZE - led->tx_idx;
+}
+
 static void send_data_from_queue(struct led *led)
 {
+	/* Steps played so far can be reused. */
+	led->tx_idx = (led->tx_idx + led->playing_cnt) % STEPS_QUEUE_ARRAY_SIZE;
+	led->playing_cnt = 0;
+
 	if (!is_queue_empty(led)) {
+		/* Play all of the steps enqueued so far as a single effect to avoid LED event
+		 * round trip after every step. The steps are kept in the queue until played.
+		 */
+		led->playing_cnt = count_contiguous_steps(led);
 		led->led_stream_effect.steps = &led->steps_queue[led->tx_idx];
-		led->led_stream_effect.step_count = 1;
+		led->led_stream_effect.step_count = led->playing_cnt;
 
 		send_effect(&led->led_stream_effect, led);
-
-		led->tx_idx = next_index(led->tx_idx);
 	} else {
 		LOG_INF("No steps ready in queue, stop streaming");
 
@@ -163,32 +178,75 @@ static void send_data_from_queue(struct led *led)
 	}
 }
 
-static void handle_incoming_step(const uint8_t *data, const size_t size)
+static void start_streaming(struct led *led, size_t led_id)
+{
+	if (!led->streaming) {
+		LOG_DBG("Sending first led effect for led %zu", led_id);
+
+		led->streaming = true;
+
+		send_data_from_queue(led);
+	}
+}
+
+static struct led *get_led(const uint8_t *data, size_t led_id_pos, size_t *led_id)
 {
 	if (!initialized) {
 		LOG_WRN("Not initialized");
+		return NULL;
+	}
+
+	*led_id = data[led_id_pos];
+
+	if (*led_id >= ARRAY_SIZE(leds)) {
+		LOG_WRN("Wrong LED ID: %zu, effect ignored", *led_id);
+		return NULL;
+	}
+
+	return &leds[*led_id];
+}
+
+static void handle_incoming_step(const uint8_t *data, const size_t size)
+{
+	if (size != LED_STREAM_DATA_SIZE) {
+		LOG_WRN("Invalid stream data size (%zu)", size);
 		return;
 	}
 
-	size_t led_id = data[LED_ID_POS];
+	size_t led_id;
+	struct led *led = get_led(data, LED_ID_POS, &led_id);
 
-	if (led_id >= ARRAY_SIZE(leds)) {
-		LOG_WRN("Wrong LED ID: %zu, effect ignored", led_id);
+	if (!led || !store_data(data, led)) {
 		return;
 	}
 
-	struct led *led = &leds[led_id];
+	start_streaming(led, led_id);
+}
 
-	if (!store_data(data, size, led)) {
+static void handle_incoming_steps(const uint8_t *data, const size_t size)
+{
+	/* LED ID followed by a sequence of steps. */
+	if ((size <= sizeof(uint8_t)) ||
+	    ((size - sizeof(uint8_t)) % LED_STREAM_STEP_SIZE) != 0) {
+		LOG_WRN("Invalid stream data size (%zu)", size);
 		return;
 	}
 
-	if (!led->streaming) {
-		LOG_DBG("Sending first led effect for led %zu", led_id);
+	size_t led_id;
+	struct led *led = get_led(data, BULK_LED_ID_POS, &led_id);
 
-		led->streaming = true;
+	if (!led) {
+		return;
+	}
 
-		send_data_from_queue(led);
+	for (size_t pos = sizeof(uint8_t); pos < size; pos += LED_STREAM_STEP_SIZE) {
+		if (!store_data(&data[pos], led)) {
+			break;
+		}
+	}
+
+	if (!is_queue_empty(led)) {
+		start_streaming(led, led_id);
 	}
 }
 
@@ -199,6 +257,10 @@ static void config_set(const uint8_t opt_id, const uint8_t *data, const size_t s
 		handle_incoming_step(data, size);
 		break;
 
+	case LED_STREAM_OPT_SET_LED_EFFECTS:
+		handle_incoming_steps(data, size);
+		break;
+
 	default:
 		LOG_WRN("Unknown config set: %" PRIu8, opt_id);
 		break;
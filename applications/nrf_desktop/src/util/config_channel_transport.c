@@ -12,6 +12,7 @@
 
 #define MODULE config_channel_transport
 #define TRANSPORT_HEADER_SIZE		4
+#define EVENT_ID_POS			1
 #define CONFIG_STATUS_POS		2
 
 #include <zephyr/logging/log.h>
@@ -165,6 +166,7 @@ static void timeout_fn(struct k_work *work)
 	/* Send response with timeout status, without aditional data. */
 	transport->data[CONFIG_STATUS_POS] = CONFIG_STATUS_TIMEOUT;
 	drop_transactions(transport);
+	transport->in_flight = 0;
 	transport->state = CONFIG_CHANNEL_TRANSPORT_RSP_READY;
 }
 
@@ -199,14 +201,39 @@ int config_channel_transport_get(struct config_channel_transport *transport,
 	return 0;
 }
 
+static bool window_accept(const struct config_channel_transport *transport,
+			  const uint8_t *buffer, size_t length)
+{
+	if (transport->in_flight >= CONFIG_DESKTOP_CONFIG_CHANNEL_SET_WINDOW) {
+		return false;
+	}
+
+	if (length < TRANSPORT_HEADER_SIZE) {
+		return false;
+	}
+
+	/* Only the set requests for the same option handled by the local
+	 * modules can be pipelined. Forwarded requests are handled one by one.
+	 */
+	return ((buffer[0] == CFG_CHAN_RECIPIENT_LOCAL) &&
+		(buffer[EVENT_ID_POS] == transport->window_event_id) &&
+		(buffer[CONFIG_STATUS_POS] == CONFIG_STATUS_SET));
+}
+
 int config_channel_transport_set(struct config_channel_transport *transport,
 				 const uint8_t *buffer, size_t length)
 {
 	__ASSERT_NO_MSG(transport->state != CONFIG_CHANNEL_TRANSPORT_DISABLED);
 
+	bool in_window = false;
+
 	if (transport->state == CONFIG_CHANNEL_TRANSPORT_WAIT_RSP) {
-		LOG_WRN("Transport %p busy", (void *)transport);
-		return -EBUSY;
+		if (!window_accept(transport, buffer, length)) {
+			LOG_WRN("Transport %p busy", (void *)transport);
+			return -EBUSY;
+		}
+
+		in_window = true;
 	}
 
 	if (transport->state == CONFIG_CHANNEL_TRANSPORT_RSP_READY) {
@@ -232,10 +259,19 @@ int config_channel_transport_set(struct config_channel_transport *transport,
 	BUILD_ASSERT(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT > 0, "");
 	k_work_reschedule(&transport->timeout, K_SECONDS(CONFIG_DESKTOP_CONFIG_CHANNEL_TIMEOUT));
 
+	if (in_window) {
+		/* Pending response is already stored. */
+		transport->in_flight++;
+		return 0;
+	}
+
 	/* Store the data to send it as pending response. */
 	fill_response_pending(transport->data);
 	transport->data_len = TRANSPORT_HEADER_SIZE;
 	transport->state = CONFIG_CHANNEL_TRANSPORT_WAIT_RSP;
+	transport->in_flight = 1;
+	transport->window_event_id = event->event_id;
+	transport->window_err = false;
 
 	return 0;
 }
@@ -269,12 +305,27 @@ bool config_channel_transport_rsp_receive(struct config_channel_transport *trans
 		event->dyndata.size = 0;
 	}
 
-	int pos = config_channel_report_fill(transport->data,
-				event->dyndata.size + TRANSPORT_HEADER_SIZE,
-				event);
+	if (transport->in_flight > 0) {
+		transport->in_flight--;
+	}
+
+	/* Store the last response or the first error response in the window. */
+	if (!transport->window_err &&
+	    ((event->status != CONFIG_STATUS_SUCCESS) || (transport->in_flight == 0))) {
+		int pos = config_channel_report_fill(transport->data,
+					event->dyndata.size + TRANSPORT_HEADER_SIZE,
+					event);
+
+		__ASSERT_NO_MSG(pos > 0);
+		ARG_UNUSED(pos);
 
-	__ASSERT_NO_MSG(pos > 0);
-	ARG_UNUSED(pos);
+		transport->window_err = (event->status != CONFIG_STATUS_SUCCESS);
+	}
+
+	if (transport->in_flight > 0) {
+		/* Wait for responses to the remaining requests in the window. */
+		return true;
+	}
 
 	transport->state = CONFIG_CHANNEL_TRANSPORT_RSP_READY;
 
@@ -294,6 +345,7 @@ void config_channel_transport_disconnect(struct config_channel_transport *transp
 	if (transport->state == CONFIG_CHANNEL_TRANSPORT_WAIT_RSP) {
 		drop_transactions(transport);
 	}
+	transport->in_flight = 0;
 	transport->state = CONFIG_CHANNEL_TRANSPORT_IDLE;
 
 	int err = k_work_cancel_delayable(&transport->timeout);
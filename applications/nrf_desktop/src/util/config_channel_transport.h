@@ -59,6 +59,13 @@ struct config_channel_transport {
 	uint8_t data[REPORT_SIZE_USER_CONFIG];
 
 	enum config_channel_transport_state state;
+
+	/* Set requests waiting for response. */
+	uint8_t in_flight;
+	/* Event ID of the set requests in the window. */
+	uint8_t window_event_id;
+	/* Error response for a request in the window is stored. */
+	bool window_err;
 };
 
 /** @brief Initialize the configuration channel transport instance.
@@ -84,6 +91,10 @@ int config_channel_transport_get(struct config_channel_transport *transport,
 /**
  * @brief Handle a set operation on the configuration channel.
  *
+ * Up to @kconfig{CONFIG_DESKTOP_CONFIG_CHANNEL_SET_WINDOW} set requests for the same local
+ * option can be in flight. The response is provided after all of the requests are handled.
+ * The first error response is returned if any of the requests fails.
+ *
  * @param transport Pointer to the configuration channel transport instance.
  * @param buffer    Pointer to the report buffer to be parsed to handle
  *                  the set request.
@@ -126,11 +126,41 @@ static bool exit_datamode(void)
 	return ret;
 }
 
+/* Pass data to the data mode handler. Returns the number of bytes consumed. */
+static int datamode_send(const uint8_t *data, int size_send, uint8_t flags)
+{
+	int size_sent;
+	int size_finish = 0;
+
+	LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_LIMIT), "RX");
+	k_mutex_lock(&mutex_mode, K_FOREVER);
+	if (datamode_handler) {
+		size_sent = datamode_handler(DATAMODE_SEND, data, size_send, flags);
+		if (size_sent > 0) {
+			size_finish += size_sent;
+		} else if (size_sent == 0) {
+			size_finish += size_send;
+		} else {
+			LOG_WRN("Raw send failed, %d dropped", size_send);
+			size_finish += size_send;
+		}
+	} else {
+		LOG_WRN("no handler, %d dropped", size_send);
+		size_finish += size_send;
+	}
+	k_mutex_unlock(&mutex_mode);
+
+#if defined(CONFIG_SLM_DATAMODE_URC)
+	rsp_send("\r\n#XDATAMODE: %d\r\n", size_finish);
+#endif
+	return size_finish;
+}
+
 /* Lock mutex_data, before calling. */
 static void raw_send(uint8_t flags)
 {
 	uint8_t *data = NULL;
-	int size_send, size_sent, size_all, size_finish;
+	int size_send, size_all, size_finish;
 
 	/* NOTE ring_buf_get_claim() might not return full size */
 	do {
@@ -141,32 +171,9 @@ static void raw_send(uint8_t flags)
 		}
 		LOG_INF("Raw send: size_send: %d, data %p", size_send, (void *)data);
 		if (data != NULL && size_send > 0) {
-
 			/* Raw data sending */
-			size_finish = 0;
-
-			LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_LIMIT), "RX");
-			k_mutex_lock(&mutex_mode, K_FOREVER);
-			if (datamode_handler && size_send > 0) {
-				size_sent = datamode_handler(DATAMODE_SEND, data, size_send, flags);
-				if (size_sent > 0) {
-					size_finish += size_sent;
-				} else if (size_sent == 0) {
-					size_finish += size_send;
-				} else {
-					LOG_WRN("Raw send failed, %d dropped", size_send);
-					size_finish += size_send;
-				}
-				(void)ring_buf_get_finish(&data_rb, size_finish);
-			} else {
-				LOG_WRN("no handler, %d dropped", size_send);
-				(void)ring_buf_get_finish(&data_rb, size_send + size_finish);
-			}
-			k_mutex_unlock(&mutex_mode);
-
-#if defined(CONFIG_SLM_DATAMODE_URC)
-			rsp_send("\r\n#XDATAMODE: %d\r\n", size_finish);
-#endif
+			size_finish = datamode_send(data, size_send, flags);
+			(void)ring_buf_get_finish(&data_rb, size_finish);
 		} else {
 			break;
 		}
@@ -180,6 +187,16 @@ static void write_data_buf(const uint8_t *buf, size_t len)
 	size_t index = 0;
 
 	while (index < len) {
+		/* Send full buffers directly from the caller's buffer, while there is
+		 * no earlier data waiting in the ring buffer. Same as filling the ring
+		 * buffer and sending it when the next byte does not fit, minus the copy.
+		 */
+		if (ring_buf_is_empty(&data_rb) && len - index > CONFIG_SLM_DATAMODE_BUF_SIZE) {
+			index += datamode_send(buf + index, CONFIG_SLM_DATAMODE_BUF_SIZE,
+					       SLM_DATAMODE_FLAGS_MORE_DATA);
+			continue;
+		}
+
 		ret = ring_buf_put(&data_rb, buf + index, len - index);
 		if (ret) {
 			index += ret;
@@ -17,8 +17,11 @@ find_package(Python3 REQUIRED)
 #                 to image formats used.
 #   OUTPUT        location of the created package
 #
+# Optional arguments:
+#   SHA256        include the SHA-256 digest of each image in the package header
+#
 function(dfu_multi_image_package TARGET_NAME)
-    cmake_parse_arguments(ARG "" "OUTPUT" "IMAGE_IDS;IMAGE_PATHS;DEPENDS" ${ARGN})
+    cmake_parse_arguments(ARG "SHA256" "OUTPUT" "IMAGE_IDS;IMAGE_PATHS;DEPENDS" ${ARGN})
 
     if (NOT DEFINED ARG_IMAGE_IDS OR NOT ARG_IMAGE_PATHS OR NOT ARG_OUTPUT)
         message(FATAL_ERROR "All IMAGE_IDS, IMAGE_PATHS and OUTPUT arguments must be specified")
@@ -27,6 +30,10 @@ function(dfu_multi_image_package TARGET_NAME)
     # Prepare dfu_multi_image_tool.py argument list
     set(SCRIPT_ARGS "create")
 
+    if (ARG_SHA256)
+        list(APPEND SCRIPT_ARGS "--sha256")
+    endif()
+
     foreach(image IN ZIP_LISTS ARG_IMAGE_IDS ARG_IMAGE_PATHS)
         list(APPEND SCRIPT_ARGS "--image" "${image_0}" "${image_1}")
     endforeach()
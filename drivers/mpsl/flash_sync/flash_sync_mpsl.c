@@ -8,6 +8,7 @@
 
 #include <mpsl.h>
 #include <mpsl_timeslot.h>
+#include <mpsl/mpsl_timeslot_stats.h>
 #include <hal/nrf_timer.h>
 
 #include "multithreading_lock.h"
@@ -48,6 +49,7 @@ struct mpsl_context {
 };
 
 static struct mpsl_context _context;
+static struct mpsl_timeslot_stats_user timeslot_stats;
 
 /**
  * Get time in microseconds since the beginning of the timeslot.
@@ -74,6 +76,7 @@ static void reschedule_next_timeslot(void)
 	int32_t ret = mpsl_timeslot_request(_context.session_id,
 					    &_context.timeslot_request);
 
+	mpsl_timeslot_stats_requested(&timeslot_stats);
 	__ASSERT_EVAL((void)ret, (void)ret, ret == 0,
 		      "mpsl_timeslot_request failed: %d", ret);
 }
@@ -90,6 +93,7 @@ timeslot_callback(mpsl_timeslot_session_id_t session_id, uint32_t signal)
 
 	switch (signal) {
 	case MPSL_TIMESLOT_SIGNAL_START:
+		mpsl_timeslot_stats_start(&timeslot_stats);
 		rc = _context.op_desc->handler(_context.op_desc->context);
 		if (rc != FLASH_OP_ONGOING) {
 			_context.status = (rc == FLASH_OP_DONE) ? 0 : rc;
@@ -107,8 +111,11 @@ timeslot_callback(mpsl_timeslot_session_id_t session_id, uint32_t signal)
 				MPSL_TIMESLOT_SIGNAL_ACTION_REQUEST;
 			_context.return_param.params.request.p_next =
 				&_context.timeslot_request;
+			mpsl_timeslot_stats_requested(&timeslot_stats);
 		}
 
+		mpsl_timeslot_stats_end(&timeslot_stats, _context.request_length_us +
+					TIMESLOT_LENGTH_SLACK_US);
 		break;
 
 	case MPSL_TIMESLOT_SIGNAL_SESSION_IDLE:
@@ -120,7 +127,13 @@ timeslot_callback(mpsl_timeslot_session_id_t session_id, uint32_t signal)
 		return NULL;
 
 	case MPSL_TIMESLOT_SIGNAL_CANCELLED:
+		mpsl_timeslot_stats_cancelled(&timeslot_stats);
+		/* Retry the failed request. */
+		reschedule_next_timeslot();
+		return NULL;
+
 	case MPSL_TIMESLOT_SIGNAL_BLOCKED:
+		mpsl_timeslot_stats_blocked(&timeslot_stats);
 		/* Retry the failed request. */
 		reschedule_next_timeslot();
 		return NULL;
@@ -136,6 +149,7 @@ timeslot_callback(mpsl_timeslot_session_id_t session_id, uint32_t signal)
 int nrf_flash_sync_init(void)
 {
 	LOG_DBG("");
+	mpsl_timeslot_stats_register(&timeslot_stats, "flash_sync");
 	return k_sem_init(&_context.timeout_sem, 0, 1);
 }
 
@@ -198,6 +212,7 @@ int nrf_flash_sync_exe(struct flash_op_desc *op_desc)
 	errcode = MULTITHREADING_LOCK_ACQUIRE();
 	__ASSERT_NO_MSG(errcode == 0);
 	ret = mpsl_timeslot_request(_context.session_id, req);
+	mpsl_timeslot_stats_requested(&timeslot_stats);
 	__ASSERT_EVAL((void)ret, (void)ret, ret == 0,
 		      "mpsl_timeslot_request failed: %d", ret);
 	MULTITHREADING_LOCK_RELEASE();
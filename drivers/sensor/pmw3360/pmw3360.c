@@ -189,6 +189,18 @@ static int spi_cs_ctrl(const struct device *dev, bool enable)
 	return err;
 }
 
+static void locked_bus_get(const struct device *dev, struct spi_dt_spec *bus)
+{
+	const struct pmw3360_config *config = dev->config;
+
+	/* Keep the SPI bus locked between the transactions of a burst. The SPI
+	 * driver then skips the lock and reconfiguration on every transaction
+	 * and no other device can access the bus while chip select is asserted.
+	 */
+	*bus = config->bus;
+	bus->config.operation |= SPI_LOCK_ON;
+}
+
 static int reg_read(const struct device *dev, uint8_t reg, uint8_t *buf)
 {
 	int err;
@@ -299,7 +311,7 @@ static int motion_burst_read(const struct device *dev, uint8_t *buf,
 {
 	int err;
 	struct pmw3360_data *data = dev->data;
-	const struct pmw3360_config *config = dev->config;
+	struct spi_dt_spec bus;
 
 	__ASSERT_NO_MSG(burst_size <= PMW3360_MAX_BURST_SIZE);
 
@@ -313,6 +325,8 @@ static int motion_burst_read(const struct device *dev, uint8_t *buf,
 		}
 	}
 
+	locked_bus_get(dev, &bus);
+
 	err = spi_cs_ctrl(dev, true);
 	if (err) {
 		return err;
@@ -331,10 +345,10 @@ static int motion_burst_read(const struct device *dev, uint8_t *buf,
 		.count = 1
 	};
 
-	err = spi_write_dt(&config->bus, &tx);
+	err = spi_write_dt(&bus, &tx);
 	if (err) {
 		LOG_ERR("Motion burst failed on SPI write");
-		return err;
+		goto error;
 	}
 
 	k_busy_wait(T_SRAD_MOTBR);
@@ -348,12 +362,14 @@ static int motion_burst_read(const struct device *dev, uint8_t *buf,
 		.count = 1
 	};
 
-	err = spi_read_dt(&config->bus, &rx);
+	err = spi_read_dt(&bus, &rx);
 	if (err) {
 		LOG_ERR("Motion burst failed on SPI read");
-		return err;
+		goto error;
 	}
 
+	spi_release_dt(&bus);
+
 	/* Terminate burst */
 	err = spi_cs_ctrl(dev, false);
 	if (err) {
@@ -365,6 +381,11 @@ static int motion_burst_read(const struct device *dev, uint8_t *buf,
 	data->last_read_burst = true;
 
 	return 0;
+
+error:
+	spi_release_dt(&bus);
+
+	return err;
 }
 
 static int burst_write(const struct device *dev, uint8_t reg, const uint8_t *buf,
@@ -372,7 +393,7 @@ static int burst_write(const struct device *dev, uint8_t reg, const uint8_t *buf
 {
 	int err;
 	struct pmw3360_data *data = dev->data;
-	const struct pmw3360_config *config = dev->config;
+	struct spi_dt_spec bus;
 
 	/* Write address of burst register */
 	uint8_t write_buf = reg | SPI_WRITE_BIT;
@@ -385,30 +406,34 @@ static int burst_write(const struct device *dev, uint8_t reg, const uint8_t *buf
 		.count = 1
 	};
 
+	locked_bus_get(dev, &bus);
+
 	err = spi_cs_ctrl(dev, true);
 	if (err) {
 		return err;
 	}
 
-	err = spi_write_dt(&config->bus, &tx);
+	err = spi_write_dt(&bus, &tx);
 	if (err) {
 		LOG_ERR("Burst write failed on SPI write");
-		return err;
+		goto error;
 	}
 
 	/* Write data */
 	for (size_t i = 0; i < size; i++) {
 		write_buf = buf[i];
 
-		err = spi_write_dt(&config->bus, &tx);
+		err = spi_write_dt(&bus, &tx);
 		if (err) {
 			LOG_ERR("Burst write failed on SPI write (data)");
-			return err;
+			goto error;
 		}
 
 		k_busy_wait(T_BRSEP);
 	}
 
+	spi_release_dt(&bus);
+
 	/* Terminate burst mode. */
 	err = spi_cs_ctrl(dev, false);
 	if (err) {
@@ -420,6 +445,11 @@ static int burst_write(const struct device *dev, uint8_t reg, const uint8_t *buf
 	data->last_read_burst = false;
 
 	return 0;
+
+error:
+	spi_release_dt(&bus);
+
+	return err;
 }
 
 static int update_cpi(const struct device *dev, uint32_t cpi)
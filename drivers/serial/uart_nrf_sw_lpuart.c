@@ -102,6 +102,12 @@ struct lpuart_data {
 
 	struct onoff_client rx_clk_cli;
 
+	/* Set to true while HFXO is requested for RX. */
+	bool rx_clk_held;
+
+	/* Timer used for releasing HFXO after RX. */
+	struct k_timer rx_clk_timer;
+
 #if CONFIG_NRF_SW_LPUART_INT_DRIVEN
 	struct lpuart_int_driven int_driven;
 #endif
@@ -342,6 +348,31 @@ static bool rdy_pin_blink(struct lpuart_data *data)
 	return ret;
 }
 
+static void rx_hfclk_release(struct lpuart_data *data)
+{
+	struct onoff_manager *mgr =
+	     z_nrf_clock_control_get_onoff(CLOCK_CONTROL_NRF_SUBSYS_HF);
+	int err;
+
+	data->rx_clk_held = false;
+	err = onoff_cancel_or_release(mgr, &data->rx_clk_cli);
+	__ASSERT_NO_MSG(err >= 0);
+}
+
+/* Releases HFXO held after RX unless a new packet is being received. */
+static void rx_clk_timeout(struct k_timer *timer)
+{
+	struct lpuart_data *data = CONTAINER_OF(timer, struct lpuart_data, rx_clk_timer);
+	int key = irq_lock();
+
+	if (data->rx_clk_held &&
+	    data->rx_state != RX_PREPARE && data->rx_state != RX_ACTIVE) {
+		rx_hfclk_release(data);
+	}
+
+	irq_unlock(key);
+}
+
 /* Called when end of transfer is detected. It sets response pin to idle and
  * disables RX.
  */
@@ -350,11 +381,13 @@ static void deactivate_rx(struct lpuart_data *data)
 	int err;
 
 	if (IS_ENABLED(CONFIG_NRF_SW_LPUART_HFXO_ON_RX)) {
-		struct onoff_manager *mgr =
-		     z_nrf_clock_control_get_onoff(CLOCK_CONTROL_NRF_SUBSYS_HF);
-
-		err = onoff_cancel_or_release(mgr, &data->rx_clk_cli);
-		__ASSERT_NO_MSG(err >= 0);
+		if (CONFIG_NRF_SW_LPUART_HFXO_HOLD_MS > 0) {
+			k_timer_start(&data->rx_clk_timer,
+				      K_MSEC(CONFIG_NRF_SW_LPUART_HFXO_HOLD_MS),
+				      K_NO_WAIT);
+		} else {
+			rx_hfclk_release(data);
+		}
 	}
 
 	/* abort rx */
@@ -423,7 +456,22 @@ static void start_rx_activation(struct lpuart_data *data)
 	data->rx_state = RX_PREPARE;
 
 	if (IS_ENABLED(CONFIG_NRF_SW_LPUART_HFXO_ON_RX)) {
-		rx_hfclk_request(data);
+		int key = irq_lock();
+		bool held = data->rx_clk_held;
+
+		/* HFXO still running after the previous packet. */
+		if (held) {
+			k_timer_stop(&data->rx_clk_timer);
+		} else {
+			data->rx_clk_held = true;
+		}
+		irq_unlock(key);
+
+		if (held) {
+			activate_rx(data);
+		} else {
+			rx_hfclk_request(data);
+		}
 	} else {
 		activate_rx(data);
 	}
@@ -1019,6 +1067,8 @@ static int lpuart_init(const struct device *dev)
 	k_timer_init(&data->tx_timer, tx_timeout, NULL);
 	k_timer_user_data_set(&data->tx_timer, (void *)dev);
 
+	k_timer_init(&data->rx_clk_timer, rx_clk_timeout, NULL);
+
 	err = uart_callback_set(data->uart, uart_callback, (void *)dev);
 	if (err < 0) {
 		return -EINVAL;
@@ -80,6 +80,21 @@ struct nrf_wifi_vif_ctx_zep {
 #endif /* CONFIG_NRF700X_DATA_TX */
 	unsigned long rssi_record_timestamp_us;
 	signed short rssi;
+#ifdef CONFIG_NRF700X_TWT_AUTO
+	struct nrf_wifi_twt_auto {
+		struct k_work work;
+		int64_t last_tx_ms;
+		int64_t burst_start_ms;
+		unsigned int period_ms;
+		unsigned int target_ms;
+		unsigned int flow_interval_ms;
+		unsigned char stable_cnt;
+		unsigned char unstable_cnt;
+		int64_t stats_start_ms;
+		int64_t awake_start_ms;
+		uint64_t awake_ms;
+	} twt_auto;
+#endif /* CONFIG_NRF700X_TWT_AUTO */
 #endif /* CONFIG_NRF700X_STA_MODE */
 };
 
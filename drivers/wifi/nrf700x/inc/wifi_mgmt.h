@@ -55,6 +55,14 @@ void nrf_wifi_event_proc_get_power_save_info(void *vif_ctx,
 		struct nrf_wifi_umac_event_power_save_info *ps_info,
 		unsigned int event_len);
 
+#ifdef CONFIG_NRF700X_TWT_AUTO
+void nrf_wifi_twt_auto_init(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep);
+
+void nrf_wifi_twt_auto_reset(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep);
+
+void nrf_wifi_twt_auto_tx(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep);
+#endif /* CONFIG_NRF700X_TWT_AUTO */
+
 #ifdef CONFIG_NRF700X_SYSTEM_MODE
 int nrf_wifi_mode(const struct device *dev,
 		  struct wifi_mode_info *mode);
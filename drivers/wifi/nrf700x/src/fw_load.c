@@ -85,6 +85,12 @@ INCBIN(_bin, nrf70_fw, STR(CONFIG_NRF_WIFI_FW_BIN));
 #define NRF70_FW_PATCH_ID FIXED_PARTITION_ID(nrf70_fw_partition)
 #endif
 static const struct flash_area *fa;
+#ifdef CONFIG_NRF_WIFI_FW_PATCH_INTEGRITY_CHECK
+/* The patch partition only changes through a DFU, which is applied on reboot,
+ * so the patch is verified once per boot and not on every interface bring-up.
+ */
+static bool fw_patch_verified;
+#endif /* CONFIG_NRF_WIFI_FW_PATCH_INTEGRITY_CHECK */
 
 static int nrf_wifi_read_and_download_chunk(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					    const struct flash_area *fa,
@@ -180,6 +186,10 @@ enum nrf_wifi_status nrf_wifi_fw_load(void *rpu_ctx)
 	}
 
 #ifdef CONFIG_NRF_WIFI_FW_PATCH_INTEGRITY_CHECK
+	if (fw_patch_verified) {
+		goto fw_patch_checked;
+	}
+
 	fw_patch_check_buf = k_malloc(max_chunk_size);
 	if (!fw_patch_check_buf) {
 		LOG_ERR("Failed to allocate memory for patch data size: %d", patch_hdr.len);
@@ -199,6 +209,9 @@ enum nrf_wifi_status nrf_wifi_fw_load(void *rpu_ctx)
 		goto out;
 	}
 	k_free(fw_patch_check_buf);
+	fw_patch_verified = true;
+
+fw_patch_checked:
 #endif /* NRF_WIFI_FW_PATCH_INTEGRITY_CHECK */
 
 	status = nrf_wifi_fmac_fw_reset(rpu_ctx);
@@ -23,6 +23,9 @@ LOG_MODULE_DECLARE(wifi_nrf, CONFIG_WIFI_NRF700X_LOG_LEVEL);
 #include "fmac_main.h"
 #include "wpa_supp_if.h"
 #include "net_if.h"
+#ifdef CONFIG_NRF700X_TWT_AUTO
+#include "wifi_mgmt.h"
+#endif /* CONFIG_NRF700X_TWT_AUTO */
 
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
@@ -165,6 +168,12 @@ enum nrf_wifi_status nrf_wifi_if_carr_state_chg(void *os_vif_ctx,
 
 	vif_ctx_zep->if_carr_state = carr_state;
 
+#ifdef CONFIG_NRF700X_TWT_AUTO
+	if (carr_state == NRF_WIFI_FMAC_IF_CARR_STATE_OFF) {
+		nrf_wifi_twt_auto_reset(vif_ctx_zep);
+	}
+#endif /* CONFIG_NRF700X_TWT_AUTO */
+
 	LOG_DBG("%s: Carrier state: %d", __func__, carr_state);
 
 	k_work_submit(&vif_ctx_zep->nrf_wifi_net_iface_work);
@@ -253,6 +262,12 @@ int nrf_wifi_if_send(const struct device *dev,
 			goto unlock;
 		}
 
+#ifdef CONFIG_NRF700X_TWT_AUTO
+		if (vif_ctx_zep->authorized) {
+			nrf_wifi_twt_auto_tx(vif_ctx_zep);
+		}
+#endif /* CONFIG_NRF700X_TWT_AUTO */
+
 		ret = nrf_wifi_fmac_start_xmit(rpu_ctx_zep->rpu_ctx,
 					       vif_ctx_zep->vif_idx,
 					       net_pkt_to_nbuf(pkt));
@@ -509,6 +524,9 @@ void nrf_wifi_if_init_zep(struct net_if *iface)
 	k_work_init(&vif_ctx_zep->nrf_wifi_net_iface_work,
 		    nrf_wifi_net_iface_work_handler);
 #endif /* CONFIG_NRF700X_DATA_TX */
+#ifdef CONFIG_NRF700X_TWT_AUTO
+	nrf_wifi_twt_auto_init(vif_ctx_zep);
+#endif /* CONFIG_NRF700X_TWT_AUTO */
 
 #if !defined(CONFIG_NRF_WIFI_IF_AUTO_START)
 	net_if_flag_set(iface, NET_IF_NO_AUTO_START);
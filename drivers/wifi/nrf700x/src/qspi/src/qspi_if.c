@@ -1183,22 +1183,25 @@ int qspi_read(unsigned int addr, void *data, int len)
 	return status;
 }
 
+/* Highest number of dummy words the RPU inserts before read data, see rpu_7002_memmap. */
+#define QSPI_SLAVE_LATENCY_MAX 2
+
 int qspi_hl_readw(unsigned int addr, void *data)
 {
 	int status;
-	uint8_t *rxb = NULL;
+	/* Register reads are frequent, so use a word aligned stack buffer
+	 * instead of a heap allocation per read.
+	 */
+	uint32_t rxb[1 + QSPI_SLAVE_LATENCY_MAX] = {0};
 	uint32_t len = 4;
 
-	len = len + (4 * qspi_config->qspi_slave_latency);
-
-	rxb = k_malloc(len);
-
-	if (rxb == NULL) {
-		LOG_ERR("%s: ERROR ENOMEM line %d", __func__, __LINE__);
-		return -ENOMEM;
+	if (qspi_config->qspi_slave_latency > QSPI_SLAVE_LATENCY_MAX) {
+		LOG_ERR("%s: Unsupported slave latency %d", __func__,
+			qspi_config->qspi_slave_latency);
+		return -EINVAL;
 	}
 
-	memset(rxb, 0, len);
+	len = len + (4 * qspi_config->qspi_slave_latency);
 
 	k_sem_take(&qspi_config->lock, K_FOREVER);
 
@@ -1208,9 +1211,7 @@ int qspi_hl_readw(unsigned int addr, void *data)
 
 	k_sem_give(&qspi_config->lock);
 
-	*(uint32_t *)data = *(uint32_t *)(rxb + (len - 4));
-
-	k_free(rxb);
+	*(uint32_t *)data = rxb[qspi_config->qspi_slave_latency];
 
 	return status;
 }
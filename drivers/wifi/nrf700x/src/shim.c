@@ -215,18 +215,17 @@ static void *zep_shim_nbuf_alloc(unsigned int size)
 {
 	struct nwb *nwb;
 
-	nwb = (struct nwb *)k_calloc(sizeof(struct nwb), sizeof(char));
+	/* Descriptor and data share one allocation. Only the descriptor is
+	 * cleared, the data area is always filled before it is read.
+	 */
+	nwb = (struct nwb *)k_malloc(sizeof(struct nwb) + size);
 
 	if (!nwb)
 		return NULL;
 
-	nwb->priv = k_calloc(size, sizeof(char));
-
-	if (!nwb->priv) {
-		k_free(nwb);
-		return NULL;
-	}
+	memset(nwb, 0, sizeof(struct nwb));
 
+	nwb->priv = nwb + 1;
 	nwb->data = (unsigned char *)nwb->priv;
 	nwb->tail = nwb->data;
 	nwb->len = 0;
@@ -242,9 +241,7 @@ static void zep_shim_nbuf_free(void *nbuf)
 
 	nwb = nbuf;
 
-	k_free(((struct nwb *)nbuf)->priv);
-
-	k_free(nbuf);
+	k_free(nwb);
 }
 
 static void zep_shim_nbuf_headroom_res(void *nbuf, unsigned int size)
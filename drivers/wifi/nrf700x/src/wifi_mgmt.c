@@ -415,6 +415,26 @@ static void nrf_wifi_twt_update_internal_state(struct nrf_wifi_vif_ctx_zep *vif_
 	}
 }
 
+#ifdef CONFIG_NRF700X_TWT_AUTO
+#define TWT_AUTO_FLOW_ID (WIFI_MAX_TWT_FLOWS - 1)
+
+static void twt_auto_awake_update(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep, bool awake)
+{
+	struct nrf_wifi_twt_auto *twt_auto = &vif_ctx_zep->twt_auto;
+	int64_t now = k_uptime_get();
+
+	if (!twt_auto->flow_interval_ms) {
+		return;
+	}
+
+	if (twt_auto->awake_start_ms) {
+		twt_auto->awake_ms += now - twt_auto->awake_start_ms;
+	}
+
+	twt_auto->awake_start_ms = awake ? now : 0;
+}
+#endif /* CONFIG_NRF700X_TWT_AUTO */
+
 int nrf_wifi_twt_teardown_flows(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep,
 		unsigned char start_flow_id, unsigned char end_flow_id)
 {
@@ -701,6 +721,9 @@ void nrf_wifi_event_proc_twt_sleep_zep(void *vif_ctx,
 					    def_dev_ctx->tx_config.tx_lock);
 
 		def_dev_ctx->twt_sleep_status = NRF_WIFI_FMAC_TWT_STATE_SLEEP;
+#ifdef CONFIG_NRF700X_TWT_AUTO
+		twt_auto_awake_update(vif_ctx_zep, false);
+#endif /* CONFIG_NRF700X_TWT_AUTO */
 
 		wifi_mgmt_raise_twt_sleep_state(vif_ctx_zep->zep_net_if_ctx,
 						WIFI_TWT_STATE_SLEEP);
@@ -711,6 +734,9 @@ void nrf_wifi_event_proc_twt_sleep_zep(void *vif_ctx,
 		nrf_wifi_osal_spinlock_take(fmac_dev_ctx->fpriv->opriv,
 					    def_dev_ctx->tx_config.tx_lock);
 		def_dev_ctx->twt_sleep_status = NRF_WIFI_FMAC_TWT_STATE_AWAKE;
+#ifdef CONFIG_NRF700X_TWT_AUTO
+		twt_auto_awake_update(vif_ctx_zep, true);
+#endif /* CONFIG_NRF700X_TWT_AUTO */
 		wifi_mgmt_raise_twt_sleep_state(vif_ctx_zep->zep_net_if_ctx,
 						WIFI_TWT_STATE_AWAKE);
 #ifdef CONFIG_NRF700X_DATA_TX
@@ -732,6 +758,165 @@ out:
 	k_mutex_unlock(&vif_ctx_zep->vif_lock);
 }
 
+#ifdef CONFIG_NRF700X_TWT_AUTO
+static bool twt_auto_interval_matches(unsigned int ref_ms, unsigned int interval_ms)
+{
+	unsigned int tolerance = ref_ms * CONFIG_NRF700X_TWT_AUTO_TOLERANCE_PERCENT / 100;
+
+	return (interval_ms + tolerance >= ref_ms) && (interval_ms <= ref_ms + tolerance);
+}
+
+static void twt_auto_report(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep)
+{
+	struct nrf_wifi_twt_auto *twt_auto = &vif_ctx_zep->twt_auto;
+	int64_t now = k_uptime_get();
+	uint64_t awake_ms = twt_auto->awake_ms;
+	int64_t total_ms = now - twt_auto->stats_start_ms;
+
+	if (twt_auto->awake_start_ms) {
+		awake_ms += now - twt_auto->awake_start_ms;
+	}
+
+	if (total_ms <= 0) {
+		return;
+	}
+
+	LOG_INF("TWT auto: interval %u ms, awake %llu ms of %lld ms (%u%%)",
+		twt_auto->flow_interval_ms, awake_ms, total_ms,
+		(unsigned int)(awake_ms * 100 / total_ms));
+}
+
+static void twt_auto_work_handler(struct k_work *work)
+{
+	struct nrf_wifi_vif_ctx_zep *vif_ctx_zep =
+		CONTAINER_OF(work, struct nrf_wifi_vif_ctx_zep, twt_auto.work);
+	struct nrf_wifi_twt_auto *twt_auto = &vif_ctx_zep->twt_auto;
+	struct wifi_twt_params twt_params = {0};
+	unsigned int target_ms;
+
+	k_mutex_lock(&vif_ctx_zep->vif_lock, K_FOREVER);
+
+	target_ms = twt_auto->target_ms;
+
+	if (vif_ctx_zep->twt_flows_map & BIT(TWT_AUTO_FLOW_ID)) {
+		twt_auto_report(vif_ctx_zep);
+		nrf_wifi_twt_teardown_flows(vif_ctx_zep, TWT_AUTO_FLOW_ID, TWT_AUTO_FLOW_ID + 1);
+	}
+
+	twt_auto->flow_interval_ms = 0;
+
+	if (!target_ms) {
+		goto out;
+	}
+
+	twt_params.operation = WIFI_TWT_SETUP;
+	twt_params.negotiation_type = WIFI_TWT_INDIVIDUAL;
+	twt_params.setup_cmd = WIFI_TWT_SETUP_CMD_REQUEST;
+	twt_params.dialog_token = 1;
+	twt_params.flow_id = TWT_AUTO_FLOW_ID;
+	twt_params.setup.implicit = 1;
+	twt_params.setup.twt_wake_interval = CONFIG_NRF700X_TWT_AUTO_WAKE_DURATION_US;
+	twt_params.setup.twt_interval = target_ms * USEC_PER_MSEC;
+
+	if (nrf_wifi_set_twt(vif_ctx_zep->zep_dev_ctx, &twt_params)) {
+		LOG_DBG("%s: TWT setup request failed", __func__);
+		goto out;
+	}
+
+	LOG_DBG("%s: Requested TWT interval %u ms", __func__, target_ms);
+
+	twt_auto->flow_interval_ms = target_ms;
+	twt_auto->stats_start_ms = k_uptime_get();
+	twt_auto->awake_start_ms = twt_auto->stats_start_ms;
+	twt_auto->awake_ms = 0;
+out:
+	k_mutex_unlock(&vif_ctx_zep->vif_lock);
+}
+
+void nrf_wifi_twt_auto_init(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep)
+{
+	k_work_init(&vif_ctx_zep->twt_auto.work, twt_auto_work_handler);
+	nrf_wifi_twt_auto_reset(vif_ctx_zep);
+}
+
+void nrf_wifi_twt_auto_reset(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep)
+{
+	struct nrf_wifi_twt_auto *twt_auto = &vif_ctx_zep->twt_auto;
+
+	twt_auto->last_tx_ms = 0;
+	twt_auto->burst_start_ms = 0;
+	twt_auto->period_ms = 0;
+	twt_auto->target_ms = 0;
+	twt_auto->flow_interval_ms = 0;
+	twt_auto->stable_cnt = 0;
+	twt_auto->unstable_cnt = 0;
+	twt_auto->awake_start_ms = 0;
+	twt_auto->awake_ms = 0;
+}
+
+/* Called with vif_lock held for every data frame handed to the FMAC. */
+void nrf_wifi_twt_auto_tx(struct nrf_wifi_vif_ctx_zep *vif_ctx_zep)
+{
+	struct nrf_wifi_twt_auto *twt_auto = &vif_ctx_zep->twt_auto;
+	int64_t now = k_uptime_get();
+	int64_t gap_ms = now - twt_auto->last_tx_ms;
+	unsigned int interval_ms;
+
+	twt_auto->last_tx_ms = now;
+
+	if (twt_auto->burst_start_ms && gap_ms < CONFIG_NRF700X_TWT_AUTO_BURST_GAP_MS) {
+		return;
+	}
+
+	if (!twt_auto->burst_start_ms) {
+		twt_auto->burst_start_ms = now;
+		return;
+	}
+
+	interval_ms = MIN(now - twt_auto->burst_start_ms, UINT32_MAX);
+	twt_auto->burst_start_ms = now;
+
+	if (twt_auto_interval_matches(twt_auto->period_ms, interval_ms)) {
+		twt_auto->period_ms = (3 * twt_auto->period_ms + interval_ms) / 4;
+		if (twt_auto->stable_cnt < UINT8_MAX) {
+			twt_auto->stable_cnt++;
+		}
+		twt_auto->unstable_cnt = 0;
+	} else {
+		twt_auto->period_ms = interval_ms;
+		twt_auto->stable_cnt = 0;
+		if (twt_auto->unstable_cnt < UINT8_MAX) {
+			twt_auto->unstable_cnt++;
+		}
+	}
+
+	if (twt_auto->stable_cnt >= CONFIG_NRF700X_TWT_AUTO_STABLE_COUNT) {
+		if (twt_auto->period_ms < CONFIG_NRF700X_TWT_AUTO_MIN_INTERVAL_MS) {
+			return;
+		}
+
+		if (twt_auto->flow_interval_ms &&
+		    twt_auto_interval_matches(twt_auto->flow_interval_ms, twt_auto->period_ms)) {
+			return;
+		}
+
+		twt_auto->target_ms = twt_auto->period_ms;
+	} else if (twt_auto->flow_interval_ms &&
+		   twt_auto->unstable_cnt >= CONFIG_NRF700X_TWT_AUTO_STABLE_COUNT) {
+		/* Traffic no longer periodic, fall back to regular power save */
+		twt_auto->target_ms = 0;
+	} else {
+		return;
+	}
+
+	/* Require a fresh run of matching intervals before the next request */
+	twt_auto->stable_cnt = 0;
+	twt_auto->unstable_cnt = 0;
+
+	k_work_submit(&twt_auto->work);
+}
+#endif /* CONFIG_NRF700X_TWT_AUTO */
+
 #ifdef CONFIG_NRF700X_SYSTEM_MODE
 int nrf_wifi_mode(const struct device *dev,
 		  struct wifi_mode_info *mode)
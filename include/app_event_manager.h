@@ -55,6 +55,10 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** puts events in the high priority queue.
+	 *  Flag set by user. Used only if CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES is enabled.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -84,6 +88,9 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 #define APP_EVENT_ID(ename) _EVENT_ID(ename)
 
 /** @brief Create an event listener object.
+ *
+ * The event handler function can be NULL if the listener subscribes to events only
+ * using typed event handlers, for example with @ref APP_EVENT_SUBSCRIBE_HANDLER.
  *
  * @param lname   Module name.
  * @param cb_fn  Pointer to the event handler function.
@@ -133,6 +140,65 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	const struct {} _CONCAT(_CONCAT(__event_subscriber_, ename), final_sub_redefined) = {}
 
 
+/** @brief Subscribe a typed event handler to an event type as first module that is
+ *  being notified.
+ *
+ * The handler is called directly, without notifying the event handler function
+ * of the listener. The handler must have the form
+ * `bool handler(const struct ename *event)` and its return value has the same
+ * meaning as for the event handler function of the listener.
+ *
+ * @param lname    Name of the listener.
+ * @param ename    Name of the event.
+ * @param handler  Typed event handler.
+ */
+#define APP_EVENT_SUBSCRIBE_HANDLER_FIRST(lname, ename, handler)				\
+	_APP_EVENT_SUBSCRIBE_HANDLER(lname, ename, _APP_EM_MARKER_FIRST_ELEMENT, handler);	\
+	const struct {} _CONCAT(_CONCAT(__event_subscriber_, ename), first_sub_redefined) = {}
+
+
+/** @brief Subscribe a typed event handler to the early notification list for an
+ *  event type.
+ *
+ * See @ref APP_EVENT_SUBSCRIBE_HANDLER_FIRST for the handler description.
+ *
+ * @param lname    Name of the listener.
+ * @param ename    Name of the event.
+ * @param handler  Typed event handler.
+ */
+#define APP_EVENT_SUBSCRIBE_HANDLER_EARLY(lname, ename, handler)		\
+	_APP_EVENT_SUBSCRIBE_HANDLER(lname, ename,				\
+				     _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_EARLY), handler)
+
+
+/** @brief Subscribe a typed event handler to the normal notification list for an
+ *  event type.
+ *
+ * See @ref APP_EVENT_SUBSCRIBE_HANDLER_FIRST for the handler description.
+ *
+ * @param lname    Name of the listener.
+ * @param ename    Name of the event.
+ * @param handler  Typed event handler.
+ */
+#define APP_EVENT_SUBSCRIBE_HANDLER(lname, ename, handler)			\
+	_APP_EVENT_SUBSCRIBE_HANDLER(lname, ename,				\
+				     _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL), handler)
+
+
+/** @brief Subscribe a typed event handler to an event type as final module that is
+ *  being notified.
+ *
+ * See @ref APP_EVENT_SUBSCRIBE_HANDLER_FIRST for the handler description.
+ *
+ * @param lname    Name of the listener.
+ * @param ename    Name of the event.
+ * @param handler  Typed event handler.
+ */
+#define APP_EVENT_SUBSCRIBE_HANDLER_FINAL(lname, ename, handler)				\
+	_APP_EVENT_SUBSCRIBE_HANDLER(lname, ename, _APP_EM_MARKER_FINAL_ELEMENT, handler);	\
+	const struct {} _CONCAT(_CONCAT(__event_subscriber_, ename), final_sub_redefined) = {}
+
+
 /** @brief Declare an event type.
  *
  * This macro provides declarations required for an event to be used
@@ -178,6 +244,23 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define a memory pool for an event type.
+ *
+ * Events of the given type are allocated from a statically allocated pool of fixed-size
+ * blocks instead of the heap. If the pool is exhausted, the event is allocated using
+ * @ref app_event_manager_alloc. The pool must be defined in the same source file as
+ * the event type. Event types with dynamic data cannot use a pool.
+ *
+ * @note
+ * If the @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option is disabled, the macro
+ * has no effect.
+ *
+ * @param ename  Name of the event.
+ * @param count  Number of events in the pool.
+ */
+#define APP_EVENT_TYPE_POOL_DEFINE(ename, count) _APP_EVENT_TYPE_POOL_DEFINE(ename, count)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -403,6 +486,102 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Event pool statistics. */
+struct app_event_pool_stats {
+	/** Number of events in the pool. */
+	uint32_t num_blocks;
+
+	/** Number of events currently allocated from the pool. */
+	uint32_t num_used;
+
+	/** Maximum number of events allocated from the pool at the same time. */
+	uint32_t max_used;
+
+	/** Number of events allocated from the heap because the pool was exhausted. */
+	uint32_t num_fallbacks;
+};
+
+/** @brief Get statistics of the event type pool.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure filled with the pool statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If the event type has no pool defined.
+ */
+int app_event_manager_pool_stats_get(const struct event_type *et,
+				     struct app_event_pool_stats *stats);
+
+/** @brief Reset the maximum usage and heap fallback counters of the event type pool.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param et  Pointer to the event type.
+ */
+void app_event_manager_pool_stats_reset(const struct event_type *et);
+
+/** @brief Latency statistics.
+ *
+ * Percentiles are estimated from a histogram with power-of-two buckets. The reported value is
+ * the upper bound of the bucket, limited by the maximum latency.
+ */
+struct app_event_latency_stats {
+	/** Number of samples. */
+	uint32_t count;
+
+	/** Median latency in microseconds. */
+	uint32_t p50_us;
+
+	/** 99th percentile of latency in microseconds. */
+	uint32_t p99_us;
+
+	/** Maximum latency in microseconds. */
+	uint32_t max_us;
+};
+
+/** @brief Get latency statistics of the event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LATENCY_STATS} option needs to be enabled.
+ *
+ * @param et          Pointer to the event type.
+ * @param dispatch    Pointer to the structure filled with statistics of the time between event
+ *                    submission and start of the event processing. Can be NULL.
+ * @param processing  Pointer to the structure filled with statistics of the time of the event
+ *                    processing by all listeners. Can be NULL.
+ */
+void app_event_manager_latency_get(const struct event_type *et,
+				   struct app_event_latency_stats *dispatch,
+				   struct app_event_latency_stats *processing);
+
+/** @brief Get statistics of the listener notification processing time.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LATENCY_STATS} option needs to be enabled.
+ *
+ * @param el     Pointer to the event listener.
+ * @param stats  Pointer to the structure filled with the statistics.
+ */
+void app_event_manager_listener_latency_get(const struct event_listener *el,
+					    struct app_event_latency_stats *stats);
+
+/** @brief Reset all latency statistics.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LATENCY_STATS} option needs to be enabled.
+ */
+void app_event_manager_latency_reset(void);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
@@ -208,6 +208,11 @@ struct audio_module_description {
 
 	/* A pointer to the functions in the module. */
 	const struct audio_module_functions *functions;
+
+	/* Flag to indicate that the module can process audio data in place, that is, with the
+	 * input and output audio data being the same.
+	 */
+	bool in_place;
 };
 
 /**
@@ -249,6 +254,37 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+#if CONFIG_AUDIO_MODULE_STATS
+/**
+ * @brief Module's timing statistics.
+ */
+struct audio_module_stats {
+	/* Number of audio data items processed. */
+	uint32_t frames;
+
+	/* Processing time of the last audio data item in microseconds. */
+	uint32_t process_us_last;
+
+	/* Maximum processing time of an audio data item in microseconds. */
+	uint32_t process_us_max;
+
+	/* Total processing time in microseconds. */
+	uint64_t process_us_total;
+
+	/* Time the last audio data item waited in the input queue in microseconds. */
+	uint32_t queue_wait_us_last;
+
+	/* Maximum time an audio data item waited in the input queue in microseconds. */
+	uint32_t queue_wait_us_max;
+
+	/* Total time waited in the input queue in microseconds. */
+	uint64_t queue_wait_us_total;
+
+	/* Number of audio data items whose queue wait and processing exceeded their duration. */
+	uint32_t deadline_misses;
+};
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 /**
  * @brief Private module handle.
  */
@@ -280,6 +316,12 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
+	/* Next module in an in-place processing chain, run in this module's thread. */
+	struct audio_module_handle *chain_next;
+
+	/* Previous module in an in-place processing chain. */
+	struct audio_module_handle *chain_prev;
+
 	/* Semaphore to count messages between modules and on a module's TX FIFO. */
 	struct k_sem sem;
 
@@ -291,6 +333,14 @@ struct audio_module_handle {
 
 	/* Private context for the module. */
 	struct audio_module_context *context;
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* Timing statistics of the module. */
+	struct audio_module_stats stats;
+
+	/* List node in the list of open modules with statistics. */
+	sys_snode_t stats_node;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 };
 
 /**
@@ -305,6 +355,11 @@ struct audio_module_message {
 
 	/* Callback for when the audio data has been consumed. */
 	audio_module_response_cb response_cb;
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* Cycle count when the message was queued. */
+	uint32_t queued_cyc;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 };
 
 /**
@@ -388,6 +443,35 @@ int audio_module_disconnect(struct audio_module_handle *handle,
 			    struct audio_module_handle *handle_disconnect,
 			    bool disconnect_external);
 
+/**
+ * @brief Connect an audio module so that it processes the output of another module in place.
+ *
+ * @note The audio data from handle_from is processed by handle_to in the thread of the first
+ *       module in the chain, directly in the data buffer of that module. Hence, there is no
+ *       message passing, thread switch or copy between the modules. The output of the last
+ *       module in the chain is sent to its connected modules as normal. The modules must not be
+ *       running, handle_to must support in-place processing and all modules in a chain must
+ *       use the same audio data buffer slab.
+ *
+ * @param handle_from  [in/out]  The handle for the module for output.
+ * @param handle_to    [in/out]  The handle of the module to process the output in place.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_connect_in_place(struct audio_module_handle *handle_from,
+				  struct audio_module_handle *handle_to);
+
+/**
+ * @brief Disconnect an audio module that processes the output of another module in place.
+ *
+ * @param handle             [in/out]  The handle for the module for output.
+ * @param handle_disconnect  [in/out]  The handle of the module to disconnect.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_disconnect_in_place(struct audio_module_handle *handle,
+				     struct audio_module_handle *handle_disconnect);
+
 /**
  * @brief Start processing audio data in the audio module given by handle.
  *
@@ -491,6 +575,27 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
  */
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels);
 
+#if CONFIG_AUDIO_MODULE_STATS
+/**
+ * @brief Get the timing statistics of an audio module.
+ *
+ * @param handle  [in]   The handle to the module instance.
+ * @param stats   [out]  Pointer to the copy of the module's statistics.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_stats_get(struct audio_module_handle *handle, struct audio_module_stats *stats);
+
+/**
+ * @brief Reset the timing statistics of an audio module.
+ *
+ * @param handle  [in/out]  The handle to the module instance.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_stats_reset(struct audio_module_handle *handle);
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 #ifdef __cplusplus
 }
 #endif
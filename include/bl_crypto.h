@@ -11,6 +11,7 @@
 extern "C" {
 #endif
 
+#include <sys/types.h>
 #include <zephyr/types.h>
 #include <fw_info.h>
 
@@ -170,6 +171,33 @@ typedef int (*bl_sha256_verify_t)(const uint8_t *data, uint32_t data_len,
 				const uint8_t *expected);
 
 
+struct device;
+
+/**
+ * @brief Calculate a digest over data in a flash device and verify it.
+ *
+ * The data is read in blocks of @kconfig{CONFIG_SB_CRYPTO_FLASH_SHA256_BUF_SIZE}
+ * bytes, so it does not need to be memory-mapped. Requires
+ * @kconfig{CONFIG_SB_CRYPTO_FLASH_SHA256}.
+ *
+ * @param[in]  fdev      The flash device to read from.
+ * @param[in]  offset    The offset of the data in @p fdev.
+ * @param[in]  len       The length of the data.
+ * @param[in]  expected  The expected digest over the data.
+ *
+ * @retval 0          If the procedure succeeded and the resulting digest is
+ *                    identical to @p expected.
+ * @retval -EHASHINV  If the procedure succeeded, but the digests don't match.
+ * @retval -EINVAL    If @p fdev or @p expected was NULL.
+ * @retval -ENODEV    If @p fdev is not ready.
+ * @return Any error code from flash_read(), @ref bl_sha256_init,
+ *         @ref bl_sha256_update, or @ref bl_sha256_finalize if something else
+ *         went wrong.
+ */
+int bl_sha256_flash_verify(const struct device *fdev, off_t offset, size_t len,
+			   const uint8_t *expected);
+
+
 /**
  * @brief Validate a secp256r1 signature.
  *
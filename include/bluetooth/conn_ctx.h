@@ -51,7 +51,7 @@ struct bt_conn_ctx {
 
 /** @brief Bluetooth connection context library structure. */
 struct bt_conn_ctx_lib {
-	/** Connection contexts. */
+	/** Connection contexts, indexed by bt_conn_index(). */
 	struct bt_conn_ctx ctx[CONFIG_BT_MAX_CONN];
 
 	/** Context data mutex that ensures that only one connection context is
@@ -113,6 +113,29 @@ void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn);
  */
 int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn);
 
+/**
+ * @brief Get the context data of a connection, allocating it on first use.
+ *
+ * This function returns the context data of the connection if it was
+ * already allocated. Otherwise, it allocates the memory and sets
+ * @p allocated, so that the caller initializes the context before use.
+ * It lets services set up a context lazily, in the first callback that
+ * needs it, instead of in every connected callback.
+ *
+ * This function should be used in conjunction with
+ * @ref bt_conn_ctx_release to ensure proper operation.
+ *
+ * @param ctx_lib	Bluetooth connection context library instance.
+ * @param conn		Bluetooth connection.
+ * @param allocated	Set to true if the context data was allocated by this
+ *			call, false otherwise.
+ *
+ * @return Pointer to the connection context data if the operation
+ *         was successful. Otherwise NULL.
+ */
+void *bt_conn_ctx_get_or_alloc(struct bt_conn_ctx_lib *ctx_lib,
+			       struct bt_conn *conn, bool *allocated);
+
 /**
  * @brief Free all allocated context data.
  *
@@ -124,7 +147,9 @@ void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib);
  * @brief Get the context data of a connection from the memory pool.
  *
  * This function finds a connection's context data in the memory pool.
- * The link to find is identified by the connection object.
+ * The link to find is identified by the connection object. The context is
+ * stored at the index of the connection, see bt_conn_index(), so the
+ * lookup takes constant time.
  *
  * This function should be used in conjunction with
  * @ref bt_conn_ctx_release to ensure proper operation.
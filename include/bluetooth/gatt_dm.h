@@ -317,6 +317,20 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context);
  */
 int bt_gatt_dm_data_release(struct bt_gatt_dm *dm);
 
+/** @brief Clear the discovery cache.
+ *
+ * Forget all the services stored in the cache. The next discovery of every
+ * service is done on the peer. This function must not be called while
+ * a discovery is in progress.
+ */
+#ifdef CONFIG_BT_GATT_DM_CACHE
+void bt_gatt_dm_cache_clear(void);
+#else
+static inline void bt_gatt_dm_cache_clear(void)
+{
+}
+#endif
+
 /** @brief Print service discovery data.
  *
  * This function prints GATT attributes that belong to the discovered service.
@@ -39,8 +39,13 @@ struct bt_mesh_light_ctrl_reg_spec {
 	struct bt_mesh_light_ctrl_reg reg;
 	/** Regulator step timer. */
 	struct k_work_delayable timer;
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT)
+	/** Internal integral sum, in Q16.16 format. */
+	int64_t i;
+#else
 	/** Internal integral sum. */
 	float i;
+#endif
 	/** Regulator enabled flag. */
 	bool enabled;
 	/* If true, internal integral sum can be negative until it becomes positive. */
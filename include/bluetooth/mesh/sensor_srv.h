@@ -92,6 +92,10 @@ struct bt_mesh_sensor_srv {
 			BT_MESH_SENSOR_MSG_MAXLEN_CADENCE_STATUS))];
 	/** Composition data model pointer. */
 	const struct bt_mesh_model *model;
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_UNSEG)
+	/* First sensor left out of the previous publication. */
+	struct bt_mesh_sensor *pub_next;
+#endif
 };
 
 #if !defined(CONFIG_BT_MESH_SENSOR_USE_LEGACY_SENSOR_VALUE) || defined(__DOXYGEN__)
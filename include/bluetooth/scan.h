@@ -562,6 +562,14 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr);
  */
 void bt_scan_blocklist_clear(void);
 
+/**@brief Clear the duplicate report filter.
+ *
+ * @details Use this function to forget all the devices remembered
+ *          by the duplicate report filter. The next report of
+ *          every device is forwarded.
+ */
+void bt_scan_duplicate_filter_clear(void);
+
 /**@brief Function to update the autoconnect flag after a filter match.
  *
  * @note The function should not be used when scanning is active.
@@ -551,6 +551,42 @@ int bt_hids_inp_rep_send(struct bt_hids *hids_obj, struct bt_conn *conn,
 			 uint8_t rep_index, uint8_t const *rep, uint8_t len,
 			 bt_gatt_complete_func_t cb);
 
+/** @brief Input Report to be sent with @ref bt_hids_inp_rep_send_multiple. */
+struct bt_hids_inp_rep_data {
+	/** Index of report descriptor. */
+	uint8_t rep_index;
+
+	/** Pointer to the report data. */
+	uint8_t const *rep;
+
+	/** Length of report data. */
+	uint8_t len;
+};
+
+/** @brief Send several Input Reports at once.
+ *
+ *  The reports are sent with a single call to bt_gatt_notify_multiple().
+ *  If the peer supports it, they are combined in ATT Multiple Handle Value
+ *  Notifications, otherwise they are sent as separate notifications.
+ *  Requires the @kconfig{CONFIG_BT_GATT_NOTIFY_MULTIPLE} option.
+ *
+ *  @note The function is not thread safe.
+ *	     It cannot be called from multiple threads at the same time.
+ *
+ *  @param hids_obj Pointer to HIDS instance.
+ *  @param conn Pointer to Connection Object.
+ *  @param reps Reports to send.
+ *  @param count Number of reports, at most @kconfig{CONFIG_BT_HIDS_INPUT_REP_MAX}.
+ *  @param cb Notification complete callback (can be NULL), called once
+ *	      for the whole batch.
+ *
+ *  @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	      code is returned.
+ */
+int bt_hids_inp_rep_send_multiple(struct bt_hids *hids_obj, struct bt_conn *conn,
+				  const struct bt_hids_inp_rep_data *reps, size_t count,
+				  bt_gatt_complete_func_t cb);
+
 /** @brief Send Boot Mouse Input Report.
  *
  *  @note The function is not thread safe.
@@ -35,6 +35,11 @@ struct bt_hogp_rep_info;
  * The data size can be obtained from the report object from the
  * @em bt_hogp_rep_info::size field.
  *
+ * The data is not copied: @p data points directly into the buffer of the
+ * received ATT PDU. It is only valid until the callback returns, because the
+ * buffer is then given back to the Bluetooth host. Copy the data if it must
+ * be processed later.
+ *
  * @param hogp   HOGP object.
  * @param rep    Report object.
  * @param err    ATT error code.
@@ -113,6 +113,30 @@ int bt_nus_init(struct bt_nus_cb *callbacks);
  */
 int bt_nus_send(struct bt_conn *conn, const uint8_t *data, uint16_t len);
 
+/**@brief Queue data to be streamed to a connected peer.
+ *
+ * @details The data is copied to the TX stream buffer and sent in
+ *          notifications as large as the ATT MTU allows. At most
+ *          @kconfig{CONFIG_BT_NUS_TX_STREAM_CREDITS} notifications are
+ *          queued in the Bluetooth host at a time, the next ones are sent
+ *          as they complete. The @ref bt_nus_cb.sent callback is not called
+ *          for streamed data. The stream is bound to one connection until
+ *          it disconnects. Requires the @kconfig{CONFIG_BT_NUS_TX_STREAM}
+ *          option.
+ *
+ * @note The function is not thread safe. It cannot be called from multiple
+ *       threads at the same time.
+ *
+ * @param[in] conn Pointer to connection object.
+ * @param[in] data Pointer to a data buffer.
+ * @param[in] len  Length of the data in the buffer.
+ *
+ * @return Number of bytes queued, which is less than @p len if the stream
+ *         buffer is full. A negative value is returned on error, -EBUSY if
+ *         the stream is used by another connection.
+ */
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, size_t len);
+
 /**@brief Get maximum data length that can be used for @ref bt_nus_send.
  *
  * @param[in] conn Pointer to connection Object.
@@ -23,6 +23,9 @@ extern "C" {
 #endif
 
 /** @brief Sensor data aggregator event.
+ *
+ *  The samples point to the aggregator buffer, the data is not copied. The buffer can be accessed
+ *  until it is released with #sensor_data_aggregator_release_buffer_event.
  */
 struct sensor_data_aggregator_event {
 	struct app_event_header header;
@@ -35,7 +38,9 @@ struct sensor_data_aggregator_event {
 
 /** @brief Sensor data aggregator release buffer event.
  *
- *  It is expected that exactly one release event is sent for each buffer.
+ *  It is expected that every consumer of the aggregator sends exactly one release event for each
+ *  buffer. The number of consumers is set with the consumer_cnt devicetree property of the
+ *  aggregator. The buffer is reused after it is released by all consumers.
  */
 struct sensor_data_aggregator_release_buffer_event {
 	struct app_event_header header;
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SETTINGS_LOADER_EVENT_H_
+#define _SETTINGS_LOADER_EVENT_H_
+
+/**
+ * @file
+ * @defgroup caf_settings_loader_event CAF Settings Loader Event
+ * @{
+ * @brief CAF Settings Loader Event.
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Settings subtree loaded event.
+ *
+ * The event is submitted by the settings loader module after the given settings subtree is
+ * loaded from non-volatile memory. The event is used only if staged loading of settings is
+ * enabled.
+ */
+struct settings_subtree_loaded_event {
+	/** Event header. */
+	struct app_event_header header;
+
+	/** Name of the loaded subtree. */
+	const char *subtree;
+};
+
+APP_EVENT_TYPE_DECLARE(settings_subtree_loaded_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _SETTINGS_LOADER_EVENT_H_ */
@@ -32,6 +32,51 @@ struct sm_trigger {
 	struct sm_trigger_activation activation;
 };
 
+/**
+ * @brief Adaptive sampling rate configuration
+ *
+ * The sampling period is halved when the absolute difference between consecutive values of any
+ * sensor channel exceeds the threshold. The sampling period is doubled after the given number of
+ * consecutive samples without activity. The period is kept within the configured range.
+ */
+struct sm_adaptive_rate {
+	/**
+	 * @brief Sampling period used when the sensor detects activity
+	 */
+	unsigned int min_period_ms;
+	/**
+	 * @brief Sampling period used when the sensor detects no activity
+	 */
+	unsigned int max_period_ms;
+	/**
+	 * @brief Activity threshold
+	 */
+	struct sensor_value thresh;
+	/**
+	 * @brief Number of consecutive samples without activity before the period is doubled
+	 */
+	uint8_t quiet_samples;
+};
+
+/**
+ * @brief Sensor FIFO configuration
+ *
+ * The FIFO watermark level and the sampling frequency must be configured in the sensor
+ * driver. The sensor manager drains the FIFO when the trigger is raised.
+ */
+struct sm_fifo {
+	/**
+	 * @brief Trigger raised by the sensor when the FIFO reaches the watermark level
+	 */
+	struct sensor_trigger cfg;
+	/**
+	 * @brief Number of samples read from the FIFO on the trigger
+	 *
+	 * The value must match the FIFO watermark level configured in the sensor driver.
+	 */
+	uint8_t watermark;
+};
+
 /**
  * @brief Sensor configuration
  *
@@ -85,6 +130,24 @@ struct sm_sensor_config {
 	 * @brief Flag to indicate whether sensor should be suspended or not.
 	 */
 	bool suspend;
+	/**
+	 * @brief Sensor FIFO configuration
+	 *
+	 * If set, the sensor is not sampled periodically. Samples are read from the sensor FIFO
+	 * when the FIFO trigger is raised and are submitted in a single sensor event.
+	 * The configuration is used only if :kconfig:option:`CONFIG_CAF_SENSOR_MANAGER_FIFO`
+	 * is enabled.
+	 */
+	const struct sm_fifo *fifo;
+	/**
+	 * @brief Adaptive sampling rate configuration
+	 *
+	 * If set, the sampling period changes at runtime depending on the signal activity.
+	 * The configuration is used only if
+	 * :kconfig:option:`CONFIG_CAF_SENSOR_MANAGER_ADAPTIVE_RATE` is enabled.
+	 * It is ignored for sensors with FIFO configured.
+	 */
+	const struct sm_adaptive_rate *adaptive_rate;
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SETTINGS_LOADER_H_
+#define _SETTINGS_LOADER_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Settings loading stage
+ *
+ * The stages are provided by the application in file specified by
+ * the :kconfig:option:`CONFIG_CAF_SETTINGS_LOADER_DEF_PATH` option, if
+ * :kconfig:option:`CONFIG_CAF_SETTINGS_LOADER_STAGED` is enabled.
+ */
+struct settings_loader_stage {
+	/**
+	 * @brief Name of the settings subtree loaded in the stage
+	 */
+	const char *subtree;
+	/**
+	 * @brief Flag to indicate whether the subtree is required before the module is ready
+	 *
+	 * Critical subtrees are loaded before the settings loader module reports the ready state.
+	 * Other subtrees are loaded in the background afterwards.
+	 */
+	bool critical;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SETTINGS_LOADER_H_ */
@@ -17,6 +17,14 @@
  * @brief Basic continuous array.
  */
 
+/** @brief Contiguous part of a finite array. */
+struct contin_array_span {
+	/** Pointer to the first byte of the span. */
+	void const *data;
+	/** Size of the span in bytes. May be zero. */
+	uint32_t size;
+};
+
 /** @brief Creates a continuous array from a finite array.
  *
  * @param pcm_cont		Pointer to the destination array.
@@ -40,6 +48,30 @@
 int contin_array_create(void *pcm_cont, uint32_t pcm_cont_size, void const *const pcm_finite,
 			uint32_t pcm_finite_size, uint32_t *const finite_pos);
 
+/** @brief Gets the next part of a continuous array without copying it.
+ *
+ * @param pcm_finite		Pointer to an array of samples or data.
+ * @param pcm_finite_size	Size of pcm_finite.
+ * @param size			Number of bytes to get. Cannot be larger than
+ *				pcm_finite_size.
+ * @param finite_pos		Variable used internally. Must be set
+ *				to 0 for the first run and not changed.
+ * @param spans			The bytes, in order, as two spans of pcm_finite.
+ *				The second span is empty unless the view wraps
+ *				around the end of pcm_finite.
+ *
+ * @note  This function gives the same data as contin_array_create, and shares
+ * the same position handling, but leaves it to the caller to consume the two
+ * spans, for example by handing them directly to a DMA transfer.
+ *
+ * @retval 0		If the operation was successful.
+ * @retval -EPERM	If any sizes are zero.
+ * @retval -EINVAL	If size is larger than pcm_finite_size.
+ * @retval -ENXIO	On NULL pointer.
+ */
+int contin_array_view(void const *const pcm_finite, uint32_t pcm_finite_size, uint32_t size,
+		      uint32_t *const finite_pos, struct contin_array_span spans[2]);
+
 /**
  * @}
  */
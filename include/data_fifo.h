@@ -31,6 +31,25 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+#if CONFIG_DATA_FIFO_SPSC
+/* State of a single-producer/single-consumer data_fifo. The blocks are used as a ring, and
+ * each index is a free-running counter written by one side only.
+ */
+struct data_fifo_spsc {
+	/* Written by the producer */
+	atomic_t alloc_idx;
+	atomic_t lock_idx;
+	/* Written by the consumer */
+	atomic_t read_idx;
+	atomic_t free_idx;
+	/* Only used when one side has to wait for the other */
+	atomic_t producer_waiting;
+	atomic_t consumer_waiting;
+	struct k_sem space_sem;
+	struct k_sem data_sem;
+};
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -39,6 +58,10 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if CONFIG_DATA_FIFO_SPSC
+	bool spsc;
+	struct data_fifo_spsc ring;
+#endif
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +75,29 @@ struct data_fifo {
 				  .elements_max = elements_max_in,                                 \
 				  .initialized = false }
 
+#if CONFIG_DATA_FIFO_SPSC
+/**
+ * @brief Define a single-producer/single-consumer data_fifo.
+ *
+ * The FIFO has the same API as one defined with DATA_FIFO_DEFINE, but uses a lock-free ring
+ * instead of a memory slab and a message queue. Kernel objects are only used when a caller
+ * waits with a timeout. The following restrictions apply:
+ * - Only one context allocates and locks blocks, and only one context reads and frees blocks.
+ * - Blocks are locked and freed in the order they were allocated.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(1))                                                                   \
+		_msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = { 0 };    \
+	char __aligned(WB_UP(1))                                                                   \
+		_slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = { 0 };              \
+	struct data_fifo name = { .msgq_buffer = _msgq_buffer_##name,                              \
+				  .slab_buffer = _slab_buffer_##name,                              \
+				  .block_size_max = block_size_max_in,                             \
+				  .elements_max = elements_max_in,                                 \
+				  .initialized = false,                                            \
+				  .spsc = true }
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -150,6 +150,8 @@ int dfu_multi_image_register_writer(const struct dfu_image_writer *writer);
  *
  * @retval -ESPIPE  If @c offset is bigger than expected which may indicate a data gap
  *                  or writing more data than declared in the package header.
+ * @retval -EBADMSG If @kconfig{CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST} is enabled and the
+ *                  digest of an image does not match the one in the package header.
  * @return negative On other failure.
  * @return 0        On success.
  */
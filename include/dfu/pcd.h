@@ -107,6 +107,16 @@ void pcd_fw_copy_invalidate(void);
  */
 enum pcd_status pcd_fw_copy_status_get(void);
 
+/** @brief Get the number of bytes copied so far by an ongoing update.
+ *
+ * The progress is updated by the network core every few kilobytes while it
+ * copies the image. A network core bootloader that does not report progress
+ * leaves it at 0.
+ *
+ * @return Number of bytes of the image written to the network core flash.
+ */
+size_t pcd_fw_copy_progress_get(void);
+
 /** @brief Get value of 'data' member of pcd cmd.
  *
  * @retval value of 'data' member.
@@ -115,7 +115,9 @@ int emds_entry_add(struct emds_dynamic_entry *entry);
  *
  * Triggers the process of storing all data registered to be stored. All data
  * registered either through @ref emds_entry_add function or the
- * @ref EMDS_STATIC_ENTRY_DEFINE macro is stored. It locks all interrupts until
+ * @ref EMDS_STATIC_ENTRY_DEFINE macro is stored. If
+ * @kconfig{CONFIG_EMDS_STORE_CHANGED_ONLY} is enabled, entries that are
+ * identical to their stored copy are skipped. It locks all interrupts until
  * the write is finished. Once the data storage is completed, the data should
  * not be changed, and the device should be halted. The device must not be
  * allowed to reboot when operating on a backup supply, since reboot will
@@ -168,6 +170,9 @@ int emds_clear(void);
  * added. After this has been called emergency data storage should be ready to
  * store.
  *
+ * If @kconfig{CONFIG_EMDS_STORE_CHANGED_ONLY} is enabled, the current entries
+ * are kept, unless the flash storage has to be cleared.
+ *
  * @retval 0 Success
  * @retval -ERRNO errno code if error
  */
@@ -180,6 +185,9 @@ int emds_prepare(void);
  * registered in the entries. This value is dependent on the chip used, and
  * should be checked against the chip datasheet.
  *
+ * If @kconfig{CONFIG_EMDS_STORE_CHANGED_ONLY} is enabled, only the entries
+ * that differ from their stored copy at the time of the call are counted.
+ *
  * @return Time needed to store all data (in microseconds).
  */
 uint32_t emds_store_time_get(void);
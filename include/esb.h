@@ -213,6 +213,21 @@ struct esb_evt {
 /** @brief Event handler prototype. */
 typedef void (*esb_event_handler)(const struct esb_evt *event);
 
+/** @brief Enhanced ShockBurst per-pipe statistics. */
+struct esb_pipe_stats {
+	uint32_t rx_packets;	 /**< Packets added to the RX FIFO. */
+	uint32_t rx_retransmits; /**< Retransmitted packets discarded as duplicates. */
+	uint32_t rx_dropped;	 /**< Packets dropped because the RX FIFO was full. */
+	uint32_t ack_payloads;	 /**< ACK payloads delivered to the PTX. */
+};
+
+/** @brief Enhanced ShockBurst per-channel statistics. */
+struct esb_channel_stats {
+	uint32_t tx_packets;  /**< Packets sent with acknowledgment requested. */
+	uint32_t tx_attempts; /**< Transmission attempts, including retransmissions. */
+	uint32_t tx_failed;   /**< Packets not acknowledged after all retransmissions. */
+};
+
 /** @brief Main configuration structure for the module. */
 struct esb_config {
 	enum esb_protocol protocol;		/**< Protocol. */
@@ -296,7 +311,8 @@ bool esb_is_idle(void);
  *  This function writes a payload that is added to the queue. When the module
  *  is in PTX mode, the payload is queued for a regular transmission. When the
  *  module is in PRX mode, the payload is queued for when a packet is received
- *  that requires an acknowledgement with payload.
+ *  that requires an acknowledgement with payload. At most
+ *  CONFIG_ESB_ACK_PAYLOAD_PIPE_MAX payloads can be queued for each pipe.
  *
  *  @param[in]   payload     The payload.
  *
@@ -508,6 +524,42 @@ int esb_set_bitrate(enum esb_bitrate bitrate);
  */
 int esb_reuse_pid(uint8_t pipe);
 
+/** @brief Get the statistics of a pipe.
+ *
+ *  Requires the CONFIG_ESB_PIPE_STATS Kconfig option.
+ *
+ *  @param[in]  pipe	Pipe.
+ *  @param[out] stats	Statistics of the pipe.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats);
+
+/** @brief Reset the statistics of all pipes.
+ *
+ *  Requires the CONFIG_ESB_PIPE_STATS Kconfig option.
+ */
+void esb_pipe_stats_reset(void);
+
+/** @brief Get the link quality statistics of a radio channel.
+ *
+ *  Requires the CONFIG_ESB_CHANNEL_STATS Kconfig option.
+ *
+ *  @param[in]  channel	Radio channel.
+ *  @param[out] stats	Statistics of the channel.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_channel_stats_get(uint32_t channel, struct esb_channel_stats *stats);
+
+/** @brief Reset the statistics of all radio channels.
+ *
+ *  Requires the CONFIG_ESB_CHANNEL_STATS Kconfig option.
+ */
+void esb_channel_stats_reset(void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -34,6 +34,24 @@ enum fem_antenna {
 	FEM_ANTENNA_2
 };
 
+/**@brief Closed-loop Tx output power policy.
+ *
+ * The policy keeps the output power at the lowest level that still delivers the target RSSI
+ * at the receiver. It is updated with the RSSI reported by the peer and is applied to the
+ * radio and the front-end module before every transmission with
+ * @ref fem_tx_power_policy_prepare.
+ */
+struct fem_tx_power_policy {
+	/** RSSI in dBm the receiver should observe. */
+	int8_t rssi_target;
+
+	/** RSSI deviation from the target in dB that does not change the output power. */
+	uint8_t hysteresis_db;
+
+	/** Current Tx output power requested on air in dBm. */
+	int8_t power;
+};
+
 /**@brief Initialize the front-end module.
  *
  * @param[in] timer_instance Pointer to a 1-us resolution timer instance.
@@ -204,6 +222,47 @@ static inline int8_t fem_tx_output_power_max_get(uint16_t freq_mhz)
 	return fem_tx_output_power_check(INT8_MAX, freq_mhz, true);
 }
 
+/**@brief Initialize the Tx output power policy.
+ *
+ * @param[out] policy Tx output power policy.
+ * @param[in] rssi_target RSSI in dBm the receiver should observe.
+ * @param[in] hysteresis_db RSSI deviation from the target in dB that does not change
+ *                          the output power.
+ * @param[in] initial_power Tx output power in dBm used until the first RSSI feedback.
+ */
+void fem_tx_power_policy_init(struct fem_tx_power_policy *policy, int8_t rssi_target,
+			      uint8_t hysteresis_db, int8_t initial_power);
+
+/**@brief Update the Tx output power policy with the RSSI feedback from the receiver.
+ *
+ * The output power is raised by the full RSSI shortfall, so that the link recovers within
+ * one update, and lowered by half of the RSSI excess, so that a single strong packet does not
+ * push the link below the target. The result is limited to the output power achievable at
+ * the given frequency.
+ *
+ * @param[in,out] policy Tx output power policy.
+ * @param[in] rssi RSSI in dBm reported by the receiver.
+ * @param[in] freq_mhz Frequency in MHz the feedback was measured on.
+ *
+ * @return The new Tx output power in dBm.
+ */
+int8_t fem_tx_power_policy_update(struct fem_tx_power_policy *policy, int8_t rssi,
+				  uint16_t freq_mhz);
+
+/**@brief Prepare the radio and the front-end module for a transmission using the policy.
+ *
+ * @param[in] policy Tx output power policy.
+ * @param[out] radio_tx_power Tx power value to be set on the radio peripheral.
+ * @param[in] freq_mhz Frequency in MHz of the transmission.
+ *
+ * @return The power in dBm that is achieved as device output power.
+ */
+static inline int8_t fem_tx_power_policy_prepare(const struct fem_tx_power_policy *policy,
+						 int8_t *radio_tx_power, uint16_t freq_mhz)
+{
+	return fem_tx_output_power_prepare(policy->power, radio_tx_power, freq_mhz);
+}
+
 /**@brief Get the front-end module default Tx gain.
  *
  * @return The front-end module default Tx gain value.
@@ -46,6 +46,8 @@ struct at_monitor_entry {
 		uint8_t paused : 1; /* Monitor is paused. */
 		uint8_t direct : 1; /* Dispatch in ISR. */
 	} flags;
+	/** Next monitor with the same filter index bucket, set by the library. */
+	struct at_monitor_entry *next;
 };
 
 /** Wildcard. Match any notifications. */
@@ -117,6 +119,59 @@ static inline void at_monitor_resume(struct at_monitor_entry *mon)
 	mon->flags.paused = false;
 }
 
+/**
+ * @brief Keep a notification after the monitor callback returns.
+ *
+ * The notification given to a monitor defined with @ref AT_MONITOR is a buffer shared by all
+ * monitors that receive it. Holding it keeps the buffer from being freed, so that the
+ * notification can be parsed later without copying it. Every hold must be followed by
+ * at_monitor_notif_release(). Holding the buffer keeps it from receiving a new notification,
+ * so the notification should be released as soon as possible.
+ *
+ * @note Must not be used by monitors defined with @ref AT_MONITOR_ISR, as the notification
+ *       is then not copied by the library.
+ *
+ * @param notif The notification given to the monitor callback.
+ *
+ * @return The notification, @p notif.
+ */
+const char *at_monitor_notif_hold(const char *notif);
+
+/**
+ * @brief Release a notification kept with at_monitor_notif_hold().
+ *
+ * @param notif The notification.
+ */
+void at_monitor_notif_release(const char *notif);
+
+/**
+ * @brief AT monitor statistics.
+ */
+struct at_monitor_stats {
+	/** Number of notifications queued for monitors in the system workqueue. */
+	uint32_t notifs;
+	/** Number of notifications dropped because no buffer was available. */
+	uint32_t dropped;
+	/** Number of notifications put on the heap because they were too large for a slab
+	 *  buffer or all slab buffers were in use.
+	 */
+	uint32_t heap_fallbacks;
+	/** Number of notification buffers currently in use. */
+	uint32_t bufs_in_use;
+	/** Highest number of notification buffers in use at the same time. */
+	uint32_t bufs_in_use_max;
+};
+
+/**
+ * @brief Get the AT monitor statistics.
+ *
+ * @param stats Statistics.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p stats is NULL.
+ */
+int at_monitor_stats_get(struct at_monitor_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
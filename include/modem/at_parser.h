@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef AT_PARSER_H__
+#define AT_PARSER_H__
+
+#include <stdlib.h>
+#include <zephyr/types.h>
+
+#include <modem/at_params.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file at_parser.h
+ *
+ * @defgroup at_parser AT parser
+ * @{
+ * @brief Reentrant, allocation-free parser for AT commands, responses and notifications.
+ *
+ * The parser scans a line of an AT string once and records where each parameter starts, how
+ * long it is and its type. Nothing is copied and no memory is allocated; the parameter values
+ * are only decoded when they are read by the typed getters. All parser state is kept in
+ * @ref at_parser, so any number of threads can parse at the same time, each with its own
+ * parser instance.
+ *
+ * The AT string must remain valid and unmodified for as long as the parser is used.
+ */
+
+/** @brief Location and type of a parameter in the line being parsed. */
+struct at_parser_param {
+	/** Offset of the first character of the parameter from the start of the line. */
+	uint16_t offset;
+	/** Length of the parameter in characters. */
+	uint16_t len;
+	/** Parameter type, see @ref at_param_type. */
+	uint8_t type;
+};
+
+/** @brief AT parser instance. Members are private, use the API to access the parameters. */
+struct at_parser {
+	/** Start of the line currently parsed. */
+	const char *line;
+	/** Start of the next line to parse, or NULL if this is the last one. */
+	const char *next;
+	/** Number of parameters in the line. */
+	size_t count;
+	/** Parameters of the line. */
+	struct at_parser_param params[CONFIG_AT_PARSER_MAX_PARAMS];
+};
+
+/**
+ * @brief Initialize a parser and parse the first line of an AT string.
+ *
+ * The first line is the first AT command, notification or string response of @p at, leading
+ * line terminators are skipped. Any following notifications can be parsed by calling
+ * @ref at_parser_cmd_next. A trailing final result code, such as "OK", ends the string.
+ *
+ * @param parser Parser instance.
+ * @param at     AT string to parse, must be null-terminated.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ * @retval -E2BIG  The line has more than @kconfig{CONFIG_AT_PARSER_MAX_PARAMS} parameters or is
+ *                 too long. The parser holds the parameters that fit.
+ * @retval -EBADMSG The line is malformed, for example a string is missing its closing quote.
+ */
+int at_parser_init(struct at_parser *parser, const char *at);
+
+/**
+ * @brief Parse the next line of the AT string.
+ *
+ * @param parser Parser instance.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL The parser is not initialized.
+ * @retval -ENODATA There are no more lines to parse.
+ * @retval -E2BIG  See @ref at_parser_init.
+ * @retval -EBADMSG See @ref at_parser_init.
+ */
+int at_parser_cmd_next(struct at_parser *parser);
+
+/**
+ * @brief Get the number of parameters in the current line.
+ *
+ * The notification or command name, such as "+CEREG" or "AT+CFUN", is the first parameter.
+ *
+ * @param[in] parser Parser instance.
+ * @param[out] count Number of parameters.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int at_parser_cmd_count_get(const struct at_parser *parser, size_t *count);
+
+/**
+ * @brief Get the type of a parameter.
+ *
+ * Integers are not range checked by the scan, so a parameter of type
+ * @ref AT_PARAM_TYPE_NUM_INT can still fail to decode with -ERANGE.
+ *
+ * @param[in] parser Parser instance.
+ * @param[in] index  Parameter index in the current line.
+ *
+ * @return Parameter type, @ref AT_PARAM_TYPE_INVALID if there is no parameter at @p index.
+ */
+enum at_param_type at_parser_type_get(const struct at_parser *parser, size_t index);
+
+/**
+ * @brief Get a parameter value as a signed 64-bit integer.
+ *
+ * @param[in] parser Parser instance.
+ * @param[in] index  Parameter index in the current line.
+ * @param[out] value Parameter value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid, or the parameter is not
+ *                 an integer.
+ * @retval -ERANGE The value does not fit in the type.
+ */
+int at_parser_int64_get(const struct at_parser *parser, size_t index, int64_t *value);
+
+/**
+ * @brief Get a parameter value as a signed 32-bit integer.
+ *
+ * See @ref at_parser_int64_get for the return values.
+ */
+int at_parser_int_get(const struct at_parser *parser, size_t index, int32_t *value);
+
+/**
+ * @brief Get a parameter value as an unsigned 32-bit integer.
+ *
+ * See @ref at_parser_int64_get for the return values.
+ */
+int at_parser_unsigned_int_get(const struct at_parser *parser, size_t index, uint32_t *value);
+
+/**
+ * @brief Get a parameter value as a signed 16-bit integer.
+ *
+ * See @ref at_parser_int64_get for the return values.
+ */
+int at_parser_short_get(const struct at_parser *parser, size_t index, int16_t *value);
+
+/**
+ * @brief Get a parameter value as an unsigned 16-bit integer.
+ *
+ * See @ref at_parser_int64_get for the return values.
+ */
+int at_parser_unsigned_short_get(const struct at_parser *parser, size_t index, uint16_t *value);
+
+/**
+ * @brief Get a pointer to a string parameter in the AT string.
+ *
+ * The string is not null-terminated. Quotes are not included.
+ *
+ * @param[in] parser Parser instance.
+ * @param[in] index  Parameter index in the current line.
+ * @param[out] str   Start of the string.
+ * @param[out] len   Length of the string.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid, or the parameter is not
+ *                 a string.
+ */
+int at_parser_string_ptr_get(const struct at_parser *parser, size_t index, const char **str,
+			     size_t *len);
+
+/**
+ * @brief Copy a string parameter.
+ *
+ * The string is not null-terminated. Quotes are not included.
+ *
+ * @param[in] parser   Parser instance.
+ * @param[in] index    Parameter index in the current line.
+ * @param[out] str     Buffer to copy the string to.
+ * @param[in,out] len  Size of @p str as input, length of the string as output.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid, or the parameter is not
+ *                 a string.
+ * @retval -ENOMEM @p str is too small for the string.
+ */
+int at_parser_string_get(const struct at_parser *parser, size_t index, char *str, size_t *len);
+
+/**
+ * @brief Decode an array parameter, such as "(1,2,3)".
+ *
+ * @param[in] parser    Parser instance.
+ * @param[in] index     Parameter index in the current line.
+ * @param[out] array    Buffer to decode the array elements to.
+ * @param[in,out] len   Size of @p array in bytes as input, size of the decoded elements in
+ *                      bytes as output.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid, or the parameter is not
+ *                 an array.
+ * @retval -ENOMEM @p array is too small for all the elements.
+ * @retval -ERANGE An element does not fit in 32 bits.
+ */
+int at_parser_array_get(const struct at_parser *parser, size_t index, uint32_t *array,
+			size_t *len);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_PARSER_H__ */
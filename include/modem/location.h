@@ -64,6 +64,16 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * Fallback to next preferred method until a location meets
+	 * @ref location_config.accuracy_target.
+	 *
+	 * Wi-Fi and cellular are always scanned at the same time and resolved with a single
+	 * cloud request, wherever they are in the method list, to get a first location quickly.
+	 * If no method gives a location that meets the target, the most accurate location is
+	 * returned.
+	 */
+	LOCATION_REQ_MODE_RACE,
 };
 
 /** Event IDs. */
@@ -112,7 +122,8 @@ enum location_event_id {
 	 * and the positioning procedure continues.
 	 *
 	 * This event is only sent if @kconfig{CONFIG_LOCATION_DATA_DETAILS} is set and
-	 * @ref location_config.mode is @ref LOCATION_REQ_MODE_FALLBACK.
+	 * @ref location_config.mode is @ref LOCATION_REQ_MODE_FALLBACK or
+	 * @ref LOCATION_REQ_MODE_RACE.
 	 */
 	LOCATION_EVT_FALLBACK,
 };
@@ -274,7 +285,9 @@ struct location_data_fallback {
 	/**
 	 * Event ID indicating the cause for the fallback.
 	 *
-	 * Either @ref LOCATION_EVT_TIMEOUT and @ref LOCATION_EVT_ERROR.
+	 * Either @ref LOCATION_EVT_TIMEOUT and @ref LOCATION_EVT_ERROR, or
+	 * @ref LOCATION_EVT_LOCATION if the location did not meet
+	 * @ref location_config.accuracy_target.
 	 */
 	enum location_event_id cause;
 	/** Data details at the time of a timeout or an error that caused the fallback. */
@@ -546,9 +559,12 @@ struct location_config {
 	 *
 	 * Wi-Fi and cellular scan results are combined into single cloud request, that is,
 	 * these methods are handled together, if the following conditions are met:
-	 *   - Methods are one after the other in location request method list
-	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK
+	 *   - Methods are one after the other in location request method list, or @ref mode is
+	 *     @ref LOCATION_REQ_MODE_RACE
+	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK or @ref LOCATION_REQ_MODE_RACE
 	 *   - Requested cloud service for Wi-Fi and cellular is the same
+	 *
+	 * The combined method is run at the position of the first of the two methods.
 	 */
 	struct location_method_config methods[CONFIG_LOCATION_METHODS_LIST_SIZE];
 
@@ -587,6 +603,18 @@ struct location_config {
 	 * location_config_defaults_set() function is called.
 	 */
 	enum location_req_mode mode;
+
+	/**
+	 * @brief Accuracy (in meters) a location must meet to end the location request in
+	 * @ref LOCATION_REQ_MODE_RACE mode.
+	 *
+	 * @details A location with a larger accuracy value makes the library fall back to the next
+	 * method. Set to 0 to accept any location. Not used in other modes.
+	 *
+	 * Default value is 0. It is applied when location_config_defaults_set() function is
+	 * called.
+	 */
+	uint32_t accuracy_target;
 };
 
 /**
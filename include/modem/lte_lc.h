@@ -1711,6 +1711,30 @@ int lte_lc_neighbor_cell_measurement(struct lte_lc_ncellmeas_params *params);
  */
 int lte_lc_neighbor_cell_measurement_cancel(void);
 
+/**
+ * Get the result of the latest neighbor cell measurement.
+ *
+ * The result of the latest successful neighbor cell measurement is kept by the library, so it
+ * can be reused, for example for cellular positioning, without making a new measurement. The
+ * result is the same as in the latest @ref LTE_LC_EVT_NEIGHBOR_CELL_MEAS event.
+ *
+ * @param[in,out] cells     Cell information. The neighbor cells and GCI cells are copied to the
+ *                          arrays set in @c neighbor_cells and @c gci_cells, which can be NULL
+ *                          to leave them out.
+ * @param[in] ncells_max    Number of cells that fit in @c neighbor_cells.
+ * @param[in] gci_cells_max Number of cells that fit in @c gci_cells.
+ * @param[out] age_ms       Time since the result was received, in milliseconds. Can be NULL.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if @p cells is NULL.
+ * @retval -ENODATA if there is no result, as no measurement has been made or the latest one
+ *         failed.
+ * @retval -E2BIG if not all the cells fit in the arrays. The cells that fit are copied.
+ */
+int lte_lc_neighbor_cell_measurement_last_get(struct lte_lc_cells_info *cells,
+					      size_t ncells_max, size_t gci_cells_max,
+					      int64_t *age_ms);
+
 /**
  * Get connection evaluation parameters.
  *
@@ -254,6 +254,16 @@ enum at_param_type modem_info_type_get(enum modem_info info);
  */
 int modem_info_params_get(struct modem_param_info *modem_param);
 
+/** @brief Invalidate the cached AT command responses.
+ *
+ * The responses are invalidated automatically by AT notifications and functional mode
+ * changes. Call this when the information has changed in some other way, for example after
+ * changing the system mode. The modem firmware version, IMEI and supported bands are kept.
+ *
+ * @note Requires @kconfig{CONFIG_MODEM_INFO_CACHE}.
+ */
+void modem_info_cache_invalidate(void);
+
 /** @brief Obtain the UUID of the modem firmware build.
  *
  * The UUID is represented as a string, for example:
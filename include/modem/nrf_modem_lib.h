@@ -228,6 +228,52 @@ void nrf_modem_fault_handler(struct nrf_modem_fault_info *fault_info);
 const char *nrf_modem_lib_fault_strerror(int fault);
 #endif
 
+struct zsock_addrinfo;
+
+/**
+ * @brief Flush the DNS resolver cache.
+ *
+ * Drop all the cached addresses, for example when the device has moved to a network where the
+ * host names resolve differently. Lookups in progress are not cached.
+ *
+ * @note Requires @kconfig{CONFIG_NRF_MODEM_LIB_DNS_CACHE}.
+ */
+void nrf_modem_lib_dns_cache_flush(void);
+
+/**
+ * @brief Callback for an asynchronous DNS lookup.
+ *
+ * @param err       Zero on success, a DNS_EAI_* error code of getaddrinfo() otherwise.
+ * @param res       Resolved addresses, NULL on failure. Must be freed with freeaddrinfo().
+ * @param user_data User data given to @ref nrf_modem_lib_getaddrinfo_async.
+ */
+typedef void (*nrf_modem_lib_getaddrinfo_cb_t)(int err, struct zsock_addrinfo *res,
+					       void *user_data);
+
+/**
+ * @brief Resolve a host name without blocking the caller.
+ *
+ * The lookup is done in a dedicated thread, in the same way as getaddrinfo(), and the result
+ * is given to @p cb in that thread. With @kconfig{CONFIG_NRF_MODEM_LIB_DNS_CACHE}, cached
+ * addresses are given without a new lookup.
+ *
+ * @note Requires @kconfig{CONFIG_NRF_MODEM_LIB_DNS_ASYNC}.
+ *
+ * @param node      Host name to resolve.
+ * @param service   Service name or port number, or NULL.
+ * @param hints     Hints as for getaddrinfo(), or NULL. The hints are copied.
+ * @param cb        Callback for the result.
+ * @param user_data User data for the callback.
+ *
+ * @retval 0 If the lookup was queued.
+ * @retval -EINVAL If @p node or @p cb is NULL.
+ * @retval -ENAMETOOLONG If @p node or @p service is too long.
+ * @retval -EAGAIN If too many lookups are queued already.
+ */
+int nrf_modem_lib_getaddrinfo_async(const char *node, const char *service,
+				    const struct zsock_addrinfo *hints,
+				    nrf_modem_lib_getaddrinfo_cb_t cb, void *user_data);
+
 #if defined(CONFIG_NRF_MODEM_LIB_MEM_DIAG) || defined(__DOXYGEN__)
 struct nrf_modem_lib_diag_stats {
 	struct {
@@ -249,6 +295,35 @@ struct nrf_modem_lib_diag_stats {
 int nrf_modem_lib_diag_stats_get(struct nrf_modem_lib_diag_stats *stats);
 #endif
 
+#if defined(CONFIG_NRF_MODEM_LIB_WAIT_STATS) || defined(__DOXYGEN__)
+/** @brief Statistics of the threads waiting on the Modem library. */
+struct nrf_modem_lib_wait_stats {
+	/** Number of events notified by the Modem library. */
+	uint32_t events;
+	/** Number of times a sleeping thread was woken up by an event. */
+	uint32_t wakeups;
+	/** Number of waits that returned right away, because an event relevant to the thread
+	 *  had happened since its last wait.
+	 */
+	uint32_t sleeps_skipped;
+	/** Number of waits that timed out. */
+	uint32_t timeouts;
+};
+
+/**
+ * @brief Retrieve wait statistics.
+ *
+ * An event only wakes the threads waiting on the socket or context the event is for, so
+ * @c wakeups is expected to stay close to @c events, even with many threads blocked.
+ *
+ * @param[out] stats Wait statistics.
+ *
+ * @retval 0 On success.
+ * @retval -EFAULT If @p stats is NULL.
+ */
+int nrf_modem_lib_wait_stats_get(struct nrf_modem_lib_wait_stats *stats);
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
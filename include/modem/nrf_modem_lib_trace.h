@@ -114,6 +114,29 @@ int nrf_modem_lib_trace_clear(void);
  * @return Rolling average bitrate of the trace backend
  */
 uint32_t nrf_modem_lib_trace_backend_bitrate_get(void);
+
+/** @brief Trace backend statistics. */
+struct nrf_modem_lib_trace_backend_stats {
+	/** Rolling average bitrate of the trace backend, see
+	 *  @ref nrf_modem_lib_trace_backend_bitrate_get.
+	 */
+	uint32_t bitrate;
+	/** Number of trace bytes written to the trace backend since boot. */
+	uint64_t bytes_written;
+	/** Number of trace bytes written to the trace backend since boot, that the backend
+	 *  could not output. Always zero for backends that do not report dropped data.
+	 */
+	uint64_t bytes_dropped;
+};
+
+/** @brief Get the throughput and drop counters of the trace backend.
+ *
+ * @param[out] stats Trace backend statistics.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p stats is NULL.
+ */
+int nrf_modem_lib_trace_backend_stats_get(struct nrf_modem_lib_trace_backend_stats *stats);
 #endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__) */
 
 /** @} */
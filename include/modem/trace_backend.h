@@ -122,6 +122,18 @@ struct nrf_modem_lib_trace_backend {
 	 * @return 0 on success, negative errno on failure.
 	 */
 	int (*resume)(void);
+
+	/**
+	 * @brief Get the number of trace bytes dropped by the trace backend.
+	 *
+	 * Trace data is dropped when it has been accepted by @c write, but the backend could not
+	 * output it, for example because the transfer from a buffer failed.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @return Number of bytes dropped since boot.
+	 */
+	size_t (*dropped_get)(void);
 };
 
 /**@} */ /* defgroup trace_backend */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file mpsl_timeslot_stats.h
+ *
+ * @defgroup mpsl_timeslot_stats Multiprotocol Service Layer timeslot statistics.
+ *
+ * @brief Usage and contention statistics of MPSL timeslot sessions.
+ *
+ * Each timeslot user registers a statistics instance and reports the requests
+ * and signals of its session. When CONFIG_MPSL_TIMESLOT_STATS is disabled, the
+ * reporting functions compile to nothing.
+ * @{
+ */
+
+#ifndef MPSL_TIMESLOT_STATS__
+#define MPSL_TIMESLOT_STATS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+/** @brief Counters of a single timeslot user. */
+struct mpsl_timeslot_stats {
+	/* Number of timeslots requested. */
+	uint32_t requested;
+
+	/* Number of timeslots granted. */
+	uint32_t granted;
+
+	/* Number of requests blocked by other protocols. */
+	uint32_t blocked;
+
+	/* Number of requests cancelled in favor of other protocols. */
+	uint32_t cancelled;
+
+	/* Number of timeslots that took longer than their requested length. */
+	uint32_t overruns;
+
+	/* Time spent in granted timeslots in microseconds. */
+	uint64_t busy_us_total;
+
+	/* Longest time spent in a single timeslot in microseconds. */
+	uint32_t busy_us_max;
+};
+
+/** @brief Statistics instance of a timeslot user. */
+struct mpsl_timeslot_stats_user {
+	/* Name shown in the shell and in the nRF Profiler events. */
+	const char *name;
+
+	struct mpsl_timeslot_stats stats;
+
+	/* Uptime in milliseconds when the statistics were last reset. */
+	int64_t reset_ms;
+
+	/* Cycle count at the start of the ongoing timeslot. */
+	uint32_t start_cyc;
+
+	sys_snode_t node;
+};
+
+#if defined(CONFIG_MPSL_TIMESLOT_STATS)
+
+/** @brief Register a timeslot user.
+ *
+ * @param user Statistics instance, must stay valid for the lifetime of the application.
+ * @param name Name of the user.
+ */
+void mpsl_timeslot_stats_register(struct mpsl_timeslot_stats_user *user, const char *name);
+
+/** @brief Record a timeslot request. */
+void mpsl_timeslot_stats_requested(struct mpsl_timeslot_stats_user *user);
+
+/** @brief Record the MPSL_TIMESLOT_SIGNAL_START signal. */
+void mpsl_timeslot_stats_start(struct mpsl_timeslot_stats_user *user);
+
+/** @brief Record the end of the timeslot work started with @ref mpsl_timeslot_stats_start.
+ *
+ * @param user Statistics instance.
+ * @param length_us Requested length of the timeslot, used to detect overruns.
+ */
+void mpsl_timeslot_stats_end(struct mpsl_timeslot_stats_user *user, uint32_t length_us);
+
+/** @brief Record the MPSL_TIMESLOT_SIGNAL_BLOCKED signal. */
+void mpsl_timeslot_stats_blocked(struct mpsl_timeslot_stats_user *user);
+
+/** @brief Record the MPSL_TIMESLOT_SIGNAL_CANCELLED signal. */
+void mpsl_timeslot_stats_cancelled(struct mpsl_timeslot_stats_user *user);
+
+/** @brief Get a copy of the statistics of a user.
+ *
+ * @param user Statistics instance.
+ * @param stats Copy of the statistics.
+ * @param elapsed_ms Time since the last reset in milliseconds, can be NULL.
+ */
+void mpsl_timeslot_stats_get(struct mpsl_timeslot_stats_user *user,
+			     struct mpsl_timeslot_stats *stats, int64_t *elapsed_ms);
+
+/** @brief Reset the statistics of all registered users. */
+void mpsl_timeslot_stats_reset(void);
+
+#else
+
+static inline void mpsl_timeslot_stats_register(struct mpsl_timeslot_stats_user *user,
+						const char *name) {}
+static inline void mpsl_timeslot_stats_requested(struct mpsl_timeslot_stats_user *user) {}
+static inline void mpsl_timeslot_stats_start(struct mpsl_timeslot_stats_user *user) {}
+static inline void mpsl_timeslot_stats_end(struct mpsl_timeslot_stats_user *user,
+					   uint32_t length_us) {}
+static inline void mpsl_timeslot_stats_blocked(struct mpsl_timeslot_stats_user *user) {}
+static inline void mpsl_timeslot_stats_cancelled(struct mpsl_timeslot_stats_user *user) {}
+
+#endif /* CONFIG_MPSL_TIMESLOT_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPSL_TIMESLOT_STATS__ */
+
+/**
+ * @}
+ */
@@ -32,7 +32,8 @@ enum azure_iot_hub_evt_type {
 	AZURE_IOT_HUB_EVT_CONNECTING = 0x1,
 
 	/** Connected to Azure IoT Hub.
-	 *  The event has no associated data.
+	 *  The ``data.persistent_session`` member indicates if a previous MQTT
+	 *  session is being used.
 	 */
 	AZURE_IOT_HUB_EVT_CONNECTED,
 
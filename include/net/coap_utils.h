@@ -40,6 +40,26 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 		      const char *const *uri_path_options, uint8_t *payload,
 		      uint16_t payload_size, coap_reply_t reply_cb);
 
+/** @brief Send CoAP confirmable request.
+ *
+ * The request is retransmitted with exponential backoff until it is
+ * acknowledged by the server or the retransmission attempts run out.
+ *
+ * @param[in] method           CoAP method type.
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] payload          pointer to the CoAP message payload.
+ * @param[in] payload_size     size of the CoAP message payload.
+ * @param[in] reply_cb         function to call when the response comes.
+ *
+ * @retval >= 0 On success.
+ * @retval -ENOMEM Too many confirmable requests await an acknowledgment.
+ * @retval < 0 On other failure.
+ */
+int coap_send_confirmable_request(enum coap_method method, const struct sockaddr *addr,
+				  const char *const *uri_path_options, uint8_t *payload,
+				  uint16_t payload_size, coap_reply_t reply_cb);
+
 #endif /* __COAP_UTILS_H__ */
 
 /**
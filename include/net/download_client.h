@@ -189,6 +189,12 @@ struct download_client {
 		bool connection_close;
 		/** Is using ranged query. */
 		bool ranged;
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+		/** The request for the next range has been sent ahead. */
+		bool request_sent;
+		/** Buffer for the request sent ahead, as the response buffer is in use. */
+		char req_buf[CONFIG_DOWNLOAD_CLIENT_HTTP_REQ_BUF_SIZE];
+#endif
 	} http;
 
 	struct {
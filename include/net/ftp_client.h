@@ -370,6 +370,17 @@ int ftp_delete(const char *file);
  */
 int ftp_get(const char *file);
 
+/**@brief Get a file starting from an offset
+ * Resume an interrupted download with the REST command. The data callback
+ * receives the file content starting from the given offset.
+ *
+ * @param file Target file name
+ * @param offset Number of bytes to skip from the start of the file
+ *
+ * @retval ftp_reply_code or negative if error
+ */
+int ftp_get_resume(const char *file, uint32_t offset);
+
 /**@brief Put data to a file
  * If file does not exist, create the file
  *
@@ -64,6 +64,19 @@ typedef void (*mqtt_helper_on_connack_t)(enum mqtt_conn_return_code return_code,
 typedef void (*mqtt_helper_on_disconnect_t)(int result);
 typedef void (*mqtt_helper_on_publish_t)(struct mqtt_helper_buf topic_buf,
 					 struct mqtt_helper_buf payload_buf);
+
+/** @brief Handler invoked for each part of an incoming MQTT PUBLISH payload.
+ *	   The payload is read in parts of up to CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN bytes,
+ *	   so messages larger than the payload buffer can be received.
+ *
+ *  @param topic_buf Topic of the message.
+ *  @param chunk_buf Part of the payload. Only valid for the duration of the call.
+ *  @param offset Offset of the part within the payload.
+ *  @param total_len Total length of the payload.
+ */
+typedef void (*mqtt_helper_on_publish_chunk_t)(struct mqtt_helper_buf topic_buf,
+					       struct mqtt_helper_buf chunk_buf,
+					       size_t offset, size_t total_len);
 typedef void (*mqtt_helper_on_puback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_suback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_pingresp_t)(void);
@@ -75,6 +88,8 @@ struct mqtt_helper_cfg {
 		mqtt_helper_on_connack_t on_connack;
 		mqtt_helper_on_disconnect_t on_disconnect;
 		mqtt_helper_on_publish_t on_publish;
+		/* If set, used instead of on_publish. */
+		mqtt_helper_on_publish_chunk_t on_publish_chunk;
 		mqtt_helper_on_puback_t on_puback;
 		mqtt_helper_on_suback_t on_suback;
 		mqtt_helper_on_pingresp_t on_pingresp;
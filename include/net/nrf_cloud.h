@@ -775,6 +775,50 @@ int nrf_cloud_shadow_device_status_update(const struct nrf_cloud_device_status *
  */
 int nrf_cloud_sensor_data_stream(const struct nrf_cloud_sensor_data *param);
 
+/**
+ * @brief Add sensor data to the batch of device messages.
+ *
+ * The message is encoded straight into the batch buffer. The batch is published on the bulk
+ * topic when the message does not fit in the remaining buffer space, or when
+ * @kconfig{CONFIG_NRF_CLOUD_MQTT_BATCH_MAX_AGE} has passed since the first message was added.
+ * Messages can be added while disconnected; they are kept until the batch is published.
+ *
+ * @param[in] param Sensor data; the data pointed to by param->data.ptr
+ *                  must be a string. The tag value is ignored.
+ *
+ * @retval 0       If successful.
+ * @retval -EINVAL Invalid parameter.
+ * @retval -E2BIG  The message does not fit in an empty batch buffer.
+ * @return A negative value indicates an error, for example from publishing a full batch.
+ */
+int nrf_cloud_batch_sensor_data_add(const struct nrf_cloud_sensor_data *param);
+
+/**
+ * @brief Add an encoded device message to the batch of device messages.
+ *
+ * See @ref nrf_cloud_batch_sensor_data_add.
+ *
+ * @param[in] msg A single device message encoded as a JSON object, for example from
+ *                @ref nrf_cloud_obj_cloud_encode.
+ *
+ * @retval 0       If successful.
+ * @retval -EINVAL Invalid parameter.
+ * @retval -E2BIG  The message does not fit in an empty batch buffer.
+ * @return A negative value indicates an error, for example from publishing a full batch.
+ */
+int nrf_cloud_batch_msg_add(const struct nrf_cloud_data *msg);
+
+/**
+ * @brief Publish the batch of device messages now.
+ *
+ * If publishing fails, the messages are kept in the batch.
+ *
+ * @retval 0       If successful, or if the batch is empty.
+ * @retval -EACCES Cloud connection is not established; wait for @ref NRF_CLOUD_EVT_READY.
+ * @return A negative value indicates an error.
+ */
+int nrf_cloud_batch_flush(void);
+
 /**
  * @brief Send data to nRF Cloud.
  *
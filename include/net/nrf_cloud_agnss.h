@@ -33,6 +33,8 @@ extern "C" {
  *
  * @retval 0       Request sent successfully.
  * @retval -EACCES Cloud connection is not established; wait for @ref NRF_CLOUD_EVT_READY.
+ * @retval -ENODATA Nothing left to request, for example because the ephemerides were
+ *                  filtered out in the filtered ephemerides mode. No message is sent.
  * @return A negative value indicates an error.
  */
 int nrf_cloud_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *request);
@@ -113,6 +113,13 @@ struct nrf_cloud_rest_context {
 
 	/** Error code from nRF Cloud */
 	enum nrf_cloud_error nrf_err;
+
+	/** Internal: token generated by @ref nrf_cloud_rest_session_begin. */
+	char *session_jwt;
+	/** Internal: a session is started with @ref nrf_cloud_rest_session_begin. */
+	bool session_active;
+	/** Internal: keep_alive value before @ref nrf_cloud_rest_session_begin. */
+	bool session_keep_alive;
 };
 
 /** @brief Data required for nRF Cloud location request */
@@ -342,6 +349,39 @@ int nrf_cloud_rest_shadow_device_status_update(struct nrf_cloud_rest_context *co
  */
 int nrf_cloud_rest_disconnect(struct nrf_cloud_rest_context *const rest_ctx);
 
+/**
+ * @brief Start a session of several REST requests on one connection.
+ *	  The connection is kept alive across the API calls made with @p rest_ctx,
+ *	  so that the TLS handshake is only done once. If no JWT is set in
+ *	  @p rest_ctx.auth and CONFIG_NRF_CLOUD_REST_AUTOGEN_JWT is enabled, one JWT is
+ *	  generated for the whole session instead of one for each request.
+ *	  The session must be ended with @ref nrf_cloud_rest_session_end.
+ *
+ * @param[in,out] rest_ctx Context for communicating with nRF Cloud's REST API.
+ *
+ * @retval 0 If successful.
+ *          Otherwise, a (negative) error code is returned:
+ *	    - -EINVAL, if valid context is not given.
+ *	    - -EALREADY, if a session is already started with @p rest_ctx.
+ *	    - -ENOMEM, if the JWT could not be allocated.
+ *	    - Any error returned by @ref nrf_cloud_jwt_generate.
+ */
+int nrf_cloud_rest_session_begin(struct nrf_cloud_rest_context *const rest_ctx);
+
+/**
+ * @brief End a session started with @ref nrf_cloud_rest_session_begin.
+ *	  The connection is closed, the session JWT is freed and the previous
+ *	  keep_alive setting of @p rest_ctx is restored.
+ *
+ * @param[in,out] rest_ctx Context for communicating with nRF Cloud's REST API.
+ *
+ * @retval 0 If successful.
+ *          Otherwise, a (negative) error code is returned:
+ *	    - -EINVAL, if valid context is not given, or no session is started.
+ *	    - -EIO, for any kind of socket-level closure failure.
+ */
+int nrf_cloud_rest_session_end(struct nrf_cloud_rest_context *const rest_ctx);
+
 /**
  * @brief Performs just-in-time provisioning (JITP) with nRF Cloud.
  *
@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <zephyr/types.h>
 #include <nfc/ndef/record_parser.h>
 #include <nfc/ndef/msg.h>
@@ -86,6 +87,59 @@ int nfc_ndef_msg_parse(uint8_t  *result_buf,
 		       const uint8_t *raw_data,
 		       uint32_t *raw_data_len);
 
+/** @brief Iterator over the records of a raw NDEF message.
+ *
+ *  The iterator walks the records in place and does not need memory
+ *  for the descriptors of all records of the message.
+ */
+struct nfc_ndef_msg_iter {
+	/** Pointer to the raw message data. */
+	const uint8_t *data;
+
+	/** Length of the raw message data. */
+	uint32_t data_len;
+
+	/** Offset of the next record in the raw message data. */
+	uint32_t offset;
+
+	/** Number of records returned so far. */
+	uint32_t record_count;
+
+	/** The last record of the message was returned. */
+	bool done;
+};
+
+/** @brief Initialize an iterator over the records of a raw NDEF message.
+ *
+ *  @param[out] iter Pointer to the iterator.
+ *  @param[in] raw_data Pointer to the data to be parsed. The data must stay
+ *                      valid while the iterator and the returned record
+ *                      descriptors are used.
+ *  @param[in] raw_data_len Size of the NFC data in the @p raw_data buffer.
+ */
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter,
+			    const uint8_t *raw_data,
+			    uint32_t raw_data_len);
+
+/** @brief Get the next record of a raw NDEF message.
+ *
+ *  The record descriptor and the binary payload descriptor point into the
+ *  raw message data. The payload is not copied or decoded.
+ *
+ *  @param[in,out] iter Pointer to the iterator.
+ *  @param[out] rec_desc Pointer to the descriptor of the record.
+ *  @param[out] bin_pay_desc Pointer to the binary payload descriptor
+ *                           of the record.
+ *
+ *  @retval 0 If a record was returned.
+ *  @retval -ENOENT If the last record of the message was already returned.
+ *  @retval -EINVAL If the record is malformed or exceeds the data.
+ *  @retval -EFAULT If the record location flags are invalid.
+ */
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_desc *rec_desc,
+			   struct nfc_ndef_bin_payload_desc *bin_pay_desc);
+
 /** @brief Print the parsed contents of an NDEF message.
  *
  *  @param[in] msg_desc Pointer to the descriptor of the message that should
@@ -18,6 +18,7 @@
 #include <zephyr/types.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/byteorder.h>
 
 #ifndef CONFIG_NRF_PROFILER_MAX_NUMBER_OF_APP_EVENTS
 /** Maximum number of events. */
@@ -172,7 +173,13 @@ static inline void nrf_profiler_log_start(struct log_event_buf *buf) {}
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_uint32(struct log_event_buf *buf, uint32_t data);
+static inline void nrf_profiler_log_encode_uint32(struct log_event_buf *buf, uint32_t data)
+{
+	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
+			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
+	sys_put_le32(data, buf->payload);
+	buf->payload += sizeof(data);
+}
 #else
 static inline void nrf_profiler_log_encode_uint32(struct log_event_buf *buf,
 					      uint32_t data) {}
@@ -187,7 +194,10 @@ static inline void nrf_profiler_log_encode_uint32(struct log_event_buf *buf,
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_int32(struct log_event_buf *buf, int32_t data);
+static inline void nrf_profiler_log_encode_int32(struct log_event_buf *buf, int32_t data)
+{
+	nrf_profiler_log_encode_uint32(buf, (uint32_t)data);
+}
 #else
 static inline void nrf_profiler_log_encode_int32(struct log_event_buf *buf,
 					     int32_t data) {}
@@ -202,7 +212,13 @@ static inline void nrf_profiler_log_encode_int32(struct log_event_buf *buf,
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_uint16(struct log_event_buf *buf, uint16_t data);
+static inline void nrf_profiler_log_encode_uint16(struct log_event_buf *buf, uint16_t data)
+{
+	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
+			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
+	sys_put_le16(data, buf->payload);
+	buf->payload += sizeof(data);
+}
 #else
 static inline void nrf_profiler_log_encode_uint16(struct log_event_buf *buf,
 					      uint16_t data) {}
@@ -217,7 +233,10 @@ static inline void nrf_profiler_log_encode_uint16(struct log_event_buf *buf,
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_int16(struct log_event_buf *buf, int16_t data);
+static inline void nrf_profiler_log_encode_int16(struct log_event_buf *buf, int16_t data)
+{
+	nrf_profiler_log_encode_uint16(buf, (uint16_t)data);
+}
 #else
 static inline void nrf_profiler_log_encode_int16(struct log_event_buf *buf,
 					     int16_t data) {}
@@ -232,7 +251,13 @@ static inline void nrf_profiler_log_encode_int16(struct log_event_buf *buf,
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_uint8(struct log_event_buf *buf, uint8_t data);
+static inline void nrf_profiler_log_encode_uint8(struct log_event_buf *buf, uint8_t data)
+{
+	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
+			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
+	*(buf->payload) = data;
+	buf->payload += sizeof(data);
+}
 #else
 static inline void nrf_profiler_log_encode_uint8(struct log_event_buf *buf,
 					     uint8_t data) {}
@@ -247,7 +272,10 @@ static inline void nrf_profiler_log_encode_uint8(struct log_event_buf *buf,
  * @param data Data to add to the buffer.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_encode_int8(struct log_event_buf *buf, int8_t data);
+static inline void nrf_profiler_log_encode_int8(struct log_event_buf *buf, int8_t data)
+{
+	nrf_profiler_log_encode_uint8(buf, (uint8_t)data);
+}
 #else
 static inline void nrf_profiler_log_encode_int8(struct log_event_buf *buf,
 					    int8_t data) {}
@@ -282,8 +310,11 @@ static inline void nrf_profiler_log_encode_string(struct log_event_buf *buf,
  * @param mem_address Memory address to encode.
  */
 #ifdef CONFIG_NRF_PROFILER
-void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
-				  const void *mem_address);
+static inline void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
+						const void *mem_address)
+{
+	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
+}
 #else
 static inline void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 						const void *mem_address) {}
@@ -75,6 +75,44 @@ enum sample_rate_converter_filter {
 #define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE   0
 #endif
 
+/**
+ * The internal input buffer must be able to store two samples in addition to the block size to
+ * meet filter requirements.
+ */
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES                                    \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
+	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
+	(SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
+	(SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
+#else
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE  0
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE 0
+#endif
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Number of phases in the polyphase filter bank used for fractional conversion ratios. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES 32
+
+/** Number of filter taps per phase in the polyphase filter bank. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS 32
+
+/**
+ * Number of samples per channel in the polyphase history buffer. The buffer holds the filter
+ * history followed by one block of de-interleaved input samples.
+ */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE                                               \
+	(SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS - 1 + CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX)
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /** Buffer used for storing input bytes to the sample rate converter */
 struct buf_ctx {
 	uint8_t buf[SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE];
@@ -121,7 +159,42 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+	/* Scratch buffers used when input and output samples must be buffered between process
+	 * calls. Kept in the context to not put a full block of samples on the caller's stack.
+	 */
+	uint8_t internal_input_buf[SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE];
+	uint8_t internal_output_buf[SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE];
+};
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Context for the fractional sample rate conversion */
+struct sample_rate_converter_polyphase_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Number of interleaved channels in the input and output. */
+	uint8_t channels;
+
+	/* Index in the history buffer of the newest input sample used for the next output. */
+	size_t pos;
+
+	/* Position of the next output sample between two input samples, in units of
+	 * 1 / sample_rate_output.
+	 */
+	uint32_t phase_acc;
+
+	/* Filter history followed by de-interleaved input samples, one row per channel. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t history_15[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX]
+			[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t history_31[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX]
+			[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#endif
 };
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 
 /**
  * @brief	Open the sample rate converter for a new context.
@@ -170,6 +243,71 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * @brief	Open the sample rate converter for a fractional conversion ratio.
+ *
+ * @details	Clears the context and configures it for a conversion ratio within 10 %, such
+ *		as between 44.1 kHz and 48 kHz. Only the ratio between the sample rates is used, so
+ *		the rates may be scaled to give a finer ratio, for example for clock drift
+ *		compensation. This must be done before a context is used with a new stream.
+ *
+ * @param[out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ * @param[in]	channels		Number of interleaved channels in the stream.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or unsupported parameters.
+ */
+int sample_rate_converter_polyphase_open(struct sample_rate_converter_polyphase_ctx *ctx,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 uint8_t channels);
+
+/**
+ * @brief	Change the conversion ratio of an open fractional conversion context.
+ *
+ * @details	The filter history and the position of the next output sample are kept, so the
+ *		ratio may be changed between two process calls without a discontinuity in the
+ *		stream. Used to follow a drifting clock.
+ *
+ * @param[in,out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]		sample_rate_input	Sample rate of the input samples.
+ * @param[in]		sample_rate_output	Sample rate of the output samples.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Context not opened or unsupported conversion ratio.
+ */
+int sample_rate_converter_polyphase_ratio_set(struct sample_rate_converter_polyphase_ctx *ctx,
+					      uint32_t sample_rate_input,
+					      uint32_t sample_rate_output);
+
+/**
+ * @brief	Process interleaved input samples and produce output samples with new sample rate.
+ *
+ * @details	All channels are filtered in the same call using a polyphase filter bank. The
+ *		number of output frames follows the ratio between the sample rates and may vary by
+ *		one between calls; for example 441 input frames always give 480 output frames at
+ *		44.1 kHz to 48 kHz. The input is copied into the context before any output is
+ *		written, so @p output may point to the same buffer as @p input if it is large
+ *		enough to hold the result.
+ *
+ * @param[in,out]	ctx		Pointer to the polyphase conversion context.
+ * @param[in]		input		Pointer to interleaved samples to process.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		output		Array that interleaved output will be written.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters or output array too small for the result.
+ */
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase_ctx *ctx,
+					    void const *const input, size_t input_size,
+					    void *const output, size_t output_size,
+					    size_t *output_written);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /**
  * @}
  */
@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/types.h>
+
+#include <modem/at_parser.h>
+#include "at_utils.h"
+
+static inline bool is_line_end(char chr)
+{
+	return is_lfcr(chr) || is_terminated(chr);
+}
+
+static inline const char *spaces_skip(const char *str)
+{
+	while (*str == ' ') {
+		str++;
+	}
+
+	return str;
+}
+
+/* Record the location and type of a parameter in the line */
+static int param_add(struct at_parser *parser, const char *start, const char *end,
+		     enum at_param_type type)
+{
+	size_t offset = start - parser->line;
+	size_t len = end - start;
+
+	if ((parser->count >= ARRAY_SIZE(parser->params)) || (offset > UINT16_MAX) ||
+	    (len > UINT16_MAX)) {
+		return -E2BIG;
+	}
+
+	parser->params[parser->count].offset = offset;
+	parser->params[parser->count].len = len;
+	parser->params[parser->count].type = type;
+	parser->count++;
+
+	return 0;
+}
+
+/* Scan the name of a notification or command. Returns the first character after the name. */
+static const char *name_scan(struct at_parser *parser, const char *str, int *err)
+{
+	const char *start = str;
+
+	if (is_notification(*str)) {
+		str++;
+		while (is_valid_notification_char(*str)) {
+			str++;
+		}
+
+		*err = param_add(parser, start, str, AT_PARAM_TYPE_STRING);
+
+		return (*str == AT_RSP_SEPARATOR) ? str + 1 : str;
+	}
+
+	/* Command, skip "AT" and the command prefix */
+	str += sizeof("AT") - 1;
+	if (!is_line_end(*str)) {
+		str++;
+	}
+
+	while (is_valid_command_char(*str)) {
+		str++;
+	}
+
+	*err = param_add(parser, start, str, AT_PARAM_TYPE_STRING);
+
+	/* Skip the set, read and test command identifiers */
+	if ((*str == AT_CMD_SEPARATOR) && (str[1] == AT_CMD_READ_TEST_IDENTIFIER)) {
+		str += 2;
+	} else if ((*str == AT_CMD_SEPARATOR) || (*str == AT_CMD_READ_TEST_IDENTIFIER)) {
+		str++;
+	}
+
+	return str;
+}
+
+static inline bool is_param_end(char chr)
+{
+	return (chr == AT_PARAM_SEPARATOR) || (chr == ' ') || is_line_end(chr);
+}
+
+/* Scan one parameter. Returns the first character after the parameter, or NULL if malformed. */
+static const char *param_scan(struct at_parser *parser, const char *str, int *err)
+{
+	const char *start = str;
+
+	if (is_number(*str) && (isdigit((int)*str) || isdigit((int)str[1]))) {
+		str++;
+		while (isdigit((int)*str)) {
+			str++;
+		}
+
+		if (is_param_end(*str)) {
+			*err = param_add(parser, start, str, AT_PARAM_TYPE_NUM_INT);
+			return str;
+		}
+
+		/* Not only digits, such as "1.2.3", scanned as an unquoted string below */
+		str = start;
+	}
+
+	if (is_dblquote(*str)) {
+		start = ++str;
+		while (!is_dblquote(*str) && !is_terminated(*str)) {
+			str++;
+		}
+		if (!is_dblquote(*str)) {
+			return NULL;
+		}
+		*err = param_add(parser, start, str, AT_PARAM_TYPE_STRING);
+		return str + 1;
+	}
+
+	if (is_array_start(*str)) {
+		start = ++str;
+		while (!is_array_stop(*str) && !is_line_end(*str)) {
+			str++;
+		}
+		if (!is_array_stop(*str)) {
+			return NULL;
+		}
+		*err = param_add(parser, start, str, AT_PARAM_TYPE_ARRAY);
+		return str + 1;
+	}
+
+	if ((*str == AT_PARAM_SEPARATOR) || is_line_end(*str)) {
+		*err = param_add(parser, start, str, AT_PARAM_TYPE_EMPTY);
+		return str;
+	}
+
+	/* Unquoted string, up to the next separator */
+	while ((*str != AT_PARAM_SEPARATOR) && !is_line_end(*str)) {
+		str++;
+	}
+	*err = param_add(parser, start, str, AT_PARAM_TYPE_STRING);
+
+	return str;
+}
+
+/* Check for SMS PDU data, a line of hexadecimal digits following a numeric parameter */
+static const char *pdu_scan(const char *str)
+{
+	while (isxdigit((int)*str)) {
+		str++;
+	}
+
+	return is_line_end(*str) ? str : NULL;
+}
+
+/*
+ * Scan a line once, recording the location and type of each parameter.
+ * Nothing is decoded here, values are decoded by the getters.
+ */
+static int line_scan(struct at_parser *parser, const char *str)
+{
+	const char *end;
+	int err = 0;
+	int ret;
+
+	while (is_lfcr(*str)) {
+		str++;
+	}
+
+	parser->line = str;
+	parser->next = NULL;
+	parser->count = 0;
+
+	if (is_terminated(*str)) {
+		return -EBADMSG;
+	}
+
+	if (is_notification(*str) || is_command(str)) {
+		bool forced_string = is_forced_string_response(str);
+
+		str = spaces_skip(name_scan(parser, str, &err));
+
+		if (forced_string && !is_line_end(*str)) {
+			/* The parameters are kept as one string */
+			end = str;
+			while (!is_line_end(*end)) {
+				end++;
+			}
+			ret = param_add(parser, str, end, AT_PARAM_TYPE_STRING);
+			err = err ? err : ret;
+			str = end;
+		}
+
+		while (!is_line_end(*str)) {
+			str = param_scan(parser, str, &ret);
+			if (str == NULL) {
+				return -EBADMSG;
+			}
+			err = err ? err : ret;
+
+			str = spaces_skip(str);
+			if (*str == AT_PARAM_SEPARATOR) {
+				str = spaces_skip(str + 1);
+				if (is_line_end(*str)) {
+					/* Trailing empty parameter */
+					ret = param_add(parser, str, str, AT_PARAM_TYPE_EMPTY);
+					err = err ? err : ret;
+				}
+			} else if (!is_line_end(*str)) {
+				return -EBADMSG;
+			}
+		}
+	} else {
+		/* A line without a notification ID is one string parameter */
+		while (!is_line_end(*str)) {
+			str++;
+		}
+		err = param_add(parser, parser->line, str, AT_PARAM_TYPE_STRING);
+	}
+
+	while (is_lfcr(*str)) {
+		str++;
+	}
+
+	if ((parser->count > 0) &&
+	    (parser->params[parser->count - 1].type == AT_PARAM_TYPE_NUM_INT) &&
+	    isxdigit((int)*str) && !is_result(str)) {
+		end = pdu_scan(str);
+		if (end != NULL) {
+			ret = param_add(parser, str, end, AT_PARAM_TYPE_STRING);
+			err = err ? err : ret;
+			str = end;
+			while (is_lfcr(*str)) {
+				str++;
+			}
+		}
+	}
+
+	if (!is_terminated(*str) && !is_result(str)) {
+		parser->next = str;
+	}
+
+	return err;
+}
+
+static const struct at_parser_param *param_get(const struct at_parser *parser, size_t index,
+					       enum at_param_type type)
+{
+	if ((parser == NULL) || (parser->line == NULL) || (index >= parser->count) ||
+	    (parser->params[index].type != type)) {
+		return NULL;
+	}
+
+	return &parser->params[index];
+}
+
+static int num_get(const struct at_parser *parser, size_t index, int64_t min, int64_t max,
+		   int64_t *value)
+{
+	const struct at_parser_param *param = param_get(parser, index, AT_PARAM_TYPE_NUM_INT);
+
+	if ((param == NULL) || (value == NULL)) {
+		return -EINVAL;
+	}
+
+	const char *str = parser->line + param->offset;
+	const char *end = str + param->len;
+	bool negative = (*str == '-');
+	uint64_t limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+	uint64_t acc = 0;
+
+	if ((*str == '-') || (*str == '+')) {
+		str++;
+	}
+
+	for (; str < end; str++) {
+		uint8_t digit = *str - '0';
+
+		if (acc > (limit - digit) / 10) {
+			return -ERANGE;
+		}
+		acc = acc * 10 + digit;
+	}
+
+	int64_t val = negative ? (int64_t)(0 - acc) : (int64_t)acc;
+
+	if ((val < min) || (val > max)) {
+		return -ERANGE;
+	}
+
+	*value = val;
+
+	return 0;
+}
+
+int at_parser_init(struct at_parser *parser, const char *at)
+{
+	if ((parser == NULL) || (at == NULL)) {
+		return -EINVAL;
+	}
+
+	return line_scan(parser, at);
+}
+
+int at_parser_cmd_next(struct at_parser *parser)
+{
+	if ((parser == NULL) || (parser->line == NULL)) {
+		return -EINVAL;
+	}
+
+	if (parser->next == NULL) {
+		return -ENODATA;
+	}
+
+	return line_scan(parser, parser->next);
+}
+
+int at_parser_cmd_count_get(const struct at_parser *parser, size_t *count)
+{
+	if ((parser == NULL) || (parser->line == NULL) || (count == NULL)) {
+		return -EINVAL;
+	}
+
+	*count = parser->count;
+
+	return 0;
+}
+
+enum at_param_type at_parser_type_get(const struct at_parser *parser, size_t index)
+{
+	if ((parser == NULL) || (parser->line == NULL) || (index >= parser->count)) {
+		return AT_PARAM_TYPE_INVALID;
+	}
+
+	return parser->params[index].type;
+}
+
+int at_parser_int64_get(const struct at_parser *parser, size_t index, int64_t *value)
+{
+	return num_get(parser, index, INT64_MIN, INT64_MAX, value);
+}
+
+int at_parser_int_get(const struct at_parser *parser, size_t index, int32_t *value)
+{
+	int64_t val;
+	int err;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	err = num_get(parser, index, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+
+	*value = (int32_t)val;
+
+	return 0;
+}
+
+int at_parser_unsigned_int_get(const struct at_parser *parser, size_t index, uint32_t *value)
+{
+	int64_t val;
+	int err;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	err = num_get(parser, index, 0, UINT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+
+	*value = (uint32_t)val;
+
+	return 0;
+}
+
+int at_parser_short_get(const struct at_parser *parser, size_t index, int16_t *value)
+{
+	int64_t val;
+	int err;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	err = num_get(parser, index, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+
+	*value = (int16_t)val;
+
+	return 0;
+}
+
+int at_parser_unsigned_short_get(const struct at_parser *parser, size_t index, uint16_t *value)
+{
+	int64_t val;
+	int err;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	err = num_get(parser, index, 0, UINT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+
+	*value = (uint16_t)val;
+
+	return 0;
+}
+
+int at_parser_string_ptr_get(const struct at_parser *parser, size_t index, const char **str,
+			     size_t *len)
+{
+	const struct at_parser_param *param = param_get(parser, index, AT_PARAM_TYPE_STRING);
+
+	if ((param == NULL) || (str == NULL) || (len == NULL)) {
+		return -EINVAL;
+	}
+
+	*str = parser->line + param->offset;
+	*len = param->len;
+
+	return 0;
+}
+
+int at_parser_string_get(const struct at_parser *parser, size_t index, char *str, size_t *len)
+{
+	const char *ptr;
+	size_t ptr_len;
+	int err;
+
+	if ((str == NULL) || (len == NULL)) {
+		return -EINVAL;
+	}
+
+	err = at_parser_string_ptr_get(parser, index, &ptr, &ptr_len);
+	if (err) {
+		return err;
+	}
+
+	if (*len < ptr_len) {
+		return -ENOMEM;
+	}
+
+	memcpy(str, ptr, ptr_len);
+	*len = ptr_len;
+
+	return 0;
+}
+
+int at_parser_array_get(const struct at_parser *parser, size_t index, uint32_t *array,
+			size_t *len)
+{
+	const struct at_parser_param *param = param_get(parser, index, AT_PARAM_TYPE_ARRAY);
+
+	if ((param == NULL) || (array == NULL) || (len == NULL)) {
+		return -EINVAL;
+	}
+
+	const char *str = parser->line + param->offset;
+	const char *end = str + param->len;
+	size_t count = 0;
+
+	/* Elements are the runs of decimal digits, anything else separates them */
+	while (str < end) {
+		uint64_t acc = 0;
+
+		if (!isdigit((int)*str)) {
+			str++;
+			continue;
+		}
+
+		while ((str < end) && isdigit((int)*str)) {
+			acc = acc * 10 + (*str++ - '0');
+			if (acc > UINT32_MAX) {
+				return -ERANGE;
+			}
+		}
+
+		if ((count + 1) * sizeof(uint32_t) > *len) {
+			return -ENOMEM;
+		}
+
+		array[count++] = (uint32_t)acc;
+	}
+
+	*len = count * sizeof(uint32_t);
+
+	return 0;
+}
@@ -19,6 +19,8 @@
 #include <zephyr/types.h>
 #include <stddef.h>
 #include <ctype.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
 
 #define AT_PARAM_SEPARATOR ','
 #define AT_RSP_SEPARATOR ':'
@@ -30,6 +32,13 @@
 #define AT_PROP_NOTIFICATION_PREFX '%'
 #define AT_CUSTOM_COMMAND_PREFX '#'
 
+#define AT_CMD_CGEV_LEN         5
+#define AT_CMD_CPIN_LEN         5
+#define AT_CMD_SHORTSWVER_LEN   11
+#define AT_CMD_HWVERSION_LEN    10
+#define AT_CMD_XMODEMUUID_LEN   11
+#define AT_CMD_XICCID_LEN       7
+
 /**
  * @brief Check if character is a notification start character
  *
@@ -273,7 +282,7 @@ static inline bool is_command(const char *str)
  * @retval true  If the string is a CLAC response
  * @retval false Otherwise
  */
-static bool is_clac(const char *str)
+static inline bool is_clac(const char *str)
 {
 	/* skip leading <CR><LF>, if any, as check not from index 0 */
 	while (is_lfcr(*str)) {
@@ -301,6 +310,53 @@ static bool is_clac(const char *str)
 
 	return true;
 }
+/**
+ * @brief Check if a string starts with a final result code
+ *
+ * @param[in] str String to examine
+ *
+ * @retval true  If the string starts with OK, ERROR, +CME ERROR or +CMS ERROR
+ * @retval false Otherwise
+ */
+static inline bool is_result(const char *str)
+{
+	static const char * const toclip[] = {
+		"OK\r\n",
+		"ERROR\r\n",
+		"+CME ERROR",
+		"+CMS ERROR"
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(toclip); i++) {
+		if (!strncmp(str, toclip[i], strlen(toclip[i]))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Check if the parameters of a response must be parsed as one string
+ *
+ * @param[in] str Response, starting with the notification ID
+ *
+ * @retval true  If the parameters of the response are parsed as one string
+ * @retval false Otherwise
+ */
+static inline bool is_forced_string_response(const char *str)
+{
+	if (!strncmp(str, "+CGEV", AT_CMD_CGEV_LEN) ||
+	    !strncmp(str, "+CPIN", AT_CMD_CPIN_LEN) ||
+	    !strncmp(str, "%SHORTSWVER", AT_CMD_SHORTSWVER_LEN) ||
+	    !strncmp(str, "%HWVERSION", AT_CMD_HWVERSION_LEN) ||
+	    !strncmp(str, "%XMODEMUUID", AT_CMD_XMODEMUUID_LEN) ||
+	    !strncmp(str, "%XICCID", AT_CMD_XICCID_LEN)) {
+		return true;
+	}
+
+	return false;
+}
 /** @} */
 
 #endif /* AT_UTILS_H__ */
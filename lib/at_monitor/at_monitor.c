@@ -3,6 +3,8 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <ctype.h>
+#include <errno.h>
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/kernel.h>
@@ -15,9 +17,14 @@
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+/* Number of hash buckets for the filter index, must be a power of two */
+#define FILTER_INDEX_BUCKETS 32
+
 struct at_notif_fifo {
 	void *fifo_reserved;
-	char data[]; /* Null-terminated AT notification string */
+	atomic_t refcnt;
+	bool from_slab; /* Buffer is from the notification slab, not the heap */
+	char data[];	/* Null-terminated AT notification string */
 };
 
 static void at_monitor_task(struct k_work *work);
@@ -26,6 +33,27 @@ static K_FIFO_DEFINE(at_monitor_fifo);
 static K_HEAP_DEFINE(at_monitor_heap, CONFIG_AT_MONITOR_HEAP_SIZE);
 static K_WORK_DEFINE(at_monitor_work, at_monitor_task);
 
+#if defined(CONFIG_AT_MONITOR_NOTIF_SLAB)
+#define NOTIF_SLAB_BLOCK_SIZE                                                                      \
+	WB_UP(sizeof(struct at_notif_fifo) + CONFIG_AT_MONITOR_NOTIF_SLAB_BUF_SIZE)
+
+K_MEM_SLAB_DEFINE_STATIC(at_monitor_slab, NOTIF_SLAB_BLOCK_SIZE,
+			 CONFIG_AT_MONITOR_NOTIF_SLAB_BUF_COUNT, sizeof(void *));
+#endif
+
+static struct {
+	atomic_t notifs;
+	atomic_t dropped;
+	atomic_t heap_fallbacks;
+	atomic_t bufs_in_use;
+	atomic_t bufs_in_use_max;
+} stats;
+
+/* Monitors with a command filter, by hash of the command name */
+static struct at_monitor_entry *filter_index[FILTER_INDEX_BUCKETS];
+/* Monitors that are not indexed and are matched against every notification */
+static struct at_monitor_entry *filter_unindexed;
+
 static bool is_paused(const struct at_monitor_entry *mon)
 {
 	return mon->flags.paused;
@@ -36,9 +64,158 @@ static bool is_direct(const struct at_monitor_entry *mon)
 	return mon->flags.direct;
 }
 
-static bool has_match(const struct at_monitor_entry *mon, const char *notif)
+static bool is_cmd_start(char c)
+{
+	return (c == '+' || c == '%');
+}
+
+/* Length of the command name at the start of a notification or a filter, like "+CEREG" */
+static size_t cmd_len(const char *str)
+{
+	size_t len;
+
+	if (!is_cmd_start(str[0])) {
+		return 0;
+	}
+
+	for (len = 1; isalnum((unsigned char)str[len]) || str[len] == '_'; len++) {
+	}
+
+	return len;
+}
+
+static size_t cmd_hash(const char *cmd, size_t len)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t)cmd[i]) * 16777619u;
+	}
+
+	return hash & (FILTER_INDEX_BUCKETS - 1);
+}
+
+static bool is_indexed(const struct at_monitor_entry *mon)
+{
+	return IS_ENABLED(CONFIG_AT_MONITOR_FILTER_INDEX) && mon->filter != ANY &&
+	       cmd_len(mon->filter) > 1;
+}
+
+/* An indexed monitor matches notifications of the same command that begin with its filter.
+ * Any other monitor matches notifications that contain its filter.
+ */
+static bool has_match(const struct at_monitor_entry *mon, const char *notif, size_t notif_cmd_len)
+{
+	if (mon->filter == ANY) {
+		return true;
+	}
+
+	if (is_indexed(mon)) {
+		return cmd_len(mon->filter) == notif_cmd_len &&
+		       strncmp(notif, mon->filter, strlen(mon->filter)) == 0;
+	}
+
+	return strstr(notif, mon->filter);
+}
+
+/* Get the monitors that can match a notification; the indexed monitors for the command of the
+ * notification, and the monitors that are not indexed.
+ */
+static void candidates_get(const char *notif, size_t *notif_cmd_len,
+			   struct at_monitor_entry *candidates[2])
+{
+	*notif_cmd_len = cmd_len(notif);
+
+	candidates[0] = (*notif_cmd_len > 1) ? filter_index[cmd_hash(notif, *notif_cmd_len)] : NULL;
+	candidates[1] = filter_unindexed;
+}
+
+static void filter_index_build(void)
+{
+	struct at_monitor_entry *index_tail[FILTER_INDEX_BUCKETS] = {NULL};
+	struct at_monitor_entry *unindexed_tail = NULL;
+	struct at_monitor_entry **tail;
+
+	/* Append in section order, so that the monitors of a list are dispatched in definition
+	 * order
+	 */
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		e->next = NULL;
+
+		if (is_indexed(e)) {
+			size_t bucket = cmd_hash(e->filter, cmd_len(e->filter));
+
+			tail = &index_tail[bucket];
+			if (*tail == NULL) {
+				filter_index[bucket] = e;
+			}
+		} else {
+			tail = &unindexed_tail;
+			if (*tail == NULL) {
+				filter_unindexed = e;
+			}
+		}
+
+		if (*tail != NULL) {
+			(*tail)->next = e;
+		}
+		*tail = e;
+	}
+}
+
+static struct at_notif_fifo *notif_buf_alloc(size_t len)
+{
+	struct at_notif_fifo *at_notif = NULL;
+
+#if defined(CONFIG_AT_MONITOR_NOTIF_SLAB)
+	if (len < CONFIG_AT_MONITOR_NOTIF_SLAB_BUF_SIZE) {
+		if (k_mem_slab_alloc(&at_monitor_slab, (void **)&at_notif, K_NO_WAIT) == 0) {
+			at_notif->from_slab = true;
+			return at_notif;
+		}
+	}
+#endif
+
+	at_notif = k_heap_alloc(&at_monitor_heap, sizeof(struct at_notif_fifo) + len + sizeof(char),
+				K_NO_WAIT);
+	if (at_notif) {
+		at_notif->from_slab = false;
+
+		if (IS_ENABLED(CONFIG_AT_MONITOR_NOTIF_SLAB)) {
+			/* Oversized notification, or all slab buffers in use */
+			atomic_inc(&stats.heap_fallbacks);
+		}
+	}
+
+	return at_notif;
+}
+
+static void notif_buf_free(struct at_notif_fifo *at_notif)
+{
+	atomic_dec(&stats.bufs_in_use);
+
+#if defined(CONFIG_AT_MONITOR_NOTIF_SLAB)
+	if (at_notif->from_slab) {
+		k_mem_slab_free(&at_monitor_slab, at_notif);
+		return;
+	}
+#endif
+
+	k_heap_free(&at_monitor_heap, at_notif);
+}
+
+static struct at_notif_fifo *notif_buf_get(const char *notif)
+{
+	return (struct at_notif_fifo *)(notif - offsetof(struct at_notif_fifo, data));
+}
+
+static void notif_buf_unref(struct at_notif_fifo *at_notif)
 {
-	return (mon->filter == ANY || strstr(notif, mon->filter));
+	/* atomic_dec() returns the previous value */
+	if (atomic_dec(&at_notif->refcnt) == 1) {
+		notif_buf_free(at_notif);
+	}
 }
 
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
@@ -49,19 +226,26 @@ void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
 	struct at_notif_fifo *at_notif;
-	size_t sz_needed;
+	struct at_monitor_entry *candidates[2];
+	size_t notif_cmd_len;
+	atomic_val_t in_use;
+	size_t len;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
+	candidates_get(notif, &notif_cmd_len, candidates);
+
 	monitored = false;
-	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
-			if (is_direct(e)) {
-				LOG_DBG("Dispatching to %p (ISR)", e->handler);
-				e->handler(notif);
-			} else {
-				/* Copy and schedule work-queue task */
-				monitored = true;
+	for (size_t i = 0; i < ARRAY_SIZE(candidates); i++) {
+		for (struct at_monitor_entry *e = candidates[i]; e; e = e->next) {
+			if (!is_paused(e) && has_match(e, notif, notif_cmd_len)) {
+				if (is_direct(e)) {
+					LOG_DBG("Dispatching to %p (ISR)", e->handler);
+					e->handler(notif);
+				} else {
+					/* Copy and schedule work-queue task */
+					monitored = true;
+				}
 			}
 		}
 	}
@@ -71,16 +255,25 @@ void at_monitor_dispatch(const char *notif)
 		return;
 	}
 
-	sz_needed = sizeof(struct at_notif_fifo) + strlen(notif) + sizeof(char);
+	len = strlen(notif);
 
-	at_notif = k_heap_alloc(&at_monitor_heap, sz_needed, K_NO_WAIT);
+	at_notif = notif_buf_alloc(len);
 	if (!at_notif) {
+		atomic_inc(&stats.dropped);
 		LOG_WRN("No heap space for incoming notification: %s", notif);
 		__ASSERT(at_notif, "No heap space for incoming notification: %s", notif);
 		return;
 	}
 
-	strcpy(at_notif->data, notif);
+	atomic_inc(&stats.notifs);
+	in_use = atomic_inc(&stats.bufs_in_use) + 1;
+	if (in_use > atomic_get(&stats.bufs_in_use_max)) {
+		atomic_set(&stats.bufs_in_use_max, in_use);
+	}
+
+	/* The notification is copied once, and the copy is shared by all deferred monitors */
+	atomic_set(&at_notif->refcnt, 1);
+	memcpy(at_notif->data, notif, len + sizeof(char));
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
@@ -89,24 +282,63 @@ void at_monitor_dispatch(const char *notif)
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	struct at_monitor_entry *candidates[2];
+	size_t notif_cmd_len;
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		/* Match notification with the monitors that can match it */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
-				LOG_DBG("Dispatching to %p", e->handler);
-				e->handler(at_notif->data);
+		candidates_get(at_notif->data, &notif_cmd_len, candidates);
+		for (size_t i = 0; i < ARRAY_SIZE(candidates); i++) {
+			for (struct at_monitor_entry *e = candidates[i]; e; e = e->next) {
+				if (!is_paused(e) && !is_direct(e) &&
+				    has_match(e, at_notif->data, notif_cmd_len)) {
+					LOG_DBG("Dispatching to %p", e->handler);
+					e->handler(at_notif->data);
+				}
 			}
 		}
-		k_heap_free(&at_monitor_heap, at_notif);
+		notif_buf_unref(at_notif);
+	}
+}
+
+const char *at_monitor_notif_hold(const char *notif)
+{
+	__ASSERT_NO_MSG(notif != NULL);
+
+	atomic_inc(&notif_buf_get(notif)->refcnt);
+
+	return notif;
+}
+
+void at_monitor_notif_release(const char *notif)
+{
+	__ASSERT_NO_MSG(notif != NULL);
+
+	notif_buf_unref(notif_buf_get(notif));
+}
+
+int at_monitor_stats_get(struct at_monitor_stats *monitor_stats)
+{
+	if (monitor_stats == NULL) {
+		return -EINVAL;
 	}
+
+	monitor_stats->notifs = atomic_get(&stats.notifs);
+	monitor_stats->dropped = atomic_get(&stats.dropped);
+	monitor_stats->heap_fallbacks = atomic_get(&stats.heap_fallbacks);
+	monitor_stats->bufs_in_use = atomic_get(&stats.bufs_in_use);
+	monitor_stats->bufs_in_use_max = atomic_get(&stats.bufs_in_use_max);
+
+	return 0;
 }
 
 static int at_monitor_sys_init(void)
 {
 	int err;
 
+	filter_index_build();
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
@@ -27,12 +27,59 @@ int contin_array_create(void *const pcm_cont, uint32_t pcm_cont_size, void const
 		return -EPERM;
 	}
 
-	for (uint32_t i = 0; i < pcm_cont_size; i++) {
-		if (*finite_pos > (pcm_finite_size - 1)) {
+	if (*finite_pos > (pcm_finite_size - 1)) {
+		*finite_pos = 0;
+	}
+
+	/* Copy the largest contiguous run up to the end of the finite array per iteration */
+	for (uint32_t copied = 0; copied < pcm_cont_size;) {
+		uint32_t run = MIN(pcm_cont_size - copied, pcm_finite_size - *finite_pos);
+
+		memcpy((uint8_t *)pcm_cont + copied, (uint8_t const *)pcm_finite + *finite_pos,
+		       run);
+		copied += run;
+		*finite_pos += run;
+
+		if (*finite_pos == pcm_finite_size) {
 			*finite_pos = 0;
 		}
-		((char *)pcm_cont)[i] = ((char *)pcm_finite)[*finite_pos];
-		(*finite_pos)++;
+	}
+
+	return 0;
+}
+
+int contin_array_view(void const *const pcm_finite, uint32_t pcm_finite_size, uint32_t size,
+		      uint32_t *const finite_pos, struct contin_array_span spans[2])
+{
+	if (pcm_finite == NULL || finite_pos == NULL || spans == NULL) {
+		return -ENXIO;
+	}
+
+	if (!size || !pcm_finite_size) {
+		LOG_ERR("size cannot be zero");
+		return -EPERM;
+	}
+
+	if (size > pcm_finite_size) {
+		LOG_ERR("View of %d bytes does not fit in two spans of %d bytes", size,
+			pcm_finite_size);
+		return -EINVAL;
+	}
+
+	if (*finite_pos > (pcm_finite_size - 1)) {
+		*finite_pos = 0;
+	}
+
+	uint32_t run = MIN(size, pcm_finite_size - *finite_pos);
+
+	spans[0].data = (uint8_t const *)pcm_finite + *finite_pos;
+	spans[0].size = run;
+	spans[1].data = pcm_finite;
+	spans[1].size = size - run;
+
+	*finite_pos += size;
+	if (*finite_pos >= pcm_finite_size) {
+		*finite_pos -= pcm_finite_size;
 	}
 
 	return 0;
@@ -5,6 +5,9 @@
  */
 
 #include "data_fifo.h"
+#if CONFIG_DATA_FIFO_SPSC
+#include "data_fifo_spsc.h"
+#endif
 
 #include <zephyr/kernel.h>
 
@@ -48,6 +51,12 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return data_fifo_spsc_pointer_first_vacant_get(data_fifo, data, timeout);
+	}
+#endif
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +75,12 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return data_fifo_spsc_block_lock(data_fifo, data, size);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +106,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return data_fifo_spsc_pointer_last_filled_get(data_fifo, data, size, timeout);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +129,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		data_fifo_spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -117,6 +145,12 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return data_fifo_spsc_num_used_get(data_fifo, alloced_num, locked_num);
+	}
+#endif
+
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
@@ -138,6 +172,12 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return data_fifo_spsc_empty(data_fifo);
+	}
+#endif
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -176,6 +216,18 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		ret = data_fifo_spsc_init(data_fifo);
+		if (ret) {
+			return ret;
+		}
+
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
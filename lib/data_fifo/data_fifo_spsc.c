@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "data_fifo_spsc.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
+
+/* The indexes are free-running counters, so a difference is the number of blocks between them
+ * also after the counters wrap. The atomic accessors order the block accesses with respect to the
+ * index updates.
+ */
+static inline uint32_t idx_get(const atomic_t *idx)
+{
+	return (uint32_t)atomic_get(idx);
+}
+
+static inline void idx_inc(atomic_t *idx)
+{
+	(void)atomic_inc(idx);
+}
+
+static inline uint32_t slot_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return idx % data_fifo->elements_max;
+}
+
+static inline void *block_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + (slot_get(data_fifo, idx) * data_fifo->block_size_max);
+}
+
+static inline struct data_fifo_msgq *msg_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[slot_get(data_fifo, idx)];
+}
+
+static bool vacant_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return (idx_get(&ring->alloc_idx) - idx_get(&ring->free_idx)) < data_fifo->elements_max;
+}
+
+static bool filled_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return idx_get(&ring->lock_idx) != idx_get(&ring->read_idx);
+}
+
+/**
+ * @brief Wait until the other side of the FIFO has made progress.
+ *
+ * The waiting flag is set before the condition is checked again, and the other side checks the
+ * flag after it has updated its index. Hence, at least one of the sides sees the update of the
+ * other and the wakeup cannot be lost.
+ */
+static int wait_for(struct data_fifo *data_fifo, bool (*available)(struct data_fifo *),
+		    atomic_t *waiting, struct k_sem *sem, k_timeout_t timeout, int no_wait_err)
+{
+	int ret;
+
+	while (!available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return no_wait_err;
+		}
+
+		k_sem_reset(sem);
+		atomic_set(waiting, true);
+
+		if (available(data_fifo)) {
+			atomic_set(waiting, false);
+			break;
+		}
+
+		ret = k_sem_take(sem, timeout);
+		atomic_set(waiting, false);
+		if (ret) {
+			return available(data_fifo) ? 0 : ret;
+		}
+	}
+
+	return 0;
+}
+
+static inline void wake(atomic_t *waiting, struct k_sem *sem)
+{
+	if (atomic_cas(waiting, true, false)) {
+		k_sem_give(sem);
+	}
+}
+
+int data_fifo_spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					    k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	int ret;
+
+	/* Same return values as k_mem_slab_alloc */
+	ret = wait_for(data_fifo, vacant_available, &ring->producer_waiting, &ring->space_sem,
+		       timeout, -ENOMEM);
+	if (ret) {
+		return ret;
+	}
+
+	*data = block_get(data_fifo, idx_get(&ring->alloc_idx));
+	idx_inc(&ring->alloc_idx);
+
+	return 0;
+}
+
+int data_fifo_spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t lock_idx = idx_get(&ring->lock_idx);
+
+	if ((lock_idx == idx_get(&ring->alloc_idx)) || (*data != block_get(data_fifo, lock_idx))) {
+		LOG_ERR("Block %p is not the oldest allocated block", *data);
+		return -ESPIPE;
+	}
+
+	struct data_fifo_msgq *msg = msg_get(data_fifo, lock_idx);
+
+	msg->block_ptr = *data;
+	msg->size = size;
+
+	/* Publish the block to the consumer */
+	idx_inc(&ring->lock_idx);
+	wake(&ring->consumer_waiting, &ring->data_sem);
+
+	return 0;
+}
+
+int data_fifo_spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
+					   size_t *size, k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	int ret;
+
+	/* Same return values as k_msgq_get */
+	ret = wait_for(data_fifo, filled_available, &ring->consumer_waiting, &ring->data_sem,
+		       timeout, -ENOMSG);
+	if (ret) {
+		return ret;
+	}
+
+	struct data_fifo_msgq *msg = msg_get(data_fifo, idx_get(&ring->read_idx));
+
+	*data = msg->block_ptr;
+	*size = msg->size;
+	idx_inc(&ring->read_idx);
+
+	return 0;
+}
+
+void data_fifo_spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t free_idx = idx_get(&ring->free_idx);
+
+	if ((free_idx == idx_get(&ring->read_idx)) || (data != block_get(data_fifo, free_idx))) {
+		LOG_ERR("Block %p is not the oldest read block", data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	/* Hand the block back to the producer */
+	idx_inc(&ring->free_idx);
+	wake(&ring->producer_waiting, &ring->space_sem);
+}
+
+int data_fifo_spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+				uint32_t *locked_num)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	/* Read order gives a snapshot where the locked blocks never outnumber the allocated
+	 * ones, since every index is only ever incremented and alloc >= lock >= read >= free.
+	 */
+	uint32_t free_idx = idx_get(&ring->free_idx);
+	uint32_t read_idx = idx_get(&ring->read_idx);
+	uint32_t lock_idx = idx_get(&ring->lock_idx);
+	uint32_t alloc_idx = idx_get(&ring->alloc_idx);
+
+	*alloced_num = alloc_idx - free_idx;
+	*locked_num = lock_idx - read_idx;
+
+	if ((*locked_num > *alloced_num) || (*alloced_num > data_fifo->elements_max)) {
+		LOG_ERR("Num locked %d cannot be larger than alloced %d", *locked_num,
+			*alloced_num);
+		*alloced_num = UINT32_MAX;
+		*locked_num = UINT32_MAX;
+		return -EACCES;
+	}
+
+	return 0;
+}
+
+int data_fifo_spsc_empty(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	/* Both sides must be stopped, as for the slab re-init of the default FIFO */
+	atomic_set(&ring->alloc_idx, 0);
+	atomic_set(&ring->lock_idx, 0);
+	atomic_set(&ring->read_idx, 0);
+	atomic_set(&ring->free_idx, 0);
+
+	return 0;
+}
+
+int data_fifo_spsc_init(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	int ret;
+
+	(void)data_fifo_spsc_empty(data_fifo);
+	atomic_set(&ring->producer_waiting, false);
+	atomic_set(&ring->consumer_waiting, false);
+
+	ret = k_sem_init(&ring->space_sem, 0, 1);
+	if (ret) {
+		return ret;
+	}
+
+	return k_sem_init(&ring->data_sem, 0, 1);
+}
@@ -8,6 +8,8 @@
 #include <zephyr/net/sntp.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/socketutils.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/random/random.h>
 #if defined(CONFIG_LTE_LINK_CONTROL)
 #include <modem/lte_lc.h>
 #endif
@@ -26,8 +28,22 @@ static const char * const servers[] = {
 	GOOGLE_NTP
 };
 
+#if defined(CONFIG_DATE_TIME_NTP_PARALLEL)
+#define NTP_PACKET_SIZE		48
+/* Leap indicator 0, version 4, mode 3 (client) */
+#define NTP_LI_VN_MODE_CLIENT	0x23
+#define NTP_MODE_MASK		0x07
+#define NTP_MODE_SERVER		4
+#define NTP_STRATUM_OFFSET	1
+#define NTP_ORIG_TS_OFFSET	24
+#define NTP_TX_TS_OFFSET	40
+/* Seconds between the NTP epoch (1900) and the Unix epoch (1970) */
+#define NTP_UNIX_EPOCH_OFFSET	2208988800ULL
+#else
 static struct sntp_time sntp_time;
+#endif
 
+#if !defined(CONFIG_DATE_TIME_NTP_PARALLEL)
 static int sntp_time_request(const char *server, uint32_t timeout, struct sntp_time *time)
 {
 	int err;
@@ -63,6 +79,150 @@ socket_close:
 
 	return err;
 }
+#else
+static int ntp_request_send(const char *server, const uint8_t *req)
+{
+	int err;
+	int sock;
+	struct zsock_addrinfo *addrinfo;
+
+	struct zsock_addrinfo hints = {
+		.ai_flags = AI_NUMERICSERV,
+		.ai_family = AF_UNSPEC, /* Allow both IPv4 and IPv6 addresses */
+		.ai_socktype = SOCK_DGRAM
+	};
+
+	err = zsock_getaddrinfo(server, STRINGIFY(NTP_PORT), &hints, &addrinfo);
+	if (err) {
+		LOG_WRN("getaddrinfo, error: %d", err);
+		return -EHOSTUNREACH;
+	}
+
+	sock = zsock_socket(addrinfo->ai_family, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		LOG_WRN("socket, error: %d", errno);
+		err = -errno;
+		goto exit;
+	}
+
+	err = zsock_connect(sock, addrinfo->ai_addr, addrinfo->ai_addrlen);
+	if (err) {
+		LOG_WRN("connect, error: %d", errno);
+		err = -errno;
+		goto socket_close;
+	}
+
+	if (zsock_send(sock, req, NTP_PACKET_SIZE, 0) != NTP_PACKET_SIZE) {
+		LOG_WRN("send, error: %d", errno);
+		err = -errno;
+		goto socket_close;
+	}
+
+	zsock_freeaddrinfo(addrinfo);
+
+	return sock;
+
+socket_close:
+	zsock_close(sock);
+exit:
+	zsock_freeaddrinfo(addrinfo);
+
+	return err;
+}
+
+static int ntp_response_parse(const uint8_t *rsp, const uint8_t *req, int64_t *date_time_ms)
+{
+	uint64_t seconds;
+	uint32_t fraction;
+
+	if ((rsp[0] & NTP_MODE_MASK) != NTP_MODE_SERVER || rsp[NTP_STRATUM_OFFSET] == 0) {
+		return -EINVAL;
+	}
+
+	/* The server echoes the transmit timestamp of the request as the originate timestamp */
+	if (memcmp(&rsp[NTP_ORIG_TS_OFFSET], &req[NTP_TX_TS_OFFSET], 8) != 0) {
+		return -EINVAL;
+	}
+
+	seconds = sys_get_be32(&rsp[NTP_TX_TS_OFFSET]);
+	fraction = sys_get_be32(&rsp[NTP_TX_TS_OFFSET + 4]);
+	if (seconds < NTP_UNIX_EPOCH_OFFSET) {
+		return -EINVAL;
+	}
+
+	*date_time_ms = (int64_t)(seconds - NTP_UNIX_EPOCH_OFFSET) * MSEC_PER_SEC +
+			(int64_t)(((uint64_t)fraction * MSEC_PER_SEC) >> 32);
+
+	return 0;
+}
+
+/* Query all servers at once and use the first valid response */
+static int ntp_parallel_get(int64_t *date_time_ms)
+{
+	struct zsock_pollfd fds[ARRAY_SIZE(servers)];
+	uint8_t req[NTP_PACKET_SIZE] = { NTP_LI_VN_MODE_CLIENT };
+	uint8_t rsp[NTP_PACKET_SIZE];
+	int64_t deadline;
+	int64_t remaining;
+	int nfds = 0;
+	int err = -ENODATA;
+	int ret;
+
+	/* Random transmit timestamp to match the responses to this request */
+	sys_put_be32(sys_rand32_get(), &req[NTP_TX_TS_OFFSET]);
+	sys_put_be32(sys_rand32_get(), &req[NTP_TX_TS_OFFSET + 4]);
+
+	for (int i = 0; i < ARRAY_SIZE(servers); i++) {
+		ret = ntp_request_send(servers[i], req);
+		if (ret < 0) {
+			LOG_DBG("Did not query NTP server %s, error %d", servers[i], ret);
+			continue;
+		}
+
+		fds[nfds].fd = ret;
+		fds[nfds].events = ZSOCK_POLLIN;
+		nfds++;
+	}
+
+	if (nfds == 0) {
+		return -ENODATA;
+	}
+
+	deadline = k_uptime_get() + MSEC_PER_SEC * CONFIG_DATE_TIME_NTP_QUERY_TIME_SECONDS;
+
+	while (err && (remaining = deadline - k_uptime_get()) > 0) {
+		ret = zsock_poll(fds, nfds, (int)remaining);
+		if (ret <= 0) {
+			break;
+		}
+
+		for (int i = 0; i < nfds; i++) {
+			if (fds[i].revents == 0) {
+				continue;
+			}
+
+			if ((fds[i].revents & ZSOCK_POLLIN) &&
+			    zsock_recv(fds[i].fd, rsp, sizeof(rsp), 0) == sizeof(rsp) &&
+			    ntp_response_parse(rsp, req, date_time_ms) == 0) {
+				err = 0;
+				break;
+			}
+
+			/* Erroneous or invalid response, stop polling this server */
+			zsock_close(fds[i].fd);
+			fds[i].fd = -1;
+		}
+	}
+
+	for (int i = 0; i < nfds; i++) {
+		if (fds[i].fd >= 0) {
+			zsock_close(fds[i].fd);
+		}
+	}
+
+	return err;
+}
+#endif /* !defined(CONFIG_DATE_TIME_NTP_PARALLEL) */
 
 #if defined(CONFIG_LTE_LINK_CONTROL)
 static bool is_connected_to_lte(void)
@@ -98,6 +258,13 @@ int date_time_ntp_get(int64_t *date_time_ms)
 	LOG_DBG("Connected to LTE, performing NTP UTC time update");
 #endif
 
+#if defined(CONFIG_DATE_TIME_NTP_PARALLEL)
+	err = ntp_parallel_get(date_time_ms);
+	if (err == 0) {
+		LOG_DBG("Time obtained from NTP");
+		return 0;
+	}
+#else
 	for (int i = 0; i < ARRAY_SIZE(servers); i++) {
 		err =  sntp_time_request(servers[i],
 			MSEC_PER_SEC * CONFIG_DATE_TIME_NTP_QUERY_TIME_SECONDS,
@@ -110,6 +277,7 @@ int date_time_ntp_get(int64_t *date_time_ms)
 		*date_time_ms = (int64_t)sntp_time.seconds * 1000;
 		return 0;
 	}
+#endif
 
 	LOG_WRN("Did not get time from any NTP server");
 
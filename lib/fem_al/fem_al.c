@@ -6,6 +6,7 @@
 
 
 #include <errno.h>
+#include <stdlib.h>
 
 #include <hal/nrf_radio.h>
 #include <hal/nrf_timer.h>
@@ -13,6 +14,7 @@
 #include <nrf_erratas.h>
 
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
 
 #include <mpsl_fem_config_common.h>
 #include <mpsl_fem_protocol_api.h>
@@ -285,6 +287,35 @@ int8_t fem_tx_output_power_check(int8_t power, uint16_t freq_mhz, bool tx_power_
 	return mpsl_fem_tx_power_split(power, &power_split, freq_mhz, tx_power_ceiling);
 }
 
+void fem_tx_power_policy_init(struct fem_tx_power_policy *policy, int8_t rssi_target,
+			      uint8_t hysteresis_db, int8_t initial_power)
+{
+	policy->rssi_target = rssi_target;
+	policy->hysteresis_db = hysteresis_db;
+	policy->power = initial_power;
+}
+
+int8_t fem_tx_power_policy_update(struct fem_tx_power_policy *policy, int8_t rssi,
+				  uint16_t freq_mhz)
+{
+	int16_t error = (int16_t)rssi - policy->rssi_target;
+	int16_t power;
+
+	if (abs(error) <= policy->hysteresis_db) {
+		return policy->power;
+	}
+
+	if (error < 0) {
+		power = CLAMP(policy->power - error, INT8_MIN, INT8_MAX);
+		policy->power = fem_tx_output_power_check(power, freq_mhz, true);
+	} else {
+		power = policy->power - DIV_ROUND_UP(error, 2);
+		policy->power = fem_tx_output_power_check(MAX(power, INT8_MIN), freq_mhz, false);
+	}
+
+	return policy->power;
+}
+
 uint32_t fem_default_tx_gain_get(void)
 {
 	if (fem_api->tx_default_gain_get) {
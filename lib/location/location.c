@@ -150,6 +150,7 @@ int location_request(const struct location_config *config)
 			default_config.interval = config->interval;
 			default_config.timeout = config->timeout;
 			default_config.mode = config->mode;
+			default_config.accuracy_target = config->accuracy_target;
 		} else {
 			LOG_DBG("No configuration given. Using default configuration.");
 		}
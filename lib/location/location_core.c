@@ -307,6 +307,9 @@ void location_core_config_log(const struct location_config *config)
 	LOG_DBG("  Interval: %d", config->interval);
 	LOG_DBG("  Timeout: %dms", config->timeout);
 	LOG_DBG("  Mode: %d", config->mode);
+	if (config->mode == LOCATION_REQ_MODE_RACE) {
+		LOG_DBG("  Accuracy target: %dm", config->accuracy_target);
+	}
 	LOG_DBG("  List of methods:");
 
 	for (uint8_t i = 0; i < config->methods_count; i++) {
@@ -366,6 +369,7 @@ static int location_core_location_get_pos(void)
 	loc_req_info.timeout_uptime = (loc_req_info.config.timeout != SYS_FOREVER_MS) ?
 		k_uptime_get() + loc_req_info.config.timeout : SYS_FOREVER_MS;
 	loc_req_info.execute_fallback = true;
+	loc_req_info.best_event_data_valid = false;
 	loc_req_info.current_method_index = 0;
 	requested_method = loc_req_info.methods[loc_req_info.current_method_index];
 	LOG_DBG("Requesting location with '%s' method",
@@ -423,9 +427,13 @@ static void location_request_info_create(const struct location_config *config)
 	}
 
 	/* Wi-Fi and cellular are not combined if LOCATION_REQ_MODE_ALL is used */
-	if (loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
-		/* Wi-Fi and cellular are combined if they are one after the other in method list */
-		if (abs(method_wifi_index - method_cellular_index) == 1) {
+	if (loc_req_info.config.mode != LOCATION_REQ_MODE_ALL) {
+		/* Wi-Fi and cellular are combined if they are one after the other in method list,
+		 * or anywhere in the list in race mode, to scan both at the same time.
+		 */
+		if (abs(method_wifi_index - method_cellular_index) == 1 ||
+		    (loc_req_info.config.mode == LOCATION_REQ_MODE_RACE &&
+		     loc_req_info.cellular != NULL && loc_req_info.wifi != NULL)) {
 			__ASSERT_NO_MSG(loc_req_info.cellular != NULL);
 			__ASSERT_NO_MSG(loc_req_info.wifi != NULL);
 
@@ -625,6 +633,77 @@ static void location_core_event_details_get(struct location_event_data *event)
 #endif
 }
 
+/* Whether the location of the current event ends a request in LOCATION_REQ_MODE_RACE mode. */
+static bool location_core_accuracy_target_met(void)
+{
+	return loc_req_info.config.accuracy_target == 0 ||
+	       loc_req_info.current_event_data.location.accuracy <=
+		       loc_req_info.config.accuracy_target;
+}
+
+/* Keep the location of the current event if it is the most accurate so far. */
+static void location_core_best_location_store(void)
+{
+	if (!loc_req_info.best_event_data_valid ||
+	    loc_req_info.current_event_data.location.accuracy <
+		    loc_req_info.best_event_data.location.accuracy) {
+		loc_req_info.best_event_data = loc_req_info.current_event_data;
+		loc_req_info.best_event_data_valid = true;
+	}
+}
+
+/* Replace the result of the request with the most accurate location, if it is better. */
+static void location_core_best_location_select(void)
+{
+	if (!loc_req_info.best_event_data_valid) {
+		return;
+	}
+
+	if (loc_req_info.current_event_data.id != LOCATION_EVT_LOCATION ||
+	    loc_req_info.best_event_data.location.accuracy <
+		    loc_req_info.current_event_data.location.accuracy) {
+		LOG_INF("Using the most accurate location, acquired with '%s'",
+			(char *)location_method_api_get(
+				loc_req_info.best_event_data.method)->method_string);
+		loc_req_info.current_event_data = loc_req_info.best_event_data;
+	}
+}
+
+/* Start the next method after the current one did not give a location, or the location did
+ * not meet the accuracy target.
+ */
+static void location_core_fallback(enum location_method requested_method)
+{
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_ALL) {
+		/* In ALL mode, events are sent for all methods and thus
+		 * also for failure events
+		 */
+		location_utils_event_dispatch(&loc_req_info.current_event_data);
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	} else {
+		/* Details had been set into the error or location information */
+		struct location_data_details *details =
+			(loc_req_info.current_event_data.id == LOCATION_EVT_LOCATION) ?
+				&loc_req_info.current_event_data.location.details :
+				&loc_req_info.current_event_data.error.details;
+
+		struct location_event_data fallback = {
+			.id = LOCATION_EVT_FALLBACK,
+			.method = loc_req_info.current_method,
+			.fallback = {
+				.next_method = requested_method,
+				.cause = loc_req_info.current_event_data.id,
+				.details = *details,
+			}
+		};
+		location_utils_event_dispatch(&fallback);
+#endif
+	}
+
+	location_core_current_event_data_init(requested_method);
+	(void)location_method_api_get(requested_method)->location_get(&loc_req_info);
+}
+
 static void location_core_event_cb_fn(struct k_work *work)
 {
 	char latitude_str[12];
@@ -670,6 +749,29 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 		LOG_DBG("  Google maps URL: https://maps.google.com/?q=%s,%s",
 			latitude_str, longitude_str);
+		if (loc_req_info.config.mode == LOCATION_REQ_MODE_RACE &&
+		    !location_core_accuracy_target_met()) {
+			location_core_best_location_store();
+
+			/* Get possible next method */
+			loc_req_info.current_method_index++;
+			if (loc_req_info.current_method_index < loc_req_info.methods_count) {
+				requested_method =
+					loc_req_info.methods[loc_req_info.current_method_index];
+				LOG_INF("LOCATION_REQ_MODE_RACE: accuracy %s m using '%s' does not "
+					"meet the target, trying with '%s' next",
+					accuracy_str,
+					(char *)location_method_api_get(
+						loc_req_info.current_method)->method_string,
+					(char *)location_method_api_get(
+						requested_method)->method_string);
+
+				location_core_fallback(requested_method);
+				return;
+			}
+			LOG_INF("LOCATION_REQ_MODE_RACE: no location met the accuracy target");
+		}
+
 		if (loc_req_info.config.mode == LOCATION_REQ_MODE_ALL) {
 			/* Get possible next method */
 			loc_req_info.current_method_index++;
@@ -711,33 +813,7 @@ static void location_core_event_cb_fn(struct k_work *work)
 					loc_req_info.current_method)->method_string,
 				(char *)location_method_api_get(requested_method)->method_string);
 
-			if (loc_req_info.config.mode == LOCATION_REQ_MODE_ALL) {
-				/* In ALL mode, events are sent for all methods and thus
-				 * also for failure events
-				 */
-				location_utils_event_dispatch(&loc_req_info.current_event_data);
-#if defined(CONFIG_LOCATION_DATA_DETAILS)
-			} else {
-				/* Details had been set into the error information */
-				struct location_data_details *details =
-					&loc_req_info.current_event_data.error.details;
-
-				struct location_event_data fallback = {
-					.id = LOCATION_EVT_FALLBACK,
-					.method = loc_req_info.current_method,
-					.fallback = {
-						.next_method = requested_method,
-						.cause = loc_req_info.current_event_data.id,
-						.details = *details,
-					}
-				};
-				location_utils_event_dispatch(&fallback);
-#endif
-			}
-
-			location_core_current_event_data_init(requested_method);
-			err = location_method_api_get(requested_method)->location_get(
-				&loc_req_info);
+			location_core_fallback(requested_method);
 			return;
 		}
 		if (loc_req_info.current_event_data.id != LOCATION_EVT_RESULT_UNKNOWN) {
@@ -747,6 +823,10 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 	}
 
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_RACE) {
+		location_core_best_location_select();
+	}
+
 	location_utils_event_dispatch(&loc_req_info.current_event_data);
 
 	k_work_cancel_delayable(&location_core_timeout_work);
@@ -26,6 +26,15 @@ struct location_request_info {
 	/** Event data for currently ongoing location request. */
 	struct location_event_data current_event_data;
 
+	/**
+	 * Most accurate location so far that did not meet the accuracy target in
+	 * LOCATION_REQ_MODE_RACE mode.
+	 */
+	struct location_event_data best_event_data;
+
+	/** Whether best_event_data holds a location. */
+	bool best_event_data_valid;
+
 	/** Location method of the currently used method. */
 	int current_method;
 
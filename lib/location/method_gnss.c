@@ -149,6 +149,30 @@ static void method_gnss_pgps_ext_work_fn(struct k_work *item);
 static int insuf_timewin_count;
 static int fixes_remaining;
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+/* Minimum number of satellites with valid ephemerides or almanacs for a hot or warm start */
+#define PREDICTOR_SV_MIN_COUNT 4
+#define PREDICTOR_HISTORY_LEN CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_HISTORY
+
+enum method_gnss_start_strategy {
+	METHOD_GNSS_START_HOT,
+	METHOD_GNSS_START_WARM,
+	METHOD_GNSS_START_COLD,
+};
+
+/* Uptime of the last fix, zero if there has not been a fix yet. */
+static int64_t predictor_last_fix_timestamp;
+/* Number of satellites tracked at the previous fixes. */
+static uint8_t predictor_sat_history[PREDICTOR_HISTORY_LEN];
+static uint8_t predictor_sat_history_count;
+static uint8_t predictor_sat_history_idx;
+/* Set when GNSS timed out, the next start is then predicted to be one step slower. */
+static bool predictor_timed_out;
+/* GNSS execution time (ms) of the early-abort check, zero if the check is not done. */
+static uint32_t predictor_abort_time;
+static uint8_t predictor_abort_sat_limit;
+#endif
+
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 static struct location_data_details_gnss location_data_details_gnss;
 static int64_t elapsed_time_gnss_start_timestamp;
@@ -691,6 +715,10 @@ int method_gnss_timeout(void)
 		LOG_WRN("GNSS timed out possibly due to too short GNSS time windows");
 	}
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+	predictor_timed_out = true;
+#endif
+
 	return method_gnss_cancel();
 }
 
@@ -839,6 +867,120 @@ static uint8_t method_gnss_tracked_satellites_nonzero_cn0(
 	return tracked;
 }
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+static const char *method_gnss_start_strategy_str(enum method_gnss_start_strategy strategy)
+{
+	switch (strategy) {
+	case METHOD_GNSS_START_HOT:
+		return "hot";
+	case METHOD_GNSS_START_WARM:
+		return "warm";
+	default:
+		return "cold";
+	}
+}
+
+/* Predicts the start strategy and returns the GNSS time budget (ms) for the request.
+ *
+ * A hot start needs valid ephemerides and a position, either from assistance or from a recent
+ * fix. A warm start needs valid almanacs or ephemerides. If GNSS does not report expiry times,
+ * only the age of the last fix is used. A timeout in the previous request makes the next start
+ * one step slower, because the predicted data evidently did not help.
+ */
+static int32_t method_gnss_predictor_run(int32_t timeout)
+{
+	struct nrf_modem_gnss_agnss_expiry agnss_expiry;
+	enum method_gnss_start_strategy strategy = METHOD_GNSS_START_COLD;
+	int64_t fix_age = -1;
+	uint8_t valid_ephes = 0;
+	uint8_t valid_alms = 0;
+	int32_t budget = timeout;
+	uint32_t sat_sum = 0;
+
+	if (predictor_last_fix_timestamp != 0) {
+		fix_age = (k_uptime_get() - predictor_last_fix_timestamp) / MSEC_PER_SEC;
+	}
+
+	if (nrf_modem_gnss_agnss_expiry_get(&agnss_expiry) == 0) {
+		for (int i = 0; i < agnss_expiry.sv_count; i++) {
+			if (agnss_expiry.sv[i].system_id != NRF_MODEM_GNSS_SYSTEM_GPS) {
+				continue;
+			}
+			if (agnss_expiry.sv[i].ephe_expiry > 0) {
+				valid_ephes++;
+			}
+			if (agnss_expiry.sv[i].alm_expiry > 0) {
+				valid_alms++;
+			}
+		}
+
+		if (valid_ephes >= PREDICTOR_SV_MIN_COUNT &&
+		    (agnss_expiry.position_expiry > 0 ||
+		     (fix_age >= 0 &&
+		      fix_age < CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_HOT_FIX_AGE))) {
+			strategy = METHOD_GNSS_START_HOT;
+		} else if (valid_ephes >= PREDICTOR_SV_MIN_COUNT ||
+			   valid_alms >= PREDICTOR_SV_MIN_COUNT) {
+			strategy = METHOD_GNSS_START_WARM;
+		}
+	} else if (fix_age >= 0) {
+		if (fix_age < CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_HOT_FIX_AGE) {
+			strategy = METHOD_GNSS_START_HOT;
+		} else if (fix_age < CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_WARM_FIX_AGE) {
+			strategy = METHOD_GNSS_START_WARM;
+		}
+	}
+
+	if (predictor_timed_out && strategy != METHOD_GNSS_START_COLD) {
+		strategy++;
+	}
+	predictor_timed_out = false;
+
+	if (strategy == METHOD_GNSS_START_HOT) {
+		budget = CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_HOT_TIMEOUT * MSEC_PER_SEC;
+	} else if (strategy == METHOD_GNSS_START_WARM) {
+		budget = CONFIG_LOCATION_METHOD_GNSS_PREDICTOR_WARM_TIMEOUT * MSEC_PER_SEC;
+	}
+
+	if (timeout != SYS_FOREVER_MS && timeout > 0) {
+		budget = MIN(budget, timeout);
+	}
+
+	/* With a hot or warm start, GNSS should track about as many satellites as in the previous
+	 * fixes by the halfway point of the time budget. Acquisition in a cold start is too slow
+	 * for the check to be meaningful.
+	 */
+	predictor_abort_time = 0;
+	if (strategy != METHOD_GNSS_START_COLD && predictor_sat_history_count > 0) {
+		for (int i = 0; i < predictor_sat_history_count; i++) {
+			sat_sum += predictor_sat_history[i];
+		}
+
+		predictor_abort_time = budget / 2;
+		predictor_abort_sat_limit = MAX(sat_sum / predictor_sat_history_count / 2,
+						VISIBILITY_DETECTION_SAT_LIMIT);
+	}
+
+	LOG_DBG("Predicted %s start, ephemerides: %d, almanacs: %d, last fix: %d s ago, "
+		"time budget: %d ms",
+		method_gnss_start_strategy_str(strategy), valid_ephes, valid_alms, (int)fix_age,
+		budget);
+
+	return budget;
+}
+
+static void method_gnss_predictor_fix_store(uint8_t satellites_tracked)
+{
+	predictor_last_fix_timestamp = k_uptime_get();
+
+	predictor_sat_history[predictor_sat_history_idx] = satellites_tracked;
+	predictor_sat_history_idx = (predictor_sat_history_idx + 1) % PREDICTOR_HISTORY_LEN;
+	if (predictor_sat_history_count < PREDICTOR_HISTORY_LEN) {
+		predictor_sat_history_count++;
+	}
+}
+#endif /* CONFIG_LOCATION_METHOD_GNSS_PREDICTOR */
+
 static void method_gnss_print_pvt(const struct nrf_modem_gnss_pvt_data_frame *pvt_data)
 {
 	LOG_DBG("Tracked satellites: %d, fix valid: %s, insuf. time window: %s, "
@@ -900,6 +1042,13 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 	if (pvt_data.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID) {
 		fixes_remaining--;
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+		predictor_abort_time = 0;
+		if (fixes_remaining <= 0) {
+			method_gnss_predictor_fix_store(satellites_tracked_nonzero_cn0);
+		}
+#endif
+
 		location_result.latitude = pvt_data.latitude;
 		location_result.longitude = pvt_data.longitude;
 		location_result.accuracy = pvt_data.accuracy;
@@ -927,6 +1076,19 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 		}
 	}
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+	if (running && predictor_abort_time != 0 &&
+	    pvt_data.execution_time >= predictor_abort_time) {
+		predictor_abort_time = 0;
+		if (satellites_tracked_nonzero_cn0 < predictor_abort_sat_limit) {
+			LOG_DBG("GNSS tracking %d satellites, expected at least %d, canceling",
+				satellites_tracked_nonzero_cn0, predictor_abort_sat_limit);
+			method_gnss_cancel();
+			location_core_event_cb_error();
+		}
+	}
+#endif
+
 	/* Trigger GNSS priority mode if GNSS indicates that it is not getting long enough time
 	 * windows for 5 consecutive epochs. If the priority mode option is not enabled, a trace
 	 * is output in case of a timeout to warn that GNSS may be getting too short time windows
@@ -1241,6 +1403,12 @@ static void method_gnss_start_work_fn(struct k_work *work)
 		return;
 	}
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS_PREDICTOR)
+	int32_t timeout = method_gnss_predictor_run(gnss_config.timeout);
+#else
+	int32_t timeout = gnss_config.timeout;
+#endif
+
 	err = nrf_modem_gnss_start();
 	if (err) {
 		LOG_ERR("Failed to start GNSS, error: %d", err);
@@ -1252,7 +1420,7 @@ static void method_gnss_start_work_fn(struct k_work *work)
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 	elapsed_time_gnss_start_timestamp = k_uptime_get();
 #endif
-	location_core_timer_start(gnss_config.timeout);
+	location_core_timer_start(timeout);
 }
 
 int method_gnss_location_get(const struct location_request_info *request)
@@ -139,6 +139,36 @@ void scan_cellular_lte_ind_handler(const struct lte_lc_evt *const evt)
 	}
 }
 
+#if CONFIG_LOCATION_METHOD_CELLULAR_NCELLMEAS_MAX_AGE > 0
+/**
+ * Use the latest neighbor cell measurement made by LTE link control, if it is recent enough
+ * and has the current cell. GCI cells are left out, as they are searched separately.
+ */
+static bool scan_cellular_last_measurement_get(void)
+{
+	struct lte_lc_cells_info last = {
+		.neighbor_cells = neighbor_cells,
+	};
+	int64_t age_ms;
+	int err;
+
+	err = lte_lc_neighbor_cell_measurement_last_get(&last, ARRAY_SIZE(neighbor_cells), 0,
+							&age_ms);
+	if ((err && err != -E2BIG) ||
+	    age_ms > CONFIG_LOCATION_METHOD_CELLULAR_NCELLMEAS_MAX_AGE * MSEC_PER_SEC ||
+	    last.current_cell.id == LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		return false;
+	}
+
+	LOG_DBG("Using neighbor cell measurement made %lld ms ago", age_ms);
+
+	scan_cellular_info.current_cell = last.current_cell;
+	scan_cellular_info.ncells_count = last.ncells_count;
+
+	return true;
+}
+#endif
+
 void scan_cellular_execute(int32_t timeout, uint8_t cell_count)
 {
 	struct lte_lc_ncellmeas_params ncellmeas_params = {
@@ -165,6 +195,11 @@ void scan_cellular_execute(int32_t timeout, uint8_t cell_count)
 	 * 1st: Normal neighbor search to get current cell.
 	 *      In addition neighbor cells are received.
 	 */
+#if CONFIG_LOCATION_METHOD_CELLULAR_NCELLMEAS_MAX_AGE > 0
+	if (scan_cellular_last_measurement_get()) {
+		goto gci_search;
+	}
+#endif
 	LOG_DBG("Normal neighbor search (NCELLMEAS=1)");
 	err = lte_lc_neighbor_cell_measurement(&ncellmeas_params);
 	if (err) {
@@ -183,6 +218,10 @@ void scan_cellular_execute(int32_t timeout, uint8_t cell_count)
 		goto end;
 	}
 
+#if CONFIG_LOCATION_METHOD_CELLULAR_NCELLMEAS_MAX_AGE > 0
+gci_search:
+#endif
+
 	/* If no more than 1 cell is requested, don't perform GCI searches */
 	if (cell_count <= 1) {
 		goto end;
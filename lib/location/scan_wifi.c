@@ -84,29 +84,73 @@ void scan_wifi_execute(int32_t timeout, struct k_sem *wifi_scan_ready)
 	}
 }
 
+/* Locally administered MAC addresses are typically used by mobile hotspots
+ * and randomized interfaces, which are useless for positioning.
+ */
+#define MAC_LOCALLY_ADMINISTERED_BIT BIT(1)
+
+static struct wifi_scan_result *scan_wifi_result_slot_get(const struct wifi_scan_result *entry)
+{
+	struct wifi_scan_result *weakest = NULL;
+
+	for (int i = 0; i < scan_wifi_info.cnt; i++) {
+		struct wifi_scan_result *stored = &scan_wifi_info.ap_info[i];
+
+		/* Same BSSID reported again, for example on another channel or band. */
+		if (memcmp(stored->mac, entry->mac, WIFI_MAC_ADDR_LEN) == 0) {
+			return (entry->rssi > stored->rssi) ? stored : NULL;
+		}
+
+		if (weakest == NULL || stored->rssi < weakest->rssi) {
+			weakest = stored;
+		}
+	}
+
+	if (scan_wifi_info.cnt < CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT) {
+		return &scan_wifi_info.ap_info[scan_wifi_info.cnt++];
+	}
+
+	/* Buffer is full, keep the strongest access points. */
+	if (weakest != NULL && entry->rssi > weakest->rssi) {
+		return weakest;
+	}
+
+	LOG_DBG("Scanning result (mac %02x:%02x:%02x:%02x:%02x:%02x, rssi %d) "
+		"weaker than stored results - dropping it",
+			entry->mac[0], entry->mac[1], entry->mac[2],
+			entry->mac[3], entry->mac[4], entry->mac[5], entry->rssi);
+
+	return NULL;
+}
+
 static void scan_wifi_result_handle(struct net_mgmt_event_callback *cb)
 {
 	const struct wifi_scan_result *entry = (const struct wifi_scan_result *)cb->info;
 	struct wifi_scan_result *current;
 
-	if (scan_wifi_info.cnt < CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT) {
-		current = &scan_wifi_info.ap_info[scan_wifi_info.cnt];
-		*current = *entry;
-		scan_wifi_info.cnt++;
-
-		LOG_DBG("scan result #%d stored: ssid %s, channel %d,"
-			" mac %02x:%02x:%02x:%02x:%02x:%02x",
-				scan_wifi_info.cnt,
-				current->ssid,
-				current->channel,
-				current->mac[0], current->mac[1], current->mac[2],
-				current->mac[3], current->mac[4], current->mac[5]);
-	} else {
-		LOG_WRN("Scanning result (mac %02x:%02x:%02x:%02x:%02x:%02x) "
-			"did not fit to result buffer - dropping it",
-				entry->mac[0], entry->mac[1], entry->mac[2],
-				entry->mac[3], entry->mac[4], entry->mac[5]);
+	if (IS_ENABLED(CONFIG_LOCATION_METHOD_WIFI_SCANNING_SKIP_LOCAL_MAC) &&
+	    (entry->mac[0] & MAC_LOCALLY_ADMINISTERED_BIT)) {
+		LOG_DBG("Skipping locally administered mac %02x:%02x:%02x:%02x:%02x:%02x",
+			entry->mac[0], entry->mac[1], entry->mac[2],
+			entry->mac[3], entry->mac[4], entry->mac[5]);
+		return;
+	}
+
+	current = scan_wifi_result_slot_get(entry);
+	if (current == NULL) {
+		return;
 	}
+
+	*current = *entry;
+
+	LOG_DBG("scan result stored (%d in total): ssid %s, channel %d, rssi %d,"
+		" mac %02x:%02x:%02x:%02x:%02x:%02x",
+			scan_wifi_info.cnt,
+			current->ssid,
+			current->channel,
+			current->rssi,
+			current->mac[0], current->mac[1], current->mac[2],
+			current->mac[3], current->mac[4], current->mac[5]);
 }
 
 static void scan_wifi_done_handle(struct net_mgmt_event_callback *cb)
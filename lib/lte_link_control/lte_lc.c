@@ -82,6 +82,19 @@ static char rai_param[2] = CONFIG_LTE_RAI_REQ_VALUE;
 static struct lte_lc_ncellmeas_params ncellmeas_params;
 /* Sempahore value 1 means ncellmeas is not ongoing, and 0 means it's ongoing. */
 K_SEM_DEFINE(ncellmeas_idle_sem, 1, 1);
+/* Result of the latest neighbor cell measurement, decoded directly into these buffers */
+static struct lte_lc_ncell ncellmeas_ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+static struct lte_lc_cell ncellmeas_gci_cells[AT_NCELLMEAS_GCI_COUNT_MAX];
+static struct lte_lc_cells_info ncellmeas_cells = {
+	.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID,
+	.neighbor_cells = ncellmeas_ncells,
+	.gci_cells = ncellmeas_gci_cells,
+};
+/* Uptime when the latest measurement result was received, valid if ncellmeas_cells_valid */
+static int64_t ncellmeas_cells_timestamp;
+static bool ncellmeas_cells_valid;
+/* Protects the latest measurement result */
+static K_MUTEX_DEFINE(ncellmeas_cells_mutex);
 /* Network attach semaphore */
 static K_SEM_DEFINE(link, 0, 1);
 
@@ -342,98 +355,46 @@ static void at_handler_xt3412(const char *response)
 	event_handler_list_dispatch(&evt);
 }
 
-static void at_handler_ncellmeas_gci(const char *response)
-{
-	int err;
-	struct lte_lc_evt evt = {0};
-	const char *resp = response;
-
-	__ASSERT_NO_MSG(response != NULL);
-
-	int max_cell_count = ncellmeas_params.gci_count;
-	struct lte_lc_cell *cells = NULL;
-
-	LOG_DBG("%%NCELLMEAS GCI notification parsing starts");
-
-	if (max_cell_count != 0) {
-		cells = k_calloc(max_cell_count, sizeof(struct lte_lc_cell));
-		if (cells == NULL) {
-			LOG_ERR("Failed to allocate memory for the GCI cells");
-			return;
-		}
-	}
-
-	evt.cells_info.gci_cells = cells;
-	err = parse_ncellmeas_gci(&ncellmeas_params, resp, &evt.cells_info);
-	LOG_DBG("parse_ncellmeas_gci returned %d", err);
-	switch (err) {
-	case -E2BIG:
-		LOG_WRN("Not all neighbor cells could be parsed. "
-			"More cells than the configured max count of %d were found",
-			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
-		/* Fall through */
-	case 0: /* Fall through */
-	case 1:
-		LOG_DBG("Neighbor cell count: %d, GCI cells count: %d",
-			evt.cells_info.ncells_count,
-			evt.cells_info.gci_cells_count);
-		evt.type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
-		event_handler_list_dispatch(&evt);
-		break;
-	default:
-		LOG_ERR("Parsing of neighbor cells failed, err: %d", err);
-		break;
-	}
-
-	k_free(cells);
-	k_free(evt.cells_info.neighbor_cells);
-}
-
 static void at_handler_ncellmeas(const char *response)
 {
 	int err;
 	struct lte_lc_evt evt = {0};
+	struct lte_lc_ncellmeas_params params = ncellmeas_params;
 
 	__ASSERT_NO_MSG(response != NULL);
 
-	if (event_handler_list_is_empty()) {
-		/* No need to parse the response if there is no handler
-		 * to receive the parsed data.
-		 */
-		goto exit;
-	}
-
-	if (ncellmeas_params.search_type > LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE) {
-		at_handler_ncellmeas_gci(response);
-		goto exit;
-	}
+	/* The response is parsed even without event handlers, as the result is kept for
+	 * lte_lc_neighbor_cell_measurement_last_get().
+	 */
+	k_mutex_lock(&ncellmeas_cells_mutex, K_FOREVER);
 
-	int ncell_count = neighborcell_count_get(response);
-	struct lte_lc_ncell *neighbor_cells = NULL;
+	ncellmeas_cells_valid = false;
+	memset(&ncellmeas_cells.current_cell, 0, sizeof(ncellmeas_cells.current_cell));
 
-	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", ncell_count);
+	if (params.search_type > LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE) {
+		LOG_DBG("%%NCELLMEAS GCI notification parsing starts");
 
-	if (ncell_count != 0) {
-		neighbor_cells = k_calloc(ncell_count, sizeof(struct lte_lc_ncell));
-		if (neighbor_cells == NULL) {
-			LOG_ERR("Failed to allocate memory for neighbor cells");
-			goto exit;
-		}
+		params.gci_count = MIN(params.gci_count, AT_NCELLMEAS_GCI_COUNT_MAX);
+		err = parse_ncellmeas_gci(&params, response, &ncellmeas_cells);
+	} else {
+		err = parse_ncellmeas(response, &ncellmeas_cells);
 	}
 
-	evt.cells_info.neighbor_cells = neighbor_cells;
-
-	err = parse_ncellmeas(response, &evt.cells_info);
-
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed");
 		LOG_WRN("More cells than the configured max count of %d were found",
 			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
 		/* Fall through */
-	case 0: /* Fall through */
+	case 0:
+		ncellmeas_cells_timestamp = k_uptime_get();
+		ncellmeas_cells_valid = true;
+		/* Fall through */
 	case 1:
+		LOG_DBG("Neighbor cell count: %d, GCI cells count: %d",
+			ncellmeas_cells.ncells_count, ncellmeas_cells.gci_cells_count);
 		evt.type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
+		evt.cells_info = ncellmeas_cells;
 		event_handler_list_dispatch(&evt);
 		break;
 	default:
@@ -441,10 +402,8 @@ static void at_handler_ncellmeas(const char *response)
 		break;
 	}
 
-	if (neighbor_cells) {
-		k_free(neighbor_cells);
-	}
-exit:
+	k_mutex_unlock(&ncellmeas_cells_mutex);
+
 	k_sem_give(&ncellmeas_idle_sem);
 }
 
@@ -1505,6 +1464,57 @@ int lte_lc_neighbor_cell_measurement_cancel(void)
 	return err;
 }
 
+int lte_lc_neighbor_cell_measurement_last_get(struct lte_lc_cells_info *cells,
+					      size_t ncells_max, size_t gci_cells_max,
+					      int64_t *age_ms)
+{
+	int err = 0;
+	size_t count;
+
+	if (cells == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&ncellmeas_cells_mutex, K_FOREVER);
+
+	if (!ncellmeas_cells_valid) {
+		err = -ENODATA;
+		goto exit;
+	}
+
+	cells->current_cell = ncellmeas_cells.current_cell;
+
+	cells->ncells_count = 0;
+	if (cells->neighbor_cells != NULL) {
+		count = MIN(ncellmeas_cells.ncells_count, ncells_max);
+		if (count < ncellmeas_cells.ncells_count) {
+			err = -E2BIG;
+		}
+		memcpy(cells->neighbor_cells, ncellmeas_ncells,
+		       count * sizeof(struct lte_lc_ncell));
+		cells->ncells_count = count;
+	}
+
+	cells->gci_cells_count = 0;
+	if (cells->gci_cells != NULL) {
+		count = MIN(ncellmeas_cells.gci_cells_count, gci_cells_max);
+		if (count < ncellmeas_cells.gci_cells_count) {
+			err = -E2BIG;
+		}
+		memcpy(cells->gci_cells, ncellmeas_gci_cells, count * sizeof(struct lte_lc_cell));
+		cells->gci_cells_count = count;
+	}
+
+	if (age_ms != NULL) {
+		*age_ms = k_uptime_get() - ncellmeas_cells_timestamp;
+	}
+
+exit:
+	k_mutex_unlock(&ncellmeas_cells_mutex);
+
+	return err;
+}
+
 int lte_lc_conn_eval_params_get(struct lte_lc_conn_eval_params *params)
 {
 	int err;
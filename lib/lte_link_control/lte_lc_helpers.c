@@ -7,6 +7,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/types.h>
 #include <errno.h>
+#include <ctype.h>
+#include <stdlib.h>
 #include <zephyr/net/socket.h>
 #include <string.h>
 #include <stdio.h>
@@ -881,275 +883,462 @@ uint32_t neighborcell_count_get(const char *at_response)
 	return ncell_count;
 }
 
-/* Parse NCELLMEAS notification and put information into struct lte_lc_cells_info.
- *
- * Returns 0 on successful cell measurements and population of struct.
- *	     The current cell information is valid if the current cell ID is
- *	     not set to LTE_LC_CELL_EUTRAN_ID_INVALID.
- *	     The ncells_count indicates how many neighbor cells were parsed
- *	     into the neighbor_cells array.
- * Returns 1 on measurement failure
- * Returns -E2BIG if not all cells were parsed due to memory limitations
- * Returns otherwise a negative error code.
+/* Streaming decoder for the parameters of a NCELLMEAS notification. The parameters are
+ * decoded in order, straight into the destination, without first storing them in an AT
+ * parameter list.
  */
-int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
+struct ncellmeas_cursor {
+	const char *pos;
+};
+
+static inline const char *ncellmeas_spaces_skip(const char *str)
 {
-	int err, status, tmp, len;
-	struct at_param_list resp_list;
-	char  response_prefix[sizeof(AT_NCELLMEAS_RESPONSE_PREFIX)] = {0};
-	size_t response_prefix_len = sizeof(response_prefix);
-	char tmp_str[7];
-	bool incomplete = false;
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailng
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
+	while (*str == ' ') {
+		str++;
+	}
 
-	cells->ncells_count = 0;
-	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	return str;
+}
 
-	err = at_params_list_init(&resp_list, param_count);
-	if (err) {
-		LOG_ERR("Could not init AT params list, error: %d", err);
-		return err;
+static inline bool ncellmeas_is_param_end(char chr)
+{
+	return (chr == ',') || (chr == '\0') || (chr == '\r') || (chr == '\n');
+}
+
+/* Check the notification prefix and place the cursor at the first parameter. */
+static bool ncellmeas_cursor_init(struct ncellmeas_cursor *cur, const char *at_response)
+{
+	const char *str = at_response;
+	size_t prefix_len = sizeof(AT_NCELLMEAS_RESPONSE_PREFIX) - 1;
+
+	while ((*str == '\r') || (*str == '\n')) {
+		str++;
 	}
 
-	err = at_parser_params_from_str(at_response,
-					NULL,
-					&resp_list);
-	if (err && err != -E2BIG) {
-		LOG_ERR("Could not parse AT%%NCELLMEAS response, error: %d", err);
-		goto clean_exit;
-	} else if (err == -E2BIG) {
-		incomplete = true;
+	if ((strncmp(str, AT_NCELLMEAS_RESPONSE_PREFIX, prefix_len) != 0) ||
+	    (str[prefix_len] != ':')) {
+		return false;
 	}
 
-	err = at_params_string_get(&resp_list,
-				   AT_RESPONSE_PREFIX_INDEX,
-				   response_prefix,
-				   &response_prefix_len);
-	if (err) {
-		LOG_ERR("Could not get response prefix, error: %d", err);
-		goto clean_exit;
+	cur->pos = &str[prefix_len + 1];
+
+	return true;
+}
+
+static bool ncellmeas_cursor_at_end(const struct ncellmeas_cursor *cur)
+{
+	const char *str = ncellmeas_spaces_skip(cur->pos);
+
+	return (*str == '\0') || (*str == '\r') || (*str == '\n');
+}
+
+/* Move the cursor past the separator following a parameter ending at end. */
+static int ncellmeas_cursor_advance(struct ncellmeas_cursor *cur, const char *end)
+{
+	end = ncellmeas_spaces_skip(end);
+	if (!ncellmeas_is_param_end(*end)) {
+		return -EINVAL;
 	}
 
-	if (!response_is_valid(response_prefix, response_prefix_len,
-			       AT_NCELLMEAS_RESPONSE_PREFIX)) {
-		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
-		LOG_DBG("Not a valid NCELLMEAS response");
-		goto clean_exit;
+	cur->pos = (*end == ',') ? end + 1 : end;
+
+	return 0;
+}
+
+/* Decode an integer parameter. Values beyond 64 bits saturate, as with the AT parser. */
+static int ncellmeas_int_next(struct ncellmeas_cursor *cur, int64_t min, int64_t max,
+			      int64_t *value)
+{
+	const char *str = ncellmeas_spaces_skip(cur->pos);
+	char *end;
+	int64_t val;
+
+	if (!isdigit((int)*str) && (*str != '-') && (*str != '+')) {
+		return -EINVAL;
 	}
 
-	/* Status code. */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_STATUS_INDEX, &status);
+	val = strtoll(str, &end, 10);
+	if ((end == str) || (val < min) || (val > max)) {
+		return -EINVAL;
+	}
+
+	*value = val;
+
+	return ncellmeas_cursor_advance(cur, end);
+}
+
+/* Get a quoted string parameter, without copying it. */
+static int ncellmeas_string_next(struct ncellmeas_cursor *cur, const char **str, size_t *len)
+{
+	const char *start = ncellmeas_spaces_skip(cur->pos);
+	const char *end;
+
+	if (*start != '"') {
+		return -EINVAL;
+	}
+
+	start++;
+	end = strchr(start, '"');
+	if (end == NULL) {
+		return -EINVAL;
+	}
+
+	*str = start;
+	*len = end - start;
+
+	return ncellmeas_cursor_advance(cur, end + 1);
+}
+
+/* Decode a quoted hexadecimal string parameter, such as the cell ID. */
+static int ncellmeas_hex_next(struct ncellmeas_cursor *cur, int *value)
+{
+	const char *str;
+	size_t len;
+	char str_buf[16];
+	int err;
+
+	err = ncellmeas_string_next(cur, &str, &len);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	if (status != AT_NCELLMEAS_STATUS_VALUE_SUCCESS) {
-		err = 1;
-		goto clean_exit;
+	if (len >= sizeof(str_buf)) {
+		return -ENOMEM;
 	}
 
-	/* Current cell ID. */
-	err = string_param_to_int(&resp_list, AT_NCELLMEAS_CELL_ID_INDEX, &tmp, 16);
+	memcpy(str_buf, str, len);
+	str_buf[len] = '\0';
+
+	if (string_to_int(str_buf, 16, value)) {
+		return -ENODATA;
+	}
+
+	return 0;
+}
+
+/* Decode <cell_id>,<plmn>,<tac> */
+static int ncellmeas_cell_id_next(struct ncellmeas_cursor *cur, struct lte_lc_cell *cell)
+{
+	const char *str;
+	size_t len;
+	char tmp_str[7];
+	int tmp;
+	int err;
+
+	err = ncellmeas_hex_next(cur, &tmp);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
 	if (tmp > LTE_LC_CELL_EUTRAN_ID_MAX) {
 		tmp = LTE_LC_CELL_EUTRAN_ID_INVALID;
 	}
-	cells->current_cell.id = tmp;
-
-	/* PLMN */
-	len = sizeof(tmp_str);
+	cell->id = tmp;
 
-	err = at_params_string_get(&resp_list, AT_NCELLMEAS_PLMN_INDEX,
-				   tmp_str, &len);
+	/* PLMN, three digit MCC followed by two or three digit MNC */
+	err = ncellmeas_string_next(cur, &str, &len);
 	if (err) {
-		goto clean_exit;
+		return err;
+	}
+
+	if ((len < 5) || (len >= sizeof(tmp_str))) {
+		return -EINVAL;
 	}
 
+	memcpy(tmp_str, str, len);
 	tmp_str[len] = '\0';
 
-	/* Read MNC and store as integer. The MNC starts as the fourth character
-	 * in the string, following three characters long MCC.
-	 */
-	err = string_to_int(&tmp_str[3], 10, &cells->current_cell.mnc);
+	err = string_to_int(&tmp_str[3], 10, &cell->mnc);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Null-terminated MCC, read and store it. */
 	tmp_str[3] = '\0';
 
-	err = string_to_int(tmp_str, 10, &cells->current_cell.mcc);
+	err = string_to_int(tmp_str, 10, &cell->mcc);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Tracking area code. */
-	err = string_param_to_int(&resp_list, AT_NCELLMEAS_TAC_INDEX, &tmp, 16);
+	/* Tracking area code */
+	err = ncellmeas_hex_next(cur, &tmp);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	cells->current_cell.tac = tmp;
+	cell->tac = tmp;
 
-	/* Timing advance */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_TIMING_ADV_INDEX,
-				&tmp);
+	return 0;
+}
+
+/* Decode <n_earfcn>,<n_phys_cell_id>,<n_rsrp>,<n_rsrq>,<time_diff> */
+static int ncellmeas_ncell_next(struct ncellmeas_cursor *cur, struct lte_lc_ncell *ncell)
+{
+	int64_t val;
+	int err;
+
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		return err;
+	}
+	ncell->earfcn = val;
+
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+	ncell->phys_cell_id = val;
+
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+	ncell->rsrp = val;
+
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+	ncell->rsrq = val;
+
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
 	}
+	ncell->time_diff = val;
 
-	cells->current_cell.timing_advance = tmp;
+	return 0;
+}
+
+/* Decode the neighbor cells into cells->neighbor_cells, which has room for
+ * CONFIG_LTE_NEIGHBOR_CELLS_MAX cells. Cells that do not fit are skipped.
+ */
+static int ncellmeas_ncells_next(struct ncellmeas_cursor *cur, struct lte_lc_cells_info *cells,
+				 size_t count, bool *incomplete)
+{
+	size_t capacity = (cells->neighbor_cells != NULL) ? CONFIG_LTE_NEIGHBOR_CELLS_MAX : 0;
+	struct lte_lc_ncell skipped;
+	int err;
+
+	for (size_t i = 0; i < count; i++) {
+		err = ncellmeas_ncell_next(cur, (i < capacity) ? &cells->neighbor_cells[i] :
+								 &skipped);
+		if (err) {
+			return err;
+		}
+	}
+
+	cells->ncells_count = MIN(count, capacity);
+	if ((capacity > 0) && (count > capacity)) {
+		*incomplete = true;
+	}
+
+	return 0;
+}
+
+/* Parse NCELLMEAS notification and put information into struct lte_lc_cells_info.
+ * The neighbor cells are written to cells->neighbor_cells, which must have room
+ * for CONFIG_LTE_NEIGHBOR_CELLS_MAX cells, or be NULL to skip them.
+ *
+ * Returns 0 on successful cell measurements and population of struct.
+ *	     The current cell information is valid if the current cell ID is
+ *	     not set to LTE_LC_CELL_EUTRAN_ID_INVALID.
+ *	     The ncells_count indicates how many neighbor cells were parsed
+ *	     into the neighbor_cells array.
+ * Returns 1 on measurement failure
+ * Returns -E2BIG if not all cells were parsed due to memory limitations
+ * Returns otherwise a negative error code.
+ */
+int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
+{
+	struct ncellmeas_cursor cur;
+	struct lte_lc_cell *cell = &cells->current_cell;
+	bool incomplete = false;
+	int64_t val;
+	int err;
+
+	cells->ncells_count = 0;
+	cell->id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+
+	if (!ncellmeas_cursor_init(&cur, at_response)) {
+		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
+		LOG_DBG("Not a valid NCELLMEAS response");
+		return 0;
+	}
+
+	/* Status code. */
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+
+	if (val != AT_NCELLMEAS_STATUS_VALUE_SUCCESS) {
+		return 1;
+	}
+
+	/* Current cell ID, PLMN and tracking area code. */
+	err = ncellmeas_cell_id_next(&cur, cell);
+	if (err) {
+		goto error;
+	}
+
+	/* Timing advance */
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		goto error;
+	}
+	cell->timing_advance = val;
 
 	/* EARFCN */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_EARFCN_INDEX,
-				&cells->current_cell.earfcn);
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		goto error;
 	}
+	cell->earfcn = val;
 
 	/* Physical cell ID. */
-	err = at_params_short_get(&resp_list, AT_NCELLMEAS_PHYS_CELL_ID_INDEX,
-				&cells->current_cell.phys_cell_id);
+	err = ncellmeas_int_next(&cur, INT16_MIN, INT16_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		goto error;
 	}
+	cell->phys_cell_id = val;
 
 	/* RSRP */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_RSRP_INDEX, &tmp);
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		goto error;
 	}
-
-	cells->current_cell.rsrp = tmp;
+	cell->rsrp = val;
 
 	/* RSRQ */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_RSRQ_INDEX, &tmp);
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		goto error;
 	}
-
-	cells->current_cell.rsrq = tmp;
+	cell->rsrq = val;
 
 	/* Measurement time. */
-	err = at_params_int64_get(&resp_list, AT_NCELLMEAS_MEASUREMENT_TIME_INDEX,
-				  &cells->current_cell.measurement_time);
+	err = ncellmeas_int_next(&cur, INT64_MIN, INT64_MAX, &val);
 	if (err) {
-		goto clean_exit;
+		goto error;
 	}
+	cell->measurement_time = val;
 
-	/* Neighbor cell count. */
-	cells->ncells_count = neighborcell_count_get(at_response);
+	/* Neighboring cells. */
+	err = ncellmeas_ncells_next(&cur, cells, neighborcell_count_get(at_response),
+				    &incomplete);
+	if (err) {
+		goto error;
+	}
 
 	/* Starting from modem firmware v1.3.1, timing advance measurement time
 	 * information is added as the last parameter in the response.
 	 */
-	size_t ta_meas_time_index = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-			cells->ncells_count * AT_NCELLMEAS_N_PARAMS_COUNT;
-
-	if (at_params_valid_count_get(&resp_list) > ta_meas_time_index) {
-		err = at_params_int64_get(&resp_list, ta_meas_time_index,
-					  &cells->current_cell.timing_advance_meas_time);
+	cell->timing_advance_meas_time = 0;
+	if (!ncellmeas_cursor_at_end(&cur)) {
+		err = ncellmeas_int_next(&cur, INT64_MIN, INT64_MAX, &val);
 		if (err) {
-			goto clean_exit;
+			goto error;
 		}
-	} else {
-		cells->current_cell.timing_advance_meas_time = 0;
+		cell->timing_advance_meas_time = val;
 	}
 
-	if ((cells->ncells_count == 0) || (cells->neighbor_cells == NULL)) {
-		goto clean_exit;
-	}
+	return incomplete ? -E2BIG : 0;
 
-	/* Neighboring cells. */
-	for (size_t i = 0; i < cells->ncells_count; i++) {
-		size_t start_idx = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-				   i * AT_NCELLMEAS_N_PARAMS_COUNT;
+error:
+	LOG_ERR("Could not parse AT%%NCELLMEAS response, error: %d", err);
+	return err;
+}
 
-		/* EARFCN */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_EARFCN_INDEX,
-					&cells->neighbor_cells[i].earfcn);
-		if (err) {
-			goto clean_exit;
-		}
+/* Decode the parameters of one cell in a GCI search response, from <cell_id> to
+ * <neighbor_count>.
+ */
+static int ncellmeas_gci_cell_next(struct ncellmeas_cursor *cur, struct lte_lc_cell *cell,
+				   bool *is_serving_cell, uint8_t *ncells_count)
+{
+	int64_t val;
+	int err;
 
-		/* Physical cell ID. */
-		err = at_params_short_get(&resp_list,
-					  start_idx + AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX,
-					  &cells->neighbor_cells[i].phys_cell_id);
-		if (err) {
-			goto clean_exit;
-		}
+	/* <cell_id>,<plmn>,<tac> */
+	err = ncellmeas_cell_id_next(cur, cell);
+	if (err) {
+		return err;
+	}
 
-		/* RSRP */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_RSRP_INDEX,
-					&tmp);
-		if (err) {
-			goto clean_exit;
-		}
+	/* <ta> */
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+	cell->timing_advance = val;
 
-		cells->neighbor_cells[i].rsrp = tmp;
+	/* <ta_meas_time> */
+	err = ncellmeas_int_next(cur, INT64_MIN, INT64_MAX, &val);
+	if (err) {
+		return err;
+	}
+	cell->timing_advance_meas_time = val;
 
-		/* RSRQ */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_RSRQ_INDEX,
-					&tmp);
-		if (err) {
-			goto clean_exit;
-		}
+	/* <earfcn> */
+	err = ncellmeas_int_next(cur, INT32_MIN, INT32_MAX, &val);
+	if (err) {
+		return err;
+	}
+	cell->earfcn = val;
 
-		cells->neighbor_cells[i].rsrq = tmp;
+	/* <phys_cell_id> */
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+	cell->phys_cell_id = val;
 
-		/* Time difference. */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_TIME_DIFF_INDEX,
-					&cells->neighbor_cells[i].time_diff);
-		if (err) {
-			goto clean_exit;
-		}
+	/* <rsrp> */
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
 	}
+	cell->rsrp = val;
 
-	if (incomplete) {
-		err = -E2BIG;
+	/* <rsrq> */
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
 	}
+	cell->rsrq = val;
 
-clean_exit:
-	at_params_list_free(&resp_list);
+	/* <meas_time> */
+	err = ncellmeas_int_next(cur, INT64_MIN, INT64_MAX, &val);
+	if (err) {
+		return err;
+	}
+	cell->measurement_time = val;
 
-	return err;
+	/* <serving> */
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+	*is_serving_cell = val;
+
+	/* <neighbor_count> */
+	err = ncellmeas_int_next(cur, INT16_MIN, INT16_MAX, &val);
+	if (err) {
+		return err;
+	}
+	*ncells_count = val;
+
+	return 0;
 }
 
 int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params,
 	const char *at_response, struct lte_lc_cells_info *cells)
 {
-	struct at_param_list resp_list;
-	struct lte_lc_ncell *ncells = NULL;
-	int err, status, tmp_int, len;
-	int16_t tmp_short;
-	char response_prefix[sizeof(AT_NCELLMEAS_RESPONSE_PREFIX)] = {0};
-	size_t response_prefix_len = sizeof(response_prefix);
-	char tmp_str[7];
+	struct ncellmeas_cursor cur;
 	bool incomplete = false;
-	int curr_index;
-	size_t i = 0, j = 0, k = 0;
-
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailing
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
+	int64_t status;
+	int err;
+	int i;
 
 	/* Fill the defaults */
 	cells->gci_cells_count = 0;
@@ -1180,297 +1369,65 @@ int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params,
 	 *	[,<n_earfcn2>,<n_phys_cell_id2>,<n_rsrp2>,<n_rsrq2>,<time_diff2>]...]...
 	 */
 
-	err = at_params_list_init(&resp_list, param_count);
-	if (err) {
-		LOG_ERR("Could not init AT params list for cell_list, error: %d", err);
-		goto clean_exit;
-	}
-
-	err = at_parser_params_from_str(at_response, NULL, &resp_list);
-	if (err && err != -E2BIG) {
-		LOG_ERR("Could not parse AT%%NCELLMEAS response, error: %d", err);
-		goto clean_exit;
-	} else if (err == -E2BIG) {
-		/* Returns -E2BIG if the buffers set by CONFIG_LTE_NEIGHBOR_CELLS_MAX
-		 * are too small for the modem response. The associated data is still valid,
-		 * but not complete.
-		 */
-		incomplete = true;
-		LOG_WRN("E2BIG was returned, continue. param_count %d, err %d, str %s",
-			param_count, err, at_response);
-	}
-
-	err = at_params_string_get(&resp_list,
-				   AT_RESPONSE_PREFIX_INDEX,
-				   response_prefix,
-				   &response_prefix_len);
-	if (err) {
-		LOG_ERR("Could not get response prefix, error: %d", err);
-		goto clean_exit;
-	}
-
-	if (!response_is_valid(response_prefix, response_prefix_len,
-			       AT_NCELLMEAS_RESPONSE_PREFIX)) {
+	if (!ncellmeas_cursor_init(&cur, at_response)) {
 		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
 		LOG_ERR("Not a valid NCELLMEAS response");
-		goto clean_exit;
+		return 0;
 	}
 
 	/* Status code. */
-	curr_index = AT_NCELLMEAS_STATUS_INDEX;
-	err = at_params_int_get(&resp_list, curr_index, &status);
+	err = ncellmeas_int_next(&cur, INT32_MIN, INT32_MAX, &status);
 	if (err) {
 		LOG_DBG("Cannot parse NCELLMEAS status");
-		goto clean_exit;
+		return err;
 	}
 
 	if (status == AT_NCELLMEAS_STATUS_VALUE_FAIL) {
-		err = 1;
-		LOG_DBG("NCELLMEAS status %d", status);
-		goto clean_exit;
+		LOG_DBG("NCELLMEAS status %d", (int)status);
+		return 1;
 	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
 		LOG_WRN("NCELLMEAS measurements interrupted; results incomplete");
 	}
 
 	/* Go through the cells. */
-	for (i = 0; curr_index < (param_count - (AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT + 1)) &&
-			i < params->gci_count; i++) {
+	for (i = 0; !ncellmeas_cursor_at_end(&cur) && i < params->gci_count; i++) {
 		struct lte_lc_cell parsed_cell;
 		bool is_serving_cell;
 		uint8_t parsed_ncells_count;
 
-		/* <cell_id>  */
-		curr_index++;
-		err = string_param_to_int(&resp_list, curr_index, &tmp_int, 16);
+		err = ncellmeas_gci_cell_next(&cur, &parsed_cell, &is_serving_cell,
+					      &parsed_ncells_count);
 		if (err) {
-			LOG_ERR("Could not parse cell_id, index %d, i %d error: %d",
-				curr_index, i, err);
-			goto clean_exit;
+			LOG_ERR("Could not parse GCI cell %d, error: %d", i, err);
+			return err;
 		}
 
-		if (tmp_int > LTE_LC_CELL_EUTRAN_ID_MAX) {
-			LOG_WRN("cell_id = %d which is > LTE_LC_CELL_EUTRAN_ID_MAX; "
-				"marking invalid", tmp_int);
-			tmp_int = LTE_LC_CELL_EUTRAN_ID_INVALID;
-		}
-		parsed_cell.id = tmp_int;
-
-		/* <plmn> */
-		len = sizeof(tmp_str);
-
-		curr_index++;
-		err = at_params_string_get(&resp_list, curr_index, tmp_str, &len);
-		if (err) {
-			LOG_ERR("Could not parse plmn, error: %d", err);
-			goto clean_exit;
-		}
-		/* A successful call to `at_params_string_get` guarantees `len` to be set to
-		 * a value lower than the totalt size of `tmp_str`.
-		 */
-		tmp_str[len] = '\0';
-
-		/* Read MNC and store as integer. The MNC starts as the fourth character
-		 * in the string, following three characters long MCC.
-		 */
-		err = string_to_int(&tmp_str[3], 10, &parsed_cell.mnc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* Null-terminated MCC, read and store it. */
-		tmp_str[3] = '\0';
-
-		err = string_to_int(tmp_str, 10, &parsed_cell.mcc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <tac> */
-		curr_index++;
-		err = string_param_to_int(&resp_list, curr_index, &tmp_int, 16);
-		if (err) {
-			LOG_ERR("Could not parse tracking_area_code in i %d, error: %d", i, err);
-			goto clean_exit;
-		}
-		parsed_cell.tac = tmp_int;
-
-		/* <ta> */
-		curr_index++;
-		err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance, error: %d", err);
-			goto clean_exit;
-		}
-		parsed_cell.timing_advance = tmp_int;
-
-		/* <ta_meas_time> */
-		curr_index++;
-		err = at_params_int64_get(&resp_list, curr_index,
-					  &parsed_cell.timing_advance_meas_time);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance_meas_time, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <earfcn> */
-		curr_index++;
-		err = at_params_int_get(&resp_list, curr_index, &parsed_cell.earfcn);
-		if (err) {
-			LOG_ERR("Could not parse earfcn, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <phys_cell_id> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.phys_cell_id);
-		if (err) {
-			LOG_ERR("Could not parse phys_cell_id, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrp> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.rsrp);
-		if (err) {
-			LOG_ERR("Could not parse rsrp, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrq> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.rsrq);
-		if (err) {
-			LOG_ERR("Could not parse rsrq, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <meas_time> */
-		curr_index++;
-		err = at_params_int64_get(&resp_list, curr_index, &parsed_cell.measurement_time);
-		if (err) {
-			LOG_ERR("Could not parse meas_time, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <serving> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &tmp_short);
-		if (err) {
-			LOG_ERR("Could not parse serving, error: %d", err);
-			goto clean_exit;
-		}
-		is_serving_cell = tmp_short;
-
-		/* <neighbor_count> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &tmp_short);
-		if (err) {
-			LOG_ERR("Could not parse neighbor_count, error: %d", err);
-			goto clean_exit;
-		}
-		parsed_ncells_count = tmp_short;
-
 		if (is_serving_cell) {
-			int to_be_parsed_ncell_count = 0;
-
 			/* This the current/serving cell.
 			 * In practice the <neighbor_count> is always 0 for other than
 			 * the serving cell, i.e. no neigbour cell list is available.
 			 * Thus, handle neighbor cells only for the serving cell.
 			 */
 			cells->current_cell = parsed_cell;
-			if (parsed_ncells_count != 0) {
-				/* Allocate room for the parsed neighbor info. */
-				if (parsed_ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-					to_be_parsed_ncell_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
-					incomplete = true;
-					LOG_WRN("Cutting response, because received neigbor cell"
-						" count is bigger than configured max: %d",
-							CONFIG_LTE_NEIGHBOR_CELLS_MAX);
-
-				} else {
-					to_be_parsed_ncell_count = parsed_ncells_count;
-				}
-				ncells = k_calloc(
-						to_be_parsed_ncell_count,
-						sizeof(struct lte_lc_ncell));
-				if (ncells == NULL) {
-					LOG_WRN("Failed to allocate memory for the ncells"
-						" (continue)");
-					continue;
-				}
-				cells->neighbor_cells = ncells;
-				cells->ncells_count = to_be_parsed_ncell_count;
-			}
 
-			/* Parse neighbors */
-			for (j = 0; j < to_be_parsed_ncell_count; j++) {
-				/* <n_earfcn[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list,
-							curr_index,
-							&cells->neighbor_cells[j].earfcn);
-				if (err) {
-					LOG_ERR("Could not parse n_earfcn, error: %d", err);
-					goto clean_exit;
-				}
-
-				/* <n_phys_cell_id[j]> */
-				curr_index++;
-				err = at_params_short_get(&resp_list,
-							  curr_index,
-							  &cells->neighbor_cells[j].phys_cell_id);
-				if (err) {
-					LOG_ERR("Could not parse n_phys_cell_id, error: %d", err);
-					goto clean_exit;
-				}
-
-				/* <n_rsrp[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrp, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrp = tmp_int;
-
-				/* <n_rsrq[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrq, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrq = tmp_int;
-
-				/* <time_diff[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list,
-							curr_index,
-							&cells->neighbor_cells[j].time_diff);
-				if (err) {
-					LOG_ERR("Could not parse time_diff, error: %d", err);
-					goto clean_exit;
-				}
+			err = ncellmeas_ncells_next(&cur, cells, parsed_ncells_count, &incomplete);
+			if (err) {
+				LOG_ERR("Could not parse neighbor cells, error: %d", err);
+				return err;
 			}
 		} else {
-			cells->gci_cells[k] = parsed_cell;
+			cells->gci_cells[cells->gci_cells_count] = parsed_cell;
 			cells->gci_cells_count++; /* Increase count for non-serving GCI cell */
-			k++;
 		}
 	}
 
 	if (incomplete) {
-		err = -E2BIG;
-		LOG_ERR("Buffer is too small; results incomplete: %d", err);
+		LOG_WRN("Cutting response, because received neigbor cell count is bigger than "
+			"configured max: %d", CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		return -E2BIG;
 	}
 
-clean_exit:
-	at_params_list_free(&resp_list);
-
-	return err;
+	return 0;
 }
 
 int parse_xmodemsleep(const char *at_response, struct lte_lc_modem_sleep *modem_sleep)
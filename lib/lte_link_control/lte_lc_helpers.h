@@ -109,6 +109,8 @@
 	 AT_NCELLMEAS_N_PARAMS_COUNT * CONFIG_LTE_NEIGHBOR_CELLS_MAX)
 
 #define AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT	12
+/* Maximum number of cells in a GCI search, current cell included */
+#define AT_NCELLMEAS_GCI_COUNT_MAX		15
 
 /* XMODEMSLEEP command parameters. */
 #define AT_XMODEMSLEEP_SUB			"AT%%XMODEMSLEEP=1,%d,%d"
@@ -263,8 +265,11 @@ uint32_t neighborcell_count_get(const char *at_response);
  * Hence, the maximum value for these fields is represented by 63 bits and is
  * 9223372036854775807, which still represents millions of years.
  *
+ * The neighbor cells are decoded directly into cells->neighbor_cells, which must have room
+ * for CONFIG_LTE_NEIGHBOR_CELLS_MAX cells, or be NULL to skip them.
+ *
  * @param at_response Pointer to buffer with AT response.
- * @param ncell Pointer to ncell structure.
+ * @param cells Pointer to lte_lc_cells_info structure.
  *
  * @return Zero on success or (negative) error code otherwise.
  *         Returns -E2BIG if the static buffers set by CONFIG_LTE_NEIGHBOR_CELLS_MAX
@@ -283,7 +288,11 @@ int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells);
  * Hence, the maximum value for these fields is represented by 63 bits and is
  * 9223372036854775807, which still represents millions of years.
  *
- * @param params Neighbor cell measurement parameters.
+ * The cells are decoded directly into the arrays of @p cells. cells->neighbor_cells must have
+ * room for CONFIG_LTE_NEIGHBOR_CELLS_MAX cells and cells->gci_cells for params->gci_count
+ * cells.
+ *
+@param params Neighbor cell measurement parameters.
  * @param at_response Pointer to buffer with AT response.
  * @param cells Pointer to lte_lc_cells_info structure.
  *
@@ -7,6 +7,7 @@
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <modem/at_cmd_parser.h>
+#include <modem/nrf_modem_lib.h>
 #include <ctype.h>
 #include <zephyr/device.h>
 #include <errno.h>
@@ -367,6 +368,206 @@ AT_MONITOR(modem_info_cesq_mon, "%CESQ", modem_info_rsrp_subscribe_handler, PAUS
 static rsrp_cb_t modem_info_rsrp_cb;
 static struct at_param_list m_param_list;
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+/* Time to live of responses that do not expire */
+#define CACHE_TTL_FOREVER UINT32_MAX
+
+/* Groups of cached responses that go stale for the same reason */
+enum cache_group {
+	/* Modem firmware and identity, change only with a new modem firmware. */
+	CACHE_GROUP_DEVICE,
+	/* SIM card information, invalidated by %XSIM. */
+	CACHE_GROUP_SIM,
+	/* Registration, cell and system mode, invalidated by +CEREG. */
+	CACHE_GROUP_NETWORK,
+	/* PDP contexts, invalidated by +CGEV and +CEREG. */
+	CACHE_GROUP_PDN,
+	/* Signal quality, invalidated by %CESQ and %XMODEMSLEEP. */
+	CACHE_GROUP_SIGNAL,
+	/* Battery voltage and temperature. */
+	CACHE_GROUP_SENSOR,
+	CACHE_GROUP_COUNT,
+};
+
+static const uint32_t cache_group_ttl_ms[CACHE_GROUP_COUNT] = {
+	[CACHE_GROUP_DEVICE]	= CACHE_TTL_FOREVER,
+	[CACHE_GROUP_SIM]	= CACHE_TTL_FOREVER,
+	[CACHE_GROUP_NETWORK]	= CONFIG_MODEM_INFO_CACHE_NETWORK_TTL * MSEC_PER_SEC,
+	[CACHE_GROUP_PDN]	= CONFIG_MODEM_INFO_CACHE_NETWORK_TTL * MSEC_PER_SEC,
+	[CACHE_GROUP_SIGNAL]	= CONFIG_MODEM_INFO_CACHE_SIGNAL_TTL * MSEC_PER_SEC,
+	[CACHE_GROUP_SENSOR]	= CONFIG_MODEM_INFO_CACHE_SENSOR_TTL * MSEC_PER_SEC,
+};
+
+/* Incremented from the notification handlers when the responses of a group go stale. */
+static atomic_t cache_group_gen[CACHE_GROUP_COUNT];
+
+struct cache_entry {
+	const char *cmd;
+	enum cache_group group;
+	bool valid;
+	/* Generation of the group when the command was sent. */
+	atomic_val_t gen;
+	/* Uptime when the response was received. */
+	int64_t timestamp;
+	char rsp[CONFIG_MODEM_INFO_BUFFER_SIZE];
+};
+
+/* One entry per AT command, so all the fields read from a response share one AT round trip.
+ * AT+CCLK? is not cached, as the time changes all the time.
+ */
+static struct cache_entry cache[] = {
+	{ .cmd = AT_CMD_CESQ,		.group = CACHE_GROUP_SIGNAL },
+	{ .cmd = AT_CMD_CURRENT_BAND,	.group = CACHE_GROUP_NETWORK },
+	{ .cmd = AT_CMD_SUPPORTED_BAND,	.group = CACHE_GROUP_DEVICE },
+	{ .cmd = AT_CMD_CURRENT_MODE,	.group = CACHE_GROUP_NETWORK },
+	{ .cmd = AT_CMD_CURRENT_OP,	.group = CACHE_GROUP_NETWORK },
+	{ .cmd = AT_CMD_NETWORK_STATUS,	.group = CACHE_GROUP_NETWORK },
+	{ .cmd = AT_CMD_PDP_CONTEXT,	.group = CACHE_GROUP_PDN },
+	{ .cmd = AT_CMD_UICC_STATE,	.group = CACHE_GROUP_SIM },
+	{ .cmd = AT_CMD_VBAT,		.group = CACHE_GROUP_SENSOR },
+	{ .cmd = AT_CMD_TEMP,		.group = CACHE_GROUP_SENSOR },
+	{ .cmd = AT_CMD_FW_VERSION,	.group = CACHE_GROUP_DEVICE },
+	{ .cmd = AT_CMD_ICCID,		.group = CACHE_GROUP_SIM },
+	{ .cmd = AT_CMD_SYSTEMMODE,	.group = CACHE_GROUP_NETWORK },
+	{ .cmd = AT_CMD_IMSI,		.group = CACHE_GROUP_SIM },
+	{ .cmd = AT_CMD_IMEI,		.group = CACHE_GROUP_DEVICE },
+};
+
+static K_MUTEX_DEFINE(cache_mutex);
+
+/* The handlers only mark responses stale, so they run directly in the notification ISR. */
+AT_MONITOR_ISR(modem_info_cache_cereg_mon, "+CEREG", cache_cereg_handler);
+AT_MONITOR_ISR(modem_info_cache_cgev_mon, "+CGEV", cache_cgev_handler);
+AT_MONITOR_ISR(modem_info_cache_xsim_mon, "%XSIM", cache_xsim_handler);
+AT_MONITOR_ISR(modem_info_cache_cesq_mon, "%CESQ", cache_signal_handler);
+AT_MONITOR_ISR(modem_info_cache_xmodemsleep_mon, "%XMODEMSLEEP", cache_signal_handler);
+
+static void cache_group_invalidate(enum cache_group group)
+{
+	atomic_inc(&cache_group_gen[group]);
+}
+
+static void cache_cereg_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_group_invalidate(CACHE_GROUP_NETWORK);
+	cache_group_invalidate(CACHE_GROUP_PDN);
+}
+
+static void cache_cgev_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_group_invalidate(CACHE_GROUP_PDN);
+}
+
+static void cache_xsim_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_group_invalidate(CACHE_GROUP_SIM);
+}
+
+static void cache_signal_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_group_invalidate(CACHE_GROUP_SIGNAL);
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_CFUN_HOOKS)
+NRF_MODEM_LIB_ON_CFUN(modem_info_cfun_hook, modem_info_on_cfun, NULL);
+
+static void modem_info_on_cfun(int mode, void *ctx)
+{
+	ARG_UNUSED(mode);
+	ARG_UNUSED(ctx);
+
+	modem_info_cache_invalidate();
+}
+#endif
+
+static bool cache_entry_is_fresh(const struct cache_entry *entry)
+{
+	uint32_t ttl_ms = cache_group_ttl_ms[entry->group];
+
+	if (!entry->valid || entry->gen != atomic_get(&cache_group_gen[entry->group])) {
+		return false;
+	}
+
+	return ttl_ms == CACHE_TTL_FOREVER || k_uptime_get() - entry->timestamp < ttl_ms;
+}
+
+static struct cache_entry *cache_entry_get(const char *cmd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (strcmp(cache[i].cmd, cmd) == 0) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+void modem_info_cache_invalidate(void)
+{
+	/* The device information stays valid across functional mode changes */
+	for (int group = 0; group < CACHE_GROUP_COUNT; group++) {
+		if (group != CACHE_GROUP_DEVICE) {
+			cache_group_invalidate(group);
+		}
+	}
+}
+
+/* Send an AT command, or get its response from the cache if it is still fresh.
+ * The response is copied to buf, which must be CONFIG_MODEM_INFO_BUFFER_SIZE bytes.
+ */
+static int modem_info_at_cmd(char *buf, const char *cmd)
+{
+	struct cache_entry *entry = cache_entry_get(cmd);
+	atomic_val_t gen;
+	int err;
+
+	if (entry == NULL) {
+		return nrf_modem_at_cmd(buf, CONFIG_MODEM_INFO_BUFFER_SIZE, cmd);
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	if (cache_entry_is_fresh(entry)) {
+		LOG_DBG("Using cached response of %s", cmd);
+	} else {
+		/* Take the generation before sending the command, so that a notification
+		 * received meanwhile leaves the response stale.
+		 */
+		gen = atomic_get(&cache_group_gen[entry->group]);
+		entry->valid = false;
+
+		err = nrf_modem_at_cmd(entry->rsp, sizeof(entry->rsp), cmd);
+		if (err) {
+			k_mutex_unlock(&cache_mutex);
+			return err;
+		}
+
+		entry->gen = gen;
+		entry->timestamp = k_uptime_get();
+		entry->valid = true;
+	}
+
+	memcpy(buf, entry->rsp, CONFIG_MODEM_INFO_BUFFER_SIZE);
+
+	k_mutex_unlock(&cache_mutex);
+
+	return 0;
+}
+#else
+static int modem_info_at_cmd(char *buf, const char *cmd)
+{
+	return nrf_modem_at_cmd(buf, CONFIG_MODEM_INFO_BUFFER_SIZE, cmd);
+}
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
 static void flip_iccid_string(char *buf)
 {
 	uint8_t current_char;
@@ -466,7 +667,7 @@ int modem_info_short_get(enum modem_info info, uint16_t *buf)
 		return -EINVAL;
 	}
 
-	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE, modem_data[info]->cmd);
+	err = modem_info_at_cmd(recv_buf, modem_data[info]->cmd);
 	if (err != 0) {
 		return -EIO;
 	}
@@ -630,7 +831,7 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 
 	buf[0] = '\0';
 
-	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE, modem_data[info]->cmd);
+	err = modem_info_at_cmd(recv_buf, modem_data[info]->cmd);
 	if (err != 0) {
 		return -EIO;
 	}
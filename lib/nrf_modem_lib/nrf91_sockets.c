@@ -29,6 +29,7 @@
 #include <zephyr/net/conn_mgr_connectivity_impl.h>
 #include <zephyr/net/net_if.h>
 #include <zephyr/sys/util_macro.h>
+#include <modem/nrf_modem_lib.h>
 
 #if defined(CONFIG_POSIX_API)
 #include <zephyr/posix/poll.h>
@@ -678,12 +679,35 @@ static ssize_t nrf91_socket_offload_sendto(void *obj, const void *buf,
 	return retval;
 }
 
+/* Send a whole buffer, retrying on partial sends. Returns the number of bytes sent, or -1 if
+ * nothing could be sent.
+ */
+static ssize_t sendto_all(void *obj, const uint8_t *data, size_t len, int flags,
+			  const struct msghdr *msg)
+{
+	ssize_t ret;
+	size_t offset = 0;
+
+	while (offset < len) {
+		ret = nrf91_socket_offload_sendto(obj, data + offset, len - offset, flags,
+						  msg->msg_name, msg->msg_namelen);
+		if (ret < 0) {
+			return offset > 0 ? (ssize_t)offset : ret;
+		}
+		offset += ret;
+	}
+
+	return offset;
+}
+
 static ssize_t nrf91_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 					    int flags)
 {
 	ssize_t len = 0;
 	ssize_t ret;
-	ssize_t offset;
+	size_t buf_len;
+	size_t iov_count = 0;
+	const struct iovec *iov = NULL;
 	int i;
 	static K_MUTEX_DEFINE(sendmsg_lock);
 	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
@@ -693,66 +717,75 @@ static ssize_t nrf91_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 		return -1;
 	}
 
-	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
-	 */
-
 	for (i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len > 0) {
+			iov = &msg->msg_iov[i];
+			iov_count++;
+		}
 		len += msg->msg_iov[i].iov_len;
 	}
 
-	if (len <= sizeof(buf)) {
-		/* Protect `buf` access with a mutex. */
-		k_mutex_lock(&sendmsg_lock, K_FOREVER);
-		len = 0;
-
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			memcpy(buf + len, msg->msg_iov[i].iov_base,
-			       msg->msg_iov[i].iov_len);
-			len += msg->msg_iov[i].iov_len;
-		}
-
-		offset = 0;
-		ret = 0;
-		while ((offset < len) && (ret >= 0)) {
-			ret = nrf91_socket_offload_sendto(obj,
-				(buf + offset), (len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret > 0) {
-				offset += ret;
-			}
-		}
-
-		k_mutex_unlock(&sendmsg_lock);
-		return ret;
+	/* A single buffer is sent from where it is, there is nothing to gather. */
+	if (iov_count <= 1) {
+		return sendto_all(obj, iov ? iov->iov_base : NULL, len, flags, msg);
 	}
 
-	/* If the data won't fit into intermediate buffer, send the buffers
-	 * separately
-	 */
+	/* Protect `buf` access with a mutex. */
+	k_mutex_lock(&sendmsg_lock, K_FOREVER);
 
+	/* Try to reduce number of `sendto` calls - gather the buffers while they fit into the
+	 * intermediate buffer. Buffers that are larger than the intermediate buffer are sent
+	 * without copying them. If the whole message fits, it is sent with a single call.
+	 */
 	len = 0;
+	buf_len = 0;
 
 	for (i = 0; i < msg->msg_iovlen; i++) {
-		if (msg->msg_iov[i].iov_len == 0) {
-			continue;
-		}
+		const uint8_t *base = msg->msg_iov[i].iov_base;
+		size_t iov_len = msg->msg_iov[i].iov_len;
+
+		if (iov_len > sizeof(buf) - buf_len) {
+			if (buf_len > 0) {
+				ret = sendto_all(obj, buf, buf_len, flags, msg);
+				if ((size_t)ret != buf_len) {
+					goto exit;
+				}
+				len += ret;
+				buf_len = 0;
+			}
 
-		offset = 0;
-		while (offset < msg->msg_iov[i].iov_len) {
-			ret = nrf91_socket_offload_sendto(obj,
-				(((uint8_t *) msg->msg_iov[i].iov_base) + offset),
-				(msg->msg_iov[i].iov_len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret < 0) {
-				return ret;
+			if (iov_len > sizeof(buf)) {
+				ret = sendto_all(obj, base, iov_len, flags, msg);
+				if ((size_t)ret != iov_len) {
+					goto exit;
+				}
+				len += ret;
+				continue;
 			}
-			offset += ret;
+		}
+
+		memcpy(buf + buf_len, base, iov_len);
+		buf_len += iov_len;
+	}
+
+	ret = 0;
+	if (buf_len > 0) {
+		ret = sendto_all(obj, buf, buf_len, flags, msg);
+		if ((size_t)ret == buf_len) {
 			len += ret;
+			ret = 0;
 		}
 	}
 
-	return len;
+exit:
+	k_mutex_unlock(&sendmsg_lock);
+
+	if (ret < 0 && len == 0) {
+		return ret;
+	}
+
+	/* Partially sent, report what was sent. */
+	return len + MAX(ret, 0);
 }
 
 static void nrf91_socket_offload_freeaddrinfo(struct zsock_addrinfo *root)
@@ -768,10 +801,8 @@ static void nrf91_socket_offload_freeaddrinfo(struct zsock_addrinfo *root)
 	}
 }
 
-static int nrf91_socket_offload_getaddrinfo(const char *node,
-					    const char *service,
-					    const struct zsock_addrinfo *hints,
-					    struct zsock_addrinfo **res)
+static int getaddrinfo_modem(const char *node, const char *service,
+			     const struct zsock_addrinfo *hints, struct zsock_addrinfo **res)
 {
 	int err;
 	struct nrf_addrinfo nrf_hints;
@@ -839,6 +870,386 @@ error:
 	return retval;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_DNS_CACHE) || defined(CONFIG_NRF_MODEM_LIB_DNS_ASYNC)
+/* Longest service kept, fits port numbers and service names such as "https". */
+#define DNS_SERVICE_LEN 15
+#endif
+
+#if defined(CONFIG_NRF_MODEM_LIB_DNS_CACHE)
+enum dns_cache_state {
+	DNS_CACHE_FREE,
+	/* A lookup is in progress. */
+	DNS_CACHE_PENDING,
+	/* The lookup is done, the result is valid until it expires. */
+	DNS_CACHE_DONE,
+};
+
+struct dns_cache_addr {
+	int family;
+	int socktype;
+	int protocol;
+	socklen_t addrlen;
+	/* Use `struct sockaddr_in6` to fit both, IPv4 and IPv6 */
+	struct sockaddr_in6 addr;
+};
+
+struct dns_cache_entry {
+	enum dns_cache_state state;
+	/* Incremented each time the entry is taken for a new lookup. */
+	uint32_t gen;
+	/* Result of the lookup, zero or a DNS_EAI_* error code. */
+	int result;
+	int64_t expiry;
+	/* Lookup parameters. */
+	char node[CONFIG_NRF_MODEM_LIB_DNS_HOSTNAME_LEN + 1];
+	char service[DNS_SERVICE_LEN + 1];
+	int family;
+	int socktype;
+	int protocol;
+	int flags;
+	/* Resolved addresses. */
+	size_t addr_count;
+	struct dns_cache_addr addrs[CONFIG_NRF_MODEM_LIB_DNS_CACHE_ADDR_MAX];
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_NRF_MODEM_LIB_DNS_CACHE_SIZE];
+/* Incremented by nrf_modem_lib_dns_cache_flush(), so that lookups in progress are not kept. */
+static uint32_t dns_cache_flush_gen;
+static K_MUTEX_DEFINE(dns_cache_lock);
+/* Signalled when a lookup is done. */
+static K_CONDVAR_DEFINE(dns_cache_done);
+
+static bool dns_cache_is_cacheable(const char *node, const char *service,
+				   const struct zsock_addrinfo *hints)
+{
+	if (node == NULL || strlen(node) > CONFIG_NRF_MODEM_LIB_DNS_HOSTNAME_LEN) {
+		return false;
+	}
+
+	if (service != NULL && strlen(service) > DNS_SERVICE_LEN) {
+		return false;
+	}
+
+	/* Numeric hosts are not resolved over the network. */
+	return hints == NULL || !(hints->ai_flags & AI_NUMERICHOST);
+}
+
+static bool dns_cache_entry_matches(const struct dns_cache_entry *entry, const char *node,
+				    const char *service, const struct zsock_addrinfo *hints)
+{
+	return entry->state != DNS_CACHE_FREE &&
+	       strcmp(entry->node, node) == 0 &&
+	       strcmp(entry->service, service ? service : "") == 0 &&
+	       entry->family == (hints ? hints->ai_family : 0) &&
+	       entry->socktype == (hints ? hints->ai_socktype : 0) &&
+	       entry->protocol == (hints ? hints->ai_protocol : 0) &&
+	       entry->flags == (hints ? hints->ai_flags : 0);
+}
+
+static struct dns_cache_entry *dns_cache_find(const char *node, const char *service,
+					      const struct zsock_addrinfo *hints)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		if (dns_cache_entry_matches(&dns_cache[i], node, service, hints)) {
+			return &dns_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Get a free entry, or the one that expires first. */
+static struct dns_cache_entry *dns_cache_entry_alloc(void)
+{
+	struct dns_cache_entry *entry = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		if (dns_cache[i].state == DNS_CACHE_FREE) {
+			return &dns_cache[i];
+		}
+
+		if (dns_cache[i].state == DNS_CACHE_DONE &&
+		    (entry == NULL || dns_cache[i].expiry < entry->expiry)) {
+			entry = &dns_cache[i];
+		}
+	}
+
+	/* NULL if all entries have a lookup in progress. */
+	return entry;
+}
+
+/* Take an entry for a new lookup. */
+static void dns_cache_entry_claim(struct dns_cache_entry *entry, const char *node,
+				  const char *service, const struct zsock_addrinfo *hints)
+{
+	entry->state = DNS_CACHE_PENDING;
+	entry->gen++;
+	entry->addr_count = 0;
+	strcpy(entry->node, node);
+	strcpy(entry->service, service ? service : "");
+	entry->family = hints ? hints->ai_family : 0;
+	entry->socktype = hints ? hints->ai_socktype : 0;
+	entry->protocol = hints ? hints->ai_protocol : 0;
+	entry->flags = hints ? hints->ai_flags : 0;
+}
+
+static void dns_cache_store(struct dns_cache_entry *entry, int result,
+			    const struct zsock_addrinfo *res, uint32_t flush_gen)
+{
+	entry->result = result;
+	entry->state = DNS_CACHE_DONE;
+	entry->expiry = k_uptime_get();
+
+	for (; res != NULL && entry->addr_count < ARRAY_SIZE(entry->addrs); res = res->ai_next) {
+		struct dns_cache_addr *addr = &entry->addrs[entry->addr_count];
+
+		if (res->ai_addrlen > sizeof(addr->addr)) {
+			continue;
+		}
+
+		addr->family = res->ai_family;
+		addr->socktype = res->ai_socktype;
+		addr->protocol = res->ai_protocol;
+		addr->addrlen = res->ai_addrlen;
+		memcpy(&addr->addr, res->ai_addr, res->ai_addrlen);
+		entry->addr_count++;
+	}
+
+	/* Failed lookups, and lookups that were in progress during a flush, are only given to
+	 * the lookups that waited for them.
+	 */
+	if (result == 0 && flush_gen == dns_cache_flush_gen) {
+		entry->expiry += CONFIG_NRF_MODEM_LIB_DNS_CACHE_TTL * MSEC_PER_SEC;
+	}
+}
+
+/* Build an address list from a cache entry. The list is freed by freeaddrinfo(). */
+static int dns_cache_res_get(const struct dns_cache_entry *entry, struct zsock_addrinfo **res)
+{
+	struct zsock_addrinfo *latest_z_res = NULL;
+
+	if (entry->result != 0) {
+		return entry->result;
+	}
+
+	*res = NULL;
+
+	for (size_t i = 0; i < entry->addr_count; i++) {
+		const struct dns_cache_addr *addr = &entry->addrs[i];
+		struct zsock_addrinfo *next_z_res = k_calloc(1, sizeof(struct zsock_addrinfo));
+
+		if (next_z_res == NULL) {
+			nrf91_socket_offload_freeaddrinfo(*res);
+			*res = NULL;
+			return DNS_EAI_MEMORY;
+		}
+
+		next_z_res->ai_addr = k_malloc(addr->addrlen);
+		if (next_z_res->ai_addr == NULL) {
+			k_free(next_z_res);
+			nrf91_socket_offload_freeaddrinfo(*res);
+			*res = NULL;
+			return DNS_EAI_MEMORY;
+		}
+
+		next_z_res->ai_family = addr->family;
+		next_z_res->ai_socktype = addr->socktype;
+		next_z_res->ai_protocol = addr->protocol;
+		next_z_res->ai_addrlen = addr->addrlen;
+		memcpy(next_z_res->ai_addr, &addr->addr, addr->addrlen);
+
+		if (latest_z_res == NULL) {
+			*res = next_z_res;
+		} else {
+			latest_z_res->ai_next = next_z_res;
+		}
+		latest_z_res = next_z_res;
+	}
+
+	return *res != NULL ? 0 : DNS_EAI_NODATA;
+}
+
+static int dns_cache_getaddrinfo(const char *node, const char *service,
+				 const struct zsock_addrinfo *hints, struct zsock_addrinfo **res)
+{
+	struct dns_cache_entry *entry;
+	uint32_t flush_gen;
+	uint32_t gen;
+	int retval;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	while ((entry = dns_cache_find(node, service, hints)) != NULL) {
+		if (entry->state == DNS_CACHE_PENDING) {
+			/* Wait for the lookup in progress instead of sending the same query. */
+			gen = entry->gen;
+			while (entry->state == DNS_CACHE_PENDING && entry->gen == gen) {
+				k_condvar_wait(&dns_cache_done, &dns_cache_lock, K_FOREVER);
+			}
+
+			if (entry->gen != gen) {
+				/* The entry was taken for another lookup, look again. */
+				continue;
+			}
+		} else if (k_uptime_get() >= entry->expiry) {
+			/* Expired, resolve again using the same entry. */
+			break;
+		}
+
+		retval = dns_cache_res_get(entry, res);
+		k_mutex_unlock(&dns_cache_lock);
+		return retval;
+	}
+
+	if (entry == NULL) {
+		entry = dns_cache_entry_alloc();
+	}
+
+	if (entry != NULL) {
+		dns_cache_entry_claim(entry, node, service, hints);
+	}
+	flush_gen = dns_cache_flush_gen;
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	retval = getaddrinfo_modem(node, service, hints, res);
+
+	if (entry != NULL) {
+		k_mutex_lock(&dns_cache_lock, K_FOREVER);
+		dns_cache_store(entry, retval, retval == 0 ? *res : NULL, flush_gen);
+		k_condvar_broadcast(&dns_cache_done);
+		k_mutex_unlock(&dns_cache_lock);
+	}
+
+	return retval;
+}
+
+void nrf_modem_lib_dns_cache_flush(void)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		if (dns_cache[i].state == DNS_CACHE_DONE) {
+			dns_cache[i].state = DNS_CACHE_FREE;
+		}
+	}
+
+	dns_cache_flush_gen++;
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+#endif /* CONFIG_NRF_MODEM_LIB_DNS_CACHE */
+
+static int nrf91_socket_offload_getaddrinfo(const char *node,
+					    const char *service,
+					    const struct zsock_addrinfo *hints,
+					    struct zsock_addrinfo **res)
+{
+#if defined(CONFIG_NRF_MODEM_LIB_DNS_CACHE)
+	if (dns_cache_is_cacheable(node, service, hints)) {
+		return dns_cache_getaddrinfo(node, service, hints, res);
+	}
+#endif
+
+	return getaddrinfo_modem(node, service, hints, res);
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_DNS_ASYNC)
+struct dns_async_req {
+	struct k_work work;
+	char node[CONFIG_NRF_MODEM_LIB_DNS_HOSTNAME_LEN + 1];
+	char service[DNS_SERVICE_LEN + 1];
+	bool has_service;
+	struct zsock_addrinfo hints;
+	bool has_hints;
+	nrf_modem_lib_getaddrinfo_cb_t cb;
+	void *user_data;
+};
+
+static struct dns_async_req dns_async_reqs[CONFIG_NRF_MODEM_LIB_DNS_ASYNC_REQUESTS];
+static ATOMIC_DEFINE(dns_async_reqs_in_use, CONFIG_NRF_MODEM_LIB_DNS_ASYNC_REQUESTS);
+
+static struct k_work_q dns_async_work_q;
+static K_THREAD_STACK_DEFINE(dns_async_stack, CONFIG_NRF_MODEM_LIB_DNS_ASYNC_STACK_SIZE);
+
+static void dns_async_work_fn(struct k_work *work)
+{
+	struct dns_async_req *req = CONTAINER_OF(work, struct dns_async_req, work);
+	nrf_modem_lib_getaddrinfo_cb_t cb = req->cb;
+	void *user_data = req->user_data;
+	struct zsock_addrinfo *res = NULL;
+	int retval;
+
+	retval = nrf91_socket_offload_getaddrinfo(req->node,
+						  req->has_service ? req->service : NULL,
+						  req->has_hints ? &req->hints : NULL, &res);
+
+	/* Release the request first, so that the callback can start a new lookup. */
+	atomic_clear_bit(dns_async_reqs_in_use, req - dns_async_reqs);
+
+	cb(retval, retval == 0 ? res : NULL, user_data);
+}
+
+static void dns_async_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "nrf_modem_lib_dns",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(dns_async_reqs); i++) {
+		k_work_init(&dns_async_reqs[i].work, dns_async_work_fn);
+	}
+
+	k_work_queue_start(&dns_async_work_q, dns_async_stack,
+			   K_THREAD_STACK_SIZEOF(dns_async_stack),
+			   CONFIG_NRF_MODEM_LIB_DNS_ASYNC_PRIORITY, &cfg);
+}
+
+int nrf_modem_lib_getaddrinfo_async(const char *node, const char *service,
+				    const struct zsock_addrinfo *hints,
+				    nrf_modem_lib_getaddrinfo_cb_t cb, void *user_data)
+{
+	struct dns_async_req *req;
+
+	if (node == NULL || cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (strlen(node) > CONFIG_NRF_MODEM_LIB_DNS_HOSTNAME_LEN ||
+	    (service != NULL && strlen(service) > DNS_SERVICE_LEN)) {
+		return -ENAMETOOLONG;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(dns_async_reqs); i++) {
+		if (atomic_test_and_set_bit(dns_async_reqs_in_use, i)) {
+			continue;
+		}
+
+		req = &dns_async_reqs[i];
+		strcpy(req->node, node);
+		req->has_service = (service != NULL);
+		if (service != NULL) {
+			strcpy(req->service, service);
+		}
+		req->has_hints = (hints != NULL);
+		if (hints != NULL) {
+			req->hints = *hints;
+			req->hints.ai_next = NULL;
+			req->hints.ai_addr = NULL;
+			req->hints.ai_canonname = NULL;
+		}
+		req->cb = cb;
+		req->user_data = user_data;
+
+		k_work_submit_to_queue(&dns_async_work_q, &req->work);
+
+		return 0;
+	}
+
+	return -EAGAIN;
+}
+#endif /* CONFIG_NRF_MODEM_LIB_DNS_ASYNC */
+
 static int nrf91_socket_offload_fcntl(int fd, int cmd, va_list args)
 {
 	int retval;
@@ -1140,6 +1551,10 @@ static int nrf91_socket_offload_init(const struct device *arg)
 		offload_ctx[i].nrf_fd = -1;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_DNS_ASYNC)
+	dns_async_init();
+#endif
+
 	return 0;
 }
 
@@ -81,6 +81,7 @@ static uint32_t backend_bps_avg;
 static uint32_t backend_bps_tot;
 static uint32_t backend_bps_samples;
 static int64_t backend_measurement_start;
+static uint64_t backend_bytes_written;
 
 #define BACKEND_BPS_AVG_UPDATE_PERIOD K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS)
 
@@ -119,6 +120,24 @@ uint32_t nrf_modem_lib_trace_backend_bitrate_get(void)
 	return backend_bps_avg;
 }
 
+static uint64_t backend_bytes_dropped(void)
+{
+	return trace_backend.dropped_get ? trace_backend.dropped_get() : 0;
+}
+
+int nrf_modem_lib_trace_backend_stats_get(struct nrf_modem_lib_trace_backend_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	stats->bitrate = backend_bps_avg;
+	stats->bytes_written = backend_bytes_written;
+	stats->bytes_dropped = backend_bytes_dropped();
+
+	return 0;
+}
+
 static void trace_backend_bitrate_perf_start(void)
 {
 	backend_measurement_start = k_uptime_ticks();
@@ -131,6 +150,10 @@ static void trace_backend_bitrate_perf_end(int size)
 
 	delta = k_uptime_ticks() - backend_measurement_start;
 
+	if (size > 0) {
+		backend_bytes_written += size;
+	}
+
 	if (size > 0 && delta > 0) {
 		bps = size * 8 * CONFIG_SYS_CLOCK_TICKS_PER_SEC / delta;
 		backend_bps_update(bps);
@@ -158,7 +181,8 @@ K_WORK_DELAYABLE_DEFINE(backend_bps_log_work, backend_bps_log);
 
 static void backend_bps_log(struct k_work *item)
 {
-	LOG_INF("Trace backend bitrate (bps): %u", backend_bps_avg);
+	LOG_INF("Trace backend bitrate (bps): %u, dropped (bytes): %u", backend_bps_avg,
+		(uint32_t)backend_bytes_dropped());
 
 	k_work_schedule(&backend_bps_log_work, BACKEND_BPS_LOG_PERIOD);
 }
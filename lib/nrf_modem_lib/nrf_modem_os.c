@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <nrf_modem.h>
 #include <nrf_modem_os.h>
+#include <modem/nrf_modem_lib.h>
 #include <nrf.h>
 #include <nrfx_ipc.h>
 #include <nrf_errno.h>
@@ -18,6 +19,9 @@
 
 #define UNUSED_FLAGS 0
 #define THREAD_MONITOR_ENTRIES 10
+/* Number of wait buckets, must be a power of two. */
+#define WAIT_BUCKET_BITS 3
+#define WAIT_BUCKETS BIT(WAIT_BUCKET_BITS)
 
 LOG_MODULE_REGISTER(nrf_modem, CONFIG_NRF_MODEM_LIB_LOG_LEVEL);
 
@@ -41,14 +45,52 @@ static uint8_t library_heap_buf[CONFIG_NRF_MODEM_LIB_HEAP_SIZE];
 static struct thread_monitor_entry {
 	k_tid_t id; /* Thread ID. */
 	int cnt; /* Last RPC event count. */
+	uint32_t context; /* Context of the last wait. */
+	uint32_t context_cnt; /* Last RPC event count relevant to the context. */
 } thread_event_monitor[THREAD_MONITOR_ENTRIES];
 
-/* A list of threads that are sleeping and should be woken up on next event. */
-static sys_slist_t sleeping_threads;
+/* Threads sleeping on a context, grouped by a hash of the context, so that an event only
+ * wakes the threads waiting on that context.
+ */
+static struct wait_bucket {
+	/* Threads that are sleeping and should be woken up on next event. */
+	sys_slist_t sleeping_threads;
+	/* Number of events on the contexts in this bucket. */
+	uint32_t event_cnt;
+} wait_buckets[WAIT_BUCKETS];
+
+/* Threads sleeping on context 0, which are woken up on any event. */
+static sys_slist_t sleeping_threads_any;
 
 /* RPC event counter, incremented on each RPC event. */
 static atomic_t rpc_event_cnt;
 
+/* Number of events on context 0, which are relevant to all contexts. */
+static uint32_t broadcast_event_cnt;
+
+#if defined(CONFIG_NRF_MODEM_LIB_WAIT_STATS)
+static struct nrf_modem_lib_wait_stats wait_stats;
+#define WAIT_STATS_INC(field) (wait_stats.field++)
+#else
+#define WAIT_STATS_INC(field)
+#endif
+
+static struct wait_bucket *wait_bucket_get(uint32_t context)
+{
+	/* Multiplicative hashing, so that aligned contexts are spread over the buckets too. */
+	return &wait_buckets[(context * 2654435761U) >> (32 - WAIT_BUCKET_BITS)];
+}
+
+/* Number of RPC events that may have changed the state of the given context. */
+static uint32_t context_event_cnt(uint32_t context)
+{
+	if (context == 0) {
+		return rpc_event_cnt;
+	}
+
+	return broadcast_event_cnt + wait_bucket_get(context)->event_cnt;
+}
+
 /* Get thread monitor structure assigned to a specific thread id, with a RPC
  * counter value at which nrf_modem_lib last checked the 'readiness' of a thread
  */
@@ -77,27 +119,38 @@ static struct thread_monitor_entry *thread_monitor_entry_get(k_tid_t id)
 
 	new_entry->id = id;
 	new_entry->cnt = rpc_event_cnt - 1;
+	new_entry->context = 0;
 
 	return new_entry;
 }
 
-/* Update thread monitor entry RPC counter. */
-static void thread_monitor_entry_update(struct thread_monitor_entry *entry)
+/* Update thread monitor entry RPC counters. */
+static void thread_monitor_entry_update(struct thread_monitor_entry *entry, uint32_t context)
 {
 	entry->cnt = rpc_event_cnt;
+	entry->context = context;
+	entry->context_cnt = context_event_cnt(context);
 }
 
 /* Verify that thread can be put into sleep (no RPC event occured in a
  * meantime), or whether we should return to nrf_modem_lib to re-verify if a sleep is
  * needed.
+ *
+ * When the thread waits on the same context as last time, only events that would have woken
+ * it up on that context are considered. Otherwise, any event prevents the thread from sleeping.
  */
-static bool can_thread_sleep(struct thread_monitor_entry *entry)
+static bool can_thread_sleep(struct thread_monitor_entry *entry, uint32_t context)
 {
 	bool allow_to_sleep = true;
 
-	if (rpc_event_cnt != entry->cnt) {
-		thread_monitor_entry_update(entry);
-		allow_to_sleep = false;
+	if (context != 0 && context == entry->context) {
+		allow_to_sleep = (context_event_cnt(context) == entry->context_cnt);
+	} else {
+		allow_to_sleep = (rpc_event_cnt == entry->cnt);
+	}
+
+	if (!allow_to_sleep) {
+		thread_monitor_entry_update(entry, context);
 	}
 
 	return allow_to_sleep;
@@ -110,6 +163,15 @@ static void sleeping_thread_init(struct sleeping_thread *thread, uint32_t contex
 	thread->context = context;
 }
 
+static sys_slist_t *sleeping_thread_list_get(uint32_t context)
+{
+	if (context == 0) {
+		return &sleeping_threads_any;
+	}
+
+	return &wait_bucket_get(context)->sleeping_threads;
+}
+
 /* Add thread to the sleeping threads list. Will return information whether
  * the thread was allowed to sleep or not.
  */
@@ -122,9 +184,11 @@ static bool sleeping_thread_add(struct sleeping_thread *thread)
 
 	entry = thread_monitor_entry_get(k_current_get());
 
-	if (can_thread_sleep(entry)) {
+	if (can_thread_sleep(entry, thread->context)) {
 		allow_to_sleep = true;
-		sys_slist_append(&sleeping_threads, &thread->node);
+		sys_slist_append(sleeping_thread_list_get(thread->context), &thread->node);
+	} else {
+		WAIT_STATS_INC(sleeps_skipped);
 	}
 
 	irq_unlock(key);
@@ -133,20 +197,56 @@ static bool sleeping_thread_add(struct sleeping_thread *thread)
 }
 
 /* Remove a thread form the sleeping threads list. */
-static void sleeping_thread_remove(struct sleeping_thread *thread)
+static void sleeping_thread_remove(struct sleeping_thread *thread, bool timed_out)
 {
 	struct thread_monitor_entry *entry;
 
 	uint32_t key = irq_lock();
 
-	sys_slist_find_and_remove(&sleeping_threads, &thread->node);
+	sys_slist_find_and_remove(sleeping_thread_list_get(thread->context), &thread->node);
 
 	entry = thread_monitor_entry_get(k_current_get());
-	thread_monitor_entry_update(entry);
+	thread_monitor_entry_update(entry, thread->context);
+
+	if (timed_out) {
+		WAIT_STATS_INC(timeouts);
+	}
 
 	irq_unlock(key);
 }
 
+static void sleeping_threads_wake(sys_slist_t *list, uint32_t context)
+{
+	struct sleeping_thread *thread;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, thread, node) {
+		/* Wake sleeping thread if context of the thread matches, is 0 or the notify
+		 * context is 0.
+		 */
+		if ((thread->context == context) || (context == 0) || (thread->context == 0)) {
+			k_sem_give(&thread->sem);
+			WAIT_STATS_INC(wakeups);
+		}
+	}
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_WAIT_STATS)
+int nrf_modem_lib_wait_stats_get(struct nrf_modem_lib_wait_stats *stats)
+{
+	uint32_t key;
+
+	if (!stats) {
+		return -EFAULT;
+	}
+
+	key = irq_lock();
+	*stats = wait_stats;
+	irq_unlock(key);
+
+	return 0;
+}
+#endif
+
 void nrf_modem_os_busywait(int32_t usec)
 {
 	k_busy_wait(usec);
@@ -154,6 +254,7 @@ void nrf_modem_os_busywait(int32_t usec)
 
 int32_t nrf_modem_os_timedwait(uint32_t context, int32_t *timeout)
 {
+	int err;
 	struct sleeping_thread thread;
 	int64_t start, remaining;
 
@@ -190,9 +291,9 @@ int32_t nrf_modem_os_timedwait(uint32_t context, int32_t *timeout)
 #pragma GCC diagnostic pop
 #endif /* __GNUC__ */
 
-	(void)k_sem_take(&thread.sem, SYS_TIMEOUT_MS(*timeout));
+	err = k_sem_take(&thread.sem, SYS_TIMEOUT_MS(*timeout));
 
-	sleeping_thread_remove(&thread);
+	sleeping_thread_remove(&thread, err == -EAGAIN);
 
 	if (!nrf_modem_is_initialized()) {
 		return -NRF_ESHUTDOWN;
@@ -342,18 +443,26 @@ int nrf_modem_os_mutex_lock(void *mutex, int timeout)
 
 void nrf_modem_os_event_notify(uint32_t context)
 {
-	atomic_inc(&rpc_event_cnt);
+	uint32_t key = irq_lock();
 
-	struct sleeping_thread *thread;
+	atomic_inc(&rpc_event_cnt);
+	WAIT_STATS_INC(events);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&sleeping_threads, thread, node) {
-		/* Wake sleeping thread if context of the thread matches, is 0 or the notify
-		 * context is 0.
-		 */
-		if ((thread->context == context) || (context == 0) || (thread->context == 0)) {
-			k_sem_give(&thread->sem);
+	if (context == 0) {
+		broadcast_event_cnt++;
+		for (size_t i = 0; i < ARRAY_SIZE(wait_buckets); i++) {
+			sleeping_threads_wake(&wait_buckets[i].sleeping_threads, context);
 		}
+	} else {
+		struct wait_bucket *bucket = wait_bucket_get(context);
+
+		bucket->event_cnt++;
+		sleeping_threads_wake(&bucket->sleeping_threads, context);
 	}
+
+	sleeping_threads_wake(&sleeping_threads_any, context);
+
+	irq_unlock(key);
 }
 
 void *nrf_modem_os_alloc(size_t bytes)
@@ -475,7 +584,10 @@ static int on_init(void)
 	 * initialization. This is because we want to keep the list intact regardless of modem
 	 * reinitialization to wake sleeping threads on modem initialization.
 	 */
-	sys_slist_init(&sleeping_threads);
+	for (size_t i = 0; i < ARRAY_SIZE(wait_buckets); i++) {
+		sys_slist_init(&wait_buckets[i].sleeping_threads);
+	}
+	sys_slist_init(&sleeping_threads_any);
 	atomic_clear(&rpc_event_cnt);
 
 	return 0;
@@ -494,12 +606,11 @@ void nrf_modem_os_init(void)
 
 void nrf_modem_os_shutdown(void)
 {
-	struct sleeping_thread *thread;
-
 	/* Wake up all sleeping threads. */
-	SYS_SLIST_FOR_EACH_CONTAINER(&sleeping_threads, thread, node) {
-		k_sem_give(&thread->sem);
+	for (size_t i = 0; i < ARRAY_SIZE(wait_buckets); i++) {
+		sleeping_threads_wake(&wait_buckets[i].sleeping_threads, 0);
 	}
+	sleeping_threads_wake(&sleeping_threads_any, 0);
 }
 
 SYS_INIT(on_init, POST_KERNEL, 0);
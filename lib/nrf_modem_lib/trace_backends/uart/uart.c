@@ -9,6 +9,10 @@
 #include <zephyr/logging/log.h>
 #include <modem/trace_backend.h>
 #include <zephyr/pm/device.h>
+#include <zephyr/sys/byteorder.h>
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_LZ4)
+#include <lz4.h>
+#endif
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
@@ -21,18 +25,233 @@ static const struct device *const uart_dev = DEVICE_DT_GET(UART_DEVICE_NODE);
 #define UART_TX_WAIT_TIME_MS 1000
 /* Maximum UART transfer attempts. */
 #define UART_TX_RETRIES 5
+/* Maximum length of a single UART transfer, limited by the EasyDMA MAXCNT register. */
+#define UART_TX_MAX_LEN ((1 << UARTE1_EASYDMA_MAXCNT_SIZE) - 1)
 
 /* Semaphores used to synchronize UART transfers. */
 static K_SEM_DEFINE(tx_sem, 0, 1);
+#if !defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
 static K_SEM_DEFINE(tx_done_sem, 0, 1);
 /* Number of bytes that were transferred successfully in last transmission. */
 static int tx_bytes;
+#endif
 
 /* Callback to notify the trace library when trace data is processed. */
 static trace_backend_processed_cb trace_processed_callback;
 
 static bool suspended;
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+#define TX_BUF_COUNT CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUF_COUNT
+/* Amount of trace data gathered before a buffer is sent. */
+#define FILL_SIZE CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUF_SIZE
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_LZ4)
+/* Magic number starting an LZ4 legacy frame. */
+#define LZ4_LEGACY_MAGIC 0x184C2102
+/* Each block in a legacy frame is preceded by its compressed size. */
+#define LZ4_BLOCK_HDR_SIZE 4
+#define LZ4_BLOCK_MAX_SIZE LZ4_COMPRESSBOUND(FILL_SIZE)
+#define TX_BUF_SIZE (sizeof(uint32_t) + LZ4_BLOCK_HDR_SIZE + LZ4_BLOCK_MAX_SIZE)
+
+/* Trace data waiting to be compressed into the buffer being filled. */
+static uint8_t lz4_src[FILL_SIZE];
+static LZ4_stream_t lz4_state;
+/* Start a new frame in the next buffer. */
+static bool lz4_magic_pending;
+#define FILL_DATA lz4_src
+#else
+#define TX_BUF_SIZE FILL_SIZE
+#define FILL_DATA fill_buf->data
+#endif
+
+struct tx_buf {
+	/* Number of bytes to send. */
+	size_t len;
+	/* Number of bytes sent so far. */
+	size_t sent;
+	/* Consecutive transfers that timed out without sending anything. */
+	uint8_t retries;
+	uint8_t data[TX_BUF_SIZE];
+};
+
+static struct tx_buf tx_bufs[TX_BUF_COUNT];
+static bool tx_bufs_initialized;
+
+/* Buffers free to be filled. */
+K_MSGQ_DEFINE(trace_uart_free_msgq, sizeof(struct tx_buf *), TX_BUF_COUNT, sizeof(void *));
+/* Buffers waiting to be sent, in order. */
+K_MSGQ_DEFINE(trace_uart_ready_msgq, sizeof(struct tx_buf *), TX_BUF_COUNT, sizeof(void *));
+
+/* Buffer being sent, NULL if the UART is idle. Protected by tx_lock. */
+static struct tx_buf *tx_active;
+static struct k_spinlock tx_lock;
+
+/* Buffer being filled and the number of trace bytes gathered for it.
+ * Protected by fill_mutex.
+ */
+static struct tx_buf *fill_buf;
+static size_t fill_len;
+static K_MUTEX_DEFINE(fill_mutex);
+
+/* Number of trace bytes that could not be sent. */
+static atomic_t tx_dropped;
+
+static void fill_flush_work_fn(struct k_work *work);
+static K_WORK_DEFINE(fill_flush_work, fill_flush_work_fn);
+
+/* Start the next transfer, from the active buffer or the next ready buffer.
+ * Must be called with tx_lock held.
+ */
+static void tx_continue(void)
+{
+	int err;
+	size_t len;
+
+	while (true) {
+		if (tx_active && tx_active->sent >= tx_active->len) {
+			(void)k_msgq_put(&trace_uart_free_msgq, &tx_active, K_NO_WAIT);
+			tx_active = NULL;
+		}
+
+		if (!tx_active && k_msgq_get(&trace_uart_ready_msgq, &tx_active, K_NO_WAIT)) {
+			/* Nothing more to send */
+			tx_active = NULL;
+			return;
+		}
+
+		len = MIN(tx_active->len - tx_active->sent, UART_TX_MAX_LEN);
+
+		err = uart_tx(uart_dev, &tx_active->data[tx_active->sent], len,
+			      UART_TX_WAIT_TIME_MS * USEC_PER_MSEC);
+		if (!err) {
+			return;
+		}
+
+		LOG_ERR("uart error: %d", err);
+		atomic_add(&tx_dropped, tx_active->len - tx_active->sent);
+		tx_active->sent = tx_active->len;
+	}
+}
+
+static void tx_done(enum uart_event_type type, size_t len)
+{
+	bool idle;
+	k_spinlock_key_t key = k_spin_lock(&tx_lock);
+
+	if (!tx_active) {
+		k_spin_unlock(&tx_lock, key);
+		return;
+	}
+
+	tx_active->sent += len;
+
+	if (type == UART_TX_ABORTED && len == 0 && ++tx_active->retries >= UART_TX_RETRIES) {
+		atomic_add(&tx_dropped, tx_active->len - tx_active->sent);
+		tx_active->sent = tx_active->len;
+	} else if (len) {
+		tx_active->retries = 0;
+	}
+
+	tx_continue();
+	idle = (tx_active == NULL);
+
+	k_spin_unlock(&tx_lock, key);
+
+	if (idle) {
+		/* Send what has been gathered while the UART was busy. */
+		k_work_submit(&fill_flush_work);
+	}
+}
+
+/* Queue the buffer being filled for sending. Must be called with fill_mutex held. */
+static void fill_flush(void)
+{
+	k_spinlock_key_t key;
+
+	if (!fill_buf) {
+		return;
+	}
+
+	if (fill_len == 0) {
+		(void)k_msgq_put(&trace_uart_free_msgq, &fill_buf, K_NO_WAIT);
+		fill_buf = NULL;
+		return;
+	}
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_LZ4)
+	uint8_t *dst = fill_buf->data;
+	int compressed;
+
+	if (lz4_magic_pending) {
+		sys_put_le32(LZ4_LEGACY_MAGIC, dst);
+		dst += sizeof(uint32_t);
+		lz4_magic_pending = false;
+	}
+
+	/* Cannot fail, the block is sized for incompressible data. */
+	compressed = LZ4_compress_fast_extState(&lz4_state, (const char *)lz4_src,
+						(char *)dst + LZ4_BLOCK_HDR_SIZE, fill_len,
+						LZ4_BLOCK_MAX_SIZE, 1);
+	__ASSERT_NO_MSG(compressed > 0);
+
+	sys_put_le32(compressed, dst);
+	fill_buf->len = (dst - fill_buf->data) + LZ4_BLOCK_HDR_SIZE + compressed;
+#else
+	fill_buf->len = fill_len;
+#endif
+	fill_buf->sent = 0;
+	fill_buf->retries = 0;
+
+	/* Cannot fail, there are as many slots as buffers. */
+	(void)k_msgq_put(&trace_uart_ready_msgq, &fill_buf, K_NO_WAIT);
+	fill_buf = NULL;
+	fill_len = 0;
+
+	key = k_spin_lock(&tx_lock);
+	if (!tx_active) {
+		tx_continue();
+	}
+	k_spin_unlock(&tx_lock, key);
+}
+
+static void fill_flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&fill_mutex, K_FOREVER);
+	fill_flush();
+	k_mutex_unlock(&fill_mutex);
+}
+
+/* Send all gathered trace data and wait for the UART to finish. */
+static int tx_drain(void)
+{
+	int err = 0;
+	int i;
+	struct tx_buf *bufs[TX_BUF_COUNT];
+
+	k_mutex_lock(&fill_mutex, K_FOREVER);
+	fill_flush();
+	k_mutex_unlock(&fill_mutex);
+
+	for (i = 0; i < TX_BUF_COUNT; i++) {
+		err = k_msgq_get(&trace_uart_free_msgq, &bufs[i],
+				 K_MSEC(UART_TX_WAIT_TIME_MS * UART_TX_RETRIES));
+		if (err) {
+			LOG_WRN("Timed out waiting for UART transfers to complete");
+			break;
+		}
+	}
+
+	while (i--) {
+		(void)k_msgq_put(&trace_uart_free_msgq, &bufs[i], K_NO_WAIT);
+	}
+
+	return err;
+}
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED */
+
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	ARG_UNUSED(dev);
@@ -41,8 +260,12 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	switch (evt->type) {
 	case UART_TX_DONE:
 	case UART_TX_ABORTED:
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+		tx_done(evt->type, evt->data.tx.len);
+#else
 		tx_bytes = evt->data.tx.len;
 		k_sem_give(&tx_done_sem);
+#endif
 		break;
 	case UART_RX_DISABLED:
 		LOG_INF("Disabled UART RX");
@@ -93,6 +316,20 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 		return -EFAULT;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+	if (!tx_bufs_initialized) {
+		for (size_t i = 0; i < TX_BUF_COUNT; i++) {
+			struct tx_buf *buf = &tx_bufs[i];
+
+			(void)k_msgq_put(&trace_uart_free_msgq, &buf, K_NO_WAIT);
+		}
+		tx_bufs_initialized = true;
+	}
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_LZ4)
+	lz4_magic_pending = true;
+#endif
+#endif
+
 	k_sem_give(&tx_sem);
 
 	return 0;
@@ -100,9 +337,69 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 
 int trace_backend_deinit(void)
 {
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+	(void)tx_drain();
+#endif
 	return 0;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+int trace_backend_write(const void *data, size_t len)
+{
+	int err;
+	size_t n;
+	struct tx_buf *buf;
+
+	if (suspended) {
+		return -EPERM;
+	}
+
+	k_mutex_lock(&fill_mutex, K_FOREVER);
+
+	if (!fill_buf) {
+		/* Don't hold the mutex while waiting, so that the flush work is not blocked. Only
+		 * this function assigns a buffer to be filled.
+		 */
+		k_mutex_unlock(&fill_mutex);
+
+		err = k_msgq_get(&trace_uart_free_msgq, &buf, K_MSEC(UART_TX_WAIT_TIME_MS));
+		if (err) {
+			return -EAGAIN;
+		}
+
+		k_mutex_lock(&fill_mutex, K_FOREVER);
+		fill_buf = buf;
+		fill_len = 0;
+	}
+
+	n = MIN(len, FILL_SIZE - fill_len);
+	memcpy(&FILL_DATA[fill_len], data, n);
+	fill_len += n;
+
+	/* Send right away if the UART is idle, otherwise keep gathering until the buffer is full
+	 * or the UART is done with the previous buffers.
+	 */
+	if (fill_len == FILL_SIZE || !tx_active) {
+		fill_flush();
+	}
+
+	k_mutex_unlock(&fill_mutex);
+
+	/* The data has been copied, so the modem can reuse the trace memory. */
+	err = trace_processed_callback(n);
+	if (err) {
+		return err;
+	}
+
+	return n;
+}
+
+size_t trace_backend_dropped_get(void)
+{
+	return atomic_get(&tx_dropped);
+}
+#else
+
 /* Returns the number of bytes written, or negative error. */
 static int uart_send(const uint8_t *data, size_t len)
 {
@@ -133,7 +430,6 @@ int trace_backend_write(const void *data, size_t len)
 
 	/* Split RAM buffer into smaller chunks to be transferred using DMA. */
 	uint8_t *buf = (uint8_t *)data;
-	const size_t MAX_BUF_LEN = (1 << UARTE1_EASYDMA_MAXCNT_SIZE) - 1;
 	size_t remaining_bytes = len;
 
 	if (suspended) {
@@ -143,7 +439,7 @@ int trace_backend_write(const void *data, size_t len)
 	k_sem_take(&tx_sem, K_FOREVER);
 
 	while (remaining_bytes) {
-		size_t transfer_len = MIN(remaining_bytes, MAX_BUF_LEN);
+		size_t transfer_len = MIN(remaining_bytes, UART_TX_MAX_LEN);
 		size_t idx = len - remaining_bytes;
 
 		ret = uart_send(&buf[idx], transfer_len);
@@ -175,12 +471,17 @@ out:
 
 	return ret;
 }
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED */
 
 int trace_backend_suspend(void)
 {
 #if CONFIG_PM_DEVICE
 	int err;
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+	(void)tx_drain();
+#endif
+
 	err = pm_device_action_run(uart_dev, PM_DEVICE_ACTION_SUSPEND);
 	if (err) {
 		LOG_ERR("pm_device_action_run() failed (%d)\n", err);
@@ -214,5 +515,8 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
 	.suspend = trace_backend_suspend,
-	.resume = trace_backend_resume
+	.resume = trace_backend_resume,
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_BUFFERED)
+	.dropped_get = trace_backend_dropped_get,
+#endif
 };
@@ -6,94 +6,172 @@
 
 #include "pcm_mix.h"
 
+#include <string.h>
 #include <zephyr/kernel.h>
 
+#if CONFIG_PCM_MIX_DSP
+#include <arm_acle.h>
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
+#if CONFIG_PCM_MIX_DSP && defined(__ARM_FEATURE_SIMD32)
+#define PCM_MIX_SIMD 1
+#else
+#define PCM_MIX_SIMD 0
+#endif
+
+#define INT24_MIN (-(1 << 23))
+#define INT24_MAX ((1 << 23) - 1)
+
+/* Placement of the samples of buffer B in buffer A */
+struct mix_layout {
+	/* Number of samples in buffer A per sample of buffer B */
+	uint8_t a_stride;
+	/* Mix into the first sample of the stride */
+	bool first;
+	/* Mix into the second sample of the stride */
+	bool second;
+};
+
 /* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+static inline int32_t hard_limiter_16(int32_t pcm)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	return CLAMP(pcm, INT16_MIN, INT16_MAX);
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline int32_t hard_limiter_24(int32_t pcm)
 {
-	int32_t res;
-
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+#if PCM_MIX_SIMD
+	return __ssat(pcm, 24);
+#else
+	return CLAMP(pcm, INT24_MIN, INT24_MAX);
+#endif
+}
 
-		hard_limiter(&res);
+static inline int32_t add_sat_32(int32_t a, int32_t b)
+{
+#if PCM_MIX_SIMD
+	return __qadd(a, b);
+#else
+	int64_t res = (int64_t)a + b;
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
-	}
+	return (int32_t)CLAMP(res, INT32_MIN, INT32_MAX);
+#endif
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static inline int32_t sample_get(const uint8_t *p, uint8_t bytes)
 {
-	int32_t res;
-
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	int32_t val;
+
+	if (bytes == sizeof(int32_t)) {
+		memcpy(&val, p, sizeof(val));
+	} else {
+		/* Sign extend packed 24-bit sample */
+		val = (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) |
+				((uint32_t)p[2] << 24)) >> 8;
+	}
 
-		hard_limiter(&res);
+	return val;
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+static inline void sample_set(uint8_t *p, uint8_t bytes, int32_t val)
+{
+	if (bytes == sizeof(int32_t)) {
+		memcpy(p, &val, sizeof(val));
+	} else {
+		p[0] = (uint8_t)val;
+		p[1] = (uint8_t)(val >> 8);
+		p[2] = (uint8_t)(val >> 16);
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static inline int32_t sample_mix(int32_t a, int32_t b, uint8_t bytes)
 {
-	int32_t res;
+	if (bytes == sizeof(int32_t)) {
+		return add_sat_32(a, b);
+	}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	return hard_limiter_24(a + b);
+}
 
-		hard_limiter(&res);
+/* Mix 16-bit samples. Two samples are mixed per instruction if the DSP extension is used. */
+static void pcm_mix_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b,
+		       struct mix_layout layout)
+{
+	size_t i = 0;
+
+#if PCM_MIX_SIMD
+	if (layout.a_stride == 1) {
+		for (; i + 1 < samples_b; i += 2) {
+			int16x2_t a;
+			int16x2_t b;
+
+			memcpy(&a, &pcm_a[i], sizeof(a));
+			memcpy(&b, &pcm_b[i], sizeof(b));
+			a = __qadd16(a, b);
+			memcpy(&pcm_a[i], &a, sizeof(a));
+		}
+	} else {
+		const uint32_t mask = (layout.first ? 0x0000FFFF : 0) |
+				      (layout.second ? 0xFFFF0000 : 0);
+
+		for (; i < samples_b; i++) {
+			uint16_t b_mono = (uint16_t)pcm_b[i];
+			int16x2_t a;
+			int16x2_t b = (int16x2_t)((((uint32_t)b_mono << 16) | b_mono) & mask);
+
+			memcpy(&a, &pcm_a[i * 2], sizeof(a));
+			a = __qadd16(a, b);
+			memcpy(&pcm_a[i * 2], &a, sizeof(a));
+		}
+	}
+#endif
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+	for (; i < samples_b; i++) {
+		int16_t *a = &pcm_a[i * layout.a_stride];
+
+		if (layout.first) {
+			a[0] = (int16_t)hard_limiter_16(a[0] + pcm_b[i]);
+		}
+		if (layout.second) {
+			a[1] = (int16_t)hard_limiter_16(a[1] + pcm_b[i]);
+		}
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix packed 24-bit or 32-bit samples */
+static void pcm_mix_wide(uint8_t *pcm_a, uint8_t const *pcm_b, size_t samples_b, uint8_t bytes,
+			 struct mix_layout layout)
 {
-	int32_t res;
-
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
-
-		hard_limiter(&res);
+	for (size_t i = 0; i < samples_b; i++) {
+		int32_t b = sample_get(&pcm_b[i * bytes], bytes);
+		uint8_t *a = &pcm_a[i * layout.a_stride * bytes];
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+		if (layout.first) {
+			sample_set(a, bytes, sample_mix(sample_get(a, bytes), b, bytes));
+		}
+		if (layout.second) {
+			a += bytes;
+			sample_set(a, bytes, sample_mix(sample_get(a, bytes), b, bytes));
+		}
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_bit_depth(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		      enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
 {
+	struct mix_layout layout;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	if (pcm_bit_depth != 16 && pcm_bit_depth != 24 && pcm_bit_depth != 32) {
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
@@ -106,30 +184,44 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		if (size_b > size_a) {
 			return -EPERM;
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
+		layout = (struct mix_layout){ .a_stride = 1, .first = true, .second = false };
 		break;
 	case B_MONO_INTO_A_STEREO_LR:
 		if (size_b > (size_a / 2)) {
 			return -EPERM;
 		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
+		layout = (struct mix_layout){ .a_stride = 2, .first = true, .second = true };
 		break;
 	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
 		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
+			LOG_ERR("size a %zu size b %zu", size_a, size_b);
 			return -EPERM;
 		}
+		layout = (struct mix_layout){ .a_stride = 2, .first = true, .second = false };
 		break;
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
 		if (size_b > (size_a / 2)) {
 			return -EPERM;
 		}
+		layout = (struct mix_layout){ .a_stride = 2, .first = false, .second = true };
 		break;
 	default:
 		return -ESRCH;
 	};
 
+	uint8_t bytes = pcm_bit_depth / 8;
+
+	if (bytes == sizeof(int16_t)) {
+		pcm_mix_16(pcm_a, pcm_b, size_b / bytes, layout);
+	} else {
+		pcm_mix_wide(pcm_a, pcm_b, size_b / bytes, bytes, layout);
+	}
+
 	return 0;
 }
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_bit_depth(pcm_a, size_a, pcm_b, size_b, mix_mode, 16);
+}
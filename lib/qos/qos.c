@@ -66,7 +66,7 @@ static void notify_event(struct qos_evt *evt)
 
 STATIC void timeout_handler_work_fn(struct k_work *work)
 {
-	struct qos_metadata *node = NULL, *next_node = NULL;
+	struct qos_metadata *node = NULL, *next_node = NULL, *node_prev = NULL;
 	struct qos_evt evt = {
 		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST
 	};
@@ -74,7 +74,8 @@ STATIC void timeout_handler_work_fn(struct k_work *work)
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
 	/* Remove all messages where the notified_count equals or exceeds
-	 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
+	 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX. The previous node is tracked so that expired
+	 * messages are unlinked in a single pass over the list.
 	 */
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
@@ -83,8 +84,12 @@ STATIC void timeout_handler_work_fn(struct k_work *work)
 			evt.message = node->message;
 			notify_event(&evt);
 			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_find_and_remove(&ctx.pending_list, &node->header);
+			sys_slist_remove(&ctx.pending_list,
+					 node_prev ? &node_prev->header : NULL, &node->header);
+			continue;
 		}
+
+		node_prev = node;
 	};
 
 	/* Don't shedule a new work if the pending list is empty. */
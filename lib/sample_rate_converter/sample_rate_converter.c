@@ -14,26 +14,6 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
 
-/**
- * The input buffer must be able to store two samples in addition to the block size to meet
- * filter requirements.
- */
-#define INTERNAL_INPUT_BUF_NUMBER_SAMPLES                                                          \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
-	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
-
-#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
-#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
-#endif
-
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
 	if (sample_rate_input > sample_rate_output) {
@@ -210,9 +190,6 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 	uint8_t *write_ptr;
 	size_t samples_to_process;
 
-	uint8_t internal_input_buf[SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE];
-	uint8_t internal_output_buf[SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE];
-
 #if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
 	size_t bytes_per_sample = sizeof(uint16_t);
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
@@ -273,8 +250,8 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 	}
 
 	if (ctx->conversion_ratio == 3) {
-		read_ptr = internal_input_buf;
-		write_ptr = internal_output_buf;
+		read_ptr = ctx->internal_input_buf;
+		write_ptr = ctx->internal_output_buf;
 
 		if (((samples_in + (ctx->input_buf.bytes_in_buf * bytes_per_sample)) %
 		     ctx->conversion_ratio) == 0) {
@@ -294,8 +271,8 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		/* Merge bytes in input buffer and incoming bytes into the internal buffer
 		 * for processing
 		 */
-		memcpy(internal_input_buf, ctx->input_buf.buf, ctx->input_buf.bytes_in_buf);
-		memcpy(internal_input_buf + ctx->input_buf.bytes_in_buf, input, input_size);
+		memcpy(ctx->internal_input_buf, ctx->input_buf.buf, ctx->input_buf.bytes_in_buf);
+		memcpy(ctx->internal_input_buf + ctx->input_buf.bytes_in_buf, input, input_size);
 	} else {
 		write_ptr = output;
 		read_ptr = input;
@@ -343,7 +320,7 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 	}
 
 	int bytes_to_write = samples_to_process * ctx->conversion_ratio * bytes_per_sample;
-	uint8_t *ringbuf_write_ptr = (uint8_t *)internal_output_buf;
+	uint8_t *ringbuf_write_ptr = (uint8_t *)ctx->internal_output_buf;
 
 	LOG_DBG("Writing %d bytes to output buffer", bytes_to_write);
 	while (bytes_to_write) {
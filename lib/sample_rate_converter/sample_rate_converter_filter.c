@@ -301,3 +301,497 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 	return 0;
 }
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * Polyphase filter bank for conversion between 44.1 kHz and 48 kHz.
+ *
+ * The prototype is a 1024 tap Kaiser windowed sinc (beta 7) with the cut-off at 0.42 times the
+ * input sample rate, split into 32 phases of 32 taps. Each phase is stored in reverse order so it
+ * can be applied with a dot product directly on the history buffer. One extra phase, the first
+ * phase delayed by one input sample, allows interpolating between all neighbouring phases. Each
+ * phase has a gain of 1.
+ */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static const q15_t filter_polyphase_16bit[SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES + 1]
+					 [SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS] = {
+	{
+		0x000C, 0xFFED, 0x000C, 0x001D, 0xFF8B, 0x00F4, 0xFE90, 0x0196, 0xFF01, 0xFF4D,
+		0x03A3, 0xF867, 0x0BF6, 0xF03B, 0x11A1, 0x6B7C, 0x1528, 0xEF18, 0x0C2E, 0xF89C,
+		0x0348, 0xFFA4, 0xFEC3, 0x01B8, 0xFE86, 0x00F1, 0xFF94, 0x0015, 0x0011, 0xFFEB,
+		0x000C, 0xFFFC
+	},
+	{
+		0x000B, 0xFFEF, 0x0007, 0x0024, 0xFF84, 0x00F5, 0xFE9D, 0x0173, 0xFF40, 0xFEF9,
+		0x03F6, 0xF840, 0x0BAB, 0xF170, 0x0E33, 0x6B3C, 0x18C5, 0xEE09, 0x0C51, 0xF8E0,
+		0x02E5, 0xFFFE, 0xFE85, 0x01D7, 0xFE7E, 0x00EB, 0xFF9D, 0x000D, 0x0016, 0xFFE9,
+		0x000D, 0xFFFC
+	},
+	{
+		0x000A, 0xFFF2, 0x0002, 0x002B, 0xFF7E, 0x00F5, 0xFEAC, 0x014D, 0xFF7F, 0xFEA8,
+		0x0441, 0xF828, 0x0B4E, 0xF2B3, 0x0AE1, 0x6ABF, 0x1C75, 0xED11, 0x0C60, 0xF932,
+		0x027A, 0x0059, 0xFE49, 0x01F4, 0xFE79, 0x00E5, 0xFFA7, 0x0005, 0x001B, 0xFFE6,
+		0x000E, 0xFFFC
+	},
+	{
+		0x0009, 0xFFF4, 0xFFFE, 0x0031, 0xFF79, 0x00F3, 0xFEBC, 0x0126, 0xFFBE, 0xFE5B,
+		0x0482, 0xF81D, 0x0ADF, 0xF403, 0x07AE, 0x6A03, 0x2036, 0xEC31, 0x0C59, 0xF991,
+		0x0209, 0x00B6, 0xFE0E, 0x020D, 0xFE76, 0x00DC, 0xFFB2, 0xFFFC, 0x001F, 0xFFE4,
+		0x000E, 0xFFFC
+	},
+	{
+		0x0009, 0xFFF6, 0xFFFA, 0x0036, 0xFF75, 0x00F0, 0xFECF, 0x00FE, 0xFFFC, 0xFE13,
+		0x04BB, 0xF821, 0x0A60, 0xF55D, 0x049C, 0x6909, 0x2403, 0xEB6D, 0x0C3B, 0xF9FF,
+		0x0192, 0x0114, 0xFDD6, 0x0224, 0xFE76, 0x00D1, 0xFFBE, 0xFFF3, 0x0024, 0xFFE3,
+		0x000F, 0xFFFC
+	},
+	{
+		0x0008, 0xFFF8, 0xFFF6, 0x003B, 0xFF72, 0x00EB, 0xFEE3, 0x00D5, 0x0038, 0xFDCF,
+		0x04EA, 0xF832, 0x09D2, 0xF6BE, 0x01AD, 0x67D3, 0x27D9, 0xEAC6, 0x0C07, 0xFA79,
+		0x0116, 0x0171, 0xFDA0, 0x0237, 0xFE79, 0x00C5, 0xFFCB, 0xFFEA, 0x0029, 0xFFE1,
+		0x000F, 0xFFFC
+	},
+	{
+		0x0007, 0xFFFB, 0xFFF2, 0x0040, 0xFF70, 0x00E4, 0xFEF9, 0x00AC, 0x0073, 0xFD91,
+		0x050F, 0xF851, 0x0937, 0xF823, 0xFEE4, 0x6662, 0x2BB4, 0xEA40, 0x0BBC, 0xFB01,
+		0x0095, 0x01CE, 0xFD6E, 0x0247, 0xFE7E, 0x00B7, 0xFFD9, 0xFFE1, 0x002E, 0xFFDF,
+		0x000F, 0xFFFC
+	},
+	{
+		0x0006, 0xFFFD, 0xFFEE, 0x0044, 0xFF70, 0x00DC, 0xFF10, 0x0082, 0x00AC, 0xFD58,
+		0x052B, 0xF87C, 0x088F, 0xF98C, 0xFC42, 0x64B8, 0x2F92, 0xE9DA, 0x0B5A, 0xFB94,
+		0x0010, 0x022A, 0xFD3F, 0x0253, 0xFE87, 0x00A7, 0xFFE7, 0xFFD7, 0x0032, 0xFFDE,
+		0x000F, 0xFFFC
+	},
+	{
+		0x0005, 0xFFFF, 0xFFEB, 0x0047, 0xFF70, 0x00D3, 0xFF28, 0x0059, 0x00E2, 0xFD26,
+		0x053D, 0xF8B4, 0x07DC, 0xFAF4, 0xF9C9, 0x62D6, 0x336D, 0xE999, 0x0AE1, 0xFC33,
+		0xFF88, 0x0284, 0xFD14, 0x025B, 0xFE92, 0x0096, 0xFFF6, 0xFFCE, 0x0037, 0xFFDD,
+		0x000F, 0xFFFC
+	},
+	{
+		0x0004, 0x0001, 0xFFE8, 0x004A, 0xFF71, 0x00C9, 0xFF41, 0x002F, 0x0116, 0xFCF9,
+		0x0545, 0xF8F7, 0x0720, 0xFC5A, 0xF77B, 0x60BD, 0x3743, 0xE97D, 0x0A51, 0xFCDC,
+		0xFEFF, 0x02DB, 0xFCED, 0x025F, 0xFEA0, 0x0083, 0x0006, 0xFFC5, 0x003B, 0xFFDC,
+		0x000F, 0xFFFD
+	},
+	{
+		0x0003, 0x0003, 0xFFE5, 0x004C, 0xFF73, 0x00BD, 0xFF5B, 0x0007, 0x0146, 0xFCD2,
+		0x0545, 0xF945, 0x065C, 0xFDBB, 0xF558, 0x5E72, 0x3B10, 0xE989, 0x09AB, 0xFD8E,
+		0xFE74, 0x032F, 0xFCCB, 0x025F, 0xFEB1, 0x006F, 0x0015, 0xFFBB, 0x003F, 0xFFDB,
+		0x000F, 0xFFFD
+	},
+	{
+		0x0003, 0x0004, 0xFFE3, 0x004D, 0xFF76, 0x00B0, 0xFF75, 0xFFDF, 0x0174, 0xFCB2,
+		0x053B, 0xF99D, 0x0592, 0xFF16, 0xF361, 0x5BF5, 0x3ED0, 0xE9BD, 0x08EF, 0xFE49,
+		0xFDE9, 0x037E, 0xFCAE, 0x025B, 0xFEC5, 0x005A, 0x0025, 0xFFB2, 0x0042, 0xFFDA,
+		0x000E, 0xFFFD
+	},
+	{
+		0x0002, 0x0006, 0xFFE0, 0x004E, 0xFF7A, 0x00A3, 0xFF90, 0xFFB8, 0x019E, 0xFC98,
+		0x0528, 0xF9FE, 0x04C3, 0x0068, 0xF198, 0x5949, 0x427F, 0xEA1C, 0x081E, 0xFF0C,
+		0xFD5F, 0x03CA, 0xFC96, 0x0252, 0xFEDB, 0x0043, 0x0036, 0xFFAA, 0x0045, 0xFFDA,
+		0x000E, 0xFFFE
+	},
+	{
+		0x0001, 0x0007, 0xFFDF, 0x004E, 0xFF7F, 0x0095, 0xFFAA, 0xFF93, 0x01C4, 0xFC85,
+		0x050C, 0xFA68, 0x03F1, 0x01AF, 0xEFFD, 0x5672, 0x461A, 0xEAA6, 0x0738, 0xFFD4,
+		0xFCD6, 0x0410, 0xFC84, 0x0245, 0xFEF4, 0x002B, 0x0046, 0xFFA1, 0x0048, 0xFFDA,
+		0x000D, 0xFFFE
+	},
+	{
+		0x0000, 0x0009, 0xFFDD, 0x004E, 0xFF85, 0x0086, 0xFFC5, 0xFF6F, 0x01E6, 0xFC78,
+		0x04E9, 0xFAD9, 0x031C, 0x02E9, 0xEE8F, 0x5372, 0x499D, 0xEB5C, 0x063E, 0x00A2,
+		0xFC50, 0x0450, 0xFC78, 0x0234, 0xFF0F, 0x0013, 0x0056, 0xFF99, 0x004A, 0xFFDA,
+		0x000C, 0xFFFF
+	},
+	{
+		0x0000, 0x000A, 0xFFDC, 0x004D, 0xFF8B, 0x0076, 0xFFDF, 0xFF4D, 0x0204, 0xFC71,
+		0x04BD, 0xFB51, 0x0247, 0x0416, 0xED50, 0x504C, 0x4D04, 0xEC3F, 0x0533, 0x0174,
+		0xFBCE, 0x048A, 0xFC71, 0x021E, 0xFF2D, 0xFFF9, 0x0066, 0xFF92, 0x004C, 0xFFDB,
+		0x000B, 0xFFFF
+	},
+	{
+		0xFFFF, 0x000B, 0xFFDB, 0x004C, 0xFF92, 0x0066, 0xFFF9, 0xFF2D, 0x021E, 0xFC71,
+		0x048A, 0xFBCE, 0x0174, 0x0533, 0xEC3F, 0x4D04, 0x504C, 0xED50, 0x0416, 0x0247,
+		0xFB51, 0x04BD, 0xFC71, 0x0204, 0xFF4D, 0xFFDF, 0x0076, 0xFF8B, 0x004D, 0xFFDC,
+		0x000A, 0x0000
+	},
+	{
+		0xFFFF, 0x000C, 0xFFDA, 0x004A, 0xFF99, 0x0056, 0x0013, 0xFF0F, 0x0234, 0xFC78,
+		0x0450, 0xFC50, 0x00A2, 0x063E, 0xEB5C, 0x499D, 0x5372, 0xEE8F, 0x02E9, 0x031C,
+		0xFAD9, 0x04E9, 0xFC78, 0x01E6, 0xFF6F, 0xFFC5, 0x0086, 0xFF85, 0x004E, 0xFFDD,
+		0x0009, 0x0000
+	},
+	{
+		0xFFFE, 0x000D, 0xFFDA, 0x0048, 0xFFA1, 0x0046, 0x002B, 0xFEF4, 0x0245, 0xFC84,
+		0x0410, 0xFCD6, 0xFFD4, 0x0738, 0xEAA6, 0x461A, 0x5672, 0xEFFD, 0x01AF, 0x03F1,
+		0xFA68, 0x050C, 0xFC85, 0x01C4, 0xFF93, 0xFFAA, 0x0095, 0xFF7F, 0x004E, 0xFFDF,
+		0x0007, 0x0001
+	},
+	{
+		0xFFFE, 0x000E, 0xFFDA, 0x0045, 0xFFAA, 0x0036, 0x0043, 0xFEDB, 0x0252, 0xFC96,
+		0x03CA, 0xFD5F, 0xFF0C, 0x081E, 0xEA1C, 0x427F, 0x5949, 0xF198, 0x0068, 0x04C3,
+		0xF9FE, 0x0528, 0xFC98, 0x019E, 0xFFB8, 0xFF90, 0x00A3, 0xFF7A, 0x004E, 0xFFE0,
+		0x0006, 0x0002
+	},
+	{
+		0xFFFD, 0x000E, 0xFFDA, 0x0042, 0xFFB2, 0x0025, 0x005A, 0xFEC5, 0x025B, 0xFCAE,
+		0x037E, 0xFDE9, 0xFE49, 0x08EF, 0xE9BD, 0x3ED0, 0x5BF5, 0xF361, 0xFF16, 0x0592,
+		0xF99D, 0x053B, 0xFCB2, 0x0174, 0xFFDF, 0xFF75, 0x00B0, 0xFF76, 0x004D, 0xFFE3,
+		0x0004, 0x0003
+	},
+	{
+		0xFFFD, 0x000F, 0xFFDB, 0x003F, 0xFFBB, 0x0015, 0x006F, 0xFEB1, 0x025F, 0xFCCB,
+		0x032F, 0xFE74, 0xFD8E, 0x09AB, 0xE989, 0x3B10, 0x5E72, 0xF558, 0xFDBB, 0x065C,
+		0xF945, 0x0545, 0xFCD2, 0x0146, 0x0007, 0xFF5B, 0x00BD, 0xFF73, 0x004C, 0xFFE5,
+		0x0003, 0x0003
+	},
+	{
+		0xFFFD, 0x000F, 0xFFDC, 0x003B, 0xFFC5, 0x0006, 0x0083, 0xFEA0, 0x025F, 0xFCED,
+		0x02DB, 0xFEFF, 0xFCDC, 0x0A51, 0xE97D, 0x3743, 0x60BD, 0xF77B, 0xFC5A, 0x0720,
+		0xF8F7, 0x0545, 0xFCF9, 0x0116, 0x002F, 0xFF41, 0x00C9, 0xFF71, 0x004A, 0xFFE8,
+		0x0001, 0x0004
+	},
+	{
+		0xFFFC, 0x000F, 0xFFDD, 0x0037, 0xFFCE, 0xFFF6, 0x0096, 0xFE92, 0x025B, 0xFD14,
+		0x0284, 0xFF88, 0xFC33, 0x0AE1, 0xE999, 0x336D, 0x62D6, 0xF9C9, 0xFAF4, 0x07DC,
+		0xF8B4, 0x053D, 0xFD26, 0x00E2, 0x0059, 0xFF28, 0x00D3, 0xFF70, 0x0047, 0xFFEB,
+		0xFFFF, 0x0005
+	},
+	{
+		0xFFFC, 0x000F, 0xFFDE, 0x0032, 0xFFD7, 0xFFE7, 0x00A7, 0xFE87, 0x0253, 0xFD3F,
+		0x022A, 0x0010, 0xFB94, 0x0B5A, 0xE9DA, 0x2F92, 0x64B8, 0xFC42, 0xF98C, 0x088F,
+		0xF87C, 0x052B, 0xFD58, 0x00AC, 0x0082, 0xFF10, 0x00DC, 0xFF70, 0x0044, 0xFFEE,
+		0xFFFD, 0x0006
+	},
+	{
+		0xFFFC, 0x000F, 0xFFDF, 0x002E, 0xFFE1, 0xFFD9, 0x00B7, 0xFE7E, 0x0247, 0xFD6E,
+		0x01CE, 0x0095, 0xFB01, 0x0BBC, 0xEA40, 0x2BB4, 0x6662, 0xFEE4, 0xF823, 0x0937,
+		0xF851, 0x050F, 0xFD91, 0x0073, 0x00AC, 0xFEF9, 0x00E4, 0xFF70, 0x0040, 0xFFF2,
+		0xFFFB, 0x0007
+	},
+	{
+		0xFFFC, 0x000F, 0xFFE1, 0x0029, 0xFFEA, 0xFFCB, 0x00C5, 0xFE79, 0x0237, 0xFDA0,
+		0x0171, 0x0116, 0xFA79, 0x0C07, 0xEAC6, 0x27D9, 0x67D3, 0x01AD, 0xF6BE, 0x09D2,
+		0xF832, 0x04EA, 0xFDCF, 0x0038, 0x00D5, 0xFEE3, 0x00EB, 0xFF72, 0x003B, 0xFFF6,
+		0xFFF8, 0x0008
+	},
+	{
+		0xFFFC, 0x000F, 0xFFE3, 0x0024, 0xFFF3, 0xFFBE, 0x00D1, 0xFE76, 0x0224, 0xFDD6,
+		0x0114, 0x0192, 0xF9FF, 0x0C3B, 0xEB6D, 0x2403, 0x6909, 0x049C, 0xF55D, 0x0A60,
+		0xF821, 0x04BB, 0xFE13, 0xFFFC, 0x00FE, 0xFECF, 0x00F0, 0xFF75, 0x0036, 0xFFFA,
+		0xFFF6, 0x0009
+	},
+	{
+		0xFFFC, 0x000E, 0xFFE4, 0x001F, 0xFFFC, 0xFFB2, 0x00DC, 0xFE76, 0x020D, 0xFE0E,
+		0x00B6, 0x0209, 0xF991, 0x0C59, 0xEC31, 0x2036, 0x6A03, 0x07AE, 0xF403, 0x0ADF,
+		0xF81D, 0x0482, 0xFE5B, 0xFFBE, 0x0126, 0xFEBC, 0x00F3, 0xFF79, 0x0031, 0xFFFE,
+		0xFFF4, 0x0009
+	},
+	{
+		0xFFFC, 0x000E, 0xFFE6, 0x001B, 0x0005, 0xFFA7, 0x00E5, 0xFE79, 0x01F4, 0xFE49,
+		0x0059, 0x027A, 0xF932, 0x0C60, 0xED11, 0x1C75, 0x6ABF, 0x0AE1, 0xF2B3, 0x0B4E,
+		0xF828, 0x0441, 0xFEA8, 0xFF7F, 0x014D, 0xFEAC, 0x00F5, 0xFF7E, 0x002B, 0x0002,
+		0xFFF2, 0x000A
+	},
+	{
+		0xFFFC, 0x000D, 0xFFE9, 0x0016, 0x000D, 0xFF9D, 0x00EB, 0xFE7E, 0x01D7, 0xFE85,
+		0xFFFE, 0x02E5, 0xF8E0, 0x0C51, 0xEE09, 0x18C5, 0x6B3C, 0x0E33, 0xF170, 0x0BAB,
+		0xF840, 0x03F6, 0xFEF9, 0xFF40, 0x0173, 0xFE9D, 0x00F5, 0xFF84, 0x0024, 0x0007,
+		0xFFEF, 0x000B
+	},
+	{
+		0xFFFC, 0x000C, 0xFFEB, 0x0011, 0x0015, 0xFF94, 0x00F1, 0xFE86, 0x01B8, 0xFEC3,
+		0xFFA4, 0x0348, 0xF89C, 0x0C2E, 0xEF18, 0x1528, 0x6B7C, 0x11A1, 0xF03B, 0x0BF6,
+		0xF867, 0x03A3, 0xFF4D, 0xFF01, 0x0196, 0xFE90, 0x00F4, 0xFF8B, 0x001D, 0x000C,
+		0xFFED, 0x000C
+	},
+	{
+		0x0000, 0x000C, 0xFFED, 0x000C, 0x001D, 0xFF8B, 0x00F4, 0xFE90, 0x0196, 0xFF01,
+		0xFF4D, 0x03A3, 0xF867, 0x0BF6, 0xF03B, 0x11A1, 0x6B7C, 0x1528, 0xEF18, 0x0C2E,
+		0xF89C, 0x0348, 0xFFA4, 0xFEC3, 0x01B8, 0xFE86, 0x00F1, 0xFF94, 0x0015, 0x0011,
+		0xFFEB, 0x000C
+	}
+
+};
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+static const q31_t filter_polyphase_32bit[SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES + 1]
+					 [SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS] = {
+	{
+		0x000BC6CA, 0xFFECF8CE, 0x000BD58B, 0x001CC3DA, 0xFF8B7934, 0x00F3EE8B,
+		0xFE903AD9, 0x01962BD5, 0xFF01651B, 0xFF4CD73A, 0x03A317AE, 0xF866D6A9,
+		0x0BF6532F, 0xF03B4404, 0x11A0A32E, 0x6B7B8142, 0x1527B3B5, 0xEF184EE9,
+		0x0C2E05CA, 0xF89C15D4, 0x0347B864, 0xFFA41C4E, 0xFEC2D335, 0x01B7BEA0,
+		0xFE85E7B4, 0x00F0982D, 0xFF93BA22, 0x001524BD, 0x0010ADCA, 0xFFEABD95,
+		0x000C7798, 0xFFFC3B41
+	},
+	{
+		0x000B08DD, 0xFFEF3DF1, 0x00071606, 0x0023F062, 0xFF84441F, 0x00F57F0C,
+		0xFE9CD7E5, 0x01728C90, 0xFF4065FF, 0xFEF8936B, 0x03F63B21, 0xF84000E8,
+		0x0BAB3C1B, 0xF16FB756, 0x0E32CB61, 0x6B3C7C20, 0x18C505AF, 0xEE095CC1,
+		0x0C517200, 0xF8DFB2F9, 0x02E4937B, 0xFFFDD69E, 0xFE85231E, 0x01D6FC83,
+		0xFE7DFF54, 0x00EB762E, 0xFF9CFF5E, 0x000D1DAB, 0x00159653, 0xFFE89141,
+		0x000D18F8, 0xFFFC2185
+	},
+	{
+		0x000A401D, 0xFFF18829, 0x00027731, 0x002AA0DF, 0xFF7E204E, 0x00F55287,
+		0xFEAB9AA1, 0x014D2B53, 0xFF7F64AE, 0xFEA7D4D6, 0x0440BD33, 0xF8278724,
+		0x0B4DBCFB, 0xF2B31E33, 0x0AE0FAE9, 0x6ABEB553, 0x1C757C69, 0xED10E8AE,
+		0x0C5FD278, 0xF9318957, 0x027A2F64, 0x005972D5, 0xFE48C879, 0x01F39FAE,
+		0xFE789EF3, 0x00E485F4, 0xFFA73F3D, 0x0004BA64, 0x001A8644, 0xFFE678E1,
+		0x000DA89F, 0xFFFC0FE4
+	},
+	{
+		0x00096ED0, 0xFFF3D2C8, 0xFFFE007B, 0x0030CD0C, 0xFF791112, 0x00F374B9,
+		0xFEBC5BDA, 0x0126541E, 0xFFBDF252, 0xFE5B1699, 0x0482496B, 0xF81D43B3,
+		0x0ADEEA85, 0xF402EBAD, 0x07ADD4B5, 0x6A02B36F, 0x2035D93E, 0xEC316088,
+		0x0C58805D, 0xF9915A93, 0x0209222E, 0x00B6573C, 0xFE0E36F8, 0x020D6584,
+		0xFE75DFD9, 0x00DBC82D, 0xFFB26DF6, 0xFFFC07B9, 0x001F7458, 0xFFE47996,
+		0x000E244C, 0xFFFC073A
+	},
+	{
+		0x00089730, 0xFFF61953, 0xFFF9B8BE, 0x00366DDD, 0xFF7517AA, 0x00EFF426,
+		0xFECEF1B2, 0x00FE53E1, 0xFFFBA329, 0xFE12CA51, 0x04BA9C90, 0xF820F96A,
+		0x0A5FEF72, 0xF55C942F, 0x049BCD43, 0x69093F79, 0x2402BF44, 0xEB6D212A,
+		0x0C3AF52E, 0xF9FECE94, 0x019210D2, 0x0113E4A6, 0xFDD5E180, 0x02240F1D,
+		0xFE75D716, 0x00D140E2, 0xFFBE7DAC, 0xFFF3137A, 0x002456FB, 0xFFE29886,
+		0x000E89CC, 0xFFFC085A
+	},
+	{
+		0x0007BB69, 0xFFF85789, 0xFFF5A63E, 0x003B7D85, 0xFF723350, 0x00EAE1E5,
+		0xFEE33000, 0x00D577ED, 0x00380F36, 0xFDCF5784, 0x04E984D0, 0xF8325483,
+		0x09D20A13, 0xF6BD9104, 0x01AD2823, 0x67D363E7, 0x27D8B72F, 0xEAC672D1,
+		0x0C06CC58, 0xFA79738F, 0x0115AE5D, 0x01717772, 0xFDA0395D, 0x023761D6,
+		0xFE789541, 0x00C4F787, 0xFFCB5E76, 0xFFE9EC66, 0x00292451, 0xFFE0DACE,
+		0x000ED701, 0xFFFC140A
+	},
+	{
+		0x0006DD92, 0xFFFA8969, 0xFFF1CE9E, 0x003FF772, 0xFF706148, 0x00E45176,
+		0xFEF8E8AC, 0x00AC0D6A, 0x0072D2E3, 0xFD911B1E, 0x050EE1B8, 0xF850EBA5,
+		0x093689DF, 0xF82363CF, 0xFEE3F5C3, 0x66626B3F, 0x2BB43353, 0xEA3F8588,
+		0x0BBBC4B3, 0xFB00BE3A, 0x0094BB00, 0x01CE6898, 0xFD6DAD6C, 0x024727D2,
+		0xFE7E2640, 0x00B6F6FE, 0xFFD8FE6F, 0xFFE0A215, 0x002DD24F, 0xFFDF457E,
+		0x000F09E8, 0xFFFC2AFF
+	},
+	{
+		0x0005FFA8, 0xFFFCAB34, 0xFFEE36DA, 0x0043D84F, 0xFF6F9CF4, 0x00DC588A,
+		0xFF0FEC0E, 0x008260C9, 0x00AB8F9B, 0xFD586705, 0x052AA413, 0xF87C4107,
+		0x088ECCEB, 0xF98B99E0, 0xFC421182, 0x64B7DE78, 0x2F9193D8, 0xE9DA6DA4,
+		0x0B59C1C5, 0xFB940A2E, 0x001002FF, 0x022A0EC0, 0xFD3EA942, 0x02533073,
+		0xFE869115, 0x00A74D9F, 0xFFE749CB, 0xFFD744DE, 0x003256CD, 0xFFDDDD87,
+		0x000F209C, 0xFFFC4DD9
+	},
+	{
+		0x00052392, 0xFFFEB979, 0xFFEAE347, 0x00471DFF, 0xFF6FDFE9, 0x00D30ED2,
+		0xFF28094E, 0x0058BD44, 0x00E1EC5A, 0xFD2581C1, 0x053CCDB0, 0xF8B3C3B4,
+		0x07DC3D5F, 0xFAF3CF72, 0xF9C92010, 0x62D582F6, 0x336D2B08, 0xE999205A,
+		0x0AE0CCCF, 0xFC329A78, 0xFF885D90, 0x0283BF66, 0xFD13945D, 0x025B50D2,
+		0xFE91D7B6, 0x00960D2F, 0xFFF62AF1, 0xFFCDE5C3, 0x0036A791, 0xFFDCA7B3,
+		0x000F1962, 0xFFFC7D27
+	},
+	{
+		0x00044B13, 0x0000B112, 0xFFE7D78C, 0x0049C799, 0xFF71220A, 0x00C88DC1,
+		0xFF410EBF, 0x002F6C59, 0x01159628, 0xFCF8A639, 0x05457106, 0xF8F6D0E4,
+		0x07204EE1, 0xFC59B2BA, 0xF77A8E1D, 0x60BD5849, 0x374341B8, 0xE97D707A,
+		0x0A5115B3, 0xFCDB9A53, 0xFEFEAB93, 0x02DAD005, 0xFCECD150, 0x025F6431,
+		0xFE9FF6E8, 0x00834ADA, 0x00058A92, 0xFFC4964F, 0x003ABA70, 0xFFDBA899,
+		0x000EF2A7, 0xFFFCB95B
+	},
+	{
+		0x000377D2, 0x00028F2C, 0xFFE516A4, 0x004BD55F, 0xFF73599F, 0x00BCF059,
+		0xFF5ACA47, 0x0006B557, 0x01464094, 0xFCD20389, 0x0544B0BF, 0xF944B56E,
+		0x065C7BFE, 0xFDBB06DA, 0xF5578F4F, 0x5E71959A, 0x3B101BC6, 0xE9890B48,
+		0x09AAF38F, 0xFD8E1E0A, 0xFE73D63F, 0x032E9745, 0xFCCABCF9, 0x025F4C5A,
+		0xFEB0E62B, 0x006F1F1B, 0x00154FCC, 0xFFBB687C, 0x003E8555, 0xFFDAE493,
+		0x000EAB0C, 0xFFFD02CF
+	},
+	{
+		0x0002AB50, 0x00045146, 0xFFE2A2DE, 0x004D48B3, 0xFF767B78, 0x00B052E7,
+		0xFF7509B1, 0xFFDEDCE4, 0x0173A611, 0xFCB1BCEC, 0x053ABF2A, 0xF99CAF55,
+		0x05924395, 0xFF15A69E, 0xF3611D97, 0x5BF4A6D2, 0x3ECFFCA4, 0xE9BD757B,
+		0x08EEE530, 0xFE492412, 0xFDE8CDB4, 0x037E6E2C, 0xFCADADBD, 0x025AF1FB,
+		0xFEC497A5, 0x0059A5A8, 0x00256051, 0xFFB26E95, 0x0041FE5F, 0xFFDA5FAD,
+		0x000E4167, 0xFFFD59BF
+	},
+	{
+		0x0001E6EB, 0x0005F538, 0xFFE07DDE, 0x004E240E, 0xFF7A7B07, 0x00A2D2CE,
+		0xFF8F9B13, 0xFFB82493, 0x019D8853, 0xFC97E9B8, 0x0527DD93, 0xF9FDEF59,
+		0x04C32651, 0x00678710, 0xF197F8C2, 0x59492984, 0x427F2BEF, 0xEA1C0875,
+		0x081D9142, 0xFF0B9641, 0xFD5E8778, 0x03C9B15C, 0xFC95F2C6, 0x025244FC,
+		0xFEDAF822, 0x0042FD51, 0x0035A088, 0xFFA9BB11, 0x00451BF6, 0xFFDA1D9F,
+		0x000DB4CD, 0xFFFDBE47
+	},
+	{
+		0x00012BDB, 0x0007792C, 0xFFDEA89F, 0x004E6AEE, 0xFF7F4A87, 0x00948E47,
+		0xFFAA4D1E, 0xFF92CA81, 0x01C3B093, 0xFC849575, 0x050C5B86, 0xFA679AA3,
+		0x03F0A41D, 0x01AEB9D8, 0xEFFCA66E, 0x5671E98E, 0x4619FA00, 0xEAA5EF9F,
+		0x0737C63D, 0xFFD44B36, 0xFCD5FCE9, 0x040FC241, 0xFC83D351, 0x02453CBD,
+		0xFEF3EF10, 0x002B47DB, 0x0045F3BE, 0xFFA16073, 0x0047D4D9, 0xFFDA21C2,
+		0x000D0490, 0xFFFE3061
+	},
+	{
+		0x00007B30, 0x0008DBA6, 0xFFDD237A, 0x004E21CD, 0xFF84DB1A, 0x0085A424,
+		0xFFC4EF7A, 0xFF6F08F8, 0x01E5EFCB, 0xFC77C003, 0x04E895FE, 0xFAD8CC75,
+		0x031C39BC, 0x02E96F65, 0xEE8F7239, 0x5371DD93, 0x499CC483, 0xEB5C2609,
+		0x063E7A22, 0x00A207E7, 0xFC502996, 0x04500847, 0xFC778E03, 0x0233D855,
+		0xFF0F5E96, 0x0012A9D7, 0x00563C52, 0xFF997128, 0x004A203D, 0xFFDA6F01,
+		0x000C304A, 0xFFFEAFE6
+	},
+	{
+		0xFFFFD5D4, 0x000A1B7D, 0xFFDBEE2B, 0x004D4E09, 0xFF8B1CED, 0x00763393,
+		0xFFDF5312, 0xFF4D161D, 0x02041EDF, 0xFC715DD8, 0x04BCF679, 0xFB5097E5,
+		0x02475E5C, 0x0415F8E3, 0xED506E50, 0x504C232B, 0x4D03FAF7, 0xEC3F743D,
+		0x0532C9F1, 0x01738153, 0xFBCE099C, 0x0489F209, 0xFC71584D, 0x021E1EB9,
+		0xFF2D23A5, 0xFFF94A68, 0x00665BE6, 0xFF91FF61, 0x004BF5DC, 0xFFDB07D1,
+		0x000B37DE, 0xFFFF3C88
+	},
+	{
+		0xFFFF3C88, 0x000B37DE, 0xFFDB07D1, 0x004BF5DC, 0xFF91FF61, 0x00665BE6,
+		0xFFF94A68, 0xFF2D23A5, 0x021E1EB9, 0xFC71584D, 0x0489F209, 0xFBCE099C,
+		0x01738153, 0x0532C9F1, 0xEC3F743D, 0x4D03FAF7, 0x504C232B, 0xED506E50,
+		0x0415F8E3, 0x02475E5C, 0xFB5097E5, 0x04BCF679, 0xFC715DD8, 0x02041EDF,
+		0xFF4D161D, 0xFFDF5312, 0x00763393, 0xFF8B1CED, 0x004D4E09, 0xFFDBEE2B,
+		0x000A1B7D, 0xFFFFD5D4
+	},
+	{
+		0xFFFEAFE6, 0x000C304A, 0xFFDA6F01, 0x004A203D, 0xFF997128, 0x00563C52,
+		0x0012A9D7, 0xFF0F5E96, 0x0233D855, 0xFC778E03, 0x04500847, 0xFC502996,
+		0x00A207E7, 0x063E7A22, 0xEB5C2609, 0x499CC483, 0x5371DD93, 0xEE8F7239,
+		0x02E96F65, 0x031C39BC, 0xFAD8CC75, 0x04E895FE, 0xFC77C003, 0x01E5EFCB,
+		0xFF6F08F8, 0xFFC4EF7A, 0x0085A424, 0xFF84DB1A, 0x004E21CD, 0xFFDD237A,
+		0x0008DBA6, 0x00007B30
+	},
+	{
+		0xFFFE3061, 0x000D0490, 0xFFDA21C2, 0x0047D4D9, 0xFFA16073, 0x0045F3BE,
+		0x002B47DB, 0xFEF3EF10, 0x02453CBD, 0xFC83D351, 0x040FC241, 0xFCD5FCE9,
+		0xFFD44B36, 0x0737C63D, 0xEAA5EF9F, 0x4619FA00, 0x5671E98E, 0xEFFCA66E,
+		0x01AEB9D8, 0x03F0A41D, 0xFA679AA3, 0x050C5B86, 0xFC849575, 0x01C3B093,
+		0xFF92CA81, 0xFFAA4D1E, 0x00948E47, 0xFF7F4A87, 0x004E6AEE, 0xFFDEA89F,
+		0x0007792C, 0x00012BDB
+	},
+	{
+		0xFFFDBE47, 0x000DB4CD, 0xFFDA1D9F, 0x00451BF6, 0xFFA9BB11, 0x0035A088,
+		0x0042FD51, 0xFEDAF822, 0x025244FC, 0xFC95F2C6, 0x03C9B15C, 0xFD5E8778,
+		0xFF0B9641, 0x081D9142, 0xEA1C0875, 0x427F2BEF, 0x59492984, 0xF197F8C2,
+		0x00678710, 0x04C32651, 0xF9FDEF59, 0x0527DD93, 0xFC97E9B8, 0x019D8853,
+		0xFFB82493, 0xFF8F9B13, 0x00A2D2CE, 0xFF7A7B07, 0x004E240E, 0xFFE07DDE,
+		0x0005F538, 0x0001E6EB
+	},
+	{
+		0xFFFD59BF, 0x000E4167, 0xFFDA5FAD, 0x0041FE5F, 0xFFB26E95, 0x00256051,
+		0x0059A5A8, 0xFEC497A5, 0x025AF1FB, 0xFCADADBD, 0x037E6E2C, 0xFDE8CDB4,
+		0xFE492412, 0x08EEE530, 0xE9BD757B, 0x3ECFFCA4, 0x5BF4A6D2, 0xF3611D97,
+		0xFF15A69E, 0x05924395, 0xF99CAF55, 0x053ABF2A, 0xFCB1BCEC, 0x0173A611,
+		0xFFDEDCE4, 0xFF7509B1, 0x00B052E7, 0xFF767B78, 0x004D48B3, 0xFFE2A2DE,
+		0x00045146, 0x0002AB50
+	},
+	{
+		0xFFFD02CF, 0x000EAB0C, 0xFFDAE493, 0x003E8555, 0xFFBB687C, 0x00154FCC,
+		0x006F1F1B, 0xFEB0E62B, 0x025F4C5A, 0xFCCABCF9, 0x032E9745, 0xFE73D63F,
+		0xFD8E1E0A, 0x09AAF38F, 0xE9890B48, 0x3B101BC6, 0x5E71959A, 0xF5578F4F,
+		0xFDBB06DA, 0x065C7BFE, 0xF944B56E, 0x0544B0BF, 0xFCD20389, 0x01464094,
+		0x0006B557, 0xFF5ACA47, 0x00BCF059, 0xFF73599F, 0x004BD55F, 0xFFE516A4,
+		0x00028F2C, 0x000377D2
+	},
+	{
+		0xFFFCB95B, 0x000EF2A7, 0xFFDBA899, 0x003ABA70, 0xFFC4964F, 0x00058A92,
+		0x00834ADA, 0xFE9FF6E8, 0x025F6431, 0xFCECD150, 0x02DAD005, 0xFEFEAB93,
+		0xFCDB9A53, 0x0A5115B3, 0xE97D707A, 0x374341B8, 0x60BD5849, 0xF77A8E1D,
+		0xFC59B2BA, 0x07204EE1, 0xF8F6D0E4, 0x05457106, 0xFCF8A639, 0x01159628,
+		0x002F6C59, 0xFF410EBF, 0x00C88DC1, 0xFF71220A, 0x0049C799, 0xFFE7D78C,
+		0x0000B112, 0x00044B13
+	},
+	{
+		0xFFFC7D27, 0x000F1962, 0xFFDCA7B3, 0x0036A791, 0xFFCDE5C3, 0xFFF62AF1,
+		0x00960D2F, 0xFE91D7B6, 0x025B50D2, 0xFD13945D, 0x0283BF66, 0xFF885D90,
+		0xFC329A78, 0x0AE0CCCF, 0xE999205A, 0x336D2B08, 0x62D582F6, 0xF9C92010,
+		0xFAF3CF72, 0x07DC3D5F, 0xF8B3C3B4, 0x053CCDB0, 0xFD2581C1, 0x00E1EC5A,
+		0x0058BD44, 0xFF28094E, 0x00D30ED2, 0xFF6FDFE9, 0x00471DFF, 0xFFEAE347,
+		0xFFFEB979, 0x00052392
+	},
+	{
+		0xFFFC4DD9, 0x000F209C, 0xFFDDDD87, 0x003256CD, 0xFFD744DE, 0xFFE749CB,
+		0x00A74D9F, 0xFE869115, 0x02533073, 0xFD3EA942, 0x022A0EC0, 0x001002FF,
+		0xFB940A2E, 0x0B59C1C5, 0xE9DA6DA4, 0x2F9193D8, 0x64B7DE78, 0xFC421182,
+		0xF98B99E0, 0x088ECCEB, 0xF87C4107, 0x052AA413, 0xFD586705, 0x00AB8F9B,
+		0x008260C9, 0xFF0FEC0E, 0x00DC588A, 0xFF6F9CF4, 0x0043D84F, 0xFFEE36DA,
+		0xFFFCAB34, 0x0005FFA8
+	},
+	{
+		0xFFFC2AFF, 0x000F09E8, 0xFFDF457E, 0x002DD24F, 0xFFE0A215, 0xFFD8FE6F,
+		0x00B6F6FE, 0xFE7E2640, 0x024727D2, 0xFD6DAD6C, 0x01CE6898, 0x0094BB00,
+		0xFB00BE3A, 0x0BBBC4B3, 0xEA3F8588, 0x2BB43353, 0x66626B3F, 0xFEE3F5C3,
+		0xF82363CF, 0x093689DF, 0xF850EBA5, 0x050EE1B8, 0xFD911B1E, 0x0072D2E3,
+		0x00AC0D6A, 0xFEF8E8AC, 0x00E45176, 0xFF706148, 0x003FF772, 0xFFF1CE9E,
+		0xFFFA8969, 0x0006DD92
+	},
+	{
+		0xFFFC140A, 0x000ED701, 0xFFE0DACE, 0x00292451, 0xFFE9EC66, 0xFFCB5E76,
+		0x00C4F787, 0xFE789541, 0x023761D6, 0xFDA0395D, 0x01717772, 0x0115AE5D,
+		0xFA79738F, 0x0C06CC58, 0xEAC672D1, 0x27D8B72F, 0x67D363E7, 0x01AD2823,
+		0xF6BD9104, 0x09D20A13, 0xF8325483, 0x04E984D0, 0xFDCF5784, 0x00380F36,
+		0x00D577ED, 0xFEE33000, 0x00EAE1E5, 0xFF723350, 0x003B7D85, 0xFFF5A63E,
+		0xFFF85789, 0x0007BB69
+	},
+	{
+		0xFFFC085A, 0x000E89CC, 0xFFE29886, 0x002456FB, 0xFFF3137A, 0xFFBE7DAC,
+		0x00D140E2, 0xFE75D716, 0x02240F1D, 0xFDD5E180, 0x0113E4A6, 0x019210D2,
+		0xF9FECE94, 0x0C3AF52E, 0xEB6D212A, 0x2402BF44, 0x69093F79, 0x049BCD43,
+		0xF55C942F, 0x0A5FEF72, 0xF820F96A, 0x04BA9C90, 0xFE12CA51, 0xFFFBA329,
+		0x00FE53E1, 0xFECEF1B2, 0x00EFF426, 0xFF7517AA, 0x00366DDD, 0xFFF9B8BE,
+		0xFFF61953, 0x00089730
+	},
+	{
+		0xFFFC073A, 0x000E244C, 0xFFE47996, 0x001F7458, 0xFFFC07B9, 0xFFB26DF6,
+		0x00DBC82D, 0xFE75DFD9, 0x020D6584, 0xFE0E36F8, 0x00B6573C, 0x0209222E,
+		0xF9915A93, 0x0C58805D, 0xEC316088, 0x2035D93E, 0x6A02B36F, 0x07ADD4B5,
+		0xF402EBAD, 0x0ADEEA85, 0xF81D43B3, 0x0482496B, 0xFE5B1699, 0xFFBDF252,
+		0x0126541E, 0xFEBC5BDA, 0x00F374B9, 0xFF791112, 0x0030CD0C, 0xFFFE007B,
+		0xFFF3D2C8, 0x00096ED0
+	},
+	{
+		0xFFFC0FE4, 0x000DA89F, 0xFFE678E1, 0x001A8644, 0x0004BA64, 0xFFA73F3D,
+		0x00E485F4, 0xFE789EF3, 0x01F39FAE, 0xFE48C879, 0x005972D5, 0x027A2F64,
+		0xF9318957, 0x0C5FD278, 0xED10E8AE, 0x1C757C69, 0x6ABEB553, 0x0AE0FAE9,
+		0xF2B31E33, 0x0B4DBCFB, 0xF8278724, 0x0440BD33, 0xFEA7D4D6, 0xFF7F64AE,
+		0x014D2B53, 0xFEAB9AA1, 0x00F55287, 0xFF7E204E, 0x002AA0DF, 0x00027731,
+		0xFFF18829, 0x000A401D
+	},
+	{
+		0xFFFC2185, 0x000D18F8, 0xFFE89141, 0x00159653, 0x000D1DAB, 0xFF9CFF5E,
+		0x00EB762E, 0xFE7DFF54, 0x01D6FC83, 0xFE85231E, 0xFFFDD69E, 0x02E4937B,
+		0xF8DFB2F9, 0x0C517200, 0xEE095CC1, 0x18C505AF, 0x6B3C7C20, 0x0E32CB61,
+		0xF16FB756, 0x0BAB3C1B, 0xF84000E8, 0x03F63B21, 0xFEF8936B, 0xFF4065FF,
+		0x01728C90, 0xFE9CD7E5, 0x00F57F0C, 0xFF84441F, 0x0023F062, 0x00071606,
+		0xFFEF3DF1, 0x000B08DD
+	},
+	{
+		0xFFFC3B41, 0x000C7798, 0xFFEABD95, 0x0010ADCA, 0x001524BD, 0xFF93BA22,
+		0x00F0982D, 0xFE85E7B4, 0x01B7BEA0, 0xFEC2D335, 0xFFA41C4E, 0x0347B864,
+		0xF89C15D4, 0x0C2E05CA, 0xEF184EE9, 0x1527B3B5, 0x6B7B8142, 0x11A0A32E,
+		0xF03B4404, 0x0BF6532F, 0xF866D6A9, 0x03A317AE, 0xFF4CD73A, 0xFF01651B,
+		0x01962BD5, 0xFE903AD9, 0x00F3EE8B, 0xFF8B7934, 0x001CC3DA, 0x000BD58B,
+		0xFFECF8CE, 0x000BC6CA
+	},
+	{
+		0x00000000, 0x000BC6CA, 0xFFECF8CE, 0x000BD58B, 0x001CC3DA, 0xFF8B7934,
+		0x00F3EE8B, 0xFE903AD9, 0x01962BD5, 0xFF01651B, 0xFF4CD73A, 0x03A317AE,
+		0xF866D6A9, 0x0BF6532F, 0xF03B4404, 0x11A0A32E, 0x6B7B8142, 0x1527B3B5,
+		0xEF184EE9, 0x0C2E05CA, 0xF89C15D4, 0x0347B864, 0xFFA41C4E, 0xFEC2D335,
+		0x01B7BEA0, 0xFE85E7B4, 0x00F0982D, 0xFF93BA22, 0x001524BD, 0x0010ADCA,
+		0xFFEABD95, 0x000C7798
+	}
+
+};
+#endif
+
+void const *sample_rate_converter_polyphase_filter_get(void)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	return filter_polyphase_16bit;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	return filter_polyphase_32bit;
+#endif
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
@@ -24,4 +24,17 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * @brief Get the polyphase filter bank for fractional conversion ratios.
+ *
+ * @details The filter bank has SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES + 1 rows of
+ *	    SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS coefficients in the selected bit depth. The
+ *	    coefficients of each row are stored in reverse order.
+ *
+ * @return Pointer to the first coefficient of the filter bank.
+ */
+void const *sample_rate_converter_polyphase_filter_get(void);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
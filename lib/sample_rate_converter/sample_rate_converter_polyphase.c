@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+#include "sample_rate_converter_filter.h"
+
+#include <errno.h>
+#include <string.h>
+#include <dsp/basic_math_functions.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_polyphase, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#define TAPS   SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS
+#define PHASES SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES
+
+/* Number of fractional bits used for the weight between two neighbouring phases */
+#define PHASE_WEIGHT_BITS 15
+
+/* Highest sample rate value that keeps the phase position within 32 bits */
+#define SAMPLE_RATE_MAX (UINT32_MAX / PHASES)
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t sample_t;
+#define HISTORY(ctx) ((ctx)->history_15)
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t sample_t;
+#define HISTORY(ctx) ((ctx)->history_31)
+#endif
+
+/**
+ * @brief Check that the conversion ratio is within what the filter bank is designed for.
+ *
+ * @details The sample rates only give the ratio, so any scale can be used to get a fine enough
+ *	    ratio; 48000 to 44100 and 1000000 to 1000050 are both supported. The ratio must be
+ *	    within 10 %, which covers both 44.1 kHz to 48 kHz and clock drift compensation.
+ */
+static bool sample_rates_supported(uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	if ((sample_rate_input == 0) || (sample_rate_output == 0) ||
+	    (sample_rate_input > SAMPLE_RATE_MAX) || (sample_rate_output > SAMPLE_RATE_MAX)) {
+		return false;
+	}
+
+	return ((uint64_t)sample_rate_input * 10 <= (uint64_t)sample_rate_output * 11) &&
+	       ((uint64_t)sample_rate_output * 10 <= (uint64_t)sample_rate_input * 11);
+}
+
+/**
+ * @brief Number of output frames produced from the samples currently in the history buffer.
+ *
+ * @details An output frame is produced for every output position up to and including the
+ *	    newest input sample. Output positions advance by sample_rate_input / sample_rate_output
+ *	    input samples.
+ */
+static size_t frames_out_get(struct sample_rate_converter_polyphase_ctx const *ctx,
+			     size_t frames_in)
+{
+	size_t end = TAPS - 1 + frames_in;
+
+	if (ctx->pos >= end) {
+		return 0;
+	}
+
+	uint64_t span = (uint64_t)(end - ctx->pos) * ctx->sample_rate_output - ctx->phase_acc;
+
+	return DIV_ROUND_UP(span, ctx->sample_rate_input);
+}
+
+/**
+ * @brief Filter one output sample for a channel.
+ *
+ * @details The output is the weighted sum of the two phases around the output position, which
+ *	    keeps the filter bank small while still supporting any position between two input
+ *	    samples. The dot products use the SIMD multiply-accumulate instructions of the CMSIS DSP
+ *	    library when available.
+ */
+static inline sample_t filter_sample(sample_t const *history, sample_t const *phase_lo,
+				     sample_t const *phase_hi, q63_t weight)
+{
+	q63_t lo;
+	q63_t hi;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	/* Dot product result is in 34.30 format */
+	arm_dot_prod_q15(history, phase_lo, TAPS, &lo);
+	arm_dot_prod_q15(history, phase_hi, TAPS, &hi);
+
+	q63_t acc = lo + (((hi - lo) * weight) >> PHASE_WEIGHT_BITS);
+
+	return (q15_t)CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	/* Dot product result is in 16.48 format */
+	arm_dot_prod_q31(history, phase_lo, TAPS, &lo);
+	arm_dot_prod_q31(history, phase_hi, TAPS, &hi);
+
+	q63_t acc = lo + (((hi - lo) >> PHASE_WEIGHT_BITS) * weight);
+
+	return (q31_t)CLAMP(acc >> 17, INT32_MIN, INT32_MAX);
+#endif
+}
+
+int sample_rate_converter_polyphase_open(struct sample_rate_converter_polyphase_ctx *ctx,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 uint8_t channels)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if (!sample_rates_supported(sample_rate_input, sample_rate_output)) {
+		LOG_ERR("Unsupported fractional conversion %d -> %d", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
+	if ((channels == 0) || (channels > CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX)) {
+		LOG_ERR("Invalid number of channels: %d", channels);
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_polyphase_ctx));
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->channels = channels;
+	/* Start with an empty (zeroed) filter history */
+	ctx->pos = TAPS - 1;
+
+	LOG_DBG("Polyphase converter initialized. Input sample rate: %d, Output sample rate: %d, "
+		"channels: %d",
+		sample_rate_input, sample_rate_output, channels);
+	return 0;
+}
+
+int sample_rate_converter_polyphase_ratio_set(struct sample_rate_converter_polyphase_ctx *ctx,
+					      uint32_t sample_rate_input,
+					      uint32_t sample_rate_output)
+{
+	if ((ctx == NULL) || (ctx->channels == 0)) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	if (!sample_rates_supported(sample_rate_input, sample_rate_output)) {
+		LOG_ERR("Unsupported fractional conversion %d -> %d", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
+	/* Keep the position of the next output sample between the same two input samples */
+	ctx->phase_acc = ((uint64_t)ctx->phase_acc * sample_rate_output) / ctx->sample_rate_output;
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+
+	return 0;
+}
+
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase_ctx *ctx,
+					    void const *const input, size_t input_size,
+					    void *const output, size_t output_size,
+					    size_t *output_written)
+{
+	sample_t const (*filter)[TAPS];
+	sample_t const *in = input;
+	sample_t *out = output;
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->channels == 0) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	size_t frame_size = ctx->channels * sizeof(sample_t);
+
+	if (input_size % frame_size != 0) {
+		LOG_ERR("Size of input is not a frame multiple");
+		return -EINVAL;
+	}
+
+	size_t frames_in = input_size / frame_size;
+
+	if (frames_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
+		LOG_ERR("Too many frames given as input");
+		return -EINVAL;
+	}
+
+	size_t frames_out = frames_out_get(ctx, frames_in);
+
+	if (frames_out * frame_size > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	/* De-interleave the whole input first, so that output may overwrite the input */
+	for (size_t i = 0; i < frames_in; i++) {
+		for (uint8_t ch = 0; ch < ctx->channels; ch++) {
+			HISTORY(ctx)[ch][TAPS - 1 + i] = in[i * ctx->channels + ch];
+		}
+	}
+
+	filter = sample_rate_converter_polyphase_filter_get();
+
+	for (size_t i = 0; i < frames_out; i++) {
+		uint32_t phase_pos = ctx->phase_acc * PHASES;
+		uint32_t phase = phase_pos / ctx->sample_rate_output;
+		q63_t weight = ((q63_t)(phase_pos % ctx->sample_rate_output) << PHASE_WEIGHT_BITS) /
+			       ctx->sample_rate_output;
+
+		for (uint8_t ch = 0; ch < ctx->channels; ch++) {
+			out[i * ctx->channels + ch] =
+				filter_sample(&HISTORY(ctx)[ch][ctx->pos - (TAPS - 1)],
+					      filter[phase], filter[phase + 1], weight);
+		}
+
+		ctx->phase_acc += ctx->sample_rate_input;
+		while (ctx->phase_acc >= ctx->sample_rate_output) {
+			ctx->phase_acc -= ctx->sample_rate_output;
+			ctx->pos++;
+		}
+	}
+
+	/* Keep the newest samples as history for the next call */
+	for (uint8_t ch = 0; ch < ctx->channels; ch++) {
+		memmove(HISTORY(ctx)[ch], &HISTORY(ctx)[ch][frames_in],
+			(TAPS - 1) * sizeof(sample_t));
+	}
+	ctx->pos -= frames_in;
+
+	*output_written = frames_out * frame_size;
+
+	return 0;
+}
@@ -27,6 +27,8 @@ LOG_MODULE_DECLARE(sms, CONFIG_SMS_LOG_LEVEL);
 #define SMS_MAX_CONCAT_PAYLOAD_LEN_CHARS \
 	(SMS_MAX_PAYLOAD_LEN_CHARS - SMS_UDH_CONCAT_SIZE_SEPTETS)
 
+static const char hex_digits[] = "0123456789ABCDEF";
+
 /**
  * @brief Encode phone number into format specified within SMS header.
  *
@@ -182,10 +184,12 @@ static int sms_submit_encode(
 	}
 
 	/* Then, add the actual user data by creating hexadecimal string
-	 * representation of GSM 7bit encoded text
+	 * representation of GSM 7bit encoded text. This is done without sprintf()
+	 * because it is called for every octet of every message part.
 	 */
 	for (int i = 0; i < encoded_data_size_octets; i++) {
-		sprintf(send_buf + ud_start_index + (2 * i), "%02X", encoded[i]);
+		send_buf[ud_start_index + (2 * i)] = hex_digits[encoded[i] >> 4];
+		send_buf[ud_start_index + (2 * i) + 1] = hex_digits[encoded[i] & 0x0F];
 	}
 	send_buf[ud_start_index + encoded_data_size_octets * 2] = '\x1a';
 	send_buf[ud_start_index + encoded_data_size_octets * 2 + 1] = '\0';
@@ -264,11 +268,13 @@ static int sms_submit_concat(
 
 		/* User Data Header is included into encoded buffer because the actual data/text
 		 * must be aligned into septet (7bit) boundary after User Data Header.
+		 * Packing is only needed when the part is actually sent, counting the parts
+		 * just needs the number of converted characters.
 		 */
 		size = string_conversion_ascii_to_gsm7bit(user_data,
 			SMS_UDH_CONCAT_SIZE_SEPTETS + text_part_size,
 			sms_payload_tmp, &encoded_data_size_octets, &encoded_data_size_septets,
-			true);
+			send_at_cmds);
 
 		/* User Data Header septets must be ignored from the text size and indexing */
 		text_encoded_size += size - SMS_UDH_CONCAT_SIZE_SEPTETS;
@@ -374,6 +380,9 @@ int sms_submit_send(
 		err = sms_submit_concat(data,
 			encoded_number, encoded_number_size, encoded_number_size_octets,
 			false, &concat_msg_count);
+		if (err) {
+			return err;
+		}
 
 		/* Then, encode and send message parts */
 		err = sms_submit_concat(data,
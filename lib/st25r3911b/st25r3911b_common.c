@@ -332,13 +332,9 @@ int st25r3911b_non_response_timer_set(uint16_t fc, bool long_range, bool emv)
 		return err;
 	}
 
-	err = st25r3911b_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG1, reg_data[0]);
-	if (err) {
-		return err;
-	}
-
-	return st25r3911b_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG2,
-				    reg_data[1]);
+	/* Both timer registers are adjacent, write them in one SPI transaction. */
+	return st25r3911b_multiple_reg_write(ST25R3911B_REG_NO_RSP_TIM_REG1,
+					     reg_data, ARRAY_SIZE(reg_data));
 }
 
 int st25r3911b_mask_receive_timer_set(uint32_t fc)
@@ -114,6 +114,9 @@ int st25r3911b_irq_modify(uint32_t clr_mask, uint32_t set_mask)
 	int err = 0;
 	uint32_t mask;
 	uint32_t old_mask;
+	uint8_t val[IRQ_REG_CNT];
+	size_t first = IRQ_REG_CNT;
+	size_t last = 0;
 	k_spinlock_key_t key;
 
 	key = k_spin_lock(&spinlock);
@@ -126,20 +129,23 @@ int st25r3911b_irq_modify(uint32_t clr_mask, uint32_t set_mask)
 
 	irq_mask = old_mask;
 
+	/* Mask registers are adjacent, so write the whole changed range
+	 * in a single SPI transaction.
+	 */
 	for (size_t i = 0; i < IRQ_REG_CNT; i++) {
-		if (!((mask >> (8 * i)) & 0xFF)) {
-			continue;
-		}
+		val[i] = (uint8_t)(old_mask >> (8 * i));
 
-		uint8_t val = (uint8_t)(old_mask >> (8 * i));
-
-		err = st25r3911b_reg_write(ST25R3911B_REG_MASK_MAIN_INT + i,
-					   val);
-		if (err) {
-			break;
+		if ((mask >> (8 * i)) & 0xFF) {
+			first = MIN(first, i);
+			last = i;
 		}
 	}
 
+	if (first < IRQ_REG_CNT) {
+		err = st25r3911b_multiple_reg_write(ST25R3911B_REG_MASK_MAIN_INT + first,
+						    &val[first], last - first + 1);
+	}
+
 	k_spin_unlock(&spinlock, key);
 
 	LOG_DBG("Interrupts modified, current state %u", old_mask);
@@ -126,6 +126,7 @@ struct st25r3911b_nfca {
 	struct nfc_transfer transfer;
 	struct nfc_fifo fifo;
 	struct fifo_water_lvl water_lvl;
+	uint8_t frame_mode;
 	uint32_t cmd;
 	const struct st25r3911b_nfca_cb *cb;
 };
@@ -154,6 +155,12 @@ enum {
 	RX_STATE_COMPLETE
 };
 
+enum {
+	FRAME_MODE_UNKNOWN,
+	FRAME_MODE_STANDARD,
+	FRAME_MODE_ANTICOLLISION
+};
+
 enum {
 	ANTICOLLISION_CASCADE_1 = 1,
 	ANTICOLLISION_CASCADE_2,
@@ -204,6 +211,40 @@ static void timeout_process(void)
 	}
 }
 
+/* Switch between bit oriented anticollision frames without Rx CRC and standard
+ * frames. The reader keeps this configuration between transfers, so the
+ * registers are only touched when the mode actually changes.
+ */
+static int frame_mode_set(bool antcl)
+{
+	int err;
+	uint8_t mode = antcl ? FRAME_MODE_ANTICOLLISION : FRAME_MODE_STANDARD;
+
+	if (nfca.frame_mode == mode) {
+		return 0;
+	}
+
+	nfca.frame_mode = FRAME_MODE_UNKNOWN;
+
+	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
+				    antcl ? 0 : ST25R3911B_REG_ISO14443A_ANTCL,
+				    antcl ? ST25R3911B_REG_ISO14443A_ANTCL : 0);
+	if (err) {
+		return err;
+	}
+
+	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
+				    antcl ? 0 : ST25R3911B_REG_AUXILIARY_NO_CRC_RX,
+				    antcl ? ST25R3911B_REG_AUXILIARY_NO_CRC_RX : 0);
+	if (err) {
+		return err;
+	}
+
+	nfca.frame_mode = mode;
+
+	return 0;
+}
+
 static int transmission_prepare(void)
 {
 	int err;
@@ -239,35 +280,14 @@ static int anticollision_transmit(uint8_t *tx_buf, size_t tx_bytes,
 	uint32_t mask_timer;
 	uint16_t no_rsp_timer;
 
-	if (antcl) {
-		/* Set sending anticollision frame */
-		err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A, 0,
-					    ST25R3911B_REG_ISO14443A_ANTCL);
-		if (err) {
-			return err;
-		}
-
-		err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY, 0,
-					    ST25R3911B_REG_AUXILIARY_NO_CRC_RX);
-		if (err) {
-			return err;
-		}
+	/* Set or unset sending anticollision frame */
+	err = frame_mode_set(antcl);
+	if (err) {
+		return err;
+	}
 
+	if (antcl) {
 		LOG_DBG("Bit oriented anticollision frame will be sent");
-
-	} else {
-		/* Unset sending anticollision frame */
-		err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
-					    ST25R3911B_REG_ISO14443A_ANTCL, 0);
-		if (err) {
-			return err;
-		}
-
-		err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
-					    ST25R3911B_REG_AUXILIARY_NO_CRC_RX, 0);
-		if (err) {
-			return err;
-		}
 	}
 
 	mask_timer = NFCA_MIN_LISTEN_FDT -
@@ -764,16 +784,8 @@ static int tag_detect(enum st25r3911b_nfca_detect_cmd cmd)
 	uint32_t mask_timer;
 	uint32_t no_rsp_timer;
 
-	/* Set sending anticollision frame */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A, 0,
-				    ST25R3911B_REG_ISO14443A_ANTCL);
-	if (err) {
-		return err;
-	}
-
-	/* Rx data do not contain the CRC. */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY, 0,
-				    ST25R3911B_REG_AUXILIARY_NO_CRC_RX);
+	/* Set sending anticollision frame, Rx data do not contain the CRC. */
+	err = frame_mode_set(true);
 	if (err) {
 		return err;
 	}
@@ -864,21 +876,7 @@ static int transfer(const struct st25r3911b_nfca_buf *tx,
 	uint32_t irq;
 
 	/* Do not set sending anticollision frame */
-	err = st25r3911b_reg_modify(ST25R3911B_REG_ISO14443A,
-				    ST25R3911B_REG_ISO14443A_ANTCL, 0);
-	if (err) {
-		return err;
-	}
-
-	err = st25r3911b_reg_modify(ST25R3911B_REG_AUXILIARY,
-				    ST25R3911B_REG_AUXILIARY_NO_CRC_RX, 0);
-	if (err) {
-		return err;
-	}
-
-	/* Read FIFO water level */
-	err = st25r3911b_fifo_reload_lvl_get(&nfca.water_lvl.tx,
-					     &nfca.water_lvl.rx);
+	err = frame_mode_set(false);
 	if (err) {
 		return err;
 	}
@@ -1081,6 +1079,9 @@ int st25r3911b_nfca_init(struct k_poll_event *events, uint8_t cnt,
 		return err;
 	}
 
+	/* Registers are reset to defaults, the frame mode is configured on first use. */
+	nfca.frame_mode = FRAME_MODE_UNKNOWN;
+
 	/* Initialize ST25R3911B */
 	err = st25r3911b_init();
 	if (err) {
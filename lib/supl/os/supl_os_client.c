@@ -126,15 +126,26 @@ static int set_lte_params(void)
 
 int supl_session(const struct nrf_modem_gnss_agnss_data_frame *const agnss_request)
 {
-	set_device_id();
-	set_lte_params();
-
 	/* GPS data need is always expected to be present and first in list. */
 	__ASSERT(agnss_request->system_count > 0,
 		 "GNSS system data need not found");
 	__ASSERT(agnss_request->system[0].system_id == NRF_MODEM_GNSS_SYSTEM_GPS,
 		 "GPS data need not found");
 
+	/* The modem keeps the assistance data it already has and only requests
+	 * the missing parts. Skip the AT queries and the SUPL exchange when
+	 * nothing is needed.
+	 */
+	if (agnss_request->data_flags == 0 &&
+	    agnss_request->system[0].sv_mask_alm == 0 &&
+	    agnss_request->system[0].sv_mask_ephe == 0) {
+		LOG_DBG("No A-GNSS data requested, skipping SUPL session");
+		return 0;
+	}
+
+	set_device_id();
+	set_lte_params();
+
 	supl_client_ctx.agps_types.data_flags = agnss_request->data_flags;
 	supl_client_ctx.agps_types.sv_mask_alm = agnss_request->system[0].sv_mask_alm;
 	supl_client_ctx.agps_types.sv_mask_ephe = agnss_request->system[0].sv_mask_ephe;
@@ -11,12 +11,15 @@
 #include "lc_pwm_led.h"
 
 #define PWM_SIZE_STEP 512
+/* Shortest interval between two light level updates during a transition. */
+#define TRANSITION_FRAME_MS 20
 
 struct lightness_ctx {
 	struct bt_mesh_lightness_srv lightness_srv;
 	struct k_work_delayable per_work;
 	uint16_t target_lvl;
 	uint16_t current_lvl;
+	uint16_t step;
 	uint32_t time_per;
 	uint32_t rem_time;
 };
@@ -110,11 +113,18 @@ BT_MESH_HEALTH_PUB_DEFINE(health_pub, 0);
 static void start_new_light_trans(const struct bt_mesh_lightness_set *set,
 				  struct lightness_ctx *ctx)
 {
-	uint32_t step_cnt = abs(set->lvl - ctx->current_lvl) / PWM_SIZE_STEP;
+	uint32_t delta = abs(set->lvl - ctx->current_lvl);
+	uint32_t step_cnt = delta / PWM_SIZE_STEP;
 	uint32_t time = set->transition ? set->transition->time : 0;
 	uint32_t delay = set->transition ? set->transition->delay : 0;
 
+	/* Use larger steps rather than updating the LED more often than once
+	 * per frame.
+	 */
+	step_cnt = MIN(step_cnt, time / TRANSITION_FRAME_MS);
+
 	ctx->target_lvl = set->lvl;
+	ctx->step = step_cnt ? delta / step_cnt : delta;
 	ctx->time_per = (step_cnt ? time / step_cnt : 0);
 	ctx->rem_time = time;
 	k_work_reschedule(&ctx->per_work, K_MSEC(delay));
@@ -131,7 +141,7 @@ static void periodic_led_work(struct k_work *work)
 	l_ctx->rem_time -= l_ctx->time_per;
 
 	if ((l_ctx->rem_time <= l_ctx->time_per) ||
-	    (abs(l_ctx->target_lvl - l_ctx->current_lvl) <= PWM_SIZE_STEP)) {
+	    (abs(l_ctx->target_lvl - l_ctx->current_lvl) <= l_ctx->step)) {
 		struct bt_mesh_lightness_status status = {
 			.current = l_ctx->target_lvl,
 			.target = l_ctx->target_lvl,
@@ -144,9 +154,9 @@ static void periodic_led_work(struct k_work *work)
 
 		goto apply_and_print;
 	} else if (l_ctx->target_lvl > l_ctx->current_lvl) {
-		l_ctx->current_lvl += PWM_SIZE_STEP;
+		l_ctx->current_lvl += l_ctx->step;
 	} else {
-		l_ctx->current_lvl -= PWM_SIZE_STEP;
+		l_ctx->current_lvl -= l_ctx->step;
 	}
 
 	k_work_reschedule(&l_ctx->per_work, K_MSEC(l_ctx->time_per));
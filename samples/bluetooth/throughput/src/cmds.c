@@ -258,6 +258,15 @@ static int test_run_cmd(const struct shell *shell, size_t argc,
 			test_params.data_len);
 }
 
+#if defined(CONFIG_BT_NUS_TX_STREAM)
+static int nus_stream_cmd(const struct shell *shell, size_t argc,
+			  char **argv)
+{
+	return nus_stream_run(shell, test_params.conn_param, test_params.phy,
+			      test_params.data_len);
+}
+#endif /* CONFIG_BT_NUS_TX_STREAM */
+
 static int test_central_cmd(const struct shell *shell, size_t argc,
 			    char **argv)
 {
@@ -274,5 +283,8 @@ static int test_peripheral_cmd(const struct shell *shell, size_t argc,
 
 SHELL_CMD_REGISTER(config, &sub_config, "Configure the example", default_cmd);
 SHELL_CMD_REGISTER(run, NULL, "Run the test", test_run_cmd);
+#if defined(CONFIG_BT_NUS_TX_STREAM)
+SHELL_CMD_REGISTER(nus_stream, NULL, "Run the NUS stream test", nus_stream_cmd);
+#endif
 SHELL_CMD_REGISTER(central, NULL, "Select central role", test_central_cmd);
 SHELL_CMD_REGISTER(peripheral, NULL, "Select peripheral role", test_peripheral_cmd);
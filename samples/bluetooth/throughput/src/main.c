@@ -18,6 +18,7 @@
 #include <zephyr/bluetooth/hci.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <bluetooth/services/throughput.h>
+#include <bluetooth/services/nus.h>
 #include <bluetooth/scan.h>
 #include <bluetooth/gatt_dm.h>
 
@@ -484,11 +485,6 @@ static int connection_configuration_set(const struct shell *shell,
 		return err;
 	}
 
-	if (info.role != BT_CONN_ROLE_CENTRAL) {
-		shell_error(shell,
-		"'run' command shall be executed only on the central board");
-	}
-
 	err = bt_conn_le_phy_update(default_conn, phy);
 	if (err) {
 		shell_error(shell, "PHY update failed: %d\n", err);
@@ -550,6 +546,7 @@ int test_run(const struct shell *shell,
 	uint64_t stamp;
 	int64_t delta;
 	uint32_t data = 0;
+	struct bt_conn_info info = {0};
 
 	const char *img_ptr = img;
 	char str_buf[7];
@@ -573,6 +570,17 @@ int test_run(const struct shell *shell,
 
 	shell_print(shell, "\n==== Starting throughput test ====");
 
+	err = bt_conn_get_info(default_conn, &info);
+	if (err) {
+		shell_error(shell, "Failed to get connection info %d", err);
+		return err;
+	}
+
+	if (info.role != BT_CONN_ROLE_CENTRAL) {
+		shell_error(shell,
+		"'run' command shall be executed only on the central board");
+	}
+
 	err = connection_configuration_set(shell, conn_param, phy, data_len);
 	if (err) {
 		return err;
@@ -643,6 +651,80 @@ int test_run(const struct shell *shell,
 	return 0;
 }
 
+#if defined(CONFIG_BT_NUS_TX_STREAM)
+int nus_stream_run(const struct shell *shell,
+		   const struct bt_le_conn_param *conn_param,
+		   const struct bt_conn_le_phy_param *phy,
+		   const struct bt_conn_le_data_len_param *data_len)
+{
+	int err;
+	int queued;
+	int64_t stamp;
+	int64_t delta;
+	uint32_t data = 0;
+
+	/* a dummy data buffer */
+	static char dummy[495];
+
+	if (!default_conn) {
+		shell_error(shell, "Device is disconnected %s",
+			    "Connect to the peer device before running test");
+		return -EFAULT;
+	}
+
+	shell_print(shell, "\n==== Starting NUS stream test ====");
+
+	err = connection_configuration_set(shell, conn_param, phy, data_len);
+	if (err) {
+		return err;
+	}
+
+	/* The central exchanges the MTU after the service discovery, so this
+	 * is only needed when the peer did not do it.
+	 */
+	if (bt_gatt_get_mtu(default_conn) == BT_ATT_DEFAULT_LE_MTU) {
+		exchange_params.func = exchange_func;
+
+		err = bt_gatt_exchange_mtu(default_conn, &exchange_params);
+		if (err) {
+			shell_error(shell, "MTU exchange failed (err %d)", err);
+		}
+	}
+
+	/* Make sure that all BLE procedures are finished. */
+	k_sleep(K_MSEC(500));
+
+	shell_print(shell, "Streaming with ATT MTU %u",
+		    bt_gatt_get_mtu(default_conn));
+
+	stamp = k_uptime_get();
+
+	while (k_uptime_get() - stamp <= CONFIG_BT_THROUGHPUT_DURATION) {
+		queued = bt_nus_stream_send(default_conn, dummy, sizeof(dummy));
+		if (queued < 0) {
+			shell_error(shell, "NUS stream failed (err %d)", queued);
+			shell_error(shell, "Is the peer subscribed to the NUS TX characteristic?");
+			return queued;
+		}
+
+		if (queued == 0) {
+			/* The stream buffer is full, let it drain. */
+			k_sleep(K_MSEC(1));
+		}
+
+		data += queued;
+	}
+
+	delta = k_uptime_delta(&stamp);
+
+	printk("\nDone\n");
+	printk("[local] queued %u bytes (%u KB) in %lld ms at %llu kbps\n",
+	       data, data / 1024, delta, ((uint64_t)data * 8 / delta));
+
+	return 0;
+}
+#endif /* CONFIG_BT_NUS_TX_STREAM */
+
 BT_CONN_CB_DEFINE(conn_callbacks) = {
 	.connected = connected,
 	.disconnected = disconnected,
@@ -675,6 +757,14 @@ int main(void)
 		return 0;
 	}
 
+	if (IS_ENABLED(CONFIG_BT_NUS_TX_STREAM)) {
+		err = bt_nus_init(NULL);
+		if (err) {
+			printk("NUS service initialization failed.\n");
+			return 0;
+		}
+	}
+
 	printk("\n");
 	printk("Press button 1 or type \"central\" on the central board.\n");
 	printk("Press button 2 or type \"peripheral\" on the peripheral board.\n");
@@ -20,6 +20,22 @@ int test_run(const struct shell *shell,
 	     const struct bt_conn_le_phy_param *phy,
 	     const struct bt_conn_le_data_len_param *data_len);
 
+/**
+ * @brief Run the NUS stream test
+ *
+ * Streams data with @ref bt_nus_stream_send to a peer subscribed to
+ * the NUS TX characteristic.
+ *
+ * @param shell       Shell instance where output will be printed.
+ * @param conn_param  Connection parameters.
+ * @param phy         Phy parameters.
+ * @param data_len    Maximum transmission payload.
+ */
+int nus_stream_run(const struct shell *shell,
+		   const struct bt_le_conn_param *conn_param,
+		   const struct bt_conn_le_phy_param *phy,
+		   const struct bt_conn_le_data_len_param *data_len);
+
 /**
  * @brief Set the board into a specific role.
  *
@@ -24,6 +24,10 @@ if(CONFIG_CHIP_OTA_REQUESTOR OR CONFIG_MCUMGR_TRANSPORT_BT)
     target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/dfu/ota/ota_util.cpp)
 endif()
 
+if(CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINED_IMAGE_PROCESSOR)
+    target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/dfu/ota/ota_image_processor_pipelined_impl.cpp)
+endif()
+
 if(CONFIG_PWM)
     target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/pwm/pwm_device.cpp)
 endif()
@@ -33,7 +37,7 @@ if(CONFIG_MCUMGR_TRANSPORT_BT)
     target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/dfu/smp/dfu_over_smp.cpp)
 endif()
 
-if(CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS)
+if(CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS OR CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE)
     target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/migration/migration_manager.cpp)
 endif()
 
@@ -8,27 +8,235 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
-constexpr size_t kTaskQueueSize = CONFIG_NCS_SAMPLE_MATTER_APP_TASK_QUEUE_SIZE;
+namespace
+{
+constexpr size_t kDispatchBatchSize = CONFIG_NCS_SAMPLE_MATTER_APP_TASK_DISPATCH_BATCH_SIZE;
+
+constexpr size_t RoundUpToPowerOfTwo(size_t value)
+{
+	size_t result = 1;
+
+	while (result < value) {
+		result <<= 1;
+	}
+
+	return result;
+}
+
+/* Distance between two positions of a lane, taking the wrap-around of the position counters into account. */
+atomic_val_t Distance(atomic_val_t to, atomic_val_t from)
+{
+	return static_cast<atomic_val_t>(static_cast<uintptr_t>(to) - static_cast<uintptr_t>(from));
+}
+
+/*
+ * Bounded lock-free queue with multiple producers and a single consumer.
+ *
+ * Each cell holds a sequence number that tells whether the cell is free for the producer that claimed the given
+ * position, or whether it holds a task ready to be consumed. Producers claim positions by advancing the enqueue
+ * position with a compare-and-swap operation, so the queue can be safely used from threads and interrupts at the
+ * same time. The capacity is rounded up to a power of two, so that the cell index stays consistent when the
+ * position counters wrap around.
+ */
+template <size_t Size> class TaskLane {
+public:
+	static constexpr size_t kCapacity = RoundUpToPowerOfTwo(Size);
+
+	TaskLane()
+	{
+		for (size_t i = 0; i < kCapacity; i++) {
+			atomic_set(&mCells[i].mSequence, static_cast<atomic_val_t>(i));
+		}
+	}
+
+	bool Push(const Nrf::Task &task)
+	{
+		atomic_val_t position = atomic_get(&mEnqueuePosition);
+		Cell *cell;
+
+		for (;;) {
+			cell = &mCells[static_cast<uintptr_t>(position) & kMask];
+			atomic_val_t distance = Distance(atomic_get(&cell->mSequence), position);
+
+			if (distance == 0) {
+				if (atomic_cas(&mEnqueuePosition, position, position + 1)) {
+					break;
+				}
+				position = atomic_get(&mEnqueuePosition);
+			} else if (distance < 0) {
+				/* The cell still holds a task from the previous round, so the lane is full. */
+				atomic_inc(&mOverflows);
+				return false;
+			} else {
+				/* Another producer has claimed the position in the meantime. */
+				position = atomic_get(&mEnqueuePosition);
+			}
+		}
+
+		cell->mTask = task;
+		atomic_set(&cell->mSequence, position + 1);
+		UpdateHighWaterMark(Distance(position + 1, atomic_get(&mDequeuePosition)));
+
+		return true;
+	}
+
+	bool Pop(Nrf::Task &task)
+	{
+		atomic_val_t position = atomic_get(&mDequeuePosition);
+		Cell &cell = mCells[static_cast<uintptr_t>(position) & kMask];
+
+		/* The lane is empty or the producer that claimed the position has not stored the task yet. */
+		if (Distance(atomic_get(&cell.mSequence), position + 1) < 0) {
+			return false;
+		}
+
+		task = cell.mTask;
+		atomic_set(&cell.mSequence, position + static_cast<atomic_val_t>(kCapacity));
+		atomic_set(&mDequeuePosition, position + 1);
+
+		return true;
+	}
+
+	Nrf::TaskQueueStatistics GetStatistics()
+	{
+		return { kCapacity, Used(), static_cast<size_t>(atomic_get(&mHighWaterMark)),
+			 static_cast<uint32_t>(atomic_get(&mOverflows)) };
+	}
+
+	void ResetHighWaterMark() { atomic_set(&mHighWaterMark, static_cast<atomic_val_t>(Used())); }
 
-K_MSGQ_DEFINE(sTaskQueue, sizeof(Nrf::Task), kTaskQueueSize, alignof(Nrf::Task));
+private:
+	static constexpr uintptr_t kMask = kCapacity - 1;
+
+	struct Cell {
+		atomic_t mSequence;
+		Nrf::Task mTask;
+	};
+
+	size_t Used()
+	{
+		atomic_val_t used = Distance(atomic_get(&mEnqueuePosition), atomic_get(&mDequeuePosition));
+
+		/* The positions are read separately, so the result may be off while the lane is being modified. */
+		if (used < 0) {
+			return 0;
+		}
+
+		return MIN(static_cast<size_t>(used), kCapacity);
+	}
+
+	void UpdateHighWaterMark(atomic_val_t used)
+	{
+		atomic_val_t highWaterMark = atomic_get(&mHighWaterMark);
+
+		while (used > highWaterMark && !atomic_cas(&mHighWaterMark, highWaterMark, used)) {
+			highWaterMark = atomic_get(&mHighWaterMark);
+		}
+	}
+
+	Cell mCells[kCapacity];
+	atomic_t mEnqueuePosition = ATOMIC_INIT(0);
+	atomic_t mDequeuePosition = ATOMIC_INIT(0);
+	atomic_t mHighWaterMark = ATOMIC_INIT(0);
+	atomic_t mOverflows = ATOMIC_INIT(0);
+};
+
+TaskLane<CONFIG_NCS_SAMPLE_MATTER_APP_TASK_QUEUE_URGENT_SIZE> sUrgentLane;
+TaskLane<CONFIG_NCS_SAMPLE_MATTER_APP_TASK_QUEUE_SIZE> sNormalLane;
+TaskLane<CONFIG_NCS_SAMPLE_MATTER_APP_TASK_QUEUE_BACKGROUND_SIZE> sBackgroundLane;
+
+/* Wakes up the application thread when a new task is posted. */
+K_SEM_DEFINE(sTaskSignal, 0, 1);
+
+bool PopTask(Nrf::Task &task)
+{
+	return sUrgentLane.Pop(task) || sNormalLane.Pop(task) || sBackgroundLane.Pop(task);
+}
+} /* namespace */
 
 namespace Nrf
 {
-	void PostTask(const Task &task)
+	bool PostTask(const Task &task, TaskPriority priority)
 	{
-		if (k_msgq_put(&sTaskQueue, &task, K_NO_WAIT) != 0) {
-			LOG_ERR("Failed to post event to app task event queue");
+		bool posted = false;
+
+		switch (priority) {
+		case TaskPriority::Urgent:
+			posted = sUrgentLane.Push(task);
+			break;
+		case TaskPriority::Normal:
+			posted = sNormalLane.Push(task);
+			break;
+		case TaskPriority::Background:
+			posted = sBackgroundLane.Push(task);
+			break;
+		default:
+			break;
 		}
+
+		if (!posted) {
+			LOG_ERR("Failed to post task to app task queue (priority %u)", static_cast<unsigned>(priority));
+			return false;
+		}
+
+		k_sem_give(&sTaskSignal);
+
+		return true;
 	}
 
 	void DispatchNextTask()
 	{
 		Task task;
-		k_msgq_get(&sTaskQueue, &task, K_FOREVER);
+
+		/*
+		 * A wake-up signal does not guarantee that a task can be popped: the producer that claimed the first
+		 * free position in a lane may still be storing its task. It signals again once the task is stored.
+		 */
+		while (!PopTask(task)) {
+			k_sem_take(&sTaskSignal, K_FOREVER);
+		}
+
 		task();
+
+		/* Re-check the lanes before every task, so that urgent tasks posted meanwhile are not delayed. */
+		for (size_t i = 1; i < kDispatchBatchSize && PopTask(task); i++) {
+			task();
+		}
+	}
+
+	TaskQueueStatistics GetTaskQueueStatistics(TaskPriority priority)
+	{
+		switch (priority) {
+		case TaskPriority::Urgent:
+			return sUrgentLane.GetStatistics();
+		case TaskPriority::Normal:
+			return sNormalLane.GetStatistics();
+		case TaskPriority::Background:
+			return sBackgroundLane.GetStatistics();
+		default:
+			return {};
+		}
+	}
+
+	void ResetTaskQueueHighWaterMark(TaskPriority priority)
+	{
+		switch (priority) {
+		case TaskPriority::Urgent:
+			sUrgentLane.ResetHighWaterMark();
+			break;
+		case TaskPriority::Normal:
+			sNormalLane.ResetHighWaterMark();
+			break;
+		case TaskPriority::Background:
+			sBackgroundLane.ResetHighWaterMark();
+			break;
+		default:
+			break;
+		}
 	}
 
 } /* namespace Nrf */
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace Nrf
@@ -50,6 +52,25 @@ namespace Nrf
 		Handler mHandler;
 	};
 
+	/**
+	 * @brief Priority of a task posted to the task queue.
+	 *
+	 * Each priority is served by a separate queue lane of a fixed size. Tasks from a higher priority lane are
+	 * always dispatched before tasks from a lower priority lane, so that latency sensitive work, such as
+	 * handling buttons and LEDs, does not wait behind bursts of less important tasks.
+	 */
+	enum class TaskPriority : uint8_t { Urgent, Normal, Background, Count };
+
+	/**
+	 * @brief Statistics of a single task queue lane.
+	 */
+	struct TaskQueueStatistics {
+		size_t mCapacity; /* Maximum number of tasks that can be queued in the lane. */
+		size_t mUsed; /* Number of tasks currently waiting in the lane. */
+		size_t mHighWaterMark; /* Maximum number of tasks that have been waiting in the lane at once. */
+		uint32_t mOverflows; /* Number of tasks dropped because the lane was full. */
+	};
+
 	/**
 	 * @brief Post a task to the task queue.
 	 *
@@ -64,17 +85,38 @@ namespace Nrf
 	 * uint32_t myNumber;
 	 * PostTask([myNumber]{ MyMethod(myNumber) };)
 	 *
+	 * The method does not block and can be called from an interrupt context.
+	 *
 	 * @param task the Task to be posted to the application thread's task queue
+	 * @param priority the priority of the task
+	 * @return true if the task has been queued, false if the queue lane of the given priority was full
 	 */
-	void PostTask(const Task &task);
+	bool PostTask(const Task &task, TaskPriority priority = TaskPriority::Normal);
 
 	/**
-	 * @brief Dispatch the next available task.
+	 * @brief Dispatch the next available tasks.
 	 *
 	 * This is a blocking method that should be called in an application thread.
 	 * Dispatching events relies on constant waiting for the next event posted in the
 	 * task queue.
 	 *
+	 * Once woken up, the method dispatches up to \c CONFIG_NCS_SAMPLE_MATTER_APP_TASK_DISPATCH_BATCH_SIZE tasks
+	 * in a row. The highest priority lane that is not empty is selected before each dispatched task.
 	 */
 	void DispatchNextTask();
+
+	/**
+	 * @brief Get statistics of the task queue lane of the given priority.
+	 *
+	 * @param priority the priority of the lane
+	 * @return statistics of the lane
+	 */
+	TaskQueueStatistics GetTaskQueueStatistics(TaskPriority priority);
+
+	/**
+	 * @brief Reset the high-water mark of the task queue lane of the given priority to the current usage.
+	 *
+	 * @param priority the priority of the lane
+	 */
+	void ResetTaskQueueHighWaterMark(TaskPriority priority);
 } /* namespace Nrf */
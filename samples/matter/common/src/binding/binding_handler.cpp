@@ -7,12 +7,46 @@
 #include "binding_handler.h"
 
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
 using namespace chip;
 using namespace chip::app;
 
+namespace
+{
+constexpr size_t kBindingDataPoolSize = CONFIG_NCS_SAMPLE_MATTER_BINDING_DATA_POOL_SIZE;
+
+Nrf::Matter::BindingHandler::BindingData sBindingDataPool[kBindingDataPoolSize];
+ATOMIC_DEFINE(sBindingDataPoolUsed, kBindingDataPoolSize);
+
+bool IsBoundTo(const EmberBindingTableEntry &entry, EndpointId endpointId, ClusterId clusterId)
+{
+	return entry.local == endpointId && entry.clusterId.HasValue() && entry.clusterId.Value() == clusterId;
+}
+
+/* Group commands are delivered to all endpoints of the group members, so several group bindings that differ only by
+ * the remote endpoint result in the same group command. Check if the given group binding is preceded in the binding
+ * table by another binding that already addresses the same group. */
+bool IsDuplicateGroupBinding(const EmberBindingTableEntry &binding)
+{
+	for (auto &entry : BindingTable::GetInstance()) {
+		if (&entry == &binding) {
+			return false;
+		}
+
+		if (entry.type == EMBER_MULTICAST_BINDING && entry.fabricIndex == binding.fabricIndex &&
+		    entry.groupId == binding.groupId && entry.local == binding.local &&
+		    entry.clusterId == binding.clusterId) {
+			return true;
+		}
+	}
+
+	return false;
+}
+} /* namespace */
+
 namespace Nrf::Matter
 {
 	void BindingHandler::Init()
@@ -20,6 +54,27 @@ namespace Nrf::Matter
 		InitInternal();
 	}
 
+	BindingHandler::BindingData *BindingHandler::AllocBindingData()
+	{
+		for (size_t i = 0; i < kBindingDataPoolSize; i++) {
+			if (!atomic_test_and_set_bit(sBindingDataPoolUsed, i)) {
+				sBindingDataPool[i] = BindingData{};
+				return &sBindingDataPool[i];
+			}
+		}
+
+		return Platform::New<BindingData>();
+	}
+
+	void BindingHandler::FreeBindingData(BindingData *bindingData)
+	{
+		if (bindingData >= sBindingDataPool && bindingData < sBindingDataPool + kBindingDataPoolSize) {
+			atomic_clear_bit(sBindingDataPoolUsed, bindingData - sBindingDataPool);
+		} else {
+			Platform::Delete<BindingData>(bindingData);
+		}
+	}
+
 	void BindingHandler::RunBoundClusterAction(BindingData *bindingData)
 	{
 		VerifyOrReturn(bindingData != nullptr, LOG_ERR("Invalid binding data"));
@@ -36,7 +91,7 @@ namespace Nrf::Matter
 		/* If session was recovered and communication works, reset flag to the initial state. */
 		if (bindingData->CaseSessionRecovered)
 			bindingData->CaseSessionRecovered = false;
-		Platform::Delete<BindingData>(bindingData);
+		FreeBindingData(bindingData);
 	}
 
 	void BindingHandler::OnInvokeCommandFailure(BindingData *bindingData, CHIP_ERROR Error)
@@ -58,7 +113,7 @@ namespace Nrf::Matter
 				LOG_ERR("NotifyBoundClusterChanged failed due to: %" CHIP_ERROR_FORMAT, error.Format());
 			}
 		} else {
-			Platform::Delete<BindingData>(bindingData);
+			FreeBindingData(bindingData);
 			LOG_ERR("Binding command was not applied! Reason: %" CHIP_ERROR_FORMAT, Error.Format());
 		}
 	}
@@ -71,7 +126,7 @@ namespace Nrf::Matter
 
 		if (binding.type == EMBER_MULTICAST_BINDING) {
 
-			if (data->IsGroup.HasValue() && !data->IsGroup.Value()) {
+			if ((data->IsGroup.HasValue() && !data->IsGroup.Value()) || IsDuplicateGroupBinding(binding)) {
 				return;
 			}
 
@@ -90,7 +145,7 @@ namespace Nrf::Matter
 	{
 		VerifyOrDie(context != 0);
 
-		Platform::Delete(static_cast<BindingData *>(context));
+		FreeBindingData(static_cast<BindingData *>(context));
 	}
 
 	void BindingHandler::InitInternal()
@@ -149,12 +204,54 @@ namespace Nrf::Matter
 		VerifyOrDie(context != 0);
 		BindingData *data = reinterpret_cast<BindingData *>(context);
 
-		if (BindingTable::GetInstance().Size() != 0) {
-			LOG_INF("Notify Bounded Cluster | endpoint: %d cluster: %d", data->EndpointId, data->ClusterId);
-			BindingManager::GetInstance().NotifyBoundClusterChanged(data->EndpointId, data->ClusterId,
-										static_cast<void *>(data));
-		} else {
+		if (BindingTable::GetInstance().Size() == 0) {
 			LOG_INF("NO DEVICE BOUND");
+			FreeBindingData(data);
+			return;
+		}
+
+		if (IsGroupOnly(*data)) {
+			LOG_INF("Notify Bounded Groups | endpoint: %d cluster: %d", data->EndpointId, data->ClusterId);
+			RunGroupAction(*data);
+			FreeBindingData(data);
+			return;
+		}
+
+		LOG_INF("Notify Bounded Cluster | endpoint: %d cluster: %d", data->EndpointId, data->ClusterId);
+		BindingManager::GetInstance().NotifyBoundClusterChanged(data->EndpointId, data->ClusterId,
+									static_cast<void *>(data));
+	}
+
+	bool BindingHandler::IsGroupOnly(const BindingData &bindingData)
+	{
+		if (bindingData.IsGroup.HasValue()) {
+			return bindingData.IsGroup.Value();
+		}
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_BINDING_GROUP_FIRST
+		/* Assume that the unicast targets are members of the bound group, so a single group command reaches
+		 * all of them without establishing a CASE session with every device. */
+		for (auto &entry : BindingTable::GetInstance()) {
+			if (entry.type == EMBER_MULTICAST_BINDING &&
+			    IsBoundTo(entry, bindingData.EndpointId, bindingData.ClusterId)) {
+				return true;
+			}
+		}
+#endif
+
+		return false;
+	}
+
+	void BindingHandler::RunGroupAction(BindingData &bindingData)
+	{
+		/* Group commands do not need the operational sessions, so send them directly instead of going through
+		 * the BindingManager that would connect to all unicast targets first. */
+		for (auto &entry : BindingTable::GetInstance()) {
+			if (entry.type == EMBER_MULTICAST_BINDING &&
+			    IsBoundTo(entry, bindingData.EndpointId, bindingData.ClusterId) &&
+			    !IsDuplicateGroupBinding(entry)) {
+				bindingData.InvokeCommandFunc(entry, nullptr, bindingData);
+			}
 		}
 	}
 
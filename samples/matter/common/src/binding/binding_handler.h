@@ -36,6 +36,24 @@ public:
 	 * @brief Initialaize internal actions
 	 */
 	static void Init();
+
+	/**
+	 * @brief Allocate binding data from the pool of statically allocated objects.
+	 *
+	 * If all pooled objects are in use, the binding data is allocated on the heap. The binding data passed to
+	 * RunBoundClusterAction is released by the BindingHandler once the binding action is completed.
+	 *
+	 * @return pointer to the value-initialized binding data, nullptr if no memory is available
+	 */
+	static BindingData *AllocBindingData();
+
+	/**
+	 * @brief Release binding data allocated with AllocBindingData or Platform::New.
+	 *
+	 * @param bindingData BindingData structure to be released
+	 */
+	static void FreeBindingData(BindingData *bindingData);
+
 	/**
 	 * @brief Print out to the log, binding table components and it's size
 	 */
@@ -67,6 +85,8 @@ private:
 					  chip::OperationalDeviceProxy *deviceProxy, void *context);
 	static void DeviceContextReleaseHandler(void *context);
 	static void InitInternal();
+	static bool IsGroupOnly(const BindingData &bindingData);
+	static void RunGroupAction(BindingData &bindingData);
 };
 
 } /* namespace Nrf::Matter */
@@ -109,7 +109,7 @@ void Board::LEDStateUpdateHandler(LEDWidget &ledWidget)
 {
 	LEDEvent event;
 	event.LedWidget = &ledWidget;
-	PostTask([event] { UpdateLedStateEventHandler(event); });
+	PostTask([event] { UpdateLedStateEventHandler(event); }, TaskPriority::Urgent);
 }
 
 void Board::UpdateLedStateEventHandler(const LEDEvent &event)
@@ -182,7 +182,7 @@ void Board::StartTimer(uint32_t timeoutInMs)
 
 void Board::FunctionTimerTimeoutCallback(k_timer *timer)
 {
-	PostTask([] { FunctionTimerEventHandler(); });
+	PostTask([] { FunctionTimerEventHandler(); }, TaskPriority::Urgent);
 }
 
 void Board::FunctionTimerEventHandler()
@@ -219,13 +219,13 @@ void Board::ButtonEventHandler(ButtonState buttonState, ButtonMask hasChanged)
 	if (BLUETOOTH_ADV_BUTTON_MASK & hasChanged) {
 		ButtonAction action =
 			(BLUETOOTH_ADV_BUTTON_MASK & buttonState) ? ButtonAction::Pressed : ButtonAction::Released;
-		PostTask([action] { StartBLEAdvertisementHandler(action); });
+		PostTask([action] { StartBLEAdvertisementHandler(action); }, TaskPriority::Urgent);
 	}
 
 	if (FUNCTION_BUTTON_MASK & hasChanged) {
 		ButtonAction action =
 			(BLUETOOTH_ADV_BUTTON_MASK & buttonState) ? ButtonAction::Pressed : ButtonAction::Released;
-		PostTask([action] { FunctionHandler(action); });
+		PostTask([action] { FunctionHandler(action); }, TaskPriority::Urgent);
 	}
 }
 
@@ -15,11 +15,37 @@ namespace Nrf {
 
 static LEDWidget::LEDWidgetStateUpdateHandler sStateUpdateCallback;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+/*
+ * All blinking LEDs are driven by a single timer, whose handler changes the LED states directly in the timer
+ * context. The state changes are aligned to a common time grid, so that LEDs blinking at compatible rates are
+ * handled within a single wake-up, and no tasks are posted to the application thread.
+ */
+static constexpr int64_t kPatternQuantumMS = CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE_QUANTUM_MS;
+
+static k_timer sPatternTimer;
+static k_spinlock sPatternLock;
+static LEDWidget *sPatternWidgets;
+
+static int64_t AlignToPatternQuantum(int64_t timeMS)
+{
+	return ((timeMS + kPatternQuantumMS - 1) / kPatternQuantumMS) * kPatternQuantumMS;
+}
+#endif
+
 void LEDWidget::InitGpio()
 {
 #ifdef CONFIG_DK_LIBRARY
 	dk_leds_init();
 #endif
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	static bool sPatternTimerInitialized;
+
+	if (!sPatternTimerInitialized) {
+		k_timer_init(&sPatternTimer, &LEDWidget::PatternTimerHandler, nullptr);
+		sPatternTimerInitialized = true;
+	}
+#endif
 }
 
 void LEDWidget::SetStateUpdateCallback(LEDWidgetStateUpdateHandler stateUpdateCb)
@@ -36,8 +62,25 @@ void LEDWidget::Init(uint32_t gpioNum)
 	mGPIONum = gpioNum;
 	mState = false;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	k_spinlock_key_t key = k_spin_lock(&sPatternLock);
+	LEDWidget *widget = sPatternWidgets;
+
+	while (widget != nullptr && widget != this) {
+		widget = widget->mNext;
+	}
+
+	/* Register the LED in the pattern engine unless it has already been initialized */
+	if (widget == nullptr) {
+		mNext = sPatternWidgets;
+		sPatternWidgets = this;
+	}
+
+	k_spin_unlock(&sPatternLock, key);
+#else
 	k_timer_init(&mLedTimer, &LEDWidget::LedStateTimerHandler, nullptr);
 	k_timer_user_data_set(&mLedTimer, this);
+#endif
 
 	Set(false);
 #endif
@@ -51,10 +94,20 @@ void LEDWidget::Invert()
 void LEDWidget::Set(bool state)
 {
 #ifdef CONFIG_DK_LIBRARY
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	k_spinlock_key_t key = k_spin_lock(&sPatternLock);
+
+	mBlinkOnTimeMS = mBlinkOffTimeMS = 0;
+	DoSet(state);
+	ReschedulePatternTimer();
+
+	k_spin_unlock(&sPatternLock, key);
+#else
 	k_timer_stop(&mLedTimer);
 	mBlinkOnTimeMS = mBlinkOffTimeMS = 0;
 	DoSet(state);
 #endif
+#endif
 }
 
 void LEDWidget::Blink(uint32_t changeRateMS)
@@ -65,6 +118,21 @@ void LEDWidget::Blink(uint32_t changeRateMS)
 void LEDWidget::Blink(uint32_t onTimeMS, uint32_t offTimeMS)
 {
 #ifdef CONFIG_DK_LIBRARY
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	k_spinlock_key_t key = k_spin_lock(&sPatternLock);
+
+	mBlinkOnTimeMS = onTimeMS;
+	mBlinkOffTimeMS = offTimeMS;
+
+	if (IsBlinking()) {
+		DoSet(!mState);
+		ScheduleStateChange();
+	}
+
+	ReschedulePatternTimer();
+
+	k_spin_unlock(&sPatternLock, key);
+#else
 	k_timer_stop(&mLedTimer);
 
 	mBlinkOnTimeMS = onTimeMS;
@@ -75,13 +143,18 @@ void LEDWidget::Blink(uint32_t onTimeMS, uint32_t offTimeMS)
 		ScheduleStateChange();
 	}
 #endif
+#endif
 }
 
 void LEDWidget::ScheduleStateChange()
 {
 #ifdef CONFIG_DK_LIBRARY
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	mNextStateChangeMS = AlignToPatternQuantum(k_uptime_get() + (mState ? mBlinkOnTimeMS : mBlinkOffTimeMS));
+#else
 	k_timer_start(&mLedTimer, K_MSEC(mState ? mBlinkOnTimeMS : mBlinkOffTimeMS), K_NO_WAIT);
 #endif
+#endif
 }
 
 void LEDWidget::DoSet(bool state)
@@ -94,17 +167,67 @@ void LEDWidget::DoSet(bool state)
 
 void LEDWidget::UpdateState()
 {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	k_spinlock_key_t key = k_spin_lock(&sPatternLock);
+
+	if (IsBlinking()) {
+		DoSet(!mState);
+		ScheduleStateChange();
+		ReschedulePatternTimer();
+	}
+
+	k_spin_unlock(&sPatternLock, key);
+#else
 	/* Prevent from keep updating the state if LED was set to solid On/Off value */
 	if (mBlinkOnTimeMS != 0 && mBlinkOffTimeMS != 0) {
 		DoSet(!mState);
 		ScheduleStateChange();
 	}
+#endif
+}
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+void LEDWidget::PatternTimerHandler(k_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&sPatternLock);
+	const int64_t now = k_uptime_get();
+
+	for (LEDWidget *widget = sPatternWidgets; widget != nullptr; widget = widget->mNext) {
+		if (widget->IsBlinking() && widget->mNextStateChangeMS <= now) {
+			widget->DoSet(!widget->mState);
+			widget->ScheduleStateChange();
+		}
+	}
+
+	ReschedulePatternTimer();
+
+	k_spin_unlock(&sPatternLock, key);
 }
 
+void LEDWidget::ReschedulePatternTimer()
+{
+	/* Must be called with the pattern lock held */
+	int64_t nextStateChangeMS = INT64_MAX;
+
+	for (LEDWidget *widget = sPatternWidgets; widget != nullptr; widget = widget->mNext) {
+		if (widget->IsBlinking()) {
+			nextStateChangeMS = MIN(nextStateChangeMS, widget->mNextStateChangeMS);
+		}
+	}
+
+	if (nextStateChangeMS == INT64_MAX) {
+		k_timer_stop(&sPatternTimer);
+		return;
+	}
+
+	k_timer_start(&sPatternTimer, K_MSEC(MAX(nextStateChangeMS - k_uptime_get(), 0)), K_NO_WAIT);
+}
+#else
 void LEDWidget::LedStateTimerHandler(k_timer *timer)
 {
 	if (sStateUpdateCallback)
 		sStateUpdateCallback(*reinterpret_cast<LEDWidget *>(timer->user_data));
 }
+#endif
 
 } /* namespace Nrf */
@@ -31,9 +31,20 @@ private:
 	uint32_t mBlinkOffTimeMS;
 	uint32_t mGPIONum;
 	bool mState;
+#ifdef CONFIG_NCS_SAMPLE_MATTER_LED_PATTERN_ENGINE
+	/* Uptime at which the LED state is changed next, valid only while the LED is blinking. */
+	int64_t mNextStateChangeMS;
+	LEDWidget *mNext;
+
+	static void PatternTimerHandler(k_timer *timer);
+	static void ReschedulePatternTimer();
+
+	bool IsBlinking() const { return mBlinkOnTimeMS != 0 && mBlinkOffTimeMS != 0; }
+#else
 	k_timer mLedTimer;
 
 	static void LedStateTimerHandler(k_timer *timer);
+#endif
 
 	void DoSet(bool state);
 	void ScheduleStateChange();
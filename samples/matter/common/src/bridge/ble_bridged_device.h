@@ -40,6 +40,28 @@ public:
 	virtual bt_uuid *GetServiceUuid() = 0;
 	virtual int ParseDiscoveredData(bt_gatt_dm *discoveredData) = 0;
 
+	/**
+	 * @brief Get the attribute handles obtained by @ref ParseDiscoveredData, so they can be cached.
+	 *
+	 * The default implementation does not support caching, so the GATT discovery is always performed.
+	 *
+	 * @param handles array to be filled with the attribute handles
+	 * @param maxCount maximum number of handles that fit in the array
+	 * @return number of handles written to the array, 0 if caching is not supported
+	 */
+	virtual uint8_t GetGattHandles(uint16_t *handles, uint8_t maxCount) { return 0; }
+
+	/**
+	 * @brief Restore the attribute handles returned earlier by @ref GetGattHandles and finish the connection setup
+	 * the same way as @ref ParseDiscoveredData does, but without the GATT discovery.
+	 *
+	 * @param handles array containing the cached attribute handles
+	 * @param count number of handles in the array
+	 * @return 0 on success
+	 * @return negative error code on failure, in which case the GATT discovery is performed
+	 */
+	virtual int RestoreGattHandles(const uint16_t *handles, uint8_t count) { return -ENOTSUP; }
+
 	BLEBridgedDevice &GetBLEBridgedDevice() { return mDevice; }
 	void SetConnectionObject(bt_conn *conn) { mDevice.mConn = conn; }
 	bt_conn *GetConnectionObject() { return mDevice.mConn; }
@@ -45,6 +45,10 @@ static const struct bt_gatt_dm_cb discovery_cb = { .completed = Nrf::BLEConnecti
 
 static struct bt_conn_le_create_param *create_param = BT_CONN_LE_CREATE_CONN;
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+static bt_uuid *sUuidDbHash = BT_UUID_GATT_DB_HASH;
+#endif
+
 namespace Nrf
 {
 
@@ -74,6 +78,7 @@ void BLEConnectivityManager::FilterMatch(bt_scan_device_info *device_info, bt_sc
 
 	scannedDevices[scannedDevicesCounter].mAddr = *device_info->recv_info->addr;
 	scannedDevices[scannedDevicesCounter].mConnParam = *device_info->conn_param;
+	scannedDevices[scannedDevicesCounter].mRssi = device_info->recv_info->rssi;
 
 	if (!filter_match->uuid.match) {
 		return;
@@ -87,6 +92,18 @@ int BLEConnectivityManager::StartGattDiscovery(bt_conn *conn, BLEBridgedDevicePr
 {
 	/* Start GATT discovery for the device's service UUID. */
 	int err = bt_gatt_dm_start(conn, provider->GetServiceUuid(), &discovery_cb, provider);
+	if (err == -EALREADY) {
+		/* Another discovery is in progress, defer this one until the GATT Discovery Manager is released. */
+		CHIP_ERROR ret = DeviceLayer::PlatformMgr().ScheduleWork(
+			[](intptr_t context) {
+				if (Instance().QueueGattDiscovery(reinterpret_cast<BLEBridgedDeviceProvider *>(context))) {
+					Instance().StartQueuedGattDiscovery();
+				}
+			},
+			reinterpret_cast<intptr_t>(provider));
+		err = (ret == CHIP_NO_ERROR) ? 0 : -ENOMEM;
+	}
+
 	if (err) {
 		LOG_ERR("Could not start the discovery procedure, error "
 			"code: %d",
@@ -95,28 +112,239 @@ int BLEConnectivityManager::StartGattDiscovery(bt_conn *conn, BLEBridgedDevicePr
 	return err;
 }
 
+int BLEConnectivityManager::StartCachedGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider)
+{
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* The cache can be used only for devices that were already discovered. */
+	VerifyOrReturnValue(provider->IsInitiallyConnected(), StartGattDiscovery(conn, provider));
+
+	Platform::UniquePtr<GattCacheCtx> ctx(Platform::New<GattCacheCtx>());
+	VerifyOrReturnValue(ctx, StartGattDiscovery(conn, provider));
+
+	ctx->mProvider = provider;
+	ctx->mValidate = true;
+
+	if (!BridgeStorageManager::Instance().LoadBtGattCache(ctx->mCache, provider->GetBtAddress())) {
+		return StartGattDiscovery(conn, provider);
+	}
+
+	/* Verify whether the cached handles are still valid by comparing the peer's GATT database hash. */
+	if (ReadGattDbHash(conn, ctx.get()) != 0) {
+		return StartGattDiscovery(conn, provider);
+	}
+
+	ctx.release();
+	return 0;
+#else
+	return StartGattDiscovery(conn, provider);
+#endif
+}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+int BLEConnectivityManager::ReadGattDbHash(bt_conn *conn, GattCacheCtx *ctx)
+{
+	ctx->mReadParams.func = GattDbHashReadCallback;
+	ctx->mReadParams.handle_count = 0;
+	ctx->mReadParams.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	ctx->mReadParams.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	ctx->mReadParams.by_uuid.uuid = sUuidDbHash;
+
+	int err = bt_gatt_read(conn, &ctx->mReadParams);
+	if (err) {
+		LOG_ERR("Cannot read the GATT database hash (err %d)", err);
+	}
+
+	return err;
+}
+
+uint8_t BLEConnectivityManager::GattDbHashReadCallback(bt_conn *conn, uint8_t att_err, bt_gatt_read_params *params,
+							const void *data, uint16_t length)
+{
+	Platform::UniquePtr<GattCacheCtx> ctx(CONTAINER_OF(params, GattCacheCtx, mReadParams));
+	bool hashRead = !att_err && data && length == BridgeStorageManager::kGattDbHashSize;
+
+	if (ctx->mValidate) {
+		if (hashRead && memcmp(ctx->mCache.mDbHash, data, length) == 0) {
+			if (CHIP_NO_ERROR == DeviceLayer::PlatformMgr().ScheduleWork(
+						     RestoreGattCache, reinterpret_cast<intptr_t>(ctx.get()))) {
+				ctx.release();
+				return BT_GATT_ITER_STOP;
+			}
+		} else {
+			LOG_INF("The GATT cache is outdated or cannot be validated, starting the discovery");
+		}
+
+		StartGattDiscovery(conn, ctx->mProvider);
+		return BT_GATT_ITER_STOP;
+	}
+
+	/* Devices not exposing the database hash cannot be cached, as there is no way to validate the handles. */
+	VerifyOrReturnValue(hashRead, BT_GATT_ITER_STOP, LOG_INF("The GATT database hash is not available"));
+
+	memcpy(ctx->mCache.mDbHash, data, length);
+
+	CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t context) {
+			Platform::UniquePtr<GattCacheCtx> cacheCtx(reinterpret_cast<GattCacheCtx *>(context));
+			if (!BridgeStorageManager::Instance().StoreBtGattCache(cacheCtx->mCache,
+									       cacheCtx->mProvider->GetBtAddress())) {
+				LOG_ERR("Cannot store the GATT cache");
+			}
+		},
+		reinterpret_cast<intptr_t>(ctx.get()));
+
+	if (CHIP_NO_ERROR == err) {
+		ctx.release();
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+void BLEConnectivityManager::RestoreGattCache(intptr_t context)
+{
+	Platform::UniquePtr<GattCacheCtx> ctx(reinterpret_cast<GattCacheCtx *>(context));
+	BLEBridgedDeviceProvider *provider = ctx->mProvider;
+
+	/* The connection could have been lost meanwhile. */
+	VerifyOrReturn(provider->GetConnectionObject());
+
+	if (CHIP_NO_ERROR != provider->NotifyReachableStatusChange(true)) {
+		LOG_WRN("The device has not been notified about the status change.");
+	}
+
+	if (0 != provider->RestoreGattHandles(ctx->mCache.mHandles, ctx->mCache.mHandlesCount)) {
+		LOG_ERR("Cannot restore the cached GATT handles, starting the discovery");
+		StartGattDiscovery(provider->GetConnectionObject(), provider);
+		return;
+	}
+
+	LOG_INF("The GATT discovery skipped, cached handles restored");
+
+	/* The device was successfully recovered. */
+	Instance().mRecovery.RemoveRecovered(provider);
+	provider->NotifySuccessfulRecovery();
+	Instance().UpdateRecovery();
+}
+
+void BLEConnectivityManager::StoreGattCache(BLEBridgedDeviceProvider *provider)
+{
+	Platform::UniquePtr<GattCacheCtx> ctx(Platform::New<GattCacheCtx>());
+	VerifyOrReturn(ctx && provider->GetConnectionObject());
+
+	ctx->mProvider = provider;
+	ctx->mValidate = false;
+	ctx->mCache.mVersion = BridgeStorageManager::kGattCacheVersion;
+	ctx->mCache.mHandlesCount =
+		provider->GetGattHandles(ctx->mCache.mHandles, BridgeStorageManager::kGattCacheMaxHandles);
+
+	/* The provider does not support caching. */
+	VerifyOrReturn(ctx->mCache.mHandlesCount > 0);
+
+	if (ReadGattDbHash(provider->GetConnectionObject(), ctx.get()) == 0) {
+		ctx.release();
+	}
+}
+#endif
+
+bool BLEConnectivityManager::QueueGattDiscovery(BLEBridgedDeviceProvider *provider)
+{
+	for (uint8_t i = 0; i < mDiscoveryQueueCount; i++) {
+		if (mDiscoveryQueue[i] == provider) {
+			return true;
+		}
+	}
+
+	if (mDiscoveryQueueCount >= kMaxConnectedDevices) {
+		LOG_ERR("Cannot queue the discovery procedure");
+		return false;
+	}
+
+	mDiscoveryQueue[mDiscoveryQueueCount++] = provider;
+	return true;
+}
+
+void BLEConnectivityManager::RemoveQueuedGattDiscovery(BLEBridgedDeviceProvider *provider)
+{
+	uint8_t count = 0;
+
+	for (uint8_t i = 0; i < mDiscoveryQueueCount; i++) {
+		if (mDiscoveryQueue[i] != provider) {
+			mDiscoveryQueue[count++] = mDiscoveryQueue[i];
+		}
+	}
+
+	mDiscoveryQueueCount = count;
+}
+
+void BLEConnectivityManager::StartQueuedGattDiscovery()
+{
+	while (mDiscoveryQueueCount > 0) {
+		BLEBridgedDeviceProvider *provider = mDiscoveryQueue[0];
+
+		/* The connection could have been lost meanwhile, so skip such providers. */
+		if (!provider->GetConnectionObject()) {
+			RemoveQueuedGattDiscovery(provider);
+			continue;
+		}
+
+		int err = bt_gatt_dm_start(provider->GetConnectionObject(), provider->GetServiceUuid(), &discovery_cb,
+					   provider);
+		if (err == -EALREADY) {
+			/* Still busy, the next release of the GATT Discovery Manager will resume the queue. */
+			return;
+		}
+
+		RemoveQueuedGattDiscovery(provider);
+
+		if (!err) {
+			return;
+		}
+
+		LOG_ERR("Could not start the queued discovery procedure, error code: %d", err);
+	}
+}
+
+void BLEConnectivityManager::ScheduleQueuedGattDiscovery()
+{
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { Instance().StartQueuedGattDiscovery(); }, 0);
+}
+
 void BLEConnectivityManager::UpdateRecovery()
 {
 	if (!sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
-		/* There is another provider to re-connect, schedule this operation. */
-		BLEBridgedDeviceProvider *providerToRecover =
-			Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-		DeviceLayer::PlatformMgr().ScheduleWork(
-			[](intptr_t context) {
-				Instance().Reconnect(reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-			},
-			reinterpret_cast<intptr_t>(providerToRecover));
+		/* There is another provider to re-connect, schedule this operation. It can be done as soon as the
+		 * previous connection is created, without waiting for its GATT discovery. */
+		DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { Instance().ConnectNextProvider(); }, 0);
 		/* We have still a device to recover, keep the LostDevice state active */
 		Instance().UpdateStateFlag(State::LostDevice, true);
 	} else if (!sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
 		/* There are pending providers to recover and no more scanned ones, schedule next scan operation. */
-		Instance().mRecovery.StartTimer();
+		if (!Instance().mRecovery.mConnectingProvider) {
+			Instance().mRecovery.StartTimer();
+		}
 	} else {
 		/* All devices have been recovered, disable LostDevice state */
 		Instance().UpdateStateFlag(State::LostDevice, false);
 	}
 }
 
+void BLEConnectivityManager::ConnectNextProvider()
+{
+	/* Only one connection can be created at a time, the next one is started from the connection callback. */
+	VerifyOrReturn(!mRecovery.mConnectingProvider);
+
+	while (BLEBridgedDeviceProvider *provider = mRecovery.GetProvider(&mRecovery.mListToReconnect)) {
+		if (CHIP_NO_ERROR == Reconnect(provider)) {
+			return;
+		}
+		provider->NotifyFailedRecovery();
+	}
+
+	if (mRecovery.IsNeeded()) {
+		mRecovery.StartTimer();
+	}
+}
+
 void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 {
 	const bt_addr_le_t *dstAddr = bt_conn_get_dst(conn);
@@ -142,6 +370,11 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 		return;
 	}
 
+	/* The connection creation is finished, so the next provider to recover can be connected. */
+	if (Instance().mRecovery.mConnectingProvider == provider) {
+		Instance().mRecovery.mConnectingProvider = nullptr;
+	}
+
 	/* If there was an error during the initial connection, we should notify the application */
 	bool firstConnFailed = (conn_err && !provider->IsInitiallyConnected());
 	VerifyOrExit(!firstConnFailed, err = conn_err);
@@ -159,14 +392,16 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 	/* Start GATT discovery only if this specific device was successfully connected before. Otherwise, it will be
 	 * called after a successful pairing. */
 	if (provider->IsInitiallyConnected()) {
-		err = StartGattDiscovery(conn, provider);
+		err = StartCachedGattDiscovery(conn, provider);
 		VerifyOrExit(err == 0, );
 	}
 #else
-	err = StartGattDiscovery(conn, provider);
+	err = StartCachedGattDiscovery(conn, provider);
 	VerifyOrExit(err == 0, );
 #endif
 
+	Instance().UpdateRecovery();
+
 	return;
 
 exit:
@@ -350,7 +585,8 @@ exit:
 					ctx->mProvider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 				ctx->mProvider->ConfirmInitialConnection();
 				VerifyOrReturn(CHIP_NO_ERROR == err, bt_gatt_dm_data_release(ctx->mDiscoveryData);
-					       Instance().RemoveBLEProvider(ctx->mProvider->GetBtAddress()););
+					       Instance().RemoveBLEProvider(ctx->mProvider->GetBtAddress());
+					       Instance().StartQueuedGattDiscovery(););
 			}
 
 			if (CHIP_NO_ERROR != ctx->mProvider->NotifyReachableStatusChange(true)) {
@@ -359,8 +595,14 @@ exit:
 
 			if (0 != ctx->mProvider->ParseDiscoveredData(ctx->mDiscoveryData)) {
 				LOG_ERR("Cannot parse the GATT discovered data.");
+			} else {
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+				/* Cache the discovered handles to skip the discovery on the next reconnection. */
+				StoreGattCache(ctx->mProvider);
+#endif
 			}
 			bt_gatt_dm_data_release(ctx->mDiscoveryData);
+			Instance().StartQueuedGattDiscovery();
 		},
 		reinterpret_cast<intptr_t>(discoveryCtx.get()));
 
@@ -368,6 +610,7 @@ exit:
 		discoveryCtx.release();
 	} else {
 		bt_gatt_dm_data_release(dm);
+		ScheduleQueuedGattDiscovery();
 	}
 
 	Instance().UpdateRecovery();
@@ -387,6 +630,7 @@ void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
 		}
 	}
 
+	ScheduleQueuedGattDiscovery();
 	Instance().UpdateRecovery();
 }
 
@@ -401,6 +645,7 @@ void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *contex
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 	}
 
+	ScheduleQueuedGattDiscovery();
 	Instance().UpdateRecovery();
 }
 
@@ -557,7 +802,6 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 {
 	DeviceLayer::PlatformMgr().ScheduleWork(
 		[](intptr_t context) {
-			BLEBridgedDeviceProvider *provider;
 			ScanResult result = *reinterpret_cast<ScanResult *>(context);
 			sys_snode_t *node;
 			sys_snode_t *tmpNodeSafe;
@@ -573,6 +817,11 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 					return;
 				}
 
+				/* The provider is already connected and waits for the GATT discovery. */
+				if (item->mProvider->GetConnectionObject()) {
+					continue;
+				}
+
 				providerFound = false;
 
 				for (uint8_t i = 0; i < result.mCount && !providerFound; i++) {
@@ -580,27 +829,22 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 					if (memcmp(&providerAddress, &result.mDevices[i].mAddr,
 						   sizeof(result.mDevices[i].mAddr)) == 0) {
 						providerFound = true;
-						Instance().mRecovery.PutProvider(
-							item->mProvider, &Instance().mRecovery.mListToReconnect);
+						Instance().mRecovery.PutProvider(item->mProvider,
+										 &Instance().mRecovery.mListToReconnect,
+										 result.mDevices[i].mRssi);
 					}
 				}
 
-				/* Increase failed attempts counter of all devices to recover that were not detected. */
+				/* Postpone the next attempt of all devices to recover that were not detected. */
 				if (!providerFound) {
-					item->mProvider->NotifyFailedRecovery();
+					Instance().mRecovery.NotifyFailedRecovery(item);
 				}
 			}
 
 			if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
 				Instance().mRecovery.StartTimer();
 			} else {
-				provider = Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-				DeviceLayer::PlatformMgr().ScheduleWork(
-					[](intptr_t context) {
-						Instance().Reconnect(
-							reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-					},
-					reinterpret_cast<intptr_t>(provider));
+				Instance().ConnectNextProvider();
 			}
 		},
 		reinterpret_cast<intptr_t>(&result));
@@ -668,10 +912,14 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 	char addrStr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_to_str(&provider->GetBLEBridgedDevice().mAddr, addrStr, sizeof(addrStr));
 
+	/* Mark the provider before creating the connection, as the connection callback may be called right away. */
+	mRecovery.mConnectingProvider = provider;
+
 	int err = bt_conn_le_create(&provider->GetBLEBridgedDevice().mAddr, create_param, connParams, &conn);
 
 	if (err) {
 		LOG_ERR("Creating reconnection failed (err %d)", err);
+		mRecovery.mConnectingProvider = nullptr;
 		return System::MapErrorZephyr(err);
 	} else {
 		provider->SetConnectionObject(conn);
@@ -769,6 +1017,16 @@ CHIP_ERROR BLEConnectivityManager::RemoveBLEProvider(bt_addr_le_t address)
 		return CHIP_ERROR_NOT_FOUND;
 	}
 
+	RemoveQueuedGattDiscovery(provider);
+	if (mRecovery.mConnectingProvider == provider) {
+		mRecovery.mConnectingProvider = nullptr;
+	}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* Ignore error, as the cache may not be present in the storage. */
+	BridgeStorageManager::Instance().RemoveBtGattCache(address);
+#endif
+
 	if (!provider->GetBLEBridgedDevice().mConn) {
 		return CHIP_ERROR_INTERNAL;
 	}
@@ -860,6 +1118,7 @@ void BLEConnectivityManager::Recovery::TimerTimeoutCallback(k_timer *timer)
 		/* Schedule scan only if there is any device to be recovered and there is no device to be
 		 * re-connected.*/
 		if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect) &&
+		    !Instance().mRecovery.mConnectingProvider &&
 		    !sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
 			DeviceLayer::PlatformMgr().ScheduleWork(
 				[](intptr_t context) {
@@ -883,7 +1142,7 @@ BLEBridgedDeviceProvider *BLEConnectivityManager::Recovery::GetProvider(sys_slis
 	return provider;
 }
 
-bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list)
+bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list, int8_t rssi)
 {
 	if (sys_slist_len(list) >= kMaxConnectedDevices) {
 		return false;
@@ -896,45 +1155,72 @@ bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *pro
 	}
 
 	item->mProvider = provider;
-	sys_slist_append(list, item);
+	item->mRssi = rssi;
+	item->mDeadline = CalculateDeadline(provider);
+
+	/* Keep the list sorted by RSSI, so the devices with the best link quality are connected first. */
+	sys_snode_t *prev = nullptr;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE (list, node) {
+		if (reinterpret_cast<ListItem *>(node)->mRssi < rssi) {
+			break;
+		}
+		prev = node;
+	}
+
+	sys_slist_insert(list, prev, item);
 
 	return true;
 }
 
-uint16_t BLEConnectivityManager::Recovery::GetFailedRecoveryAttempts()
+int64_t BLEConnectivityManager::Recovery::CalculateDeadline(BLEBridgedDeviceProvider *provider)
 {
-	sys_snode_t *node;
-	sys_snode_t *tmpNodeSafe;
-	ListItem *item;
-	uint16_t attempts = UINT16_MAX;
+	uint16_t attempts = provider->GetFailedRecoveryAttempts();
+	/* Calculate next recovery time as an exponential function of failed attempts number of the provider.
+	 * This allows to scan the less frequently, the longer the device is not detected, without delaying the
+	 * recovery of other devices.
+	 */
+	uint32_t exponent = attempts < kRecoveryMaxBackoffExponent ? attempts : kRecoveryMaxBackoffExponent;
+	uint32_t time = kRecoveryIntervalSec << exponent;
 
-	/* Find the smallest number or failed recovery attempts from all providers. */
-	SYS_SLIST_FOR_EACH_NODE_SAFE (&Instance().mRecovery.mListToRecover, node, tmpNodeSafe) {
-		item = reinterpret_cast<ListItem *>(node);
+	time = time < kRecoveryMaxIntervalSec ? time : kRecoveryMaxIntervalSec;
 
-		if (!item) {
-			return 0;
-		}
+	return k_uptime_get() + static_cast<int64_t>(time) * MSEC_PER_SEC;
+}
 
-		uint16_t newAttempts = item->mProvider->GetFailedRecoveryAttempts();
+void BLEConnectivityManager::Recovery::NotifyFailedRecovery(ListItem *item)
+{
+	item->mProvider->NotifyFailedRecovery();
+	item->mDeadline = CalculateDeadline(item->mProvider);
+}
 
-		attempts = newAttempts < attempts ? newAttempts : attempts;
+int64_t BLEConnectivityManager::Recovery::GetNearestDeadline()
+{
+	sys_snode_t *node;
+	int64_t deadline = INT64_MAX;
+
+	/* Find the nearest recovery attempt from all providers. */
+	SYS_SLIST_FOR_EACH_NODE (&mListToRecover, node) {
+		int64_t itemDeadline = reinterpret_cast<ListItem *>(node)->mDeadline;
+
+		deadline = itemDeadline < deadline ? itemDeadline : deadline;
 	}
 
-	return attempts;
+	return deadline;
 }
 
 void BLEConnectivityManager::Recovery::StartTimer()
 {
-	uint16_t attempts = GetFailedRecoveryAttempts();
-	/* Calculate next recovery time as a quadratic function of failed attempts number.
-	 * This allows to scan the less frequently, the longer no devices are detected.
-	 */
-	uint32_t time = ((attempts * attempts) + 1) * kRecoveryIntervalSec;
+	int64_t deadline = GetNearestDeadline();
 
-	time = time < kRecoveryMaxIntervalSec ? time : kRecoveryMaxIntervalSec;
+	if (deadline == INT64_MAX) {
+		return;
+	}
+
+	int64_t time = deadline - k_uptime_get();
 
-	k_timer_start(&mRecoveryTimer, K_SECONDS(time), K_NO_WAIT);
+	k_timer_start(&mRecoveryTimer, K_MSEC(time > 0 ? time : 0), K_NO_WAIT);
 }
 
 BLEConnectivityManager::State BLEConnectivityManager::GetCurrentState()
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "bridge_storage_manager.h"
 #include "bridged_device_data_provider.h"
 
 #include <bluetooth/gatt_dm.h>
@@ -59,6 +60,7 @@ public:
 		bt_addr_le_t mAddr;
 		bt_le_conn_param mConnParam;
 		uint16_t mUuid;
+		int8_t mRssi;
 	};
 
 	struct ScanResult {
@@ -73,11 +75,17 @@ private:
 		/* Recovery intervals in seconds. */
 		constexpr static auto kRecoveryIntervalSec = 1;
 		constexpr static auto kRecoveryMaxIntervalSec = CONFIG_BRIDGE_BT_RECOVERY_MAX_INTERVAL;
+		/* Limit of the backoff exponent to avoid the interval overflow, the interval is capped anyway. */
+		constexpr static auto kRecoveryMaxBackoffExponent = 16;
 
 		constexpr static auto kRecoveryScanTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_SCAN_TIMEOUT_MS;
 
 		struct ListItem : public sys_snode_t {
 			BLEBridgedDeviceProvider *mProvider = nullptr;
+			/* The last known RSSI of the device, used to prioritize the reconnection. */
+			int8_t mRssi = INT8_MIN;
+			/* Uptime (in ms) of the next scheduled recovery attempt for the provider. */
+			int64_t mDeadline = 0;
 		};
 
 	public:
@@ -87,17 +95,22 @@ private:
 
 	private:
 		BLEBridgedDeviceProvider *GetProvider(sys_slist_t *list);
-		bool PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
+		bool PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list, int8_t rssi = INT8_MIN);
 		bool IsNeeded() { return !sys_slist_is_empty(&mListToRecover); }
 		void StartTimer();
 		void CancelTimer() { k_timer_stop(&mRecoveryTimer); }
 		void RemoveRecovered(BLEBridgedDeviceProvider *provider);
-		uint16_t GetFailedRecoveryAttempts();
+		void NotifyFailedRecovery(ListItem *item);
+		int64_t GetNearestDeadline();
 
+		static int64_t CalculateDeadline(BLEBridgedDeviceProvider *provider);
 		static void TimerTimeoutCallback(k_timer *timer);
 
 		sys_slist_t mListToRecover;
+		/* Providers detected during the recovery scan, sorted by RSSI in descending order. */
 		sys_slist_t mListToReconnect;
+		/* The provider waiting for the connection creation, the Bluetooth host allows only one at a time. */
+		BLEBridgedDeviceProvider *mConnectingProvider = nullptr;
 		k_timer mRecoveryTimer;
 	};
 
@@ -106,6 +119,16 @@ private:
 		bt_gatt_dm *mDiscoveryData;
 	};
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	struct GattCacheCtx {
+		BLEBridgedDeviceProvider *mProvider;
+		bt_gatt_read_params mReadParams;
+		BridgeStorageManager::BtGattCache mCache;
+		/* Indicates whether the loaded cache is validated on reconnection or a new one is being created. */
+		bool mValidate;
+	};
+#endif
+
 public:
 	using DeviceConnectedCallback = CHIP_ERROR (*)(bool success, void *context);
 	using ScanDoneCallback = void (*)(ScanResult &result, void *context);
@@ -244,6 +267,7 @@ public:
 	static void DiscoveryNotFound(bt_conn *conn, void *context);
 	static void DiscoveryError(bt_conn *conn, int err, void *context);
 	static int StartGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider);
+	static int StartCachedGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider);
 
 #ifdef CONFIG_BT_SMP
 	static void SecurityChangedHandler(struct bt_conn *conn, bt_security_t level, enum bt_security_err err);
@@ -273,6 +297,18 @@ private:
 	State GetCurrentState();
 	void UpdateStateFlag(State state, bool enabled);
 	void UpdateRecovery();
+	void ConnectNextProvider();
+	void StartQueuedGattDiscovery();
+	bool QueueGattDiscovery(BLEBridgedDeviceProvider *provider);
+	void RemoveQueuedGattDiscovery(BLEBridgedDeviceProvider *provider);
+	static void ScheduleQueuedGattDiscovery();
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	static void StoreGattCache(BLEBridgedDeviceProvider *provider);
+	static int ReadGattDbHash(bt_conn *conn, GattCacheCtx *ctx);
+	static uint8_t GattDbHashReadCallback(bt_conn *conn, uint8_t att_err, bt_gatt_read_params *params,
+					      const void *data, uint16_t length);
+	static void RestoreGattCache(intptr_t context);
+#endif
 
 	StateChangedCallback mStateChangedCb = nullptr;
 	uint8_t mStateBitmask = 0;
@@ -283,6 +319,10 @@ private:
 	ScannedDevice mScannedDevices[kMaxScannedDevices];
 	ScanResult mScanResult;
 	BLEBridgedDeviceProvider *mConnectedProviders[kMaxConnectedDevices];
+	/* Providers connected while the GATT discovery of another one was in progress, the GATT Discovery Manager
+	 * handles only one discovery at a time. */
+	BLEBridgedDeviceProvider *mDiscoveryQueue[kMaxConnectedDevices];
+	uint8_t mDiscoveryQueueCount = 0;
 	bt_uuid *mServicesUuid[kMaxServiceUuids];
 	uint8_t mServicesUuidCount;
 	ScanDoneCallback mScanDoneCallback;
@@ -12,6 +12,7 @@
 #include <app/reporting/reporting.h>
 #include <app/util/generic-callbacks.h>
 #include <lib/support/Span.h>
+#include <platform/CHIPDeviceLayer.h>
 
 #include <zephyr/logging/log.h>
 
@@ -61,7 +62,7 @@ CHIP_ERROR BridgeManager::AddBridgedDevices(MatterBridgedDevice *devices[], Brid
 {
 	chip::Optional<uint8_t> indexes[deviceListSize];
 	uint16_t endpoints[deviceListSize];
-	Platform::UniquePtr<BridgedDeviceDataProvider> providerPtr(dataProvider);
+	DataProviderPool::UniquePtr providerPtr = mDataProviderPool.MakeUnique(dataProvider);
 
 	VerifyOrReturnError(devicesPairIndexes, CHIP_ERROR_INTERNAL);
 	CHIP_ERROR err =
@@ -75,7 +76,7 @@ CHIP_ERROR BridgeManager::AddBridgedDevices(MatterBridgedDevice *devices[], Brid
 					    uint8_t deviceListSize, uint8_t devicesPairIndexes[],
 					    uint16_t endpointIds[])
 {
-	Platform::UniquePtr<BridgedDeviceDataProvider> providerPtr(dataProvider);
+	DataProviderPool::UniquePtr providerPtr = mDataProviderPool.MakeUnique(dataProvider);
 	chip::Optional<uint8_t> indexes[deviceListSize];
 
 	VerifyOrReturnError(devicesPairIndexes, CHIP_ERROR_INTERNAL);
@@ -119,6 +120,9 @@ CHIP_ERROR BridgeManager::RemoveBridgedDevice(uint16_t endpoint, uint8_t &device
 			auto &devicePair = mDevicesMap[index];
 			if (devicePair.mDevice->GetEndpointId() == endpoint) {
 				LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
+#ifdef CONFIG_BRIDGE_REPORTING_COALESCING
+			DropReports(endpoint);
+#endif
 				/* Free dynamically allocated memory */
 				emberAfClearDynamicEndpoint(index);
 				devicesPairIndex = index;
@@ -135,6 +139,7 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	bool removeProvider = true;
 	auto &devicePair = mDevicesMap[index];
+	BridgedDeviceDataProvider *provider = devicePair.mProvider;
 
 	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
 	/* There must be at least 2 duplicates in the map to determine the real duplicate,
@@ -159,7 +164,7 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 			}
 		}
 	}
-	if (mDevicesMap.Erase(index)) {
+	if (ErasePair(index, provider)) {
 		if (removeProvider) {
 			mNumberOfProviders--;
 		}
@@ -195,11 +200,10 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 {
 	uint8_t index{ 0 };
 	CHIP_ERROR err;
-	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	BridgedDevicePair pair(device, dataProvider);
 
-	/* Check if the current provider is already contained in the map - if so, there is at least one duplicate */
-	bool isNewProvider = (Instance().mDevicesMap.GetDuplicatesCount(pair, duplicatedItemKeys) == 0);
+	/* Check if the current provider is already bridged with any device - if so, there is at least one duplicate */
+	bool isNewProvider = !mProviderIndexes.Contains(dataProvider);
 
 	if (isNewProvider) {
 		VerifyOrReturnError(mNumberOfProviders + 1 <= kMaxDataProviders, CHIP_ERROR_NO_MEMORY,
@@ -220,7 +224,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			return CHIP_ERROR_INTERNAL;
 		}
 
-		if (!mDevicesMap.Insert(index, std::move(pair))) {
+		if (!InsertPair(index, std::move(pair))) {
 			return CHIP_ERROR_INTERNAL;
 		}
 
@@ -237,7 +241,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 				mCurrentDynamicEndpointId > endpointId ? mCurrentDynamicEndpointId : endpointId + 1;
 		} else {
 			/* The pair was added to a map, so we have to take care about removing it in case of failure. */
-			mDevicesMap.Erase(index);
+			ErasePair(index, dataProvider);
 		}
 
 		return err;
@@ -245,7 +249,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 		while (index < kMaxBridgedDevices) {
 			/* Find the first empty index in the bridged devices list */
 			if (!mDevicesMap.Contains(index)) {
-				if (mDevicesMap.Insert(index, std::move(pair))) {
+				if (InsertPair(index, std::move(pair))) {
 					/* Assign the free endpoint ID. */
 					do {
 						err = CreateEndpoint(index, mCurrentDynamicEndpointId);
@@ -253,7 +257,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 						if (err != CHIP_NO_ERROR) {
 							/* The pair was added to a map, so we have to take care about
 							 * removing it in case of failure. */
-							mDevicesMap.Erase(index);
+							ErasePair(index, dataProvider);
 						}
 
 						/* Handle wrap condition */
@@ -283,6 +287,33 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 	return CHIP_ERROR_NO_MEMORY;
 }
 
+bool BridgeManager::InsertPair(uint8_t index, BridgedDevicePair &&pair)
+{
+	BridgedDeviceDataProvider *provider = pair.mProvider;
+
+	if (!mProviderIndexes.Insert(provider, index)) {
+		LOG_ERR("Maximum number of devices bridged with a single provider exceeded");
+		return false;
+	}
+
+	if (!mDevicesMap.Insert(index, std::move(pair))) {
+		mProviderIndexes.Erase(provider, index);
+		return false;
+	}
+
+	return true;
+}
+
+bool BridgeManager::ErasePair(uint8_t index, BridgedDeviceDataProvider *provider)
+{
+	if (!mDevicesMap.Erase(index)) {
+		return false;
+	}
+
+	mProviderIndexes.Erase(provider, index);
+	return true;
+}
+
 CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 {
 	if (!mDevicesMap.Contains(index)) {
@@ -338,12 +369,12 @@ exit:
 	/* This method takes care of the resources, so objects have to be deleted in case of failures. */
 	if (err != CHIP_NO_ERROR) {
 		if (dataProvider) {
-			chip::Platform::Delete(dataProvider);
+			mDataProviderPool.Delete(dataProvider);
 		}
 
 		if (devices) {
 			for (auto i = 0; i < deviceListSize; ++i) {
-				chip::Platform::Delete(devices[i]);
+				mBridgedDevicePool.Delete(devices[i]);
 			}
 		}
 	}
@@ -410,23 +441,105 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 
 	/* The state update was triggered by non-Matter device, find bridged Matter device to update it as well.
 	 */
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			/* If the Bridged Device state was updated successfully, schedule sending Matter data
-			 * report. */
-			auto *device = item.value.mDevice;
-			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
-				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
-			}
+	uint8_t count = 0;
+	const uint8_t *indexes = Instance().mProviderIndexes.Get(&dataProvider, count);
+
+	for (uint8_t i = 0; i < count; i++) {
+		/* If the Bridged Device state was updated successfully, schedule sending Matter data report. */
+		auto *device = Instance().mDevicesMap[indexes[i]].mDevice;
+		if (device && CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+			Instance().ScheduleReport(device->GetEndpointId(), clusterId, attributeId);
 		}
 	}
 }
 
+void BridgeManager::ScheduleReport(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+#ifdef CONFIG_BRIDGE_REPORTING_COALESCING
+	/* The bridged device already holds the latest attribute value, so it is enough to remember that the attribute
+	 * has to be reported. */
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		const PendingReport &report = mPendingReports[i];
+		if (report.mEndpointId == endpointId && report.mClusterId == clusterId &&
+		    report.mAttributeId == attributeId) {
+			return;
+		}
+	}
+
+	if (mPendingReportsCount >= kMaxPendingReports) {
+		/* No space for the new entry, send the pending reports prematurely. */
+		DeviceLayer::SystemLayer().CancelTimer(ReportingTimerTimeoutCallback, this);
+		FlushReports();
+	}
+
+	mPendingReports[mPendingReportsCount++] = { endpointId, clusterId, attributeId };
+
+	if (mPendingReportsCount == 1) {
+		/* The first pending report opens the coalescing window. */
+		CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(
+			System::Clock::Milliseconds32(kReportingCoalescingWindowMs), ReportingTimerTimeoutCallback, this);
+
+		if (err != CHIP_NO_ERROR) {
+			LOG_ERR("Cannot start the reporting timer: %" CHIP_ERROR_FORMAT, err.Format());
+			FlushReports();
+		}
+	}
+#else
+	EmitReport(endpointId, clusterId, attributeId);
+#endif
+}
+
+void BridgeManager::EmitReport(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId)
+{
+	MatterReportingAttributeChangeCallback(endpointId, clusterId, attributeId);
+
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	if (mReportCallback) {
+		mReportCallback(endpointId, clusterId, attributeId);
+	}
+#endif
+}
+
+#ifdef CONFIG_BRIDGE_REPORTING_COALESCING
+void BridgeManager::FlushReports()
+{
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		const PendingReport &report = mPendingReports[i];
+		EmitReport(report.mEndpointId, report.mClusterId, report.mAttributeId);
+	}
+
+	mPendingReportsCount = 0;
+}
+
+void BridgeManager::DropReports(EndpointId endpointId)
+{
+	uint8_t count = 0;
+
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		if (mPendingReports[i].mEndpointId != endpointId) {
+			mPendingReports[count++] = mPendingReports[i];
+		}
+	}
+
+	mPendingReportsCount = count;
+
+	if (mPendingReportsCount == 0) {
+		DeviceLayer::SystemLayer().CancelTimer(ReportingTimerTimeoutCallback, this);
+	}
+}
+
+void BridgeManager::ReportingTimerTimeoutCallback(System::Layer *layer, void *context)
+{
+	VerifyOrReturn(context);
+
+	reinterpret_cast<BridgeManager *>(context)->FlushReports();
+}
+#endif
+
 void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, ClusterId clusterId, CommandId commandId,
 				  Nrf::Matter::BindingHandler::InvokeCommand invokeCommand)
 {
-	Nrf::Matter::BindingHandler::BindingData *bindingData =
-		Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+	Nrf::Matter::BindingHandler::BindingData *bindingData = Nrf::Matter::BindingHandler::AllocBindingData();
 
 	if (!bindingData) {
 		return;
@@ -436,13 +549,14 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 	bindingData->ClusterId = clusterId;
 	bindingData->InvokeCommandFunc = invokeCommand;
 
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			auto *device = item.value.mDevice;
+	uint8_t count = 0;
+	const uint8_t *indexes = Instance().mProviderIndexes.Get(&dataProvider, count);
 
-			if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
-				bindingData->EndpointId = device->GetEndpointId();
-			}
+	for (uint8_t i = 0; i < count; i++) {
+		auto *device = Instance().mDevicesMap[indexes[i]].mDevice;
+
+		if (device && emberAfContainsClient(device->GetEndpointId(), clusterId)) {
+			bindingData->EndpointId = device->GetEndpointId();
 		}
 	}
 
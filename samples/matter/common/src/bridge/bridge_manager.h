@@ -20,7 +20,13 @@ public:
 	static constexpr uint8_t kMaxBridgedDevicesPerProvider = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER_PER_PROVIDER;
 	static constexpr chip::EndpointId kAggregatorEndpointId = CONFIG_BRIDGE_AGGREGATOR_ENDPOINT_ID;
 
+	static constexpr uint8_t kMaxDataProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
+	static constexpr size_t kBridgedDevicePoolBlockSize = CONFIG_BRIDGE_BRIDGED_DEVICE_POOL_BLOCK_SIZE;
+	static constexpr size_t kDataProviderPoolBlockSize = CONFIG_BRIDGE_DATA_PROVIDER_POOL_BLOCK_SIZE;
+
 	using LoadStoredBridgedDevicesCallback = CHIP_ERROR (*)();
+	using BridgedDevicePool = SlabPool<MatterBridgedDevice, kBridgedDevicePoolBlockSize, kMaxBridgedDevices>;
+	using DataProviderPool = SlabPool<BridgedDeviceDataProvider, kDataProviderPoolBlockSize, kMaxDataProviders>;
 
 	/**
 	 * @brief Initialize BridgeManager instance.
@@ -118,6 +124,35 @@ public:
 	static void HandleCommand(BridgedDeviceDataProvider &dataProvider, chip::ClusterId clusterId,
 				  chip::CommandId commandId, Nrf::Matter::BindingHandler::InvokeCommand invokeCommand);
 
+	/**
+	 * @brief Get the pool from which all bridged device objects passed to the Bridge Manager must be allocated.
+	 * The Bridge Manager returns the objects to the pool once the bridged devices are removed.
+	 *
+	 * @return reference to the bridged devices pool
+	 */
+	BridgedDevicePool &GetBridgedDevicePool() { return mBridgedDevicePool; }
+
+	/**
+	 * @brief Get the pool from which all data provider objects passed to the Bridge Manager must be allocated.
+	 * The Bridge Manager returns the objects to the pool once the last bridged device using the provider is removed.
+	 *
+	 * @return reference to the data providers pool
+	 */
+	DataProviderPool &GetDataProviderPool() { return mDataProviderPool; }
+
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	using ReportCallback = void (*)(chip::EndpointId endpointId, chip::ClusterId clusterId,
+					chip::AttributeId attributeId);
+
+	/**
+	 * @brief Set the callback invoked whenever the Matter data report is emitted for the bridged device attribute.
+	 * It allows to measure the time needed by the Bridge Manager to process the data provider's update.
+	 *
+	 * @param callback callback to be invoked or nullptr to remove the previously set one
+	 */
+	void SetReportCallback(ReportCallback callback) { mReportCallback = callback; }
+#endif
+
 	static BridgeManager &Instance()
 	{
 		static BridgeManager sInstance;
@@ -134,8 +169,8 @@ private:
 
 		~BridgedDevicePair()
 		{
-			chip::Platform::Delete(mDevice);
-			chip::Platform::Delete(mProvider);
+			BridgeManager::Instance().GetBridgedDevicePool().Delete(mDevice);
+			BridgeManager::Instance().GetDataProviderPool().Delete(mProvider);
 			mDevice = nullptr;
 			mProvider = nullptr;
 		}
@@ -175,9 +210,20 @@ private:
 		BridgedDeviceDataProvider *mProvider;
 	};
 
-	static constexpr uint8_t kMaxDataProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
+#ifdef CONFIG_BRIDGE_REPORTING_COALESCING
+	static constexpr uint32_t kReportingCoalescingWindowMs = CONFIG_BRIDGE_REPORTING_COALESCING_WINDOW_MS;
+	static constexpr uint8_t kMaxPendingReports = CONFIG_BRIDGE_REPORTING_COALESCING_QUEUE_SIZE;
+
+	struct PendingReport {
+		chip::EndpointId mEndpointId;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
+#endif
 
 	using DeviceMap = FiniteMap<BridgedDevicePair, kMaxBridgedDevices>;
+	using ProviderIndexesMap =
+		FiniteMultiMap<BridgedDeviceDataProvider *, kMaxDataProviders, kMaxBridgedDevicesPerProvider>;
 
 	/**
 	 * @brief Add pair of single bridged device and its data provider using optional index and endpoint id.
@@ -245,7 +291,76 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
+	/**
+	 * @brief Insert pair of bridged device and its data provider to the devices map and assign the pair's index to
+	 * the provider in the reverse lookup map.
+	 *
+	 * @param index index under which the pair will be stored
+	 * @param pair pair to be stored
+	 * @return true on success
+	 * @return false if the pair cannot be stored
+	 */
+	bool InsertPair(uint8_t index, BridgedDevicePair &&pair);
+
+	/**
+	 * @brief Erase pair of bridged device and its data provider from the devices map and remove the pair's index
+	 * from the provider in the reverse lookup map.
+	 *
+	 * @param index index under which the pair is stored
+	 * @param provider data provider assigned to the pair before any of its duplicates were detached
+	 * @return true on success
+	 * @return false if the pair cannot be found
+	 */
+	bool ErasePair(uint8_t index, BridgedDeviceDataProvider *provider);
+
+	/**
+	 * @brief Schedule sending Matter data report for the given attribute. If the reporting coalescing is enabled,
+	 * the report is deferred until the end of the coalescing window and merged with other changes of the same
+	 * attribute.
+	 *
+	 * @param endpointId endpoint id of the bridged device
+	 * @param clusterId cluster id of the changed attribute
+	 * @param attributeId id of the changed attribute
+	 */
+	void ScheduleReport(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+	/**
+	 * @brief Emit Matter data report for the given attribute immediately.
+	 *
+	 * @param endpointId endpoint id of the bridged device
+	 * @param clusterId cluster id of the changed attribute
+	 * @param attributeId id of the changed attribute
+	 */
+	void EmitReport(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+#ifdef CONFIG_BRIDGE_REPORTING_COALESCING
+	/**
+	 * @brief Send Matter data reports for all pending attributes.
+	 */
+	void FlushReports();
+
+	/**
+	 * @brief Drop pending reports of the given endpoint, e.g. before the endpoint is removed.
+	 *
+	 * @param endpointId endpoint id of the bridged device
+	 */
+	void DropReports(chip::EndpointId endpointId);
+
+	static void ReportingTimerTimeoutCallback(chip::System::Layer *layer, void *context);
+
+	PendingReport mPendingReports[kMaxPendingReports];
+	uint8_t mPendingReportsCount{ 0 };
+#endif
+
+#ifdef CONFIG_BRIDGE_BENCHMARK
+	ReportCallback mReportCallback{ nullptr };
+#endif
+
+	BridgedDevicePool mBridgedDevicePool;
+	DataProviderPool mDataProviderPool;
 	DeviceMap mDevicesMap;
+	/* Reverse lookup of the pairs' indexes owned by the data provider. */
+	ProviderIndexesMap mProviderIndexes;
 	uint16_t mNumberOfProviders{ 0 };
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	uint8_t mDevicesIndexesCounter;
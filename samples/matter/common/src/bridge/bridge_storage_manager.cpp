@@ -6,6 +6,10 @@
 
 #include "bridge_storage_manager.h"
 
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+#include "migration/migration_manager.h"
+#endif
+
 namespace
 {
 template <class T> bool LoadDataToObject(Nrf::PersistentStorageNode *node, T &data)
@@ -26,6 +30,55 @@ Nrf::PersistentStorageNode CreateIndexNode(uint8_t bridgedDeviceIndex, Nrf::Pers
 	return Nrf::PersistentStorageNode(index, strlen(index), parent);
 }
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+Nrf::PersistentStorageNode CreateAddressNode(const bt_addr_le_t &addr, Nrf::PersistentStorageNode *parent)
+{
+	/* The address string representation contains characters that should not be used in the settings key. */
+	char key[2 * sizeof(bt_addr_le_t) + 1] = { 0 };
+
+	snprintf(key, sizeof(key), "%02x%02x%02x%02x%02x%02x%02x", addr.type, addr.a.val[5], addr.a.val[4],
+		 addr.a.val[3], addr.a.val[2], addr.a.val[1], addr.a.val[0]);
+
+	return Nrf::PersistentStorageNode(key, strlen(key), parent);
+}
+#endif
+
+bool IsValidRecord(const Nrf::BridgeStorageManager::BridgedDeviceRecord &record, size_t recordSize)
+{
+	using Nrf::BridgeStorageManager;
+
+	return recordSize == sizeof(record) && record.mVersion == BridgeStorageManager::kBridgedDeviceRecordVersion &&
+	       record.mNodeLabelLength < sizeof(record.mNodeLabel);
+}
+
+struct LoadRecordsContext {
+	Nrf::BridgeStorageManager::LoadBridgedDeviceRecordCallback callback;
+	void *context;
+	bool result;
+};
+
+bool LoadRecordEntry(const char *key, const void *data, size_t dataSize, void *context)
+{
+	LoadRecordsContext &ctx = *static_cast<LoadRecordsContext *>(context);
+	Nrf::BridgeStorageManager::BridgedDeviceRecord record;
+	char *end = nullptr;
+	unsigned long index = strtoul(key, &end, 10);
+
+	if (*key == '\0' || *end != '\0' || index > UINT8_MAX || dataSize != sizeof(record)) {
+		ctx.result = false;
+		return true;
+	}
+
+	memcpy(&record, data, sizeof(record));
+
+	if (!IsValidRecord(record, dataSize)) {
+		ctx.result = false;
+		return true;
+	}
+
+	return ctx.callback(record, static_cast<uint8_t>(index), ctx.context);
+}
+
 } /* namespace */
 
 namespace Nrf {
@@ -123,21 +176,78 @@ bool BridgeStorageManager::RemoveBridgedDeviceType(uint8_t bridgedDeviceIndex)
 	return Nrf::PersistentStorage::Instance().Remove(&id);
 }
 
-bool BridgeStorageManager::StoreBridgedDevice(const MatterBridgedDevice *device, uint8_t index)
+bool BridgeStorageManager::StoreBridgedDeviceRecord(const BridgedDeviceRecord &record, uint8_t bridgedDeviceIndex)
 {
-	if (!device) {
+	Nrf::PersistentStorageNode id = CreateIndexNode(bridgedDeviceIndex, &mBridgedDeviceRecord);
+
+	return Nrf::PersistentStorage::Instance().Store(&id, &record, sizeof(record));
+}
+
+bool BridgeStorageManager::LoadBridgedDeviceRecord(BridgedDeviceRecord &record, uint8_t bridgedDeviceIndex)
+{
+	Nrf::PersistentStorageNode id = CreateIndexNode(bridgedDeviceIndex, &mBridgedDeviceRecord);
+	size_t readSize = 0;
+
+	if (!Nrf::PersistentStorage::Instance().Load(&id, &record, sizeof(record), readSize)) {
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+		/* The device may still be stored using the legacy layout, so migrate it on the first access. */
+		if (Nrf::Matter::Migration::MoveBridgedDeviceToRecord(bridgedDeviceIndex) != CHIP_NO_ERROR ||
+		    !Nrf::PersistentStorage::Instance().Load(&id, &record, sizeof(record), readSize)) {
+			return false;
+		}
+#else
+		return false;
+#endif
+	}
+
+	return IsValidRecord(record, readSize);
+}
+
+bool BridgeStorageManager::LoadBridgedDeviceRecords(LoadBridgedDeviceRecordCallback callback, void *context)
+{
+	if (!callback) {
 		return false;
 	}
 
-	if (!StoreBridgedDeviceEndpointId(device->GetEndpointId(), index)) {
+	LoadRecordsContext ctx{ callback, context, true };
+
+	if (!Nrf::PersistentStorage::Instance().LoadAll(&mBridgedDeviceRecord, LoadRecordEntry, &ctx)) {
 		return false;
 	}
 
-	if (!StoreBridgedDeviceNodeLabel(device->GetNodeLabel(), strlen(device->GetNodeLabel()), index)) {
+	return ctx.result;
+}
+
+bool BridgeStorageManager::RemoveBridgedDeviceRecord(uint8_t bridgedDeviceIndex)
+{
+	Nrf::PersistentStorageNode id = CreateIndexNode(bridgedDeviceIndex, &mBridgedDeviceRecord);
+
+	return Nrf::PersistentStorage::Instance().Remove(&id);
+}
+
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+bool BridgeStorageManager::StoreBridgedDevice(const MatterBridgedDevice *device, const bt_addr_le_t &addr,
+					      uint8_t index)
+#else
+bool BridgeStorageManager::StoreBridgedDevice(const MatterBridgedDevice *device, uint8_t index)
+#endif
+{
+	if (!device) {
 		return false;
 	}
 
-	return StoreBridgedDeviceType(device->GetDeviceType(), index);
+	BridgedDeviceRecord record = {};
+
+	record.mVersion = kBridgedDeviceRecordVersion;
+	record.mEndpointId = device->GetEndpointId();
+	record.mDeviceType = device->GetDeviceType();
+	record.mNodeLabelLength = strnlen(device->GetNodeLabel(), sizeof(record.mNodeLabel) - 1);
+	memcpy(record.mNodeLabel, device->GetNodeLabel(), record.mNodeLabelLength);
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	record.mBtAddress = addr;
+#endif
+
+	return StoreBridgedDeviceRecord(record, index);
 }
 
 #ifdef CONFIG_BRIDGED_DEVICE_BT
@@ -161,6 +271,33 @@ bool BridgeStorageManager::RemoveBtAddress(uint8_t bridgedDeviceIndex)
 
 	return Nrf::PersistentStorage::Instance().Remove(&id);
 }
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+bool BridgeStorageManager::StoreBtGattCache(const BtGattCache &cache, const bt_addr_le_t &addr)
+{
+	Nrf::PersistentStorageNode id = CreateAddressNode(addr, &mBtGattCache);
+
+	return Nrf::PersistentStorage::Instance().Store(&id, &cache, sizeof(cache));
+}
+
+bool BridgeStorageManager::LoadBtGattCache(BtGattCache &cache, const bt_addr_le_t &addr)
+{
+	Nrf::PersistentStorageNode id = CreateAddressNode(addr, &mBtGattCache);
+
+	if (!LoadDataToObject(&id, cache)) {
+		return false;
+	}
+
+	return cache.mVersion == kGattCacheVersion && cache.mHandlesCount <= kGattCacheMaxHandles;
+}
+
+bool BridgeStorageManager::RemoveBtGattCache(const bt_addr_le_t &addr)
+{
+	Nrf::PersistentStorageNode id = CreateAddressNode(addr, &mBtGattCache);
+
+	return Nrf::PersistentStorage::Instance().Remove(&id);
+}
+#endif
 #endif
 
 } /* namespace Nrf */
@@ -22,6 +22,12 @@ namespace Nrf {
  *		/brd_cnt/ /<uint8_t>/
  *		/brd_ids/ /<uint8_t[brd_cnt]>/
  * 		/brd/
+ *			/rec/
+ *				/0/	/<BridgedDeviceRecord>/
+ *				/1/	/<BridgedDeviceRecord>/
+ *				.
+ *				.
+ *				/n/ /<BridgedDeviceRecord>/
  *			/eid/
  *				/0/	/<uint16_t>/
  *				/1/	/<uint16_t>/
@@ -47,21 +53,60 @@ namespace Nrf {
  *					.
  *					.
  *					/n/	/<bt_addr_le_t>/
+ *				/gatt/
+ *					/<bt_addr_le_t as hex string>/	/<BtGattCache>/
+ *
+ * The eid, label, type and bt/addr entries represent the legacy layout, in which every attribute of the bridged
+ * device was stored under a separate key. Currently, all the attributes are written at once as a single rec entry
+ * and the legacy entries are only read to migrate the devices stored by the previous firmware versions.
  */
 class BridgeStorageManager {
 public:
 	static constexpr auto kMaxIndexLength = 3;
+	static constexpr uint8_t kBridgedDeviceRecordVersion = 1;
+
+	/* All persistent attributes of the bridged device packed into a single settings entry. */
+	struct BridgedDeviceRecord {
+		uint8_t mVersion;
+		uint8_t mNodeLabelLength;
+		uint16_t mEndpointId;
+		uint16_t mDeviceType;
+		char mNodeLabel[MatterBridgedDevice::kNodeLabelSize];
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+		bt_addr_le_t mBtAddress;
+#endif
+	};
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	static constexpr uint8_t kGattCacheVersion = 1;
+	static constexpr uint8_t kGattCacheMaxHandles = 8;
+	static constexpr uint8_t kGattDbHashSize = 16;
+
+	/* Attribute handles discovered on the bridged Bluetooth LE device, valid as long as the peer's GATT database
+	 * hash does not change. */
+	struct BtGattCache {
+		uint8_t mVersion;
+		uint8_t mHandlesCount;
+		uint8_t mDbHash[kGattDbHashSize];
+		uint16_t mHandles[kGattCacheMaxHandles];
+	};
+#endif
 
 	BridgeStorageManager()
 		: mBridge("br", strlen("br")), mBridgedDevicesCount("brd_cnt", strlen("brd_cnt"), &mBridge),
 		  mBridgedDevicesIndexes("brd_ids", strlen("brd_ids"), &mBridge),
 		  mBridgedDevice("brd", strlen("brd"), &mBridge),
+		  mBridgedDeviceRecord("rec", strlen("rec"), &mBridgedDevice),
 		  mBridgedDeviceEndpointId("eid", strlen("eid"), &mBridgedDevice),
 		  mBridgedDeviceNodeLabel("label", strlen("label"), &mBridgedDevice),
 		  mBridgedDeviceType("type", strlen("type"), &mBridgedDevice)
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 		  ,
 		  mBt("bt", strlen("bt"), &mBridgedDevice), mBtAddress("addr", strlen("addr"), &mBt)
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+		  ,
+		  mBtGattCache("gatt", strlen("gatt"), &mBt)
+#endif
 #endif
 	{
 	}
@@ -210,9 +255,76 @@ public:
 	 */
 	bool RemoveBridgedDeviceType(uint8_t bridgedDeviceIndex);
 
+	/**
+	 * @brief Store bridged device record into settings
+	 *
+	 * @param record record containing all persistent attributes of the bridged device
+	 * @param bridgedDeviceIndex index describing specific bridged device
+	 * @return true if key has been written successfully
+	 * @return false an error occurred
+	 */
+	bool StoreBridgedDeviceRecord(const BridgedDeviceRecord &record, uint8_t bridgedDeviceIndex);
+
+	/**
+	 * @brief Load bridged device record from settings
+	 *
+	 * @param record reference to the record object to be filled with loaded data
+	 * @param bridgedDeviceIndex index describing specific bridged device
+	 * @return true if key has been loaded successfully and the record format is supported
+	 * @return false an error occurred
+	 */
+	bool LoadBridgedDeviceRecord(BridgedDeviceRecord &record, uint8_t bridgedDeviceIndex);
+
+	/**
+	 * @brief Callback called for every valid bridged device record found by LoadBridgedDeviceRecords
+	 *
+	 * @param record loaded bridged device record
+	 * @param bridgedDeviceIndex index describing the bridged device the record belongs to
+	 * @param context user context passed to LoadBridgedDeviceRecords
+	 * @return true to continue loading the next records
+	 * @return false to stop loading
+	 */
+	using LoadBridgedDeviceRecordCallback = bool (*)(BridgedDeviceRecord &record, uint8_t bridgedDeviceIndex,
+							 void *context);
+
+	/**
+	 * @brief Load all bridged device records from settings in a single pass over the settings storage
+	 *
+	 * Records that cannot be parsed or have an unsupported format are skipped and make the function return false,
+	 * but the remaining records are still delivered to the callback.
+	 *
+	 * @param callback callback called for every valid record
+	 * @param context user context passed to the callback
+	 * @return true if all records have been loaded successfully
+	 * @return false an error occurred
+	 */
+	bool LoadBridgedDeviceRecords(LoadBridgedDeviceRecordCallback callback, void *context = nullptr);
+
+	/**
+	 * @brief Remove bridged device record entry from settings
+	 *
+	 * @param bridgedDeviceIndex index describing specific bridged device's record to be removed
+	 * @return true if key entry has been removed successfully
+	 * @return false an error occurred
+	 */
+	bool RemoveBridgedDeviceRecord(uint8_t bridgedDeviceIndex);
+
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	/**
+	 * @brief Store bridged device into settings. Helper method allowing to store endpoint id, node label, device
+	 * type and Bluetooth LE address of specific bridged device using a single settings entry.
+	 *
+	 * @param device address of bridged device object to be stored
+	 * @param addr Bluetooth LE address of the device
+	 * @param index index describing specific bridged device
+	 * @return true if key has been written successfully
+	 * @return false an error occurred
+	 */
+	bool StoreBridgedDevice(const MatterBridgedDevice *device, const bt_addr_le_t &addr, uint8_t index);
+#else
 	/**
 	 * @brief Store bridged device into settings. Helper method allowing to store endpoint id, node label and device
-	 * type of specific bridged device using a single call.
+	 * type of specific bridged device using a single settings entry.
 	 *
 	 * @param device address of bridged device object to be stored
 	 * @param index index describing specific bridged device
@@ -220,6 +332,7 @@ public:
 	 * @return false an error occurred
 	 */
 	bool StoreBridgedDevice(const MatterBridgedDevice *device, uint8_t index);
+#endif
 
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 
@@ -251,6 +364,37 @@ public:
 	 * @return false an error occurred
 	 */
 	bool RemoveBtAddress(uint8_t bridgedDeviceIndex);
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/**
+	 * @brief Store GATT discovery cache of the bridged Bluetooth LE device into settings
+	 *
+	 * @param cache GATT discovery cache to be stored
+	 * @param addr Bluetooth LE address of the device that the cache belongs to
+	 * @return true if key has been written successfully
+	 * @return false an error occurred
+	 */
+	bool StoreBtGattCache(const BtGattCache &cache, const bt_addr_le_t &addr);
+
+	/**
+	 * @brief Load GATT discovery cache of the bridged Bluetooth LE device from settings
+	 *
+	 * @param cache reference to the cache object to be filled with loaded data
+	 * @param addr Bluetooth LE address of the device that the cache belongs to
+	 * @return true if key has been loaded successfully and the cache format is supported
+	 * @return false an error occurred
+	 */
+	bool LoadBtGattCache(BtGattCache &cache, const bt_addr_le_t &addr);
+
+	/**
+	 * @brief Remove GATT discovery cache of the bridged Bluetooth LE device from settings
+	 *
+	 * @param addr Bluetooth LE address of the device that the cache belongs to
+	 * @return true if key entry has been removed successfully
+	 * @return false an error occurred
+	 */
+	bool RemoveBtGattCache(const bt_addr_le_t &addr);
+#endif
 #endif
 
 private:
@@ -258,12 +402,16 @@ private:
 	Nrf::PersistentStorageNode mBridgedDevicesCount;
 	Nrf::PersistentStorageNode mBridgedDevicesIndexes;
 	Nrf::PersistentStorageNode mBridgedDevice;
+	Nrf::PersistentStorageNode mBridgedDeviceRecord;
 	Nrf::PersistentStorageNode mBridgedDeviceEndpointId;
 	Nrf::PersistentStorageNode mBridgedDeviceNodeLabel;
 	Nrf::PersistentStorageNode mBridgedDeviceType;
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 	Nrf::PersistentStorageNode mBt;
 	Nrf::PersistentStorageNode mBtAddress;
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	Nrf::PersistentStorageNode mBtGattCache;
+#endif
 #endif
 };
 
@@ -8,32 +8,64 @@
 
 #include <lib/support/CHIPMem.h>
 
+#include <zephyr/kernel.h>
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <map>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 namespace Nrf {
 
 /*
-   DeviceFactory template container allows to instantiate a map which
-   binds supported Matter device type identifiers (uint16_t) with corresponding
-   creation method (e.g. constructor invocation). DeviceFactory can
-   only be constructed by passing a user-defined initialized list with
-   <uint16_t, ConcreteDeviceCreator> pairs.
-   Then, Create() method can be used to obtain an instance of demanded
-   device type with all passed arguments forwarded to the underlying
-   ConcreteDeviceCreator.
+   DeviceFactory template container allows to bind supported Matter device type identifiers (e.g. uint16_t)
+   with corresponding creation functions (e.g. constructor invocation) without any dynamic allocation.
+   The creators are kept in a table that is sorted at compilation time using the MakeCreatorTable() method,
+   and DeviceFactory can only be constructed by passing such a table, which must have static storage duration.
+   Then, Create() method can be used to obtain an instance of demanded device type with all passed arguments
+   forwarded to the underlying ConcreteDeviceCreator. The creator is found using binary search.
+   Example:
+     constexpr std::initializer_list<Factory::Creator> kCreators{ { kType, &CreateDevice<Device> }, };
+     constexpr auto kCreatorTable = Factory::MakeCreatorTable<kCreators.size()>(kCreators);
+     static constexpr Factory sFactory{ kCreatorTable };
 */
 template <typename T, typename DeviceType, typename... Args> class DeviceFactory {
 public:
-	using ConcreteDeviceCreator = std::function<T *(Args...)>;
-	using CreationMap = std::map<DeviceType, ConcreteDeviceCreator>;
+	using ConcreteDeviceCreator = T *(*)(Args...);
+
+	struct Creator {
+		DeviceType mDeviceType;
+		ConcreteDeviceCreator mCreate;
+	};
 
-	DeviceFactory(std::initializer_list<std::pair<DeviceType, ConcreteDeviceCreator>> init)
+	template <std::size_t N> static constexpr std::array<Creator, N> MakeCreatorTable(std::initializer_list<Creator> init)
 	{
-		for (auto &pair : init) {
-			mCreationMap.insert(pair);
+		std::array<Creator, N> table{};
+		std::size_t count = 0;
+
+		for (const Creator &creator : init) {
+			table[count++] = creator;
 		}
+
+		/* Use insertion sort, as std::sort is not constexpr in C++17. */
+		for (std::size_t i = 1; i < N; i++) {
+			for (std::size_t j = i; j > 0 && table[j].mDeviceType < table[j - 1].mDeviceType; j--) {
+				Creator creator = table[j];
+				table[j] = table[j - 1];
+				table[j - 1] = creator;
+			}
+		}
+
+		return table;
+	}
+
+	template <std::size_t N>
+	constexpr DeviceFactory(const std::array<Creator, N> &table) : mCreators(table.data()), mCreatorsCount(N)
+	{
 	}
 
 	DeviceFactory() = delete;
@@ -43,16 +75,109 @@ public:
 	DeviceFactory &operator=(DeviceFactory &&) = delete;
 	~DeviceFactory() = default;
 
-	T *Create(DeviceType deviceType, Args... params)
+	T *Create(DeviceType deviceType, Args... params) const
 	{
-		if (mCreationMap.find(deviceType) == mCreationMap.end()) {
+		std::size_t low = 0;
+		std::size_t high = mCreatorsCount;
+
+		while (low < high) {
+			std::size_t middle = low + (high - low) / 2;
+
+			if (mCreators[middle].mDeviceType < deviceType) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		if (low == mCreatorsCount || mCreators[low].mDeviceType != deviceType) {
 			return nullptr;
 		}
-		return mCreationMap[deviceType](std::forward<Args>(params)...);
+		return mCreators[low].mCreate(std::forward<Args>(params)...);
 	}
 
 private:
-	CreationMap mCreationMap;
+	const Creator *mCreators;
+	std::size_t mCreatorsCount;
+};
+
+/*
+   SlabPool template container allows to allocate objects of T type, or any type derived from T, from
+   the statically allocated memory that is split into N blocks of BlockSize bytes. The pool is backed by
+   the Zephyr memory slab, so allocating and releasing the objects takes constant time, never fragments
+   the heap and is thread-safe.
+   SlabPool's API offers basic operations like:
+     * constructing a new object of given type in the free block (New)
+     * destroying the object and releasing its block (Delete)
+     * wrapping the object in a smart pointer that releases it to the pool (MakeUnique)
+     * retrieving the occupancy statistics (Capacity, Used, MaxUsed, FailedAllocations)
+	Prerequisites:
+     * T must have a virtual destructor and be the first base class of the allocated types
+     * the size of every allocated type must not exceed BlockSize, what is verified at compilation time
+*/
+template <typename T, std::size_t BlockSize, std::size_t N> class SlabPool {
+public:
+	static constexpr std::size_t kBlockAlignment = alignof(std::max_align_t);
+	static constexpr std::size_t kBlockSize = (BlockSize + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment;
+
+	struct Deleter {
+		SlabPool *mPool;
+		void operator()(T *object) const { mPool->Delete(object); }
+	};
+	using UniquePtr = std::unique_ptr<T, Deleter>;
+
+	SlabPool() { k_mem_slab_init(&mSlab, mBuffer, kBlockSize, N); }
+
+	SlabPool(const SlabPool &) = delete;
+	SlabPool &operator=(const SlabPool &) = delete;
+
+	template <typename U, typename... Args> U *New(Args &&...args)
+	{
+		static_assert(std::is_base_of_v<T, U>, "The pool can only hold objects derived from T");
+		static_assert(sizeof(U) <= kBlockSize, "The object does not fit the pool block, increase the block size");
+		static_assert(alignof(U) <= kBlockAlignment, "The object alignment is not supported by the pool");
+
+		void *block = nullptr;
+
+		if (k_mem_slab_alloc(&mSlab, &block, K_NO_WAIT) != 0) {
+			atomic_inc(&mFailedAllocations);
+			return nullptr;
+		}
+
+		U *object = new (block) U(std::forward<Args>(args)...);
+
+		/* Delete() releases the block using T pointer, so the T subobject must be placed at the beginning. */
+		if (static_cast<void *>(static_cast<T *>(object)) != block) {
+			object->~U();
+			k_mem_slab_free(&mSlab, block);
+			return nullptr;
+		}
+		return object;
+	}
+
+	void Delete(T *object)
+	{
+		if (!object) {
+			return;
+		}
+
+		object->~T();
+		k_mem_slab_free(&mSlab, object);
+	}
+
+	UniquePtr MakeUnique(T *object) { return UniquePtr(object, Deleter{ this }); }
+
+	constexpr std::size_t Capacity() const { return N; }
+	std::size_t Used() { return k_mem_slab_num_used_get(&mSlab); }
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	std::size_t MaxUsed() { return k_mem_slab_max_used_get(&mSlab); }
+#endif
+	std::size_t FailedAllocations() { return atomic_get(&mFailedAllocations); }
+
+private:
+	struct k_mem_slab mSlab;
+	atomic_t mFailedAllocations = ATOMIC_INIT(0);
+	alignas(kBlockAlignment) uint8_t mBuffer[kBlockSize * N];
 };
 
 /*
@@ -61,6 +186,8 @@ private:
    the maximum number of stored elements must be well known. FiniteMap owns
    inserted values, meaning that once the user inserts a value it will not longer
    be valid outside of the container, i.e. FiniteMap cannot return stored object by copy.
+   The container is dense and direct-indexed: the value stored under the key is always kept in the
+   mMap[key] slot, so the key must be lower than N and the lookup operations take constant time.
    FiniteMap's API offers basic operations like:
      * inserting new values under provided key (Insert)
      * erasing existing item under given key (Erase) - this operation takes care about the duplicated items,
@@ -82,6 +209,11 @@ template <typename T, std::size_t N> struct FiniteMap {
 
 	bool Insert(uint16_t key, T &&value)
 	{
+		if (key >= N) {
+			/* The key cannot be used to directly index the map. */
+			return false;
+		}
+
 		if (Contains(key)) {
 			/* The key with sane value already exists in the map, return prematurely. */
 			return false;
@@ -95,11 +227,9 @@ template <typename T, std::size_t N> struct FiniteMap {
 
 	bool Erase(uint16_t key)
 	{
-		const auto &it = std::find_if(std::begin(mMap), std::end(mMap),
-					      [key](const Item &item) { return item.key == key; });
-		if (it != std::end(mMap) && it->value) {
-			it->value = T{};
-			it->key = kInvalidKey;
+		if (key < N && mMap[key].key == key && mMap[key].value) {
+			mMap[key].value = T{};
+			mMap[key].key = kInvalidKey;
 			mElementsCount--;
 			return true;
 		}
@@ -110,21 +240,13 @@ template <typename T, std::size_t N> struct FiniteMap {
 	T &operator[](uint16_t key)
 	{
 		static T dummyObject;
-		for (auto &it : mMap) {
-			if (key == it.key)
-				return it.value;
+		if (Contains(key)) {
+			return mMap[key].value;
 		}
 		return dummyObject;
 	}
 
-	bool Contains(uint16_t key)
-	{
-		for (auto &it : mMap) {
-			if (key == it.key)
-				return true;
-		}
-		return false;
-	}
+	bool Contains(uint16_t key) { return key < N && mMap[key].key == key; }
 	std::size_t FreeSlots() { return N - mElementsCount; }
 
 	uint8_t GetDuplicatesCount(const T &value, uint16_t *key)
@@ -147,4 +269,163 @@ template <typename T, std::size_t N> struct FiniteMap {
 	uint16_t mElementsCount{ 0 };
 };
 
+/*
+   FiniteMultiMap template container allows to keep a reverse mapping between K-type key (e.g. a pointer
+   to the owner object) and up to M uint8_t-type values (e.g. FiniteMap keys) assigned to it.
+   The container can hold at most N distinct keys. Keys are hashed into an open addressing table with
+   linear probing, so the lookup operations take constant time on average and the table never allocates.
+   FiniteMultiMap's API offers basic operations like:
+     * assigning a new value to the provided key (Insert)
+     * removing a value assigned to the provided key, the key is released along with its last value (Erase)
+     * checking if the map contains any value assigned to the provided key (Contains)
+     * retrieving all values assigned to the provided key (Get)
+	Prerequisites:
+     * K must be hashable with std::hash and have ==operator implemented
+*/
+template <typename K, std::size_t N, std::size_t M> struct FiniteMultiMap {
+	static_assert(N > 0 && M > 0, "FiniteMultiMap must be able to hold at least one value");
+
+	struct Bucket {
+		K key{};
+		uint8_t values[M];
+		/* The bucket is free if there is no value assigned to the key. */
+		uint8_t count{ 0 };
+	};
+
+	bool Insert(const K &key, uint8_t value)
+	{
+		Bucket *bucket = Find(key);
+
+		if (!bucket) {
+			bucket = FindFree(key);
+			if (!bucket) {
+				return false;
+			}
+			bucket->key = key;
+			mKeysCount++;
+		}
+
+		for (uint8_t i = 0; i < bucket->count; i++) {
+			if (bucket->values[i] == value) {
+				/* The value is already assigned to the key. */
+				return true;
+			}
+		}
+
+		if (bucket->count >= M) {
+			return false;
+		}
+
+		bucket->values[bucket->count++] = value;
+		return true;
+	}
+
+	bool Erase(const K &key, uint8_t value)
+	{
+		Bucket *bucket = Find(key);
+
+		if (!bucket) {
+			return false;
+		}
+
+		for (uint8_t i = 0; i < bucket->count; i++) {
+			if (bucket->values[i] == value) {
+				/* The order of values is not relevant, so fill the gap with the last one. */
+				bucket->values[i] = bucket->values[--bucket->count];
+				if (bucket->count == 0) {
+					Release(static_cast<std::size_t>(bucket - mBuckets));
+				}
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Contains(const K &key) { return Find(key) != nullptr; }
+
+	/* Returns the values assigned to the key and sets count to their number, or nullptr if key is not present. */
+	const uint8_t *Get(const K &key, uint8_t &count)
+	{
+		Bucket *bucket = Find(key);
+
+		count = bucket ? bucket->count : 0;
+		return bucket ? bucket->values : nullptr;
+	}
+
+	std::size_t FreeSlots() { return N - mKeysCount; }
+
+private:
+	static std::size_t Home(const K &key)
+	{
+		std::size_t hash = std::hash<K>{}(key);
+
+		/* Mix the upper bits down, as pointer keys have the lowest bits always cleared due to alignment. */
+		hash ^= hash >> 4;
+		hash ^= hash >> 12;
+		return hash % N;
+	}
+
+	static std::size_t Next(std::size_t index) { return (index + 1) % N; }
+
+	Bucket *Find(const K &key)
+	{
+		std::size_t index = Home(key);
+
+		for (std::size_t probe = 0; probe < N; probe++) {
+			if (mBuckets[index].count == 0) {
+				/* Free bucket ends the probe sequence. */
+				return nullptr;
+			}
+			if (mBuckets[index].key == key) {
+				return &mBuckets[index];
+			}
+			index = Next(index);
+		}
+		return nullptr;
+	}
+
+	Bucket *FindFree(const K &key)
+	{
+		std::size_t index = Home(key);
+
+		for (std::size_t probe = 0; probe < N; probe++) {
+			if (mBuckets[index].count == 0) {
+				return &mBuckets[index];
+			}
+			index = Next(index);
+		}
+		return nullptr;
+	}
+
+	void Release(std::size_t freed)
+	{
+		/* Shift the following buckets of the probe sequence back, so that no tombstones are needed. */
+		std::size_t index = freed;
+
+		mBuckets[freed].key = K{};
+		mKeysCount--;
+
+		for (std::size_t probe = 1; probe < N; probe++) {
+			index = Next(index);
+			if (mBuckets[index].count == 0) {
+				return;
+			}
+
+			std::size_t home = Home(mBuckets[index].key);
+			bool reachable = (freed <= index) ? (home <= freed || home > index) : (home <= freed && home > index);
+
+			if (reachable) {
+				mBuckets[freed] = mBuckets[index];
+				mBuckets[index].count = 0;
+				mBuckets[index].key = K{};
+				freed = index;
+			}
+		}
+	}
+
+	Bucket mBuckets[N];
+	std::size_t mKeysCount{ 0 };
+};
+
 } /* namespace Nrf */
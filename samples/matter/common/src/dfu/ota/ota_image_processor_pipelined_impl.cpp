@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ota_image_processor_pipelined_impl.h"
+
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemError.h>
+
+#include <dfu/dfu_multi_image.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace
+{
+K_THREAD_STACK_DEFINE(sWriterStack, CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINE_WRITER_STACK_SIZE);
+k_work_q sWriterQueue;
+
+Nrf::Matter::OTAImageProcessorPipelinedImpl *sInstance;
+} /* namespace */
+
+namespace Nrf::Matter {
+
+OTAImageProcessorPipelinedImpl::OTAImageProcessorPipelinedImpl(ExternalFlashManager *flashHandler)
+	: OTAImageProcessorBaseImpl(flashHandler)
+{
+	k_work_queue_init(&sWriterQueue);
+	k_work_queue_start(&sWriterQueue, sWriterStack, K_THREAD_STACK_SIZEOF(sWriterStack),
+			   CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINE_WRITER_PRIORITY, nullptr);
+	k_thread_name_set(&sWriterQueue.thread, "ota_writer");
+	k_work_init(&mWriteWork, WriteBlockHandler);
+	sInstance = this;
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::PrepareDownload()
+{
+	WaitForWriter();
+	ResetPipeline();
+
+	mDigestHeaderParser.Init();
+	mDigestAvailable = false;
+	ReturnErrorOnFailure(mDigest.Begin());
+
+	return OTAImageProcessorBaseImpl::PrepareDownload();
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::Finalize()
+{
+	/* Let the writer complete the last blocks before the image is closed */
+	WaitForWriter();
+
+	CHIP_ERROR error = System::MapErrorZephyr(atomic_get(&mWriteError));
+	ResetPipeline();
+
+	if (error == CHIP_NO_ERROR) {
+		error = VerifyDigest();
+	}
+
+	if (error != CHIP_NO_ERROR) {
+		ChipLogError(SoftwareUpdate, "Failed to finalize firmware image: %" CHIP_ERROR_FORMAT, error.Format());
+		OTAImageProcessorBaseImpl::Abort();
+		return error;
+	}
+
+	return OTAImageProcessorBaseImpl::Finalize();
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::Abort()
+{
+	WaitForWriter();
+	ResetPipeline();
+	mDigest.Clear();
+
+	return OTAImageProcessorBaseImpl::Abort();
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::ProcessBlock(ByteSpan &block)
+{
+	VerifyOrReturnError(mDownloader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+	/*
+	 * The base implementation drops the header once the payload size is known, so decode it once more
+	 * on the side to get the expected image digest.
+	 */
+	if (mDigestHeaderParser.IsInitialized()) {
+		ByteSpan headerBlock = block;
+		OTAImageHeader header;
+		CHIP_ERROR error = mDigestHeaderParser.AccumulateAndDecode(headerBlock, header);
+
+		if (error == CHIP_NO_ERROR) {
+			mDigestAvailable = header.mImageDigestType == OTAImageDigestType::kSha256 &&
+					   header.mImageDigest.size() == sizeof(mExpectedDigest);
+
+			if (mDigestAvailable) {
+				memcpy(mExpectedDigest, header.mImageDigest.data(), sizeof(mExpectedDigest));
+			} else {
+				ChipLogError(SoftwareUpdate, "Unsupported image digest type, image digest is not verified");
+			}
+
+			mDigestHeaderParser.Clear();
+		}
+	}
+
+	CHIP_ERROR error = ProcessHeader(block);
+
+	if (error == CHIP_NO_ERROR) {
+		error = UpdateDigest(block);
+	}
+
+	if (error == CHIP_NO_ERROR) {
+		error = System::MapErrorZephyr(atomic_get(&mWriteError));
+	}
+
+	if (error == CHIP_NO_ERROR && block.size() > kStagingBufferSize) {
+		ChipLogError(SoftwareUpdate, "Block of %u bytes exceeds the staging buffer size",
+			     static_cast<unsigned>(block.size()));
+		error = CHIP_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	if (error == CHIP_NO_ERROR && !block.empty()) {
+		/* Only the block being written and at most one block waiting for the writer can be staged */
+		VerifyOrReturnError(mPendingBlock == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+		StagedBlock &staged = mWrittenBlock == &mStagedBlocks[0] ? mStagedBlocks[1] : mStagedBlocks[0];
+
+		memcpy(staged.mData, block.data(), block.size());
+		staged.mSize = block.size();
+		staged.mOffset = mParams.downloadedBytes;
+		mParams.downloadedBytes += block.size();
+
+		if (mWrittenBlock != nullptr) {
+			/* Both staging buffers are in use, so request the next block once the writer is done */
+			mPendingBlock = &staged;
+			return CHIP_NO_ERROR;
+		}
+
+		SubmitBlock(staged);
+	}
+
+	/* Report the result back to the downloader asynchronously */
+	return SystemLayer().ScheduleLambda([this, error] {
+		if (error == CHIP_NO_ERROR) {
+			mDownloader->FetchNextData();
+		} else {
+			mDownloader->EndDownload(error);
+		}
+	});
+}
+
+void OTAImageProcessorPipelinedImpl::ResetPipeline()
+{
+	mWrittenBlock = nullptr;
+	mPendingBlock = nullptr;
+	atomic_set(&mWriteError, 0);
+}
+
+void OTAImageProcessorPipelinedImpl::WaitForWriter()
+{
+	k_work_sync sync;
+
+	k_work_flush(&mWriteWork, &sync);
+
+	/* The Matter thread is blocked here, so the pending block would never be submitted otherwise */
+	if (mPendingBlock != nullptr && atomic_get(&mWriteError) == 0) {
+		SubmitBlock(*mPendingBlock);
+		mPendingBlock = nullptr;
+		k_work_flush(&mWriteWork, &sync);
+	}
+}
+
+void OTAImageProcessorPipelinedImpl::SubmitBlock(StagedBlock &block)
+{
+	mWrittenBlock = &block;
+	k_work_submit_to_queue(&sWriterQueue, &mWriteWork);
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::UpdateDigest(ByteSpan block)
+{
+	VerifyOrReturnError(!block.empty(), CHIP_NO_ERROR);
+
+	return mDigest.AddData(block);
+}
+
+CHIP_ERROR OTAImageProcessorPipelinedImpl::VerifyDigest()
+{
+	uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+	MutableByteSpan digest(digestBuffer);
+
+	ReturnErrorOnFailure(mDigest.Finish(digest));
+	VerifyOrReturnError(mDigestAvailable, CHIP_NO_ERROR);
+	VerifyOrReturnError(digest.size() == sizeof(mExpectedDigest) &&
+				    memcmp(digest.data(), mExpectedDigest, sizeof(mExpectedDigest)) == 0,
+			    CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+	ChipLogProgress(SoftwareUpdate, "Firmware image digest verified");
+
+	return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorPipelinedImpl::WriteBlockHandler(k_work *work)
+{
+	/* Runs in the writer thread; the flash pages reached by the write are erased on the way */
+	const StagedBlock *block = sInstance->mWrittenBlock;
+	const int result = dfu_multi_image_write(block->mOffset, block->mData, block->mSize);
+
+	if (result != 0) {
+		atomic_cas(&sInstance->mWriteError, 0, result);
+	}
+
+	PlatformMgr().ScheduleWork(BlockWrittenHandler, reinterpret_cast<intptr_t>(sInstance));
+}
+
+void OTAImageProcessorPipelinedImpl::BlockWrittenHandler(intptr_t context)
+{
+	auto *processor = reinterpret_cast<OTAImageProcessorPipelinedImpl *>(context);
+
+	/* The pipeline has been flushed by Finalize() or Abort() in the meantime */
+	VerifyOrReturn(processor->mWrittenBlock != nullptr);
+
+	processor->mWrittenBlock = nullptr;
+
+	const int result = atomic_get(&processor->mWriteError);
+
+	if (result != 0) {
+		processor->mPendingBlock = nullptr;
+		processor->mDownloader->EndDownload(System::MapErrorZephyr(result));
+		return;
+	}
+
+	if (processor->mPendingBlock != nullptr) {
+		processor->SubmitBlock(*processor->mPendingBlock);
+		processor->mPendingBlock = nullptr;
+		processor->mDownloader->FetchNextData();
+	}
+}
+
+} /* namespace Nrf::Matter */
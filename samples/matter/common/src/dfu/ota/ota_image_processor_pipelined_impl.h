@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "ota_image_processor_base_impl.h"
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/OTAImageHeader.h>
+
+#include <zephyr/kernel.h>
+
+namespace Nrf::Matter {
+
+/**
+ * OTA image processor that writes the image to flash in the background.
+ *
+ * Each received block is copied to one of two staging buffers and written to flash, including the erase of
+ * the flash pages that the write reaches, by a dedicated thread. The next block is requested as soon as a
+ * staging buffer is free, so that receiving the following block overlaps with writing the current one, and
+ * the Matter thread is never blocked by flash operations.
+ *
+ * The digest of the image payload is computed incrementally while the blocks are received and verified
+ * against the digest from the Matter OTA image header when the download is finalized.
+ */
+class OTAImageProcessorPipelinedImpl : public OTAImageProcessorBaseImpl {
+public:
+	static constexpr size_t kStagingBufferSize = CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINE_BLOCK_SIZE;
+
+	explicit OTAImageProcessorPipelinedImpl(chip::DeviceLayer::ExternalFlashManager *flashHandler = nullptr);
+
+	CHIP_ERROR PrepareDownload() override;
+	CHIP_ERROR Finalize() override;
+	CHIP_ERROR Abort() override;
+	CHIP_ERROR ProcessBlock(chip::ByteSpan &block) override;
+
+private:
+	struct StagedBlock {
+		uint8_t mData[kStagingBufferSize];
+		size_t mSize;
+		size_t mOffset;
+	};
+
+	void ResetPipeline();
+	void WaitForWriter();
+	void SubmitBlock(StagedBlock &block);
+	CHIP_ERROR UpdateDigest(chip::ByteSpan block);
+	CHIP_ERROR VerifyDigest();
+
+	static void WriteBlockHandler(k_work *work);
+	static void BlockWrittenHandler(intptr_t context);
+
+	StagedBlock mStagedBlocks[2];
+	StagedBlock *mWrittenBlock = nullptr;
+	StagedBlock *mPendingBlock = nullptr;
+	k_work mWriteWork;
+	atomic_t mWriteError = ATOMIC_INIT(0);
+
+	chip::OTAImageHeaderParser mDigestHeaderParser;
+	chip::Crypto::Hash_SHA256_stream mDigest;
+	uint8_t mExpectedDigest[chip::Crypto::kSHA256_Hash_Length];
+	bool mDigestAvailable = false;
+};
+
+} /* namespace Nrf::Matter */
@@ -6,6 +6,10 @@
 
 #include "ota_util.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINED_IMAGE_PROCESSOR
+#include "ota_image_processor_pipelined_impl.h"
+#endif
+
 #if CONFIG_CHIP_OTA_REQUESTOR
 #include <app/clusters/ota-requestor/BDXDownloader.h>
 #include <app/clusters/ota-requestor/DefaultOTARequestor.h>
@@ -36,10 +40,16 @@ namespace Nrf::Matter {
 /* compile-time factory method */
 OTAImageProcessorImpl &GetOTAImageProcessor()
 {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINED_IMAGE_PROCESSOR
+	using ImageProcessor = OTAImageProcessorPipelinedImpl;
+#else
+	using ImageProcessor = OTAImageProcessorBaseImpl;
+#endif
+
 #if CONFIG_PM_DEVICE && CONFIG_NORDIC_QSPI_NOR
-	static OTAImageProcessorBaseImpl sOTAImageProcessor(&GetFlashHandler());
+	static ImageProcessor sOTAImageProcessor(&GetFlashHandler());
 #else
-	static OTAImageProcessorBaseImpl sOTAImageProcessor;
+	static ImageProcessor sOTAImageProcessor;
 #endif
 	return sOTAImageProcessor;
 }
@@ -21,6 +21,10 @@ namespace Nrf::Matter {
  * power states of peripherals, select the implementation that automatically
  * powers off the external flash when no longer needed. Otherwise, select the
  * most basic implementation.
+ *
+ * If CONFIG_NCS_SAMPLE_MATTER_OTA_PIPELINED_IMAGE_PROCESSOR is enabled, the selected
+ * implementation is extended to write the image to flash in the background and
+ * verify the image digest.
  */
 chip::DeviceLayer::OTAImageProcessorImpl &GetOTAImageProcessor();
 
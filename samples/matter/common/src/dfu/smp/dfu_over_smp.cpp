@@ -16,6 +16,13 @@
 
 #include <lib/support/logging/CHIPLogging.h>
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+#include <zephyr/bluetooth/hci.h>
+#ifdef CONFIG_BT_LL_SOFTDEVICE
+#include <sdc_hci_vs.h>
+#endif
+#endif
+
 #include <zephyr/dfu/mcuboot.h>
 #include <zephyr/mgmt/mcumgr/mgmt/callbacks.h>
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
@@ -30,6 +37,13 @@ constexpr uint16_t kAdvertisingIntervalMin = 400;
 constexpr uint16_t kAdvertisingIntervalMax = 500;
 constexpr uint8_t kAdvertisingFlags = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+/* Connection interval in 1.25 ms units and supervision timeout in 10 ms units used while DFU is active. */
+constexpr uint16_t kThroughputConnIntervalMin = 6;
+constexpr uint16_t kThroughputConnIntervalMax = 12;
+constexpr uint16_t kThroughputConnTimeout = 400;
+#endif
+
 namespace
 {
 enum mgmt_cb_return UploadConfirmHandler(uint32_t event,
@@ -102,6 +116,16 @@ void DFUOverSMP::Init()
 
 	mgmt_callback_register(&sUploadCallback);
 	mgmt_callback_register(&sCommandCallback);
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+	mConnCallbacks.disconnected = OnDisconnected;
+	bt_conn_cb_register(&mConnCallbacks);
+
+	mDfuStatusCallback.callback = DfuStatusHandler;
+	mDfuStatusCallback.event_id =
+		MGMT_EVT_OP_IMG_MGMT_DFU_STARTED | MGMT_EVT_OP_IMG_MGMT_DFU_STOPPED | MGMT_EVT_OP_IMG_MGMT_DFU_PENDING;
+	mgmt_callback_register(&mDfuStatusCallback);
+#endif
 }
 
 void DFUOverSMP::ConfirmNewImage()
@@ -130,4 +154,125 @@ void DFUOverSMP::StartServer()
 	ChipLogProgress(DeviceLayer, "DFU over SMP started");
 }
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+enum mgmt_cb_return DFUOverSMP::DfuStatusHandler(uint32_t event, enum mgmt_cb_return prev_status, int32_t *rc,
+						  uint16_t *group, bool *abort_more, void *data, size_t data_size)
+{
+	/* The upload is complete once the image is marked as pending. */
+	GetDFUOverSMP().SetThroughputMode(event == MGMT_EVT_OP_IMG_MGMT_DFU_STARTED);
+
+	return MGMT_CB_OK;
+}
+
+void DFUOverSMP::SetThroughputMode(bool enable)
+{
+	/* Apply the mode again when a new upload starts, as the previous client may have left without stopping */
+	VerifyOrReturn(enable || mThroughputModeActive);
+
+	/*
+	 * The image management hooks do not identify the connection used for the transfer, so apply the mode to
+	 * all connections in the peripheral role, which are the ones that the SMP client can use.
+	 */
+	bt_conn_foreach(BT_CONN_TYPE_LE, enable ? EnterThroughputMode : ExitThroughputMode, this);
+
+	if (enable != mThroughputModeActive) {
+		SetConnEventExtension(enable || IS_ENABLED(CONFIG_BT_CTLR_SDC_CONN_EVENT_EXTEND_DEFAULT));
+	}
+
+	mThroughputModeActive = enable;
+	ChipLogProgress(SoftwareUpdate, "DFU over SMP throughput mode %s", enable ? "enabled" : "disabled");
+}
+
+void DFUOverSMP::EnterThroughputMode(bt_conn *conn, void *data)
+{
+	DFUOverSMP *dfu = static_cast<DFUOverSMP *>(data);
+	bt_conn_info info;
+
+	VerifyOrReturn(bt_conn_get_info(conn, &info) == 0 && info.role == BT_CONN_ROLE_PERIPHERAL);
+
+	SavedConnParams &saved = dfu->mSavedConnParams[bt_conn_index(conn)];
+
+	/* Keep the parameters saved before the throughput mode was first applied to the connection */
+	if (!saved.mValid) {
+		saved = { true, info.le.interval, info.le.latency, info.le.timeout };
+	}
+
+	const bt_conn_le_phy_param phyParams = { .options = BT_CONN_LE_PHY_OPT_NONE,
+						 .pref_tx_phy = BT_GAP_LE_PHY_2M,
+						 .pref_rx_phy = BT_GAP_LE_PHY_2M };
+	const bt_conn_le_data_len_param dataLenParams = { .tx_max_len = BT_GAP_DATA_LEN_MAX,
+							  .tx_max_time = BT_GAP_DATA_TIME_MAX };
+	const bt_le_conn_param connParams = { .interval_min = kThroughputConnIntervalMin,
+					      .interval_max = kThroughputConnIntervalMax,
+					      .latency = 0,
+					      .timeout = kThroughputConnTimeout };
+
+	/* The peer may reject any of the requests, in which case the transfer continues with slower settings. */
+	int ret = bt_conn_le_phy_update(conn, &phyParams);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to request 2M PHY: %d", ret);
+	}
+
+	ret = bt_conn_le_data_len_update(conn, &dataLenParams);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to request maximum data length: %d", ret);
+	}
+
+	ret = bt_conn_le_param_update(conn, &connParams);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to request connection parameters update: %d", ret);
+	}
+}
+
+void DFUOverSMP::ExitThroughputMode(bt_conn *conn, void *data)
+{
+	DFUOverSMP *dfu = static_cast<DFUOverSMP *>(data);
+	SavedConnParams &saved = dfu->mSavedConnParams[bt_conn_index(conn)];
+
+	VerifyOrReturn(saved.mValid);
+	saved.mValid = false;
+
+	const bt_conn_le_phy_param phyParams = { .options = BT_CONN_LE_PHY_OPT_NONE,
+						 .pref_tx_phy = BT_GAP_LE_PHY_1M,
+						 .pref_rx_phy = BT_GAP_LE_PHY_1M };
+	const bt_le_conn_param connParams = { .interval_min = saved.mInterval,
+					      .interval_max = saved.mInterval,
+					      .latency = saved.mLatency,
+					      .timeout = saved.mTimeout };
+
+	int ret = bt_conn_le_param_update(conn, &connParams);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to restore connection parameters: %d", ret);
+	}
+
+	ret = bt_conn_le_phy_update(conn, &phyParams);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to restore 1M PHY: %d", ret);
+	}
+}
+
+void DFUOverSMP::SetConnEventExtension(bool enable)
+{
+#ifdef CONFIG_BT_LL_SOFTDEVICE
+	net_buf *buf = bt_hci_cmd_create(SDC_HCI_OPCODE_CMD_VS_CONN_EVENT_EXTEND,
+					 sizeof(sdc_hci_cmd_vs_conn_event_extend_t));
+	VerifyOrReturn(buf != nullptr, ChipLogError(SoftwareUpdate, "Failed to allocate HCI command"));
+
+	auto *params = static_cast<sdc_hci_cmd_vs_conn_event_extend_t *>(
+		net_buf_add(buf, sizeof(sdc_hci_cmd_vs_conn_event_extend_t)));
+	params->enable = enable;
+
+	const int ret = bt_hci_cmd_send_sync(SDC_HCI_OPCODE_CMD_VS_CONN_EVENT_EXTEND, buf, nullptr);
+	if (ret) {
+		ChipLogError(SoftwareUpdate, "Failed to set connection event extension: %d", ret);
+	}
+#endif
+}
+
+void DFUOverSMP::OnDisconnected(bt_conn *conn, uint8_t reason)
+{
+	GetDFUOverSMP().mSavedConnParams[bt_conn_index(conn)].mValid = false;
+}
+#endif
+
 } /* namespace Nrf */
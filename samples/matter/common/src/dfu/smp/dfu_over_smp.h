@@ -8,6 +8,11 @@
 
 #include <platform/Zephyr/BLEAdvertisingArbiter.h>
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/mgmt/mcumgr/mgmt/callbacks.h>
+#endif
+
 #include <array>
 
 namespace Nrf {
@@ -50,6 +55,29 @@ public:
 	void StartServer();
 
 private:
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DFU_OVER_SMP_THROUGHPUT_MODE
+	/* Connection parameters to restore once the DFU is no longer active. */
+	struct SavedConnParams {
+		bool mValid;
+		uint16_t mInterval;
+		uint16_t mLatency;
+		uint16_t mTimeout;
+	};
+
+	static enum mgmt_cb_return DfuStatusHandler(uint32_t event, enum mgmt_cb_return prev_status, int32_t *rc,
+						    uint16_t *group, bool *abort_more, void *data, size_t data_size);
+	static void EnterThroughputMode(bt_conn *conn, void *data);
+	static void ExitThroughputMode(bt_conn *conn, void *data);
+	static void SetConnEventExtension(bool enable);
+	static void OnDisconnected(bt_conn *conn, uint8_t reason);
+
+	void SetThroughputMode(bool enable);
+
+	bool mThroughputModeActive = false;
+	SavedConnParams mSavedConnParams[CONFIG_BT_MAX_CONN] = {};
+	bt_conn_cb mConnCallbacks = {};
+	mgmt_callback mDfuStatusCallback = {};
+#endif
 	bool mIsStarted = false;
 	chip::DeviceLayer::BLEAdvertisingArbiter::Request mAdvertisingRequest = {};
 	std::array<bt_data, 2> mAdvertisingItems;
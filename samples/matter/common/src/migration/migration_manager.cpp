@@ -9,10 +9,114 @@
 #include <crypto/OperationalKeystore.h>
 #include <crypto/PersistentStorageOperationalKeystore.h>
 
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+#include "bridge/bridge_storage_manager.h"
+#endif
+
+namespace
+{
+#ifdef CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS
+constexpr char kOperationalKeysJournalKey[] = "nrf/mig/opk";
+constexpr uint8_t kOperationalKeysLayoutVersion = 1;
+#endif
+
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+Nrf::Matter::Migration::MigrationJournal
+	sBridgedDevicesJournal("nrf/mig/brd", Nrf::BridgeStorageManager::kBridgedDeviceRecordVersion);
+
+CHIP_ERROR LoadBridgedDevicesJournal()
+{
+	if (sBridgedDevicesJournal.IsLoaded()) {
+		return CHIP_NO_ERROR;
+	}
+
+	return sBridgedDevicesJournal.Load(&chip::Server::GetInstance().GetPersistentStorage());
+}
+
+void RemoveLegacyBridgedDevice(uint8_t index)
+{
+	Nrf::BridgeStorageManager &storage = Nrf::BridgeStorageManager::Instance();
+
+	/* Ignore errors, as the leftovers do not affect loading the device. */
+	storage.RemoveBridgedDeviceEndpointId(index);
+	storage.RemoveBridgedDeviceNodeLabel(index);
+	storage.RemoveBridgedDeviceType(index);
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	storage.RemoveBtAddress(index);
+#endif
+}
+#endif
+} /* namespace */
+
 namespace Nrf::Matter
 {
 namespace Migration
 {
+	CHIP_ERROR MigrationJournal::Load(chip::PersistentStorageDelegate *storage)
+	{
+		VerifyOrReturnError(storage, CHIP_ERROR_INVALID_ARGUMENT);
+
+		State state = {};
+		uint16_t size = sizeof(state);
+		CHIP_ERROR err = storage->SyncGetKeyValue(mKey, &state, size);
+
+		if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) {
+			state = {};
+		} else if (err != CHIP_NO_ERROR) {
+			return err;
+		}
+
+		/* Start from scratch if the journal belongs to a migration to a different layout version. */
+		if (err != CHIP_NO_ERROR || size < offsetof(State, mMigrated) || state.mVersion != mVersion) {
+			state = {};
+			state.mVersion = mVersion;
+		}
+
+		mState = state;
+		mStorage = storage;
+
+		return CHIP_NO_ERROR;
+	}
+
+	CHIP_ERROR MigrationJournal::MarkMigrated(uint8_t item)
+	{
+		VerifyOrReturnError(IsLoaded(), CHIP_ERROR_INCORRECT_STATE);
+
+		if (IsMigrated(item)) {
+			return CHIP_NO_ERROR;
+		}
+
+		mState.mMigrated[item / 8] |= BIT(item % 8);
+
+		return Store();
+	}
+
+	CHIP_ERROR MigrationJournal::MarkCompleted()
+	{
+		VerifyOrReturnError(IsLoaded(), CHIP_ERROR_INCORRECT_STATE);
+
+		if (IsCompleted()) {
+			return CHIP_NO_ERROR;
+		}
+
+		mState.mCompleted = 1;
+		memset(mState.mMigrated, 0, sizeof(mState.mMigrated));
+
+		return Store();
+	}
+
+	CHIP_ERROR MigrationJournal::Store()
+	{
+		/* Store only the part of the bitmap which contains the migrated items to keep the journal compact. */
+		size_t size = sizeof(mState);
+
+		while (size > offsetof(State, mMigrated) && reinterpret_cast<const uint8_t *>(&mState)[size - 1] == 0) {
+			size--;
+		}
+
+		return mStorage->SyncSetKeyValue(mKey, &mState, static_cast<uint16_t>(size));
+	}
+
 #ifdef CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS
 	CHIP_ERROR MoveOperationalKeysFromKvsToIts(chip::PersistentStorageDelegate *storage,
 						   chip::Crypto::OperationalKeystore *keystore)
@@ -21,17 +125,28 @@ namespace Migration
 
 		VerifyOrReturnError(keystore && storage, CHIP_ERROR_INVALID_ARGUMENT);
 
+		MigrationJournal journal(kOperationalKeysJournalKey, kOperationalKeysLayoutVersion);
+		err = journal.Load(storage);
+		VerifyOrReturnError(err == CHIP_NO_ERROR, err);
+
 		/* Initialize the obsolete Operational Keystore*/
 		chip::PersistentStorageOperationalKeystore obsoleteKeystore;
 		err = obsoleteKeystore.Init(storage);
 		VerifyOrReturnError(err == CHIP_NO_ERROR, err);
 
-		/* Migrate all obsolete Operational Keys to PSA ITS */
+		/* Migrate all obsolete Operational Keys to PSA ITS, skipping the fabrics migrated on previous boots */
 		for (const chip::FabricInfo &fabric : chip::Server::GetInstance().GetFabricTable()) {
+			if (journal.IsMigrated(fabric.GetFabricIndex())) {
+				continue;
+			}
+
 			err = keystore->MigrateOpKeypairForFabric(fabric.GetFabricIndex(), obsoleteKeystore);
 			if (CHIP_NO_ERROR != err) {
 				break;
 			}
+
+			/* Ignore an error, as the journal only allows to skip the fabric on the next boot. */
+			journal.MarkMigrated(fabric.GetFabricIndex());
 		}
 
 #ifdef CONFIG_NCS_SAMPLE_MATTER_FACTORY_RESET_ON_KEY_MIGRATION_FAILURE
@@ -46,5 +161,69 @@ namespace Migration
 		return err;
 	}
 #endif /* CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS */
+
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+	CHIP_ERROR MoveBridgedDeviceToRecord(uint8_t bridgedDeviceIndex)
+	{
+		Nrf::BridgeStorageManager &storage = Nrf::BridgeStorageManager::Instance();
+		Nrf::BridgeStorageManager::BridgedDeviceRecord record = {};
+		size_t labelLength = 0;
+
+		ReturnErrorOnFailure(LoadBridgedDevicesJournal());
+
+		if (sBridgedDevicesJournal.IsCompleted()) {
+			/* All devices use the record layout, so there is no legacy entry to look for. */
+			return CHIP_ERROR_NOT_FOUND;
+		}
+
+		record.mVersion = Nrf::BridgeStorageManager::kBridgedDeviceRecordVersion;
+
+		if (!storage.LoadBridgedDeviceEndpointId(record.mEndpointId, bridgedDeviceIndex) ||
+		    !storage.LoadBridgedDeviceType(record.mDeviceType, bridgedDeviceIndex)) {
+			return CHIP_ERROR_NOT_FOUND;
+		}
+
+		/* Ignore an error, as node label is optional, so it may not be found. */
+		if (storage.LoadBridgedDeviceNodeLabel(record.mNodeLabel, sizeof(record.mNodeLabel) - 1, labelLength,
+						       bridgedDeviceIndex)) {
+			record.mNodeLabelLength = labelLength;
+		}
+
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+		if (!storage.LoadBtAddress(record.mBtAddress, bridgedDeviceIndex)) {
+			return CHIP_ERROR_NOT_FOUND;
+		}
+#endif
+
+		/* Journal the device before writing the record, so the legacy entries left behind by a power loss are
+		 * removed when the migration is completed. */
+		ReturnErrorOnFailure(sBridgedDevicesJournal.MarkMigrated(bridgedDeviceIndex));
+
+		if (!storage.StoreBridgedDeviceRecord(record, bridgedDeviceIndex)) {
+			return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+		}
+
+		RemoveLegacyBridgedDevice(bridgedDeviceIndex);
+
+		return CHIP_NO_ERROR;
+	}
+
+	CHIP_ERROR CompleteBridgedDevicesMigration()
+	{
+		ReturnErrorOnFailure(LoadBridgedDevicesJournal());
+
+		if (sBridgedDevicesJournal.IsCompleted()) {
+			return CHIP_NO_ERROR;
+		}
+
+		for (size_t i = 0; i < MigrationJournal::kMaxItems; i++) {
+			if (sBridgedDevicesJournal.IsMigrated(static_cast<uint8_t>(i))) {
+				RemoveLegacyBridgedDevice(static_cast<uint8_t>(i));
+			}
+		}
+
+		return sBridgedDevicesJournal.MarkCompleted();
+	}
+#endif /* CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE */
 } /* namespace Migration */
 } /* namespace Nrf::Matter */
@@ -8,14 +8,81 @@
 
 #include <app/server/Server.h>
 
+#include <zephyr/sys/util.h>
+
 namespace Nrf::Matter
 {
 namespace Migration
 {
+	/**
+	 * @brief Journal of a lazy migration of the items kept in the persistent storage.
+	 *
+	 * The journal tracks which items, for example fabrics or bridged devices, have already been migrated to the
+	 * storage layout of the current firmware, so every item can be migrated on its first access instead of all
+	 * of them at boot. An item is marked in the journal before its migrated data is written, which allows
+	 * resuming an interrupted migration after a power loss. Once all items are migrated, the journal is
+	 * shrunk to the completion marker and the legacy data is no longer looked up.
+	 */
+	class MigrationJournal {
+	public:
+		static constexpr size_t kMaxItems = 256;
+
+		/**
+		 * @brief Constructor of the journal.
+		 *
+		 * @param key persistent storage key of the journal
+		 * @param version version of the storage layout that the items are migrated to. The journal stored for
+		 * a different version is discarded.
+		 */
+		MigrationJournal(const char *key, uint8_t version) : mKey(key), mVersion(version) {}
+
+		/**
+		 * @brief Load the journal from the persistent storage. A missing journal means that no item has been
+		 * migrated yet.
+		 *
+		 * @param storage persistent storage to keep the journal in
+		 * @retval CHIP_NO_ERROR if the journal has been loaded or it does not exist yet.
+		 * @retval CHIP_ERROR_INVALID_ARGUMENT when the storage is not defined.
+		 * @retval Other CHIP_ERROR codes related to the persistent storage read.
+		 */
+		CHIP_ERROR Load(chip::PersistentStorageDelegate *storage);
+
+		bool IsLoaded() const { return mStorage != nullptr; }
+		bool IsCompleted() const { return mState.mCompleted != 0; }
+		bool IsMigrated(uint8_t item) const { return mState.mMigrated[item / 8] & BIT(item % 8); }
+
+		/**
+		 * @brief Mark the item as migrated and store the journal.
+		 */
+		CHIP_ERROR MarkMigrated(uint8_t item);
+
+		/**
+		 * @brief Mark the whole migration as completed and store the journal.
+		 */
+		CHIP_ERROR MarkCompleted();
+
+	private:
+		struct State {
+			uint8_t mVersion;
+			uint8_t mCompleted;
+			uint8_t mMigrated[kMaxItems / 8];
+		};
+
+		CHIP_ERROR Store();
+
+		const char *mKey;
+		uint8_t mVersion;
+		chip::PersistentStorageDelegate *mStorage = nullptr;
+		State mState = {};
+	};
+
 #ifdef CONFIG_NCS_SAMPLE_MATTER_OPERATIONAL_KEYS_MIGRATION_TO_ITS
 	/**
 	 * @brief Migrate all stored Operational Keys from the persistent storage (KVS) to secure PSA ITS.
 	 *
+	 * The fabrics whose keys have been migrated are tracked in the migration journal and skipped on the next
+	 * boots.
+	 *
 	 * This function will schedule a factory reset automatically if the
 	 * CONFIG_NCS_SAMPLE_MATTER_FACTORY_RESET_ON_KEY_MIGRATION_FAILURE
 	 * Kconfig option is set to 'y'. In this case, the function returns CHIP_NO_ERROR to not block any further
@@ -33,5 +100,34 @@ namespace Migration
 	CHIP_ERROR MoveOperationalKeysFromKvsToIts(chip::PersistentStorageDelegate *storage,
 						   chip::Crypto::OperationalKeystore *keystore);
 #endif
+
+#ifdef CONFIG_BRIDGE_MIGRATE_LEGACY_STORAGE
+	/**
+	 * @brief Migrate a single bridged device stored using the legacy per-attribute keys to the record layout.
+	 *
+	 * The function is called on the first access to a bridged device whose record is not found, so devices are
+	 * migrated lazily instead of all at boot.
+	 *
+	 * @param bridgedDeviceIndex index describing specific bridged device
+	 * @retval CHIP_NO_ERROR if the device has been migrated properly.
+	 * @retval CHIP_ERROR_NOT_FOUND if the migration has been completed or a mandatory attribute of the legacy
+	 * 		   device entry is missing.
+	 * @retval CHIP_ERROR_PERSISTED_STORAGE_FAILED if the record could not be written.
+	 * @retval Other CHIP_ERROR codes related to the migration journal.
+	 */
+	CHIP_ERROR MoveBridgedDeviceToRecord(uint8_t bridgedDeviceIndex);
+
+	/**
+	 * @brief Mark migration of the bridged devices as completed.
+	 *
+	 * The function should be called once all stored bridged devices have been loaded using the record layout.
+	 * It removes the legacy entries left behind by an interrupted migration of the devices, so the legacy
+	 * layout is never looked up again.
+	 *
+	 * @retval CHIP_NO_ERROR if the migration has been marked as completed.
+	 * @retval Other CHIP_ERROR codes related to the migration journal.
+	 */
+	CHIP_ERROR CompleteBridgedDevicesMigration();
+#endif
 } /* namespace Migration */
 } /* namespace Nrf::Matter */
@@ -61,6 +61,49 @@ int LoadEntryCallback(const char *name, size_t entrySize, settings_read_cb readC
 
 	return 1;
 }
+
+int HasEntryCallback(const char *name, size_t entrySize, settings_read_cb readCb, void *cbArg, void *param)
+{
+	/* Process just the exact match, the value itself is not needed to tell whether the key exists */
+	if (name != nullptr && *name != '\0') {
+		return 0;
+	}
+
+	*static_cast<bool *>(param) = true;
+
+	return 1;
+}
+
+struct LoadAllContext {
+	Nrf::PersistentStorage::LoadAllCallback callback;
+	void *context;
+	bool result;
+};
+
+int LoadSubtreeCallback(const char *name, size_t entrySize, settings_read_cb readCb, void *cbArg, void *param)
+{
+	LoadAllContext &ctx = *static_cast<LoadAllContext *>(param);
+	uint8_t buffer[SETTINGS_MAX_VAL_LEN];
+
+	if (entrySize > sizeof(buffer)) {
+		ctx.result = false;
+		return 0;
+	}
+
+	const ssize_t bytesRead = readCb(cbArg, buffer, entrySize);
+
+	if (bytesRead < 0 || static_cast<size_t>(bytesRead) != entrySize) {
+		ctx.result = false;
+		return 0;
+	}
+
+	/* Skip the entries holding the magic empty value, Load treats them as missing as well */
+	if (entrySize == kEmptyValueSize && memcmp(buffer, kEmptyValue, kEmptyValueSize) == 0) {
+		return 0;
+	}
+
+	return ctx.callback(name ? name : "", buffer, entrySize, ctx.context) ? 0 : 1;
+}
 } /* namespace */
 
 namespace Nrf {
@@ -76,9 +119,9 @@ bool PersistentStorage::Store(PersistentStorageNode *node, const void *data, siz
 		return false;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetFullKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return false;
 	}
 
@@ -91,9 +134,9 @@ bool PersistentStorage::Load(PersistentStorageNode *node, void *data, size_t dat
 		return false;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetFullKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return false;
 	}
 
@@ -114,13 +157,16 @@ bool PersistentStorage::HasEntry(PersistentStorageNode *node)
 		return false;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetFullKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return false;
 	}
 
-	return LoadEntry(key);
+	bool found = false;
+	settings_load_subtree_direct(key, HasEntryCallback, &found);
+
+	return found;
 }
 
 bool PersistentStorage::Remove(PersistentStorageNode *node)
@@ -129,13 +175,16 @@ bool PersistentStorage::Remove(PersistentStorageNode *node)
 		return false;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetFullKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return false;
 	}
 
-	if (!LoadEntry(key)) {
+	bool found = false;
+	settings_load_subtree_direct(key, HasEntryCallback, &found);
+
+	if (!found) {
 		return false;
 	}
 
@@ -144,6 +193,27 @@ bool PersistentStorage::Remove(PersistentStorageNode *node)
 	return true;
 }
 
+bool PersistentStorage::LoadAll(PersistentStorageNode *prefix, LoadAllCallback callback, void *context)
+{
+	if (!prefix || !callback) {
+		return false;
+	}
+
+	const char *key = prefix->GetFullKey();
+
+	if (!key) {
+		return false;
+	}
+
+	LoadAllContext ctx{ callback, context, true };
+
+	if (settings_load_subtree_direct(key, LoadSubtreeCallback, &ctx)) {
+		return false;
+	}
+
+	return ctx.result;
+}
+
 bool PersistentStorage::LoadEntry(const char *key, void *data, size_t dataMaxSize, size_t *outSize)
 {
 	ReadEntry entry{ data, dataMaxSize, 0, false };
@@ -162,31 +232,53 @@ bool PersistentStorage::LoadEntry(const char *key, void *data, size_t dataMaxSiz
 
 bool PersistentStorageNode::GetKey(char *key)
 {
-	if (!key || mKeyName[0] == '\0') {
+	if (!key) {
 		return false;
 	}
 
-	/* Recursively call GetKey method for the parents until the full key name including all hierarchy levels will be
-	 * created. */
+	const char *fullKey = GetFullKey();
+
+	if (!fullKey) {
+		return false;
+	}
+
+	strncpy(key, fullKey, kMaxKeyNameLength);
+
+	return true;
+}
+
+const char *PersistentStorageNode::GetFullKey()
+{
+	if (mFullKey[0] != '\0') {
+		return mFullKey;
+	}
+
+	if (mKeyName[0] == '\0') {
+		return nullptr;
+	}
+
+	/* Walk the parents only once, until the full key name including all hierarchy levels will be created. The
+	 * parents cache their keys as well, so building keys of the sibling nodes does not walk the tree again. */
 	if (mParent != nullptr) {
-		char parentKey[kMaxKeyNameLength];
+		const char *parentKey = mParent->GetFullKey();
 
-		if (!mParent->GetKey(parentKey)) {
-			return false;
+		if (!parentKey) {
+			return nullptr;
 		}
 
-		int result = snprintf(key, kMaxKeyNameLength, "%s/%s", parentKey, mKeyName);
+		int result = snprintf(mFullKey, kMaxKeyNameLength, "%s/%s", parentKey, mKeyName);
 
 		if (result < 0 || result >= kMaxKeyNameLength) {
-			return false;
+			mFullKey[0] = '\0';
+			return nullptr;
 		}
 
 	} else {
 		/* In case of not having a parent, return only own key name. */
-		strncpy(key, mKeyName, kMaxKeyNameLength);
+		strncpy(mFullKey, mKeyName, kMaxKeyNameLength);
 	}
 
-	return true;
+	return mFullKey;
 }
 
 } /* namespace Nrf */
@@ -41,9 +41,21 @@ public:
 	 */
 	bool GetKey(char *key);
 
+	/**
+	 * @brief Gets complete settings key name for this node without copying it.
+	 *
+	 * The key is built by walking the parent nodes only on the first call and cached in the node afterwards, so
+	 * the node names and the tree hierarchy must not change during the node's lifetime.
+	 *
+	 * @return pointer to the null-terminated key owned by the node
+	 * @return nullptr if the key could not be created
+	 */
+	const char *GetFullKey();
+
 private:
 	PersistentStorageNode *mParent = nullptr;
 	char mKeyName[kMaxKeyNameLength] = { 0 };
+	char mFullKey[kMaxKeyNameLength] = { 0 };
 };
 
 /**
@@ -101,6 +113,29 @@ public:
 	 */
 	bool Remove(PersistentStorageNode *node);
 
+	/**
+	 * @brief Callback called for every settings entry found by LoadAll.
+	 *
+	 * @param key key name of the entry relative to the prefix node, empty for the prefix key itself
+	 * @param data entry value
+	 * @param dataSize a size of the entry value
+	 * @param context user context passed to LoadAll
+	 * @return true to continue loading the next entries
+	 * @return false to stop loading
+	 */
+	using LoadAllCallback = bool (*)(const char *key, const void *data, size_t dataSize, void *context);
+
+	/**
+	 * @brief Load all settings entries stored under given node in a single pass over the settings storage
+	 *
+	 * @param prefix address of settings tree node containing information about the subtree to be loaded
+	 * @param callback callback called for every entry found in the subtree
+	 * @param context user context passed to the callback
+	 * @return true if all entries have been loaded successfully
+	 * @return false an error occurred or at least one entry could not be read
+	 */
+	bool LoadAll(PersistentStorageNode *prefix, LoadAllCallback callback, void *context = nullptr);
+
 	static PersistentStorage &Instance()
 	{
 		static PersistentStorage sInstance;
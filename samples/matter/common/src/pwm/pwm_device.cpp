@@ -6,6 +6,12 @@
 
 #include "pwm_device.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+#include "app/task_executor.h"
+
+#include <cmath>
+#endif
+
 #include <lib/support/CodeUtils.h>
 
 #include <zephyr/drivers/pwm.h>
@@ -14,6 +20,12 @@
 
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+namespace {
+constexpr float kTransitionGamma = CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITION_GAMMA / 10.0f;
+} /* namespace */
+#endif
+
 namespace Nrf {
 
 int PWMDevice::Init(const pwm_dt_spec *aPWMDevice, uint8_t aMinLevel, uint8_t aMaxLevel, uint8_t aDefaultLevel)
@@ -24,6 +36,11 @@ int PWMDevice::Init(const pwm_dt_spec *aPWMDevice, uint8_t aMinLevel, uint8_t aM
 	mLevel = aDefaultLevel;
 	mPwmDevice = aPWMDevice;
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+	k_timer_init(&mTransitionTimer, &PWMDevice::TransitionTimerHandler, nullptr);
+	k_timer_user_data_set(&mTransitionTimer, this);
+#endif
+
 	if (!device_is_ready(mPwmDevice->dev)) {
 		LOG_ERR("PWM device %s is not ready", mPwmDevice->dev->name);
 		return -ENODEV;
@@ -67,6 +84,10 @@ bool PWMDevice::InitiateAction(Action_t aAction, int32_t aActor, uint8_t *aValue
 			mActionInitiatedClb(aAction, aActor);
 		}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+		CancelTransition();
+#endif
+
 		if (aAction == ON_ACTION || aAction == OFF_ACTION) {
 			Set(new_state == kState_On);
 		} else if (aAction == LEVEL_ACTION) {
@@ -97,17 +118,109 @@ void PWMDevice::Set(bool aOn)
 
 void PWMDevice::SuppressOutput()
 {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+	CancelTransition();
+	mCurrentPulse = 0;
+#endif
 	pwm_set_pulse_dt(mPwmDevice, 0);
 }
 
 void PWMDevice::ApplyLevel()
+{
+	const uint32_t pulse = GetPulse();
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+	CancelTransition();
+	mCurrentPulse = pulse;
+#endif
+	pwm_set_pulse_dt(mPwmDevice, pulse);
+}
+
+uint32_t PWMDevice::GetPulse() const
 {
 	const uint8_t maxEffectiveLevel = mMaxLevel - mMinLevel;
 	const uint8_t effectiveLevel =
 		mState == kState_On ? chip::min<uint8_t>(mLevel - mMinLevel, maxEffectiveLevel) : 0;
 
-	pwm_set_pulse_dt(mPwmDevice, static_cast<uint32_t>(static_cast<const uint64_t>(mPwmDevice->period) *
-							   effectiveLevel / maxEffectiveLevel));
+	return static_cast<uint32_t>(static_cast<const uint64_t>(mPwmDevice->period) * effectiveLevel /
+				     maxEffectiveLevel);
+}
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+bool PWMDevice::InitiateTransition(uint8_t aLevel, uint32_t aTransitionTimeMs, int32_t aActor)
+{
+	VerifyOrReturnValue(aLevel != mLevel || (mState == kState_On) != (aLevel != 0), false);
+
+	if (mActionInitiatedClb) {
+		mActionInitiatedClb(LEVEL_ACTION, aActor);
+	}
+
+	CancelTransition();
+
+	/* The transition starts from the current pulse width, which may be an intermediate step of a cancelled one */
+	const uint32_t startPulse = mCurrentPulse;
+
+	LOG_INF("Setting brightness level to %u in %u ms", aLevel, aTransitionTimeMs);
+	mState = aLevel == 0 ? kState_Off : kState_On;
+	mLevel = aLevel;
+
+	/* Apply at most one step per millisecond, and always finish at the exact target pulse width. */
+	const uint32_t targetPulse = GetPulse();
+	const size_t steps = chip::max<size_t>(chip::min<size_t>(kMaxTransitionSteps, aTransitionTimeMs), 1);
+
+	/*
+	 * Interpolate linearly in the perceived brightness domain and convert each step back to the pulse width
+	 * domain with the gamma curve, so that the fade looks uniform to the human eye.
+	 */
+	const float period = static_cast<float>(mPwmDevice->period);
+	const float start = powf(startPulse / period, 1.0f / kTransitionGamma);
+	const float target = powf(targetPulse / period, 1.0f / kTransitionGamma);
+
+	for (size_t step = 1; step < steps; step++) {
+		const float brightness = start + (target - start) * step / steps;
+		mTransitionPulses[step - 1] = static_cast<uint32_t>(period * powf(brightness, kTransitionGamma));
+	}
+
+	mTransitionPulses[steps - 1] = targetPulse;
+	mTransitionSteps = steps;
+	mTransitionStepsLeft = steps;
+	mTransitionActor = aActor;
+
+	const k_timeout_t interval = K_MSEC(aTransitionTimeMs / steps);
+	k_timer_start(&mTransitionTimer, interval, interval);
+
+	return true;
+}
+
+void PWMDevice::CancelTransition()
+{
+	k_timer_stop(&mTransitionTimer);
+	mTransitionStepsLeft = 0;
+}
+
+void PWMDevice::TransitionTimerHandler(k_timer *timer)
+{
+	PWMDevice *device = static_cast<PWMDevice *>(k_timer_user_data_get(timer));
+
+	VerifyOrReturn(device->mTransitionStepsLeft != 0);
+
+	device->mCurrentPulse = device->mTransitionPulses[device->mTransitionSteps - device->mTransitionStepsLeft];
+	pwm_set_pulse_dt(device->mPwmDevice, device->mCurrentPulse);
+
+	if (--device->mTransitionStepsLeft != 0) {
+		return;
+	}
+
+	k_timer_stop(timer);
+
+	/* Report the completion once, in the application thread context */
+	const int32_t actor = device->mTransitionActor;
+	PostTask([device, actor] {
+		if (device->mActionCompletedClb) {
+			device->mActionCompletedClb(LEVEL_ACTION, actor);
+		}
+	});
 }
+#endif
 
 } /* namespace Nrf */
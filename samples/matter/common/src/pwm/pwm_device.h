@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/pwm.h>
+#include <zephyr/kernel.h>
 
 namespace Nrf {
 
@@ -39,6 +40,23 @@ public:
 	const device *GetDevice() { return mPwmDevice->dev; }
 	void SuppressOutput();
 	void ApplyLevel();
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+	/**
+	 * @brief Initiate a smooth transition to the given level.
+	 *
+	 * The gamma-corrected pulse widths of all transition steps are computed upfront and applied from
+	 * a timer context, so the transition does not involve the application thread. The action initiated
+	 * callback is called immediately and the action completed callback is called once, from the application
+	 * thread, when the target level has been reached. Any other action cancels an ongoing transition.
+	 *
+	 * @param aLevel the target level
+	 * @param aTransitionTimeMs duration of the transition in milliseconds
+	 * @param aActor actor passed to the callbacks
+	 * @return true if the transition has been initiated, false if the device is already at the given level
+	 */
+	bool InitiateTransition(uint8_t aLevel, uint32_t aTransitionTimeMs, int32_t aActor);
+	bool IsInTransition() const { return mTransitionStepsLeft != 0; }
+#endif
 
 private:
 	State_t mState;
@@ -53,6 +71,21 @@ private:
 
 	void Set(bool aOn);
 	void SetLevel(uint8_t aLevel);
+	uint32_t GetPulse() const;
+
+#ifdef CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITIONS
+	static constexpr size_t kMaxTransitionSteps = CONFIG_NCS_SAMPLE_MATTER_PWM_DEVICE_TRANSITION_STEPS;
+
+	uint32_t mTransitionPulses[kMaxTransitionSteps];
+	size_t mTransitionSteps = 0;
+	volatile size_t mTransitionStepsLeft = 0;
+	volatile uint32_t mCurrentPulse = 0;
+	int32_t mTransitionActor;
+	k_timer mTransitionTimer;
+
+	void CancelTransition();
+	static void TransitionTimerHandler(k_timer *timer);
+#endif
 };
 
 } /* namespace Nrf */
@@ -33,8 +33,7 @@ void LightSwitch::Init(chip::EndpointId lightSwitchEndpoint)
 
 void LightSwitch::InitiateActionSwitch(Action action)
 {
-	Nrf::Matter::BindingHandler::BindingData *data =
-		Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+	Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 	if (data) {
 		data->EndpointId = mLightSwitchEndpoint;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -50,7 +49,7 @@ void LightSwitch::InitiateActionSwitch(Action action)
 			data->CommandId = Clusters::OnOff::Commands::Off::Id;
 			break;
 		default:
-			Platform::Delete(data);
+			Nrf::Matter::BindingHandler::FreeBindingData(data);
 			return;
 		}
 		Nrf::Matter::BindingHandler::RunBoundClusterAction(data);
@@ -60,8 +59,7 @@ void LightSwitch::InitiateActionSwitch(Action action)
 void LightSwitch::DimmerChangeBrightness()
 {
 	static uint16_t sBrightness;
-	Nrf::Matter::BindingHandler::BindingData *data =
-		Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+	Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 	if (data) {
 		data->EndpointId = mLightSwitchEndpoint;
 		data->CommandId = Clusters::LevelControl::Commands::MoveToLevel::Id;
@@ -65,8 +65,7 @@ namespace Unicast
 
 	static CHIP_ERROR OnCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::On::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -79,8 +78,7 @@ namespace Unicast
 
 	static CHIP_ERROR OffCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::Off::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -93,8 +91,7 @@ namespace Unicast
 
 	static CHIP_ERROR ToggleCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::Toggle::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -140,8 +137,7 @@ namespace Group
 
 	CHIP_ERROR OnCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::On::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -154,8 +150,7 @@ namespace Group
 
 	CHIP_ERROR OffCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::Off::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -168,8 +163,7 @@ namespace Group
 
 	CHIP_ERROR ToggleCommandHandler(int argc, char **argv)
 	{
-		Nrf::Matter::BindingHandler::BindingData *data =
-			Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+		Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 		data->EndpointId = LightSwitch::GetInstance().GetLightSwitchEndpointId();
 		data->CommandId = Clusters::OnOff::Commands::Toggle::Id;
 		data->ClusterId = Clusters::OnOff::Id;
@@ -9,6 +9,10 @@
 
 #include "app_task.h"
 
+#include <crypto/CHIPCryptoPAL.h>
+
+#include <zephyr/random/random.h>
+
 using namespace chip;
 
 BoltLockManager BoltLockManager::sLock;
@@ -20,6 +24,9 @@ void BoltLockManager::Init(StateChangeCallback callback)
 	k_timer_init(&mActuatorTimer, &BoltLockManager::ActuatorTimerEventHandler, nullptr);
 	k_timer_user_data_set(&mActuatorTimer, this);
 
+	/* Randomize the PIN hashes, so that the layout of the PIN index does not depend only on the PIN codes. */
+	mPinHashSeed = sys_rand32_get();
+
 	/* Set the default state */
 	Nrf::GetBoard().GetLED(Nrf::DeviceLeds::LED2).Set(IsLocked());
 }
@@ -90,6 +97,11 @@ bool BoltLockManager::SetCredential(uint16_t credentialIndex, FabricIndex creato
 	CredentialData &credentialData = mCredentialData[credentialIndex - 1];
 	auto &credential = mCredentials[credentialIndex - 1];
 
+	/* The index entry is looked up by the hash of the current secret, so remove it before the secret is replaced. */
+	if (IsIndexedPin(credential)) {
+		RemovePinFromIndex(credentialIndex);
+	}
+
 	if (!secret.empty()) {
 		memcpy(credentialData.mSecret.Alloc(secret.size()).Get(), secret.data(), secret.size());
 	}
@@ -102,6 +114,10 @@ bool BoltLockManager::SetCredential(uint16_t credentialIndex, FabricIndex creato
 	credential.modificationSource = DlAssetSource::kMatterIM;
 	credential.lastModifiedBy = modifier;
 
+	if (IsIndexedPin(credential)) {
+		AddPinToIndex(credentialIndex);
+	}
+
 	ChipLogProgress(Zcl, "Setting lock credential %u: %s", static_cast<unsigned>(credentialIndex),
 			credential.status == DlCredentialStatus::kAvailable ? "available" : "occupied");
 
@@ -115,14 +131,23 @@ bool BoltLockManager::ValidatePIN(const Optional<ByteSpan> &pinCode, OperationEr
 		return true;
 	}
 
-	/* Check the PIN code */
-	for (const auto &credential : mCredentials) {
-		if (credential.status == DlCredentialStatus::kAvailable ||
-		    credential.credentialType != CredentialTypeEnum::kPin) {
+	/*
+	 * Check the PIN code. Only the credentials with a matching hash are compared, in constant time, so the
+	 * validation time does not grow with the number of credentials.
+	 */
+	const ByteSpan &pin = pinCode.Value();
+	const uint32_t hash = HashPin(pin);
+	constexpr size_t kMask = kPinIndexSize - 1;
+
+	for (size_t i = hash & kMask; mPinIndex[i].mCredentialIndex != 0; i = (i + 1) & kMask) {
+		if (mPinIndex[i].mHash != hash) {
 			continue;
 		}
 
-		if (credential.credentialData.data_equal(pinCode.Value())) {
+		const ByteSpan &secret = mCredentials[mPinIndex[i].mCredentialIndex - 1].credentialData;
+
+		if (secret.size() == pin.size() &&
+		    Crypto::IsBufferContentEqualConstantTime(secret.data(), pin.data(), pin.size())) {
 			ChipLogDetail(Zcl, "Valid lock PIN code provided");
 			return true;
 		}
@@ -134,6 +159,67 @@ bool BoltLockManager::ValidatePIN(const Optional<ByteSpan> &pinCode, OperationEr
 	return false;
 }
 
+uint32_t BoltLockManager::HashPin(const ByteSpan &pin) const
+{
+	/* FNV-1a hash with the seed mixed into the offset basis */
+	uint32_t hash = 2166136261u ^ mPinHashSeed;
+
+	for (uint8_t byte : pin) {
+		hash = (hash ^ byte) * 16777619u;
+	}
+
+	return hash;
+}
+
+bool BoltLockManager::IsIndexedPin(const EmberAfPluginDoorLockCredentialInfo &credential) const
+{
+	return credential.status != DlCredentialStatus::kAvailable &&
+	       credential.credentialType == CredentialTypeEnum::kPin && !credential.credentialData.empty();
+}
+
+void BoltLockManager::AddPinToIndex(uint16_t credentialIndex)
+{
+	const uint32_t hash = HashPin(mCredentials[credentialIndex - 1].credentialData);
+	size_t i = hash & (kPinIndexSize - 1);
+
+	/* The table holds at least twice as many entries as there are credentials, so a free entry always exists. */
+	while (mPinIndex[i].mCredentialIndex != 0) {
+		i = (i + 1) & (kPinIndexSize - 1);
+	}
+
+	mPinIndex[i] = { hash, credentialIndex };
+}
+
+void BoltLockManager::RemovePinFromIndex(uint16_t credentialIndex)
+{
+	const uint32_t hash = HashPin(mCredentials[credentialIndex - 1].credentialData);
+	size_t i = hash & (kPinIndexSize - 1);
+
+	while (mPinIndex[i].mCredentialIndex != credentialIndex) {
+		VerifyOrReturn(mPinIndex[i].mCredentialIndex != 0);
+		i = (i + 1) & (kPinIndexSize - 1);
+	}
+
+	/*
+	 * Remove the entry and shift back the following entries of the probe sequence that would become unreachable,
+	 * so that no tombstones are needed and lookups stop at the first empty entry.
+	 */
+	for (size_t next = (i + 1) & (kPinIndexSize - 1); mPinIndex[next].mCredentialIndex != 0;
+	     next = (next + 1) & (kPinIndexSize - 1)) {
+		const size_t home = mPinIndex[next].mHash & (kPinIndexSize - 1);
+
+		/* Keep the entry in place if its home position lies cyclically in (i, next]. */
+		if (((next - home) & (kPinIndexSize - 1)) < ((next - i) & (kPinIndexSize - 1))) {
+			continue;
+		}
+
+		mPinIndex[i] = mPinIndex[next];
+		i = next;
+	}
+
+	mPinIndex[i] = {};
+}
+
 void BoltLockManager::Lock(OperationSource source)
 {
 	VerifyOrReturn(mState != State::kLockingCompleted);
@@ -67,6 +67,35 @@ private:
 
 	void SetState(State state, OperationSource source);
 
+	/*
+	 * Index of PIN credentials used to validate a PIN code without comparing it against every stored credential.
+	 * It is an open addressing hash table with linear probing that maps a hash of the PIN code to the credential
+	 * slot. The table is kept at most half full, so probe sequences stay short regardless of the number of
+	 * credentials.
+	 */
+	struct PinIndexEntry {
+		uint32_t mHash;
+		uint16_t mCredentialIndex; /* 1-based credential index, 0 for an empty entry. */
+	};
+
+	static constexpr size_t RoundUpToPowerOfTwo(size_t value)
+	{
+		size_t result = 1;
+
+		while (result < value) {
+			result <<= 1;
+		}
+
+		return result;
+	}
+
+	static constexpr size_t kPinIndexSize = RoundUpToPowerOfTwo(2 * CONFIG_LOCK_NUM_CREDENTIALS);
+
+	uint32_t HashPin(const chip::ByteSpan &pin) const;
+	void AddPinToIndex(uint16_t credentialIndex);
+	void RemovePinFromIndex(uint16_t credentialIndex);
+	bool IsIndexedPin(const EmberAfPluginDoorLockCredentialInfo &credential) const;
+
 	static void ActuatorTimerEventHandler(k_timer *timer);
 	static void ActuatorAppEventHandler(const BoltLockManagerEvent &event);
 	friend BoltLockManager &BoltLockMgr();
@@ -82,6 +111,9 @@ private:
 	CredentialData mCredentialData[CONFIG_LOCK_NUM_CREDENTIALS];
 	EmberAfPluginDoorLockCredentialInfo mCredentials[CONFIG_LOCK_NUM_CREDENTIALS] = {};
 
+	PinIndexEntry mPinIndex[kPinIndexSize] = {};
+	uint32_t mPinHashSeed = 0;
+
 	static BoltLockManager sLock;
 };
 
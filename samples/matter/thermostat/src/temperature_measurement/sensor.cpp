@@ -84,7 +84,7 @@ void TemperatureSensor::InternalMeasurement()
 
 void TemperatureSensor::ExternalMeasurement()
 {
-	Nrf::Matter::BindingHandler::BindingData *data = Platform::New<Nrf::Matter::BindingHandler::BindingData>();
+	Nrf::Matter::BindingHandler::BindingData *data = Nrf::Matter::BindingHandler::AllocBindingData();
 	data->ClusterId = Clusters::TemperatureMeasurement::Id;
 	data->EndpointId = mTemperatureMeasurementEndpointId;
 	data->InvokeCommandFunc = ExternalTemperatureMeasurementReadHandler;
@@ -20,17 +20,25 @@ The CBOR header currently complies with the following format:
     ]
 }
 
+When created with the --sha256 option, each image entry also contains
+the SHA-256 digest of the image as a byte string:
+{"id": 0, "size": 102400, "sha": h'...'}
+
 Usage examples:
 
 Creating DFU Multi Image package:
 ./dfu_multi_image_tool.py create --image 0 app_update.bin --image 1 net_core_app_update.bin dfu_multi_image.bin
 
+Creating DFU Multi Image package with image digests:
+./dfu_multi_image_tool.py create --sha256 --image 0 app_update.bin --image 1 net_core_app_update.bin dfu_multi_image.bin
+
 Showing DFU Multi Image package header:
 ./dfu_multi_image_tool.py show dfu_multi_image.bin
 """
 
 import argparse
 import cbor2
+import hashlib
 import struct
 import os
 
@@ -39,12 +47,36 @@ import os
 READ_BUFFER_SIZE = 16 * 1024
 
 
-def generate_header(image: list) -> bytes:
+def file_digest(path: str) -> bytes:
+    """
+    Compute SHA-256 digest of a file
+    """
+
+    digest = hashlib.sha256()
+
+    with open(path, 'rb') as file:
+        while True:
+            chunk = file.read(READ_BUFFER_SIZE)
+            if not chunk:
+                break
+            digest.update(chunk)
+
+    return digest.digest()
+
+
+def generate_header(image: list, sha256: bool) -> bytes:
     """
     Generate DFU Multi Image package header
     """
 
-    image_data = [{'id': int(id), 'size': os.path.getsize(path)} for id, path in image]
+    image_data = []
+
+    for id, path in image:
+        image_info = {'id': int(id), 'size': os.path.getsize(path)}
+        if sha256:
+            image_info['sha'] = file_digest(path)
+        image_data.append(image_info)
+
     header_data = {'img': image_data}
     header_cbor = cbor2.dumps(header_data)
 
@@ -63,13 +95,13 @@ def parse_header(file: object) -> object:
     return cbor2.loads(header_cbor)
 
 
-def generate_image(images: list, output_file: str) -> None:
+def generate_image(images: list, output_file: str, sha256: bool) -> None:
     """
     Generate DFU Multi Image package
     """
 
     with open(output_file, 'wb') as out_file:
-        out_file.write(generate_header(images))
+        out_file.write(generate_header(images, sha256))
 
         for _, path in images:
             with open(path, 'rb') as file:
@@ -92,6 +124,8 @@ def show_header(input_file: str) -> None:
         for image in header['img']:
             print(f'- Id: {image["id"]}')
             print(f'  Size: {image["size"]}')
+            if 'sha' in image:
+                print(f'  SHA-256: {image["sha"].hex()}')
 
 
 def main():
@@ -106,6 +140,9 @@ def main():
         '-i', '--image',
         required=True, action='append', nargs=2, metavar=('id', 'path'),
         help='Image to be included in package')
+    create_parser.add_argument(
+        '--sha256', action='store_true',
+        help='Include SHA-256 digest of each image in package header')
     create_parser.add_argument(
         'output_file', help='Path to output package file')
 
@@ -117,7 +154,7 @@ def main():
     args = parser.parse_args()
 
     if args.subcommand == 'create':
-        generate_image(args.image, args.output_file)
+        generate_image(args.image, args.output_file, args.sha256)
     elif args.subcommand == 'show':
         show_header(args.input_file)
     else:
@@ -118,7 +118,7 @@ class NrfHidTransport():
 
     @staticmethod
     def exchange_feature_report(dev, recipient, event_id, status, event_data,
-                                poll_interval=POLL_INTERVAL_DEFAULT):
+                                poll_interval=POLL_INTERVAL_DEFAULT, wait_rsp=True):
         data = NrfHidTransport._create_feature_report(recipient, event_id, status, event_data)
 
         try:
@@ -127,6 +127,10 @@ class NrfHidTransport():
             logging.debug('Send feature report problem: {}'.format(e))
             return False, None
 
+        if not wait_rsp:
+            # Request is pipelined, the response is fetched after the last request in window
+            return True, None
+
         for _ in range(POLL_RETRY_COUNT):
             time.sleep(poll_interval)
 
@@ -447,7 +451,8 @@ class NrfHidDevice():
 
         return peers, peers_cache
 
-    def _config_operation(self, module_name, option_name, is_get, value, poll_interval):
+    def _config_operation(self, module_name, option_name, is_get, value, poll_interval,
+                          wait_rsp=True):
         if not self.initialized():
             print("Device not found")
 
@@ -473,7 +478,8 @@ class NrfHidDevice():
         success, fetched_data = NrfHidTransport.exchange_feature_report(self.dev_ptr,
                                                                         self.recipient,
                                                                         event_id, status,
-                                                                        value, poll_interval)
+                                                                        value, poll_interval,
+                                                                        wait_rsp)
         if is_get:
             return success, fetched_data
         else:
@@ -511,8 +517,10 @@ class NrfHidDevice():
     def config_get(self, module_name, option_name, poll_interval=POLL_INTERVAL_DEFAULT):
         return self._config_operation(module_name, option_name, True, None, poll_interval)
 
-    def config_set(self, module_name, option_name, value, poll_interval=POLL_INTERVAL_DEFAULT):
-        return self._config_operation(module_name, option_name, False, value, poll_interval)
+    def config_set(self, module_name, option_name, value, poll_interval=POLL_INTERVAL_DEFAULT,
+                   wait_rsp=True):
+        return self._config_operation(module_name, option_name, False, value, poll_interval,
+                                      wait_rsp)
 
     def get_complete_module_name(self, name):
         """complete module name consist of module name + '/' + variant name."""
@@ -92,7 +92,7 @@ def perform_dfu(dev, args):
             print('Improper user input. Operation terminated.')
             return
 
-    success = dfu_transfer(dev, img_file_bin, progress_bar)
+    success = dfu_transfer(dev, img_file_bin, progress_bar, args.window)
 
     if success:
         success = fwreboot(dev)
@@ -208,6 +208,10 @@ def parse_arguments():
     parser_dfu.add_argument('--autoconfirm',
                             help='Automatically confirm user input',
                             action='store_true')
+    parser_dfu.add_argument('--window', type=int, default=1,
+                            help='Number of image data requests sent before '
+                                 'fetching the response. Must not exceed '
+                                 'CONFIG_DESKTOP_CONFIG_CHANNEL_SET_WINDOW of the device')
 
     sp_commands.add_parser('fwinfo', help='Obtain information about FW image')
     sp_commands.add_parser('devinfo', help='Obtain identification information about device')
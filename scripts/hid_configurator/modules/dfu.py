@@ -547,7 +547,7 @@ def dfu_sync_wait_until_inactive(dev):
     return dfu_info
 
 
-def dfu_transfer(dev, dfu_image, progress_callback):
+def dfu_transfer(dev, dfu_image, progress_callback, window=1):
     img_length = os.stat(dfu_image).st_size
     img_csum = file_crc(dfu_image)
     if not img_csum:
@@ -574,7 +574,7 @@ def dfu_transfer(dev, dfu_image, progress_callback):
     img_file.seek(offset)
 
     try:
-        success, offset = send_chunks(dev, img_csum, img_file, img_length, offset, dfu_info.get_sync_buffer_size(), progress_callback)
+        success, offset = send_chunks(dev, img_csum, img_file, img_length, offset, dfu_info.get_sync_buffer_size(), progress_callback, window)
     except Exception:
         success = False
 
@@ -599,7 +599,7 @@ def dfu_transfer(dev, dfu_image, progress_callback):
     return success
 
 
-def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, progress_callback):
+def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, progress_callback, window=1):
     def dfu_checkpoint(img_csum, img_length, offset):
         # Sync DFU state at regular intervals to ensure everything
         # is all right.
@@ -631,6 +631,10 @@ def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, p
     next_checkpoint = offset + sync_buffer_size
     if next_checkpoint > img_length: next_checkpoint = img_length
 
+    # Number of data requests sent without fetching the response.
+    # Device accepts up to window requests before the response must be fetched.
+    in_flight = 0
+
     while offset < img_length:
         # Set current progress
         progress_callback(int(offset / img_length * 1000))
@@ -648,7 +652,10 @@ def send_chunks(dev, img_csum, img_file, img_length, offset, sync_buffer_size, p
         logging.debug('Send DFU request: offset {}, size {}'.format(offset, chunk_len))
         dfu_module_name = dev.get_complete_module_name('dfu')
         if dfu_module_name:
-            success = dev.config_set(dfu_module_name , 'data', chunk_data)
+            in_flight += 1
+            wait_rsp = (in_flight >= window) or (offset + chunk_len >= next_checkpoint)
+            success = dev.config_set(dfu_module_name , 'data', chunk_data, wait_rsp=wait_rsp)
+            if wait_rsp: in_flight = 0
         else:
             print('Module DFU not found')
             return False, offset
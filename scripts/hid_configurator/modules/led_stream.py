@@ -11,6 +11,10 @@ from NrfHidDevice import EVENT_DATA_LEN_MAX
 LED_STREAM_DATA = 0x0
 MS_PER_SEC = 1000
 
+STEP_FMT = 'BBBHH'
+# Bulk transfer data consists of LED ID followed by a sequence of steps.
+BULK_STEPS_MAX = (EVENT_DATA_LEN_MAX - struct.calcsize('<B')) // struct.calcsize('<' + STEP_FMT)
+
 
 class Step:
     def __init__(self, r, g, b, substep_count, substep_time):
@@ -50,6 +54,29 @@ def led_send_single_step(dev, step, led_id):
     return success
 
 
+def led_send_steps(dev, steps, led_id):
+    assert len(steps) <= BULK_STEPS_MAX
+
+    event_data = struct.pack('<B', led_id)
+    for step in steps:
+        event_data += struct.pack('<' + STEP_FMT, step.r, step.g, step.b,
+                                  step.substep_count, step.substep_time)
+
+    success = dev.config_set('led_stream', 'set_led_effects', event_data,
+                             poll_interval=0.001)
+
+    return success
+
+
+def bulk_transfer_supported(dev):
+    config = dev.get_device_config()
+
+    if config is None:
+        return False
+
+    return 'set_led_effects' in config.get('led_stream', [])
+
+
 def fetch_free_steps_buffer_info(dev, led_id):
     success, fetched_data = dev.config_get('led_stream', 'get_leds_state',
                                            poll_interval=0.001)
@@ -92,6 +119,8 @@ def send_continuous_led_stream(dev, led_id, freq, substep_cnt = 10):
             substep_time =  MS_PER_SEC // (freq * substep_cnt)
         )
 
+        bulk = bulk_transfer_supported(dev)
+
         print('LED stream started, press Ctrl+C to interrupt')
         while True:
             success, (ready, free) = fetch_free_steps_buffer_info(dev, led_id)
@@ -105,14 +134,25 @@ def send_continuous_led_stream(dev, led_id, freq, substep_cnt = 10):
 
             while free > 0:
                 # Send steps with random color and predefined duration
-                step.generate_random_color()
+                if bulk:
+                    steps = []
+                    for i in range(min(free, BULK_STEPS_MAX)):
+                        step.generate_random_color()
+                        steps.append(Step(step.r, step.g, step.b,
+                                          step.substep_count, step.substep_time))
+
+                    success = led_send_steps(dev, steps, led_id)
+                    sent = len(steps)
+                else:
+                    step.generate_random_color()
 
-                success = led_send_single_step(dev, step, led_id)
+                    success = led_send_single_step(dev, step, led_id)
+                    sent = 1
 
                 if not success:
                     break
 
-                free -= 1
+                free -= sent
     except Exception as e:
         print(e)
     except KeyboardInterrupt as e:
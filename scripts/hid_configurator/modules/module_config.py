@@ -37,6 +37,11 @@ BLE_QOS_OPTIONS = {
     'wifi_active_threshold':  ConfigOption((1,      65535), 'param_wifi',   'Threshold relative to average rating for considering a wifi active(blockable) [Fixed point with 1/100 scaling]', int),
     'channel_map':            ConfigOption(('0',      '0x1FFFFFFFFF'), 'chmap', '5-byte BLE channel map bitmask', str),
     'wifi_blacklist':         ConfigOption(('0',      '1,2,...,11'), 'blacklist', 'List of blacklisted wifi channels', str),
+    'crc_worst_channel':      ConfigOption((0,      36),    'crc_stats',    'BLE channel with the highest CRC error ratio', int),
+    'crc_worst_error':        ConfigOption((0,      100),   'crc_stats',    'Highest averaged CRC error ratio of a BLE channel [%]', int),
+    'crc_avg_error':          ConfigOption((0,      100),   'crc_stats',    'Averaged CRC error ratio of all BLE channels [%]', int),
+    'burst_updates':          ConfigOption((0,      65535), 'crc_stats',    'Number of channel map updates triggered by interference bursts', int),
+    'chmap_updates':          ConfigOption((0,      65535), 'crc_stats',    'Number of channel map updates', int),
 }
 
 # Formatting details for QoS, which uses a struct containing multiple configuration values:
@@ -46,6 +51,7 @@ BLE_QOS_OPTIONS_FORMAT = {
     'chmap': ('<5s', ['channel_map'], lambda x: '0x{:02X}{:02X}{:02X}{:02X}{:02X}'.format(x[4],x[3],x[2],x[1],x[0]), None),
     'param_ble': ('<HBhhHBHHH', ['sample_count_min', 'min_channel_count', 'weight_crc_ok', 'weight_crc_error', 'ble_block_threshold', 'eval_max_count', 'eval_duration', 'eval_keepout_duration', 'eval_success_threshold'], None, None),
     'param_wifi' : ('<hhh', ['wifi_rating_inc', 'wifi_present_threshold', 'wifi_active_threshold'], None, None),
+    'crc_stats' : ('<BBBHH', ['crc_worst_channel', 'crc_worst_error', 'crc_avg_error', 'burst_updates', 'chmap_updates'], None, None),
 }
 
 BLE_BOND_OPTIONS = {
@@ -12,6 +12,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
+#include "app_event_manager_latency.h"
+
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
@@ -23,6 +25,22 @@ static K_WORK_DEFINE(event_processor, event_processor_fn);
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)
+static void event_processor_high_fn(struct k_work *work);
+
+static K_WORK_DEFINE(event_processor_high, event_processor_high_fn);
+static sys_slist_t eventq_high = SYS_SLIST_STATIC_INIT(&eventq_high);
+#else
+/* Never used, defined to avoid conditional compilation in the event processor. */
+static sys_slist_t eventq_high;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD)
+static K_THREAD_STACK_DEFINE(high_prio_work_q_stack,
+			     CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD_STACK_SIZE);
+static struct k_work_q high_prio_work_q;
+#endif
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -132,76 +150,283 @@ void * __weak app_event_manager_alloc(size_t size)
 	return event;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static bool event_pool_owns(const struct app_event_pool *pool, const void *addr)
+{
+	const char *mem = addr;
+
+	return (pool != NULL) && (mem >= pool->buffer) &&
+	       (mem < pool->buffer + pool->block_size * pool->num_blocks);
+}
+
+static void event_pool_update_max_used(const struct app_event_pool *pool)
+{
+	atomic_val_t used = k_mem_slab_num_used_get(&pool->data->slab);
+	atomic_val_t max_used = atomic_get(&pool->data->max_used);
+
+	while ((used > max_used) && !atomic_cas(&pool->data->max_used, max_used, used)) {
+		max_used = atomic_get(&pool->data->max_used);
+	}
+}
+
+void *_app_event_manager_alloc_event(const struct event_type *et, size_t size)
+{
+	const struct app_event_pool *pool = et->pool;
+	void *event;
+
+	if (pool == NULL) {
+		return app_event_manager_alloc(size);
+	}
+
+	__ASSERT_NO_MSG(size <= pool->block_size);
+
+	if (!k_mem_slab_alloc(&pool->data->slab, &event, K_NO_WAIT)) {
+		event_pool_update_max_used(pool);
+		return event;
+	}
+
+	atomic_inc(&pool->data->fallbacks);
+
+	return app_event_manager_alloc(size);
+}
+
+static bool event_pool_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+
+	if ((aeh == NULL) ||
+	    (aeh->type_id < _event_type_list_start) ||
+	    (aeh->type_id >= _event_type_list_end)) {
+		return false;
+	}
+
+	const struct app_event_pool *pool = aeh->type_id->pool;
+
+	if (!event_pool_owns(pool, addr)) {
+		return false;
+	}
+
+	k_mem_slab_free(&pool->data->slab, addr);
+
+	return true;
+}
+
+int app_event_manager_pool_stats_get(const struct event_type *et,
+				     struct app_event_pool_stats *stats)
+{
+	const struct app_event_pool *pool = et->pool;
+
+	if (pool == NULL) {
+		return -ENOENT;
+	}
+
+	stats->num_blocks = pool->num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(&pool->data->slab);
+	stats->max_used = atomic_get(&pool->data->max_used);
+	stats->num_fallbacks = atomic_get(&pool->data->fallbacks);
+
+	return 0;
+}
+
+void app_event_manager_pool_stats_reset(const struct event_type *et)
+{
+	const struct app_event_pool *pool = et->pool;
+
+	if (pool == NULL) {
+		return;
+	}
+
+	atomic_set(&pool->data->max_used, k_mem_slab_num_used_get(&pool->data->slab));
+	atomic_clear(&pool->data->fallbacks);
+}
+
+static int event_pools_init(void)
+{
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		const struct app_event_pool *pool = et->pool;
+
+		if (pool == NULL) {
+			continue;
+		}
+
+		int err = k_mem_slab_init(&pool->data->slab, pool->buffer,
+					  pool->block_size, pool->num_blocks);
+
+		if (err) {
+			LOG_ERR("Cannot initialize %s pool (err: %d)", et->name, err);
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+SYS_INIT(event_pools_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static bool event_pool_free(void *addr)
+{
+	return false;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
 void __weak app_event_manager_free(void *addr)
 {
+	if (event_pool_free(addr)) {
+		return;
+	}
+
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+static void event_free(struct app_event_header *aeh)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	/* Pooled events are always returned to their pool, even if the free function
+	 * is overridden by the application.
+	 */
+	if (event_pool_free(aeh)) {
+		return;
+	}
+
+	app_event_manager_free(aeh);
+}
 
+static bool eventq_take(sys_slist_t *queue, sys_slist_t *events)
+{
 	/* Make current event list local. */
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	if (sys_slist_is_empty(&eventq)) {
+	if (sys_slist_is_empty(queue)) {
 		k_spin_unlock(&lock, key);
-		return;
+		return false;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	sys_slist_merge_slist(events, queue);
 
 	k_spin_unlock(&lock, key);
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+	return true;
+}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
 
-		const struct event_type *et = aeh->type_id;
+	const struct event_type *et = aeh->type_id;
+	uint32_t process_start = latency_now();
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	latency_dispatch_record(aeh, process_start);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
 
-		log_event(aeh);
+	log_event(aeh);
 
-		bool consumed = false;
+	bool consumed = false;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
 
-			__ASSERT_NO_MSG(es != NULL);
+		__ASSERT_NO_MSG(es != NULL);
 
-			const struct event_listener *el = es->listener;
+		const struct event_listener *el = es->listener;
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		__ASSERT_NO_MSG(el != NULL);
 
-			log_event_progress(et, el);
+		bool (*notification)(const struct app_event_header *aeh) =
+			(es->notification != NULL) ? es->notification : el->notification;
 
-			consumed = el->notification(aeh);
+		__ASSERT_NO_MSG(notification != NULL);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+		log_event_progress(et, el);
+
+		uint32_t notification_start = latency_now();
+
+		consumed = notification(aeh);
+		latency_listener_record(el, notification_start);
+
+		if (consumed) {
+			log_event_consumed(et);
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
+
+	latency_processing_record(et, process_start);
+	event_free(aeh);
+}
+
+static void eventq_process(sys_slist_t *queue, bool high_prio_first)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
 
-		app_event_manager_free(aeh);
+	if (!eventq_take(queue, &events)) {
+		return;
 	}
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		if (high_prio_first) {
+			eventq_process(&eventq_high, false);
+		}
+
+		event_process(aeh);
+	}
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	/* If high priority events share the thread with other events, they are processed
+	 * before every event of normal priority. This limits delay of a high priority event
+	 * to processing of a single event.
+	 */
+	eventq_process(&eventq, IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES) &&
+				!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD));
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)
+static void event_processor_high_fn(struct k_work *work)
+{
+	eventq_process(&eventq_high, false);
+}
+
+static bool is_high_prio_event(const struct event_type *et)
+{
+	return app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY);
+}
+#else
+static bool is_high_prio_event(const struct event_type *et)
+{
+	return false;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES */
+
+static void event_processor_submit(bool high_prio)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)
+	if (high_prio) {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD)
+		k_work_submit_to_queue(&high_prio_work_q, &event_processor_high);
+#else
+		k_work_submit(&event_processor_high);
+#endif
+		return;
+	}
+#endif
+
+	k_work_submit(&event_processor);
 }
 
 void _event_submit(struct app_event_header *aeh)
@@ -209,6 +434,10 @@ void _event_submit(struct app_event_header *aeh)
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	bool high_prio = is_high_prio_event(aeh->type_id);
+
+	latency_submit_mark(aeh);
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
@@ -216,12 +445,29 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(high_prio ? &eventq_high : &eventq, &aeh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	event_processor_submit(high_prio);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD)
+static int high_prio_work_q_init(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "app_event_manager_high_prio",
+	};
+
+	k_work_queue_start(&high_prio_work_q, high_prio_work_q_stack,
+			   K_THREAD_STACK_SIZEOF(high_prio_work_q_stack),
+			   CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD_PRIORITY, &cfg);
+
+	return 0;
 }
 
+SYS_INIT(high_prio_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD */
+
 int app_event_manager_init(void)
 {
 	int ret = 0;
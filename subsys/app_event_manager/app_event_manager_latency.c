@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <app_event_manager.h>
+
+#include "app_event_manager_latency.h"
+
+#define HIST_BUCKETS CONFIG_APP_EVENT_MANAGER_LATENCY_STATS_BUCKETS
+
+/* Histograms of the submit to dispatch and processing latency, one per event type. */
+static struct app_event_latency_hist dispatch_hist[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct app_event_latency_hist processing_hist[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct k_spinlock lock;
+
+static size_t hist_bucket(uint32_t us)
+{
+	/* Index of the most significant bit set plus one, 0 for 0. */
+	size_t idx = (us == 0) ? 0 : (32 - __builtin_clz(us));
+
+	return MIN(idx, HIST_BUCKETS - 1);
+}
+
+static void hist_record(struct app_event_latency_hist *hist, uint32_t cycles)
+{
+	uint32_t us = k_cyc_to_us_floor32(cycles);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	hist->buckets[hist_bucket(us)]++;
+	hist->count++;
+	hist->max_us = MAX(hist->max_us, us);
+
+	k_spin_unlock(&lock, key);
+}
+
+static uint32_t hist_percentile(const struct app_event_latency_hist *hist, uint32_t count,
+				uint8_t percent)
+{
+	/* Number of samples at or below the percentile, rounded up. */
+	uint32_t target = DIV_ROUND_UP((uint64_t)count * percent, 100);
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < HIST_BUCKETS; i++) {
+		sum += hist->buckets[i];
+		if ((sum >= target) && (sum > 0)) {
+			/* Report the upper bound of the bucket, limited by the maximum. */
+			uint32_t upper = (i == 0) ? 0 : (uint32_t)(BIT64(i) - 1);
+
+			return MIN(upper, hist->max_us);
+		}
+	}
+
+	return hist->max_us;
+}
+
+static void hist_stats_get(const struct app_event_latency_hist *hist,
+			   struct app_event_latency_stats *stats)
+{
+	struct app_event_latency_hist snapshot;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	snapshot = *hist;
+	k_spin_unlock(&lock, key);
+
+	stats->count = snapshot.count;
+	stats->max_us = snapshot.max_us;
+	stats->p50_us = hist_percentile(&snapshot, snapshot.count, 50);
+	stats->p99_us = hist_percentile(&snapshot, snapshot.count, 99);
+}
+
+static size_t event_type_idx(const struct event_type *et)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	return et - _event_type_list_start;
+}
+
+void latency_dispatch_record(const struct app_event_header *aeh, uint32_t now)
+{
+	hist_record(&dispatch_hist[event_type_idx(aeh->type_id)], now - aeh->submit_cycles);
+}
+
+void latency_listener_record(const struct event_listener *el, uint32_t start)
+{
+	hist_record(el->latency, k_cycle_get_32() - start);
+}
+
+void latency_processing_record(const struct event_type *et, uint32_t start)
+{
+	hist_record(&processing_hist[event_type_idx(et)], k_cycle_get_32() - start);
+}
+
+void app_event_manager_latency_get(const struct event_type *et,
+				   struct app_event_latency_stats *dispatch,
+				   struct app_event_latency_stats *processing)
+{
+	size_t idx = event_type_idx(et);
+
+	if (dispatch) {
+		hist_stats_get(&dispatch_hist[idx], dispatch);
+	}
+	if (processing) {
+		hist_stats_get(&processing_hist[idx], processing);
+	}
+}
+
+void app_event_manager_listener_latency_get(const struct event_listener *el,
+					    struct app_event_latency_stats *stats)
+{
+	hist_stats_get(el->latency, stats);
+}
+
+void app_event_manager_latency_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(dispatch_hist, 0, sizeof(dispatch_hist));
+	memset(processing_hist, 0, sizeof(processing_hist));
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		memset(el->latency, 0, sizeof(*el->latency));
+	}
+
+	k_spin_unlock(&lock, key);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Application Event Manager latency statistics private header.
+ *
+ * The functions are used only by the Application Event Manager core.
+ */
+
+#ifndef _APP_EVENT_MANAGER_LATENCY_H_
+#define _APP_EVENT_MANAGER_LATENCY_H_
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+/* Store the event submission time. */
+static inline void latency_submit_mark(struct app_event_header *aeh)
+{
+	aeh->submit_cycles = k_cycle_get_32();
+}
+
+/* Record time between submission and start of the event processing. */
+void latency_dispatch_record(const struct app_event_header *aeh, uint32_t now);
+
+/* Record processing time of the listener notification. */
+void latency_listener_record(const struct event_listener *el, uint32_t start);
+
+/* Record processing time of the event by all listeners. */
+void latency_processing_record(const struct event_type *et, uint32_t start);
+
+static inline uint32_t latency_now(void)
+{
+	return k_cycle_get_32();
+}
+#else
+static inline void latency_submit_mark(struct app_event_header *aeh) {}
+static inline void latency_dispatch_record(const struct app_event_header *aeh, uint32_t now) {}
+static inline void latency_listener_record(const struct event_listener *el, uint32_t start) {}
+static inline void latency_processing_record(const struct event_type *et, uint32_t start) {}
+
+static inline uint32_t latency_now(void)
+{
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LATENCY_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _APP_EVENT_MANAGER_LATENCY_H_ */
@@ -106,19 +106,47 @@ extern "C" {
 	((const struct event_subscriber *)&_APP_EM_TAG_NAME(ename, _APP_EM_MARKER_ARRAY_END))
 
 
-/* Subscribe a listener to an event. */
-#define _APP_EVENT_SUBSCRIBE(lname, ename, prio)					\
+/* Subscribe a listener to an event using the given notification function. */
+#define _APP_EVENT_SUBSCRIBE_FN(lname, ename, prio, notification_fn)			\
 	const struct event_subscriber _CONCAT(_CONCAT(__event_subscriber_, ename), lname)\
 	__used __aligned(__alignof(struct event_subscriber))				\
 	__attribute__((__section__(_APP_EVENT_SUBSCRIBERS_SECTION_NAME(ename, prio)))) = {\
 		.listener = &_CONCAT(__event_listener_, lname),				\
+		.notification = (notification_fn),					\
 	}
 
+/* Subscribe a listener to an event. */
+#define _APP_EVENT_SUBSCRIBE(lname, ename, prio) \
+	_APP_EVENT_SUBSCRIBE_FN(lname, ename, prio, NULL)
+
+/* Convenience macro generating name of the typed handler wrapper. */
+#define _APP_EVENT_HANDLER_NAME(lname, ename) \
+	_CONCAT(_CONCAT(_CONCAT(__event_handler_, ename), _), lname)
+
+/* Subscribe a typed event handler of a listener to an event.
+ * The subscriber is placed in the array of the given event type, so the wrapper
+ * does not need to verify the event type before casting.
+ */
+#define _APP_EVENT_SUBSCRIBE_HANDLER(lname, ename, prio, handler)			\
+	static bool _APP_EVENT_HANDLER_NAME(lname, ename)(const struct app_event_header *aeh)\
+	{										\
+		__ASSERT_NO_MSG(aeh->type_id == _EVENT_ID(ename));			\
+		return handler(CONTAINER_OF(aeh, struct ename, header));		\
+	}										\
+	_APP_EVENT_SUBSCRIBE_FN(lname, ename, prio, _APP_EVENT_HANDLER_NAME(lname, ename))
+
 
 /* Pointer to event type definition is used as event type identifier. */
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for the event of the given ename type. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+#define _APP_EVENT_ALLOC(ename, size) _app_event_manager_alloc_event(_EVENT_ID(ename), size)
+#else
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +155,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -188,15 +216,28 @@ extern "C" {
 
 
 /* Declarations and definitions - for more details refer to public API. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+#define _APP_EVENT_LISTENER_LATENCY_DEFINE(lname) \
+	static struct app_event_latency_hist _CONCAT(__event_listener_latency_, lname);
+#define _APP_EVENT_LISTENER_LATENCY(lname) \
+	.latency = &_CONCAT(__event_listener_latency_, lname),
+#else
+#define _APP_EVENT_LISTENER_LATENCY_DEFINE(lname)
+#define _APP_EVENT_LISTENER_LATENCY(lname)
+#endif
+
 #define _APP_EVENT_LISTENER(lname, notification_fn)					\
+	_APP_EVENT_LISTENER_LATENCY_DEFINE(lname)					\
 	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
 		.name = STRINGIFY(lname),						\
 		.notification = (notification_fn),					\
+		_APP_EVENT_LISTENER_LATENCY(lname) /* No comma here intentionally */	\
 	}
 
 
 #define _APP_EVENT_TYPE_DECLARE_COMMON(ename)						\
 	extern Z_DECL_ALIGN(struct event_type) _CONCAT(__event_type_, ename);		\
+	_APP_EVENT_TYPE_DECLARE_POOL(ename)						\
 	_APP_EVENT_CASTER_FN(ename);							\
 	_APP_EVENT_TYPECHECK_FN(ename)
 
@@ -219,6 +260,72 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+/** @brief Event pool runtime data. */
+struct app_event_pool_data {
+	/** Memory slab holding the events. */
+	struct k_mem_slab slab;
+
+	/** Maximum number of blocks used at the same time. */
+	atomic_t max_used;
+
+	/** Number of allocations that fell back to the heap. */
+	atomic_t fallbacks;
+};
+
+/** @brief Event pool.
+ *
+ * All event pools must be defined using @ref APP_EVENT_TYPE_POOL_DEFINE.
+ */
+struct app_event_pool {
+	/** Pointer to the pool runtime data. */
+	struct app_event_pool_data *data;
+
+	/** Pointer to the memory backing the memory slab. */
+	char *buffer;
+
+	/** Size of a single block. */
+	size_t block_size;
+
+	/** Number of blocks in the pool. */
+	uint32_t num_blocks;
+};
+
+/* Alignment and size of a single event in the pool. Memory slab requires blocks aligned to
+ * the pointer size.
+ */
+#define _APP_EVENT_POOL_ALIGN(ename) MAX(__alignof__(struct ename), sizeof(void *))
+#define _APP_EVENT_POOL_BLOCK_SIZE(ename) \
+	ROUND_UP(sizeof(struct ename), _APP_EVENT_POOL_ALIGN(ename))
+
+/* The pool is declared weak so that event types without a pool resolve to NULL. */
+#define _APP_EVENT_TYPE_DECLARE_POOL(ename) \
+	extern const struct app_event_pool _CONCAT(__event_pool_, ename) __weak;
+
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename) \
+	.pool = &_CONCAT(__event_pool_, ename),
+
+#define _APP_EVENT_TYPE_POOL_DEFINE(ename, count)					\
+	BUILD_ASSERT(!_CONCAT(ename, _HAS_DYNDATA),					\
+		     "Event pool cannot be used for events with dynamic data");		\
+	BUILD_ASSERT((count) > 0, "Event pool must contain at least one event");	\
+	static struct app_event_pool_data _CONCAT(__event_pool_data_, ename);		\
+	static char __aligned(_APP_EVENT_POOL_ALIGN(ename))				\
+		_CONCAT(__event_pool_buf_, ename)[(count) * _APP_EVENT_POOL_BLOCK_SIZE(ename)];\
+	const struct app_event_pool _CONCAT(__event_pool_, ename) = {			\
+		.data       = &_CONCAT(__event_pool_data_, ename),			\
+		.buffer     = _CONCAT(__event_pool_buf_, ename),			\
+		.block_size = _APP_EVENT_POOL_BLOCK_SIZE(ename),			\
+		.num_blocks = (count),							\
+	}
+#else
+#define _APP_EVENT_TYPE_DECLARE_POOL(ename)
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename)
+#define _APP_EVENT_TYPE_POOL_DEFINE(ename, count)					\
+	BUILD_ASSERT(!_CONCAT(ename, _HAS_DYNDATA),					\
+		     "Event pool cannot be used for events with dynamic data")
+#endif
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
@@ -230,8 +337,31 @@ struct app_event_header {
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+	/** Value of the cycle counter on the event submission. */
+	uint32_t submit_cycles;
+#endif
 };
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+/** @brief Latency histogram.
+ *
+ * Bucket i counts latencies in the range of [2^(i-1), 2^i) microseconds, bucket 0 counts
+ * latencies below 1 microsecond. The last bucket counts also all longer latencies.
+ */
+struct app_event_latency_hist {
+	/** Number of samples in each bucket. */
+	uint32_t buckets[CONFIG_APP_EVENT_MANAGER_LATENCY_STATS_BUCKETS];
+
+	/** Number of samples. */
+	uint32_t count;
+
+	/** Maximum latency in microseconds. */
+	uint32_t max_us;
+};
+#endif
+
 /** Function to log data from this event. */
 typedef void (*log_event_data)(const struct app_event_header *aeh);
 
@@ -292,6 +422,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	/** Pointer to the event pool or NULL if events are allocated from the heap. */
+	const struct app_event_pool *pool;
+#endif
 };
 
 
@@ -315,6 +450,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_POOL(ename) /* No comma here intentionally */	\
 	}
 
 /**
@@ -387,6 +523,11 @@ struct event_listener {
 	 * not propagated to further listeners, or false, otherwise.
 	 */
 	bool (*notification)(const struct app_event_header *aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+	/** Histogram of the listener notification processing time. */
+	struct app_event_latency_hist *latency;
+#endif
 };
 
 
@@ -395,6 +536,11 @@ struct event_listener {
 struct event_subscriber {
 	/** Pointer to the listener. */
 	const struct event_listener *listener;
+
+	/** Pointer to the function that is called when an event is handled.
+	 * If NULL, the notification function of the listener is called.
+	 */
+	bool (*notification)(const struct app_event_header *aeh);
 };
 
 
@@ -433,6 +579,17 @@ struct event_postprocess_hook {
  */
 void _event_submit(struct app_event_header *aeh);
 
+/** @brief Allocate an event of the given type.
+ *
+ * The event is taken from the event type pool if the pool is defined and not exhausted.
+ * Otherwise, the event is allocated using @ref app_event_manager_alloc.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Size of the event (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_alloc_event(const struct event_type *et, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,84 @@ static int show_events(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static int show_pools(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event Pools:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_pool_stats stats;
+
+		if (app_event_manager_pool_stats_get(et, &stats)) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] used: %u/%u max: %u fallbacks: %u\n",
+			      et->name, stats.num_used, stats.num_blocks,
+			      stats.max_used, stats.num_fallbacks);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+static void print_latency(const struct shell *shell, const char *label,
+			  const struct app_event_latency_stats *stats)
+{
+	shell_fprintf(shell, SHELL_NORMAL,
+		      "|\t\t%s: count: %u p50: %u us p99: %u us max: %u us\n",
+		      label, stats->count, stats->p50_us, stats->p99_us, stats->max_us);
+}
+
+static int show_latency(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event latency:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_latency_stats dispatch;
+		struct app_event_latency_stats processing;
+
+		app_event_manager_latency_get(et, &dispatch, &processing);
+		if (dispatch.count == 0) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "|\t[E:%s]\n", et->name);
+		print_latency(shell, "dispatch", &dispatch);
+		print_latency(shell, "processing", &processing);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Listener latency:\n");
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		struct app_event_latency_stats stats;
+
+		app_event_manager_listener_latency_get(el, &stats);
+		if (stats.count == 0) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "|\t[L:%s]\n", el->name);
+		print_latency(shell, "notification", &stats);
+	}
+
+	return 0;
+}
+
+static int reset_latency(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	app_event_manager_latency_reset();
+	shell_fprintf(shell, SHELL_NORMAL, "Latency statistics reset\n");
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LATENCY_STATS */
+
 static int show_listeners(const struct shell *shell, size_t argc,
 		char **argv)
 {
@@ -155,6 +233,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	SHELL_CMD_ARG(show_pools, NULL, "Show event pools", show_pools, 0, 0),
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)
+	SHELL_CMD_ARG(show_latency, NULL, "Show event latency statistics",
+		      show_latency, 0, 0),
+	SHELL_CMD_ARG(reset_latency, NULL, "Reset event latency statistics",
+		      reset_latency, 0, 0),
+#endif
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
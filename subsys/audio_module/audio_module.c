@@ -14,12 +14,30 @@
 
 #include "data_fifo.h"
 
+#if CONFIG_AUDIO_MODULE_STATS_PROFILER
+#include <nrf_profiler.h>
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(audio_module, CONFIG_AUDIO_MODULE_LOG_LEVEL);
 
 /* Define a timeout to prevent system locking */
 #define LOCK_TIMEOUT_US (K_USEC(100))
 
+#if CONFIG_AUDIO_MODULE_STATS
+/* List of the open modules, used to show their statistics. */
+static sys_slist_t stats_list = SYS_SLIST_STATIC_INIT(&stats_list);
+static K_MUTEX_DEFINE(stats_list_mutex);
+
+/* Lock for reading and updating the statistics of a module. */
+static struct k_spinlock stats_lock;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
+#if CONFIG_AUDIO_MODULE_STATS_PROFILER
+static uint16_t profiler_event_id;
+static bool profiler_event_registered;
+#endif /* CONFIG_AUDIO_MODULE_STATS_PROFILER */
+
 /**
  * @brief Helper function to validate the module state.
  *
@@ -134,6 +152,68 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+/**
+ * @brief Get a timestamp for the module statistics.
+ *
+ * @return The current cycle count, or 0 if the statistics are disabled.
+ */
+static inline uint32_t stats_timestamp(void)
+{
+#if CONFIG_AUDIO_MODULE_STATS
+	return k_cycle_get_32();
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief Update the statistics of a module after it processed an audio data item.
+ *
+ * @param handle      [in/out]  The handle for the module instance.
+ * @param queued_cyc  [in]      Cycle count when the audio data was queued to the module.
+ * @param start_cyc   [in]      Cycle count when the module started processing the audio data.
+ * @param audio_data  [in]      Pointer to the processed audio data.
+ */
+static void stats_update(struct audio_module_handle *handle, uint32_t queued_cyc,
+			 uint32_t start_cyc, struct audio_data const *const audio_data)
+{
+#if CONFIG_AUDIO_MODULE_STATS
+	k_spinlock_key_t key;
+	struct audio_module_stats *stats = &handle->stats;
+	uint32_t process_us = k_cyc_to_us_floor32(k_cycle_get_32() - start_cyc);
+	uint32_t queue_wait_us = k_cyc_to_us_floor32(start_cyc - queued_cyc);
+	bool deadline_miss = handle->description->type != AUDIO_MODULE_TYPE_INPUT &&
+			     audio_data->meta.data_len_us != 0 &&
+			     (queue_wait_us + process_us) > audio_data->meta.data_len_us;
+
+	key = k_spin_lock(&stats_lock);
+
+	stats->frames++;
+	stats->process_us_last = process_us;
+	stats->process_us_max = MAX(stats->process_us_max, process_us);
+	stats->process_us_total += process_us;
+	stats->queue_wait_us_last = queue_wait_us;
+	stats->queue_wait_us_max = MAX(stats->queue_wait_us_max, queue_wait_us);
+	stats->queue_wait_us_total += queue_wait_us;
+	stats->deadline_misses += deadline_miss;
+
+	k_spin_unlock(&stats_lock, key);
+
+#if CONFIG_AUDIO_MODULE_STATS_PROFILER
+	if (profiler_event_registered && is_profiling_enabled(profiler_event_id)) {
+		struct log_event_buf buf;
+
+		nrf_profiler_log_start(&buf);
+		nrf_profiler_log_encode_string(&buf, handle->name);
+		nrf_profiler_log_encode_uint32(&buf, process_us);
+		nrf_profiler_log_encode_uint32(&buf, queue_wait_us);
+		nrf_profiler_log_encode_uint8(&buf, deadline_miss);
+		nrf_profiler_log_send(&buf, profiler_event_id);
+	}
+#endif /* CONFIG_AUDIO_MODULE_STATS_PROFILER */
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+}
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -189,6 +269,9 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 		memcpy(&data_msg_rx->audio_data, audio_data, sizeof(struct audio_data));
 		data_msg_rx->tx_handle = tx_handle;
 		data_msg_rx->response_cb = data_in_response_cb;
+#if CONFIG_AUDIO_MODULE_STATS
+		data_msg_rx->queued_cyc = k_cycle_get_32();
+#endif
 
 		ret = data_fifo_block_lock(rx_handle->thread.msg_rx, (void **)&data_msg_rx,
 					   sizeof(struct audio_module_message));
@@ -338,6 +421,60 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 	return 0;
 }
 
+/**
+ * @brief Process the audio data in place in the modules chained after the given module.
+ *
+ * @note The modules in the chain run in the caller's thread, on the caller's audio data buffer.
+ *       If processing stops, or the chain ends in an output module, the audio data is released.
+ *
+ * @param handle      [in/out]  The handle for the first module of the chain.
+ * @param audio_data  [in/out]  Pointer to the audio data to process.
+ *
+ * @return The handle of the last module in the chain, or NULL if the audio data was released.
+ */
+static struct audio_module_handle *chain_process(struct audio_module_handle *handle,
+						 struct audio_data *audio_data)
+{
+	int ret;
+	uint32_t start_cyc;
+	struct audio_module_handle *next;
+
+	for (next = handle->chain_next; next != NULL; next = next->chain_next) {
+		if (!state_running(next->state)) {
+			LOG_WRN("Chained module %s is in an invalid state %d, releasing audio data",
+				next->name, next->state);
+
+			k_mem_slab_free(handle->thread.data_slab, (void **)&audio_data->data);
+			return NULL;
+		}
+
+		start_cyc = stats_timestamp();
+
+		ret = next->description->functions->data_process(
+			(struct audio_module_handle_private *)next, audio_data,
+			has_input_type(next->description->type) ? audio_data : NULL);
+		if (ret) {
+			LOG_ERR("Data process error in chained module %s, ret %d", next->name, ret);
+
+			k_mem_slab_free(handle->thread.data_slab, (void **)&audio_data->data);
+			return NULL;
+		}
+
+		/* A chained module has no input queue. */
+		stats_update(next, start_cyc, start_cyc, audio_data);
+
+		handle = next;
+	}
+
+	if (!has_input_type(handle->description->type)) {
+		/* The audio data has been output by the last module of the chain. */
+		k_mem_slab_free(handle->thread.data_slab, (void **)&audio_data->data);
+		return NULL;
+	}
+
+	return handle;
+}
+
 /**
  * @brief The thread that receives data from outside (e.g. the system and passes it into the audio
  *        system.
@@ -353,6 +490,8 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 {
 	int ret;
 	struct audio_data audio_data;
+	struct audio_module_handle *tail;
+	uint32_t start_cyc;
 	void *data;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
@@ -374,6 +513,8 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 		audio_data.data = data;
 		audio_data.data_size = handle->thread.data_size;
 
+		start_cyc = stats_timestamp();
+
 		/* Process the input audio data */
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, NULL, &audio_data);
@@ -384,10 +525,16 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 			continue;
 		}
 
+		/* An input module has no input queue. */
+		stats_update(handle, start_cyc, start_cyc, &audio_data);
+
 		LOG_DBG("Module %s received new audio data ", handle->name);
 
-		/* Send input audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+		/* Send input audio data through any in-place chain and on to next module(s). */
+		tail = chain_process(handle, &audio_data);
+		if (tail != NULL) {
+			send_to_connected_modules(tail, &audio_data);
+		}
 	}
 
 	CODE_UNREACHABLE;
@@ -409,6 +556,7 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 	int ret;
 
 	struct audio_module_message *msg_rx;
+	uint32_t start_cyc;
 	size_t size;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
@@ -431,6 +579,8 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 
 		LOG_DBG("Module %s new audio data received", handle->name);
 
+		start_cyc = stats_timestamp();
+
 		/* Process the input audio data and output from the audio system. */
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, &msg_rx->audio_data, NULL);
@@ -445,6 +595,10 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 			continue;
 		}
 
+#if CONFIG_AUDIO_MODULE_STATS
+		stats_update(handle, msg_rx->queued_cyc, start_cyc, &msg_rx->audio_data);
+#endif
+
 		if (msg_rx->response_cb != NULL) {
 			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
 					    &msg_rx->audio_data);
@@ -471,6 +625,8 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 	int ret;
 	struct audio_module_message *msg_rx;
 	struct audio_data audio_data;
+	struct audio_module_handle *tail;
+	uint32_t start_cyc;
 	void *data;
 	size_t size;
 
@@ -503,6 +659,8 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 		audio_data.data = data;
 		audio_data.data_size = handle->thread.data_size;
 
+		start_cyc = stats_timestamp();
+
 		/* Process the input audio data into the output audio data. */
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, &msg_rx->audio_data,
@@ -522,8 +680,15 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 			continue;
 		}
 
-		/* Send processed audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+#if CONFIG_AUDIO_MODULE_STATS
+		stats_update(handle, msg_rx->queued_cyc, start_cyc, &msg_rx->audio_data);
+#endif
+
+		/* Send processed audio data through any in-place chain and on to next module(s). */
+		tail = chain_process(handle, &audio_data);
+		if (tail != NULL) {
+			send_to_connected_modules(tail, &audio_data);
+		}
 
 		if (msg_rx->response_cb != NULL) {
 			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
@@ -629,6 +794,26 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 
 	handle->state = AUDIO_MODULE_STATE_CONFIGURED;
 
+#if CONFIG_AUDIO_MODULE_STATS_PROFILER
+	if (!profiler_event_registered) {
+		static const char *const labels[] = {"module", "process_us", "queue_wait_us",
+						     "deadline_miss"};
+		static const enum nrf_profiler_arg types[] = {
+			NRF_PROFILER_ARG_STRING, NRF_PROFILER_ARG_U32, NRF_PROFILER_ARG_U32,
+			NRF_PROFILER_ARG_U8};
+
+		profiler_event_id = nrf_profiler_register_event_type(
+			"audio_module_frame", labels, types, ARRAY_SIZE(types));
+		profiler_event_registered = true;
+	}
+#endif /* CONFIG_AUDIO_MODULE_STATS_PROFILER */
+
+#if CONFIG_AUDIO_MODULE_STATS
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+	sys_slist_append(&stats_list, &handle->stats_node);
+	k_mutex_unlock(&stats_list_mutex);
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 	k_thread_start(handle->thread_id);
 
 	LOG_DBG("Thread started");
@@ -651,6 +836,11 @@ int audio_module_close(struct audio_module_handle *handle)
 		return -ECANCELED;
 	}
 
+	if (handle->chain_next != NULL || handle->chain_prev != NULL) {
+		LOG_ERR("Module %s is connected in place and cannot be closed", handle->name);
+		return -EBUSY;
+	}
+
 	if (handle->description->functions->close != NULL) {
 		ret = handle->description->functions->close(
 			(struct audio_module_handle_private *)handle);
@@ -675,6 +865,12 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	k_thread_abort(handle->thread_id);
 
+#if CONFIG_AUDIO_MODULE_STATS
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+	sys_slist_find_and_remove(&stats_list, &handle->stats_node);
+	k_mutex_unlock(&stats_list_mutex);
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 	LOG_DBG("Closed module %s", handle->name);
 
 	return 0;
@@ -919,6 +1115,99 @@ int audio_module_disconnect(struct audio_module_handle *handle,
 	return 0;
 }
 
+int audio_module_connect_in_place(struct audio_module_handle *handle_from,
+				  struct audio_module_handle *handle_to)
+{
+	struct audio_module_handle *head;
+	struct audio_module_handle *handle;
+
+	if (handle_from == NULL || handle_to == NULL) {
+		LOG_ERR("Invalid parameter for the connection function");
+		return -EINVAL;
+	}
+
+	if (handle_from == handle_to) {
+		LOG_ERR("Module handles identical");
+		return -EINVAL;
+	}
+
+	if (!has_input_type(handle_from->description->type) ||
+	    !has_output_type(handle_to->description->type)) {
+		LOG_ERR("Connections between these modules is not supported");
+		return -ECANCELED;
+	}
+
+	if (!handle_to->description->in_place) {
+		LOG_ERR("Module %s does not support in-place processing", handle_to->name);
+		return -ECANCELED;
+	}
+
+	if (!state_not_undefined(handle_from->state) || state_running(handle_from->state) ||
+	    !state_not_undefined(handle_to->state) || state_running(handle_to->state)) {
+		LOG_WRN("A module is in an invalid state for connecting in place");
+		return -ECANCELED;
+	}
+
+	if (handle_from->chain_next != NULL || handle_to->chain_prev != NULL) {
+		LOG_WRN("Module %s or %s is already connected in place", handle_from->name,
+			handle_to->name);
+		return -EALREADY;
+	}
+
+	for (head = handle_from; head->chain_prev != NULL; head = head->chain_prev) {
+	}
+
+	/* All modules in a chain release the audio data to the slab of the first module. */
+	for (handle = handle_to; handle != NULL; handle = handle->chain_next) {
+		if (handle == head) {
+			LOG_ERR("Connecting %s to %s in place would create a loop", handle_to->name,
+				handle_from->name);
+			return -EINVAL;
+		}
+
+		if (handle->thread.data_slab != head->thread.data_slab) {
+			LOG_ERR("Module %s does not share the data slab of %s", handle->name,
+				head->name);
+			return -EINVAL;
+		}
+	}
+
+	handle_from->chain_next = handle_to;
+	handle_to->chain_prev = handle_from;
+
+	LOG_DBG("Connected the output of %s to %s in place", handle_from->name, handle_to->name);
+
+	return 0;
+}
+
+int audio_module_disconnect_in_place(struct audio_module_handle *handle,
+				     struct audio_module_handle *handle_disconnect)
+{
+	if (handle == NULL || handle_disconnect == NULL) {
+		LOG_ERR("Invalid parameter for the disconnection function");
+		return -EINVAL;
+	}
+
+	if (state_running(handle->state) || state_running(handle_disconnect->state)) {
+		LOG_WRN("A module is in an invalid state for disconnecting in place");
+		return -ECANCELED;
+	}
+
+	if (handle->chain_next != handle_disconnect) {
+		LOG_ERR("Module %s is not connected in place to module %s",
+			handle_disconnect->name, handle->name);
+		return -EALREADY;
+	}
+
+	handle->chain_next = NULL;
+	handle_disconnect->chain_prev = NULL;
+
+	LOG_DBG("Disconnected module %s in place from module %s", handle_disconnect->name,
+		handle->name);
+
+	return 0;
+}
+
 int audio_module_start(struct audio_module_handle *handle)
 {
 	int ret;
@@ -1212,3 +1501,107 @@ int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_ch
 
 	return 0;
 }
+
+#if CONFIG_AUDIO_MODULE_STATS
+int audio_module_stats_get(struct audio_module_handle *handle, struct audio_module_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if (handle == NULL || stats == NULL) {
+		LOG_ERR("Invalid parameters");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_WRN("Module %s in an invalid state, %d, for getting statistics", handle->name,
+			handle->state);
+		return -ECANCELED;
+	}
+
+	key = k_spin_lock(&stats_lock);
+	memcpy(stats, &handle->stats, sizeof(struct audio_module_stats));
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+
+int audio_module_stats_reset(struct audio_module_handle *handle)
+{
+	k_spinlock_key_t key;
+
+	if (handle == NULL) {
+		LOG_ERR("Invalid parameters");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_WRN("Module %s in an invalid state, %d, for resetting statistics",
+			handle->name, handle->state);
+		return -ECANCELED;
+	}
+
+	key = k_spin_lock(&stats_lock);
+	memset(&handle->stats, 0, sizeof(struct audio_module_stats));
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
+#if CONFIG_AUDIO_MODULE_STATS_SHELL
+static int cmd_stats_show(const struct shell *shell, size_t argc, char **argv)
+{
+	struct audio_module_handle *handle;
+	struct audio_module_stats stats;
+
+	shell_print(shell, "%-*s %8s %20s %20s %8s", CONFIG_AUDIO_MODULE_NAME_SIZE, "Module",
+		    "Frames", "Process avg/max [us]", "Queue avg/max [us]", "Misses");
+
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, handle, stats_node) {
+		if (audio_module_stats_get(handle, &stats)) {
+			continue;
+		}
+
+		uint32_t frames = MAX(stats.frames, 1);
+
+		shell_print(shell, "%-*s %8u %9u/%-10u %9u/%-10u %8u",
+			    CONFIG_AUDIO_MODULE_NAME_SIZE, handle->name, stats.frames,
+			    (uint32_t)(stats.process_us_total / frames), stats.process_us_max,
+			    (uint32_t)(stats.queue_wait_us_total / frames), stats.queue_wait_us_max,
+			    stats.deadline_misses);
+	}
+
+	k_mutex_unlock(&stats_list_mutex);
+
+	return 0;
+}
+
+static int cmd_stats_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	struct audio_module_handle *handle;
+
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, handle, stats_node) {
+		(void)audio_module_stats_reset(handle);
+	}
+
+	k_mutex_unlock(&stats_list_mutex);
+
+	shell_print(shell, "Statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_audio_module,
+	SHELL_CMD_ARG(stats, NULL, "Show timing statistics of the open modules",
+		      cmd_stats_show, 0, 0),
+	SHELL_CMD_ARG(stats_reset, NULL, "Reset timing statistics of the open modules",
+		      cmd_stats_reset, 0, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(audio_module, &sub_audio_module, "Audio module commands", NULL);
+#endif /* CONFIG_AUDIO_MODULE_STATS_SHELL */
@@ -15,37 +15,81 @@ static void bt_conn_ctx_mem_free(struct k_mem_slab *mem_slab, void **data)
 	*data = NULL;
 }
 
+/* Contexts are stored at the index of their connection, so that no lookup
+ * is needed.
+ */
+static struct bt_conn_ctx *bt_conn_ctx_slot(struct bt_conn_ctx_lib *ctx_lib,
+					    struct bt_conn *conn)
+{
+	uint8_t index = bt_conn_index(conn);
+
+	__ASSERT_NO_MSG(index < CONFIG_BT_MAX_CONN);
+
+	return &ctx_lib->ctx[index];
+}
+
+static void *bt_conn_ctx_slot_alloc(struct bt_conn_ctx_lib *ctx_lib,
+				    struct bt_conn_ctx *ctx,
+				    struct bt_conn *conn)
+{
+	int err;
+
+	err = k_mem_slab_alloc(ctx_lib->mem_slab, &ctx->data, K_NO_WAIT);
+	if (err) {
+		ctx->data = NULL;
+		return NULL;
+	}
+
+	ctx->conn = conn;
+
+	LOG_DBG("The memory for the connection context "
+		"has been allocated, conn %p, index: %u",
+		(void *)conn, bt_conn_index(conn));
+
+	return ctx->data;
+}
+
 void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 {
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	int err = -ENOMEM;
-	struct bt_conn_ctx *ctx;
+	struct bt_conn_ctx *ctx = bt_conn_ctx_slot(ctx_lib, conn);
 
 	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		ctx = &ctx_lib->ctx[i];
+	if (!ctx->conn && !ctx->data &&
+	    bt_conn_ctx_slot_alloc(ctx_lib, ctx, conn)) {
+		return ctx->data;
+	}
+
+	LOG_WRN("Memory can not be allocated");
+	k_mutex_unlock(ctx_lib->mutex);
+
+	return NULL;
+}
 
-		if (!ctx->conn && !ctx->data) {
-			err = k_mem_slab_alloc(ctx_lib->mem_slab,
-					       &ctx->data,
-					       K_NO_WAIT);
-			if (!err) {
-				ctx->conn = conn;
+void *bt_conn_ctx_get_or_alloc(struct bt_conn_ctx_lib *ctx_lib,
+			       struct bt_conn *conn, bool *allocated)
+{
+	__ASSERT_NO_MSG(conn != NULL);
+	__ASSERT_NO_MSG(ctx_lib != NULL);
+	__ASSERT_NO_MSG(allocated != NULL);
 
-				LOG_DBG("The memory for the connection context "
-					"has been allocated, conn %p, index: %u",
-					(void *)conn, i);
+	struct bt_conn_ctx *ctx = bt_conn_ctx_slot(ctx_lib, conn);
 
-				return ctx->data;
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			} else {
-				break;
-			}
+	*allocated = false;
 
-		}
+	if (ctx->conn == conn) {
+		return ctx->data;
+	}
+
+	if (!ctx->conn && !ctx->data &&
+	    bt_conn_ctx_slot_alloc(ctx_lib, ctx, conn)) {
+		*allocated = true;
+		return ctx->data;
 	}
 
 	LOG_WRN("Memory can not be allocated");
@@ -59,24 +103,22 @@ int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	struct bt_conn_ctx *ctx = bt_conn_ctx_slot(ctx_lib, conn);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-		if (ctx->conn == conn) {
-			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
-			ctx->conn = NULL;
-			ctx->data = NULL;
+	if (ctx->conn == conn) {
+		bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
+		ctx->conn = NULL;
+		ctx->data = NULL;
 
-			LOG_DBG("The context memory for the connection "
-				"has been released, conn %p index %u",
-				(void *)conn, i);
+		LOG_DBG("The context memory for the connection "
+			"has been released, conn %p index %u",
+			(void *)conn, bt_conn_index(conn));
 
-			k_mutex_unlock(ctx_lib->mutex);
+		k_mutex_unlock(ctx_lib->mutex);
 
-			return 0;
-		}
+		return 0;
 	}
 
 	LOG_WRN("There is no allocated memory for this connection");
@@ -111,16 +153,14 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	struct bt_conn_ctx *ctx = bt_conn_ctx_slot(ctx_lib, conn);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-		if (ctx->conn == conn) {
-			LOG_DBG("Memory block found for the connection");
+	if (ctx->conn == conn) {
+		LOG_DBG("Memory block found for the connection");
 
-			return ctx->data;
-		}
+		return ctx->data;
 	}
 
 	LOG_WRN("No memory block for connection");
@@ -371,19 +371,62 @@ static int hci_driver_send(struct net_buf *buf)
 	return err;
 }
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_ZERO_COPY)
+/* Host buffer the next HCI message is fetched into. */
+static struct net_buf *acl_rx_buf;
+#endif
+
+static uint8_t *rx_msg_buf_get(uint8_t *hci_buf, size_t size)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_ZERO_COPY)
+	if (!acl_rx_buf) {
+		acl_rx_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_NO_WAIT);
+	}
+
+	if (acl_rx_buf && net_buf_tailroom(acl_rx_buf) >= size) {
+		return net_buf_tail(acl_rx_buf);
+	}
+#endif
+
+	return hci_buf;
+}
+
+static struct net_buf *acl_rx_buf_take(uint8_t *hci_buf, uint16_t len)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_ZERO_COPY)
+	struct net_buf *buf = acl_rx_buf;
+
+	if (buf && hci_buf == net_buf_tail(buf)) {
+		acl_rx_buf = NULL;
+		net_buf_add(buf, len);
+
+		return buf;
+	}
+#endif
+
+	return NULL;
+}
+
 static void data_packet_process(uint8_t *hci_buf)
 {
-	struct net_buf *data_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_FOREVER);
+	struct net_buf *data_buf;
 	struct bt_hci_acl_hdr *hdr = (void *)hci_buf;
 	uint16_t hf, handle, len;
 	uint8_t flags, pb, bc;
 
+	len = sys_le16_to_cpu(hdr->len);
+
+	data_buf = acl_rx_buf_take(hci_buf, len + sizeof(*hdr));
 	if (!data_buf) {
-		LOG_ERR("No data buffer available");
-		return;
+		data_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_FOREVER);
+		if (!data_buf) {
+			LOG_ERR("No data buffer available");
+			return;
+		}
+
+		net_buf_add_mem(data_buf, &hci_buf[0], len + sizeof(*hdr));
 	}
 
-	len = sys_le16_to_cpu(hdr->len);
 	hf = sys_le16_to_cpu(hdr->handle);
 	handle = bt_acl_handle(hf);
 	flags = bt_acl_flags(hf);
@@ -393,7 +436,6 @@ static void data_packet_process(uint8_t *hci_buf)
 	LOG_DBG("Data: handle (0x%02x), PB(%01d), BC(%01d), len(%u)", handle,
 	       pb, bc, len);
 
-	net_buf_add_mem(data_buf, &hci_buf[0], len + sizeof(*hdr));
 	bt_recv(data_buf);
 }
 
@@ -537,10 +579,15 @@ void hci_driver_receive_process(void)
 	static uint8_t hci_buf[BT_BUF_RX_SIZE];
 #endif
 
-	if (fetch_and_process_hci_msg(&hci_buf[0])) {
-		/* Let other threads of same priority run in between. */
-		receive_signal_raise();
+	for (int i = 0; i < CONFIG_BT_CTLR_SDC_RX_BATCH_COUNT; i++) {
+		if (!fetch_and_process_hci_msg(rx_msg_buf_get(&hci_buf[0],
+							      sizeof(hci_buf)))) {
+			return;
+		}
 	}
+
+	/* Let other threads of same priority run in between. */
+	receive_signal_raise();
 }
 
 static void receive_work_handler(struct k_work *work)
@@ -1295,6 +1342,13 @@ static int hci_driver_close(void)
 
 	MULTITHREADING_LOCK_RELEASE();
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_ZERO_COPY)
+	if (acl_rx_buf) {
+		net_buf_unref(acl_rx_buf);
+		acl_rx_buf = NULL;
+	}
+#endif
+
 	return err;
 }
 
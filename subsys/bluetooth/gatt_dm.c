@@ -8,6 +8,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
+#include <zephyr/bluetooth/conn.h>
 #include <bluetooth/gatt_dm.h>
 
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
@@ -29,6 +30,55 @@ enum {
 	STATE_NUM
 };
 
+/* Size of the GATT Database Hash characteristic value */
+#define DB_HASH_SIZE 16
+
+/* UUID of any type */
+union uuid_any {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+
+#if CONFIG_BT_GATT_DM_CACHE
+/* Cached attribute of a discovered service */
+struct cache_attr {
+	/* Attribute UUID */
+	union uuid_any uuid;
+	/* Service UUID or characteristic value UUID */
+	union uuid_any val_uuid;
+	/* Attribute handle */
+	uint16_t handle;
+	/* Service end handle or characteristic value handle */
+	uint16_t val_handle;
+	/* Attribute permissions */
+	uint8_t perm;
+	/* Characteristic properties */
+	uint8_t properties;
+};
+
+/* Cached discovery of a service on a peer */
+struct cache_entry {
+	/* Peer address */
+	bt_addr_le_t addr;
+	/* Database Hash of the peer when the service was discovered */
+	uint8_t db_hash[DB_HASH_SIZE];
+	/* The service was searched by UUID */
+	bool search_svc_by_uuid;
+	/* The UUID of the searched service */
+	union uuid_any svc_uuid;
+	/* Number of cached attributes, 0 if the entry is free */
+	size_t attr_cnt;
+	/* Attributes of the service */
+	struct cache_attr attrs[CONFIG_BT_GATT_DM_MAX_ATTRS];
+};
+
+static struct cache_entry cache[CONFIG_BT_GATT_DM_CACHE_SIZE];
+/* Index of the entry replaced by the next new service */
+static size_t cache_next;
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 /* One item in linked list containing dynamically allocated user data chunks */
 struct data_chunk_item {
 	/* Required by the sys_slist */
@@ -54,12 +104,7 @@ struct bt_gatt_dm {
 	ATOMIC_DEFINE(state_flags, STATE_NUM);
 
 	/* The UUID of the service to discover. */
-	union {
-		struct bt_uuid uuid;
-		struct bt_uuid_16 u16;
-		struct bt_uuid_32 u32;
-		struct bt_uuid_128 u128;
-	} svc_uuid;
+	union uuid_any svc_uuid;
 
 	/* Single-linked list of allocated chunks for user data */
 	sys_slist_t chunk_list;
@@ -71,6 +116,15 @@ struct bt_gatt_dm {
 
 	/* Indicates that services should be searched by the UUID. */
 	bool search_svc_by_uuid;
+
+#if CONFIG_BT_GATT_DM_CACHE
+	/* The parameters used to read the Database Hash */
+	struct bt_gatt_read_params db_hash_params;
+	/* Database Hash of the peer */
+	uint8_t db_hash[DB_HASH_SIZE];
+	/* The discovered service is stored in the cache when completed */
+	bool cache_store;
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 };
 
 /* Currently only one instance is supported */
@@ -247,9 +301,131 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if CONFIG_BT_GATT_DM_CACHE
+static struct cache_entry *cache_find(const struct bt_gatt_dm *dm)
+{
+	const bt_addr_le_t *addr = bt_conn_get_dst(dm->conn);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct cache_entry *entry = &cache[i];
+
+		if (!entry->attr_cnt ||
+		    (bt_addr_le_cmp(&entry->addr, addr) != 0) ||
+		    (entry->search_svc_by_uuid != dm->search_svc_by_uuid)) {
+			continue;
+		}
+
+		if (dm->search_svc_by_uuid &&
+		    (bt_uuid_cmp(&entry->svc_uuid.uuid, &dm->svc_uuid.uuid) != 0)) {
+			continue;
+		}
+
+		return entry;
+	}
+
+	return NULL;
+}
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct cache_entry *entry = cache_find(dm);
+
+	if (!entry) {
+		entry = &cache[cache_next];
+		cache_next = (cache_next + 1) % ARRAY_SIZE(cache);
+	}
+
+	bt_addr_le_copy(&entry->addr, bt_conn_get_dst(dm->conn));
+	memcpy(entry->db_hash, dm->db_hash, sizeof(entry->db_hash));
+	entry->search_svc_by_uuid = dm->search_svc_by_uuid;
+	memcpy(&entry->svc_uuid, &dm->svc_uuid, sizeof(entry->svc_uuid));
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		const struct bt_gatt_dm_attr *attr = &dm->attrs[i];
+		const struct bt_gatt_service_val *service_val = bt_gatt_dm_attr_service_val(attr);
+		const struct bt_gatt_chrc *chrc = bt_gatt_dm_attr_chrc_val(attr);
+		struct cache_attr *cached = &entry->attrs[i];
+
+		memset(cached, 0, sizeof(*cached));
+		memcpy(&cached->uuid, attr->uuid, get_uuid_size(attr->uuid));
+		cached->handle = attr->handle;
+		cached->perm = attr->perm;
+
+		if (service_val) {
+			memcpy(&cached->val_uuid, service_val->uuid,
+			       get_uuid_size(service_val->uuid));
+			cached->val_handle = service_val->end_handle;
+		} else if (chrc) {
+			memcpy(&cached->val_uuid, chrc->uuid, get_uuid_size(chrc->uuid));
+			cached->val_handle = chrc->value_handle;
+			cached->properties = chrc->properties;
+		}
+	}
+
+	entry->attr_cnt = dm->cur_attr_id;
+
+	LOG_DBG("Service stored in cache, %zu attributes", entry->attr_cnt);
+}
+
+static int cache_restore(struct bt_gatt_dm *dm, const struct cache_entry *entry)
+{
+	for (size_t i = 0; i < entry->attr_cnt; i++) {
+		const struct cache_attr *cached = &entry->attrs[i];
+		const struct bt_gatt_attr attr = {
+			.uuid = &cached->uuid.uuid,
+			.handle = cached->handle,
+			.perm = cached->perm,
+		};
+		struct bt_gatt_service_val *service_val;
+		struct bt_gatt_dm_attr *cur_attr;
+		struct bt_gatt_chrc *chrc;
+
+		if (i == 0) {
+			cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+			if (!cur_attr) {
+				return -ENOMEM;
+			}
+
+			service_val = bt_gatt_dm_attr_service_val(cur_attr);
+			service_val->end_handle = cached->val_handle;
+			service_val->uuid = uuid_store(dm, &cached->val_uuid.uuid);
+			if (!service_val->uuid) {
+				return -ENOMEM;
+			}
+		} else if (bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC) == 0) {
+			cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+			if (!cur_attr) {
+				return -ENOMEM;
+			}
+
+			chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+			chrc->value_handle = cached->val_handle;
+			chrc->properties = cached->properties;
+			chrc->uuid = uuid_store(dm, &cached->val_uuid.uuid);
+			if (!chrc->uuid) {
+				return -ENOMEM;
+			}
+		} else if (!attr_store(dm, &attr, 0)) {
+			return -ENOMEM;
+		}
+	}
+
+	/* Let bt_gatt_dm_continue() resume after the cached service. */
+	dm->discover_params.end_handle = entry->attrs[0].val_handle;
+
+	return 0;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if CONFIG_BT_GATT_DM_CACHE
+	if (dm->cache_store) {
+		dm->cache_store = false;
+		cache_store(dm);
+	}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -601,6 +777,57 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
 	return curr;
 }
 
+#if CONFIG_BT_GATT_DM_CACHE
+static uint8_t db_hash_read_callback(struct bt_conn *conn, uint8_t err,
+				     struct bt_gatt_read_params *params,
+				     const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = &bt_gatt_dm_inst;
+	struct cache_entry *entry;
+	int ret;
+
+	if (err || !data || (length != sizeof(dm->db_hash))) {
+		/* The peer does not expose its Database Hash,
+		 * the discovery cannot be cached.
+		 */
+		LOG_DBG("Database Hash not available, err: %u", err);
+		dm->cache_store = false;
+	} else {
+		memcpy(dm->db_hash, data, sizeof(dm->db_hash));
+		dm->cache_store = true;
+
+		entry = cache_find(dm);
+		if (entry && !memcmp(entry->db_hash, dm->db_hash, sizeof(dm->db_hash))) {
+			LOG_DBG("Service restored from cache");
+
+			dm->cache_store = false;
+			ret = cache_restore(dm, entry);
+			if (ret) {
+				discovery_complete_error(dm, ret);
+			} else {
+				discovery_complete(dm);
+			}
+
+			return BT_GATT_ITER_STOP;
+		}
+	}
+
+	ret = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (ret) {
+		LOG_ERR("Discover failed, error: %d.", ret);
+		discovery_complete_error(dm, ret);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+void bt_gatt_dm_cache_clear(void)
+{
+	memset(cache, 0, sizeof(cache));
+	cache_next = 0;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 int bt_gatt_dm_start(struct bt_conn *conn,
 		     const struct bt_uuid *svc_uuid,
 		     const struct bt_gatt_dm_cb *cb,
@@ -646,7 +873,19 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 
+#if CONFIG_BT_GATT_DM_CACHE
+	/* The discovery is started once the Database Hash of the peer is known. */
+	dm->cache_store = false;
+	dm->db_hash_params.func = db_hash_read_callback;
+	dm->db_hash_params.handle_count = 0;
+	dm->db_hash_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->db_hash_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	dm->db_hash_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+
+	err = bt_gatt_read(conn, &dm->db_hash_params);
+#else
 	err = bt_gatt_discover(conn, &dm->discover_params);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
 		atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
@@ -684,6 +923,10 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	}
 
 	dm->context = context;
+#if CONFIG_BT_GATT_DM_CACHE
+	/* Only the services found by bt_gatt_dm_start() are cached. */
+	dm->cache_store = false;
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 	dm->discover_params.start_handle = dm->discover_params.end_handle + 1;
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
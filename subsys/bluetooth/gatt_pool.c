@@ -93,9 +93,23 @@ static size_t free_element_find(struct svc_el_pool *el_pool, size_t el_cnt)
 	__ASSERT((el_pool->elements != NULL) && (el_pool->locks != NULL),
 		 "Pool uninitialized");
 
-	for (size_t i = 0; i < el_cnt; i++) {
-		if (!atomic_test_and_set_bit(el_pool->locks, i)) {
-			return i;
+	/* Look for a clear bit one word of the lock mask at a time. */
+	for (size_t word = 0; (word * ATOMIC_BITS) < el_cnt; word++) {
+		atomic_val_t locks = atomic_get(&el_pool->locks[word]);
+
+		while (~locks) {
+			size_t i = (word * ATOMIC_BITS) + __builtin_ctzl(~locks);
+
+			if (i >= el_cnt) {
+				return el_cnt;
+			}
+
+			if (!atomic_test_and_set_bit(el_pool->locks, i)) {
+				return i;
+			}
+
+			/* Taken concurrently, try the next clear bit. */
+			locks = atomic_get(&el_pool->locks[word]);
 		}
 	}
 	return el_cnt;
@@ -8,39 +8,61 @@
 
 #define REG_INT CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_INTERVAL
 
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT)
+/* Q16.16 values. They are held in 64 bits, as illuminance goes beyond the
+ * 16 bit integer part.
+ */
+typedef int64_t reg_val_t;
+
+#define REG_FRAC_BITS 16
+#define REG_VAL(_f) ((reg_val_t)((_f) * (float)BIT(REG_FRAC_BITS)))
+#define REG_VAL_INT(_n) ((reg_val_t)(_n) << REG_FRAC_BITS)
+#define REG_MUL(_a, _b) (((_a) * (_b)) >> REG_FRAC_BITS)
+#define REG_INTERVAL_SCALE(_v) (((_v) * REG_INT) / MSEC_PER_SEC)
+#define REG_FLOAT(_v) ((float)(_v) / (float)BIT(REG_FRAC_BITS))
+#else
+typedef float reg_val_t;
+
+#define REG_VAL(_f) ((float)(_f))
+#define REG_VAL_INT(_n) ((float)(_n))
+#define REG_MUL(_a, _b) ((_a) * (_b))
+#define REG_INTERVAL_SCALE(_v) ((_v) * ((float)REG_INT / (float)MSEC_PER_SEC))
+#define REG_FLOAT(_v) (_v)
+#endif
+
 struct reg_terms {
-	float i;
-	float p;
+	reg_val_t i;
+	reg_val_t p;
 };
 
 static struct reg_terms reg_terms_calc(struct bt_mesh_light_ctrl_reg_spec *spec_reg)
 {
-	float target = bt_mesh_light_ctrl_reg_target_get(&spec_reg->reg);
-	float error = target - spec_reg->reg.measured;
+	reg_val_t target = REG_VAL(bt_mesh_light_ctrl_reg_target_get(&spec_reg->reg));
+	reg_val_t error = target - REG_VAL(spec_reg->reg.measured);
 	/* Accuracy should be in percent and both up and down: */
-	float accuracy = (spec_reg->reg.cfg.accuracy * target) / (2 * 100.0f);
-	float input;
-	float kp, ki;
+	reg_val_t accuracy = REG_MUL(REG_VAL(spec_reg->reg.cfg.accuracy), target) / (2 * 100);
+	reg_val_t input;
+	reg_val_t kp, ki;
 
 	if (error > accuracy) {
 		input = error - accuracy;
 	} else if (error < -accuracy) {
 		input = error + accuracy;
 	} else {
-		input = 0.0f;
+		input = 0;
 	}
 
 	if (input >= 0) {
-		kp = spec_reg->reg.cfg.kp.up;
-		ki = spec_reg->reg.cfg.ki.up;
+		kp = REG_VAL(spec_reg->reg.cfg.kp.up);
+		ki = REG_VAL(spec_reg->reg.cfg.ki.up);
 	} else {
-		kp = spec_reg->reg.cfg.kp.down;
-		ki = spec_reg->reg.cfg.ki.down;
+		kp = REG_VAL(spec_reg->reg.cfg.kp.down);
+		ki = REG_VAL(spec_reg->reg.cfg.ki.down);
 	}
 
 	return (struct reg_terms){
-		.i = ((input) * (ki) * ((float)REG_INT / (float)MSEC_PER_SEC)),
-		.p = input * kp,
+		.i = REG_INTERVAL_SCALE(REG_MUL(input, ki)),
+		.p = REG_MUL(input, kp),
 	};
 }
 
@@ -67,10 +89,10 @@ static void reg_step(struct k_work *work)
 	}
 
 	if (!spec_reg->neg) {
-		spec_reg->i = CLAMP(spec_reg->i, 0, UINT16_MAX);
+		spec_reg->i = CLAMP(spec_reg->i, 0, REG_VAL_INT(UINT16_MAX));
 	}
 
-	float output = spec_reg->i + reg_terms.p;
+	float output = REG_FLOAT(spec_reg->i + reg_terms.p);
 
 	spec_reg->reg.updated(&spec_reg->reg, output);
 }
@@ -84,7 +106,7 @@ static void internal_sum_recover(struct bt_mesh_light_ctrl_reg_spec *spec_reg, u
 	/* Recalculate the internal sum so that it is equal to the passed lightness level at the
 	 * next regulator step.
 	 */
-	spec_reg->i = lightness - reg_terms.i;
+	spec_reg->i = REG_VAL_INT(lightness) - reg_terms.i;
 	/* Allow the internal sum to be negative until it becomes positive. */
 	spec_reg->neg = true;
 }
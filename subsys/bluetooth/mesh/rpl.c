@@ -22,9 +22,81 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+/* Open addressing hash index over the source addresses in replay_list. The
+ * list itself is what EMDS stores, so the index is kept in RAM only and is
+ * rebuilt on first use after the list is loaded, cleared or compacted.
+ * Entries hold the list slot plus one, zero marks an unused entry. The index
+ * has at least twice as many entries as the list has slots.
+ */
+#define RPL_INDEX_BITS LOG2CEIL(2 * CONFIG_BT_MESH_CRPL)
+#define RPL_INDEX_SIZE BIT(RPL_INDEX_BITS)
+
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+static uint16_t rpl_count;
+static bool rpl_index_valid;
+
+static uint32_t rpl_index_hash(uint16_t src)
+{
+	/* Fibonacci hashing, the upper bits are the best mixed ones. */
+	return ((uint32_t)src * 2654435769U) >> (32 - RPL_INDEX_BITS);
+}
+
+static void rpl_index_insert(uint16_t src, uint16_t slot)
+{
+	uint32_t i = rpl_index_hash(src);
+
+	while (rpl_index[i]) {
+		i = (i + 1) & (RPL_INDEX_SIZE - 1);
+	}
+
+	rpl_index[i] = slot + 1;
+}
+
+static struct bt_mesh_rpl *rpl_index_find(uint16_t src)
+{
+	uint32_t i = rpl_index_hash(src);
+
+	/* The index is at most half full, so the probe always ends. */
+	while (rpl_index[i]) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[i] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+
+		i = (i + 1) & (RPL_INDEX_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+static void rpl_index_build(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+
+	/* Used slots are kept at the start of the list. */
+	for (rpl_count = 0; rpl_count < ARRAY_SIZE(replay_list); rpl_count++) {
+		if (!replay_list[rpl_count].src) {
+			break;
+		}
+
+		rpl_index_insert(replay_list[rpl_count].src, rpl_count);
+	}
+
+	rpl_index_valid = true;
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
+	if (!rpl->src) {
+		rpl_index_insert(rx->ctx.addr, rpl - replay_list);
+		rpl_count++;
+	} else if (rpl->src != rx->ctx.addr) {
+		/* Two pending segmented messages got the same empty slot. */
+		rpl_index_valid = false;
+	}
+
 	/* If this is the first message on the new IV index, we should reset it
 	 * to zero to avoid invalid combinations of IV index and seg.
 	 */
@@ -45,7 +117,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,11 +129,20 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	if (!rpl_index_valid) {
+		rpl_index_build();
+	}
 
-		/* Empty slot */
-		if (!rpl->src) {
+	rpl = rpl_index_find(rx->ctx.addr);
+
+	/* Existing slot for given address */
+	if (rpl) {
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
+
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
 			if (match) {
 				*match = rpl;
 			} else {
@@ -69,27 +150,22 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 			}
 
 			return false;
+		} else {
+			return true;
 		}
+	}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+	/* Empty slot */
+	if (rpl_count < ARRAY_SIZE(replay_list)) {
+		rpl = &replay_list[rpl_count];
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
-
-				return false;
-			} else {
-				return true;
-			}
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
 	LOG_ERR("RPL is full!");
@@ -99,6 +175,7 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	rpl_index_valid = false;
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +207,7 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+	rpl_index_valid = false;
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
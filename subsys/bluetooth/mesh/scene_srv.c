@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/bluetooth/mesh/access.h>
 #include <bluetooth/mesh/models.h>
 #include <zephyr/sys/byteorder.h>
@@ -384,6 +385,50 @@ static ssize_t entry_store(const struct bt_mesh_model *mod,
 	return sizeof(struct scene_data) + data->len;
 }
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_STORE_SKIP_UNCHANGED)
+struct page_cmp {
+	const uint8_t *buf;
+	size_t len;
+	bool equal;
+};
+
+static int page_cmp_cb(const char *key, size_t len, settings_read_cb read_cb,
+		       void *cb_arg, void *param)
+{
+	struct page_cmp *cmp = param;
+	uint8_t buf[SCENE_PAGE_SIZE];
+	ssize_t size;
+
+	if ((key && *key) || len != cmp->len) {
+		return 0;
+	}
+
+	size = read_cb(cb_arg, buf, sizeof(buf));
+	cmp->equal = (size == cmp->len && !memcmp(buf, cmp->buf, size));
+	return 0;
+}
+
+/** Check whether the stored page already holds the given data. */
+static bool page_unchanged(struct bt_mesh_scene_srv *srv, const char *path,
+			   const uint8_t buf[], size_t len)
+{
+	struct page_cmp cmp = {
+		.buf = buf,
+		.len = len,
+	};
+	char key[40];
+
+	sprintf(key, "bt/mesh/s/%x/data/%s",
+		(srv->model->rt->elem_idx << 8) | srv->model->rt->mod_idx, path);
+
+	if (settings_load_subtree_direct(key, page_cmp_cb, &cmp)) {
+		return false;
+	}
+
+	return cmp.equal;
+}
+#endif
+
 /** Store a single page of the Scene.
  *
  *  To accommodate large scene data, each scene is stored in pages of up to 256
@@ -398,6 +443,16 @@ static void page_store(struct bt_mesh_scene_srv *srv, uint16_t scene,
 	scene_path(path, scene, vnd, page);
 	update_page_count(srv, vnd, page);
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_STORE_SKIP_UNCHANGED)
+	/* Storing the same scene again usually leaves most pages unchanged.
+	 * Skip the flash write for those.
+	 */
+	if (page_unchanged(srv, path, buf, len)) {
+		LOG_DBG("%s unchanged", path);
+		return;
+	}
+#endif
+
 	err = bt_mesh_model_data_store(srv->model, false, path, buf, len);
 	if (err) {
 		LOG_ERR("Failed storing %s: %d", path, err);
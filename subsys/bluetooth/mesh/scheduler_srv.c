@@ -74,15 +74,20 @@ static int get_days_in_month(int year, int month)
 	return days[month];
 }
 
+static int leap_years_before(int year)
+{
+	year--;
+	return year / 4 - year / 100 + year / 400;
+}
+
 static int get_day_of_week(int year, int month, int day)
 {
-	int day_cnt = 0;
+	int day_cnt;
 
 	year += TM_START_YEAR;
 
-	for (int i = TM_START_YEAR; i < year; i++) {
-		day_cnt += is_leap_year(i) ? DAYS_LEAP_YEAR : DAYS_YEAR;
-	}
+	day_cnt = (year - TM_START_YEAR) * DAYS_YEAR +
+		  leap_years_before(year) - leap_years_before(TM_START_YEAR);
 
 	for (int i = 0; i < month; i++) {
 		day_cnt += get_days_in_month(year, i);
@@ -379,14 +384,16 @@ static bool convert_scheduler_time_to_tm(struct tm *sched_time,
 
 static uint8_t get_least_time_index(struct bt_mesh_scheduler_srv *srv)
 {
-	uint8_t cnt = u32_count_trailing_zeros(srv->active_bitmap);
-	uint8_t idx = cnt;
+	uint8_t idx = u32_count_trailing_zeros(srv->active_bitmap);
+	uint32_t rest = srv->active_bitmap & (srv->active_bitmap - 1);
 
-	while (++cnt < BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT) {
-		if (srv->active_bitmap & BIT(cnt)) {
-			idx = srv->sched_tai[idx].sec >
-				srv->sched_tai[cnt].sec ? cnt : idx;
-		}
+	/* Only visit the active entries. */
+	while (rest) {
+		uint8_t cnt = u32_count_trailing_zeros(rest);
+
+		idx = srv->sched_tai[idx].sec >
+			srv->sched_tai[cnt].sec ? cnt : idx;
+		rest &= rest - 1;
 	}
 
 	return MIN(BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT, idx);
@@ -418,23 +425,28 @@ static void run_scheduler(struct bt_mesh_scheduler_srv *srv)
 			scheduled_uptime, current_uptime);
 }
 
-static void schedule_action(struct bt_mesh_scheduler_srv *srv,
-			    uint8_t idx)
+static struct tm *current_local_get(struct bt_mesh_scheduler_srv *srv)
 {
-	struct tm sched_time = {0};
-	struct bt_mesh_schedule_entry *entry = &srv->sch_reg[idx];
-
 	int64_t current_uptime = k_uptime_get();
 	struct tm *current_local = bt_mesh_time_srv_localtime(srv->time_srv,
 			current_uptime);
 
 	if (current_local == NULL) {
 		LOG_WRN("Local time not available");
-		return;
+		return NULL;
 	}
 
 	LOG_DBG("Current uptime %lld", current_uptime);
 
+	return current_local;
+}
+
+static void schedule_action_at(struct bt_mesh_scheduler_srv *srv,
+			       uint8_t idx, struct tm *current_local)
+{
+	struct tm sched_time = {0};
+	struct bt_mesh_schedule_entry *entry = &srv->sch_reg[idx];
+
 	LOG_DBG("Current time:");
 	LOG_DBG("        year: %d", current_local->tm_year);
 	LOG_DBG("       month: %d", current_local->tm_mon);
@@ -464,6 +476,16 @@ static void schedule_action(struct bt_mesh_scheduler_srv *srv,
 	WRITE_BIT(srv->active_bitmap, idx, 1);
 }
 
+static void schedule_action(struct bt_mesh_scheduler_srv *srv,
+			    uint8_t idx)
+{
+	struct tm *current_local = current_local_get(srv);
+
+	if (current_local) {
+		schedule_action_at(srv, idx, current_local);
+	}
+}
+
 static void scheduled_action_handle(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -841,8 +863,19 @@ int bt_mesh_scheduler_srv_time_update(struct bt_mesh_scheduler_srv *srv)
 		return -EINVAL;
 	}
 
+	/* The local time is the same for all entries, so it's only converted
+	 * once per update.
+	 */
+	struct tm *current_local = current_local_get(srv);
+
+	if (current_local == NULL) {
+		return 0;
+	}
+
 	for (int idx = 0; idx < BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT; ++idx) {
-		schedule_action(srv, idx);
+		if (is_entry_defined(srv, idx)) {
+			schedule_action_at(srv, idx, current_local);
+		}
 	}
 
 	run_scheduler(srv);
@@ -881,20 +881,53 @@ static uint16_t min_int_get(const struct bt_mesh_sensor *sensor,
 	return DIV_ROUND_UP(min_int, pub_int);
 }
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_UNSEG)
+/* Largest access payload that fits in an unsegmented message. */
+#define PUB_UNSEG_MAX (BT_MESH_APP_UNSEG_SDU_MAX - BT_MESH_MIC_SHORT)
+
+static struct bt_mesh_sensor *pub_first_take(struct bt_mesh_sensor_srv *srv)
+{
+	struct bt_mesh_sensor *s = srv->pub_next;
+
+	srv->pub_next = NULL;
+	return s;
+}
+
+static void pub_deferred(struct bt_mesh_sensor_srv *srv, struct bt_mesh_sensor *s)
+{
+	if (!srv->pub_next) {
+		srv->pub_next = s;
+	}
+}
+#else
+static struct bt_mesh_sensor *pub_first_take(struct bt_mesh_sensor_srv *srv)
+{
+	return NULL;
+}
+
+static void pub_deferred(struct bt_mesh_sensor_srv *srv, struct bt_mesh_sensor *s)
+{
+}
+#endif
+
 /** @brief Conditionally add a sensor value to a publication.
  *
  *  A sensor message will be added to the publication if its minimum interval
  *  has expired and the value is outside its delta threshold or the
  *  publication interval has expired.
  *
- *  @param srv         Server sending the publication.
- *  @param s           Sensor to add data of.
- *  @param period_div  Server's original period divisor.
- *  @param base_period Server's original base period.
+ *  @param srv          Server sending the publication.
+ *  @param s            Sensor to add data of.
+ *  @param period_div   Server's original period divisor.
+ *  @param base_period  Server's original base period.
+ *  @param original_len Length of the publication without sensor data.
+ *
+ *  @return -EMSGSIZE if the sensor value was left out to keep the publication
+ *          unsegmented, 0 otherwise.
  */
-static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
-			struct bt_mesh_sensor *s, uint8_t period_div,
-			uint32_t base_period)
+static int pub_msg_add(struct bt_mesh_sensor_srv *srv,
+		       struct bt_mesh_sensor *s, uint8_t period_div,
+		       uint32_t base_period, uint32_t original_len)
 {
 	struct net_buf_simple_state state;
 	uint16_t min_int = min_int_get(s, period_div, base_period);
@@ -902,7 +935,7 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 	int err;
 
 	if (delta < min_int) {
-		return;
+		return 0;
 	}
 
 	if (!s->state.configured &&
@@ -910,14 +943,14 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 		/** Don't publish a sensor value with not configured sensor cadence state more
 		 * frequently than base periodic publication.
 		 */
-		return;
+		return 0;
 	}
 
 	sensor_value_type value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX] = {};
 
 	err = value_get(srv, s, NULL, value);
 	if (err) {
-		return;
+		return 0;
 	}
 
 	if (s->state.configured) {
@@ -925,7 +958,7 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 		uint16_t interval = pub_int_get(s, period_div);
 
 		if (!delta_triggered && delta < interval) {
-			return;
+			return 0;
 		}
 	}
 
@@ -934,11 +967,21 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 	if (err) {
 		LOG_WRN("Pub sensor value encode for 0x%04x: %d", s->type->id, err);
 		net_buf_simple_restore(srv->pub.msg, &state);
-		return;
+		return 0;
 	}
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_PUB_UNSEG)
+	if (srv->pub.msg->len > PUB_UNSEG_MAX && state.len > original_len) {
+		/* Leave the value to the next publication. */
+		net_buf_simple_restore(srv->pub.msg, &state);
+		return -EMSGSIZE;
+	}
+#endif
+
 	s->state.prev = value[0];
 	s->state.seq = srv->seq;
+
+	return 0;
 }
 
 static int update_handler(const struct bt_mesh_model *model)
@@ -965,9 +1008,19 @@ static int update_handler(const struct bt_mesh_model *model)
 
 	srv->pub.fast_period = true;
 
+	/* Sensors left out of the previous publication go first. */
+	struct bt_mesh_sensor *first = pub_first_take(srv);
+
 	SENSOR_FOR_EACH(&srv->sensors, s)
 	{
-		pub_msg_add(srv, s, period_div, base_period);
+		if (s == first) {
+			first = NULL;
+		}
+
+		if (!first &&
+		    pub_msg_add(srv, s, period_div, base_period, original_len) == -EMSGSIZE) {
+			pub_deferred(srv, s);
+		}
 
 		/** Update the publication divisor to a new value. This is needed to take new
 		 * changes in a sensor cadence state, .e.g. when the cadence decreased.
@@ -1055,6 +1108,7 @@ static void sensor_srv_reset(const struct bt_mesh_model *model)
 	}
 
 	srv->pub.period_div = 0;
+	(void)pub_first_take(srv);
 
 	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)bt_mesh_model_data_store(srv->model, false, NULL, NULL,
@@ -15,22 +15,29 @@ static const uint8_t month_cfg[12] = { 31, 28, 31, 30, 31, 30,
 static const uint8_t month_leap_cfg[12] = { 31, 29, 31, 30, 31, 30,
 					 31, 31, 30, 31, 30, 31 };
 
+static uint32_t leap_years_before(uint32_t year)
+{
+	year--;
+	return year / 4 - year / 100 + year / 400;
+}
+
+/* Number of days from the start of the TAI epoch to the start of the year. */
+static uint64_t days_before_year(uint32_t year)
+{
+	return (year - TAI_START_YEAR) * DAYS_YEAR +
+	       leap_years_before(year) - leap_years_before(TAI_START_YEAR);
+}
+
 int ts_to_tai(struct bt_mesh_time_tai *tai, const struct tm *timeptr)
 {
 	uint32_t current_year = timeptr->tm_year + TM_START_YEAR;
-	uint32_t days = 0;
+	uint32_t days;
 
 	if (current_year < TAI_START_YEAR) {
 		return -EAGAIN;
 	}
 
-	for (int year = TAI_START_YEAR; year < current_year; year++) {
-		if (is_leap_year(year)) {
-			days += DAYS_LEAP_YEAR;
-		} else {
-			days += DAYS_YEAR;
-		}
-	}
+	days = days_before_year(current_year);
 
 	const uint8_t *months =
 		is_leap_year(current_year) ? month_leap_cfg : month_cfg;
@@ -61,18 +68,17 @@ void tai_to_ts(const struct bt_mesh_time_tai *tai, struct tm *timeptr)
 	timeptr->tm_wday = (TAI_START_DAY + day_cnt) % WEEKDAY_CNT;
 	timeptr->tm_isdst = -1;
 
-	for (year = TAI_START_YEAR;; year++) {
-		is_leap = is_leap_year(year);
-
-		uint32_t days_in_year = is_leap ? DAYS_LEAP_YEAR : DAYS_YEAR;
-
-		if (days_in_year > day_cnt) {
-			break;
-		}
-
-		day_cnt -= days_in_year;
+	/* Every year has at least 365 days, so this estimate is never too
+	 * early. It only overshoots by one year per ~1500 years of leap days.
+	 */
+	year = TAI_START_YEAR + day_cnt / DAYS_YEAR;
+	while (days_before_year(year) > day_cnt) {
+		year--;
 	}
 
+	day_cnt -= days_before_year(year);
+	is_leap = is_leap_year(year);
+
 	timeptr->tm_yday = day_cnt;
 	timeptr->tm_year = year - TM_START_YEAR;
 
@@ -789,7 +789,14 @@ void bt_gatt_notify_params_dec(struct ser_scratchpad *scratchpad,
 
 	data->attr = bt_rpc_decode_gatt_attr(ctx);
 	data->len = ser_decode_uint(ctx);
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ZERO_COPY)
+	size_t buffer_size;
+
+	/* Points into the received packet, valid until decoding is done. */
+	data->data = ser_decode_buffer_ptr_and_size(ctx, &buffer_size);
+#else
 	data->data = ser_decode_buffer_into_scratchpad(scratchpad, NULL);
+#endif
 	data->func = (bt_gatt_complete_func_t)ser_decode_callback(ctx,
 								   bt_gatt_complete_func_t_encoder);
 	data->user_data = (void *)(uintptr_t)ser_decode_uint(ctx);
@@ -812,11 +819,25 @@ static void bt_gatt_notify_cb_rpc_handler(const struct nrf_rpc_group *group,
 	conn = bt_rpc_decode_bt_conn(ctx);
 	bt_gatt_notify_params_dec(&scratchpad, &params);
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ZERO_COPY)
+	if (!ser_decode_valid(ctx)) {
+		ser_decoding_done_and_check(group, ctx);
+		goto decoding_error;
+	}
+
+	/* The notification data is still in the received packet, so it can
+	 * only be released once the stack has copied it.
+	 */
+	result = bt_gatt_notify_cb(conn, &params);
+
+	ser_decoding_done_and_check(group, ctx);
+#else
 	if (!ser_decoding_done_and_check(group, ctx)) {
 		goto decoding_error;
 	}
 
 	result = bt_gatt_notify_cb(conn, &params);
+#endif
 
 	ser_rsp_send_int(group, result);
 
@@ -6,6 +6,8 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <stdlib.h>
 #include <string.h>
 #include <bluetooth/scan.h>
 
@@ -89,6 +91,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Bloom filter of the addresses, see addr_bloom_bits(). */
+	uint32_t bloom;
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -225,11 +230,40 @@ struct conn_blocklist {
 	/* Array of the blocklist devices. */
 	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN];
 
+	/* Bloom filter of the addresses, see addr_bloom_bits(). */
+	uint32_t bloom;
+
 	/* Blocklist device count. */
 	uint32_t count;
 };
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DUPLICATE_FILTER
+/* Duplicate filter device */
+struct duplicate_filter_device {
+	/* Device address. */
+	bt_addr_le_t addr;
+
+	/* CRC32 of the advertising data of the last forwarded report. */
+	uint32_t ad_hash;
+
+	/* Uptime of the last forwarded report, in milliseconds. */
+	uint32_t timestamp;
+
+	/* RSSI of the last forwarded report. */
+	int8_t rssi;
+
+	/* The entry holds a device. */
+	bool used;
+};
+
+/* Duplicate report filter. */
+struct duplicate_filter {
+	/* Array of the recently reported devices. */
+	struct duplicate_filter_device device[CONFIG_BT_SCAN_DUPLICATE_FILTER_LEN];
+};
+#endif /* CONFIG_BT_SCAN_DUPLICATE_FILTER */
+
 /* Scanning module instance. Options for the different scanning modes.
  * This structure stores all module settings. It is used to enable
  * or disable scanning modes and to configure filters.
@@ -266,6 +300,11 @@ static struct bt_scan {
 	struct conn_blocklist blocklist;
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DUPLICATE_FILTER
+	/* Scan duplicate report filter. */
+	struct duplicate_filter duplicate_filter;
+#endif /* CONFIG_BT_SCAN_DUPLICATE_FILTER */
+
 } bt_scan;
 
 static sys_slist_t callback_list;
@@ -330,10 +369,30 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 }
 #endif /* CONFIG_BT_CENTRAL */
 
+/* Two bits of a 32-bit Bloom filter for an address. An address list is
+ * only searched if all the bits of the address are set in the filter of
+ * the list, which rejects most of the advertisers without a compare.
+ */
+static uint32_t addr_bloom_bits(const bt_addr_le_t *addr)
+{
+	uint32_t hash = addr->type;
+
+	for (size_t i = 0; i < sizeof(addr->a.val); i++) {
+		hash = (hash * 31) + addr->a.val[i];
+	}
+
+	return BIT(hash & 0x1f) | BIT((hash >> 5) & 0x1f);
+}
+
 #if CONFIG_BT_SCAN_BLOCKLIST
 static bool blocklist_device_check(const bt_addr_le_t *addr)
 {
 	bool blocklist_device = false;
+	uint32_t bits = addr_bloom_bits(addr);
+
+	if ((bt_scan.blocklist.bloom & bits) != bits) {
+		return false;
+	}
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
@@ -351,6 +410,70 @@ static bool blocklist_device_check(const bt_addr_le_t *addr)
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DUPLICATE_FILTER
+static bool duplicate_report_check(const struct bt_le_scan_recv_info *info,
+				   const struct net_buf_simple *ad)
+{
+	struct duplicate_filter *filter = &bt_scan.duplicate_filter;
+	struct duplicate_filter_device *device = NULL;
+	struct duplicate_filter_device *oldest = NULL;
+	uint32_t hash = crc32_ieee(ad->data, ad->len);
+	uint32_t now = k_uptime_get_32();
+	bool duplicate = false;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(filter->device); i++) {
+		struct duplicate_filter_device *entry = &filter->device[i];
+
+		if (!entry->used) {
+			if (!oldest || oldest->used) {
+				oldest = entry;
+			}
+
+			continue;
+		}
+
+		if (bt_addr_le_cmp(&entry->addr, info->addr) == 0) {
+			device = entry;
+			break;
+		}
+
+		if (!oldest ||
+		    (oldest->used && ((now - entry->timestamp) > (now - oldest->timestamp)))) {
+			oldest = entry;
+		}
+	}
+
+	if (device) {
+		int rssi_delta = abs(info->rssi - device->rssi);
+
+		duplicate = (device->ad_hash == hash) &&
+			    ((now - device->timestamp) < CONFIG_BT_SCAN_DUPLICATE_FILTER_TTL);
+
+		if (CONFIG_BT_SCAN_DUPLICATE_FILTER_RSSI_DELTA &&
+		    (rssi_delta >= CONFIG_BT_SCAN_DUPLICATE_FILTER_RSSI_DELTA)) {
+			duplicate = false;
+		}
+	} else {
+		/* Replace the least recently reported device. */
+		device = oldest;
+		bt_addr_le_copy(&device->addr, info->addr);
+		device->used = true;
+	}
+
+	if (!duplicate) {
+		device->ad_hash = hash;
+		device->rssi = info->rssi;
+		device->timestamp = now;
+	}
+
+	k_mutex_unlock(&scan_mutex);
+
+	return duplicate;
+}
+#endif /* CONFIG_BT_SCAN_DUPLICATE_FILTER */
+
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 				      const bt_addr_le_t *addr)
@@ -512,6 +635,11 @@ static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	uint32_t bits = addr_bloom_bits(target_addr);
+
+	if ((bt_scan.scan_filters.addr.bloom & bits) != bits) {
+		return false;
+	}
 
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
@@ -564,6 +692,7 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	bt_scan.scan_filters.addr.bloom |= addr_bloom_bits(target_addr);
 
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
@@ -764,43 +893,21 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+static uint8_t uuid_len_get(uint8_t uuid_type)
 {
-	uint8_t uuid_len;
-
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
-		break;
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
 
 	default:
-		return false;
-	}
-
-	for (size_t i = 0; i < data_len; i += uuid_len) {
-		struct bt_uuid_128 uuid;
-
-		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
-			return false;
-		}
-
-		if (bt_uuid_cmp(&uuid.uuid, target_uuid->uuid) == 0) {
-			return true;
-		}
+		return 0;
 	}
-
-	return false;
 }
 
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
@@ -810,13 +917,44 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	const uint8_t uuid_len = uuid_len_get(uuid_type);
 	uint8_t data_len = data->data_len;
+	uint8_t uuid_found_cnt = 0;
 	uint8_t uuid_match_cnt = 0;
+	bool found[CONFIG_BT_SCAN_UUID_CNT];
 
-	for (size_t i = 0; i < counter; i++) {
+	if (uuid_len == 0) {
+		return false;
+	}
+
+	memset(found, 0, sizeof(found));
 
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
+	/* Each UUID of the advertising data is decoded once
+	 * and compared with all the filters.
+	 */
+	for (size_t i = 0; (i + uuid_len) <= data_len; i += uuid_len) {
+		struct bt_uuid_128 uuid;
+
+		if (!bt_uuid_create(&uuid.uuid, &data->data[i], uuid_len)) {
+			break;
+		}
+
+		for (size_t j = 0; j < counter; j++) {
+			if (!found[j] &&
+			    (bt_uuid_cmp(&uuid.uuid, uuid_filter->uuid[j].uuid) == 0)) {
+				found[j] = true;
+				uuid_found_cnt++;
+			}
+		}
+
+		if (uuid_found_cnt == counter) {
+			break;
+		}
+	}
+
+	/* Report the matches in the order of the filters. */
+	for (size_t i = 0; i < counter; i++) {
+		if (found[i]) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
 
@@ -828,9 +966,6 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			if (!all_filters_mode) {
 				break;
 			}
-
-		} else if (all_filters_mode) {
-			break;
 		}
 	}
 
@@ -1229,6 +1364,7 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	addr_filter->bloom = 0;
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
@@ -1408,6 +1544,21 @@ static void check_enabled_filters(struct bt_scan_control *control)
 	}
 }
 
+static bool adv_data_check_needed(const struct bt_scan_control *control)
+{
+	/* In the multifilter mode, a device that does not match
+	 * the address filter cannot match anymore.
+	 */
+	if (control->all_mode && is_addr_filter_enabled() &&
+	    !control->filter_status.addr.match) {
+		return false;
+	}
+
+	return is_name_filter_enabled() || is_short_name_filter_enabled() ||
+	       is_uuid_filter_enabled() || is_appearance_filter_enabled() ||
+	       is_manufacturer_data_filter_enabled();
+}
+
 static bool adv_data_found(struct bt_data *data, void *user_data)
 {
 	struct bt_scan_control *scan_control =
@@ -1497,6 +1648,12 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	struct bt_scan_control scan_control;
 	struct net_buf_simple_state state;
 
+#if CONFIG_BT_SCAN_DUPLICATE_FILTER
+	if (duplicate_report_check(info, ad)) {
+		return;
+	}
+#endif /* CONFIG_BT_SCAN_DUPLICATE_FILTER */
+
 	memset(&scan_control, 0, sizeof(scan_control));
 
 	scan_control.all_mode = bt_scan.scan_filters.all_mode;
@@ -1513,9 +1670,11 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	/* Save advertising buffer state to transfer it
 	 * data to application if futher processing is needed.
 	 */
-	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
-	net_buf_simple_restore(ad, &state);
+	if (adv_data_check_needed(&scan_control)) {
+		net_buf_simple_save(ad, &state);
+		bt_data_parse(ad, adv_data_found, (void *)&scan_control);
+		net_buf_simple_restore(ad, &state);
+	}
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -1604,6 +1763,7 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+		bt_scan.blocklist.bloom |= addr_bloom_bits(addr);
 		bt_scan.blocklist.count++;
 		LOG_INF("Device %s added to the scanning blocklist", addr_str);
 	}
@@ -1622,6 +1782,15 @@ void bt_scan_blocklist_clear(void)
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DUPLICATE_FILTER
+void bt_scan_duplicate_filter_clear(void)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	memset(&bt_scan.duplicate_filter, 0, sizeof(bt_scan.duplicate_filter));
+	k_mutex_unlock(&scan_mutex);
+}
+#endif /* CONFIG_BT_SCAN_DUPLICATE_FILTER */
+
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 void bt_scan_conn_attempts_filter_clear(void)
 {
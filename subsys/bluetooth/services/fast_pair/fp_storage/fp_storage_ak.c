@@ -312,12 +312,18 @@ int fp_storage_ak_find(struct fp_account_key *account_key,
 
 	for (size_t i = 0; i < account_key_count; i++) {
 		if (account_key_check_cb(&account_key_list[i], context)) {
-			int err;
+			uint8_t id = ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[i], ID);
+			int err = 0;
 
-			ak_order_update_ram(ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[i],
-									   ID));
-			err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-						sizeof(account_key_order));
+			/* Avoid a settings write when the most recently used key is used again,
+			 * as it happens during Key-based Pairing in the caller's context.
+			 */
+			if (account_key_order[0] != id) {
+				ak_order_update_ram(id);
+				err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME,
+							account_key_order,
+							sizeof(account_key_order));
+			}
 			if (err) {
 				LOG_ERR("Unable to save new Account Key order in Settings. "
 					"Not propagating the error and keeping updated Account Key "
@@ -1154,6 +1154,69 @@ int bt_hids_inp_rep_send(struct bt_hids *hids_obj,
 	return err;
 }
 
+#if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
+int bt_hids_inp_rep_send_multiple(struct bt_hids *hids_obj, struct bt_conn *conn,
+				  const struct bt_hids_inp_rep_data *reps, size_t count,
+				  bt_gatt_complete_func_t cb)
+{
+	struct bt_gatt_notify_params params[CONFIG_BT_HIDS_INPUT_REP_MAX];
+	struct bt_hids_conn_data *conn_data;
+	int err;
+
+	if (!conn || !reps || (count == 0) || (count > ARRAY_SIZE(params))) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct bt_hids_inp_rep *hids_inp_rep;
+
+		if (reps[i].rep_index >= hids_obj->inp_rep_group.cnt) {
+			return -EINVAL;
+		}
+
+		hids_inp_rep = &hids_obj->inp_rep_group.reports[reps[i].rep_index];
+
+		if (hids_inp_rep->size != reps[i].len) {
+			return -EINVAL;
+		}
+
+		if (!bt_gatt_is_subscribed(conn, &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind],
+					   BT_GATT_CCC_NOTIFY)) {
+			return -EACCES;
+		}
+	}
+
+	/* The connection context is looked up once for the whole batch. */
+	conn_data = bt_conn_ctx_get(hids_obj->conn_ctx, conn);
+	if (!conn_data) {
+		LOG_WRN("The context was not found");
+		return -EINVAL;
+	}
+
+	memset(params, 0, sizeof(params));
+
+	for (size_t i = 0; i < count; i++) {
+		struct bt_hids_inp_rep *hids_inp_rep =
+			&hids_obj->inp_rep_group.reports[reps[i].rep_index];
+
+		store_input_report(hids_inp_rep, conn_data->inp_rep_ctx + hids_inp_rep->offset,
+				   reps[i].rep, reps[i].len);
+
+		params[i].attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind];
+		params[i].data = reps[i].rep;
+		params[i].len = hids_inp_rep->size;
+	}
+
+	params[count - 1].func = cb;
+
+	err = bt_gatt_notify_multiple(conn, count, params);
+
+	bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
+
+	return err;
+}
+#endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
+
 static int boot_mouse_inp_report_notify_all(
 	struct bt_hids *hids_obj, const uint8_t *buttons,
 	struct bt_hids_boot_mouse_inp_rep *boot_mouse_inp_rep,
@@ -7,6 +7,7 @@
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <zephyr/bluetooth/gatt.h>
+#include <zephyr/sys/ring_buffer.h>
 
 #include <bluetooth/services/nus.h>
 #include <zephyr/logging/log.h>
@@ -81,6 +82,113 @@ BT_GATT_PRIMARY_SERVICE(BT_UUID_NUS_SERVICE),
 			       NULL, on_receive, NULL),
 );
 
+#if defined(CONFIG_BT_NUS_TX_STREAM)
+RING_BUF_DECLARE(tx_stream_buf, CONFIG_BT_NUS_TX_STREAM_BUF_SIZE);
+static K_SEM_DEFINE(tx_stream_credits, CONFIG_BT_NUS_TX_STREAM_CREDITS,
+		    CONFIG_BT_NUS_TX_STREAM_CREDITS);
+static struct bt_conn *tx_stream_conn;
+
+static void tx_stream_work_handler(struct k_work *work);
+static K_WORK_DEFINE(tx_stream_work, tx_stream_work_handler);
+
+static void tx_stream_sent(struct bt_conn *conn, void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(user_data);
+
+	k_sem_give(&tx_stream_credits);
+	k_work_submit(&tx_stream_work);
+}
+
+static void tx_stream_work_handler(struct k_work *work)
+{
+	struct bt_gatt_notify_params params = {0};
+
+	ARG_UNUSED(work);
+
+	params.attr = &nus_svc.attrs[2];
+	params.func = tx_stream_sent;
+
+	while (tx_stream_conn && !ring_buf_is_empty(&tx_stream_buf)) {
+		uint8_t *data;
+		uint32_t len;
+		int err;
+
+		if (k_sem_take(&tx_stream_credits, K_NO_WAIT)) {
+			/* Resumed when a notification completes. */
+			return;
+		}
+
+		/* The data is sent from the ring buffer, as the notification
+		 * is copied to a host buffer before bt_gatt_notify_cb returns.
+		 */
+		len = ring_buf_get_claim(&tx_stream_buf, &data, bt_nus_get_mtu(tx_stream_conn));
+
+		params.data = data;
+		params.len = len;
+
+		err = bt_gatt_notify_cb(tx_stream_conn, &params);
+		if (err) {
+			k_sem_give(&tx_stream_credits);
+			(void)ring_buf_get_finish(&tx_stream_buf, 0);
+
+			if (err != -ENOMEM) {
+				LOG_WRN("Stream notification failed, err %d", err);
+			}
+
+			/* Retried when a notification completes. */
+			return;
+		}
+
+		(void)ring_buf_get_finish(&tx_stream_buf, len);
+	}
+}
+
+static void tx_stream_disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	ARG_UNUSED(reason);
+
+	if (conn != tx_stream_conn) {
+		return;
+	}
+
+	k_work_cancel(&tx_stream_work);
+	bt_conn_unref(tx_stream_conn);
+	tx_stream_conn = NULL;
+	ring_buf_reset(&tx_stream_buf);
+}
+
+BT_CONN_CB_DEFINE(nus_conn_callbacks) = {
+	.disconnected = tx_stream_disconnected,
+};
+
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, size_t len)
+{
+	uint32_t queued;
+
+	if (!conn || !data) {
+		return -EINVAL;
+	}
+
+	if (!bt_gatt_is_subscribed(conn, &nus_svc.attrs[2], BT_GATT_CCC_NOTIFY)) {
+		return -EINVAL;
+	}
+
+	if (!tx_stream_conn) {
+		tx_stream_conn = bt_conn_ref(conn);
+	} else if (tx_stream_conn != conn) {
+		return -EBUSY;
+	}
+
+	queued = ring_buf_put(&tx_stream_buf, data, len);
+	if (queued) {
+		k_work_submit(&tx_stream_work);
+	}
+
+	return queued;
+}
+#endif /* CONFIG_BT_NUS_TX_STREAM */
+
 int bt_nus_init(struct bt_nus_cb *callbacks)
 {
 	if (callbacks) {
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/types.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <ocrypto_constant_time.h>
+#include <bl_crypto.h>
+
+#define BUF_LEN_WORDS (CONFIG_SB_CRYPTO_FLASH_SHA256_BUF_SIZE / 4)
+
+BUILD_ASSERT((CONFIG_SB_CRYPTO_FLASH_SHA256_BUF_SIZE % 4) == 0,
+	     "CONFIG_SB_CRYPTO_FLASH_SHA256_BUF_SIZE must be a multiple of 4.");
+
+/* Not stack allocated because of its size. The data is hashed from RAM, so
+ * the CryptoCell backend can access it without copying it again.
+ */
+static uint32_t flash_buf[BUF_LEN_WORDS];
+
+int bl_sha256_flash_verify(const struct device *fdev, off_t offset, size_t len,
+			   const uint8_t *expected)
+{
+	bl_sha256_ctx_t ctx;
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+	int retval;
+
+	if (!fdev || !expected) {
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(fdev)) {
+		return -ENODEV;
+	}
+
+	retval = bl_sha256_init(&ctx);
+	if (retval != 0) {
+		return retval;
+	}
+
+	while (len > 0) {
+		size_t chunk_len = MIN(len, sizeof(flash_buf));
+
+		retval = flash_read(fdev, offset, flash_buf, chunk_len);
+		if (retval != 0) {
+			return retval;
+		}
+
+		retval = bl_sha256_update(&ctx, (const uint8_t *)flash_buf, chunk_len);
+		if (retval != 0) {
+			return retval;
+		}
+
+		offset += chunk_len;
+		len -= chunk_len;
+	}
+
+	retval = bl_sha256_finalize(&ctx, hash);
+	if (retval != 0) {
+		return retval;
+	}
+
+	if (!ocrypto_constant_time_equal(expected, hash, CONFIG_SB_HASH_LEN)) {
+		return -EHASHINV;
+	}
+
+	return 0;
+}
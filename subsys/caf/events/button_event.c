@@ -35,4 +35,6 @@ APP_EVENT_TYPE_DEFINE(button_event,
 		  &button_event_info,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_CAF_INIT_LOG_BUTTON_EVENTS,
-				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
+				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE,))
+			IF_ENABLED(CONFIG_CAF_BUTTON_EVENTS_HIGH_PRIORITY,
+				(APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY))));
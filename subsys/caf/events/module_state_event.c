@@ -32,9 +32,23 @@ static void log_module_state_event(const struct app_event_header *aeh)
 			module_name_get(event->module_id), state_name[event->state]);
 }
 
+static void profile_module_state_event(struct log_event_buf *buf,
+				       const struct app_event_header *aeh)
+{
+	const struct module_state_event *event = cast_module_state_event(aeh);
+
+	nrf_profiler_log_encode_string(buf, module_name_get(event->module_id));
+	nrf_profiler_log_encode_uint8(buf, event->state);
+}
+
+APP_EVENT_INFO_DEFINE(module_state_event,
+		  ENCODE(NRF_PROFILER_ARG_STRING, NRF_PROFILER_ARG_U8),
+		  ENCODE("module", "state"),
+		  profile_module_state_event);
+
 APP_EVENT_TYPE_DEFINE(module_state_event,
 		  log_module_state_event,
-		  NULL,
+		  &module_state_event_info,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_CAF_INIT_LOG_MODULE_STATE_EVENTS,
 				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
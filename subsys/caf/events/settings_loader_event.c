@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <caf/events/settings_loader_event.h>
+
+
+static void log_settings_subtree_loaded_event(const struct app_event_header *aeh)
+{
+	const struct settings_subtree_loaded_event *event =
+		cast_settings_subtree_loaded_event(aeh);
+
+	APP_EVENT_MANAGER_LOG(aeh, "subtree: %s", event->subtree);
+}
+
+static void profile_settings_subtree_loaded_event(struct log_event_buf *buf,
+						  const struct app_event_header *aeh)
+{
+	(void)buf;
+	(void)aeh;
+}
+
+APP_EVENT_INFO_DEFINE(settings_subtree_loaded_event,
+		  ENCODE(),
+		  ENCODE(),
+		  profile_settings_subtree_loaded_event);
+
+APP_EVENT_TYPE_DEFINE(settings_subtree_loaded_event,
+		  log_settings_subtree_loaded_event,
+		  &settings_subtree_loaded_event_info,
+		  APP_EVENT_FLAGS_CREATE(
+			IF_ENABLED(CONFIG_CAF_INIT_LOG_SETTINGS_SUBTREE_LOADED_EVENTS,
+				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
@@ -62,9 +62,83 @@ enum peer_rpa {
 
 static enum peer_rpa peer_is_rpa[CONFIG_BT_ID_MAX];
 
+/* Fast advertising time is not shortened more than 2^FAST_ADV_MISS_CNT_MAX times. */
+#define FAST_ADV_MISS_CNT_MAX	8
+static uint8_t fast_adv_miss_cnt;
+
+/* Direct advertising with high duty cycle uses 3.75 ms interval. */
+#define DIRECT_ADV_HIGH_DUTY_INT	0x0006
+
+struct adv_stats {
+	int64_t seg_start;
+	uint16_t seg_interval;
+	uint16_t cur_interval;
+	uint32_t adv_ms;
+	uint32_t adv_evt_cnt;
+	uint32_t conn_cnt;
+	uint64_t total_adv_evt_cnt;
+};
+
+static struct adv_stats adv_stats;
+
 
 static void update_state(enum state new_state);
 
+static void adv_stats_seg_end(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_STATS) || (adv_stats.seg_interval == 0)) {
+		return;
+	}
+
+	uint32_t seg_ms = k_uptime_get() - adv_stats.seg_start;
+
+	adv_stats.adv_ms += seg_ms;
+	/* Interval is expressed in units of 0.625 ms. */
+	adv_stats.adv_evt_cnt += (seg_ms * 8) / (adv_stats.seg_interval * 5);
+	adv_stats.seg_interval = 0;
+}
+
+static void adv_stats_seg_start(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_STATS)) {
+		return;
+	}
+
+	adv_stats_seg_end();
+	adv_stats.seg_start = k_uptime_get();
+	adv_stats.seg_interval = adv_stats.cur_interval;
+}
+
+static void adv_stats_connected(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_STATS)) {
+		return;
+	}
+
+	adv_stats_seg_end();
+
+	adv_stats.conn_cnt++;
+	adv_stats.total_adv_evt_cnt += adv_stats.adv_evt_cnt;
+
+	LOG_INF("Connected after %" PRIu32 " ms of advertising, ~%" PRIu32 " adv events "
+		"(average: %" PRIu32 " adv events per connection)",
+		adv_stats.adv_ms, adv_stats.adv_evt_cnt,
+		(uint32_t)(adv_stats.total_adv_evt_cnt / adv_stats.conn_cnt));
+
+	adv_stats.adv_ms = 0;
+	adv_stats.adv_evt_cnt = 0;
+}
+
+static unsigned int fast_adv_timeout_s(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_FAST_ADV_ADAPTIVE)) {
+		return CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT;
+	}
+
+	return MAX(CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT >> fast_adv_miss_cnt,
+		   CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT_MIN);
+}
+
 static int settings_set(const char *key, size_t len_rd, settings_read_cb read_cb, void *cb_arg)
 {
 	/* Assuming ID is written as one digit */
@@ -238,6 +312,8 @@ static int ble_adv_start_directed(void)
 	}
 
 	adv_param.id = cur_identity;
+	adv_stats.cur_interval = (adv_param.interval_max != 0) ?
+				 adv_param.interval_max : DIRECT_ADV_HIGH_DUTY_INT;
 
 	int err = bt_le_adv_start(&adv_param, NULL, 0, NULL, 0);
 
@@ -374,6 +450,7 @@ static int ble_adv_start_undirected(void)
 	}
 
 	adv_param.id = cur_identity;
+	adv_stats.cur_interval = adv_param.interval_max;
 
 	int allowed_cnt = setup_accept_list(cur_identity);
 
@@ -393,6 +470,8 @@ static void ble_adv_start(void)
 
 	int err = bt_le_adv_stop();
 
+	adv_stats_seg_end();
+
 	if (err) {
 		LOG_ERR("Cannot stop advertising (err %d)", err);
 		goto finish;
@@ -418,6 +497,7 @@ finish:
 	if (err) {
 		update_state(STATE_ERROR);
 	} else {
+		adv_stats_seg_start();
 		broadcast_adv_state(true);
 	}
 }
@@ -455,6 +535,8 @@ static void ble_adv_stop(void)
 
 	int err = bt_le_adv_stop();
 
+	adv_stats_seg_end();
+
 	if (err) {
 		LOG_ERR("Cannot stop advertising (err %d)", err);
 		update_state(STATE_ERROR);
@@ -601,8 +683,7 @@ static void update_grace_period_work(void)
 static void update_fast_adv_work(void)
 {
 	if ((state == STATE_ACTIVE) && fast_adv && !direct_adv) {
-		(void)k_work_reschedule(&fast_adv_end,
-					K_SECONDS(CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT));
+		(void)k_work_reschedule(&fast_adv_end, K_SECONDS(fast_adv_timeout_s()));
 	} else {
 		(void)k_work_cancel_delayable(&fast_adv_end);
 	}
@@ -675,11 +756,16 @@ static void grace_period_end_fn(struct k_work *work)
 
 static void fast_adv_end_fn(struct k_work *work)
 {
-	ARG_UNUSED(work);
-
 	__ASSERT_NO_MSG(req_fast_adv && fast_adv);
 	__ASSERT_NO_MSG(state == STATE_ACTIVE);
 
+	/* The work is submitted only on fast undirected advertising timeout. */
+	if (IS_ENABLED(CONFIG_CAF_BLE_ADV_FAST_ADV_ADAPTIVE) && work &&
+	    (fast_adv_miss_cnt < FAST_ADV_MISS_CNT_MAX)) {
+		fast_adv_miss_cnt++;
+		LOG_DBG("Fast advertising time: %u[s]", fast_adv_timeout_s());
+	}
+
 	req_fast_adv = false;
 	update_state(STATE_ACTIVE);
 
@@ -863,6 +949,13 @@ static bool handle_ble_peer_event(const struct ble_peer_event *event)
 			req_wakeup = true;
 		}
 
+		if (IS_ENABLED(CONFIG_CAF_BLE_ADV_FAST_ADV_ADAPTIVE) && fast_adv && !direct_adv &&
+		    (fast_adv_miss_cnt > 0)) {
+			fast_adv_miss_cnt--;
+		}
+
+		adv_stats_connected();
+
 		update_state(STATE_IDLE);
 		break;
 
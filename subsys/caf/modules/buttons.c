@@ -32,6 +32,9 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_BUTTONS_LOG_LEVEL);
 /* For directly connected GPIO, scan rows once. */
 #define COLUMNS MAX(ARRAY_SIZE(col), 1)
 
+/* State of directly connected GPIO can be monitored with interrupts while buttons are held. */
+#define TICKLESS_HOLD (IS_ENABLED(CONFIG_CAF_BUTTONS_TICKLESS_HOLD) && (ARRAY_SIZE(col) == 0))
+
 BUILD_ASSERT(ARRAY_SIZE(col) <= 32,
 	     "Implementation uses uint32_t for bitmasks and supports up to 32 columns");
 BUILD_ASSERT(ARRAY_SIZE(row) <= 32,
@@ -41,6 +44,7 @@ enum state {
 	STATE_IDLE,
 	STATE_ACTIVE,
 	STATE_SCANNING,
+	STATE_HOLDING,
 	STATE_SUSPENDING
 };
 
@@ -188,6 +192,25 @@ static int callback_ctrl(uint32_t enable_mask)
 	return err;
 }
 
+static int callback_ctrl_hold(uint32_t pressed_mask)
+{
+	int err = 0;
+
+	/* Wait for a change of any button. Level interrupts are used for the same reason as in
+	 * callback_ctrl, but held buttons trigger on the inactive level.
+	 */
+	for (size_t i = 0; (i < ARRAY_SIZE(row)) && !err; i++) {
+		bool active_high = !IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED);
+		bool pressed = pressed_mask & BIT(i);
+		gpio_flags_t flag_irq = (active_high != pressed) ?
+					(GPIO_INT_LEVEL_HIGH) : (GPIO_INT_LEVEL_LOW);
+
+		err = gpio_pin_interrupt_configure(gpio_devs[row[i].port], row[i].pin, flag_irq);
+	}
+
+	return err;
+}
+
 static int setup_pin_wakeup(void)
 {
 	uint32_t wakeup_cols = get_wakeup_mask(col, ARRAY_SIZE(col));
@@ -222,6 +245,16 @@ static int suspend(void)
 		/* Waiting for scanning to stop */
 		break;
 
+	case STATE_HOLDING:
+		/* Resume scanning to suspend after all buttons are released. */
+		err = callback_ctrl(0);
+		if (!err) {
+			state = STATE_SUSPENDING;
+			k_work_reschedule(&matrix_scan, K_NO_WAIT);
+			err = -EBUSY;
+		}
+		break;
+
 	case STATE_ACTIVE:
 		err = setup_pin_wakeup();
 		if (!err) {
@@ -327,6 +360,7 @@ static void scan_fn(struct k_work *work)
 
 	/* Emit event for any key state change */
 	bool any_pressed = false;
+	bool settled = true;
 	size_t evt_limit = 0;
 
 	for (size_t i = 0; i < COLUMNS; i++) {
@@ -354,9 +388,20 @@ static void scan_fn(struct k_work *work)
 			      (prev_state[i] != 0) ||
 			      (settled_state[i] != 0) ||
 			      (cur_state[i] != 0);
+
+		settled = settled &&
+			  (prev_state[i] == settled_state[i]) &&
+			  (cur_state[i] == settled_state[i]);
 	}
 
-	if (any_pressed) {
+	if (TICKLESS_HOLD && any_pressed && settled && (state == STATE_SCANNING)) {
+		/* Held buttons are stable, wait for the next change using interrupts. */
+		state = STATE_HOLDING;
+		if (callback_ctrl_hold(settled_state[0])) {
+			LOG_ERR("Cannot enable callbacks");
+			goto error;
+		}
+	} else if (any_pressed) {
 		/* Schedule next scan */
 		k_work_reschedule(&matrix_scan, K_MSEC(SCAN_INTERVAL));
 	} else {
@@ -461,6 +506,7 @@ static void button_pressed_fn(struct k_work *work)
 		break;
 
 	case STATE_ACTIVE:
+	case STATE_HOLDING:
 		state = STATE_SCANNING;
 		k_work_reschedule(&matrix_scan, K_MSEC(DEBOUNCE_INTERVAL));
 		break;
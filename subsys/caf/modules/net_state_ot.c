@@ -9,6 +9,7 @@
 #include <zephyr/net/openthread.h>
 #include <openthread/thread.h>
 #include <openthread/netdata.h>
+#include <openthread/link.h>
 
 #define MODULE net_state
 #include <caf/events/module_state_event.h>
@@ -109,6 +110,69 @@ static bool check_routes(otInstance *instance)
 	return route_available;
 }
 
+#if CONFIG_CAF_NET_STATE_OT_ADAPTIVE_POLL
+static struct k_work_delayable poll_work;
+static uint32_t poll_period;
+static uint32_t poll_data_frames;
+
+static uint32_t data_frames_get(otInstance *instance)
+{
+	const otMacCounters *counters = otLinkGetCounters(instance);
+
+	/* Data polls are MAC commands and are not counted as data frames. */
+	return counters->mTxData + counters->mRxData;
+}
+
+static void poll_work_handler(struct k_work *work)
+{
+	struct openthread_context *ot_context = openthread_get_default_context();
+	uint32_t data_frames;
+	uint32_t period;
+
+	openthread_api_mutex_lock(ot_context);
+
+	data_frames = data_frames_get(ot_context->instance);
+	if (data_frames != poll_data_frames) {
+		period = CONFIG_CAF_NET_STATE_OT_POLL_PERIOD_MIN_MS;
+	} else {
+		period = MIN(poll_period * 2, CONFIG_CAF_NET_STATE_OT_POLL_PERIOD_MAX_MS);
+	}
+	poll_data_frames = data_frames;
+
+	if (period != poll_period) {
+		if (otLinkSetPollPeriod(ot_context->instance, period) == OT_ERROR_NONE) {
+			LOG_DBG("Poll period: %" PRIu32 " ms", period);
+			poll_period = period;
+		} else {
+			LOG_WRN("Cannot set poll period %" PRIu32 " ms", period);
+		}
+	}
+
+	openthread_api_mutex_unlock(ot_context);
+
+	k_work_reschedule(&poll_work, K_MSEC(poll_period));
+}
+
+static void adaptive_poll_update(otInstance *instance)
+{
+	bool sleepy_child = (otThreadGetDeviceRole(instance) == OT_DEVICE_ROLE_CHILD) &&
+			    !otThreadGetLinkMode(instance).mRxOnWhenIdle;
+
+	if (sleepy_child) {
+		if (!k_work_delayable_is_pending(&poll_work)) {
+			poll_period = CONFIG_CAF_NET_STATE_OT_POLL_PERIOD_MIN_MS;
+			poll_data_frames = data_frames_get(instance);
+			(void)otLinkSetPollPeriod(instance, poll_period);
+			k_work_reschedule(&poll_work, K_MSEC(poll_period));
+		}
+	} else if (k_work_delayable_is_pending(&poll_work)) {
+		(void)k_work_cancel_delayable(&poll_work);
+		/* Fall back to the poll period derived from the child timeout. */
+		(void)otLinkSetPollPeriod(instance, 0);
+	}
+}
+#endif /* CONFIG_CAF_NET_STATE_OT_ADAPTIVE_POLL */
+
 static void connecting_work_handler(struct k_work *work)
 {
 	LOG_INF("Waiting for OT connection...");
@@ -181,6 +245,12 @@ static void on_thread_state_changed(otChangedFlags flags, struct openthread_cont
 		}
 	}
 
+#if CONFIG_CAF_NET_STATE_OT_ADAPTIVE_POLL
+	if (flags & OT_CHANGED_THREAD_ROLE) {
+		adaptive_poll_update(ot_context->instance);
+	}
+#endif
+
 	if (has_role && has_neighbors && route_available) {
 		set_net_state(NET_STATE_CONNECTED);
 	} else {
@@ -209,6 +279,10 @@ static bool handle_state_event(const struct module_state_event *event)
 
 	set_net_state(NET_STATE_DISCONNECTED);
 
+#if CONFIG_CAF_NET_STATE_OT_ADAPTIVE_POLL
+	k_work_init_delayable(&poll_work, poll_work_handler);
+#endif
+
 	connect_ot();
 	module_set_state(MODULE_STATE_READY);
 
@@ -58,6 +58,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_SENSOR_DATA_AGGREGATOR_LOG_LEVEL);
 	[i].sensor_descr = DT_INST_PROP(i, sensor_descr),    \
 	[i].values_in_sample = DT_INST_PROP(i, sample_size), \
 	[i].buf_count = DT_INST_PROP(i, buf_count),          \
+	[i].consumer_cnt = DT_INST_PROP(i, consumer_cnt),    \
 	[i].buf_len = DT_INST_PROP(i, buf_data_length),      \
 	[i].agg_buffers = __AGG_BUFFS_NAME(DT_DRV_INST(i)),  \
 	[i].active_buf  = __AGG_BUFFS_NAME(DT_DRV_INST(i)),
@@ -67,6 +68,7 @@ struct aggregator_buffer {
 	struct sensor_value *samples;	/* Dynamic data. */
 	bool busy;			/* Buffer status. */
 	uint8_t sample_cnt;		/* Number of samples already saved in the buffer. */
+	uint8_t ref_cnt;		/* Number of consumers that did not release the buffer. */
 };
 
 struct aggregator {
@@ -76,6 +78,7 @@ struct aggregator {
 	enum sensor_state sensor_state;		/* Sensors state. */
 	const uint8_t values_in_sample;		/* Number of sensor values in a sample. */
 	const uint8_t buf_count;		/* Number of buffers. */
+	const uint8_t consumer_cnt;		/* Number of consumers releasing a buffer. */
 	const uint8_t buf_len;			/* Size of buffor data in bytes. */
 };
 
@@ -109,6 +112,13 @@ static struct aggregator *get_aggregator(const char *sensor_descr)
 static void release_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 {
 	__ASSERT_NO_MSG(ab);
+	__ASSERT_NO_MSG(ab->ref_cnt > 0);
+
+	/* The buffer is shared by all consumers, reuse it after the last one releases it. */
+	ab->ref_cnt--;
+	if (ab->ref_cnt > 0) {
+		return;
+	}
 
 	ab->sample_cnt = 0;
 	ab->busy = false;
@@ -120,6 +130,7 @@ static void release_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 {
 	ab->busy = true;
+	ab->ref_cnt = agg->consumer_cnt;
 	struct sensor_data_aggregator_event *event = new_sensor_data_aggregator_event();
 	event->values_in_sample = agg->values_in_sample;
 	event->samples = ab->samples;
@@ -129,13 +140,10 @@ static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 	APP_EVENT_SUBMIT(event);
 }
 
-static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
+static int enqueue_sample(struct aggregator *agg, const struct sensor_value *sample)
 {
 	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
 
-	if ((event->dyndata.size) != chunk_bytes) {
-		return -EBADMSG;
-	}
 	if (!agg->active_buf) {
 		return -ENOMEM;
 	}
@@ -148,7 +156,7 @@ static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
 		__ASSERT_NO_MSG(false);
 		return -ENOMEM;
 	}
-	memcpy(&ab->samples[pos_values], (uint8_t *)event->dyndata.data, chunk_bytes);
+	memcpy(&ab->samples[pos_values], sample, chunk_bytes);
 	ab->sample_cnt++;
 	avail_bytes -= chunk_bytes;
 
@@ -160,6 +168,29 @@ static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
 	return 0;
 }
 
+static int enqueue_samples(struct aggregator *agg, struct sensor_event *event)
+{
+	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+
+	/* Sensors with FIFO submit multiple samples in a single event. */
+	if ((event->dyndata.size == 0) || ((event->dyndata.size % chunk_bytes) != 0)) {
+		return -EBADMSG;
+	}
+
+	const struct sensor_value *data = sensor_event_get_data_ptr(event);
+	size_t sample_cnt = event->dyndata.size / chunk_bytes;
+
+	for (size_t i = 0; i < sample_cnt; i++) {
+		int err = enqueue_sample(agg, &data[i * agg->values_in_sample]);
+
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
 static bool event_handler(const struct app_event_header *aeh)
 {
 	if (is_sensor_event(aeh)) {
@@ -167,7 +198,7 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
-			int err = enqueue_sample(agg, event);
+			int err = enqueue_samples(agg, event);
 
 			if (err) {
 				LOG_ERR("Error code: %d", err);
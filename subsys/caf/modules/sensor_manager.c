@@ -31,6 +31,9 @@ struct sensor_data {
 	atomic_t state;
 	unsigned int sleep_cntd;
 	atomic_t event_cnt;
+	atomic_t fifo_pending;
+	struct sensor_value *rate_prev;
+	uint8_t quiet_cnt;
 };
 
 static struct sensor_data sensor_data[ARRAY_SIZE(sensor_configs)];
@@ -105,6 +108,108 @@ static size_t get_sensor_data_cnt(const struct sm_sensor_config *sc)
 	return data_cnt;
 }
 
+static bool is_fifo_sensor(const struct sm_sensor_config *sc)
+{
+	return IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_FIFO) && sc->fifo;
+}
+
+static void fifo_trigger_handler(const struct device *dev, const struct sensor_trigger *trigger)
+{
+	struct sensor_data *sd = get_sensor_data(dev);
+
+	atomic_set(&sd->fifo_pending, true);
+	k_sem_give(&can_sample);
+}
+
+static int fifo_trigger_set(const struct sm_sensor_config *sc, bool enable)
+{
+	if (!is_fifo_sensor(sc)) {
+		return 0;
+	}
+
+	int err = sensor_trigger_set(sc->dev, &sc->fifo->cfg,
+				     enable ? fifo_trigger_handler : NULL);
+
+	if (err) {
+		LOG_ERR("Cannot %s FIFO trigger of %s (err:%d)",
+			enable ? "set" : "clear", sc->dev->name, err);
+	}
+
+	return err;
+}
+
+static bool is_adaptive_rate_sensor(const struct sm_sensor_config *sc)
+{
+	return IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_ADAPTIVE_RATE) && sc->adaptive_rate &&
+	       !is_fifo_sensor(sc);
+}
+
+static int clamp_sampling_period(const struct sm_sensor_config *sc, int period)
+{
+	if (!is_adaptive_rate_sensor(sc)) {
+		return period;
+	}
+
+	return CLAMP(period, (int)sc->adaptive_rate->min_period_ms,
+		     (int)sc->adaptive_rate->max_period_ms);
+}
+
+static void adapt_sampling_rate(const struct sm_sensor_config *sc, struct sensor_data *sd,
+				const struct sensor_value *curr)
+{
+	const struct sm_adaptive_rate *ar = sc->adaptive_rate;
+	size_t data_cnt = get_sensor_data_cnt(sc);
+	int period = sd->sampling_period;
+	bool activity = false;
+
+	for (size_t i = 0; i < data_cnt; i++) {
+		struct sensor_value diff = sensor_value_abs_difference(curr[i], sd->rate_prev[i]);
+
+		if (sensor_value_greater_then(diff, ar->thresh)) {
+			activity = true;
+			break;
+		}
+	}
+
+	memcpy(sd->rate_prev, curr, data_cnt * sizeof(struct sensor_value));
+
+	/* Ramp up the sampling rate fast on activity and ramp it down gradually. */
+	if (activity) {
+		sd->quiet_cnt = 0;
+		period /= 2;
+	} else if (++(sd->quiet_cnt) >= ar->quiet_samples) {
+		sd->quiet_cnt = 0;
+		period *= 2;
+	}
+
+	period = clamp_sampling_period(sc, period);
+
+	if (period != sd->sampling_period) {
+		LOG_DBG("%s sampling period: %d ms", sc->dev->name, period);
+		sd->sampling_period = period;
+	}
+}
+
+static int adaptive_rate_init(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	__ASSERT(sc->adaptive_rate->min_period_ms > 0,
+		 "Minimal sampling period must be bigger than 0");
+	__ASSERT(sc->adaptive_rate->min_period_ms <= sc->adaptive_rate->max_period_ms,
+		 "Invalid sampling period range");
+
+	sd->rate_prev = k_calloc(get_sensor_data_cnt(sc), sizeof(struct sensor_value));
+
+	if (!sd->rate_prev) {
+		LOG_ERR("Failed to allocate memory");
+		__ASSERT_NO_MSG(false);
+		return -ENOMEM;
+	}
+
+	sd->sampling_period = clamp_sampling_period(sc, sd->sampling_period);
+
+	return 0;
+}
+
 static void reset_sensor_sleep_cnt(const struct sm_sensor_config *sc,
 				   struct sensor_data *sd)
 {
@@ -171,6 +276,12 @@ static void sensor_wake_up_post(const struct sm_sensor_config *sc, struct sensor
 	if (sc->trigger) {
 		reset_sensor_sleep_cnt(sc, sd);
 	}
+
+	if (fifo_trigger_set(sc, true)) {
+		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+		return;
+	}
+
 	update_sensor_state(sc, sd, SENSOR_STATE_ACTIVE);
 }
 
@@ -204,7 +315,11 @@ static void enter_sleep(const struct sm_sensor_config *sc,
 			struct sensor_data *sd)
 {
 	k_sched_lock();
-	int err = sensor_trigger_set(sc->dev, &sc->trigger->cfg, trigger_handler);
+	int err = fifo_trigger_set(sc, false);
+
+	if (!err) {
+		err = sensor_trigger_set(sc->dev, &sc->trigger->cfg, trigger_handler);
+	}
 
 	if (err) {
 		LOG_ERR("Error setting trigger (err:%d)", err);
@@ -215,12 +330,9 @@ static void enter_sleep(const struct sm_sensor_config *sc,
 	k_sched_unlock();
 }
 
-static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config *sc)
+static int read_sample(const struct sm_sensor_config *sc, struct sensor_value *data)
 {
 	size_t data_idx = 0;
-	size_t data_cnt = get_sensor_data_cnt(sc);
-	struct sensor_value data[data_cnt];
-
 	int err = sensor_sample_fetch(sc->dev);
 
 	for (size_t i = 0; !err && (i < sc->chan_cnt); i++) {
@@ -230,26 +342,72 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 		data_idx += sampled_chan->data_cnt;
 	}
 
+	return err;
+}
+
+static void process_samples(struct sensor_data *sd, const struct sm_sensor_config *sc,
+			    const struct sensor_value *data, size_t sample_cnt)
+{
+	size_t data_cnt = get_sensor_data_cnt(sc);
+
+	if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+		send_sensor_event(sc->event_descr, data, data_cnt * sample_cnt, &sd->event_cnt);
+	} else {
+		LOG_WRN("Did not send event due to too many active events on sensor: %s",
+			sc->dev->name);
+	}
+
+	if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
+		for (size_t i = 0; i < sample_cnt; i++) {
+			process_sensor_activity(sc, sd, &data[i * data_cnt]);
+		}
+
+		if (!is_sensor_active(sd)) {
+			enter_sleep(sc, sd);
+		}
+	}
+}
+
+static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config *sc)
+{
+	size_t data_cnt = get_sensor_data_cnt(sc);
+	struct sensor_value data[data_cnt];
+
+	int err = read_sample(sc, data);
+
 	if (err) {
 		LOG_ERR("Sensor sampling error (err %d)", err);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
-			send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data),
-					  &sd->event_cnt);
-		} else {
-			LOG_WRN("Did not send event due to too many active events on sensor: %s",
-				sc->dev->name);
+		if (is_adaptive_rate_sensor(sc)) {
+			adapt_sampling_rate(sc, sd, data);
 		}
 
-		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
-			process_sensor_activity(sc, sd, data);
-			if (!is_sensor_active(sd)) {
-				enter_sleep(sc, sd);
-			}
+		process_samples(sd, sc, data, 1);
+	}
+}
 
+static void drain_fifo(struct sensor_data *sd, const struct sm_sensor_config *sc)
+{
+	size_t data_cnt = get_sensor_data_cnt(sc);
+	struct sensor_value data[data_cnt * sc->fifo->watermark];
+	size_t sample_cnt = 0;
+	int err = 0;
+
+	/* All samples read on a single trigger are submitted in one event. */
+	while (!err && (sample_cnt < sc->fifo->watermark)) {
+		err = read_sample(sc, &data[sample_cnt * data_cnt]);
+		if (!err) {
+			sample_cnt++;
 		}
 	}
+
+	if (err) {
+		LOG_ERR("Sensor FIFO read error (err %d)", err);
+		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+	} else {
+		process_samples(sd, sc, data, sample_cnt);
+	}
 }
 
 static size_t sample_sensors(int64_t *next_timeout)
@@ -263,6 +421,19 @@ static size_t sample_sensors(int64_t *next_timeout)
 		struct sensor_data *sd = &sensor_data[i];
 		const struct sm_sensor_config *sc = &sensor_configs[i];
 
+		if (is_fifo_sensor(sc)) {
+			if ((atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) &&
+			    atomic_cas(&sd->fifo_pending, true, false)) {
+				drain_fifo(sd, sc);
+			}
+
+			/* FIFO sensors are sampled only on the trigger. */
+			if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
+				alive_sensors++;
+			}
+			continue;
+		}
+
 		if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 			if (sd->sample_timeout <= cur_uptime) {
 				sample_sensor(sd, sc);
@@ -400,6 +571,25 @@ static size_t sensor_init(void)
 			}
 		}
 
+		if (is_adaptive_rate_sensor(sc)) {
+			int err = adaptive_rate_init(sc, sd);
+
+			if (err) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				LOG_ERR("%s sensor cannot initialize adaptive rate", sc->dev->name);
+				continue;
+			}
+		}
+
+		__ASSERT(!is_fifo_sensor(sc) || (sc->fifo->watermark > 0),
+			 "FIFO watermark must be bigger than 0");
+
+		if (fifo_trigger_set(sc, true)) {
+			update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+			LOG_ERR("%s sensor cannot initialize FIFO", sc->dev->name);
+			continue;
+		}
+
 		update_sensor_state(sc, sd, SENSOR_STATE_ACTIVE);
 		alive_sensors++;
 	}
@@ -452,7 +642,9 @@ static bool handle_power_down_event(const struct app_event_header *aeh)
 			} else if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 				int ret = 0;
 
-				if (sc->suspend) {
+				ret = fifo_trigger_set(sc, false);
+
+				if (!ret && sc->suspend) {
 					ret = pm_device_action_run(sc->dev,
 								   PM_DEVICE_ACTION_SUSPEND);
 				}
@@ -534,8 +726,10 @@ static bool handle_set_sensor_period_event(const struct app_event_header *aeh)
 		if (event->descr == sc->event_descr) {
 			struct sensor_data *sd = &sensor_data[i];
 
-			sd->sampling_period = event->sampling_period;
-			sd->sample_timeout = k_uptime_get() + event->sampling_period;
+			/* Adaptive rate control continues from the requested period. */
+			sd->sampling_period = clamp_sampling_period(sc, event->sampling_period);
+			sd->quiet_cnt = 0;
+			sd->sample_timeout = k_uptime_get() + sd->sampling_period;
 			if (sd->state == SENSOR_STATE_ACTIVE) {
 				k_sem_give(&can_sample);
 			}
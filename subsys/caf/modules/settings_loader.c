@@ -9,9 +9,11 @@
 #include <zephyr/settings/settings.h>
 
 #include <app_event_manager.h>
+#include <caf/settings_loader.h>
 
 #define MODULE settings_loader
 #include <caf/events/module_state_event.h>
+#include <caf/events/settings_loader_event.h>
 
 #include CONFIG_CAF_SETTINGS_LOADER_DEF_PATH
 
@@ -24,19 +26,90 @@ static struct k_thread thread;
 static K_THREAD_STACK_DEFINE(thread_stack, THREAD_STACK_SIZE);
 
 
-static void load_settings_thread(void)
+#if IS_ENABLED(CONFIG_CAF_SETTINGS_LOADER_STAGED)
+static struct k_work deferred_load;
+
+
+static int load_stages(bool critical)
 {
-	LOG_INF("Settings load thread started");
+	for (size_t i = 0; i < ARRAY_SIZE(settings_loader_stages); i++) {
+		const struct settings_loader_stage *stage = &settings_loader_stages[i];
+
+		if (stage->critical != critical) {
+			continue;
+		}
+
+		int err = settings_load_subtree(stage->subtree);
 
-	int err = settings_load();
+		if (err) {
+			LOG_ERR("Cannot load settings subtree %s (%d)", stage->subtree, err);
+			return err;
+		}
+
+		LOG_INF("Settings subtree %s loaded", stage->subtree);
+
+		struct settings_subtree_loaded_event *event = new_settings_subtree_loaded_event();
+
+		event->subtree = stage->subtree;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	return 0;
+}
+
+static int load_critical(void)
+{
+	return load_stages(true);
+}
+
+static void load_deferred(void)
+{
+	if (load_stages(false)) {
+		module_set_state(MODULE_STATE_ERROR);
+	} else {
+		LOG_INF("Settings loaded");
+	}
+}
+
+static void deferred_load_fn(struct k_work *work)
+{
+	load_deferred();
+}
+#else
+static int load_critical(void)
+{
+	return settings_load();
+}
+
+static void load_deferred(void)
+{
+}
+#endif /* CONFIG_CAF_SETTINGS_LOADER_STAGED */
+
+static int load_and_report(void)
+{
+	int err = load_critical();
 
 	if (err) {
 		LOG_ERR("Cannot load settings");
 		module_set_state(MODULE_STATE_ERROR);
 	} else {
-		LOG_INF("Settings loaded");
+		LOG_INF(IS_ENABLED(CONFIG_CAF_SETTINGS_LOADER_STAGED) ?
+			"Critical settings loaded" : "Settings loaded");
 		module_set_state(MODULE_STATE_READY);
 	}
+
+	return err;
+}
+
+static void load_settings_thread(void)
+{
+	LOG_INF("Settings load thread started");
+
+	if (!load_and_report()) {
+		/* The thread runs in the background, load the remaining subtrees right away. */
+		load_deferred();
+	}
 }
 
 static void start_loading_thread(void)
@@ -53,16 +126,12 @@ static void load_settings(void)
 {
 	if (IS_ENABLED(CONFIG_CAF_SETTINGS_LOADER_USE_THREAD)) {
 		start_loading_thread();
-	} else {
-		int err = settings_load();
-
-		if (err) {
-			LOG_ERR("Cannot load settings");
-			module_set_state(MODULE_STATE_ERROR);
-		} else {
-			LOG_INF("Settings loaded");
-			module_set_state(MODULE_STATE_READY);
-		}
+	} else if (!load_and_report()) {
+#if IS_ENABLED(CONFIG_CAF_SETTINGS_LOADER_STAGED)
+		/* Load the remaining subtrees after other events are processed. */
+		k_work_init(&deferred_load, deferred_load_fn);
+		k_work_submit(&deferred_load);
+#endif
 	}
 }
 
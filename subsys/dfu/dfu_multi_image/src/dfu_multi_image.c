@@ -9,6 +9,10 @@
 #include <zephyr/sys/util.h>
 #include <zcbor_decode.h>
 
+#if defined(CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST)
+#include <mbedtls/sha256.h>
+#endif
+
 #include <errno.h>
 #include <string.h>
 
@@ -16,10 +20,13 @@
 #define CBOR_HEADER_NESTING_LEVEL 3
 #define IMAGE_NO_FIXED_HEADER -2
 #define IMAGE_NO_CBOR_HEADER -1
+#define IMAGE_DIGEST_SIZE 32
 
 struct image_info {
 	int32_t id;
 	uint32_t size;
+	uint_fast32_t has_digest;
+	uint8_t digest[IMAGE_DIGEST_SIZE];
 };
 
 struct header {
@@ -42,6 +49,10 @@ struct dfu_multi_image_ctx {
 	size_t cur_offset;
 	size_t cur_item_offset;
 	size_t cur_item_size;
+
+#if defined(CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST)
+	mbedtls_sha256_context sha256_ctx;
+#endif
 };
 
 static struct dfu_multi_image_ctx ctx;
@@ -54,6 +65,22 @@ static int parse_fixed_header(void)
 	return (ctx.cur_item_size <= ctx.buffer_size) ? 0 : -ENOMEM;
 }
 
+static bool parse_image_digest(zcbor_state_t *states, struct image_info *image)
+{
+	struct zcbor_string digest;
+	bool res;
+
+	res = zcbor_tstr_expect_lit(states, "sha");
+	res = res && zcbor_bstr_decode(states, &digest);
+	res = res && (digest.len == sizeof(image->digest));
+
+	if (res) {
+		memcpy(image->digest, digest.value, sizeof(image->digest));
+	}
+
+	return res;
+}
+
 static bool parse_image_info(zcbor_state_t *states, struct image_info *image)
 {
 	bool res;
@@ -63,6 +90,8 @@ static bool parse_image_info(zcbor_state_t *states, struct image_info *image)
 	res = res && zcbor_int32_decode(states, &image->id);
 	res = res && zcbor_tstr_expect_lit(states, "size");
 	res = res && zcbor_uint32_decode(states, &image->size);
+	res = res && zcbor_present_decode(&image->has_digest, (zcbor_decoder_t *)parse_image_digest,
+					  states, image);
 	res = res && zcbor_map_end_decode(states);
 
 	return res;
@@ -123,6 +152,45 @@ static void select_next_image(void)
 	}
 }
 
+#if defined(CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST)
+static int digest_update(const uint8_t *chunk, size_t chunk_size)
+{
+	const struct image_info *image = &ctx.header.images[ctx.cur_image_no];
+	uint8_t digest[IMAGE_DIGEST_SIZE];
+	int err;
+
+	if (!image->has_digest) {
+		return 0;
+	}
+
+	if (ctx.cur_item_offset == 0) {
+		mbedtls_sha256_init(&ctx.sha256_ctx);
+
+		err = mbedtls_sha256_starts(&ctx.sha256_ctx, false);
+		if (err) {
+			return -EIO;
+		}
+	}
+
+	err = mbedtls_sha256_update(&ctx.sha256_ctx, chunk, chunk_size);
+	if (err) {
+		return -EIO;
+	}
+
+	if (ctx.cur_item_offset + chunk_size < ctx.cur_item_size) {
+		return 0;
+	}
+
+	err = mbedtls_sha256_finish(&ctx.sha256_ctx, digest);
+	mbedtls_sha256_free(&ctx.sha256_ctx);
+	if (err) {
+		return -EIO;
+	}
+
+	return memcmp(digest, image->digest, sizeof(digest)) ? -EBADMSG : 0;
+}
+#endif /* CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST */
+
 static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 {
 	int err = 0;
@@ -157,6 +225,13 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 			err = writer->write(chunk, chunk_size);
 		}
 
+#if defined(CONFIG_DFU_MULTI_IMAGE_VERIFY_DIGEST)
+		/* The image is not closed on a mismatch, dfu_multi_image_done() closes it */
+		if (!err) {
+			err = digest_update(chunk, chunk_size);
+		}
+#endif
+
 		if (!err && ctx.cur_item_offset + chunk_size == ctx.cur_item_size) {
 			err = writer->close(true);
 		}
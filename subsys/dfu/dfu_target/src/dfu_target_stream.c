@@ -21,19 +21,45 @@ LOG_MODULE_REGISTER(dfu_target_stream, CONFIG_DFU_TARGET_LOG_LEVEL);
 static struct stream_flash_ctx stream;
 static const char *current_id;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+/* Serializes the stream between the writer and the erase-ahead work */
+static K_MUTEX_DEFINE(stream_mutex);
+static K_THREAD_STACK_DEFINE(erase_work_q_stack, CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD_STACK_SIZE);
+static struct k_work_q erase_work_q;
+static struct k_work erase_work;
+/* End of the erased pages following the page being written, or -1 if there are none */
+static off_t erased_ahead_end = -1;
+
+#define STREAM_LOCK() k_mutex_lock(&stream_mutex, K_FOREVER)
+#define STREAM_UNLOCK() k_mutex_unlock(&stream_mutex)
+#else
+#define STREAM_LOCK()
+#define STREAM_UNLOCK()
+#endif /* CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD */
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 
 static char current_name_key[32];
+static size_t stored_bytes_written;
 
 /**
  * @brief Store the information stored in the stream_flash instance so that it
  *        can be restored from flash in case of a power failure, reboot etc.
+ *
+ * Unless @p force is set, the progress is only stored once at least
+ * CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL more bytes have been written.
  */
-static int store_progress(void)
+static int store_progress(bool force)
 {
 	int err;
 	size_t bytes_written = stream_flash_bytes_written(&stream);
 
+	if (!force && ((bytes_written == stored_bytes_written) ||
+		       ((bytes_written - stored_bytes_written) <
+			CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL))) {
+		return 0;
+	}
+
 	err = settings_save_one(current_name_key, &bytes_written,
 				sizeof(bytes_written));
 
@@ -42,6 +68,8 @@ static int store_progress(void)
 		return err;
 	}
 
+	stored_bytes_written = bytes_written;
+
 	return 0;
 }
 
@@ -96,6 +124,94 @@ struct stream_flash_ctx *dfu_target_stream_get_stream(void)
 	return &stream;
 }
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+/**
+ * @brief Erase the pages following the page being written, while the writer waits for data.
+ *
+ * The pages are erased one at a time, so that the writer is not held up for long.
+ */
+static void erase_ahead_work_fn(struct k_work *work)
+{
+	struct flash_pages_info page;
+	off_t next;
+	off_t limit;
+	int err;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		STREAM_LOCK();
+
+		/* The first page is erased by the stream itself */
+		if (!current_id || (stream.last_erased_page_start_offset < 0)) {
+			break;
+		}
+
+		err = flash_get_page_info_by_offs(stream.fdev, stream.last_erased_page_start_offset,
+						  &page);
+		if (err) {
+			break;
+		}
+
+		next = page.start_offset + page.size;
+		limit = MIN(next + CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD_PAGES * page.size,
+			    (off_t)(stream.offset + stream.available));
+
+		if (erased_ahead_end > next) {
+			next = erased_ahead_end;
+		}
+
+		if (next >= limit) {
+			break;
+		}
+
+		err = flash_get_page_info_by_offs(stream.fdev, next, &page);
+		if (!err) {
+			err = flash_erase(stream.fdev, page.start_offset, page.size);
+		}
+		if (err) {
+			LOG_WRN("Erase ahead failed (err %d), pages will be erased on write", err);
+			erased_ahead_end = -1;
+			break;
+		}
+
+		erased_ahead_end = page.start_offset + page.size;
+
+		STREAM_UNLOCK();
+	}
+
+	STREAM_UNLOCK();
+}
+
+/**
+ * @brief Let the stream use the page erased ahead that the next flush of @p sync_len bytes
+ *	  ends in, instead of erasing it again.
+ *
+ * The stream erases the page holding the last byte of each flush, unless it is the last
+ * page it erased. The page is handed over just before the first flush that ends in it,
+ * so that the page being written is never erased again.
+ */
+static void erased_ahead_claim(size_t sync_len)
+{
+	struct flash_pages_info page;
+	off_t last = stream.offset + stream.bytes_written + sync_len - 1;
+
+	if (erased_ahead_end < 0) {
+		return;
+	}
+
+	if (last >= erased_ahead_end) {
+		erased_ahead_end = -1;
+		return;
+	}
+
+	if ((flash_get_page_info_by_offs(stream.fdev, last, &page) == 0) &&
+	    (page.start_offset > stream.last_erased_page_start_offset)) {
+		stream.last_erased_page_start_offset = page.start_offset;
+	}
+}
+#endif /* CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD */
+
 int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 {
 	int err;
@@ -149,8 +265,30 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		LOG_ERR("settings_load failed (err %d)", err);
 		return err;
 	}
+
+	stored_bytes_written = stream_flash_bytes_written(&stream);
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+	static bool erase_work_q_started;
+
+	if (!erase_work_q_started) {
+		const struct k_work_queue_config cfg = {
+			.name = "dfu_erase_ahead",
+		};
+
+		k_work_queue_start(&erase_work_q, erase_work_q_stack,
+				   K_THREAD_STACK_SIZEOF(erase_work_q_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+		k_work_init(&erase_work, erase_ahead_work_fn);
+		erase_work_q_started = true;
+	}
+
+	STREAM_LOCK();
+	erased_ahead_end = -1;
+	STREAM_UNLOCK();
+#endif /* CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD */
+
 	return 0;
 }
 
@@ -161,17 +299,90 @@ int dfu_target_stream_offset_get(size_t *out)
 	return 0;
 }
 
+#ifdef CONFIG_DFU_TARGET_STREAM_DIRECT_WRITE
+/**
+ * @brief Write whole buffers of data to flash directly from the caller's memory.
+ *
+ * While the stream buffer is empty, stream_flash is flushed with the caller's data
+ * standing in for its buffer, which saves copying the data into the stream buffer.
+ * A full buffer is aligned and no write callback is set, so stream_flash only reads it.
+ */
+static int direct_write(const uint8_t **buf, size_t *len)
+{
+	uint8_t *const stream_buf = stream.buf;
+	int err;
+
+	while ((stream.buf_bytes == 0) && (*len >= stream.buf_len)) {
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+		erased_ahead_claim(stream.buf_len);
+#endif
+		stream.buf = (uint8_t *)*buf;
+		stream.buf_bytes = stream.buf_len;
+
+		err = stream_flash_buffered_write(&stream, NULL, 0, true);
+
+		stream.buf = stream_buf;
+		if (err != 0) {
+			stream.buf_bytes = 0;
+			return err;
+		}
+
+		*buf += stream.buf_len;
+		*len -= stream.buf_len;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DFU_TARGET_STREAM_DIRECT_WRITE */
+
+static int buffered_write(const uint8_t *buf, size_t len)
+{
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+	int err;
+
+	/* Pass the data one flush at a time, to hand over the pages erased ahead */
+	while (len >= (stream.buf_len - stream.buf_bytes)) {
+		size_t chunk = stream.buf_len - stream.buf_bytes;
+
+		erased_ahead_claim(stream.buf_len);
+
+		err = stream_flash_buffered_write(&stream, buf, chunk, false);
+		if (err != 0) {
+			return err;
+		}
+
+		buf += chunk;
+		len -= chunk;
+	}
+#endif /* CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD */
+
+	return stream_flash_buffered_write(&stream, buf, len, false);
+}
+
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
-	int err = stream_flash_buffered_write(&stream, buf, len, false);
+	int err = 0;
+
+	STREAM_LOCK();
+#ifdef CONFIG_DFU_TARGET_STREAM_DIRECT_WRITE
+	err = direct_write(&buf, &len);
+#endif
+	if (err == 0) {
+		err = buffered_write(buf, len);
+	}
+	STREAM_UNLOCK();
 
 	if (err != 0) {
 		LOG_ERR("stream_flash_buffered_write error %d", err);
 		return err;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+	(void)k_work_submit_to_queue(&erase_work_q, &erase_work);
+#endif
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
-	err = store_progress();
+	err = store_progress(false);
 	if (err != 0) {
 		/* Failing to store progress is not a critical error you'll just
 		 * be left to download a bit more if you fail and resume.
@@ -187,6 +398,14 @@ int dfu_target_stream_done(bool successful)
 {
 	int err = 0;
 
+	STREAM_LOCK();
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+	if (successful && (stream.buf_bytes > 0)) {
+		erased_ahead_claim(stream.buf_bytes);
+	}
+	erased_ahead_end = -1;
+#endif
+
 	if (successful) {
 		err = stream_flash_buffered_write(&stream, NULL, 0, true);
 		if (err != 0) {
@@ -205,7 +424,7 @@ int dfu_target_stream_done(bool successful)
 		/* The stream has not completed, store the progress so that
 		 * a new call to 'init' will pick up where we left off.
 		 */
-		err = store_progress();
+		err = store_progress(true);
 		if (err != 0) {
 			LOG_ERR("Unable to reset write progress: %d", err);
 		}
@@ -213,6 +432,7 @@ int dfu_target_stream_done(bool successful)
 	}
 
 	current_id = NULL;
+	STREAM_UNLOCK();
 
 	return err;
 }
@@ -221,10 +441,15 @@ int dfu_target_stream_reset(void)
 {
 	int err;
 
+	STREAM_LOCK();
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+	erased_ahead_end = -1;
+#endif
 	stream.buf_bytes = 0;
 	stream.bytes_written = 0;
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+	stored_bytes_written = 0;
 	err = settings_delete(current_name_key);
 	if (err != 0) {
 		LOG_ERR("settings_delete error %d", err);
@@ -234,6 +459,7 @@ int dfu_target_stream_reset(void)
 	/* No flash device specified, nothing to erase. */
 	if (stream.fdev == NULL) {
 		current_id = NULL;
+		STREAM_UNLOCK();
 		return 0;
 	}
 
@@ -243,6 +469,7 @@ int dfu_target_stream_reset(void)
 	err = stream_flash_erase_page(&stream, stream.offset);
 
 	current_id = NULL;
+	STREAM_UNLOCK();
 
 	return err;
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 #include <zephyr/logging/log.h>
 #include <dfu/fmfu_fdev.h>
@@ -19,6 +20,61 @@ LOG_MODULE_REGISTER(fmfu_fdev, CONFIG_FMFU_FDEV_LOG_LEVEL);
 
 static uint8_t meta_buf[MAX_META_LEN];
 
+#if defined(CONFIG_FMFU_FDEV_PREFETCH)
+static K_THREAD_STACK_DEFINE(prefetch_stack, CONFIG_FMFU_FDEV_PREFETCH_STACK_SIZE);
+static struct k_work_q prefetch_workq;
+static bool prefetch_workq_started;
+
+static struct {
+	struct k_work work;
+	struct k_sem done;
+	const struct device *fdev;
+	uint32_t addr;
+	uint8_t *buf;
+	size_t len;
+	int err;
+} prefetch;
+
+static void prefetch_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	prefetch.err = flash_read(prefetch.fdev, prefetch.addr, prefetch.buf, prefetch.len);
+	k_sem_give(&prefetch.done);
+}
+
+static void prefetch_init(void)
+{
+	if (prefetch_workq_started) {
+		return;
+	}
+
+	k_work_init(&prefetch.work, prefetch_work_fn);
+	k_sem_init(&prefetch.done, 0, 1);
+	k_work_queue_start(&prefetch_workq, prefetch_stack,
+			   K_THREAD_STACK_SIZEOF(prefetch_stack),
+			   CONFIG_FMFU_FDEV_PREFETCH_THREAD_PRIO, NULL);
+	prefetch_workq_started = true;
+}
+
+static void prefetch_start(const struct device *fdev, uint32_t addr, uint8_t *buf, size_t len)
+{
+	prefetch.fdev = fdev;
+	prefetch.addr = addr;
+	prefetch.buf = buf;
+	prefetch.len = len;
+
+	k_work_submit_to_queue(&prefetch_workq, &prefetch.work);
+}
+
+static int prefetch_wait(void)
+{
+	k_sem_take(&prefetch.done, K_FOREVER);
+
+	return prefetch.err;
+}
+#endif /* CONFIG_FMFU_FDEV_PREFETCH */
+
 static int get_hash_from_flash(const struct device *fdev, size_t offset, size_t data_len,
 			       uint8_t *hash, uint8_t *buffer, size_t buffer_len)
 {
@@ -76,7 +132,70 @@ static int write_chunk(uint8_t *buf, size_t buf_len, uint32_t address, bool is_b
 	return 0;
 }
 
-static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
+#if defined(CONFIG_FMFU_FDEV_PREFETCH)
+static int write_chunks(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
+			uint32_t seg_offset, uint8_t *buf, size_t buf_len, bool is_bootloader)
+{
+	/* Each half of the buffer is read from flash while the other half is
+	 * written to the modem.
+	 */
+	size_t half_len = ROUND_DOWN(buf_len / 2, sizeof(uint32_t));
+	uint8_t *bufs[2] = { buf, buf + half_len };
+	uint32_t read_addr = seg_offset;
+	size_t bytes_left = seg_size;
+	size_t read_len;
+	int cur = 0;
+	int err;
+
+	if (half_len == 0) {
+		return -EINVAL;
+	}
+
+	if (seg_size == 0) {
+		return 0;
+	}
+
+	read_len = MIN(half_len, bytes_left);
+	prefetch_start(fdev, read_addr, bufs[cur], read_len);
+
+	while (bytes_left) {
+		size_t len = read_len;
+
+		err = prefetch_wait();
+		if (err != 0) {
+			LOG_ERR("flash_read failed: %d", err);
+			return err;
+		}
+
+		read_addr += len;
+		bytes_left -= len;
+		read_len = MIN(half_len, bytes_left);
+
+		if (read_len) {
+			prefetch_start(fdev, read_addr, bufs[!cur], read_len);
+		}
+
+		err = write_chunk(bufs[cur], len, seg_target_addr, is_bootloader);
+		if (err != 0) {
+			LOG_ERR("write_chunk failed: %d", err);
+			if (read_len) {
+				/* The buffer belongs to the caller, let the read finish */
+				(void)prefetch_wait();
+			}
+			return err;
+		}
+
+		LOG_DBG("Wrote chunk: offset 0x%x target addr 0x%x size 0x%zx", read_addr - len,
+			seg_target_addr, len);
+
+		seg_target_addr += len;
+		cur = !cur;
+	}
+
+	return 0;
+}
+#else
+static int write_chunks(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
 			uint32_t seg_offset, uint8_t *buf, size_t buf_len, bool is_bootloader)
 {
 	int err;
@@ -106,6 +225,21 @@ static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg
 		read_addr += read_len;
 	}
 
+	return 0;
+}
+#endif /* CONFIG_FMFU_FDEV_PREFETCH */
+
+static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
+			uint32_t seg_offset, uint8_t *buf, size_t buf_len, bool is_bootloader)
+{
+	int err;
+
+	err = write_chunks(fdev, seg_size, seg_target_addr, seg_offset, buf, buf_len,
+			   is_bootloader);
+	if (err != 0) {
+		return err;
+	}
+
 	if (is_bootloader) {
 		/* We need to explicitly call _apply() once all chunks of the
 		 * bootloader has been written.
@@ -191,6 +325,10 @@ int fmfu_fdev_load(uint8_t *buf, size_t buf_len, const struct device *fdev, size
 		return -ENOMEM;
 	}
 
+#if defined(CONFIG_FMFU_FDEV_PREFETCH)
+	prefetch_init();
+#endif
+
 	/* Read the whole wrapper. */
 	err = flash_read(fdev, offset, meta_buf, MAX_META_LEN);
 	if (err != 0) {
@@ -13,6 +13,7 @@
 
 #include <mpsl_timeslot.h>
 #include <mpsl.h>
+#include <mpsl/mpsl_timeslot_stats.h>
 
 #include <nrf_dm.h>
 #include "dm.h"
@@ -119,6 +120,7 @@ static mpsl_timeslot_request_t timeslot_request_normal = {
 
 struct dm_result result;
 static mpsl_timeslot_signal_return_param_t signal_callback_return_param;
+static struct mpsl_timeslot_stats_user timeslot_stats;
 
 static void dm_config_get(struct dm_request *dm_req, nrf_dm_config_t *dm_config)
 {
@@ -171,8 +173,11 @@ static mpsl_timeslot_signal_return_param_t *mpsl_timeslot_callback(
 		p_ret_val = &signal_callback_return_param;
 
 		dm_io_set(DM_IO_RANGING);
+		mpsl_timeslot_stats_start(&timeslot_stats);
 
 		if (atomic_get(&timeslot_ctx.state) == TIMESLOT_STATE_EARLY_PENDING) {
+			mpsl_timeslot_stats_end(&timeslot_stats,
+						timeslot_request_earliest.params.earliest.length_us);
 			dm_io_clear(DM_IO_RANGING);
 			return p_ret_val;
 		}
@@ -186,6 +191,7 @@ static mpsl_timeslot_signal_return_param_t *mpsl_timeslot_callback(
 
 		dm_context.nrf_dm_status = nrf_dm_status;
 
+		mpsl_timeslot_stats_end(&timeslot_stats, timeslot_ctx.curr_req.timeslot_length_us);
 		dm_io_clear(DM_IO_RANGING);
 
 		break;
@@ -199,7 +205,15 @@ static mpsl_timeslot_signal_return_param_t *mpsl_timeslot_callback(
 		k_msgq_put(&dm_api_msgq, &dm_api_call, K_NO_WAIT);
 		break;
 	case MPSL_TIMESLOT_SIGNAL_BLOCKED:
+		mpsl_timeslot_stats_blocked(&timeslot_stats);
+		dm_api_call = TIMESLOT_RESCHEDULE;
+		k_msgq_put(&dm_api_msgq, &dm_api_call, K_NO_WAIT);
+		break;
 	case MPSL_TIMESLOT_SIGNAL_CANCELLED:
+		mpsl_timeslot_stats_cancelled(&timeslot_stats);
+		dm_api_call = TIMESLOT_RESCHEDULE;
+		k_msgq_put(&dm_api_msgq, &dm_api_call, K_NO_WAIT);
+		break;
 	case MPSL_TIMESLOT_SIGNAL_INVALID_RETURN:
 		dm_api_call = TIMESLOT_RESCHEDULE;
 		k_msgq_put(&dm_api_msgq, &dm_api_call, K_NO_WAIT);
@@ -229,6 +243,7 @@ static void mpsl_nonpreemptible_thread(void)
 				if (err) {
 					LOG_DBG("MPSL session open failed (err %d)", err);
 				} else {
+					mpsl_timeslot_stats_register(&timeslot_stats, "dm");
 					atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_NEED_EARLY);
 				}
 				break;
@@ -237,6 +252,8 @@ static void mpsl_nonpreemptible_thread(void)
 				if (err) {
 					LOG_DBG("MPSL timeslot request failed (err %d)", err);
 					atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_IDLE);
+				} else {
+					mpsl_timeslot_stats_requested(&timeslot_stats);
 				}
 				break;
 			case MAKE_REQUEST_NORMAL:
@@ -245,6 +262,8 @@ static void mpsl_nonpreemptible_thread(void)
 				if (err) {
 					LOG_DBG("MPSL timeslot request failed (err %d)", err);
 					atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_IDLE);
+				} else {
+					mpsl_timeslot_stats_requested(&timeslot_stats);
 				}
 				break;
 			case CLOSE_SESSION:
@@ -256,14 +275,16 @@ static void mpsl_nonpreemptible_thread(void)
 	}
 }
 
-static void process_data(const nrf_dm_report_t *data, float high_precision_estimate)
+static void process_data(const nrf_dm_report_t *data, float high_precision_estimate,
+			 const bt_addr_le_t *bt_addr, enum dm_ranging_mode ranging_mode,
+			 nrf_dm_status_t status)
 {
 	if (!data) {
 		result.status = false;
 		return;
 	}
-	result.status = (dm_context.nrf_dm_status == NRF_DM_STATUS_SUCCESS);
-	bt_addr_le_copy(&result.bt_addr, &timeslot_ctx.curr_req.dm_req.bt_addr);
+	result.status = (status == NRF_DM_STATUS_SUCCESS);
+	bt_addr_le_copy(&result.bt_addr, bt_addr);
 
 	result.quality = DM_QUALITY_NONE;
 	if (data->quality == NRF_DM_QUALITY_OK) {
@@ -276,7 +297,7 @@ static void process_data(const nrf_dm_report_t *data, float high_precision_estim
 		result.quality = DM_QUALITY_CRC_FAIL;
 	}
 
-	result.ranging_mode = timeslot_ctx.curr_req.dm_req.ranging_mode;
+	result.ranging_mode = ranging_mode;
 	if (result.ranging_mode == DM_RANGING_MODE_RTT) {
 		result.dist_estimates.rtt.rtt = data->distance_estimates.rtt.rtt;
 	} else {
@@ -383,6 +404,51 @@ static void dm_reschedule(void)
 	}
 }
 
+static void report_calc(nrf_dm_report_t *report, const bt_addr_le_t *bt_addr,
+			enum dm_ranging_mode ranging_mode, nrf_dm_status_t status)
+{
+	float high_precision_estimate = 0;
+
+	nrf_dm_calc(report);
+
+#ifdef CONFIG_DM_HIGH_PRECISION_CALC
+	if (report->ranging_mode == NRF_DM_RANGING_MODE_MCPD) {
+		high_precision_estimate = nrf_dm_high_precision_calc(report);
+	}
+#endif
+	process_data(report, high_precision_estimate, bt_addr, ranging_mode, status);
+	if (dm_context.cb->data_ready != NULL) {
+		dm_context.cb->data_ready(&result);
+	}
+}
+
+#if defined(CONFIG_DM_DEFERRED_CALC)
+struct deferred_calc_item {
+	nrf_dm_report_t report;
+	bt_addr_le_t bt_addr;
+	enum dm_ranging_mode ranging_mode;
+	nrf_dm_status_t status;
+};
+
+K_MSGQ_DEFINE(deferred_calc_msgq, sizeof(struct deferred_calc_item),
+	      CONFIG_DM_DEFERRED_CALC_QUEUE_SIZE, 4);
+
+static void deferred_calc_thread(void)
+{
+	static struct deferred_calc_item item;
+
+	while (1) {
+		if (k_msgq_get(&deferred_calc_msgq, &item, K_FOREVER) == 0) {
+			report_calc(&item.report, &item.bt_addr, item.ranging_mode, item.status);
+		}
+	}
+}
+
+K_THREAD_DEFINE(deferred_calc_thread_id, DM_THREAD_STACK_SIZE,
+		deferred_calc_thread, NULL, NULL, NULL,
+		CONFIG_DM_DEFERRED_CALC_THREAD_PRIORITY, 0, 0);
+#endif
+
 static void calculation(void)
 {
 	if (IS_ENABLED(CONFIG_DM_MODULE_RPC_HOST)) {
@@ -394,22 +460,27 @@ static void calculation(void)
 			bt_addr_le_copy(&data->bt_addr, &timeslot_ctx.curr_req.dm_req.bt_addr);
 			dm_rpc_calc_and_process(data, sizeof(*data));
 		}
+	} else if (IS_ENABLED(CONFIG_DM_DEFERRED_CALC)) {
+#if defined(CONFIG_DM_DEFERRED_CALC)
+		/* Only the raw report is captured here. The estimation runs in the lower
+		 * priority thread so the next ranging can be started right away.
+		 */
+		static struct deferred_calc_item item;
+
+		nrf_dm_populate_report(&item.report);
+		bt_addr_le_copy(&item.bt_addr, &timeslot_ctx.curr_req.dm_req.bt_addr);
+		item.ranging_mode = timeslot_ctx.curr_req.dm_req.ranging_mode;
+		item.status = dm_context.nrf_dm_status;
+		if (k_msgq_put(&deferred_calc_msgq, &item, K_NO_WAIT)) {
+			LOG_WRN("Deferred calculation queue full, ranging result dropped");
+		}
+#endif
 	} else {
 		static nrf_dm_report_t report;
-		float high_precision_estimate = 0;
 
 		nrf_dm_populate_report(&report);
-		nrf_dm_calc(&report);
-
-#ifdef CONFIG_DM_HIGH_PRECISION_CALC
-		if (report.ranging_mode == NRF_DM_RANGING_MODE_MCPD) {
-			high_precision_estimate = nrf_dm_high_precision_calc(&report);
-		}
-#endif
-		process_data(&report, high_precision_estimate);
-		if (dm_context.cb->data_ready != NULL) {
-			dm_context.cb->data_ready(&result);
-		}
+		report_calc(&report, &timeslot_ctx.curr_req.dm_req.bt_addr,
+			    timeslot_ctx.curr_req.dm_req.ranging_mode, dm_context.nrf_dm_status);
 	}
 }
 
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
 #include "timeslot_queue.h"
 #include "time.h"
 
@@ -14,47 +15,27 @@
 #define MIN_TIME_BETWEEN_TIMESLOTS_US    CONFIG_DM_MIN_TIME_BETWEEN_TIMESLOTS_US
 #define RANGING_OFFSET_US                CONFIG_DM_RANGING_OFFSET_US
 
-static K_MUTEX_DEFINE(list_mtx);
-static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
-
-struct timeslot_entry {
-	struct timeslot_request timeslot_req;
-	sys_snode_t node;
-};
-
-static K_HEAP_DEFINE(heap, TIMESLOT_QUEUE_LENGTH * sizeof(struct timeslot_entry));
-
-static void list_lock(void)
-{
-	k_mutex_lock(&list_mtx, K_FOREVER);
-}
+/* The queue is a fixed ring of requests. Producers (the Bluetooth and DM threads) only
+ * write the slot past the tail and the single consumer (the DM thread) only releases
+ * the head, so the head entry returned by timeslot_queue_peek() stays valid until
+ * timeslot_queue_remove_first() is called. The lock only covers index bookkeeping.
+ */
+static struct timeslot_request ring[TIMESLOT_QUEUE_LENGTH];
+static size_t head;
+static size_t count;
+static struct k_spinlock lock;
 
-static void list_unlock(void)
+static size_t ring_idx(size_t pos)
 {
-	k_mutex_unlock(&list_mtx);
-}
-
-static size_t get_list_size(void)
-{
-	size_t ret = 0;
-	sys_snode_t *node, *tmp;
-
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		ret++;
-	}
-
-	return ret;
+	return (head + pos) % TIMESLOT_QUEUE_LENGTH;
 }
 
 static bool is_request_exist(struct dm_request *req)
 {
 	uint8_t cnt = 0;
-	sys_snode_t *node, *tmp;
-	struct timeslot_entry *item;
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		item = CONTAINER_OF(node, struct timeslot_entry, node);
-		if (bt_addr_le_cmp(&item->timeslot_req.dm_req.bt_addr, &req->bt_addr) == 0) {
+	for (size_t i = 0; i < count; i++) {
+		if (bt_addr_le_cmp(&ring[ring_idx(i)].dm_req.bt_addr, &req->bt_addr) == 0) {
 			cnt++;
 		}
 	}
@@ -65,83 +46,75 @@ static bool is_request_exist(struct dm_request *req)
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len_us, uint32_t timeslot_len_us)
 {
+	int err = 0;
 	uint32_t distance;
 	uint32_t start_time;
 	uint32_t delay;
-	size_t list_size;
-	struct timeslot_entry *last, *item;
+	struct timeslot_request *last, *item;
+	k_spinlock_key_t key;
 
 	delay = req->start_delay_us + RANGING_OFFSET_US;
 	start_time = (start_ref_tick + US_TO_RTC_TICKS(delay)) % RTC_COUNTER_MAX;
 
-	list_size = get_list_size();
-	if (list_size >= TIMESLOT_QUEUE_LENGTH) {
-		return -ENOMEM;
+	key = k_spin_lock(&lock);
+
+	if (count >= TIMESLOT_QUEUE_LENGTH) {
+		err = -ENOMEM;
+		goto out;
 	}
 
-	if (list_size != 0) {
+	if (count != 0) {
 		if (is_request_exist(req)) {
-			return -EAGAIN;
+			err = -EAGAIN;
+			goto out;
 		}
 
-		list_lock();
-		last = SYS_SLIST_PEEK_TAIL_CONTAINER(&timeslot_list, last, node);
-		list_unlock();
-
-		distance = time_distance_get(last->timeslot_req.start_time, start_time);
-		if (distance < US_TO_RTC_TICKS(last->timeslot_req.timeslot_length_us +
+		last = &ring[ring_idx(count - 1)];
+		distance = time_distance_get(last->start_time, start_time);
+		if (distance < US_TO_RTC_TICKS(last->timeslot_length_us +
 					       MIN_TIME_BETWEEN_TIMESLOTS_US)) {
-			return -EBUSY;
+			err = -EBUSY;
+			goto out;
 		}
 	}
 
-	item = k_heap_alloc(&heap, sizeof(struct timeslot_entry), K_NO_WAIT);
-	if (!item) {
-		return -ENOMEM;
-	}
-
-	item->timeslot_req.start_time = start_time;
-	item->timeslot_req.timeslot_length_us = timeslot_len_us;
-	item->timeslot_req.window_length_us = window_len_us;
+	item = &ring[ring_idx(count)];
+	item->start_time = start_time;
+	item->timeslot_length_us = timeslot_len_us;
+	item->window_length_us = window_len_us;
 	req->rng_seed++;
 
-	memcpy(&item->timeslot_req.dm_req, req, sizeof(item->timeslot_req.dm_req));
+	memcpy(&item->dm_req, req, sizeof(item->dm_req));
+	count++;
 
-	list_lock();
-	sys_slist_append(&timeslot_list, &item->node);
-	list_unlock();
+out:
+	k_spin_unlock(&lock, key);
 
-	return 0;
+	return err;
 }
 
 struct timeslot_request *timeslot_queue_peek(void)
 {
-	struct timeslot_entry *item;
-
-	list_lock();
-	item = SYS_SLIST_PEEK_HEAD_CONTAINER(&timeslot_list, item, node);
-	list_unlock();
+	struct timeslot_request *item = NULL;
+	k_spinlock_key_t key;
 
-	if (!item) {
-		return NULL;
+	key = k_spin_lock(&lock);
+	if (count != 0) {
+		item = &ring[head];
 	}
+	k_spin_unlock(&lock, key);
 
-	return &item->timeslot_req;
+	return item;
 }
 
 void timeslot_queue_remove_first(void)
 {
-	sys_snode_t *node;
-	struct timeslot_entry *item;
+	k_spinlock_key_t key;
 
-	list_lock();
-	node = sys_slist_get(&timeslot_list);
-	list_unlock();
-
-	if (!node) {
-		return;
+	key = k_spin_lock(&lock);
+	if (count != 0) {
+		head = (head + 1) % TIMESLOT_QUEUE_LENGTH;
+		count--;
 	}
-
-	item = CONTAINER_OF(node, struct timeslot_entry, node);
-	k_heap_free(&heap, item);
+	k_spin_unlock(&lock, key);
 }
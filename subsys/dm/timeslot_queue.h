@@ -36,7 +36,7 @@ struct timeslot_request {
  *  @param window_len Ranging window length.
  *  @param timeslot_len Timeslot length.
  *
- *  @retval -ENOMEM when the tiemslot queue is full or a memory allocation error.
+ *  @retval -ENOMEM when the timeslot queue is full.
  *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled.
  *  @retval -EBUSY when the timeslot cannot be scheduled due to time restrictions.
  */
@@ -91,6 +91,30 @@ static int emds_entries_size(uint32_t *size)
 	return entries;
 }
 
+/* Unchanged entries are skipped when their last stored copy is kept by emds_prepare() */
+static bool entry_changed(uint16_t id, const uint8_t *data, size_t len)
+{
+	if (!IS_ENABLED(CONFIG_EMDS_STORE_CHANGED_ONLY)) {
+		return true;
+	}
+
+	return emds_flash_cmp(&emds_flash, id, data, len) != 0;
+}
+
+static uint32_t entry_store_time(uint16_t id, const uint8_t *data, size_t len)
+{
+	size_t block_size = emds_flash.flash_params->write_block_size;
+
+	if (!entry_changed(id, data, len)) {
+		return 0;
+	}
+
+	return NRFX_CEIL_DIV(len, block_size) * CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US +
+	       NRFX_CEIL_DIV(emds_flash.ate_size, block_size) *
+		       CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US +
+	       CONFIG_EMDS_FLASH_TIME_ENTRY_OVERHEAD_US;
+}
+
 int emds_init(emds_store_cb_t cb)
 {
 	int rc;
@@ -152,6 +176,10 @@ int emds_store(void)
 	LOG_DBG("Emergency Data Storeage released");
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		if (!entry_changed(ch->id, ch->data, ch->len)) {
+			continue;
+		}
+
 		ssize_t len = emds_flash_write(&emds_flash,
 					       ch->id, ch->data, ch->len);
 		if (len < 0) {
@@ -166,6 +194,10 @@ int emds_store(void)
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		if (!entry_changed(ch->entry.id, ch->entry.data, ch->entry.len)) {
+			continue;
+		}
+
 		ssize_t len = emds_flash_write(&emds_flash,
 					       ch->entry.id, ch->entry.data, ch->entry.len);
 		if (len < 0) {
@@ -264,26 +296,16 @@ int emds_prepare(void)
 
 uint32_t emds_store_time_get(void)
 {
-	size_t block_size = emds_flash.flash_params->write_block_size;
 	uint32_t store_time_us = CONFIG_EMDS_FLASH_TIME_BASE_OVERHEAD_US;
 
-
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		store_time_us += NRFX_CEIL_DIV(ch->len, block_size) *
-					CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US
-			       + NRFX_CEIL_DIV(emds_flash.ate_size, block_size) *
-					CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US
-			       + CONFIG_EMDS_FLASH_TIME_ENTRY_OVERHEAD_US;
+		store_time_us += entry_store_time(ch->id, ch->data, ch->len);
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		store_time_us += NRFX_CEIL_DIV(ch->entry.len, block_size) *
-					CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US
-			       + NRFX_CEIL_DIV(emds_flash.ate_size, block_size) *
-					CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US
-			       + CONFIG_EMDS_FLASH_TIME_ENTRY_OVERHEAD_US;
+		store_time_us += entry_store_time(ch->entry.id, ch->entry.data, ch->entry.len);
 	}
 
 	return store_time_us;
@@ -252,6 +252,13 @@ static int check_erased(struct emds_fs *fs, uint32_t addr, size_t len)
 	return 0;
 }
 
+/* Check that the flash area between the data and ate write pointers is writeable */
+static int free_space_check(struct emds_fs *fs)
+{
+	return check_erased(fs, fs->offset + fs->data_wra_offset,
+			    fs->ate_wra - (fs->offset + fs->data_wra_offset) + fs->ate_size);
+}
+
 static int is_ate_valid(const struct emds_ate *entry)
 {
 	return entry->crc8 == crc8_ccitt(0xff, entry, offsetof(struct emds_ate, crc8));
@@ -354,9 +361,7 @@ static int ate_last_recover(struct emds_fs *fs)
 		}
 	}
 
-	/* Verify that flash area between ate and data pointer is writeable */
-	if (check_erased(fs, fs->offset + fs->data_wra_offset,
-			 fs->ate_wra - (fs->offset + fs->data_wra_offset) + fs->ate_size)) {
+	if (free_space_check(fs)) {
 		fs->force_erase = true;
 	}
 
@@ -477,25 +482,20 @@ ssize_t emds_flash_write(struct emds_fs *fs, uint16_t id, const void *data, size
 	return len;
 }
 
-ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
+/* Find the most recently written valid entry with the given id */
+static int ate_latest_find(struct emds_fs *fs, uint16_t id, struct emds_ate *entry)
 {
-	if (!fs->is_initialized) {
-		LOG_ERR("EMDS flash not initialized");
-		return -EACCES;
-	}
-
 	int rc;
 	uint32_t wlk_addr = fs->ate_wra;
-	struct emds_ate wlk_ate;
 
 	while (true) {
-		rc = flash_read(fs->flash_dev, wlk_addr, &wlk_ate, sizeof(struct emds_ate));
+		rc = flash_read(fs->flash_dev, wlk_addr, entry, sizeof(struct emds_ate));
 		if (rc) {
 			return rc;
 		}
 
-		if ((wlk_ate.id == id) && (is_ate_valid(&wlk_ate))) {
-			break;
+		if ((entry->id == id) && (is_ate_valid(entry))) {
+			return 0;
 		}
 
 		wlk_addr += fs->ate_size;
@@ -503,6 +503,22 @@ ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
 			return -ENXIO;
 		}
 	}
+}
+
+ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
+{
+	if (!fs->is_initialized) {
+		LOG_ERR("EMDS flash not initialized");
+		return -EACCES;
+	}
+
+	int rc;
+	struct emds_ate wlk_ate;
+
+	rc = ate_latest_find(fs, id, &wlk_ate);
+	if (rc) {
+		return rc;
+	}
 
 	if (len < wlk_ate.len) {
 		return -ENOMEM;
@@ -520,6 +536,51 @@ ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
 	return wlk_ate.len;
 }
 
+int emds_flash_cmp(struct emds_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	if (!fs->is_initialized) {
+		LOG_ERR("EMDS flash not initialized");
+		return -EACCES;
+	}
+
+	const uint8_t *data8 = (const uint8_t *)data;
+	uint8_t buf[EMDS_FLASH_BLOCK_SIZE * 4];
+	struct emds_ate wlk_ate;
+	uint32_t addr;
+	int rc;
+
+	rc = ate_latest_find(fs, id, &wlk_ate);
+	if (rc == -ENXIO) {
+		return 1;
+	} else if (rc) {
+		return rc;
+	}
+
+	if ((wlk_ate.len != len) || (wlk_ate.crc8_data != crc8_ccitt(0xff, data, len))) {
+		return 1;
+	}
+
+	addr = fs->offset + wlk_ate.offset;
+	while (len) {
+		size_t bytes_to_cmp = MIN(sizeof(buf), len);
+
+		rc = flash_read(fs->flash_dev, addr, buf, bytes_to_cmp);
+		if (rc) {
+			return rc;
+		}
+
+		if (memcmp(buf, data8, bytes_to_cmp)) {
+			return 1;
+		}
+
+		len -= bytes_to_cmp;
+		addr += bytes_to_cmp;
+		data8 += bytes_to_cmp;
+	}
+
+	return 0;
+}
+
 int emds_flash_prepare(struct emds_fs *fs, int byte_size)
 {
 	if (!fs->is_initialized) {
@@ -531,13 +592,20 @@ int emds_flash_prepare(struct emds_fs *fs, int byte_size)
 		return -ENOMEM;
 	}
 
-	int rc = old_entries_invalidate(fs);
+	/* When only changed entries are stored, the unchanged ones must stay readable */
+	if (!IS_ENABLED(CONFIG_EMDS_STORE_CHANGED_ONLY)) {
+		int rc = old_entries_invalidate(fs);
 
-	if (rc) {
-		return rc;
+		if (rc) {
+			return rc;
+		}
 	}
 
-	if (fs->force_erase || (byte_size > emds_flash_free_space_get(fs))) {
+	/* The store must not meet a word that is not erased, as it does not check the flash.
+	 * The free area is verified again, as it may have been written since it was recovered.
+	 */
+	if (fs->force_erase || (byte_size > emds_flash_free_space_get(fs)) ||
+	    free_space_check(fs)) {
 		emds_flash_clear(fs);
 		fs->force_erase = false;
 	}
@@ -99,12 +99,26 @@ ssize_t emds_flash_write(struct emds_fs *fs, uint16_t id, const void *data, size
  */
 ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len);
 
+/**
+ * @brief Compare an entry in the EMDS file system with data.
+ *
+ * @param fs Pointer to file system
+ * @param id Id of the entry to be compared
+ * @param data Pointer to the data to compare the entry with
+ * @param len Number of bytes in data
+ *
+ * @retval 0 if the most recently written entry with the given id holds exactly the given data
+ * @retval 1 if the entry differs from the data or has not been written
+ * @retval Negative errno code on error
+ */
+int emds_flash_cmp(struct emds_fs *fs, uint16_t id, const void *data, size_t len);
+
 /**
  * @brief Prepare EMDS file system for next write events.
  *
  * This function should be called at the moment when the user has restored the desired data
- * entries from flash. It will invalidate all prior entries, and potentially clear the flash
- * area.
+ * entries from flash. It will invalidate all prior entries, unless
+ * CONFIG_EMDS_STORE_CHANGED_ONLY is enabled, and potentially clear the flash area.
  *
  * @note Calling this function will make any subsequent read attempts fail. Be sure to
  * restore all necessary entries before using this function.
@@ -82,6 +82,9 @@ LOG_MODULE_REGISTER(esb, CONFIG_ESB_LOG_LEVEL);
 /* Radio base frequency. */
 #define RADIO_BASE_FREQUENCY 2400UL
 
+/* Highest radio channel, 2500 MHz. */
+#define ESB_RF_CHANNEL_MAX 100
+
 /* NRF5340 Radio high voltage gain. */
 #define NRF5340_HIGH_VOLTAGE_GAIN 3
 
@@ -134,10 +137,20 @@ struct payload_tx_fifo {
 	uint32_t count;	/* Number of elements in the queue. */
 };
 
+/* Received payload, left in the radio PDU buffer it was received into. */
+struct rx_fifo_entry {
+	struct esb_radio_pdu *pdu; /* Radio PDU holding the payload data. */
+	uint8_t length;	/* Payload length. */
+	uint8_t pipe;	/* Pipe the payload was received on. */
+	int8_t rssi;	/* RSSI of the received packet. */
+	uint8_t pid;	/* Packet ID. */
+	uint8_t noack;	/* No acknowledgment flag. */
+};
+
 /* First-in, first-out queue of received payloads. */
 struct payload_rx_fifo {
 	 /* Payload queue */
-	struct esb_payload *payload[CONFIG_ESB_RX_FIFO_SIZE];
+	struct rx_fifo_entry entry[CONFIG_ESB_RX_FIFO_SIZE];
 
 	uint32_t back;	/* Back of the queue (last in). */
 	uint32_t front;	/* Front of queue (first out). */
@@ -234,8 +247,12 @@ static struct payload_rx_fifo rx_fifo;
 
 static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 				 sizeof(struct esb_radio_pdu)];
-static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
-				 sizeof(struct esb_radio_pdu)];
+/* One radio PDU buffer per RX FIFO entry, plus one for the radio to receive
+ * into. Received packets are swapped into the FIFO instead of being copied.
+ */
+static uint8_t rx_payload_buffers[CONFIG_ESB_RX_FIFO_SIZE + 1][CONFIG_ESB_MAX_PAYLOAD_LENGTH +
+							       sizeof(struct esb_radio_pdu)];
+static uint8_t *rx_payload_buffer;
 
 /* Random access buffer variables for ACK payload handling */
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
@@ -244,6 +261,15 @@ struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
 /* Run time variables */
 static uint8_t pids[CONFIG_ESB_PIPE_COUNT];
 static struct pipe_info rx_pipe_info[CONFIG_ESB_PIPE_COUNT];
+#if defined(CONFIG_ESB_PIPE_STATS)
+static struct esb_pipe_stats pipe_stats[CONFIG_ESB_PIPE_COUNT];
+#define PIPE_STATS_INC(_pipe, _field) (pipe_stats[_pipe]._field++)
+#else
+#define PIPE_STATS_INC(_pipe, _field)
+#endif
+#if defined(CONFIG_ESB_CHANNEL_STATS)
+static struct esb_channel_stats channel_stats[ESB_RF_CHANNEL_MAX + 1];
+#endif
 static volatile uint32_t interrupt_flags;
 static volatile uint32_t retransmits_remaining;
 static volatile uint32_t last_tx_attempts;
@@ -701,7 +727,6 @@ static void reset_fifos(void)
 
 static void initialize_fifos(void)
 {
-	static struct esb_payload rx_payload[CONFIG_ESB_RX_FIFO_SIZE];
 	static struct esb_payload tx_payload[CONFIG_ESB_TX_FIFO_SIZE];
 
 	reset_fifos();
@@ -711,9 +736,11 @@ static void initialize_fifos(void)
 	}
 
 	for (size_t i = 0; i < CONFIG_ESB_RX_FIFO_SIZE; i++) {
-		rx_fifo.payload[i] = &rx_payload[i];
+		rx_fifo.entry[i].pdu = (struct esb_radio_pdu *)rx_payload_buffers[i];
 	}
 
+	rx_payload_buffer = rx_payload_buffers[CONFIG_ESB_RX_FIFO_SIZE];
+
 	for (size_t i = 0; i < CONFIG_ESB_TX_FIFO_SIZE; i++) {
 		ack_pl_wrap[i].p_payload = &tx_payload[i];
 		ack_pl_wrap[i].in_use = false;
@@ -745,7 +772,9 @@ static void tx_fifo_remove_last(void)
  *
  *  The module will point the register NRF_RADIO->PACKETPTR to a buffer for
  *  receiving packets. After receiving a packet the module will call this
- *  function to copy the received data to the RX FIFO.
+ *  function to hand the buffer over to the RX FIFO. The buffer of the FIFO
+ *  entry takes its place, so NRF_RADIO->PACKETPTR must be updated before the
+ *  next reception.
  *
  *  @param  pipe Pipe number to set for the packet.
  *  @param  pid  Packet ID.
@@ -756,6 +785,7 @@ static void tx_fifo_remove_last(void)
 static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 {
 	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct rx_fifo_entry *entry = &rx_fifo.entry[rx_fifo.back];
 
 	if (rx_fifo.count >= CONFIG_ESB_RX_FIFO_SIZE) {
 		return false;
@@ -766,21 +796,24 @@ static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 			return false;
 		}
 
-		rx_fifo.payload[rx_fifo.back]->length = rx_pdu->type.dpl_pdu.length;
+		entry->length = rx_pdu->type.dpl_pdu.length;
 	} else if (esb_cfg.mode == ESB_MODE_PTX) {
 		/* Received packet is an acknowledgment */
-		rx_fifo.payload[rx_fifo.back]->length = 0;
+		entry->length = 0;
 	} else {
-		rx_fifo.payload[rx_fifo.back]->length = esb_cfg.payload_length;
+		entry->length = esb_cfg.payload_length;
 	}
 
-	memcpy(rx_fifo.payload[rx_fifo.back]->data, rx_pdu->data,
-	       rx_fifo.payload[rx_fifo.back]->length);
+	entry->pipe = pipe;
+	entry->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
+	entry->pid = pid;
+	entry->noack = !rx_pdu->type.dpl_pdu.no_ack;
+
+	/* Swap buffers with the FIFO entry instead of copying the payload. */
+	rx_payload_buffer = (uint8_t *)entry->pdu;
+	entry->pdu = rx_pdu;
 
-	rx_fifo.payload[rx_fifo.back]->pipe = pipe;
-	rx_fifo.payload[rx_fifo.back]->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
-	rx_fifo.payload[rx_fifo.back]->pid = pid;
-	rx_fifo.payload[rx_fifo.back]->noack = !rx_pdu->type.dpl_pdu.no_ack;
+	PIPE_STATS_INC(pipe, rx_packets);
 
 	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
 		rx_fifo.back = 0;
@@ -1014,6 +1047,19 @@ static void on_radio_disabled_tx(void)
 	esb_state = ESB_STATE_PTX_RX_ACK;
 }
 
+static void channel_stats_update(bool success)
+{
+#if defined(CONFIG_ESB_CHANNEL_STATS)
+	struct esb_channel_stats *stats = &channel_stats[esb_addr.rf_channel];
+
+	stats->tx_packets++;
+	stats->tx_attempts += last_tx_attempts;
+	if (!success) {
+		stats->tx_failed++;
+	}
+#endif
+}
+
 static void on_radio_disabled_tx_wait_for_ack(void)
 {
 	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
@@ -1033,6 +1079,7 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 	    nrf_radio_crc_status_check(NRF_RADIO)) {
 		interrupt_flags |= INT_TX_SUCCESS_MSK;
 		last_tx_attempts = esb_cfg.retransmit_count - retransmits_remaining + 1;
+		channel_stats_update(true);
 
 		tx_fifo_remove_last();
 
@@ -1059,6 +1106,7 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 			 */
 			last_tx_attempts = esb_cfg.retransmit_count + 1;
 			interrupt_flags |= INT_TX_FAILED_MSK;
+			channel_stats_update(false);
 
 			esb_state = ESB_STATE_IDLE;
 			NVIC_SetPendingIRQ(ESB_EVT_IRQ);
@@ -1142,10 +1190,10 @@ static void clear_events_restart_rx(void)
 }
 
 static void on_radio_disabled_rx_dpl(bool retransmit_payload,
-				     struct pipe_info *pipe_info)
+				     struct pipe_info *pipe_info,
+				     const struct esb_radio_pdu *rx_pdu)
 {
 	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
 
 	uint32_t pipe = nrf_radio_rxmatch_get(NRF_RADIO);
 
@@ -1167,6 +1215,7 @@ static void on_radio_disabled_rx_dpl(bool retransmit_payload,
 			/* ACK payloads also require TX_DS */
 			/* (page 40 of the 'nRF24LE1_Product_Specification_rev1_6.pdf') */
 			interrupt_flags |= INT_TX_SUCCESS_MSK;
+			PIPE_STATS_INC(pipe, ack_payloads);
 		}
 
 		if (current_payload != 0) {
@@ -1204,6 +1253,7 @@ static void on_radio_disabled_rx(void)
 	}
 
 	if (rx_fifo.count >= CONFIG_ESB_RX_FIFO_SIZE) {
+		PIPE_STATS_INC(nrf_radio_rxmatch_get(NRF_RADIO), rx_dropped);
 		clear_events_restart_rx();
 		return;
 	}
@@ -1214,11 +1264,21 @@ static void on_radio_disabled_rx(void)
 	    (rx_pdu->type.dpl_pdu.pid) == pipe_info->pid) {
 		retransmit_payload = true;
 		send_rx_event = false;
+		PIPE_STATS_INC(nrf_radio_rxmatch_get(NRF_RADIO), rx_retransmits);
 	}
 
 	pipe_info->pid = rx_pdu->type.dpl_pdu.pid;
 	pipe_info->crc = nrf_radio_rxcrc_get(NRF_RADIO);
 
+	/* Push the new packet to the RX FIFO before the radio is restarted, as
+	 * this moves the radio to a new receive buffer. The received event is
+	 * triggered once the ACK is prepared.
+	 */
+	if (send_rx_event) {
+		send_rx_event = rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO),
+						   pipe_info->pid);
+	}
+
 	/* Check if an ack should be sent */
 	if ((esb_cfg.selective_auto_ack == false) || rx_pdu->type.dpl_pdu.no_ack) {
 		esb_fem_for_tx_ack();
@@ -1228,7 +1288,7 @@ static void on_radio_disabled_rx(void)
 
 		switch (esb_cfg.protocol) {
 		case ESB_PROTOCOL_ESB_DPL:
-			on_radio_disabled_rx_dpl(retransmit_payload, pipe_info);
+			on_radio_disabled_rx_dpl(retransmit_payload, pipe_info, rx_pdu);
 			break;
 
 		case ESB_PROTOCOL_ESB:
@@ -1253,14 +1313,8 @@ static void on_radio_disabled_rx(void)
 	}
 
 	if (send_rx_event) {
-		/* Push the new packet to the RX buffer and trigger a received
-		 * event if the operation was
-		 * successful.
-		 */
-		if (rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe_info->pid)) {
-			interrupt_flags |= INT_RX_DATA_RECEIVED_MSK;
-			NVIC_SetPendingIRQ(ESB_EVT_IRQ);
-		}
+		interrupt_flags |= INT_RX_DATA_RECEIVED_MSK;
+		NVIC_SetPendingIRQ(ESB_EVT_IRQ);
 	}
 }
 
@@ -1561,6 +1615,7 @@ int esb_write_payload(const struct esb_payload *payload)
 		return -EINVAL;
 	}
 
+	int err = 0;
 	unsigned int key = irq_lock();
 
 	if (esb_cfg.mode == ESB_MODE_PTX) {
@@ -1575,7 +1630,24 @@ int esb_write_payload(const struct esb_payload *payload)
 
 		tx_fifo.count++;
 	} else {
-		struct payload_wrap *new_ack_payload = find_free_payload_cont();
+		struct payload_wrap *last = ack_pl_wrap_pipe[payload->pipe];
+		struct payload_wrap *new_ack_payload = NULL;
+		size_t queued = 0;
+
+		if (last != 0) {
+			queued++;
+			while (last->p_next != 0) {
+				last = (struct payload_wrap *)last->p_next;
+				queued++;
+			}
+		}
+
+		/* Leave room in the shared pool for the other pipes. */
+		if (queued < CONFIG_ESB_ACK_PAYLOAD_PIPE_MAX) {
+			new_ack_payload = find_free_payload_cont();
+		} else {
+			err = -ENOMEM;
+		}
 
 		if (new_ack_payload != 0) {
 			new_ack_payload->in_use = true;
@@ -1585,15 +1657,10 @@ int esb_write_payload(const struct esb_payload *payload)
 			pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
 			new_ack_payload->p_payload->pid = pids[payload->pipe];
 
-			if (ack_pl_wrap_pipe[payload->pipe] == 0) {
+			if (last == 0) {
 				ack_pl_wrap_pipe[payload->pipe] = new_ack_payload;
 			} else {
-				struct payload_wrap *pl = ack_pl_wrap_pipe[payload->pipe];
-
-				while (pl->p_next != 0) {
-					pl = (struct payload_wrap *)pl->p_next;
-				}
-				pl->p_next = (struct payload_wrap *)new_ack_payload;
+				last->p_next = (struct payload_wrap *)new_ack_payload;
 			}
 			tx_fifo.count++;
 		}
@@ -1601,6 +1668,10 @@ int esb_write_payload(const struct esb_payload *payload)
 
 	irq_unlock(key);
 
+	if (err) {
+		return err;
+	}
+
 	if (esb_cfg.mode == ESB_MODE_PTX &&
 	    esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
 	    (esb_state == ESB_STATE_IDLE ||
@@ -1626,14 +1697,14 @@ int esb_read_rx_payload(struct esb_payload *payload)
 	}
 
 	unsigned int key = irq_lock();
+	const struct rx_fifo_entry *entry = &rx_fifo.entry[rx_fifo.front];
 
-	payload->length = rx_fifo.payload[rx_fifo.front]->length;
-	payload->pipe = rx_fifo.payload[rx_fifo.front]->pipe;
-	payload->rssi = rx_fifo.payload[rx_fifo.front]->rssi;
-	payload->pid = rx_fifo.payload[rx_fifo.front]->pid;
-	payload->noack = rx_fifo.payload[rx_fifo.front]->noack;
-	memcpy(payload->data, rx_fifo.payload[rx_fifo.front]->data,
-	       payload->length);
+	payload->length = entry->length;
+	payload->pipe = entry->pipe;
+	payload->rssi = entry->rssi;
+	payload->pid = entry->pid;
+	payload->noack = entry->noack;
+	memcpy(payload->data, entry->pdu->data, payload->length);
 
 	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
 		rx_fifo.front = 0;
@@ -1892,7 +1963,7 @@ int esb_set_rf_channel(uint32_t channel)
 	if (esb_state != ESB_STATE_IDLE) {
 		return -EBUSY;
 	}
-	if (channel > 100) {
+	if (channel > ESB_RF_CHANNEL_MAX) {
 		return -EINVAL;
 	}
 
@@ -1959,6 +2030,66 @@ int esb_set_bitrate(enum esb_bitrate bitrate)
 	return update_radio_bitrate() ? 0 : -EINVAL;
 }
 
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	if (pipe >= CONFIG_ESB_PIPE_COUNT || stats == NULL) {
+		return -EINVAL;
+	}
+
+	unsigned int key = irq_lock();
+
+	*stats = pipe_stats[pipe];
+
+	irq_unlock(key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+void esb_pipe_stats_reset(void)
+{
+#if defined(CONFIG_ESB_PIPE_STATS)
+	unsigned int key = irq_lock();
+
+	memset(pipe_stats, 0, sizeof(pipe_stats));
+
+	irq_unlock(key);
+#endif
+}
+
+int esb_channel_stats_get(uint32_t channel, struct esb_channel_stats *stats)
+{
+#if defined(CONFIG_ESB_CHANNEL_STATS)
+	if (channel > ESB_RF_CHANNEL_MAX || stats == NULL) {
+		return -EINVAL;
+	}
+
+	unsigned int key = irq_lock();
+
+	*stats = channel_stats[channel];
+
+	irq_unlock(key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+void esb_channel_stats_reset(void)
+{
+#if defined(CONFIG_ESB_CHANNEL_STATS)
+	unsigned int key = irq_lock();
+
+	memset(channel_stats, 0, sizeof(channel_stats));
+
+	irq_unlock(key);
+#endif
+}
+
 int esb_reuse_pid(uint8_t pipe)
 {
 	if (esb_state != ESB_STATE_IDLE) {
@@ -51,6 +51,33 @@ struct emp_cmd_subscribe {
 	char name[];
 };
 
+/** @brief Value marking the frame carrying a batch of events.
+ *
+ * The value overlays the event header list node of a single event frame.
+ * It is odd, so it cannot be a valid node pointer.
+ */
+#define EMP_BATCH_MAGIC 0xE7B47C11
+
+/**
+ * @brief The header of the frame carrying a batch of events.
+ *
+ * The header is followed by the event records. Every record consists of the event size
+ * stored as uint32_t and the event data padded to the 4-byte boundary.
+ */
+struct emp_batch_hdr {
+	uint32_t magic;
+};
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+/** @brief Batch of events waiting for transmission. */
+struct emp_batch {
+	struct k_mutex lock;
+	struct k_work_delayable flush_work;
+	size_t len;
+	uint32_t buf[DIV_ROUND_UP(CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE, sizeof(uint32_t))];
+};
+#endif
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -59,6 +86,9 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	struct emp_batch batch;
+#endif
 };
 
 
@@ -153,12 +183,62 @@ static void handle_ipc_endpoint_bound(void *priv)
 
 static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
+	const struct app_event_header *eh = data;
+
+	if (len < sizeof(*eh)) {
+		LOG_ERR("Unexpected event size: %zu", len);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	APP_EVENT_ASSERT_ID(eh->type_id);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	/* The event type is already translated by the remote, so the local pool can be used. */
+	void *event = _app_event_manager_alloc_event(eh->type_id, len);
+#else
 	void *event = app_event_manager_alloc(len);
+#endif
 
 	memcpy(event, data, len);
 	_event_submit(event);
 }
 
+static bool is_remote_batch(const void *data, size_t len)
+{
+	const struct emp_batch_hdr *hdr = data;
+
+	return (len >= sizeof(*hdr)) && (hdr->magic == EMP_BATCH_MAGIC);
+}
+
+static void handle_remote_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *pos = (const uint8_t *)data + sizeof(struct emp_batch_hdr);
+	const uint8_t *end = (const uint8_t *)data + len;
+
+	while (pos < end) {
+		uint32_t event_len;
+
+		if ((size_t)(end - pos) < sizeof(event_len)) {
+			LOG_ERR("Malformed event batch");
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		memcpy(&event_len, pos, sizeof(event_len));
+		pos += sizeof(event_len);
+
+		if ((size_t)(end - pos) < event_len) {
+			LOG_ERR("Malformed event batch");
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		handle_remote_event(ipc, pos, event_len);
+		pos += ROUND_UP(event_len, sizeof(uint32_t));
+	}
+}
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -256,7 +336,11 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		if (is_remote_batch(data, len)) {
+			handle_remote_batch(ipc, data, len);
+		} else {
+			handle_remote_event(ipc, data, len);
+		}
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,24 +358,12 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static int send_to_remote(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
-	}
-
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
-
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
-
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
+		ret = ipc_service_send(&ipc->ept, data, len);
 		if (ret >= 0) {
 			break;
 		}
@@ -306,6 +378,121 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	return ret;
 }
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+/* Record size of the event with the given size in the batch. */
+#define EMP_BATCH_RECORD_SIZE(size) (sizeof(uint32_t) + ROUND_UP((size), sizeof(uint32_t)))
+
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	struct emp_batch *batch = &ipc->batch;
+	int ret = 0;
+
+	if (batch->len > sizeof(struct emp_batch_hdr)) {
+		ret = send_to_remote(ipc, batch->buf, batch->len);
+		batch->len = sizeof(struct emp_batch_hdr);
+	}
+
+	return ret;
+}
+
+static void batch_flush_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct emp_batch *batch = CONTAINER_OF(dwork, struct emp_batch, flush_work);
+	struct emp_ipc_data *ipc = CONTAINER_OF(batch, struct emp_ipc_data, batch);
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+	(void)batch_flush(ipc);
+	k_mutex_unlock(&batch->lock);
+}
+
+static void batch_init(struct emp_ipc_data *ipc)
+{
+	struct emp_batch *batch = &ipc->batch;
+	struct emp_batch_hdr *hdr = (struct emp_batch_hdr *)batch->buf;
+
+	k_mutex_init(&batch->lock);
+	k_work_init_delayable(&batch->flush_work, batch_flush_work_fn);
+	hdr->magic = EMP_BATCH_MAGIC;
+	batch->len = sizeof(*hdr);
+}
+
+static bool batch_fits(size_t size)
+{
+	return (sizeof(struct emp_batch_hdr) + EMP_BATCH_RECORD_SIZE(size)) <=
+	       sizeof(((struct emp_batch *)0)->buf);
+}
+
+static int batch_add(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+		     const struct event_type *remote_ev, size_t size)
+{
+	struct emp_batch *batch = &ipc->batch;
+	uint32_t event_len = size;
+	int ret = 0;
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+
+	if ((batch->len + EMP_BATCH_RECORD_SIZE(size)) > sizeof(batch->buf)) {
+		ret = batch_flush(ipc);
+	}
+
+	uint8_t *pos = (uint8_t *)batch->buf + batch->len;
+	struct app_event_header *remote_eh = (struct app_event_header *)(pos + sizeof(event_len));
+
+	memcpy(pos, &event_len, sizeof(event_len));
+	memcpy(remote_eh, eh, size);
+	remote_eh->type_id = remote_ev;
+	batch->len += EMP_BATCH_RECORD_SIZE(size);
+
+	/* The first event in the batch starts the timeout. */
+	(void)k_work_schedule(&batch->flush_work,
+			      K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BATCH_TIMEOUT_MS));
+
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
+
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+
+	if (remote_ev == NULL) {
+		return 0;
+	}
+
+	size_t size = app_event_manager_event_size(eh);
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	if (batch_fits(size)) {
+		return batch_add(ipc, eh, remote_ev, size);
+	}
+
+	/* Keep the order of events, send the pending batch first. */
+	k_mutex_lock(&ipc->batch.lock, K_FOREVER);
+	int ret = batch_flush(ipc);
+
+	k_mutex_unlock(&ipc->batch.lock);
+
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+
+	memcpy(buffer, eh, sizeof(buffer));
+	remote_eh->type_id = remote_ev;
+	/* The list node is meaningless on the remote, clear it so it cannot be taken
+	 * for the batch frame marker.
+	 */
+	memset(&remote_eh->node, 0, sizeof(remote_eh->node));
+
+	return send_to_remote(ipc, buffer, sizeof(buffer));
+}
+
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
 	int ret = 0;
@@ -356,6 +543,10 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 
 	k_event_init(&ipc->bound);
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	batch_init(ipc);
+#endif
+
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
 		LOG_ERR("Error registering endpoint in ipc service (%d)", ret);
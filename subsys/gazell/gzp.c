@@ -52,6 +52,18 @@ static const struct device *crypto_dev = DEVICE_DT_GET_ONE(nordic_nrf_ecb);
 #ifdef CONFIG_GAZELL_PAIRING_CRYPT
 static uint8_t gzp_session_token[GZP_SESSION_TOKEN_LENGTH];
 static uint8_t gzp_dyn_key[GZP_DYN_KEY_LENGTH];
+
+/*
+ * Key, init vector and AES output of the last gzp_crypt() call. Packets and
+ * their responses are usually ciphered with the same key and session token,
+ * so the AES output can be reused.
+ */
+static struct {
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t encrypted[16];
+	bool valid;
+} gzp_crypt_cache;
 #endif
 
 
@@ -238,6 +250,13 @@ void gzp_crypt(uint8_t *dst, const uint8_t *src, uint8_t length)
 		}
 	}
 
+	if (gzp_crypt_cache.valid &&
+	    !memcmp(gzp_crypt_cache.key, key, sizeof(key)) &&
+	    !memcmp(gzp_crypt_cache.iv, iv, sizeof(iv))) {
+		gzp_xor_cipher(dst, src, gzp_crypt_cache.encrypted, length);
+		return;
+	}
+
 	uint32_t cap_flags = CAP_RAW_KEY | CAP_SYNC_OPS | CAP_SEPARATE_IO_BUFS;
 	struct cipher_ctx ini = {
 		.keylen = sizeof(key),
@@ -263,6 +282,11 @@ void gzp_crypt(uint8_t *dst, const uint8_t *src, uint8_t length)
 	err = cipher_free_session(crypto_dev, &ini);
 	__ASSERT(!err, "Cannot clean up crypto session");
 
+	memcpy(gzp_crypt_cache.key, key, sizeof(key));
+	memcpy(gzp_crypt_cache.iv, iv, sizeof(iv));
+	memcpy(gzp_crypt_cache.encrypted, encrypted, sizeof(encrypted));
+	gzp_crypt_cache.valid = true;
+
 	/* Encrypt data by XOR'ing with AES output */
 	gzp_xor_cipher(dst, src, encrypted, length);
 }
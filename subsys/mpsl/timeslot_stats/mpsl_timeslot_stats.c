@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+#include <mpsl/mpsl_timeslot_stats.h>
+
+#if CONFIG_MPSL_TIMESLOT_STATS_PROFILER
+#include <nrf_profiler.h>
+#endif
+
+static sys_slist_t users = SYS_SLIST_STATIC_INIT(&users);
+
+/* The counters are updated from the timeslot signal handlers, which run in interrupt context. */
+static struct k_spinlock lock;
+
+#if CONFIG_MPSL_TIMESLOT_STATS_PROFILER
+static uint16_t profiler_event_id;
+static bool profiler_event_registered;
+#endif
+
+void mpsl_timeslot_stats_register(struct mpsl_timeslot_stats_user *user, const char *name)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	if (!sys_slist_find(&users, &user->node, NULL)) {
+		memset(&user->stats, 0, sizeof(user->stats));
+		user->name = name;
+		user->reset_ms = k_uptime_get();
+		sys_slist_append(&users, &user->node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+#if CONFIG_MPSL_TIMESLOT_STATS_PROFILER
+	if (!profiler_event_registered) {
+		static const char *const labels[] = {"user", "busy_us", "overrun"};
+		static const enum nrf_profiler_arg types[] = {
+			NRF_PROFILER_ARG_STRING, NRF_PROFILER_ARG_U32, NRF_PROFILER_ARG_U8};
+
+		profiler_event_id = nrf_profiler_register_event_type(
+			"mpsl_timeslot", labels, types, ARRAY_SIZE(types));
+		profiler_event_registered = true;
+	}
+#endif /* CONFIG_MPSL_TIMESLOT_STATS_PROFILER */
+}
+
+void mpsl_timeslot_stats_requested(struct mpsl_timeslot_stats_user *user)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	user->stats.requested++;
+
+	k_spin_unlock(&lock, key);
+}
+
+void mpsl_timeslot_stats_start(struct mpsl_timeslot_stats_user *user)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	user->stats.granted++;
+	user->start_cyc = k_cycle_get_32();
+
+	k_spin_unlock(&lock, key);
+}
+
+void mpsl_timeslot_stats_end(struct mpsl_timeslot_stats_user *user, uint32_t length_us)
+{
+	uint32_t busy_us;
+	bool overrun;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	busy_us = k_cyc_to_us_ceil32(k_cycle_get_32() - user->start_cyc);
+	overrun = (busy_us > length_us);
+
+	user->stats.busy_us_total += busy_us;
+	user->stats.busy_us_max = MAX(user->stats.busy_us_max, busy_us);
+	user->stats.overruns += overrun;
+
+	k_spin_unlock(&lock, key);
+
+#if CONFIG_MPSL_TIMESLOT_STATS_PROFILER
+	if (profiler_event_registered && is_profiling_enabled(profiler_event_id)) {
+		struct log_event_buf buf;
+
+		nrf_profiler_log_start(&buf);
+		nrf_profiler_log_encode_string(&buf, user->name);
+		nrf_profiler_log_encode_uint32(&buf, busy_us);
+		nrf_profiler_log_encode_uint8(&buf, overrun);
+		nrf_profiler_log_send(&buf, profiler_event_id);
+	}
+#endif /* CONFIG_MPSL_TIMESLOT_STATS_PROFILER */
+}
+
+void mpsl_timeslot_stats_blocked(struct mpsl_timeslot_stats_user *user)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	user->stats.blocked++;
+
+	k_spin_unlock(&lock, key);
+}
+
+void mpsl_timeslot_stats_cancelled(struct mpsl_timeslot_stats_user *user)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	user->stats.cancelled++;
+
+	k_spin_unlock(&lock, key);
+}
+
+void mpsl_timeslot_stats_get(struct mpsl_timeslot_stats_user *user,
+			     struct mpsl_timeslot_stats *stats, int64_t *elapsed_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = user->stats;
+	if (elapsed_ms) {
+		*elapsed_ms = k_uptime_get() - user->reset_ms;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void mpsl_timeslot_stats_reset(void)
+{
+	struct mpsl_timeslot_stats_user *user;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int64_t now = k_uptime_get();
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&users, user, node) {
+		memset(&user->stats, 0, sizeof(user->stats));
+		user->reset_ms = now;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+#if CONFIG_MPSL_TIMESLOT_STATS_SHELL
+static int cmd_stats_show(const struct shell *shell, size_t argc, char **argv)
+{
+	struct mpsl_timeslot_stats_user *user;
+	struct mpsl_timeslot_stats stats;
+	int64_t elapsed_ms;
+
+	shell_print(shell, "%-12s %8s %8s %8s %8s %8s %16s %8s", "User", "Request", "Grant",
+		    "Block", "Cancel", "Overrun", "Busy avg/max[us]", "Busy[%]");
+
+	/* Users are only appended, so the list can be walked without the lock. */
+	SYS_SLIST_FOR_EACH_CONTAINER(&users, user, node) {
+		mpsl_timeslot_stats_get(user, &stats, &elapsed_ms);
+
+		uint32_t granted = MAX(stats.granted, 1);
+		uint64_t elapsed_us = MAX(elapsed_ms, 1) * USEC_PER_MSEC;
+
+		shell_print(shell, "%-12s %8u %8u %8u %8u %8u %7u/%-8u %8u.%02u", user->name,
+			    stats.requested, stats.granted, stats.blocked, stats.cancelled,
+			    stats.overruns, (uint32_t)(stats.busy_us_total / granted),
+			    stats.busy_us_max,
+			    (uint32_t)(stats.busy_us_total * 100 / elapsed_us),
+			    (uint32_t)(stats.busy_us_total * 10000 / elapsed_us % 100));
+	}
+
+	return 0;
+}
+
+static int cmd_stats_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	mpsl_timeslot_stats_reset();
+	shell_print(shell, "Statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_mpsl_timeslot,
+	SHELL_CMD_ARG(stats, NULL, "Show statistics of the MPSL timeslot users",
+		      cmd_stats_show, 0, 0),
+	SHELL_CMD_ARG(stats_reset, NULL, "Reset statistics of the MPSL timeslot users",
+		      cmd_stats_reset, 0, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(mpsl_timeslot, &sub_mpsl_timeslot, "MPSL timeslot commands", NULL);
+#endif /* CONFIG_MPSL_TIMESLOT_STATS_SHELL */
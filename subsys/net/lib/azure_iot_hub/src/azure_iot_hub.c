@@ -457,13 +457,26 @@ AZ_HUB_STATIC void on_publish(struct mqtt_helper_buf topic, struct mqtt_helper_b
 	azure_iot_hub_notify_event(&evt);
 }
 
-AZ_HUB_STATIC void on_connack(enum mqtt_conn_return_code return_code, bool session_present)
+static void ready_notify(void)
 {
-	ARG_UNUSED(session_present);
+	struct azure_iot_hub_evt evt = {
+		.type = AZURE_IOT_HUB_EVT_READY,
+	};
 
+	azure_iot_hub_notify_event(&evt);
+
+	if (IS_ENABLED(CONFIG_AZURE_IOT_HUB_AUTO_DEVICE_TWIN_REQUEST) ||
+	    IS_ENABLED(CONFIG_AZURE_FOTA)) {
+		device_twin_request();
+	}
+}
+
+AZ_HUB_STATIC void on_connack(enum mqtt_conn_return_code return_code, bool session_present)
+{
 	int err;
 	struct azure_iot_hub_evt evt = {
 		.type = AZURE_IOT_HUB_EVT_CONNECTED,
+		.data.persistent_session = session_present,
 	};
 
 	if (return_code != MQTT_CONNECTION_ACCEPTED) {
@@ -481,6 +494,16 @@ AZ_HUB_STATIC void on_connack(enum mqtt_conn_return_code return_code, bool sessi
 
 	LOG_DBG("MQTT mqtt_client connected");
 
+	/* The broker kept the subscriptions from the previous session, no need to
+	 * subscribe again.
+	 */
+	if (session_present) {
+		LOG_DBG("Resuming persistent session");
+		azure_iot_hub_notify_event(&evt);
+		ready_notify();
+		return;
+	}
+
 	err = topic_subscribe();
 	if (err) {
 		LOG_ERR("Failed to subscribe to topics, err: %d", err);
@@ -513,16 +536,7 @@ AZ_HUB_STATIC void on_puback(uint16_t message_id, int result)
 
 AZ_HUB_STATIC void on_suback(uint16_t message_id, int result)
 {
-	struct azure_iot_hub_evt evt = {
-		.type = AZURE_IOT_HUB_EVT_READY,
-	};
-
-	azure_iot_hub_notify_event(&evt);
-
-	if (IS_ENABLED(CONFIG_AZURE_IOT_HUB_AUTO_DEVICE_TWIN_REQUEST) ||
-	    IS_ENABLED(CONFIG_AZURE_FOTA)) {
-		device_twin_request();
-	}
+	ready_notify();
 }
 
 static void on_pingresp(void)
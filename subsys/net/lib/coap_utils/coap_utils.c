@@ -14,7 +14,8 @@ LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 #define MAX_COAP_MSG_LEN 256
 #define COAP_VER 1
 #define COAP_TOKEN_LEN 8
-#define COAP_MAX_REPLIES 1
+#define COAP_MAX_REPLIES CONFIG_COAP_UTILS_MAX_REPLIES
+#define COAP_MAX_PENDING CONFIG_COAP_UTILS_MAX_PENDING
 #define COAP_POOL_SLEEP 500
 #define COAP_OPEN_SOCKET_SLEEP 200
 #if defined(CONFIG_NRF_MODEM_LIB)
@@ -27,6 +28,23 @@ const static int nfds = 1;
 static struct pollfd fds;
 static struct coap_reply replies[COAP_MAX_REPLIES];
 static int proto_family;
+
+/* Index of the reply slot to reuse when all of them are in use. */
+static size_t next_reply_idx;
+
+/* Unacknowledged confirmable requests. The request is kept in the slot buffer for
+ * retransmission, and is linked to the reply slot that is released if the request
+ * is never acknowledged.
+ */
+static struct coap_pending pendings[COAP_MAX_PENDING];
+static uint8_t pending_bufs[COAP_MAX_PENDING][MAX_COAP_MSG_LEN];
+static struct coap_reply *pending_replies[COAP_MAX_PENDING];
+static struct k_work_delayable retransmit_work;
+
+/* Protects the reply and pending tables, which are used by both the sending
+ * threads and the receive thread.
+ */
+static K_MUTEX_DEFINE(coap_lock);
 static struct sockaddr *bind_addr;
 
 static K_THREAD_STACK_DEFINE(receive_stack_area, COAP_RECEIVE_STACK_SIZE);
@@ -60,11 +78,84 @@ static void coap_close_socket(int socket)
 	(void)close(socket);
 }
 
+static void retransmit_schedule(void)
+{
+	struct coap_pending *pending;
+	int64_t remaining;
+
+	pending = coap_pending_next_to_expire(pendings, COAP_MAX_PENDING);
+	if (!pending) {
+		(void)k_work_cancel_delayable(&retransmit_work);
+		return;
+	}
+
+	remaining = pending->t0 + pending->timeout - k_uptime_get();
+	(void)k_work_reschedule(&retransmit_work, K_MSEC(MAX(remaining, 0)));
+}
+
+static void pending_release(struct coap_pending *pending, bool clear_reply)
+{
+	size_t idx = pending - pendings;
+
+	if (clear_reply && pending_replies[idx]) {
+		coap_reply_clear(pending_replies[idx]);
+	}
+
+	pending_replies[idx] = NULL;
+	coap_pending_clear(pending);
+}
+
+static void retransmit_work_fn(struct k_work *work)
+{
+	int64_t now = k_uptime_get();
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	for (size_t i = 0; i < COAP_MAX_PENDING; i++) {
+		struct coap_pending *pending = &pendings[i];
+
+		if (!pending->timeout || (now < pending->t0 + pending->timeout)) {
+			continue;
+		}
+
+		if (!coap_pending_cycle(pending)) {
+			LOG_WRN("Confirmable request not acknowledged, giving up");
+			pending_release(pending, true);
+			continue;
+		}
+
+		if (sendto(fds.fd, pending->data, pending->len, 0, &pending->addr,
+			   sizeof(pending->addr)) < 0) {
+			LOG_ERR("Retransmission failed: %d", errno);
+		}
+	}
+
+	retransmit_schedule();
+
+	k_mutex_unlock(&coap_lock);
+}
+
+static void coap_send_empty_ack(const struct coap_packet *response,
+				const struct sockaddr *addr)
+{
+	struct coap_packet ack;
+	uint8_t buf[COAP_TOKEN_MAX_LEN + 4];
+
+	if (coap_ack_init(&ack, response, buf, sizeof(buf), COAP_CODE_EMPTY) < 0) {
+		return;
+	}
+
+	if (sendto(fds.fd, ack.data, ack.offset, 0, addr, sizeof(*addr)) < 0) {
+		LOG_ERR("Failed to send ACK: %d", errno);
+	}
+}
+
 static void coap_receive(void)
 {
 	static uint8_t buf[MAX_COAP_MSG_LEN + 1];
 	struct coap_packet response;
 	struct coap_reply *reply = NULL;
+	struct coap_pending *pending;
 	static struct sockaddr from_addr;
 	socklen_t from_addr_len;
 	int len;
@@ -128,11 +219,26 @@ static void coap_receive(void)
 			continue;
 		}
 
+		/* Separate responses are sent as confirmable messages. */
+		if (coap_header_get_type(&response) == COAP_TYPE_CON) {
+			coap_send_empty_ack(&response, &from_addr);
+		}
+
+		k_mutex_lock(&coap_lock, K_FOREVER);
+
+		pending = coap_pending_received(&response, pendings, COAP_MAX_PENDING);
+		if (pending) {
+			pending_release(pending, false);
+			retransmit_schedule();
+		}
+
 		reply = coap_response_received(&response, &from_addr, replies,
 					       COAP_MAX_REPLIES);
 		if (reply) {
 			coap_reply_clear(reply);
 		}
+
+		k_mutex_unlock(&coap_lock);
 	}
 }
 
@@ -188,16 +294,30 @@ static int coap_send_message(const struct sockaddr *addr,
 		      sizeof(*addr));
 }
 
-static void coap_set_response_callback(struct coap_packet *request,
-				       coap_reply_t reply_cb)
+static struct coap_reply *coap_set_response_callback(struct coap_packet *request,
+						      coap_reply_t reply_cb)
 {
-	struct coap_reply *reply;
+	struct coap_reply *reply = NULL;
 
-	reply = &replies[0];
+	for (size_t i = 0; i < COAP_MAX_REPLIES; i++) {
+		if (!replies[i].reply) {
+			reply = &replies[i];
+			break;
+		}
+	}
+
+	/* All slots are in use, drop the oldest outstanding request. */
+	if (!reply) {
+		LOG_WRN("No free reply slot, dropping an outstanding request");
+		reply = &replies[next_reply_idx];
+		next_reply_idx = (next_reply_idx + 1) % COAP_MAX_REPLIES;
+	}
 
 	coap_reply_clear(reply);
 	coap_reply_init(reply, request);
 	reply->reply = reply_cb;
+
+	return reply;
 }
 
 void coap_init(int ip_family, struct sockaddr *addr)
@@ -211,6 +331,8 @@ void coap_init(int ip_family, struct sockaddr *addr)
 	fds.revents = 0;
 	fds.fd = coap_open_socket();
 
+	k_work_init_delayable(&retransmit_work, retransmit_work_fn);
+
 	/* start sock receive thread */
 	k_thread_create(&receive_thread_data, receive_stack_area,
 			K_THREAD_STACK_SIZEOF(receive_stack_area),
@@ -237,7 +359,9 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 	}
 
 	if (reply_cb != NULL) {
+		k_mutex_lock(&coap_lock, K_FOREVER);
 		coap_set_response_callback(&request, reply_cb);
+		k_mutex_unlock(&coap_lock);
 	}
 
 	ret = coap_send_message(addr, &request);
@@ -249,3 +373,59 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 end:
 	return ret;
 }
+
+int coap_send_confirmable_request(enum coap_method method, const struct sockaddr *addr,
+				  const char *const *uri_path_options, uint8_t *payload,
+				  uint16_t payload_size, coap_reply_t reply_cb)
+{
+	int ret;
+	size_t idx;
+	struct coap_packet request;
+	struct coap_pending *pending;
+	struct coap_transmission_parameters params;
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	pending = coap_pending_next_unused(pendings, COAP_MAX_PENDING);
+	if (!pending) {
+		LOG_ERR("Too many unacknowledged confirmable requests");
+		ret = -ENOMEM;
+		goto end;
+	}
+
+	idx = pending - pendings;
+
+	ret = coap_init_request(method, COAP_TYPE_CON, uri_path_options,
+				payload, payload_size, &request, pending_bufs[idx]);
+	if (ret < 0) {
+		goto end;
+	}
+
+	params = coap_get_transmission_parameters();
+	ret = coap_pending_init(pending, &request, addr, &params);
+	if (ret < 0) {
+		LOG_ERR("Failed to init pending request");
+		goto end;
+	}
+
+	/* Set up the initial acknowledgment timeout. */
+	coap_pending_cycle(pending);
+
+	if (reply_cb != NULL) {
+		pending_replies[idx] = coap_set_response_callback(&request, reply_cb);
+	}
+
+	ret = coap_send_message(addr, &request);
+	if (ret < 0) {
+		LOG_ERR("Transmission failed: %d", errno);
+		pending_release(pending, true);
+		goto end;
+	}
+
+	retransmit_schedule();
+
+end:
+	k_mutex_unlock(&coap_lock);
+
+	return ret;
+}
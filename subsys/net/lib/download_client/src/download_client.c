@@ -36,6 +36,7 @@ int url_parse_host(const char *url, char *host, size_t len);
 
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+int http_get_request_send_ahead(struct download_client *client);
 
 int coap_block_init(struct download_client *client, size_t from);
 int coap_get_recv_timeout(struct download_client *dl);
@@ -326,6 +327,17 @@ static int client_socket_connect(struct download_client *dl, int type, uint16_t
 			}
 		}
 
+		if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_TLS_SESSION_CACHE)) {
+			int cache = TLS_SESSION_CACHE_ENABLED;
+
+			err = setsockopt(dl->fd, SOL_TLS, TLS_SESSION_CACHE, &cache,
+					 sizeof(cache));
+			if (err) {
+				LOG_WRN("Failed to enable TLS session cache, errno %d", errno);
+				/* Not fatal, so continue */
+			}
+		}
+
 		if (dl->proto == IPPROTO_DTLS_1_2 && IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_CID)) {
 			/* Enable connection ID */
 			uint32_t dtls_cid = TLS_DTLS_CID_ENABLED;
@@ -467,7 +479,8 @@ cleanup:
 	return err;
 }
 
-int socket_send(const struct download_client *client, size_t len, int timeout)
+int socket_send_buf(const struct download_client *client, const char *buf, size_t len,
+		    int timeout)
 {
 	int err;
 	int sent;
@@ -479,7 +492,7 @@ int socket_send(const struct download_client *client, size_t len, int timeout)
 	}
 
 	while (len) {
-		sent = send(client->fd, client->buf + off, len, 0);
+		sent = send(client->fd, buf + off, len, 0);
 		if (sent < 0) {
 			return -errno;
 		}
@@ -491,6 +504,11 @@ int socket_send(const struct download_client *client, size_t len, int timeout)
 	return 0;
 }
 
+int socket_send(const struct download_client *client, size_t len, int timeout)
+{
+	return socket_send_buf(client, client->buf, len, timeout);
+}
+
 static int request_send(struct download_client *dl)
 {
 	if (dl->fd < 0) {
@@ -546,6 +564,10 @@ static int reconnect(struct download_client *dl)
 	int err;
 
 	LOG_INF("Reconnecting...");
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+	/* Any request sent ahead is lost with the connection */
+	dl->http.request_sent = false;
+#endif
 	if (dl->fd >= 0) {
 		err = close(dl->fd);
 		if (err) {
@@ -727,6 +749,18 @@ static int handle_received(struct download_client *dl, ssize_t len)
 		LOG_INF("Downloaded %u bytes", dl->progress);
 	}
 
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+	/* Request the next range before handing the fragment to the application,
+	 * so that the response is on its way while the application processes it.
+	 */
+	if ((rc == 0) && dl->http.ranged && !dl->http.connection_close &&
+	    (dl->progress != dl->file_size) &&
+	    (dl->proto == IPPROTO_TCP || dl->proto == IPPROTO_TLS_1_2)) {
+		/* On failure, the request is sent again the usual way */
+		(void)http_get_request_send_ahead(dl);
+	}
+#endif
+
 	/* Send fragment to application.
 	 * If the application callback returns non-zero, stop.
 	 */
@@ -828,6 +862,14 @@ void download_thread(void *client, void *a, void *b)
 
 		/* Request loop */
 		while (is_downloading(dl)) {
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+			if (send_request && dl->http.request_sent) {
+				/* The request for this range was sent ahead */
+				dl->http.request_sent = false;
+				dl->offset = 0;
+				send_request = false;
+			}
+#endif
 			if (send_request) {
 				/* Request next fragment */
 				dl->offset = 0;
@@ -892,6 +934,18 @@ void download_thread(void *client, void *a, void *b)
 			}
 		}
 
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+		if (dl->http.request_sent && !is_closing(dl)) {
+			/* The response to the request sent ahead would be read by the
+			 * next download, reconnect to drop it.
+			 */
+			k_mutex_lock(&dl->mutex, K_FOREVER);
+			(void)reconnect(dl);
+			k_mutex_unlock(&dl->mutex);
+		}
+		dl->http.request_sent = false;
+#endif
+
 		if (is_closing(dl)) {
 			handle_disconnect(dl);
 			LOG_DBG("Connection closed");
@@ -45,8 +45,13 @@ extern char *strnstr(const char *haystack, const char *needle, size_t haystack_s
 int url_parse_host(const char *url, char *host, size_t len);
 int url_parse_file(const char *url, char *file, size_t len);
 int socket_send(const struct download_client *client, size_t len, int timeout);
+int socket_send_buf(const struct download_client *client, const char *buf, size_t len,
+		    int timeout);
 
-int http_get_request_send(struct download_client *client)
+/* Format the request for the range starting at the current progress.
+ * Returns the length of the request, or a negative error code.
+ */
+static int http_get_request_format(struct download_client *client, char *buf, size_t size)
 {
 	int err;
 	int len;
@@ -57,8 +62,6 @@ int http_get_request_send(struct download_client *client)
 	__ASSERT_NO_MSG(client->host);
 	__ASSERT_NO_MSG(client->file);
 
-	client->http.has_header = false;
-
 	err = url_parse_host(client->host, host, sizeof(host));
 	if (err) {
 		return err;
@@ -84,29 +87,38 @@ int http_get_request_send(struct download_client *client)
 
 	if (client->proto == IPPROTO_TLS_1_2
 	   || IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_RANGE, file, host, client->progress, off);
+		len = snprintf(buf, size, HTTP_GET_RANGE, file, host, client->progress, off);
 		client->http.ranged = true;
 	} else if (client->progress) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_OFFSET, file, host, client->progress);
+		len = snprintf(buf, size, HTTP_GET_OFFSET, file, host, client->progress);
 		client->http.ranged = false;
 	} else {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET, file, host);
+		len = snprintf(buf, size, HTTP_GET, file, host);
 		client->http.ranged = false;
 	}
 
-	if (len < 0 || len > CONFIG_DOWNLOAD_CLIENT_BUF_SIZE) {
+	if (len < 0 || len > size) {
 		LOG_ERR("Cannot create GET request, buffer too small");
 		return -ENOMEM;
 	}
 
 	if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(client->buf, len, "HTTP request");
+		LOG_HEXDUMP_DBG(buf, len, "HTTP request");
+	}
+
+	return len;
+}
+
+int http_get_request_send(struct download_client *client)
+{
+	int err;
+	int len;
+
+	client->http.has_header = false;
+
+	len = http_get_request_format(client, client->buf, sizeof(client->buf));
+	if (len < 0) {
+		return len;
 	}
 
 	err = socket_send(client, len, 0);
@@ -118,6 +130,31 @@ int http_get_request_send(struct download_client *client)
 	return 0;
 }
 
+#if defined(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE)
+/* Send the request for the next range while the current fragment is still in the buffer */
+int http_get_request_send_ahead(struct download_client *client)
+{
+	int err;
+	int len;
+
+	len = http_get_request_format(client, client->http.req_buf, sizeof(client->http.req_buf));
+	if (len < 0) {
+		return len;
+	}
+
+	err = socket_send_buf(client, client->http.req_buf, len, 0);
+	if (err) {
+		LOG_DBG("Failed to send HTTP request ahead, errno %d", errno);
+		return err;
+	}
+
+	client->http.has_header = false;
+	client->http.request_sent = true;
+
+	return 0;
+}
+#endif /* CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE */
+
 /* Returns:
  *  1 while the header is being received
  *  0 if the header has been fully received
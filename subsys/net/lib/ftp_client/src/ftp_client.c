@@ -19,6 +19,7 @@ LOG_MODULE_REGISTER(ftp_client, CONFIG_FTP_CLIENT_LOG_LEVEL);
 #define INVALID_SEC_TAG		-1
 
 #define FTP_MAX_BUFFER_SIZE	708 /* align with MSS on modem side */
+#define FTP_DATA_BUFFER_SIZE	CONFIG_FTP_CLIENT_DATA_BUFFER_SIZE
 #define FTP_DATA_TIMEOUT_SEC	60  /* time in seconds to wait for "Transfer complete" */
 
 #define FTP_CODE_ANY		0
@@ -43,6 +44,9 @@ static struct ftp_client {
 
 static struct k_work_q ftp_work_q;
 static char ctrl_buf[FTP_MAX_BUFFER_SIZE];
+static char data_buf[FTP_DATA_BUFFER_SIZE];
+/* PASV response for the data task, as ctrl_buf is reused by the following commands */
+static char pasv_buf[FTP_MAX_BUFFER_SIZE];
 
 enum data_task_type {
 	TASK_SEND,
@@ -164,6 +168,20 @@ static int establish_data_channel(const char *pasv_msg)
 		return -errno;
 	}
 
+#if CONFIG_FTP_CLIENT_DATA_SOCKET_BUF_SIZE > 0
+	int buf_size = CONFIG_FTP_CLIENT_DATA_SOCKET_BUF_SIZE;
+
+	/* Not all socket implementations allow tuning the buffer size, keep the default then */
+	ret = setsockopt(client.data_sock, SOL_SOCKET, SO_RCVBUF, &buf_size, sizeof(buf_size));
+	if (ret) {
+		LOG_DBG("set SO_RCVBUF failed: %d", -errno);
+	}
+	ret = setsockopt(client.data_sock, SOL_SOCKET, SO_SNDBUF, &buf_size, sizeof(buf_size));
+	if (ret) {
+		LOG_DBG("set SO_SNDBUF failed: %d", -errno);
+	}
+#endif
+
 	return 0;
 }
 
@@ -319,8 +337,9 @@ static int do_ftp_recv_ctrl(bool post_result, int success_code)
 static void do_ftp_recv_data(const char *pasv_msg)
 {
 	int ret;
+	size_t offset;
+	bool done = false;
 	struct pollfd fds[1];
-	char data_buf[FTP_MAX_BUFFER_SIZE];
 
 	/* Establish data channel */
 	ret = establish_data_channel(pasv_msg);
@@ -341,18 +360,34 @@ static void do_ftp_recv_data(const char *pasv_msg)
 			LOG_DBG("No more data");
 			break;
 		}
-		ret = recv(client.data_sock, data_buf, sizeof(data_buf), 0);
-		if (ret < 0) {
-			LOG_ERR("recv(data) failed: (%d)", -errno);
-			break;
-		}
-		if (ret == 0) {
-			/* Server close connection */
-			break;
+
+		/* Drain whatever is already queued in the socket so that the data callback
+		 * is called once per full buffer rather than once per received segment.
+		 */
+		offset = 0;
+		do {
+			ret = recv(client.data_sock, data_buf + offset, sizeof(data_buf) - offset,
+				   offset ? MSG_DONTWAIT : 0);
+			if (ret < 0) {
+				if (offset == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+					LOG_ERR("recv(data) failed: (%d)", -errno);
+					done = true;
+				}
+				break;
+			}
+			if (ret == 0) {
+				/* Server close connection */
+				done = true;
+				break;
+			}
+			offset += ret;
+		} while (offset < sizeof(data_buf));
+
+		if (offset > 0) {
+			client.data_callback(data_buf, offset);
+			LOG_DBG("DATA received %d", (int)offset);
 		}
-		client.data_callback(data_buf, ret);
-		LOG_DBG("DATA received %d", ret);
-	} while (true);
+	} while (!done);
 
 	close(client.data_sock);
 	ftp_inactivity = false;
@@ -639,7 +674,8 @@ int ftp_list(const char *options, const char *target)
 	if (ret != FTP_CODE_227) {
 		return ret;
 	}
-	data_task_param.ctrl_msg = ctrl_buf;
+	strncpy(pasv_buf, ctrl_buf, sizeof(pasv_buf) - 1);
+	data_task_param.ctrl_msg = pasv_buf;
 	data_task_param.task = TASK_RECEIVE;
 
 	/* Send LIST/NLST command in control channel */
@@ -740,6 +776,11 @@ int ftp_delete(const char *file)
 }
 
 int ftp_get(const char *file)
+{
+	return ftp_get_resume(file, 0);
+}
+
+int ftp_get_resume(const char *file, uint32_t offset)
 {
 	int ret;
 	char get_cmd[128];
@@ -753,9 +794,23 @@ int ftp_get(const char *file)
 	if (ret != FTP_CODE_227) {
 		return ret;
 	}
-	data_task_param.ctrl_msg = ctrl_buf;
+	strncpy(pasv_buf, ctrl_buf, sizeof(pasv_buf) - 1);
+	data_task_param.ctrl_msg = pasv_buf;
 	data_task_param.task = TASK_RECEIVE;
 
+	/* Ask the server to skip the part of the file that was already received */
+	if (offset > 0) {
+		sprintf(get_cmd, CMD_REST, offset);
+		ret = do_ftp_send_ctrl(get_cmd, strlen(get_cmd));
+		if (ret) {
+			return -EIO;
+		}
+		ret = do_ftp_recv_ctrl(true, FTP_CODE_350);
+		if (ret != FTP_CODE_350) {
+			return ret;
+		}
+	}
+
 	/* Send RETR command in control channel */
 	sprintf(get_cmd, CMD_RETR, file);
 	ret = do_ftp_send_ctrl(get_cmd, strlen(get_cmd));
@@ -798,7 +853,8 @@ int ftp_put(const char *file, const uint8_t *data, uint16_t length, int type)
 		if (ret != FTP_CODE_227) {
 			return ret;
 		}
-		data_task_param.ctrl_msg = ctrl_buf;
+		strncpy(pasv_buf, ctrl_buf, sizeof(pasv_buf) - 1);
+		data_task_param.ctrl_msg = pasv_buf;
 		data_task_param.task = TASK_SEND;
 		data_task_param.data = (uint8_t *)data;
 		data_task_param.length = length;
@@ -140,6 +140,11 @@ int lwm2m_update_signal_meas_objects(const struct lte_lc_cells_info *const cells
 
 	LOG_INF("Updating information for %d neighbouring cells", cells->ncells_count);
 
+	/* Update all instances under the registry lock so that observers get
+	 * one notification for the whole measurement.
+	 */
+	lwm2m_registry_lock();
+
 	for (i = 0; i < MAX_INSTANCE_COUNT && i < cells->ncells_count; i++) {
 		update_signal_meas_object(&cells->neighbor_cells[i], i);
 	}
@@ -154,6 +159,8 @@ int lwm2m_update_signal_meas_objects(const struct lte_lc_cells_info *const cells
 	}
 	neighbours = cells->ncells_count;
 
+	lwm2m_registry_unlock();
+
 	return 0;
 }
 
@@ -93,6 +93,10 @@ static void modem_data_update(struct k_work *work)
 		return;
 	}
 
+	/* Hold the registry for the whole update so that pending observations
+	 * report all changed resources in one notification.
+	 */
+	lwm2m_registry_lock();
 	lwm2m_set_string(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
 			 CONNMON_IP_ADDRESSES, 0),
 			 modem_param.network.ip_address.value_string);
@@ -110,6 +114,7 @@ static void modem_data_update(struct k_work *work)
 	lwm2m_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_LAC),
 		      modem_param.network.area_code.value);
 #endif
+	lwm2m_registry_unlock();
 }
 
 /**@brief Callback handler for LTE RSRP data. */
@@ -25,8 +25,44 @@ static void lte_notify_handler(const struct lte_lc_evt *const evt);
 static K_SEM_DEFINE(rrc_idle, 0, 1);
 static bool measurement_scheduled;
 
+#if CONFIG_LWM2M_CLIENT_UTILS_NEIGHBOUR_CELL_MAX_AGE > 0
+static struct lte_lc_ncell last_ncells[MAX_INSTANCE_COUNT];
+
+/* Populate the signal measurement objects from the latest measurement, if recent enough */
+static bool ncell_last_measurement_use(void)
+{
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = last_ncells,
+	};
+	int64_t age_ms;
+	int err;
+
+	err = lte_lc_neighbor_cell_measurement_last_get(&cells, ARRAY_SIZE(last_ncells), 0,
+							&age_ms);
+	if ((err && err != -E2BIG) ||
+	    age_ms > CONFIG_LWM2M_CLIENT_UTILS_NEIGHBOUR_CELL_MAX_AGE * MSEC_PER_SEC) {
+		return false;
+	}
+
+	LOG_DBG("Using neighbor cell measurement made %lld ms ago", age_ms);
+
+	err = lwm2m_update_signal_meas_objects(&cells);
+	if (err && err != -ENODATA) {
+		LOG_ERR("lwm2m_update_signal_meas_objects, error: %d", err);
+	}
+
+	return true;
+}
+#endif
+
 void lwm2m_ncell_schedule_measurement(void)
 {
+#if CONFIG_LWM2M_CLIENT_UTILS_NEIGHBOUR_CELL_MAX_AGE > 0
+	if (ncell_last_measurement_use()) {
+		return;
+	}
+#endif
+
 	if (measurement_scheduled) {
 		LOG_WRN("Measurement already scheduled, waiting for RRC idle");
 		return;
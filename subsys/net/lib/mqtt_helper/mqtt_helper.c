@@ -259,6 +259,31 @@ static int publish_get_payload(struct mqtt_client *const mqtt_client, size_t len
 	return mqtt_readall_publish_payload(mqtt_client, payload_buf, length);
 }
 
+static int publish_stream_payload(struct mqtt_client *const mqtt_client,
+				  struct mqtt_helper_buf topic, size_t length)
+{
+	int err;
+	size_t offset = 0;
+	struct mqtt_helper_buf chunk = {
+		.ptr = payload_buf,
+	};
+
+	/* Deliver at least one, possibly empty, chunk per message. */
+	do {
+		chunk.size = MIN(length - offset, sizeof(payload_buf));
+
+		err = mqtt_readall_publish_payload(mqtt_client, payload_buf, chunk.size);
+		if (err) {
+			return err;
+		}
+
+		current_cfg.cb.on_publish_chunk(topic, chunk, offset, length);
+		offset += chunk.size;
+	} while (offset < length);
+
+	return 0;
+}
+
 static void send_ack(struct mqtt_client *const mqtt_client, uint16_t message_id)
 {
 	int err;
@@ -287,6 +312,20 @@ MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 		.ptr = payload_buf,
 	};
 
+	if (current_cfg.cb.on_publish_chunk) {
+		err = publish_stream_payload(&mqtt_client, topic, p->message.payload.len);
+		if (err) {
+			LOG_ERR("publish_stream_payload, error: %d", err);
+			return;
+		}
+
+		if (p->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			send_ack(&mqtt_client, p->message_id);
+		}
+
+		return;
+	}
+
 	err = publish_get_payload(&mqtt_client, p->message.payload.len);
 	if (err) {
 		LOG_ERR("publish_get_payload, error: %d", err);
@@ -516,7 +555,8 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 	tls_cfg->cipher_list	        = NULL; /* Use default */
 	tls_cfg->sec_tag_count	        = ARRAY_SIZE(sec_tag_list);
 	tls_cfg->sec_tag_list	        = sec_tag_list;
-	tls_cfg->session_cache	        = TLS_SESSION_CACHE_DISABLED;
+	tls_cfg->session_cache	        = IS_ENABLED(CONFIG_MQTT_HELPER_TLS_SESSION_CACHE) ?
+					  TLS_SESSION_CACHE_ENABLED : TLS_SESSION_CACHE_DISABLED;
 	tls_cfg->hostname	        = conn_params->hostname.ptr;
 	tls_cfg->set_native_tls		= IS_ENABLED(CONFIG_MQTT_HELPER_NATIVE_TLS);
 
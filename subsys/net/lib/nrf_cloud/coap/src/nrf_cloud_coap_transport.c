@@ -464,6 +464,128 @@ struct user_cb {
 	int result_code;
 };
 
+#if defined(CONFIG_NRF_CLOUD_COAP_COALESCE)
+/* A request that shares the response of an identical request already in flight */
+struct joined_transfer {
+	sys_snode_t node;
+	struct user_cb user_cb;
+	struct k_sem done;
+	int err;
+};
+
+/* The GET or FETCH request in flight, which other identical requests can join until
+ * the first block of the response is received.
+ */
+static struct {
+	bool joinable;
+	enum coap_method method;
+	const char *path;
+	const uint8_t *buf;
+	size_t buf_len;
+	enum coap_content_format fmt_in;
+	bool reliable;
+	sys_slist_t joined;
+} active;
+static K_MUTEX_DEFINE(active_mutex);
+
+static bool active_matches(enum coap_method method, const char *path, const uint8_t *buf,
+			   size_t buf_len, enum coap_content_format fmt_in, bool reliable)
+{
+	return active.joinable && (active.method == method) && (active.fmt_in == fmt_in) &&
+	       (active.reliable == reliable) && (active.buf_len == buf_len) &&
+	       (strcmp(active.path, path) == 0) &&
+	       ((buf_len == 0) || (memcmp(active.buf, buf, buf_len) == 0));
+}
+
+/* Wait for the response of an identical request in flight.
+ * Returns -ENOENT if there is no request to join.
+ */
+static int transfer_join(enum coap_method method, const char *path, const uint8_t *buf,
+			 size_t buf_len, enum coap_content_format fmt_in, bool reliable,
+			 coap_client_response_cb_t cb, void *user)
+{
+	struct joined_transfer joined = {
+		.user_cb = {
+			.cb = cb,
+			.user_data = user
+		}
+	};
+
+	if ((method != COAP_METHOD_GET) && (method != COAP_METHOD_FETCH)) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&active_mutex, K_FOREVER);
+	if (!active_matches(method, path, buf, buf_len, fmt_in, reliable)) {
+		k_mutex_unlock(&active_mutex);
+		return -ENOENT;
+	}
+	k_sem_init(&joined.done, 0, 1);
+	sys_slist_append(&active.joined, &joined.node);
+	k_mutex_unlock(&active_mutex);
+
+	LOG_DBG("Joined request in flight for %s", path);
+	(void)k_sem_take(&joined.done, K_FOREVER);
+
+	return joined.err;
+}
+
+static void transfer_active_set(enum coap_method method, const char *path, const uint8_t *buf,
+				size_t buf_len, enum coap_content_format fmt_in, bool reliable)
+{
+	k_mutex_lock(&active_mutex, K_FOREVER);
+	active.joinable = (method == COAP_METHOD_GET) || (method == COAP_METHOD_FETCH);
+	active.method = method;
+	active.path = path;
+	active.buf = buf;
+	active.buf_len = buf_len;
+	active.fmt_in = fmt_in;
+	active.reliable = reliable;
+	sys_slist_init(&active.joined);
+	k_mutex_unlock(&active_mutex);
+}
+
+/* Pass a response block to the joined requests. Once the first block is received,
+ * no request can join anymore, so the list is not modified while it is walked.
+ */
+static void transfer_joined_notify(int16_t result_code, size_t offset, const uint8_t *payload,
+				   size_t len, bool last_block)
+{
+	struct joined_transfer *joined;
+
+	k_mutex_lock(&active_mutex, K_FOREVER);
+	active.joinable = false;
+	k_mutex_unlock(&active_mutex);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&active.joined, joined, node) {
+		joined->user_cb.result_code = result_code;
+		if (joined->user_cb.cb) {
+			joined->user_cb.cb(result_code, offset, payload, len, last_block,
+					   joined->user_cb.user_data);
+		}
+	}
+}
+
+static void transfer_joined_release(int err)
+{
+	struct joined_transfer *joined;
+	sys_snode_t *node;
+
+	k_mutex_lock(&active_mutex, K_FOREVER);
+	active.joinable = false;
+	while ((node = sys_slist_get(&active.joined)) != NULL) {
+		joined = CONTAINER_OF(node, struct joined_transfer, node);
+		joined->err = err;
+		if (!active.reliable && !err &&
+		    (joined->user_cb.result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
+			joined->err = joined->user_cb.result_code;
+		}
+		k_sem_give(&joined->done);
+	}
+	k_mutex_unlock(&active_mutex);
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_COALESCE */
+
 static void client_callback(int16_t result_code, size_t offset, const uint8_t *payload, size_t len,
 			    bool last_block, void *user_data)
 {
@@ -489,6 +611,9 @@ static void client_callback(int16_t result_code, size_t offset, const uint8_t *p
 		LOG_DBG("Calling user's callback %p", user_cb->cb);
 		user_cb->cb(result_code, offset, payload, len, last_block, user_cb->user_data);
 	}
+#if defined(CONFIG_NRF_CLOUD_COAP_COALESCE)
+	transfer_joined_notify(result_code, offset, payload, len, last_block);
+#endif
 	if (last_block || (result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
 		LOG_DBG("End of client transfer");
 		k_sem_give(&cb_sem);
@@ -506,8 +631,6 @@ static int client_transfer(enum coap_method method,
 {
 	__ASSERT_NO_MSG(resource != NULL);
 
-	k_sem_take(&serial_sem, K_FOREVER);
-
 	int err;
 	int retry;
 	char path[MAX_COAP_PATH + 1];
@@ -550,6 +673,19 @@ static int client_transfer(enum coap_method method,
 		}
 	}
 
+#if defined(CONFIG_NRF_CLOUD_COAP_COALESCE)
+	err = transfer_join(method, path, buf, buf_len, fmt_in, reliable, cb, user);
+	if (err != -ENOENT) {
+		return err;
+	}
+#endif
+
+	k_sem_take(&serial_sem, K_FOREVER);
+
+#if defined(CONFIG_NRF_CLOUD_COAP_COALESCE)
+	transfer_active_set(method, path, buf, buf_len, fmt_in, reliable);
+#endif
+
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
 		METHOD_NAME(method), path, fmt_name(fmt_out), buf_len,
@@ -564,7 +700,8 @@ static int client_transfer(enum coap_method method,
 		 */
 		if (retry++ > MAX_RETRIES) {
 			LOG_ERR("Timeout waiting for CoAP client to be available");
-			return -ETIMEDOUT;
+			err = -ETIMEDOUT;
+			break;
 		}
 		LOG_DBG("CoAP client busy");
 		k_sleep(K_MSEC(500));
@@ -586,6 +723,9 @@ static int client_transfer(enum coap_method method,
 		err = user_cb.result_code;
 	}
 
+#if defined(CONFIG_NRF_CLOUD_COAP_COALESCE)
+	transfer_joined_release(err);
+#endif
 	k_sem_give(&serial_sem);
 	return err;
 }
@@ -92,6 +92,12 @@ int nrf_cloud_alert_encode(const struct nrf_cloud_alert_info *alert,
 int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *input,
 				 struct nrf_cloud_data *output);
 
+struct json_writer;
+
+/** @brief Write the sensor data message with a JSON writer, see nrf_cloud_json_writer.h. */
+void nrf_cloud_sensor_data_json_write(struct json_writer *const writer,
+				      const struct nrf_cloud_sensor_data *const sensor);
+
 /** @brief Encode general message of either a given numeric value or, if not NULL,
  *  a string value.  If topic is present, that topic will be used.
  */
@@ -111,10 +117,25 @@ int nrf_cloud_obj_endpoint_decode(const struct nrf_cloud_obj *const desired_obj,
 				  struct nrf_cloud_data *bin_endpoint,
 				  struct nrf_cloud_data *m_endpoint);
 
-/** @brief Encode state information. */
+/** @brief Encode state information.
+ *
+ * With CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA, only the reported fields that changed since the
+ * last acknowledged report are encoded, and -ENODATA is returned if nothing changed.
+ */
 int nrf_cloud_state_encode(uint32_t reported_state, const bool update_desired_topic,
 			   const bool add_info_sections, struct nrf_cloud_data *output);
 
+#if defined(CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA)
+/** @brief Mark the state last encoded by nrf_cloud_state_encode() as acknowledged. */
+void nrf_cloud_state_reported_ack(void);
+
+/** @brief Forget the acknowledged state, so that the next report is sent in full. */
+void nrf_cloud_state_reported_reset(void);
+#else
+static inline void nrf_cloud_state_reported_ack(void) {}
+static inline void nrf_cloud_state_reported_reset(void) {}
+#endif
+
 /** @brief Decode the shadow data and get the requested FSM state. */
 int nrf_cloud_shadow_data_state_decode(const struct nrf_cloud_obj_shadow_data *const input,
 				       enum nfsm_state *const requested_state);
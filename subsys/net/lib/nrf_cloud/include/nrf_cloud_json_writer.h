@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_WRITER_H_
+#define NRF_CLOUD_JSON_WRITER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <net/nrf_cloud.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Streaming JSON writer.
+ *
+ * Serializes an object member by member directly into a character buffer, without building
+ * a cJSON tree. The output is identical to cJSON_PrintUnformatted() for the same members.
+ * With a NULL buffer, the writer only counts the length of the output.
+ */
+struct json_writer {
+	/** Output buffer, or NULL to only measure. */
+	char *buf;
+	/** Size of the output buffer. */
+	size_t size;
+	/** Length of the output so far, excluding the null terminator. */
+	size_t len;
+	/** No member has been written yet in the current object. */
+	bool first;
+};
+
+/** @brief Function writing the members of a message, called once to measure and once to write. */
+typedef void (*json_writer_encode_t)(struct json_writer *const writer, const void *const ctx);
+
+void json_writer_init(struct json_writer *const writer, char *const buf, const size_t size);
+
+/** Start an object. Use a NULL key for the root object. */
+void json_writer_obj_start(struct json_writer *const writer, const char *const key);
+void json_writer_obj_end(struct json_writer *const writer);
+
+void json_writer_str_add(struct json_writer *const writer, const char *const key,
+			 const char *const str);
+void json_writer_int_add(struct json_writer *const writer, const char *const key,
+			 const int64_t value);
+
+/** Add an already encoded JSON value as is. */
+void json_writer_raw_add(struct json_writer *const writer, const char *const key,
+			 const char *const json, const size_t len);
+
+/** @brief Null-terminate the output.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if the output did not fit in the buffer.
+ */
+int json_writer_finish(struct json_writer *const writer);
+
+/** @brief Encode a message into a single allocation of exactly the needed size.
+ *
+ * The output must be freed with nrf_cloud_free().
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if memory could not be allocated.
+ */
+int json_writer_encode(json_writer_encode_t encode, const void *const ctx,
+		       struct nrf_cloud_data *const output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_WRITER_H_ */
@@ -53,6 +53,11 @@ void npgps_download_unlock(void);
 /* settings functions */
 int npgps_save_header(struct nrf_cloud_pgps_header *header);
 const struct nrf_cloud_pgps_header *npgps_get_saved_header(void);
+/* The slot table holds, for each storage block, the sentinel of the validated prediction
+ * stored in it, or zero if the block has to be validated in full.
+ */
+int npgps_save_slot_table(const uint32_t *table);
+const uint32_t *npgps_get_saved_slot_table(void);
 const struct gps_location *npgps_get_saved_location(void);
 int npgps_settings_init(void);
 
@@ -12,6 +12,7 @@
 #include <net/nrf_cloud_codec.h>
 #include <zephyr/net/mqtt.h>
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_writer.h"
 #include "nrf_cloud_fsm.h"
 #include "nrf_cloud_transport.h"
 #include "nrf_cloud_fota.h"
@@ -40,6 +41,15 @@ static nrf_cloud_event_handler_t app_event_handler;
 static volatile enum nfsm_state current_state = STATE_IDLE;
 static K_MUTEX_DEFINE(state_mutex);
 
+#if defined(CONFIG_NRF_CLOUD_MQTT_BATCH)
+/* Batch of device messages, "[msg,msg" without the closing bracket, empty if batch_len is 0 */
+static char batch_buf[CONFIG_NRF_CLOUD_MQTT_BATCH_BUF_SIZE];
+static size_t batch_len;
+static K_MUTEX_DEFINE(batch_mutex);
+static void batch_age_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_age_work, batch_age_work_fn);
+#endif
+
 #if IS_ENABLED(CONFIG_NRF_CLOUD_CONNECTION_POLL_THREAD)
 static K_SEM_DEFINE(connection_poll_sem, 0, 1);
 static atomic_t connection_poll_active;
@@ -198,6 +208,13 @@ int nrf_cloud_uninit(void)
 	app_event_handler = NULL;
 	nct_uninit();
 
+#if defined(CONFIG_NRF_CLOUD_MQTT_BATCH)
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	(void)k_work_cancel_delayable(&batch_age_work);
+	batch_len = 0;
+	k_mutex_unlock(&batch_mutex);
+#endif
+
 	atomic_set(&uninit_in_progress, 0);
 	return err;
 }
@@ -346,6 +363,144 @@ int nrf_cloud_sensor_data_stream(const struct nrf_cloud_sensor_data *param)
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_MQTT_BATCH)
+/* Space left for a message, keeping room for its separator and the closing bracket */
+static size_t batch_space_get(void)
+{
+	return sizeof(batch_buf) - batch_len - 2;
+}
+
+static int batch_flush_locked(void)
+{
+	int err;
+
+	if (batch_len == 0) {
+		return 0;
+	}
+
+	if (current_state != STATE_DC_CONNECTED) {
+		return -EACCES;
+	}
+
+	batch_buf[batch_len] = ']';
+
+	const struct nct_dc_data buf = {
+		.data.ptr = batch_buf,
+		.data.len = batch_len + 1,
+		.message_id = NCT_MSG_ID_USE_NEXT_INCREMENT
+	};
+
+	err = nct_dc_bulk_send(&buf, MQTT_QOS_1_AT_LEAST_ONCE);
+	if (err) {
+		LOG_ERR("Failed to publish batch, error: %d", err);
+		return err;
+	}
+
+	LOG_DBG("Published batch of %zu bytes", batch_len + 1);
+	batch_len = 0;
+	(void)k_work_cancel_delayable(&batch_age_work);
+
+	return 0;
+}
+
+static void batch_age_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	if (batch_flush_locked() == -EACCES) {
+		/* Try again once connected; the messages are kept meanwhile */
+		(void)k_work_reschedule(&batch_age_work,
+					K_SECONDS(CONFIG_NRF_CLOUD_MQTT_BATCH_MAX_AGE));
+	}
+	k_mutex_unlock(&batch_mutex);
+}
+
+/* Append the message written by the writer pass, flushing a full batch first */
+static int batch_append(void (*write)(struct json_writer *const writer, const void *const ctx),
+			const void *const ctx)
+{
+	struct json_writer writer;
+	int err = 0;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+
+	for (int attempt = 0; attempt < 2; attempt++) {
+		json_writer_init(&writer, &batch_buf[batch_len + 1], batch_space_get());
+		write(&writer, ctx);
+
+		if (writer.len <= batch_space_get()) {
+			batch_buf[batch_len] = (batch_len == 0) ? '[' : ',';
+			if ((batch_len == 0) && (CONFIG_NRF_CLOUD_MQTT_BATCH_MAX_AGE > 0)) {
+				(void)k_work_schedule(
+					&batch_age_work,
+					K_SECONDS(CONFIG_NRF_CLOUD_MQTT_BATCH_MAX_AGE));
+			}
+			batch_len += 1 + writer.len;
+			goto unlock;
+		}
+
+		if (batch_len == 0) {
+			break;
+		}
+
+		err = batch_flush_locked();
+		if (err) {
+			goto unlock;
+		}
+	}
+
+	LOG_ERR("Message of %zu bytes does not fit in the batch buffer", writer.len);
+	err = -E2BIG;
+
+unlock:
+	k_mutex_unlock(&batch_mutex);
+	return err;
+}
+
+static void batch_sensor_data_write(struct json_writer *const writer, const void *const ctx)
+{
+	nrf_cloud_sensor_data_json_write(writer, ctx);
+}
+
+static void batch_msg_write(struct json_writer *const writer, const void *const ctx)
+{
+	const struct nrf_cloud_data *msg = ctx;
+
+	json_writer_raw_add(writer, NULL, msg->ptr, msg->len);
+}
+
+int nrf_cloud_batch_sensor_data_add(const struct nrf_cloud_sensor_data *param)
+{
+	if ((param == NULL) || (param->data.ptr == NULL) || (param->data.len == 0) ||
+	    (nrf_cloud_sensor_app_id_lookup(param->type) == NULL)) {
+		return -EINVAL;
+	}
+
+	return batch_append(batch_sensor_data_write, param);
+}
+
+int nrf_cloud_batch_msg_add(const struct nrf_cloud_data *msg)
+{
+	if ((msg == NULL) || (msg->ptr == NULL) || (msg->len == 0)) {
+		return -EINVAL;
+	}
+
+	return batch_append(batch_msg_write, msg);
+}
+
+int nrf_cloud_batch_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	err = batch_flush_locked();
+	k_mutex_unlock(&batch_mutex);
+
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_MQTT_BATCH */
+
 int nrf_cloud_send(const struct nrf_cloud_tx_data *msg)
 {
 	int err;
@@ -105,7 +105,7 @@ int nrf_cloud_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *reques
 		if (!err) {
 			atomic_set(&request_in_progress, 1);
 		}
-	} else {
+	} else if (err != -ENODATA) {
 		err = -ENOMEM;
 	}
 
@@ -5,6 +5,7 @@
  */
 
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_writer.h"
 #include "nrf_cloud_mem.h"
 #include "nrf_cloud_fsm.h"
 #include <net/nrf_cloud_codec.h>
@@ -422,57 +423,149 @@ static bool compare(const char *s1, const char *s2)
 	return !strncmp(s1, s2, strlen(s2));
 }
 
+static void sensor_data_write(struct json_writer *const writer, const void *const ctx)
+{
+	const struct nrf_cloud_sensor_data *sensor = ctx;
+
+	json_writer_obj_start(writer, NULL);
+	json_writer_str_add(writer, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
+	json_writer_str_add(writer, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	json_writer_str_add(writer, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+			    NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		json_writer_int_add(writer, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	}
+	json_writer_obj_end(writer);
+}
+
+void nrf_cloud_sensor_data_json_write(struct json_writer *const writer,
+				      const struct nrf_cloud_sensor_data *const sensor)
+{
+	sensor_data_write(writer, sensor);
+}
+
 int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output)
 {
-	int ret;
-
 	__ASSERT_NO_MSG(sensor != NULL);
 	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
 	__ASSERT_NO_MSG(sensor->data.len != 0);
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
 
-	cJSON *root_obj = cJSON_CreateObject();
+	return json_writer_encode(sensor_data_write, sensor, output);
+}
 
-	if (root_obj == NULL) {
-		return -ENOMEM;
+#ifdef CONFIG_NRF_CLOUD_GATEWAY
+void nrf_cloud_register_gateway_state_handler(gateway_state_handler_t handler)
+{
+	gateway_state_handler = handler;
+}
+#endif
+
+#if defined(CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA)
+/* Reported state last acknowledged by the cloud, and the state pending acknowledgment */
+static cJSON *reported_mirror;
+static cJSON *reported_pending;
+
+/* Merge the members of patch into target, recursing into objects present in both */
+static int json_merge(cJSON *const target, const cJSON *const patch)
+{
+	const cJSON *item;
+
+	cJSON_ArrayForEach(item, patch) {
+		cJSON *existing = cJSON_GetObjectItemCaseSensitive(target, item->string);
+
+		if (cJSON_IsObject(existing) && cJSON_IsObject(item)) {
+			if (json_merge(existing, item)) {
+				return -ENOMEM;
+			}
+			continue;
+		}
+
+		cJSON *copy = cJSON_Duplicate(item, true);
+
+		if (!copy) {
+			return -ENOMEM;
+		}
+
+		if (existing) {
+			cJSON_ReplaceItemInObjectCaseSensitive(target, item->string, copy);
+		} else {
+			cJSON_AddItemToObject(target, item->string, copy);
+		}
 	}
 
-	ret = json_add_str_cs(root_obj, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-			       NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
-	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
-		ret += json_add_num_cs(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	return 0;
+}
+
+/* Remove the members of reported that have the same value in the mirror, recursively.
+ * Members missing from reported are left untouched in the cloud, as a shadow update
+ * only changes the fields it contains.
+ */
+static void json_unchanged_remove(cJSON *const reported, const cJSON *const mirror)
+{
+	cJSON *item = reported->child;
+
+	while (item) {
+		cJSON *next = item->next;
+		const cJSON *old = cJSON_GetObjectItemCaseSensitive(mirror, item->string);
+
+		if (cJSON_IsObject(old) && cJSON_IsObject(item)) {
+			json_unchanged_remove(item, old);
+			if (item->child == NULL) {
+				cJSON_DeleteItemFromObjectCaseSensitive(reported, item->string);
+			}
+		} else if (old && cJSON_Compare(item, old, true)) {
+			cJSON_DeleteItemFromObjectCaseSensitive(reported, item->string);
+		}
+
+		item = next;
 	}
+}
 
-	if (ret != 0) {
-		cJSON_Delete(root_obj);
+/* Replace the reported object with the fields changed since the last acknowledged report */
+static int reported_delta_apply(cJSON *const state_obj, cJSON *const reported_obj)
+{
+	cJSON *pending = reported_mirror ? cJSON_Duplicate(reported_mirror, true) :
+					   cJSON_CreateObject();
+
+	if (!pending || json_merge(pending, reported_obj)) {
+		cJSON_Delete(pending);
 		return -ENOMEM;
 	}
 
-	char *buffer;
-
-	buffer = cJSON_PrintUnformatted(root_obj);
-	cJSON_Delete(root_obj);
+	cJSON_Delete(reported_pending);
+	reported_pending = pending;
 
-	if (buffer == NULL) {
-		return -ENOMEM;
+	if (reported_mirror) {
+		json_unchanged_remove(reported_obj, reported_mirror);
 	}
 
-	output->ptr = buffer;
-	output->len = strlen(buffer);
+	if (reported_obj->child == NULL) {
+		cJSON_DeleteItemFromObjectCaseSensitive(state_obj, NRF_CLOUD_JSON_KEY_REP);
+	}
 
 	return 0;
 }
 
-#ifdef CONFIG_NRF_CLOUD_GATEWAY
-void nrf_cloud_register_gateway_state_handler(gateway_state_handler_t handler)
+void nrf_cloud_state_reported_ack(void)
 {
-	gateway_state_handler = handler;
+	if (reported_pending) {
+		cJSON_Delete(reported_mirror);
+		reported_mirror = reported_pending;
+		reported_pending = NULL;
+	}
 }
-#endif
+
+void nrf_cloud_state_reported_reset(void)
+{
+	cJSON_Delete(reported_mirror);
+	cJSON_Delete(reported_pending);
+	reported_mirror = NULL;
+	reported_pending = NULL;
+}
+#endif /* CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA */
 
 int nrf_cloud_state_encode(uint32_t reported_state, const bool update_desired_topic,
 			   const bool add_info_sections, struct nrf_cloud_data *output)
@@ -516,6 +609,10 @@ int nrf_cloud_state_encode(uint32_t reported_state, const bool update_desired_to
 		ret += json_add_null_cs(reported_obj, NRF_CLOUD_JSON_KEY_PAIR_STAT);
 		ret += json_add_null_cs(reported_obj, NRF_CLOUD_JSON_KEY_STAGE);
 
+#if defined(CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA)
+		/* The association is cleared, so the next reported state must be sent in full */
+		nrf_cloud_state_reported_reset();
+#endif
 	} else if (reported_state == STATE_UA_PIN_COMPLETE) {
 		struct nrf_cloud_data rx_endp;
 		struct nrf_cloud_data tx_endp;
@@ -568,6 +665,18 @@ int nrf_cloud_state_encode(uint32_t reported_state, const bool update_desired_to
 				ret = err;
 			}
 		}
+
+#if defined(CONFIG_NRF_CLOUD_SHADOW_REPORT_DELTA)
+		if ((ret == 0) && reported_delta_apply(state_obj, reported_obj)) {
+			ret = -ENOMEM;
+		}
+
+		if ((ret == 0) && (state_obj->child == NULL)) {
+			LOG_DBG("Reported state unchanged");
+			cJSON_Delete(root_obj);
+			return -ENODATA;
+		}
+#endif
 	}
 
 	if (ret == 0) {
@@ -1811,40 +1920,33 @@ cleanup:
 	return err;
 }
 
+static void shadow_data_write(struct json_writer *const writer, const void *const ctx)
+{
+	const struct nrf_cloud_sensor_data *sensor = ctx;
+
+	json_writer_obj_start(writer, NULL);
+	json_writer_obj_start(writer, NRF_CLOUD_JSON_KEY_STATE);
+	json_writer_obj_start(writer, NRF_CLOUD_JSON_KEY_REP);
+	json_writer_raw_add(writer, sensor_type_str[sensor->type], sensor->data.ptr,
+			    sensor->data.len);
+	json_writer_obj_end(writer);
+	json_writer_obj_end(writer);
+	json_writer_obj_end(writer);
+}
+
 int nrf_cloud_shadow_data_encode(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output)
 {
-	int ret;
-	char *buffer = NULL;
-
 	__ASSERT_NO_MSG(sensor != NULL);
 	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
 	__ASSERT_NO_MSG(sensor->data.len != 0);
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
 
-	cJSON *root_obj = cJSON_CreateObject();
-	cJSON *state_obj = cJSON_AddObjectToObjectCS(root_obj, NRF_CLOUD_JSON_KEY_STATE);
-	cJSON *reported_obj = cJSON_AddObjectToObjectCS(state_obj, NRF_CLOUD_JSON_KEY_REP);
-	cJSON *input_obj = cJSON_ParseWithLength(sensor->data.ptr, sensor->data.len);
-
-	ret = json_add_obj_cs(reported_obj, sensor_type_str[sensor->type], input_obj);
-
-	if (ret == 0) {
-		buffer = cJSON_PrintUnformatted(root_obj);
-	} else {
-		cJSON_Delete(input_obj);
-	}
-
-	if (buffer) {
-		output->ptr = buffer;
-		output->len = strlen(buffer);
-	} else {
-		ret = -ENOMEM;
-	}
-
-	cJSON_Delete(root_obj);
-	return ret;
+	/* The sensor data is already JSON, so it is copied as is instead of being parsed
+	 * into a tree and printed again.
+	 */
+	return json_writer_encode(shadow_data_write, sensor, output);
 }
 
 int nrf_cloud_dev_status_json_encode(const struct nrf_cloud_device_status *const dev_status,
@@ -191,6 +191,31 @@ static int state_ua_pin_wait(void)
 	return 0;
 }
 
+/* The pairing status is reported, continue with the data connection */
+static int pair_status_reported(void)
+{
+	int err;
+
+	nrf_cloud_state_reported_ack();
+
+	if (!persistent_session) {
+		err = nct_dc_connect();
+		if (err) {
+			return err;
+		}
+
+		nfsm_set_current_state_and_notify(STATE_DC_CONNECTING, NULL);
+	} else {
+		struct nct_evt nevt = { .type = NCT_EVT_DC_CONNECTED,
+					.status = 0 };
+
+		LOG_DBG("Previous session valid; skipping nct_dc_connect()");
+		nfsm_handle_incoming_event(&nevt, STATE_DC_CONNECTING);
+	}
+
+	return 0;
+}
+
 static int state_ua_pin_complete(void)
 {
 	int err;
@@ -198,10 +223,19 @@ static int state_ua_pin_complete(void)
 		.opcode = NCT_CC_OPCODE_UPDATE_ACCEPTED,
 		.message_id = NCT_MSG_ID_PAIR_STATUS_REPORT,
 	};
+	struct nrf_cloud_evt evt = {
+		.type = NRF_CLOUD_EVT_USER_ASSOCIATED,
+	};
 
 	err = nrf_cloud_state_encode(STATE_UA_PIN_COMPLETE, c2d_topic_modified,
 				     add_shadow_info, &msg.data);
-	if (err) {
+	if (err == -ENODATA) {
+		/* The shadow already holds the reported state, no update is needed */
+		add_shadow_info = false;
+		c2d_topic_modified = false;
+		nfsm_set_current_state_and_notify(STATE_UA_PIN_COMPLETE, &evt);
+		return pair_status_reported();
+	} else if (err) {
 		LOG_ERR("nrf_cloud_state_encode failed %d", err);
 		return err;
 	}
@@ -219,10 +253,6 @@ static int state_ua_pin_complete(void)
 		return err;
 	}
 
-	struct nrf_cloud_evt evt = {
-		.type = NRF_CLOUD_EVT_USER_ASSOCIATED,
-	};
-
 	nfsm_set_current_state_and_notify(STATE_UA_PIN_COMPLETE, &evt);
 
 	return err;
@@ -538,28 +568,12 @@ static int cc_rx_data_handler(const struct nct_evt *nct_evt)
 
 static int cc_tx_ack_handler(const struct nct_evt *nct_evt)
 {
-	int err;
-
 	if (nct_evt->param.message_id == NCT_MSG_ID_STATE_REQUEST) {
 		nfsm_set_current_state_and_notify(STATE_CLOUD_STATE_REQUESTED,
 						  NULL);
 		return 0;
 	} else if (nct_evt->param.message_id == NCT_MSG_ID_PAIR_STATUS_REPORT) {
-		if (!persistent_session) {
-			err = nct_dc_connect();
-			if (err) {
-				return err;
-			}
-
-			nfsm_set_current_state_and_notify(STATE_DC_CONNECTING,
-							  NULL);
-		} else {
-			struct nct_evt nevt = { .type = NCT_EVT_DC_CONNECTED,
-						.status = 0 };
-
-			LOG_DBG("Previous session valid; skipping nct_dc_connect()");
-			nfsm_handle_incoming_event(&nevt, STATE_DC_CONNECTING);
-		}
+		return pair_status_reported();
 	} else if (nct_evt->type == NCT_EVT_PINGRESP) {
 		struct nrf_cloud_evt evt = {
 			.type = NRF_CLOUD_EVT_PINGRESP,
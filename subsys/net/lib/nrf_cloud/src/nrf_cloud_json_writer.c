@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "nrf_cloud_json_writer.h"
+#include "nrf_cloud_mem.h"
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+static void put_char(struct json_writer *const writer, const char c)
+{
+	if (writer->buf && (writer->len < writer->size)) {
+		writer->buf[writer->len] = c;
+	}
+	writer->len++;
+}
+
+static void put_raw(struct json_writer *const writer, const char *const str, const size_t len)
+{
+	if (writer->buf && (writer->len < writer->size)) {
+		memcpy(&writer->buf[writer->len], str, MIN(len, writer->size - writer->len));
+	}
+	writer->len += len;
+}
+
+/* Escape a string the same way as cJSON does */
+static void put_string(struct json_writer *const writer, const char *str)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	put_char(writer, '"');
+
+	for (; *str; str++) {
+		const unsigned char c = (unsigned char)*str;
+
+		switch (c) {
+		case '"':
+		case '\\':
+			put_char(writer, '\\');
+			put_char(writer, c);
+			break;
+		case '\b':
+			put_raw(writer, "\\b", 2);
+			break;
+		case '\f':
+			put_raw(writer, "\\f", 2);
+			break;
+		case '\n':
+			put_raw(writer, "\\n", 2);
+			break;
+		case '\r':
+			put_raw(writer, "\\r", 2);
+			break;
+		case '\t':
+			put_raw(writer, "\\t", 2);
+			break;
+		default:
+			if (c < 32) {
+				put_raw(writer, "\\u00", 4);
+				put_char(writer, hex[c >> 4]);
+				put_char(writer, hex[c & 0xF]);
+			} else {
+				put_char(writer, c);
+			}
+			break;
+		}
+	}
+
+	put_char(writer, '"');
+}
+
+static void put_key(struct json_writer *const writer, const char *const key)
+{
+	if (!writer->first) {
+		put_char(writer, ',');
+	}
+	writer->first = false;
+
+	if (key) {
+		put_string(writer, key);
+		put_char(writer, ':');
+	}
+}
+
+void json_writer_init(struct json_writer *const writer, char *const buf, const size_t size)
+{
+	writer->buf = buf;
+	writer->size = size;
+	writer->len = 0;
+	writer->first = true;
+}
+
+void json_writer_obj_start(struct json_writer *const writer, const char *const key)
+{
+	put_key(writer, key);
+	put_char(writer, '{');
+	writer->first = true;
+}
+
+void json_writer_obj_end(struct json_writer *const writer)
+{
+	put_char(writer, '}');
+	writer->first = false;
+}
+
+void json_writer_str_add(struct json_writer *const writer, const char *const key,
+			 const char *const str)
+{
+	put_key(writer, key);
+	put_string(writer, str);
+}
+
+void json_writer_int_add(struct json_writer *const writer, const char *const key,
+			 const int64_t value)
+{
+	/* Formatted by hand, int64_t support in printf cannot be relied on */
+	char digits[20];
+	uint64_t magnitude = (value < 0) ? -(uint64_t)value : (uint64_t)value;
+	size_t count = 0;
+
+	put_key(writer, key);
+
+	if (value < 0) {
+		put_char(writer, '-');
+	}
+
+	do {
+		digits[count++] = '0' + (magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude);
+
+	while (count) {
+		put_char(writer, digits[--count]);
+	}
+}
+
+void json_writer_raw_add(struct json_writer *const writer, const char *const key,
+			 const char *const json, const size_t len)
+{
+	put_key(writer, key);
+	put_raw(writer, json, len);
+}
+
+int json_writer_finish(struct json_writer *const writer)
+{
+	if (!writer->buf) {
+		return 0;
+	}
+
+	if (writer->len >= writer->size) {
+		if (writer->size) {
+			writer->buf[writer->size - 1] = '\0';
+		}
+		return -ENOMEM;
+	}
+
+	writer->buf[writer->len] = '\0';
+	return 0;
+}
+
+int json_writer_encode(json_writer_encode_t encode, const void *const ctx,
+		       struct nrf_cloud_data *const output)
+{
+	struct json_writer writer;
+	char *buf;
+	int err;
+
+	/* First pass only measures, so that a single exact allocation is needed */
+	json_writer_init(&writer, NULL, 0);
+	encode(&writer, ctx);
+
+	buf = nrf_cloud_malloc(writer.len + 1);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	json_writer_init(&writer, buf, writer.len + 1);
+	encode(&writer, ctx);
+
+	err = json_writer_finish(&writer);
+	if (err) {
+		nrf_cloud_free(buf);
+		return err;
+	}
+
+	output->ptr = buf;
+	output->len = writer.len;
+
+	return 0;
+}
@@ -109,6 +109,11 @@ static uint8_t prediction_cache[PGPS_PREDICTION_STORAGE_SIZE];
 #endif
 
 static uint8_t prediction_buf[PGPS_PREDICTION_STORAGE_SIZE];
+
+/* Sentinel of the validated prediction in each storage block, zero if unknown.
+ * Saved to settings so that unchanged blocks only need their sentinel checked at boot.
+ */
+static uint32_t slot_table[NUM_BLOCKS];
 static volatile bool accept_packets;
 static volatile bool loading_in_progress;
 static volatile bool notified;
@@ -200,6 +205,44 @@ static struct nrf_cloud_pgps_prediction *get_prediction_slot(int slot, off_t *fl
 	return get_cached_prediction(off);
 }
 
+/**
+ * @brief Read only the sentinel of the prediction in a storage slot, without caching the
+ * whole prediction.
+ */
+static int get_slot_sentinel(int slot, off_t *flash_off, uint32_t *sentinel)
+{
+	off_t off = storage_addr + slot * PGPS_PREDICTION_STORAGE_SIZE;
+	off_t sentinel_off = off + offsetof(struct nrf_cloud_pgps_prediction, sentinel);
+
+	*flash_off = off;
+
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	return flash_area_read(prediction_flash_area, sentinel_off - prediction_flash_area->fa_off,
+			       sentinel, sizeof(*sentinel));
+#else
+	memcpy(sentinel, (const void *)sentinel_off, sizeof(*sentinel));
+	return 0;
+#endif
+}
+
+/**
+ * @brief Find the prediction number from a sentinel that was validated earlier.
+ *
+ * @return Prediction number, or -EINVAL if the sentinel is not an exact prediction
+ * time covered by the current header.
+ */
+static int sentinel_to_prediction_num(uint32_t sentinel)
+{
+	int64_t offset_sec = (int64_t)sentinel - index.start_sec;
+
+	if ((offset_sec < 0) || (offset_sec >= index.end_sec - index.start_sec) ||
+	    (offset_sec % index.period_sec) != 0) {
+		return -EINVAL;
+	}
+
+	return (int)(offset_sec / index.period_sec);
+}
+
 static int determine_prediction_num(struct nrf_cloud_pgps_header *header,
 				    struct nrf_cloud_pgps_prediction *p)
 {
@@ -332,17 +375,37 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 	int64_t start_gps_sec = index.start_sec;
 	off_t off;
 	int64_t gps_sec;
+	uint32_t sentinel;
+	const uint32_t *saved_slot_table = npgps_get_saved_slot_table();
+	bool verified[NUM_PREDICTIONS] = { 0 };
 
 	/* reset catalog of predictions */
 	discard_prediction_buffer();
 	for (pnum = 0; pnum < count; pnum++) {
 		index.predictions[pnum] = NULL;
 	}
+	memset(slot_table, 0, sizeof(slot_table));
 
 	npgps_reset_block_pool();
 
 	/* build catalog of predictions by block */
 	for (i = 0; i < count; i++) {
+		/* A block whose sentinel is unchanged since it was last validated is catalogued
+		 * from the sentinel alone; any other block is read and validated in full.
+		 */
+		if ((saved_slot_table[i] != 0) &&
+		    !get_slot_sentinel(i, &off, &sentinel) &&
+		    (sentinel == saved_slot_table[i])) {
+			pnum = sentinel_to_prediction_num(sentinel);
+			if ((pnum >= 0) && (index.predictions[pnum] == NULL)) {
+				index.predictions[pnum] = (struct nrf_cloud_pgps_prediction *)off;
+				verified[pnum] = true;
+				LOG_DBG("Prediction num:%u unchanged at idx:%d, off:0x%lX",
+					pnum, i, (unsigned long) off);
+				continue;
+			}
+		}
+
 		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
 		if (pred == NULL) {
 			LOG_ERR("Prediction at idx:%d not accessible", i);
@@ -370,17 +433,23 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 		gps_sec = start_gps_sec + pnum * period_min * SEC_PER_MIN;
 		npgps_gps_sec_to_day_time(gps_sec, &gps_day, &gps_time_of_day);
 
-		pred = get_prediction(pnum);
-		if (pred == NULL) {
-			LOG_WRN("Prediction num:%u missing", pnum);
-			/* request partial data; download interrupted? */
-			*first_bad_day = gps_day;
-			*first_bad_time = gps_time_of_day;
-			break;
-		}
+		if (verified[pnum]) {
+			/* Validated before and unchanged, don't read it again */
+			pred = index.predictions[pnum];
+			err = 0;
+		} else {
+			pred = get_prediction(pnum);
+			if (pred == NULL) {
+				LOG_WRN("Prediction num:%u missing", pnum);
+				/* request partial data; download interrupted? */
+				*first_bad_day = gps_day;
+				*first_bad_time = gps_time_of_day;
+				break;
+			}
 
-		err = validate_prediction(pred, gps_day, gps_time_of_day,
-					  period_min, true, false);
+			err = validate_prediction(pred, gps_day, gps_time_of_day,
+						  period_min, true, false);
+		}
 		if (err) {
 			LOG_ERR("Prediction num:%u, gps_day:%u, "
 				"gps_time_of_day:%u is bad:%d; loc:%p",
@@ -395,6 +464,12 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 		LOG_DBG("Prediction num:%u, loc:%p, blk:%d", pnum, pred, i);
 		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", pred);
 		npgps_mark_block_used(i, true);
+		slot_table[i] = (uint32_t)gps_sec;
+	}
+
+	err = npgps_save_slot_table(slot_table);
+	if (err) {
+		LOG_WRN("Error saving slot table:%d", err);
 	}
 
 	/* find first free block in flash, if any, after chronologicaly
@@ -1509,6 +1584,7 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 				goto fail;
 			}
 			index.predictions[pnum] = npgps_block_to_pointer(index.store_block);
+			slot_table[index.store_block] = (uint32_t)gps_sec;
 
 			if (!finished) {
 				if (loading_in_progress && !notified && (index.loading_count > 1)) {
@@ -1530,6 +1606,10 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 				}
 
 				LOG_INF("All P-GPS data received. Done.");
+				err = npgps_save_slot_table(slot_table);
+				if (err) {
+					LOG_WRN("Error saving slot table:%d", err);
+				}
 				state = PGPS_READY;
 				if (evt_handler) {
 					struct nrf_cloud_pgps_event evt = {
@@ -29,6 +29,8 @@ LOG_MODULE_DECLARE(nrf_cloud_pgps, CONFIG_NRF_CLOUD_GPS_LOG_LEVEL);
 #define SETTINGS_FULL_LOCATION			SETTINGS_NAME "/" SETTINGS_KEY_LOCATION
 #define SETTINGS_KEY_LEAP_SEC			"g2u_leap_sec"
 #define SETTINGS_FULL_LEAP_SEC			SETTINGS_NAME "/" SETTINGS_KEY_LEAP_SEC
+#define SETTINGS_KEY_SLOT_TABLE			"slot_table"
+#define SETTINGS_FULL_SLOT_TABLE		SETTINGS_NAME "/" SETTINGS_KEY_SLOT_TABLE
 
 struct block_pool {
 	int first_free;
@@ -44,6 +46,7 @@ static int num_blocks;
 static int gps_leap_seconds = GPS_TO_UTC_LEAP_SECONDS;
 static struct gps_location saved_location;
 static struct nrf_cloud_pgps_header saved_header;
+static uint32_t saved_slot_table[NUM_BLOCKS];
 
 static K_SEM_DEFINE(dl_active, 1, 1);
 
@@ -98,6 +101,14 @@ static int settings_set(const char *key, size_t len_rd,
 			return 0;
 		}
 	}
+	if (!strncmp(key, SETTINGS_KEY_SLOT_TABLE,
+		     strlen(SETTINGS_KEY_SLOT_TABLE)) &&
+	    (len_rd == sizeof(saved_slot_table))) {
+		if (read_cb(cb_arg, (void *)saved_slot_table, len_rd) == len_rd) {
+			LOG_DBG("Read slot table");
+			return 0;
+		}
+	}
 	return -ENOTSUP;
 }
 
@@ -133,6 +144,27 @@ const struct nrf_cloud_pgps_header *npgps_get_saved_header(void)
 	return &saved_header;
 }
 
+int npgps_save_slot_table(const uint32_t *table)
+{
+	int ret = 0;
+
+	if (!memcmp(saved_slot_table, table, sizeof(saved_slot_table))) {
+		/* Unchanged, spare the flash */
+		return 0;
+	}
+
+	LOG_DBG("Saving slot table");
+	memcpy(saved_slot_table, table, sizeof(saved_slot_table));
+	ret = settings_save_one(SETTINGS_FULL_SLOT_TABLE,
+				saved_slot_table, sizeof(saved_slot_table));
+	return ret;
+}
+
+const uint32_t *npgps_get_saved_slot_table(void)
+{
+	return saved_slot_table;
+}
+
 /* @TODO: consider rate-limiting these updates to reduce Flash wear */
 static int save_location(void)
 {
@@ -996,6 +996,68 @@ int nrf_cloud_rest_disconnect(struct nrf_cloud_rest_context *const rest_ctx)
 	return err;
 }
 
+int nrf_cloud_rest_session_begin(struct nrf_cloud_rest_context *const rest_ctx)
+{
+	if (!rest_ctx) {
+		return -EINVAL;
+	} else if (rest_ctx->session_active) {
+		return -EALREADY;
+	}
+
+#ifdef CONFIG_NRF_CLOUD_REST_AUTOGEN_JWT
+	if (!rest_ctx->auth) {
+		int err;
+		char *jwt = nrf_cloud_malloc(CONFIG_MODEM_JWT_MAX_LEN + 1);
+
+		if (!jwt) {
+			return -ENOMEM;
+		}
+
+		/* Generate the token once, instead of for each request of the session */
+		err = nrf_cloud_jwt_generate(CONFIG_NRF_CLOUD_REST_AUTOGEN_JWT_VALID_TIME_S,
+					     jwt, CONFIG_MODEM_JWT_MAX_LEN + 1);
+		if (err < 0) {
+			LOG_ERR("Failed to generate session JWT, error: %d", err);
+			nrf_cloud_free(jwt);
+			return err;
+		}
+
+		rest_ctx->session_jwt = jwt;
+		rest_ctx->auth = jwt;
+	}
+#endif /* CONFIG_NRF_CLOUD_REST_AUTOGEN_JWT */
+
+	rest_ctx->session_active = true;
+	rest_ctx->session_keep_alive = rest_ctx->keep_alive;
+	rest_ctx->keep_alive = true;
+
+	return 0;
+}
+
+int nrf_cloud_rest_session_end(struct nrf_cloud_rest_context *const rest_ctx)
+{
+	int err;
+
+	if (!rest_ctx || !rest_ctx->session_active) {
+		return -EINVAL;
+	}
+
+	if (rest_ctx->session_jwt) {
+		if (rest_ctx->auth == rest_ctx->session_jwt) {
+			rest_ctx->auth = NULL;
+		}
+		nrf_cloud_free(rest_ctx->session_jwt);
+		rest_ctx->session_jwt = NULL;
+	}
+
+	rest_ctx->keep_alive = rest_ctx->session_keep_alive;
+	rest_ctx->session_active = false;
+
+	err = nrf_cloud_rest_disconnect(rest_ctx);
+
+	return (err == -ENOTCONN) ? 0 : err;
+}
+
 int nrf_cloud_rest_jitp(const sec_tag_t nrf_cloud_sec_tag)
 {
 	__ASSERT_NO_MSG(nrf_cloud_sec_tag >= 0);
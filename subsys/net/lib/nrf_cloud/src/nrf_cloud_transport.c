@@ -509,6 +509,8 @@ static int nct_provision(void)
 	nct.tls_config.sec_tag_count = ARRAY_SIZE(sec_tag_list);
 	nct.tls_config.sec_tag_list = sec_tag_list;
 	nct.tls_config.hostname = NRF_CLOUD_HOSTNAME;
+	nct.tls_config.session_cache = IS_ENABLED(CONFIG_NRF_CLOUD_MQTT_TLS_SESSION_CACHE) ?
+				       TLS_SESSION_CACHE_ENABLED : TLS_SESSION_CACHE_DISABLED;
 
 #if defined(CONFIG_NRF_CLOUD_PROVISION_CERTIFICATES)
 		err = nrf_cloud_credentials_provision();
@@ -266,6 +266,31 @@ int filter_cme_error(struct command *cmd, int cme_error)
 	return filtered ? 0 : cme_error;
 }
 
+/**
+ * @brief Trim a response buffer to the length of the response it holds
+ *
+ * Responses are kept until the whole responses request is sent, so only the used part of the
+ * receive buffer is retained. With many commands, e.g. a large certificate bundle, this keeps
+ * the heap usage proportional to the response sizes instead of the receive buffer sizes.
+ *
+ * @param resp Response buffer, freed if a trimmed copy is returned
+ * @return Trimmed response, or the original buffer if a copy could not be allocated
+ */
+static char *trim_resp(char *resp)
+{
+	size_t len = strlen(resp) + 1;
+	char *trimmed = k_malloc(len);
+
+	if (!trimmed) {
+		return resp;
+	}
+
+	memcpy(trimmed, resp, len);
+	k_free(resp);
+
+	return trimmed;
+}
+
 static int exec_at_cmd(struct command *cmd_req, struct cdc_out_fmt_data *out)
 {
 	int ret;
@@ -325,6 +350,7 @@ static int exec_at_cmd(struct command *cmd_req, struct cdc_out_fmt_data *out)
 				LOG_ERR("AT cmd failed, error: %d", ret);
 			}
 		}
+		resp = trim_resp(resp);
 		break;
 	}
 
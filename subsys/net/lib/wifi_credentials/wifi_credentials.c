@@ -19,20 +19,46 @@ K_MUTEX_DEFINE(wifi_credentials_mutex);
 /* SSID cache: maps SSIDs to their storage indices */
 static char ssid_cache[CONFIG_WIFI_CREDENTIALS_MAX_ENTRIES][WIFI_SSID_MAX_LEN];
 static size_t ssid_cache_lengths[CONFIG_WIFI_CREDENTIALS_MAX_ENTRIES];
+/* SSID hashes, checked before comparing the cached SSIDs byte by byte */
+static uint32_t ssid_cache_hashes[CONFIG_WIFI_CREDENTIALS_MAX_ENTRIES];
+
+/**
+ * @brief Computes 32-bit FNV-1a hash of an SSID.
+ *
+ * @param ssid		SSID to hash
+ * @param ssid_len	length of the SSID
+ * @return		hash value
+ */
+static uint32_t ssid_hash(const void *ssid, size_t ssid_len)
+{
+	const uint8_t *bytes = ssid;
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < ssid_len; ++i) {
+		hash ^= bytes[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
 
 /**
  * @brief Finds index of given SSID if it exists.
  *
+ * Only the RAM index is consulted, the storage backend is not accessed.
+ *
  * @param ssid		SSID to look for (buffer of WIFI_SSID_MAX_LEN length)
  * @return		index if entry is found, -1 otherwise
  */
 static inline ssize_t lookup_idx(const uint8_t *ssid, size_t ssid_len)
 {
+	uint32_t hash = ssid_hash(ssid, ssid_len);
+
 	for (size_t i = 0; i < CONFIG_WIFI_CREDENTIALS_MAX_ENTRIES; ++i) {
-		if (ssid_len != ssid_cache_lengths[i]) {
+		if (ssid_len != ssid_cache_lengths[i] || hash != ssid_cache_hashes[i]) {
 			continue;
 		}
-		if (strncmp(ssid, ssid_cache[i], ssid_len) == 0) {
+		if (memcmp(ssid, ssid_cache[i], ssid_len) == 0) {
 			return i;
 		}
 	}
@@ -88,6 +114,7 @@ void wifi_credentials_cache_ssid(size_t idx, const struct wifi_credentials_heade
 {
 	memcpy(ssid_cache[idx], buf->ssid, buf->ssid_len);
 	ssid_cache_lengths[idx] = buf->ssid_len;
+	ssid_cache_hashes[idx] = ssid_hash(buf->ssid, buf->ssid_len);
 }
 
 /**
@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <errno.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include "msg_parser_local.h"
@@ -35,6 +36,67 @@ int nfc_ndef_msg_parse(uint8_t *result_buf,
 	return err;
 }
 
+void nfc_ndef_msg_iter_init(struct nfc_ndef_msg_iter *iter,
+			    const uint8_t *raw_data,
+			    uint32_t raw_data_len)
+{
+	iter->data = raw_data;
+	iter->data_len = raw_data_len;
+	iter->offset = 0;
+	iter->record_count = 0;
+	iter->done = false;
+}
+
+int nfc_ndef_msg_iter_next(struct nfc_ndef_msg_iter *iter,
+			   struct nfc_ndef_record_desc *rec_desc,
+			   struct nfc_ndef_bin_payload_desc *bin_pay_desc)
+{
+	int err;
+	uint32_t rec_len;
+	enum nfc_ndef_record_location record_location;
+
+	if (iter->done) {
+		return -ENOENT;
+	}
+
+	rec_len = iter->data_len - iter->offset;
+
+	err = nfc_ndef_record_parse(bin_pay_desc,
+				    rec_desc,
+				    &record_location,
+				    &iter->data[iter->offset],
+				    &rec_len);
+	if (err) {
+		return err;
+	}
+
+	/* Verify the records location flags. */
+	if (iter->record_count == 0) {
+		if ((record_location != NDEF_FIRST_RECORD) &&
+		    (record_location != NDEF_LONE_RECORD)) {
+			return -EFAULT;
+		}
+	} else {
+		if ((record_location != NDEF_MIDDLE_RECORD) &&
+		    (record_location != NDEF_LAST_RECORD)) {
+			return -EFAULT;
+		}
+	}
+
+	iter->offset += rec_len;
+	iter->record_count++;
+
+	if ((record_location == NDEF_LAST_RECORD) ||
+	    (record_location == NDEF_LONE_RECORD)) {
+		iter->done = true;
+	} else if (iter->offset >= iter->data_len) {
+		/* The message ends without its last record. */
+		iter->done = true;
+		return -EFAULT;
+	}
+
+	return 0;
+}
 
 void nfc_ndef_msg_printout(const struct nfc_ndef_msg_desc *msg_desc)
 {
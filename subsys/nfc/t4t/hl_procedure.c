@@ -25,6 +25,19 @@ LOG_MODULE_REGISTER(nfc_t4t_hl_procedure,
 #define CC_RAPDU_MAX_SIZE_OFFSET 0x03
 #define NFC_T4T_APDU_SELECT_DATA {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01}
 #define APDU_LE_MAP_2_MAX_VALUE 0xFF
+#define APDU_EXT_UPDATE_HEADER_SIZE 7
+
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_EXTENDED_APDU)
+/* Extended-length APDUs: the chunk size is only limited by the tag
+ * capabilities and local buffers. ISO-DEP chaining splits the APDU into frames.
+ */
+#define NDEF_READ_CHUNK_MAX CONFIG_NFC_T4T_HL_PROCEDURE_EXTENDED_APDU_RX_SIZE
+#define NDEF_UPDATE_CHUNK_MAX \
+	(CONFIG_NFC_T4T_HL_PROCEDURE_APDU_BUF_SIZE - APDU_EXT_UPDATE_HEADER_SIZE)
+#else
+#define NDEF_READ_CHUNK_MAX APDU_LE_MAP_2_MAX_VALUE
+#define NDEF_UPDATE_CHUNK_MAX APDU_LE_MAP_2_MAX_VALUE
+#endif
 #define NFC_T4T_APDU_RSP_ALL 256
 
 enum nfc_t4t_hl_transaction_type {
@@ -180,7 +193,7 @@ static int ndef_file_chunk_read(const struct nfc_t4t_apdu_resp *resp)
 		apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_READ;
 		apdu_comm.parameter = t4t_hl.file_offset;
 		apdu_comm.resp_len = MIN(t4t_hl.ndef.nlen - (t4t_hl.file_offset - NDEF_FILE_NLEN_SIZE),
-				MIN(APDU_LE_MAP_2_MAX_VALUE, t4t_hl.ndef.cc->max_rapdu_size));
+				MIN(NDEF_READ_CHUNK_MAX, t4t_hl.ndef.cc->max_rapdu_size));
 
 		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_READ;
 
@@ -215,7 +228,7 @@ static int ndef_file_chunk_update(void)
 		apdu_comm.parameter = t4t_hl.file_offset;
 		apdu_comm.data.buff = t4t_hl.ndef.buff + t4t_hl.file_offset;
 		apdu_comm.data.len = MIN(t4t_hl.ndef.buff_size - t4t_hl.file_offset,
-				MIN(APDU_LE_MAP_2_MAX_VALUE, t4t_hl.ndef.cc->max_capdu_size));
+				MIN(NDEF_UPDATE_CHUNK_MAX, t4t_hl.ndef.cc->max_capdu_size));
 
 		t4t_hl.file_offset += apdu_comm.data.len;
 		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_UPDATE;
@@ -75,6 +75,15 @@ struct tnep_tag {
 static struct tnep_control tnep_ctrl;
 static struct tnep_tag tnep;
 
+#if CONFIG_NFC_TNEP_TAG_INITIAL_MSG_CACHE_SIZE > 0
+/* Encoded initial NDEF message, reused each time the Tag returns to
+ * the Service Ready state. Only used when the message contains nothing but
+ * the statically defined Service Parameter records.
+ */
+static uint8_t initial_msg_cache[CONFIG_NFC_TNEP_TAG_INITIAL_MSG_CACHE_SIZE];
+static size_t initial_msg_cache_len;
+#endif
+
 struct tnep_state {
 	enum tnep_state_name name;
 	void (*process)(enum tnep_event);
@@ -106,14 +115,14 @@ static void tnep_tx_msg_clear(struct nfc_ndef_msg_desc *msg)
 	nfc_ndef_msg_clear(msg);
 }
 
-static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
+static int tnep_tx_msg_set(struct nfc_ndef_msg_desc *msg,
+			   const uint8_t *encoded, size_t *encoded_len)
 {
 	int err = 0;
 	unsigned int key;
 	size_t len;
 	uint8_t *data;
 
-
 	if (tnep.current_buff == tnep.tx.data) {
 		tnep.current_buff = tnep.tx.swap_data;
 	} else {
@@ -130,10 +139,18 @@ static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
 		data = nfc_t4t_ndef_file_msg_get(data);
 	}
 
-	if (msg && (msg->record_count > 0)) {
+	if (encoded) {
+		__ASSERT_NO_MSG(*encoded_len <= len);
+
+		memcpy(data, encoded, *encoded_len);
+		len = *encoded_len;
+	} else if (msg && (msg->record_count > 0)) {
 		err = nfc_ndef_msg_encode(msg,
 					  data,
 					  &len);
+		if (!err && encoded_len) {
+			*encoded_len = len;
+		}
 	}
 
 	if (IS_ENABLED(CONFIG_NFC_T4T_NRFXLIB)) {
@@ -151,6 +168,11 @@ static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
 	return err;
 }
 
+static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
+{
+	return tnep_tx_msg_set(msg, NULL, NULL);
+}
+
 static int tnep_tx_msg_add_rec(struct nfc_ndef_msg_desc *msg,
 			       const struct nfc_ndef_record_desc *record)
 {
@@ -198,6 +220,12 @@ static int tnep_tx_initial_msg_set(void)
 		return tnep.initial_msg_encode(&NFC_NDEF_MSG(initial_msg));
 	}
 
+#if CONFIG_NFC_TNEP_TAG_INITIAL_MSG_CACHE_SIZE > 0
+	if (initial_msg_cache_len > 0) {
+		return tnep_tx_msg_set(NULL, initial_msg_cache, &initial_msg_cache_len);
+	}
+#endif
+
 	STRUCT_SECTION_FOREACH(nfc_tnep_tag_service, tnep_svc) {
 		err = tnep_tx_msg_add_rec(&NFC_NDEF_MSG(initial_msg),
 					  tnep_svc->ndef_record);
@@ -206,7 +234,30 @@ static int tnep_tx_initial_msg_set(void)
 		}
 	}
 
+#if CONFIG_NFC_TNEP_TAG_INITIAL_MSG_CACHE_SIZE > 0
+	size_t len = 0;
+
+	err = tnep_tx_msg_set(&NFC_NDEF_MSG(initial_msg), NULL, &len);
+	if (err) {
+		return err;
+	}
+
+	/* The NDEF message sits behind the NLEN field when the NFC T4T library is used. */
+	const uint8_t *data = IS_ENABLED(CONFIG_NFC_T4T_NRFXLIB) ?
+			      nfc_t4t_ndef_file_msg_get(tnep.current_buff) :
+			      tnep.current_buff;
+
+	if ((len > 0) && (len <= sizeof(initial_msg_cache))) {
+		memcpy(initial_msg_cache, data, len);
+		initial_msg_cache_len = len;
+	} else {
+		LOG_DBG("Initial message does not fit in the cache: %zu bytes", len);
+	}
+
+	return 0;
+#else
 	return tnep_tx_msg_encode(&NFC_NDEF_MSG(initial_msg));
+#endif
 }
 
 static bool ndef_check_rec_type(const struct nfc_ndef_record_desc *record,
@@ -276,45 +276,6 @@ void nrf_profiler_log_start(struct log_event_buf *buf)
 	nrf_profiler_log_encode_uint32(buf, k_cycle_get_32());
 }
 
-void nrf_profiler_log_encode_uint32(struct log_event_buf *buf, uint32_t data)
-{
-	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
-			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
-	sys_put_le32(data, buf->payload);
-	buf->payload += sizeof(data);
-}
-
-void nrf_profiler_log_encode_int32(struct log_event_buf *buf, int32_t data)
-{
-	nrf_profiler_log_encode_uint32(buf, (uint32_t)data);
-}
-
-void nrf_profiler_log_encode_uint16(struct log_event_buf *buf, uint16_t data)
-{
-	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
-			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
-	sys_put_le16(data, buf->payload);
-	buf->payload += sizeof(data);
-}
-
-void nrf_profiler_log_encode_int16(struct log_event_buf *buf, int16_t data)
-{
-	nrf_profiler_log_encode_uint16(buf, (uint16_t)data);
-}
-
-void nrf_profiler_log_encode_uint8(struct log_event_buf *buf, uint8_t data)
-{
-	__ASSERT_NO_MSG(buf->payload - buf->payload_start + sizeof(data)
-			 <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN);
-	*(buf->payload) = data;
-	buf->payload += sizeof(data);
-}
-
-void nrf_profiler_log_encode_int8(struct log_event_buf *buf, int8_t data)
-{
-	nrf_profiler_log_encode_uint8(buf, (uint8_t)data);
-}
-
 void nrf_profiler_log_encode_string(struct log_event_buf *buf, const char *string)
 {
 	size_t string_len = strlen(string);
@@ -334,12 +295,6 @@ void nrf_profiler_log_encode_string(struct log_event_buf *buf, const char *strin
 	buf->payload += string_len;
 }
 
-void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
-				  const void *mem_address)
-{
-	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
-}
-
 static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
 {
 	buf->payload_start[0] = type_id;
@@ -72,6 +72,24 @@ void cracen_acquire(void);
  */
 void cracen_release(void);
 
+/** @brief CRACEN usage statistics. */
+struct cracen_stats {
+	/** Number of times CRACEN was powered on. */
+	uint32_t power_on_count;
+	/** Total time CRACEN was powered, in microseconds. */
+	uint64_t active_time_us;
+};
+
+/**
+ * @brief Get CRACEN usage statistics.
+ *
+ * Requires CONFIG_CRACEN_STATS. The active time includes the ongoing power-on
+ * period, if any.
+ *
+ * @param[out] stats Statistics.
+ */
+void cracen_stats_get(struct cracen_stats *stats);
+
 /**
  * @}
  */
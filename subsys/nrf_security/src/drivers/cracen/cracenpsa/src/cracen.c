@@ -20,6 +20,12 @@
 
 static int users;
 
+#if defined(CONFIG_CRACEN_STATS)
+static uint32_t power_on_count;
+static int64_t power_on_ticks;
+static uint64_t active_ticks;
+#endif
+
 K_MUTEX_DEFINE(cracen_mutex);
 
 LOG_MODULE_REGISTER(cracen, CONFIG_CRACEN_LOG_LEVEL);
@@ -157,6 +163,11 @@ void cracen_acquire(void)
 							     CRACEN_ENABLE_PKEIKG_Msk);
 		LOG_DBG("Power on CRACEN.");
 		irq_enable(CRACEN_IRQn);
+
+#if defined(CONFIG_CRACEN_STATS)
+		power_on_count++;
+		power_on_ticks = k_uptime_ticks();
+#endif
 	}
 
 	k_mutex_unlock(&cracen_mutex);
@@ -199,11 +210,34 @@ void cracen_release(void)
 		NVIC_ClearPendingIRQ(CRACEN_IRQn);
 
 		LOG_DBG("Powered off CRACEN.");
+
+#if defined(CONFIG_CRACEN_STATS)
+		active_ticks += k_uptime_ticks() - power_on_ticks;
+#endif
 	}
 
 	k_mutex_unlock(&cracen_mutex);
 }
 
+#if defined(CONFIG_CRACEN_STATS)
+void cracen_stats_get(struct cracen_stats *stats)
+{
+	uint64_t ticks;
+
+	k_mutex_lock(&cracen_mutex, K_FOREVER);
+
+	ticks = active_ticks;
+	if (users > 0) {
+		ticks += k_uptime_ticks() - power_on_ticks;
+	}
+
+	stats->power_on_count = power_on_count;
+	stats->active_time_us = k_ticks_to_us_floor64(ticks);
+
+	k_mutex_unlock(&cracen_mutex);
+}
+#endif
+
 #define CRACEN_NOT_INITIALIZED 0x207467
 #define CRACEN_INITIALIZED     0x657311
 
@@ -10,13 +10,8 @@
 #include <cracen/statuscodes.h>
 #include <zephyr/kernel.h>
 
-/* We want to avoid reserving excessive RAM and invoking
- * the PRNG too often. 32 was arbitrarily chosen here
- * and can be freely adjusted later when we test this
- * in practice.
- *
- */
-#define PRNG_POOL_SIZE (32)
+/* Trade-off between reserved RAM and how often the PRNG is invoked. */
+#define PRNG_POOL_SIZE CONFIG_CRACEN_PRNG_POOL_SIZE
 
 static uint32_t prng_pool[PRNG_POOL_SIZE];
 static uint32_t prng_pool_remaining;
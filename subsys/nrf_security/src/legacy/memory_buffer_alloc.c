@@ -273,6 +273,27 @@ static void *buffer_alloc_calloc( size_t n, size_t size )
 
     // Find block that fits
     //
+#if defined(CONFIG_MBEDTLS_MEMORY_BUFFER_ALLOC_BEST_FIT)
+    // Use the smallest block that fits to limit fragmentation
+    {
+        memory_header *best = NULL;
+
+        while( cur != NULL )
+        {
+            if( cur->size >= len &&
+                ( best == NULL || cur->size < best->size ) )
+            {
+                best = cur;
+                if( cur->size == len )
+                    break;
+            }
+
+            cur = cur->next_free;
+        }
+
+        cur = best;
+    }
+#else
     while( cur != NULL )
     {
         if( cur->size >= len )
@@ -280,6 +301,7 @@ static void *buffer_alloc_calloc( size_t n, size_t size )
 
         cur = cur->next_free;
     }
+#endif
 
     if( cur == NULL )
         return( NULL );
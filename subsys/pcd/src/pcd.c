@@ -25,6 +25,9 @@ LOG_MODULE_REGISTER(pcd, CONFIG_PCD_LOG_LEVEL);
 /** Magic value written to indicate that a version number read should take place. */
 #define PCD_CMD_MAGIC_READ_VERSION 0xdca345ea
 
+/** Number of bytes copied between two updates of the progress. */
+#define PCD_PROGRESS_CHUNK_SIZE 4096
+
 #ifdef CONFIG_PCD_APP
 
 #include <hal/nrf_reset.h>
@@ -52,6 +55,7 @@ struct pcd_cmd {
 	const void *data;     /* Data to copy*/
 	size_t len;           /* Number of bytes to copy */
 	off_t offset;         /* Offset to store the flash image in */
+	size_t progress;      /* Number of bytes copied so far */
 } __aligned(4);
 
 static struct pcd_cmd *cmd = (struct pcd_cmd *)PCD_CMD_ADDRESS;
@@ -79,6 +83,11 @@ const void *pcd_cmd_data_ptr_get(void)
 	return cmd->data;
 }
 
+size_t pcd_fw_copy_progress_get(void)
+{
+	return cmd->progress;
+}
+
 #ifdef CONFIG_PCD_NET
 #ifdef CONFIG_PCD_READ_NETCORE_APP_VERSION
 int pcd_find_fw_version(void)
@@ -105,6 +114,8 @@ int pcd_fw_copy(const struct device *fdev)
 {
 	struct stream_flash_ctx stream;
 	uint8_t buf[CONFIG_PCD_BUF_SIZE];
+	const uint8_t *data = cmd->data;
+	size_t remaining = cmd->len;
 	int rc;
 
 	if (cmd->magic != PCD_CMD_MAGIC_COPY) {
@@ -118,11 +129,21 @@ int pcd_fw_copy(const struct device *fdev)
 		return rc;
 	}
 
-	rc = stream_flash_buffered_write(&stream, (uint8_t *)cmd->data,
-					 cmd->len, true);
-	if (rc != 0) {
-		LOG_ERR("stream_flash_buffered_write fail: %d", rc);
-		return rc;
+	cmd->progress = 0;
+
+	/* Written in chunks, so that the application core can follow the progress */
+	while (remaining > 0) {
+		size_t chunk = MIN(remaining, PCD_PROGRESS_CHUNK_SIZE);
+
+		rc = stream_flash_buffered_write(&stream, data, chunk, chunk == remaining);
+		if (rc != 0) {
+			LOG_ERR("stream_flash_buffered_write fail: %d", rc);
+			return rc;
+		}
+
+		data += chunk;
+		remaining -= chunk;
+		cmd->progress = stream_flash_bytes_written(&stream);
 	}
 
 	LOG_INF("Transfer done");
@@ -178,6 +199,7 @@ static int pcd_cmd_write(uint32_t command, const void *data, size_t len, off_t o
 	cmd->data = data;
 	cmd->len = len;
 	cmd->offset = offset;
+	cmd->progress = 0;
 
 	return 0;
 }
@@ -212,6 +234,11 @@ static int network_core_pcd_cmdset(uint32_t cmd, const void *src_addr, size_t le
 		k_busy_wait(1 * USEC_PER_SEC);
 
 		command_status = pcd_fw_copy_status_get();
+
+		if (command_status == PCD_STATUS_COPY) {
+			LOG_INF("Network core update: %zu/%zu bytes", pcd_fw_copy_progress_get(),
+				len);
+		}
 	} while (command_status == initial_command_status);
 
 	if (command_status == PCD_STATUS_FAILED) {
@@ -47,6 +47,39 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+#if defined(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SKIP_UNCHANGED)
+/* Check whether the stored object already holds the given data with the given flags.
+ * object_data is used as work buffer.
+ */
+static bool object_unchanged(const psa_storage_uid_t uid, const char *prefix,
+			     const uint8_t *key_buf, size_t data_length, const void *p_data,
+			     psa_storage_create_flags_t create_flags, stored_object *object_data)
+{
+	psa_status_t status;
+	size_t out_length;
+
+	status = storage_get_object(uid, prefix, (void *)object_data, sizeof(*object_data),
+				    &out_length);
+	if (status != PSA_SUCCESS || out_length < offsetof(stored_object, data)) {
+		return false;
+	}
+
+	if (object_data->header.create_flags != create_flags ||
+	    object_data->header.data_size != data_length) {
+		return false;
+	}
+
+	status = trusted_storage_aead_decrypt(
+		key_buf, AEAD_KEY_SIZE, object_data->nonce, AEAD_NONCE_SIZE,
+		(void *)&object_data->header, sizeof(object_data->header), object_data->data,
+		out_length - offsetof(stored_object, data), object_data->data,
+		STORAGE_MAX_ASSET_SIZE, &out_length);
+
+	return status == PSA_SUCCESS && out_length == data_length &&
+	       (data_length == 0 || memcmp(object_data->data, p_data, data_length) == 0);
+}
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SKIP_UNCHANGED */
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
@@ -178,6 +211,16 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto cleanup_objects;
 	}
 
+#if defined(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SKIP_UNCHANGED)
+	/* Avoid an encryption and a flash write when the data is already stored */
+	if (object_unchanged(uid, prefix, key_buf, data_length, p_data, create_flags,
+			     &object_data)) {
+		LOG_DBG("trusted_set unchanged object, not written");
+		mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+		goto cleanup;
+	}
+#endif
+
 	/* Get new nonce at each set */
 	status = trusted_storage_get_nonce(object_data.nonce, AEAD_NONCE_SIZE);
 	if (status != PSA_SUCCESS) {
@@ -9,8 +9,8 @@
 
 #include <zephyr/kernel.h>
 
-#ifdef CONFIG_ZIGBEE_FOTA_DATA_BLOCK_SIZE
-#define DFU_MULTI_TARGET_BUFFER_SIZE CONFIG_ZIGBEE_FOTA_DATA_BLOCK_SIZE
+#ifdef CONFIG_ZIGBEE_FOTA_FLASH_BUF_SIZE
+#define DFU_MULTI_TARGET_BUFFER_SIZE CONFIG_ZIGBEE_FOTA_FLASH_BUF_SIZE
 #endif
 
 /**@brief Return the 32-bit incremental identifier of the currently running images. */
@@ -70,11 +70,36 @@ static int scenes_table_set(const char *name, size_t len, settings_read_cb read_
 	return -ENOENT;
 }
 
-static void scenes_table_save(void)
+static bool store_pending;
+
+static void scenes_table_store(zb_uint8_t param)
 {
+	ZVUNUSED(param);
+
+	store_pending = false;
 	settings_save_one("scenes/scenes_table", scenes_table, sizeof(scenes_table));
 }
 
+static void scenes_table_save(void)
+{
+#if CONFIG_ZIGBEE_SCENES_SAVE_DELAY_MS > 0
+	/* Changes made while a store is pending are written together with it. */
+	if (store_pending) {
+		return;
+	}
+
+	if (ZB_SCHEDULE_APP_ALARM(scenes_table_store, 0,
+				  ZB_MILLISECONDS_TO_BEACON_INTERVAL(
+					  CONFIG_ZIGBEE_SCENES_SAVE_DELAY_MS)) == RET_OK) {
+		store_pending = true;
+		return;
+	}
+
+	LOG_WRN("Unable to defer the scene table store");
+#endif
+	scenes_table_store(0);
+}
+
 struct settings_handler scenes_conf = {
 	.name = "scenes",
 	.h_set = scenes_table_set
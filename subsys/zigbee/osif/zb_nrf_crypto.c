@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/random/random.h>
 #include <zboss_api.h>
@@ -26,17 +27,49 @@
 #if CONFIG_CRYPTO_NRF_ECB
 static const struct device *dev;
 
-static void encrypt_aes(zb_uint8_t *key, zb_uint8_t *msg, zb_uint8_t *c)
+/* CCM* in the ZBOSS stack encrypts many blocks in a row with the same key, so the cipher
+ * session is kept open and is only set up again when the key changes.
+ */
+static struct cipher_ctx ctx;
+static zb_uint8_t session_key[ECB_AES_KEY_SIZE];
+static bool session_open;
+
+static int session_get(const zb_uint8_t *key)
 {
 	int err;
 
-	__ASSERT(dev, "encryption call too early");
+	if (session_open) {
+		if (memcmp(session_key, key, ECB_AES_KEY_SIZE) == 0) {
+			return 0;
+		}
 
-	struct cipher_ctx ctx = {
+		cipher_free_session(dev, &ctx);
+		session_open = false;
+	}
+
+	memcpy(session_key, key, ECB_AES_KEY_SIZE);
+	ctx = (struct cipher_ctx) {
 		.keylen = ECB_AES_KEY_SIZE,
-		.key.bit_stream = key,
+		.key.bit_stream = session_key,
 		.flags = CAP_RAW_KEY | CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS,
 	};
+
+	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_ECB,
+				   CRYPTO_CIPHER_OP_ENCRYPT);
+	if (!err) {
+		session_open = true;
+	}
+
+	return err;
+}
+
+static void encrypt_aes(zb_uint8_t *key, zb_uint8_t *msg, zb_uint8_t *c)
+{
+	int err;
+
+	__ASSERT(dev, "encryption call too early");
+
 	struct cipher_pkt encryption = {
 		.in_buf = msg,
 		.in_len = ECB_AES_BLOCK_SIZE,
@@ -44,20 +77,15 @@ static void encrypt_aes(zb_uint8_t *key, zb_uint8_t *msg, zb_uint8_t *c)
 		.out_buf = c,
 	};
 
-	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
-				   CRYPTO_CIPHER_MODE_ECB,
-				   CRYPTO_CIPHER_OP_ENCRYPT);
+	err = session_get(key);
 	__ASSERT(!err, "Session init failed");
 
 	if (err) {
-		goto out;
+		return;
 	}
 
 	err = cipher_block_op(&ctx, &encryption);
 	__ASSERT(!err, "Encryption failed");
-
-out:
-	cipher_free_session(dev, &ctx);
 }
 #elif CONFIG_BT_CTLR
 static void encrypt_aes(zb_uint8_t *key, zb_uint8_t *msg, zb_uint8_t *c)
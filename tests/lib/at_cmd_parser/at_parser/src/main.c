@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include <modem/at_parser.h>
+
+#define PARSER_THREADS		2
+#define PARSER_ROUNDS		100
+#define PARSER_STACK_SIZE	1024
+#define PARSER_THREAD_PRIORITY	5
+
+static const char cereg[] = "+CEREG: 2,\"76C1\",\"0102DA04\", 7\r\nOK\r\n";
+static const char cgeqosrdp[] = "+CGEQOSRDP: 0,0,,\r\n"
+				"+CGEQOSRDP: 1,2,,\r\n"
+				"+CGEQOSRDP: 2,4,,,1,65280000\r\nOK\r\n";
+static const char cmt[] = "\r\n+CMT: \"12345678\", 24\r\n"
+			  "06917429000171040A91747966543100009160402143708006C8329BFD0601\r\n"
+			  "\r\nOK\r\n";
+
+K_THREAD_STACK_ARRAY_DEFINE(parser_stacks, PARSER_THREADS, PARSER_STACK_SIZE);
+static struct k_thread parser_threads[PARSER_THREADS];
+static int parser_errors[PARSER_THREADS];
+
+ZTEST(at_parser, test_notification)
+{
+	int ret;
+	struct at_parser parser;
+	size_t count;
+	int32_t val;
+	const char *str;
+	size_t len;
+	char buf[8];
+
+	ret = at_parser_init(&parser, cereg);
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 5, "Unexpected parameter count: %d", count);
+
+	ret = at_parser_string_ptr_get(&parser, 0, &str, &len);
+	zassert_equal(ret, 0, "at_parser_string_ptr_get failed: %d", ret);
+	zassert_equal(len, strlen("+CEREG"), "Unexpected length: %d", len);
+	zassert_mem_equal(str, "+CEREG", len, "Unexpected notification ID");
+
+	ret = at_parser_int_get(&parser, 1, &val);
+	zassert_equal(ret, 0, "at_parser_int_get failed: %d", ret);
+	zassert_equal(val, 2, "Unexpected value: %d", val);
+
+	/* Strings point into the AT string, without the quotes */
+	ret = at_parser_string_ptr_get(&parser, 2, &str, &len);
+	zassert_equal(ret, 0, "at_parser_string_ptr_get failed: %d", ret);
+	zassert_equal(str, &cereg[11], "String does not point into the AT string");
+	zassert_equal(len, 4, "Unexpected length: %d", len);
+
+	len = sizeof(buf);
+	ret = at_parser_string_get(&parser, 3, buf, &len);
+	zassert_equal(ret, 0, "at_parser_string_get failed: %d", ret);
+	zassert_mem_equal(buf, "0102DA04", len, "Unexpected string");
+
+	ret = at_parser_int_get(&parser, 4, &val);
+	zassert_equal(ret, 0, "at_parser_int_get failed: %d", ret);
+	zassert_equal(val, 7, "Unexpected value: %d", val);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_equal(ret, -ENODATA, "Final result code should end the string: %d", ret);
+}
+
+ZTEST(at_parser, test_multiple_notifications)
+{
+	int ret;
+	struct at_parser parser;
+	size_t count;
+	uint32_t val;
+	int lines = 1;
+
+	ret = at_parser_init(&parser, cgeqosrdp);
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 5, "Unexpected parameter count: %d", count);
+	zassert_equal(at_parser_type_get(&parser, 3), AT_PARAM_TYPE_EMPTY,
+		      "Parameter 3 should be empty");
+	zassert_equal(at_parser_type_get(&parser, 4), AT_PARAM_TYPE_EMPTY,
+		      "Trailing parameter should be empty");
+
+	while (at_parser_cmd_next(&parser) == 0) {
+		lines++;
+	}
+	zassert_equal(lines, 3, "Unexpected number of lines: %d", lines);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 7, "Unexpected parameter count: %d", count);
+
+	ret = at_parser_unsigned_int_get(&parser, 6, &val);
+	zassert_equal(ret, 0, "at_parser_unsigned_int_get failed: %d", ret);
+	zassert_equal(val, 65280000, "Unexpected value: %d", val);
+}
+
+ZTEST(at_parser, test_pdu)
+{
+	int ret;
+	struct at_parser parser;
+	size_t count;
+	const char *str;
+	size_t len;
+
+	ret = at_parser_init(&parser, cmt);
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 4, "Unexpected parameter count: %d", count);
+
+	ret = at_parser_string_ptr_get(&parser, 3, &str, &len);
+	zassert_equal(ret, 0, "at_parser_string_ptr_get failed: %d", ret);
+	zassert_equal(len, 62, "Unexpected PDU length: %d", len);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_equal(ret, -ENODATA, "Final result code should end the string: %d", ret);
+}
+
+ZTEST(at_parser, test_command)
+{
+	int ret;
+	struct at_parser parser;
+	size_t count;
+	uint16_t val;
+	const char *str;
+	size_t len;
+
+	ret = at_parser_init(&parser, "AT%XSYSTEMMODE=1,0,1,0");
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 5, "Unexpected parameter count: %d", count);
+
+	ret = at_parser_string_ptr_get(&parser, 0, &str, &len);
+	zassert_equal(ret, 0, "at_parser_string_ptr_get failed: %d", ret);
+	zassert_mem_equal(str, "AT%XSYSTEMMODE", len, "Unexpected command");
+
+	ret = at_parser_unsigned_short_get(&parser, 3, &val);
+	zassert_equal(ret, 0, "at_parser_unsigned_short_get failed: %d", ret);
+	zassert_equal(val, 1, "Unexpected value: %d", val);
+
+	ret = at_parser_init(&parser, "AT+CFUN=?");
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_equal(ret, 0, "at_parser_cmd_count_get failed: %d", ret);
+	zassert_equal(count, 1, "Unexpected parameter count: %d", count);
+}
+
+ZTEST(at_parser, test_forced_string)
+{
+	int ret;
+	struct at_parser parser;
+	const char *str;
+	size_t len;
+
+	ret = at_parser_init(&parser, "+CPIN: READY\r\nOK\r\n");
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_string_ptr_get(&parser, 1, &str, &len);
+	zassert_equal(ret, 0, "at_parser_string_ptr_get failed: %d", ret);
+	zassert_equal(len, strlen("READY"), "Unexpected length: %d", len);
+	zassert_mem_equal(str, "READY", len, "Unexpected string");
+}
+
+ZTEST(at_parser, test_array)
+{
+	int ret;
+	struct at_parser parser;
+	uint32_t array[4];
+	size_t len;
+
+	ret = at_parser_init(&parser, "+CFUN: (0,1,4,44)");
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+	zassert_equal(at_parser_type_get(&parser, 1), AT_PARAM_TYPE_ARRAY,
+		      "Parameter 1 should be an array");
+
+	len = sizeof(array);
+	ret = at_parser_array_get(&parser, 1, array, &len);
+	zassert_equal(ret, 0, "at_parser_array_get failed: %d", ret);
+	zassert_equal(len, 4 * sizeof(uint32_t), "Unexpected array size: %d", len);
+	zassert_equal(array[3], 44, "Unexpected element: %d", array[3]);
+
+	len = 3 * sizeof(uint32_t);
+	ret = at_parser_array_get(&parser, 1, array, &len);
+	zassert_equal(ret, -ENOMEM, "Too small buffer should fail: %d", ret);
+}
+
+ZTEST(at_parser, test_range)
+{
+	int ret;
+	struct at_parser parser;
+	int16_t val16;
+	uint32_t valu32;
+	int64_t val64;
+
+	ret = at_parser_init(&parser, "+TEST: 70000,-1,-9223372036854775808,9223372036854775808");
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_short_get(&parser, 1, &val16);
+	zassert_equal(ret, -ERANGE, "Value should not fit in 16 bits: %d", ret);
+
+	ret = at_parser_unsigned_int_get(&parser, 2, &valu32);
+	zassert_equal(ret, -ERANGE, "Negative value should not fit: %d", ret);
+
+	ret = at_parser_int64_get(&parser, 3, &val64);
+	zassert_equal(ret, 0, "at_parser_int64_get failed: %d", ret);
+	zassert_equal(val64, INT64_MIN, "Unexpected value");
+
+	ret = at_parser_int64_get(&parser, 4, &val64);
+	zassert_equal(ret, -ERANGE, "Value should not fit in 64 bits: %d", ret);
+}
+
+ZTEST(at_parser, test_invalid)
+{
+	int ret;
+	struct at_parser parser;
+	int32_t val;
+	char big[128] = "+TEST: ";
+
+	ret = at_parser_init(NULL, cereg);
+	zassert_equal(ret, -EINVAL, "NULL parser should fail: %d", ret);
+
+	ret = at_parser_init(&parser, NULL);
+	zassert_equal(ret, -EINVAL, "NULL string should fail: %d", ret);
+
+	ret = at_parser_init(&parser, "+CEREG: \"76C1\r\n");
+	zassert_equal(ret, -EBADMSG, "Missing quote should fail: %d", ret);
+
+	ret = at_parser_init(&parser, cereg);
+	zassert_equal(ret, 0, "at_parser_init failed: %d", ret);
+
+	ret = at_parser_int_get(&parser, 2, &val);
+	zassert_equal(ret, -EINVAL, "Getting a string as integer should fail: %d", ret);
+
+	ret = at_parser_int_get(&parser, 5, &val);
+	zassert_equal(ret, -EINVAL, "Getting out of range index should fail: %d", ret);
+	zassert_equal(at_parser_type_get(&parser, 5), AT_PARAM_TYPE_INVALID,
+		      "Out of range index should be invalid");
+
+	for (int i = 0; i < CONFIG_AT_PARSER_MAX_PARAMS; i++) {
+		strcat(big, "1,");
+	}
+	strcat(big, "1");
+
+	ret = at_parser_init(&parser, big);
+	zassert_equal(ret, -E2BIG, "Too many parameters should fail: %d", ret);
+}
+
+static void parser_thread(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+	struct at_parser parser;
+	int32_t val;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < PARSER_ROUNDS; i++) {
+		ret = at_parser_init(&parser, idx ? cereg : cgeqosrdp);
+		ret = ret ? ret : at_parser_int_get(&parser, 1, &val);
+		if (ret || (val != (idx ? 2 : 0))) {
+			parser_errors[idx]++;
+		}
+		k_yield();
+	}
+}
+
+ZTEST(at_parser, test_concurrent)
+{
+	for (int i = 0; i < PARSER_THREADS; i++) {
+		k_thread_create(&parser_threads[i], parser_stacks[i],
+				K_THREAD_STACK_SIZEOF(parser_stacks[i]), parser_thread,
+				INT_TO_POINTER(i), NULL, NULL, PARSER_THREAD_PRIORITY, 0,
+				K_NO_WAIT);
+	}
+
+	for (int i = 0; i < PARSER_THREADS; i++) {
+		k_thread_join(&parser_threads[i], K_FOREVER);
+		zassert_equal(parser_errors[i], 0, "Thread %d failed to parse", i);
+	}
+}
+
+ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -115,4 +115,74 @@ ZTEST(suite_contin_array, test_simp_arr_loop_short)
 	}
 }
 
+/* Test that every byte of the continuous array follows the finite array */
+ZTEST(suite_contin_array, test_arr_content)
+{
+	const uint32_t NUM_ITERATIONS = 50;
+	const size_t CONTIN_ARR_SIZE = 97;
+	const size_t const_arr_size = 44;
+	char contin_arr[CONTIN_ARR_SIZE];
+	uint32_t finite_pos = 0;
+	uint32_t expected_pos = 0;
+	int ret;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		ret = contin_array_create(contin_arr, CONTIN_ARR_SIZE, test_arr, const_arr_size,
+					  &finite_pos);
+		zassert_equal(ret, 0, "contin_array_create did not return zero");
+
+		for (int j = 0; j < CONTIN_ARR_SIZE; j++) {
+			zassert_equal(contin_arr[j], test_arr[expected_pos],
+				      "Value at %d is not identical", j);
+			expected_pos = (expected_pos + 1) % const_arr_size;
+		}
+	}
+}
+
+ZTEST(suite_contin_array, test_view)
+{
+	const uint32_t NUM_ITERATIONS = 50;
+	const uint32_t VIEW_SIZE = 97;
+	const size_t const_arr_size = ARRAY_SIZE(test_arr);
+	struct contin_array_span spans[2];
+	uint32_t finite_pos = 0;
+	uint32_t expected_pos = 0;
+	int ret;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		ret = contin_array_view(test_arr, const_arr_size, VIEW_SIZE, &finite_pos, spans);
+		zassert_equal(ret, 0, "contin_array_view did not return zero");
+		zassert_equal(spans[0].size + spans[1].size, VIEW_SIZE, "Size of spans is wrong");
+		zassert_equal_ptr(spans[0].data, &test_arr[expected_pos],
+				  "First span does not start at current position");
+
+		if (spans[1].size) {
+			zassert_equal(expected_pos + spans[0].size, const_arr_size,
+				      "First span does not end at the end of the array");
+			zassert_equal_ptr(spans[1].data, test_arr,
+					  "Second span does not start at the start of the array");
+		}
+
+		expected_pos = (expected_pos + VIEW_SIZE) % const_arr_size;
+		zassert_equal(finite_pos, expected_pos, "Position is wrong");
+	}
+}
+
+ZTEST(suite_contin_array, test_view_invalid)
+{
+	struct contin_array_span spans[2];
+	uint32_t finite_pos = 0;
+	int ret;
+
+	ret = contin_array_view(NULL, ARRAY_SIZE(test_arr), 1, &finite_pos, spans);
+	zassert_equal(ret, -ENXIO, "NULL pointer not detected");
+
+	ret = contin_array_view(test_arr, ARRAY_SIZE(test_arr), 0, &finite_pos, spans);
+	zassert_equal(ret, -EPERM, "Zero size not detected");
+
+	ret = contin_array_view(test_arr, ARRAY_SIZE(test_arr), ARRAY_SIZE(test_arr) + 1,
+				&finite_pos, spans);
+	zassert_equal(ret, -EINVAL, "Too large view not detected");
+}
+
 ZTEST_SUITE(suite_contin_array, NULL, NULL, NULL, NULL, NULL);
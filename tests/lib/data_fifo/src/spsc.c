@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <errno.h>
+#include <string.h>
+#include "data_fifo.h"
+
+#define ELEMENTS_MAX   4
+#define BLOCK_SIZE_MAX 32
+#define PRODUCER_DELAY K_MSEC(20)
+
+#define PRODUCER_STACK_SIZE 1024
+#define PRODUCER_PRIORITY   K_PRIO_PREEMPT(1)
+
+K_THREAD_STACK_DEFINE(producer_stack, PRODUCER_STACK_SIZE);
+static struct k_thread producer_thread;
+
+DATA_FIFO_SPSC_DEFINE(fifo, ELEMENTS_MAX, BLOCK_SIZE_MAX);
+
+static void fifo_setup(void *f)
+{
+	int ret;
+
+	if (!fifo.initialized) {
+		ret = data_fifo_init(&fifo);
+		zassert_equal(ret, 0, "init did not return 0");
+	}
+
+	ret = data_fifo_empty(&fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+}
+
+static void num_used_check(uint32_t num_alloced_tgt, uint32_t num_locked_tgt)
+{
+	uint32_t num_alloced;
+	uint32_t num_locked;
+	int ret;
+
+	ret = data_fifo_num_used_get(&fifo, &num_alloced, &num_locked);
+	zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+	zassert_equal(num_alloced, num_alloced_tgt, "num_alloced target %d actual val %d",
+		      num_alloced_tgt, num_alloced);
+	zassert_equal(num_locked, num_locked_tgt, "num_locked target %d actual val %d",
+		      num_locked_tgt, num_locked);
+}
+
+static void block_put(uint8_t val, size_t size)
+{
+	uint8_t *data_ptr;
+	int ret;
+
+	ret = data_fifo_pointer_first_vacant_get(&fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	memset(data_ptr, val, size);
+
+	ret = data_fifo_block_lock(&fifo, (void **)&data_ptr, size);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+static void block_get_check(uint8_t val, size_t size, k_timeout_t timeout)
+{
+	uint8_t *data_ptr;
+	size_t size_read;
+	int ret;
+
+	ret = data_fifo_pointer_last_filled_get(&fifo, (void **)&data_ptr, &size_read, timeout);
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+	zassert_equal(size_read, size, "Wrong size %d", size_read);
+
+	for (size_t i = 0; i < size; i++) {
+		zassert_equal(data_ptr[i], val, "Wrong data at %d", i);
+	}
+
+	data_fifo_block_free(&fifo, data_ptr);
+}
+
+ZTEST(suite_data_fifo_spsc, test_put_get_wrap)
+{
+	/* Run through the ring several times to cover wrap of the slots */
+	for (uint8_t i = 0; i < ELEMENTS_MAX * 3; i++) {
+		block_put(i, i + 1);
+		num_used_check(1, 1);
+		block_get_check(i, i + 1, K_NO_WAIT);
+		num_used_check(0, 0);
+	}
+}
+
+ZTEST(suite_data_fifo_spsc, test_full_and_empty)
+{
+	uint8_t *data_ptr;
+	size_t size;
+	int ret;
+
+	ret = data_fifo_pointer_last_filled_get(&fifo, (void **)&data_ptr, &size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get on empty FIFO returned %d", ret);
+
+	ret = data_fifo_pointer_last_filled_get(&fifo, (void **)&data_ptr, &size, K_MSEC(5));
+	zassert_equal(ret, -EAGAIN, "last_filled_get timeout returned %d", ret);
+
+	for (uint8_t i = 0; i < ELEMENTS_MAX; i++) {
+		block_put(i, BLOCK_SIZE_MAX);
+	}
+	num_used_check(ELEMENTS_MAX, ELEMENTS_MAX);
+
+	ret = data_fifo_pointer_first_vacant_get(&fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get on full FIFO returned %d", ret);
+
+	for (uint8_t i = 0; i < ELEMENTS_MAX; i++) {
+		block_get_check(i, BLOCK_SIZE_MAX, K_NO_WAIT);
+	}
+	num_used_check(0, 0);
+}
+
+ZTEST(suite_data_fifo_spsc, test_lock_out_of_order)
+{
+	uint8_t *first;
+	uint8_t *second;
+	int ret;
+
+	ret = data_fifo_pointer_first_vacant_get(&fifo, (void **)&first, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	ret = data_fifo_pointer_first_vacant_get(&fifo, (void **)&second, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	num_used_check(2, 0);
+
+	ret = data_fifo_block_lock(&fifo, (void **)&second, 1);
+	zassert_equal(ret, -ESPIPE, "Out of order lock returned %d", ret);
+
+	ret = data_fifo_block_lock(&fifo, (void **)&first, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+	ret = data_fifo_block_lock(&fifo, (void **)&second, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+	num_used_check(2, 2);
+}
+
+static void isr_producer(const void *arg)
+{
+	block_put((uint8_t)(uintptr_t)arg, BLOCK_SIZE_MAX);
+}
+
+static void producer_thread_fn(void *p1, void *p2, void *p3)
+{
+	k_sleep(PRODUCER_DELAY);
+	/* Produce from interrupt context, as the I2S driver does */
+	irq_offload(isr_producer, (const void *)0x5a);
+}
+
+ZTEST(suite_data_fifo_spsc, test_consumer_wakeup_from_isr)
+{
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer_thread_fn, NULL, NULL, NULL, PRODUCER_PRIORITY, 0, K_NO_WAIT);
+
+	block_get_check(0x5a, BLOCK_SIZE_MAX, K_FOREVER);
+	num_used_check(0, 0);
+
+	k_thread_join(&producer_thread, K_FOREVER);
+}
+
+ZTEST_SUITE(suite_data_fifo_spsc, NULL, NULL, fifo_setup, NULL, NULL);
@@ -1805,6 +1805,180 @@ void test_location_request_mode_all_cellular_error_gnss_timeout(void)
 	k_sleep(K_MSEC(1));
 }
 
+/* Test location request with:
+ * - LOCATION_REQ_MODE_RACE for cellular and GNSS positioning
+ * - Cellular location does not meet the accuracy target so GNSS is used
+ */
+void test_location_request_mode_race_cellular_gnss(void)
+{
+#if !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	int err;
+
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_CELLULAR, LOCATION_METHOD_GNSS};
+	/* Unused event data slot for the cellular location that is not sent to the handler */
+	const int cellular_location_index = ARRAY_SIZE(test_location_event_data) - 1;
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_RACE;
+	config.accuracy_target = 100;
+	config.methods[0].cellular.cell_count = 1;
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_FALLBACK;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+	test_location_event_data[cellular_location_index].location.latitude = 61.50375;
+	test_location_event_data[cellular_location_index].location.longitude = 23.896979;
+	test_location_event_data[cellular_location_index].location.accuracy = 750.0;
+
+	test_pvt_data.flags = NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID;
+	test_pvt_data.latitude = 60.987;
+	test_pvt_data.longitude = -45.997;
+	test_pvt_data.accuracy = 15.83;
+	test_pvt_data.datetime.year = 2021;
+	test_pvt_data.datetime.month = 8;
+	test_pvt_data.datetime.day = 2;
+	test_pvt_data.datetime.hour = 12;
+	test_pvt_data.datetime.minute = 34;
+	test_pvt_data.datetime.seconds = 23;
+	test_pvt_data.datetime.ms = 789;
+	test_pvt_data.sv[0].sv = 2;
+	test_pvt_data.sv[0].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[1].sv = 4;
+	test_pvt_data.sv[1].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[2].sv = 6;
+	test_pvt_data.sv[2].flags = 0;
+	test_pvt_data.sv[3].sv = 8;
+	test_pvt_data.sv[3].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[4].sv = 10;
+	test_pvt_data.sv[4].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[5].sv = 12;
+	test_pvt_data.sv[5].flags = 0;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	test_location_event_data[location_cb_expected].location.latitude = 60.987;
+	test_location_event_data[location_cb_expected].location.longitude = -45.997;
+	test_location_event_data[location_cb_expected].location.accuracy = 15.83;
+	test_location_event_data[location_cb_expected].location.datetime.valid = true;
+	test_location_event_data[location_cb_expected].location.datetime.year = 2021;
+	test_location_event_data[location_cb_expected].location.datetime.month = 8;
+	test_location_event_data[location_cb_expected].location.datetime.day = 2;
+	test_location_event_data[location_cb_expected].location.datetime.hour = 12;
+	test_location_event_data[location_cb_expected].location.datetime.minute = 34;
+	test_location_event_data[location_cb_expected].location.datetime.second = 23;
+	test_location_event_data[location_cb_expected].location.datetime.ms = 789;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_tracked = 6;
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_used = 4;
+	test_location_event_data[location_cb_expected].location.details.gnss.elapsed_time_gnss = 50;
+	test_location_event_data[location_cb_expected].location.details.gnss.pvt_data =
+		test_pvt_data;
+#endif
+	location_cb_expected++;
+
+	/* Deregister 2nd event handler used in previous tests.
+	 * Ignoring return value as in some configurations it hasn't been registered
+	 */
+	(void)location_handler_deregister(location_event_handler_2);
+
+	/***** First cellular positioning *****/
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT+CGACT?", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)cgact_resp_active, sizeof(cgact_resp_active));
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+	cellular_rest_req_resp_handle(cellular_location_index);
+
+	/* Select cellular service to be used */
+	rest_req_ctx.url = "here.api"; /* Needs a fix once rest_req_ctx is verified */
+	rest_req_ctx.sec_tag = CONFIG_LOCATION_SERVICE_HERE_TLS_SEC_TAG;
+	rest_req_ctx.port = HTTPS_PORT;
+	rest_req_ctx.host = CONFIG_LOCATION_SERVICE_HERE_HOSTNAME;
+
+	/***** Then GNSS positioning, because cellular accuracy is 750 m *****/
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+
+#if defined(CONFIG_LOCATION_TEST_AGNSS)
+	struct nrf_modem_gnss_agnss_expiry agnss_expiry = {
+		.data_flags = 0,
+		.utc_expiry = 0xffff,
+		.klob_expiry = 0xffff,
+		.neq_expiry = 0xffff,
+		.integrity_expiry = 0xffff,
+		.position_expiry = 0xffff };
+
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ExpectAndReturn(NULL, 0);
+	__cmock_nrf_modem_gnss_agnss_expiry_get_IgnoreArg_agnss_expiry();
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ReturnMemThruPtr_agnss_expiry(
+		&agnss_expiry, sizeof(agnss_expiry));
+#endif
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	/* TODO: Cannot determine the used system mode but it's set as zero by default in lte_lc */
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+
+#if !defined(CONFIG_LOCATION_TEST_AGNSS)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+#endif
+
+	/* Wait a bit so that NCELLMEAS is sent before we send response */
+	k_sleep(K_MSEC(1));
+
+	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	at_monitor_dispatch(ncellmeas_resp_pci1);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_FALLBACK */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#else
+	k_sleep(K_MSEC(10));
+#endif
+
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	__cmock_nrf_modem_gnss_read_ExpectAndReturn(
+		NULL, sizeof(test_pvt_data), NRF_MODEM_GNSS_DATA_PVT, 0);
+	__cmock_nrf_modem_gnss_read_IgnoreArg_buf();
+	__cmock_nrf_modem_gnss_read_ReturnMemThruPtr_buf(&test_pvt_data, sizeof(test_pvt_data));
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	method_gnss_event_handler(NRF_MODEM_GNSS_EVT_PVT);
+	k_sleep(K_MSEC(1));
+#endif
+}
+
 /********* TESTS PERIODIC POSITIONING REQUESTS ***********************/
 
 /* Test periodic location request and cancel it once some iterations are done. */
@@ -1182,6 +1182,55 @@ void test_lte_lc_neighbor_cell_measurement_neighbors(void)
 	at_monitor_dispatch(at_notif);
 }
 
+void test_lte_lc_neighbor_cell_measurement_last_get(void)
+{
+	int ret;
+	int64_t age_ms;
+	struct lte_lc_ncell ncells[2];
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+	};
+
+	ret = lte_lc_neighbor_cell_measurement_last_get(NULL, 0, 0, NULL);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	/* Result of the measurement in test_lte_lc_neighbor_cell_measurement_neighbors() */
+	ret = lte_lc_neighbor_cell_measurement_last_get(&cells, ARRAY_SIZE(ncells), 0, &age_ms);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(0x00112233, cells.current_cell.id);
+	TEST_ASSERT_EQUAL(987, cells.current_cell.mcc);
+	TEST_ASSERT_EQUAL(2, cells.ncells_count);
+	TEST_ASSERT_EQUAL(8, ncells[0].earfcn);
+	TEST_ASSERT_EQUAL(99, ncells[1].phys_cell_id);
+	TEST_ASSERT_EQUAL(0, cells.gci_cells_count);
+	TEST_ASSERT_TRUE(age_ms >= 0);
+
+	/* Neighbor cells that do not fit are left out */
+	ret = lte_lc_neighbor_cell_measurement_last_get(&cells, 1, 0, NULL);
+	TEST_ASSERT_EQUAL(-E2BIG, ret);
+	TEST_ASSERT_EQUAL(1, cells.ncells_count);
+
+	/* A failed measurement invalidates the result */
+	strcpy(at_notif, "%NCELLMEAS:1\r\n");
+
+	lte_lc_callback_count_expected = 1;
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS", EXIT_SUCCESS);
+
+	ret = lte_lc_neighbor_cell_measurement(NULL);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	test_event_data[0].type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
+	test_event_data[0].cells_info.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	test_event_data[0].cells_info.ncells_count = 0;
+
+	at_monitor_dispatch(at_notif);
+	(void)k_sem_take(&event_handler_called_sem, K_SECONDS(1));
+
+	ret = lte_lc_neighbor_cell_measurement_last_get(&cells, ARRAY_SIZE(ncells), 0, NULL);
+	TEST_ASSERT_EQUAL(-ENODATA, ret);
+}
+
 void test_lte_lc_neighbor_cell_measurement_gci(void)
 {
 	int ret;
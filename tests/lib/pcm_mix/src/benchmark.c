@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+#include "pcm_mix.h"
+
+/* 10 ms frame of 48 kHz audio */
+#define FRAME_SAMPLES_MONO 480
+#define FRAME_SAMPLES_STEREO (FRAME_SAMPLES_MONO * 2)
+#define BENCHMARK_ROUNDS 16
+
+static int16_t frame_a[FRAME_SAMPLES_STEREO];
+static int16_t frame_a_ref[FRAME_SAMPLES_STEREO];
+static int16_t frame_b[FRAME_SAMPLES_STEREO];
+
+/* Scalar reference of the mixer, sample by sample */
+static void ref_mix(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b,
+		    enum pcm_mix_mode mix_mode)
+{
+	for (size_t i = 0; i < samples_b; i++) {
+		switch (mix_mode) {
+		case B_STEREO_INTO_A_STEREO:
+		case B_MONO_INTO_A_MONO:
+			pcm_a[i] = CLAMP(pcm_a[i] + pcm_b[i], INT16_MIN, INT16_MAX);
+			break;
+		case B_MONO_INTO_A_STEREO_LR:
+			pcm_a[i * 2] = CLAMP(pcm_a[i * 2] + pcm_b[i], INT16_MIN, INT16_MAX);
+			pcm_a[i * 2 + 1] = CLAMP(pcm_a[i * 2 + 1] + pcm_b[i], INT16_MIN, INT16_MAX);
+			break;
+		case B_MONO_INTO_A_STEREO_L:
+			pcm_a[i * 2] = CLAMP(pcm_a[i * 2] + pcm_b[i], INT16_MIN, INT16_MAX);
+			break;
+		case B_MONO_INTO_A_STEREO_R:
+			pcm_a[i * 2 + 1] = CLAMP(pcm_a[i * 2 + 1] + pcm_b[i], INT16_MIN, INT16_MAX);
+			break;
+		}
+	}
+}
+
+static void frames_fill(void)
+{
+	sys_rand_get(frame_a, sizeof(frame_a));
+	sys_rand_get(frame_b, sizeof(frame_b));
+	memcpy(frame_a_ref, frame_a, sizeof(frame_a));
+}
+
+static void benchmark_mode(enum pcm_mix_mode mix_mode, size_t samples_b, const char *name)
+{
+	uint32_t cycles = 0;
+	uint32_t cycles_ref = 0;
+
+	for (int i = 0; i < BENCHMARK_ROUNDS; i++) {
+		frames_fill();
+
+		uint32_t start = k_cycle_get_32();
+		int ret = pcm_mix(frame_a, sizeof(frame_a), frame_b, samples_b * sizeof(int16_t),
+				  mix_mode);
+
+		cycles += k_cycle_get_32() - start;
+		zassert_equal(ret, 0, "Mix failed");
+
+		start = k_cycle_get_32();
+		ref_mix(frame_a_ref, frame_b, samples_b, mix_mode);
+		cycles_ref += k_cycle_get_32() - start;
+
+		zassert_mem_equal(frame_a, frame_a_ref, sizeof(frame_a), "Mismatch in %s", name);
+	}
+
+	TC_PRINT("%s: %u cycles per frame (scalar reference: %u)\n", name,
+		 cycles / BENCHMARK_ROUNDS, cycles_ref / BENCHMARK_ROUNDS);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_benchmark_16_bit)
+{
+	benchmark_mode(B_STEREO_INTO_A_STEREO, FRAME_SAMPLES_STEREO, "stereo into stereo");
+	benchmark_mode(B_MONO_INTO_A_STEREO_LR, FRAME_SAMPLES_MONO, "mono into stereo LR");
+	benchmark_mode(B_MONO_INTO_A_STEREO_L, FRAME_SAMPLES_MONO, "mono into stereo L");
+	benchmark_mode(B_MONO_INTO_A_STEREO_R, FRAME_SAMPLES_MONO, "mono into stereo R");
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -127,4 +127,75 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_odd_length_stereo)
+{
+	int ret;
+	int16_t sample_a[] = { 1, INT16_MAX, INT16_MIN, 3, 4 };
+	int16_t sample_b[] = { 1, 1, -1, 3, -5 };
+	int16_t sample_r[] = { 2, INT16_MAX, INT16_MIN, 6, -1 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_STEREO_INTO_A_STEREO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_lr_high_values)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, INT16_MIN, 0, 0 };
+	int16_t sample_b[] = { 10, INT16_MIN };
+	int16_t sample_r[] = { INT16_MAX, INT16_MIN + 10, INT16_MIN, INT16_MIN };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_32_bit)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, 100, 100 };
+	int32_t sample_b[] = { 1, -1 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN + 1, 99, 99 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_STEREO_LR, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_24_bit)
+{
+	int ret;
+	/* Packed little-endian samples: INT24_MAX, INT24_MIN, 1 */
+	uint8_t sample_a[] = { 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00 };
+	/* 1, -1, -2 */
+	uint8_t sample_b[] = { 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF };
+	/* INT24_MAX, INT24_MIN, -1 */
+	uint8_t sample_r[] = { 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_MONO, 24);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_illegal_bit_depth)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a),
+				B_MONO_INTO_A_MONO, 8);
+	ZEQ(ret, -EINVAL);
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <sample_rate_converter.h>
+#include <stdlib.h>
+
+#define FRAMES_44_1KHZ 441
+#define FRAMES_48KHZ   480
+#define STEREO	       2
+
+/* Frames to skip at the start of a stream before the filter history is filled */
+#define SETTLE_FRAMES SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS
+
+/* Allowed deviation from the expected output caused by filter ripple and rounding */
+#define DC_TOLERANCE 64
+
+/* Scaled sample rates giving a conversion ratio 0.1 % above unity, as for drift compensation */
+#define DRIFT_RATE_NOMINAL 1000000
+#define DRIFT_RATE_FAST	   1001000
+#define DRIFT_BLOCKS	   10
+
+static struct sample_rate_converter_polyphase_ctx poly_ctx;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static int16_t buf[FRAMES_48KHZ * STEREO];
+/* Room for the extra frames produced when the ratio is above unity */
+static int16_t drift_buf[(FRAMES_48KHZ + 4) * STEREO];
+
+static void fill_dc_stereo(size_t frames, int16_t left, int16_t right)
+{
+	for (size_t i = 0; i < frames; i++) {
+		buf[i * STEREO] = left;
+		buf[i * STEREO + 1] = right;
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_upsample_44_1khz_frame_count)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	/* A 10 ms block always gives exactly one 10 ms block at the new rate */
+	for (int i = 0; i < 4; i++) {
+		fill_dc_stereo(FRAMES_44_1KHZ, 0, 0);
+		ret = sample_rate_converter_polyphase_process(
+			&poly_ctx, buf, FRAMES_44_1KHZ * STEREO * sizeof(int16_t), buf, sizeof(buf),
+			&output_written);
+		zassert_equal(ret, 0, "Process failed");
+		zassert_equal(output_written, FRAMES_48KHZ * STEREO * sizeof(int16_t),
+			      "Output size was not as expected (%d)", output_written);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_downsample_48khz_frame_count)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 48000, 44100, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	for (int i = 0; i < 4; i++) {
+		fill_dc_stereo(FRAMES_48KHZ, 0, 0);
+		ret = sample_rate_converter_polyphase_process(
+			&poly_ctx, buf, FRAMES_48KHZ * STEREO * sizeof(int16_t), buf, sizeof(buf),
+			&output_written);
+		zassert_equal(ret, 0, "Process failed");
+		zassert_equal(output_written, FRAMES_44_1KHZ * STEREO * sizeof(int16_t),
+			      "Output size was not as expected (%d)", output_written);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_in_place_dc_channels_independent)
+{
+	int ret;
+	size_t output_written;
+	const int16_t left = 10000;
+	const int16_t right = -20000;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	for (int i = 0; i < 2; i++) {
+		fill_dc_stereo(FRAMES_44_1KHZ, left, right);
+		ret = sample_rate_converter_polyphase_process(
+			&poly_ctx, buf, FRAMES_44_1KHZ * STEREO * sizeof(int16_t), buf, sizeof(buf),
+			&output_written);
+		zassert_equal(ret, 0, "Process failed");
+	}
+
+	/* Second block has a filled history, so the output must follow the input */
+	for (size_t i = 0; i < output_written / (STEREO * sizeof(int16_t)); i++) {
+		zassert_within(buf[i * STEREO], left, DC_TOLERANCE,
+			       "Left sample %d not as expected (%d)", i, buf[i * STEREO]);
+		zassert_within(buf[i * STEREO + 1], right, DC_TOLERANCE,
+			       "Right sample %d not as expected (%d)", i, buf[i * STEREO + 1]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_downsample_dc_mono)
+{
+	int ret;
+	size_t output_written;
+	const int16_t level = 16000;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 48000, 44100, 1);
+	zassert_equal(ret, 0, "Open failed");
+
+	for (size_t i = 0; i < FRAMES_48KHZ; i++) {
+		buf[i] = level;
+	}
+
+	ret = sample_rate_converter_polyphase_process(&poly_ctx, buf,
+						      FRAMES_48KHZ * sizeof(int16_t), buf,
+						      sizeof(buf), &output_written);
+	zassert_equal(ret, 0, "Process failed");
+	zassert_equal(output_written, FRAMES_44_1KHZ * sizeof(int16_t),
+		      "Output size was not as expected (%d)", output_written);
+
+	for (size_t i = SETTLE_FRAMES; i < FRAMES_44_1KHZ; i++) {
+		zassert_within(buf[i], level, DC_TOLERANCE, "Sample %d not as expected (%d)", i,
+			       buf[i]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_ratio_set_drift_frame_count)
+{
+	int ret;
+	size_t output_written;
+	size_t frames_total = 0;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, DRIFT_RATE_NOMINAL,
+						   DRIFT_RATE_NOMINAL, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	/* A unity ratio gives as many frames out as in */
+	for (int i = 0; i < DRIFT_BLOCKS; i++) {
+		fill_dc_stereo(FRAMES_48KHZ, 0, 0);
+		ret = sample_rate_converter_polyphase_process(
+			&poly_ctx, buf, FRAMES_48KHZ * STEREO * sizeof(int16_t), drift_buf,
+			sizeof(drift_buf), &output_written);
+		zassert_equal(ret, 0, "Process failed");
+		zassert_equal(output_written, FRAMES_48KHZ * STEREO * sizeof(int16_t),
+			      "Output size was not as expected (%d)", output_written);
+	}
+
+	ret = sample_rate_converter_polyphase_ratio_set(&poly_ctx, DRIFT_RATE_NOMINAL,
+							DRIFT_RATE_FAST);
+	zassert_equal(ret, 0, "Ratio set failed");
+
+	for (int i = 0; i < DRIFT_BLOCKS; i++) {
+		fill_dc_stereo(FRAMES_48KHZ, 0, 0);
+		ret = sample_rate_converter_polyphase_process(
+			&poly_ctx, buf, FRAMES_48KHZ * STEREO * sizeof(int16_t), drift_buf,
+			sizeof(drift_buf), &output_written);
+		zassert_equal(ret, 0, "Process failed");
+		frames_total += output_written / (STEREO * sizeof(int16_t));
+	}
+
+	/* 0.1 % more frames, within one frame of rounding */
+	zassert_within(frames_total, FRAMES_48KHZ * DRIFT_BLOCKS * 1001 / 1000, 1,
+		       "Number of output frames was not as expected (%d)", frames_total);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_output_buf_too_small)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	ret = sample_rate_converter_polyphase_process(
+		&poly_ctx, buf, FRAMES_44_1KHZ * STEREO * sizeof(int16_t), buf,
+		FRAMES_44_1KHZ * STEREO * sizeof(int16_t), &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail on too small output buffer");
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_input_not_frame_multiple)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	ret = sample_rate_converter_polyphase_process(&poly_ctx, buf, 3 * sizeof(int16_t), buf,
+						      sizeof(buf), &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail on partial frame");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_open)
+{
+	int ret;
+
+	ret = sample_rate_converter_polyphase_open(NULL, 44100, 48000, STEREO);
+	zassert_equal(ret, -EINVAL, "Open did not fail on NULL context");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 24000, STEREO);
+	zassert_equal(ret, -EINVAL, "Open did not fail on unsupported sample rates");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, 0);
+	zassert_equal(ret, -EINVAL, "Open did not fail on zero channels");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000,
+						   CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail on too many channels");
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_ratio_set)
+{
+	int ret;
+
+	memset(&poly_ctx, 0, sizeof(poly_ctx));
+
+	ret = sample_rate_converter_polyphase_ratio_set(&poly_ctx, 48000, 48000);
+	zassert_equal(ret, -EINVAL, "Ratio set did not fail on context not opened");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 48000, 48000, STEREO);
+	zassert_equal(ret, 0, "Open failed");
+
+	ret = sample_rate_converter_polyphase_ratio_set(NULL, 48000, 48000);
+	zassert_equal(ret, -EINVAL, "Ratio set did not fail on NULL context");
+
+	ret = sample_rate_converter_polyphase_ratio_set(&poly_ctx, 48000, 0);
+	zassert_equal(ret, -EINVAL, "Ratio set did not fail on zero sample rate");
+
+	ret = sample_rate_converter_polyphase_ratio_set(&poly_ctx, 48000, 16000);
+	zassert_equal(ret, -EINVAL, "Ratio set did not fail on unsupported ratio");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_polyphase, NULL, NULL, NULL, NULL, NULL);
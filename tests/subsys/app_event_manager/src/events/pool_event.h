@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _POOL_EVENT_H_
+#define _POOL_EVENT_H_
+
+/**
+ * @brief Pool Event
+ * @defgroup pool_event Pool Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of events in the pool event memory pool. */
+#define POOL_EVENT_POOL_SIZE 4
+
+struct pool_event {
+	struct app_event_header header;
+
+	uint8_t val;
+};
+
+APP_EVENT_TYPE_DECLARE(pool_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _POOL_EVENT_H_ */
@@ -29,6 +29,10 @@ enum test_id {
 	TEST_OOM,
 	TEST_MULTICONTEXT,
 	TEST_NAME_STYLE_SORTING,
+	TEST_POOL,
+	TEST_PRIORITY,
+	TEST_TYPED_HANDLER,
+	TEST_THROUGHPUT,
 
 	TEST_CNT
 };
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _TYPED_EVENT_H_
+#define _TYPED_EVENT_H_
+
+/**
+ * @brief Typed Event
+ * @defgroup typed_event Typed Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct typed_event {
+	struct app_event_header header;
+
+	uint32_t val;
+};
+
+APP_EVENT_TYPE_DECLARE(typed_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _TYPED_EVENT_H_ */
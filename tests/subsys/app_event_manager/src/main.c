@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <app_event_manager.h>
 
+#include "pool_event.h"
 #include "sized_events.h"
 #include "test_events.h"
 
@@ -184,6 +185,68 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_event_pool)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_pool_stats stats;
+
+	test_start(TEST_POOL);
+
+	zassert_ok(app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats),
+		   "Cannot get pool statistics");
+	zassert_equal(stats.num_used, 0, "Events were not returned to the pool");
+}
+
+ZTEST(suite0, test_priority)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_PRIORITY);
+}
+
+ZTEST(suite0, test_typed_handler)
+{
+	test_start(TEST_TYPED_HANDLER);
+}
+
+ZTEST(suite0, test_throughput)
+{
+	test_start(TEST_THROUGHPUT);
+}
+
+ZTEST(suite0, test_latency_stats)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LATENCY_STATS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_latency_stats dispatch;
+	struct app_event_latency_stats processing;
+
+	app_event_manager_latency_reset();
+	app_event_manager_latency_get(APP_EVENT_ID(test_start_event), &dispatch, &processing);
+	zassert_equal(dispatch.count, 0, "Statistics were not reset");
+	zassert_equal(processing.count, 0, "Statistics were not reset");
+
+	/* Test start event is processed before the test end event is dispatched. */
+	test_start(TEST_BASIC);
+
+	app_event_manager_latency_get(APP_EVENT_ID(test_start_event), &dispatch, &processing);
+	zassert_equal(dispatch.count, 1, "Wrong number of dispatch latency samples");
+	zassert_equal(processing.count, 1, "Wrong number of processing latency samples");
+	zassert_true(dispatch.p50_us <= dispatch.p99_us, "Wrong percentiles");
+	zassert_true(dispatch.p99_us <= dispatch.max_us, "Wrong percentiles");
+	zassert_true(processing.p99_us <= processing.max_us, "Wrong percentiles");
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -23,6 +23,8 @@ extern "C" {
 
 #define TEST_EVENT_ORDER_CNT 20
 
+#define TEST_THROUGHPUT_EVENT_CNT 10000
+
 #ifdef __cplusplus
 }
 #endif
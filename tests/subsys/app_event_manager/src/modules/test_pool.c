@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "pool_event.h"
+
+#define MODULE test_pool
+
+static struct pool_event *event_tab[POOL_EVENT_POOL_SIZE + 1];
+
+
+static void pool_test_run(void)
+{
+	struct app_event_pool_stats stats;
+	int err;
+
+	app_event_manager_pool_stats_reset(APP_EVENT_ID(pool_event));
+
+	/* Exhaust the pool, the last event is expected to be allocated from the heap. */
+	for (size_t i = 0; i < ARRAY_SIZE(event_tab); i++) {
+		event_tab[i] = new_pool_event();
+		zassert_not_null(event_tab[i], "Cannot allocate event");
+		event_tab[i]->val = i;
+	}
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Cannot get pool statistics");
+	zassert_equal(stats.num_blocks, POOL_EVENT_POOL_SIZE, "Wrong pool size");
+	zassert_equal(stats.num_used, POOL_EVENT_POOL_SIZE, "Wrong number of used blocks");
+	zassert_equal(stats.max_used, POOL_EVENT_POOL_SIZE, "Wrong maximum number of used blocks");
+	zassert_equal(stats.num_fallbacks, 1, "Wrong number of heap fallbacks");
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(test_start_event), &stats);
+	zassert_equal(err, -ENOENT, "Event without pool should not report statistics");
+
+	/* Events are returned to the pool after they are processed. */
+	for (size_t i = 0; i < ARRAY_SIZE(event_tab); i++) {
+		APP_EVENT_SUBMIT(event_tab[i]);
+		event_tab[i] = NULL;
+	}
+}
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_POOL:
+		{
+			pool_test_run();
+
+			struct test_end_event *et = new_test_end_event();
+
+			et->test_id = st->test_id;
+			APP_EVENT_SUBMIT(et);
+			break;
+		}
+
+		default:
+			/* Ignore other test cases. */
+			zassert_true(st->test_id < TEST_CNT, "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
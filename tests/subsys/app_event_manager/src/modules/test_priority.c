@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "priority_events.h"
+
+#define MODULE test_priority
+#define NORMAL_PRIO_EVENTS_CNT 5
+
+static int normal_prio_cnt;
+static bool high_prio_received;
+
+
+static void priority_test_start(void)
+{
+	normal_prio_cnt = 0;
+	high_prio_received = false;
+
+	/* Submit a burst of normal priority events followed by a single high priority event. */
+	for (int i = 0; i < NORMAL_PRIO_EVENTS_CNT; i++) {
+		struct test_normal_prio_event *event = new_test_normal_prio_event();
+
+		event->val = i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	struct test_high_prio_event *event = new_test_high_prio_event();
+
+	event->val = NORMAL_PRIO_EVENTS_CNT;
+	APP_EVENT_SUBMIT(event);
+}
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_PRIORITY:
+			priority_test_start();
+			break;
+
+		default:
+			/* Ignore other test cases. */
+			zassert_true(st->test_id < TEST_CNT, "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	if (is_test_high_prio_event(aeh)) {
+		zassert_false(high_prio_received, "High priority event received twice");
+		zassert_equal(normal_prio_cnt, 0,
+			      "High priority event delayed by normal priority events");
+		high_prio_received = true;
+
+		return false;
+	}
+
+	if (is_test_normal_prio_event(aeh)) {
+		struct test_normal_prio_event *event = cast_test_normal_prio_event(aeh);
+
+		zassert_equal(event->val, normal_prio_cnt, "Wrong normal priority event order");
+		zassert_true(high_prio_received, "High priority event not processed first");
+		normal_prio_cnt++;
+
+		if (normal_prio_cnt == NORMAL_PRIO_EVENTS_CNT) {
+			struct test_end_event *et = new_test_end_event();
+
+			et->test_id = TEST_PRIORITY;
+			APP_EVENT_SUBMIT(et);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, test_normal_prio_event);
+APP_EVENT_SUBSCRIBE(MODULE, test_high_prio_event);
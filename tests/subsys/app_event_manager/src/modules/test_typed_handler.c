@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "typed_event.h"
+
+#include "test_config.h"
+
+#define MODULE test_typed_handler
+
+static enum test_id cur_test_id;
+static uint32_t handled_cnt;
+static uint32_t final_cnt;
+static uint32_t start_cycles;
+
+
+static void typed_event_submit(uint32_t val)
+{
+	struct typed_event *event = new_typed_event();
+
+	event->val = val;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void test_end(void)
+{
+	struct test_end_event *te = new_test_end_event();
+
+	te->test_id = cur_test_id;
+	APP_EVENT_SUBMIT(te);
+}
+
+static void throughput_report(void)
+{
+	uint32_t cycles = k_cycle_get_32() - start_cycles;
+	uint64_t ns = k_cyc_to_ns_floor64(cycles);
+
+	zassert_true(ns > 0, "Invalid measurement");
+	TC_PRINT("Dispatched %u events in %llu us (%llu events/s)\n",
+		 TEST_THROUGHPUT_EVENT_CNT, ns / NSEC_PER_USEC,
+		 (uint64_t)TEST_THROUGHPUT_EVENT_CNT * NSEC_PER_SEC / ns);
+}
+
+static bool typed_event_handler(const struct typed_event *event)
+{
+	zassert_equal(event->val, handled_cnt, "Wrong event order");
+	zassert_equal(final_cnt, handled_cnt, "Final handler not called");
+	handled_cnt++;
+
+	switch (cur_test_id) {
+	case TEST_TYPED_HANDLER:
+		if (handled_cnt < TEST_EVENT_ORDER_CNT) {
+			typed_event_submit(handled_cnt);
+		}
+		break;
+
+	case TEST_THROUGHPUT:
+		/* Submit the next event to measure the complete event lifecycle. */
+		if (handled_cnt < TEST_THROUGHPUT_EVENT_CNT) {
+			typed_event_submit(handled_cnt);
+		} else {
+			throughput_report();
+			test_end();
+		}
+		break;
+
+	default:
+		zassert_true(false, "Unexpected event");
+		break;
+	}
+
+	return false;
+}
+
+static bool typed_event_final_handler(const struct typed_event *event)
+{
+	final_cnt++;
+
+	if ((cur_test_id == TEST_TYPED_HANDLER) && (final_cnt == TEST_EVENT_ORDER_CNT)) {
+		test_end();
+	}
+
+	return false;
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_TYPED_HANDLER:
+		case TEST_THROUGHPUT:
+			cur_test_id = st->test_id;
+			handled_cnt = 0;
+			final_cnt = 0;
+			start_cycles = k_cycle_get_32();
+			typed_event_submit(0);
+			break;
+
+		default:
+			/* Ignore other test cases. */
+			zassert_true(st->test_id < TEST_CNT, "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	/* Typed events are delivered directly to the typed handlers. */
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE_HANDLER(MODULE, typed_event, typed_event_handler);
+
+/* Listener without the generic event handler. */
+APP_EVENT_LISTENER(typed_final, NULL);
+APP_EVENT_SUBSCRIBE_HANDLER_FINAL(typed_final, typed_event, typed_event_final_handler);
@@ -728,6 +728,89 @@ ZTEST(suite_audio_module_bad_param, test_reconfig_null)
 		      "Reconfiguration returns with incorrect state: %d", handle.state);
 }
 
+ZTEST(suite_audio_module_bad_param, test_connect_in_place_bad_param)
+{
+	int ret;
+	struct k_mem_slab slab_1, slab_2;
+
+	test_initialize_description(&test_description_1, "Module Test 1", AUDIO_MODULE_TYPE_INPUT,
+				    NULL);
+	test_initialize_description(&test_description_2, "Module Test 2", AUDIO_MODULE_TYPE_IN_OUT,
+				    NULL);
+	test_description_2.in_place = false;
+
+	test_initialize_handle(&handle_tx, "TEST In place 1", &test_description_1,
+			       AUDIO_MODULE_STATE_CONFIGURED, NULL, NULL);
+	test_initialize_handle(&handle_rx, "TEST In place 2", &test_description_2,
+			       AUDIO_MODULE_STATE_CONFIGURED, NULL, NULL);
+	handle_tx.thread.data_slab = &slab_1;
+	handle_rx.thread.data_slab = &slab_1;
+
+	ret = audio_module_connect_in_place(NULL, &handle_rx);
+	zassert_equal(ret, -EINVAL, "Connect in place did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+
+	ret = audio_module_connect_in_place(&handle_tx, NULL);
+	zassert_equal(ret, -EINVAL, "Connect in place did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+
+	ret = audio_module_connect_in_place(&handle_tx, &handle_tx);
+	zassert_equal(ret, -EINVAL, "Connect in place did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -ECANCELED, "Connect in place did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+
+	test_description_2.in_place = true;
+	handle_rx.state = AUDIO_MODULE_STATE_RUNNING;
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -ECANCELED, "Connect in place did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+
+	handle_rx.state = AUDIO_MODULE_STATE_CONFIGURED;
+	test_description_2.type = AUDIO_MODULE_TYPE_INPUT;
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -ECANCELED, "Connect in place did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+
+	test_description_2.type = AUDIO_MODULE_TYPE_IN_OUT;
+	handle_rx.thread.data_slab = &slab_2;
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -EINVAL, "Connect in place did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+
+	handle_rx.thread.data_slab = &slab_1;
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, 0, "Connect in place did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -EALREADY, "Connect in place did not return -EALREADY (%d): ret %d",
+		      -EALREADY, ret);
+
+	ret = audio_module_connect_in_place(&handle_rx, &handle_tx);
+	zassert_equal(ret, -ECANCELED, "Connect in place did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+
+	ret = audio_module_close(&handle_rx);
+	zassert_equal(ret, -EBUSY, "Close function did not return -EBUSY (%d): ret %d", -EBUSY,
+		      ret);
+
+	ret = audio_module_disconnect_in_place(&handle_rx, &handle_tx);
+	zassert_equal(ret, -EALREADY, "Disconnect in place did not return -EALREADY (%d): ret %d",
+		      -EALREADY, ret);
+
+	handle_tx.state = AUDIO_MODULE_STATE_RUNNING;
+	ret = audio_module_disconnect_in_place(&handle_tx, &handle_rx);
+	zassert_equal(ret, -ECANCELED,
+		      "Disconnect in place did not return -ECANCELED (%d): ret %d", -ECANCELED,
+		      ret);
+
+	ret = audio_module_disconnect_in_place(NULL, &handle_rx);
+	zassert_equal(ret, -EINVAL, "Disconnect in place did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+}
+
 ZTEST(suite_audio_module_bad_param, test_disconnect_bad_type)
 {
 	int ret;
@@ -1035,3 +1035,49 @@ ZTEST(suite_audio_module_functional, test_data_rx_fnct)
 		      "Data RX function failed to free item, data FIFO free called %d times",
 		      data_fifo_block_free_fake.call_count);
 }
+
+ZTEST(suite_audio_module_functional, test_connect_disconnect_in_place_fnct)
+{
+	int ret;
+	struct k_mem_slab slab;
+	struct audio_module_handle handle_from, handle_mid, handle_to;
+	struct audio_module_description mid_description = {0};
+	struct audio_module_description to_description = {0};
+
+	test_from_description.type = AUDIO_MODULE_TYPE_INPUT;
+	mid_description.type = AUDIO_MODULE_TYPE_IN_OUT;
+	mid_description.in_place = true;
+	to_description.type = AUDIO_MODULE_TYPE_OUTPUT;
+	to_description.in_place = true;
+
+	test_initialize_handle(&handle_from, &test_from_description, NULL, NULL);
+	test_initialize_handle(&handle_mid, &mid_description, NULL, NULL);
+	test_initialize_handle(&handle_to, &to_description, NULL, NULL);
+	handle_from.thread.data_slab = &slab;
+	handle_mid.thread.data_slab = &slab;
+	handle_to.thread.data_slab = &slab;
+
+	ret = audio_module_connect_in_place(&handle_from, &handle_mid);
+	zassert_equal(ret, 0, "Connect in place did not return successfully: ret %d", ret);
+
+	handle_to.state = AUDIO_MODULE_STATE_STOPPED;
+	ret = audio_module_connect_in_place(&handle_mid, &handle_to);
+	zassert_equal(ret, 0, "Connect in place did not return successfully: ret %d", ret);
+
+	zassert_equal_ptr(handle_from.chain_next, &handle_mid, "Chain next of first not set");
+	zassert_equal_ptr(handle_mid.chain_prev, &handle_from, "Chain previous of middle not set");
+	zassert_equal_ptr(handle_mid.chain_next, &handle_to, "Chain next of middle not set");
+	zassert_equal_ptr(handle_to.chain_prev, &handle_mid, "Chain previous of last not set");
+	zassert_is_null(handle_from.chain_prev, "Chain previous of first set");
+	zassert_is_null(handle_to.chain_next, "Chain next of last set");
+
+	ret = audio_module_disconnect_in_place(&handle_mid, &handle_to);
+	zassert_equal(ret, 0, "Disconnect in place did not return successfully: ret %d", ret);
+	zassert_is_null(handle_mid.chain_next, "Chain next of middle not cleared");
+	zassert_is_null(handle_to.chain_prev, "Chain previous of last not cleared");
+
+	ret = audio_module_disconnect_in_place(&handle_from, &handle_mid);
+	zassert_equal(ret, 0, "Disconnect in place did not return successfully: ret %d", ret);
+	zassert_is_null(handle_from.chain_next, "Chain next of first not cleared");
+	zassert_is_null(handle_mid.chain_prev, "Chain previous of middle not cleared");
+}
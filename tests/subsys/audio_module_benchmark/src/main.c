@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+
+#include "data_fifo.h"
+#include "audio_module/audio_module.h"
+
+/* 10 ms frame of 48 kHz 16-bit mono audio */
+#define FRAME_US	  10000
+#define FRAME_SIZE	  960
+#define FRAMES_NUM	  20
+#define FRAMES_SLOW_NUM	  3
+#define FRAME_TIMEOUT	  K_MSEC(100)
+#define SLAB_BLOCKS_NUM	  4
+#define FIFO_ELEMENTS_NUM 4
+
+#define THREAD_STACK_SIZE 1024
+#define THREAD_PRIORITY	  4
+
+/* Synthetic processing load of the work module */
+#define WORK_US		  1000
+#define WORK_SLOW_US	  (FRAME_US + 2000)
+
+enum bench_module {
+	BENCH_GEN,
+	BENCH_WORK,
+	BENCH_SINK,
+	BENCH_MODULES_NUM
+};
+
+struct bench_config {
+	uint32_t work_us;
+};
+
+struct bench_context {
+	struct bench_config config;
+};
+
+static K_SEM_DEFINE(frame_sem, 0, FRAMES_NUM);
+static K_SEM_DEFINE(frame_done_sem, 0, FRAMES_NUM);
+
+K_MEM_SLAB_DEFINE_STATIC(gen_slab, FRAME_SIZE, SLAB_BLOCKS_NUM, 4);
+K_MEM_SLAB_DEFINE_STATIC(work_slab, FRAME_SIZE, SLAB_BLOCKS_NUM, 4);
+DATA_FIFO_DEFINE(work_fifo_rx, FIFO_ELEMENTS_NUM, sizeof(struct audio_module_message));
+DATA_FIFO_DEFINE(sink_fifo_rx, FIFO_ELEMENTS_NUM, sizeof(struct audio_module_message));
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_stacks, BENCH_MODULES_NUM, THREAD_STACK_SIZE);
+
+static struct audio_module_handle handles[BENCH_MODULES_NUM];
+static struct bench_context contexts[BENCH_MODULES_NUM];
+static struct bench_config config = {.work_us = WORK_US};
+
+static int bench_config_set(struct audio_module_handle_private *handle,
+			    struct audio_module_configuration const *const configuration)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct bench_context *ctx = (struct bench_context *)hdl->context;
+
+	memcpy(&ctx->config, configuration, sizeof(struct bench_config));
+
+	return 0;
+}
+
+static int bench_config_get(struct audio_module_handle_private const *const handle,
+			    struct audio_module_configuration *configuration)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct bench_context *ctx = (struct bench_context *)hdl->context;
+
+	memcpy(configuration, &ctx->config, sizeof(struct bench_config));
+
+	return 0;
+}
+
+/* Input module, produces one frame each time the test gives frame_sem */
+static int gen_data_process(struct audio_module_handle_private *handle,
+			    struct audio_data const *const audio_data_rx,
+			    struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data_rx);
+
+	k_sem_take(&frame_sem, K_FOREVER);
+
+	memset(audio_data_tx->data, 0x55, FRAME_SIZE);
+	audio_data_tx->data_size = FRAME_SIZE;
+	audio_data_tx->meta.data_len_us = FRAME_US;
+
+	return 0;
+}
+
+/* In/out module, copies the frame while burning the configured number of microseconds */
+static int work_data_process(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data_rx,
+			     struct audio_data *audio_data_tx)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct bench_context *ctx = (struct bench_context *)hdl->context;
+
+	k_busy_wait(ctx->config.work_us);
+
+	if (audio_data_tx != audio_data_rx) {
+		memcpy(audio_data_tx->data, audio_data_rx->data, audio_data_rx->data_size);
+		audio_data_tx->data_size = audio_data_rx->data_size;
+		memcpy(&audio_data_tx->meta, &audio_data_rx->meta, sizeof(struct audio_metadata));
+	}
+
+	return 0;
+}
+
+/* Output module, signals the test that a frame went through the graph */
+static int sink_data_process(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data_rx,
+			     struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data_rx);
+	ARG_UNUSED(audio_data_tx);
+
+	k_sem_give(&frame_done_sem);
+
+	return 0;
+}
+
+static const struct audio_module_functions gen_functions = {
+	.configuration_set = bench_config_set,
+	.configuration_get = bench_config_get,
+	.data_process = gen_data_process};
+
+static const struct audio_module_functions work_functions = {
+	.configuration_set = bench_config_set,
+	.configuration_get = bench_config_get,
+	.data_process = work_data_process};
+
+static const struct audio_module_functions sink_functions = {
+	.configuration_set = bench_config_set,
+	.configuration_get = bench_config_get,
+	.data_process = sink_data_process};
+
+static struct audio_module_description descriptions[BENCH_MODULES_NUM] = {
+	[BENCH_GEN] = {.name = "Generator",
+		       .type = AUDIO_MODULE_TYPE_INPUT,
+		       .functions = &gen_functions},
+	[BENCH_WORK] = {.name = "Work",
+			.type = AUDIO_MODULE_TYPE_IN_OUT,
+			.functions = &work_functions,
+			.in_place = true},
+	[BENCH_SINK] = {.name = "Sink",
+			.type = AUDIO_MODULE_TYPE_OUTPUT,
+			.functions = &sink_functions}};
+
+static const char *const instance_names[BENCH_MODULES_NUM] = {"gen", "work", "sink"};
+
+static void graph_run(int frames)
+{
+	int ret;
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_stats_reset(&handles[i]);
+		zassert_equal(ret, 0, "Failed to reset statistics of %s: ret %d",
+			      instance_names[i], ret);
+	}
+
+	for (int i = 0; i < frames; i++) {
+		k_sem_give(&frame_sem);
+
+		ret = k_sem_take(&frame_done_sem, FRAME_TIMEOUT);
+		zassert_equal(ret, 0, "Frame %d did not pass through the graph", i);
+	}
+
+	/* Let the sink finish accounting the last frame */
+	k_msleep(1);
+}
+
+static void stats_print(struct audio_module_stats const *stats, char const *name)
+{
+	uint32_t frames = MAX(stats->frames, 1);
+
+	TC_PRINT("%-6s frames %3u process avg %6u max %6u us, queue avg %6u max %6u us, "
+		 "misses %u\n",
+		 name, stats->frames, (uint32_t)(stats->process_us_total / frames),
+		 stats->process_us_max, (uint32_t)(stats->queue_wait_us_total / frames),
+		 stats->queue_wait_us_max, stats->deadline_misses);
+}
+
+ZTEST(suite_audio_module_benchmark, test_graph_stats)
+{
+	int ret;
+	struct audio_module_stats stats[BENCH_MODULES_NUM];
+
+	contexts[BENCH_WORK].config.work_us = WORK_US;
+
+	graph_run(FRAMES_NUM);
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_stats_get(&handles[i], &stats[i]);
+		zassert_equal(ret, 0, "Failed to get statistics of %s: ret %d", instance_names[i],
+			      ret);
+		zassert_equal(stats[i].frames, FRAMES_NUM, "Module %s processed %d frames",
+			      instance_names[i], stats[i].frames);
+		stats_print(&stats[i], instance_names[i]);
+	}
+
+	zassert_true(stats[BENCH_WORK].process_us_max >= WORK_US,
+		     "Work module processing time %d us is below the synthetic load",
+		     stats[BENCH_WORK].process_us_max);
+	zassert_true(stats[BENCH_WORK].process_us_total >= (uint64_t)WORK_US * FRAMES_NUM,
+		     "Work module total processing time is below the synthetic load");
+	zassert_equal(stats[BENCH_GEN].deadline_misses, 0,
+		      "Input module should not be checked for deadline misses");
+}
+
+ZTEST(suite_audio_module_benchmark, test_graph_deadline_miss)
+{
+	int ret;
+	struct audio_module_stats stats;
+
+	contexts[BENCH_WORK].config.work_us = WORK_SLOW_US;
+
+	graph_run(FRAMES_SLOW_NUM);
+
+	contexts[BENCH_WORK].config.work_us = WORK_US;
+
+	ret = audio_module_stats_get(&handles[BENCH_WORK], &stats);
+	zassert_equal(ret, 0, "Failed to get statistics: ret %d", ret);
+	stats_print(&stats, instance_names[BENCH_WORK]);
+
+	zassert_equal(stats.deadline_misses, FRAMES_SLOW_NUM,
+		      "Work module missed %d deadlines, expected %d", stats.deadline_misses,
+		      FRAMES_SLOW_NUM);
+}
+
+ZTEST(suite_audio_module_benchmark, test_stats_bad_param)
+{
+	int ret;
+	struct audio_module_stats stats;
+	struct audio_module_handle handle_closed = {0};
+
+	ret = audio_module_stats_get(NULL, &stats);
+	zassert_equal(ret, -EINVAL, "Get statistics did not return -EINVAL: ret %d", ret);
+
+	ret = audio_module_stats_get(&handles[BENCH_WORK], NULL);
+	zassert_equal(ret, -EINVAL, "Get statistics did not return -EINVAL: ret %d", ret);
+
+	ret = audio_module_stats_reset(NULL);
+	zassert_equal(ret, -EINVAL, "Reset statistics did not return -EINVAL: ret %d", ret);
+
+	ret = audio_module_stats_get(&handle_closed, &stats);
+	zassert_equal(ret, -ECANCELED, "Get statistics did not return -ECANCELED: ret %d", ret);
+}
+
+static void *suite_setup(void)
+{
+	int ret;
+	struct audio_module_parameters parameters[BENCH_MODULES_NUM] = {
+		[BENCH_GEN] = {.thread = {.data_slab = &gen_slab, .data_size = FRAME_SIZE}},
+		[BENCH_WORK] = {.thread = {.msg_rx = &work_fifo_rx,
+					   .data_slab = &work_slab,
+					   .data_size = FRAME_SIZE}},
+		[BENCH_SINK] = {.thread = {.msg_rx = &sink_fifo_rx}}};
+
+	ret = data_fifo_init(&work_fifo_rx);
+	zassert_equal(ret, 0, "Failed to initialize FIFO: ret %d", ret);
+
+	ret = data_fifo_init(&sink_fifo_rx);
+	zassert_equal(ret, 0, "Failed to initialize FIFO: ret %d", ret);
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		parameters[i].description = &descriptions[i];
+		parameters[i].thread.stack = bench_stacks[i];
+		parameters[i].thread.stack_size = K_THREAD_STACK_SIZEOF(bench_stacks[i]);
+		parameters[i].thread.priority = THREAD_PRIORITY;
+
+		ret = audio_module_open(&parameters[i],
+					(struct audio_module_configuration const *)&config,
+					instance_names[i],
+					(struct audio_module_context *)&contexts[i], &handles[i]);
+		zassert_equal(ret, 0, "Failed to open %s: ret %d", instance_names[i], ret);
+	}
+
+	ret = audio_module_connect(&handles[BENCH_GEN], &handles[BENCH_WORK], false);
+	zassert_equal(ret, 0, "Failed to connect: ret %d", ret);
+
+	ret = audio_module_connect(&handles[BENCH_WORK], &handles[BENCH_SINK], false);
+	zassert_equal(ret, 0, "Failed to connect: ret %d", ret);
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_start(&handles[i]);
+		zassert_equal(ret, 0, "Failed to start %s: ret %d", instance_names[i], ret);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(suite_audio_module_benchmark, NULL, suite_setup, NULL, NULL, NULL);
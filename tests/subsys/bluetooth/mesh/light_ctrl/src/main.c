@@ -20,6 +20,13 @@
 /* Difference between In and In-1 in PI Regulator for the given Ki coefficient and U = 1. */
 #define SUMMATION_STEP(ki) ((ki) * CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_INTERVAL / 1000)
 
+/* Value of the PI Regulator internal sum in the format used by the regulator. */
+#if defined(CONFIG_BT_MESH_LIGHT_CTRL_REG_SPEC_FIXED_POINT)
+#define REG_SPEC_I(val) ((int64_t)((val) * 65536))
+#else
+#define REG_SPEC_I(val) (val)
+#endif
+
 enum flags {
 	FLAG_ON,
 	FLAG_OCC_MODE,
@@ -655,8 +662,8 @@ ZTEST(light_ctrl_pi_reg_test, test_pi_regulator_shall_not_wrap_around)
 	start_reg(CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG_LUX_ON -
 		  REG_ACCURACY(CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG_LUX_ON) - 1);
 	/* Tweak internal sum of the regulator to avoid long execution time.*/
-	((struct bt_mesh_light_ctrl_reg_spec *)light_ctrl_srv.reg)->i = 65528 *
-		SUMMATION_STEP(light_ctrl_srv.reg->cfg.ki.up);
+	((struct bt_mesh_light_ctrl_reg_spec *)light_ctrl_srv.reg)->i = REG_SPEC_I(65528 *
+		SUMMATION_STEP(light_ctrl_srv.reg->cfg.ki.up));
 	trigger_pi_reg(1, true);
 	/* Expected lightness = 65529 * U * T * Kiu + U * Kpu = 65529 + 5 = 65534. */
 	zassert_equal(pi_reg_test_ctx.lightness, 65534, "Incorrect lightness value: %d",
@@ -683,8 +690,8 @@ ZTEST(light_ctrl_pi_reg_test, test_pi_regulator_shall_not_wrap_around)
 
 	/* Drive lightness value to 0 and check that it stops changing. */
 	/* Tweak internal sum of the regulator to avoid long execution time.*/
-	((struct bt_mesh_light_ctrl_reg_spec *)light_ctrl_srv.reg)->i = 65535 - 65528 *
-		SUMMATION_STEP(light_ctrl_srv.reg->cfg.ki.up);
+	((struct bt_mesh_light_ctrl_reg_spec *)light_ctrl_srv.reg)->i = REG_SPEC_I(65535 - 65528 *
+		SUMMATION_STEP(light_ctrl_srv.reg->cfg.ki.up));
 	trigger_pi_reg(1, true);
 	/* Expected lightness = 65535 - 65529 * U * T * Kid - U * Kpd = 1. */
 	zassert_equal(pi_reg_test_ctx.lightness, 1, "Incorrect lightness value: %d",
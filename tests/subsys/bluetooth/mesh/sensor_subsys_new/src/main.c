@@ -975,4 +975,24 @@ TEST_SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range, 0x0061,
 
 TEST_SENSOR_TYPE(total_dev_runtime, 0x006e, CHANNEL(time_hour_24, 3))
 
+ZTEST(sensor_types_test_new, test_type_get_sorted)
+{
+	const struct bt_mesh_sensor_type *prev = NULL;
+
+	/* bt_mesh_sensor_type_get() relies on the types being sorted by ID. */
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (prev) {
+			zassert_true(prev->id < type->id,
+				     "Type 0x%04x placed after 0x%04x", type->id,
+				     prev->id);
+		}
+
+		zassert_equal(bt_mesh_sensor_type_get(type->id), type);
+		prev = type;
+	}
+
+	zassert_is_null(bt_mesh_sensor_type_get(0x0000));
+	zassert_is_null(bt_mesh_sensor_type_get(0xffff));
+}
+
 ZTEST_SUITE(sensor_types_test_new, NULL, NULL, NULL, NULL, NULL);
@@ -209,4 +209,27 @@ ZTEST(bl_crypto_test, test_bl_root_of_trust_verify)
 	zassert_equal(-ESIGINV, retval, "retval was %d", retval);
 }
 
+#ifdef CONFIG_SB_CRYPTO_FLASH_SHA256
+#include <zephyr/drivers/flash.h>
+
+ZTEST(bl_crypto_test, test_sha256_flash)
+{
+	const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+	const off_t offset = (off_t)const_fw_data - CONFIG_FLASH_BASE_ADDRESS;
+	uint8_t wrong_hash[CONFIG_SB_HASH_LEN];
+	int retval;
+
+	retval = bl_sha256_flash_verify(fdev, offset, ARRAY_SIZE(const_fw_data), image_fw_hash);
+	zassert_equal(0, retval, "bl_sha256_flash_verify failed: %d", retval);
+
+	memcpy(wrong_hash, image_fw_hash, sizeof(wrong_hash));
+	wrong_hash[0] ^= 1;
+	retval = bl_sha256_flash_verify(fdev, offset, ARRAY_SIZE(const_fw_data), wrong_hash);
+	zassert_equal(-EHASHINV, retval, "bl_sha256_flash_verify did not fail: %d", retval);
+
+	retval = bl_sha256_flash_verify(NULL, offset, ARRAY_SIZE(const_fw_data), image_fw_hash);
+	zassert_equal(-EINVAL, retval, "bl_sha256_flash_verify did not fail: %d", retval);
+}
+#endif
+
 ZTEST_SUITE(bl_crypto_test, NULL, NULL, NULL, NULL, NULL);
@@ -26,6 +26,7 @@ enum test_id {
 	TEST_BASIC,
 	TEST_ORDER,
 	TEST_STATUS,
+	TEST_SHARED,
 
 	TEST_CNT
 };
@@ -101,6 +101,11 @@ ZTEST(caf_sensor_aggregator_tests, test_status)
 	test_start(TEST_STATUS);
 }
 
+ZTEST(caf_sensor_aggregator_tests, test_shared)
+{
+	test_start(TEST_SHARED);
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_test_end_event(aeh)) {
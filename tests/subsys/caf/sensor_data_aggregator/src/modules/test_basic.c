@@ -15,6 +15,19 @@
 #define MODULE test_basic
 
 
+void submit_shared_samples(uint8_t first_val)
+{
+	for (size_t i = 0; i < SHARED_TEST_SAMPLES_IN_AGG_BUF; i++) {
+		struct sensor_event *se = new_sensor_event(sizeof(struct sensor_value));
+
+		zassert_not_null(se, "Failed to allocate event");
+		se->descr = SHARED_TEST_AGG_DESCR;
+		se->dyndata.size = sizeof(struct sensor_value);
+		se->dyndata.data[0] = first_val + i;
+		APP_EVENT_SUBMIT(se);
+	}
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_test_start_event(aeh)) {
@@ -65,6 +78,12 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			break;
 		}
 
+		case TEST_SHARED:
+		{
+			submit_shared_samples(0);
+			break;
+		}
+
 		default:
 			/* Ignore other test cases, check if proper test_id. */
 			zassert_true(st->test_id < TEST_CNT,
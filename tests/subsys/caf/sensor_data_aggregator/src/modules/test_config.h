@@ -16,3 +16,9 @@
 #define BASIC_TEST_AGG_DESCR "void_basic_test_sensor"
 #define ORDER_TEST_AGG_DESCR "void_order_test_sensor"
 #define STATUS_TEST_AGG_DESCR "void_status_test_sensor"
+#define SHARED_TEST_AGG_DESCR "void_shared_test_sensor"
+#define SHARED_TEST_SAMPLES_IN_AGG_BUF 5
+#define SHARED_TEST_DROPPED_VAL 10
+#define SHARED_TEST_SENT_VAL 20
+
+void submit_shared_samples(uint8_t first_val);
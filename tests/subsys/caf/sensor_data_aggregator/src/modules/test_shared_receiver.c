@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+#include "test_config.h"
+#include <test_events.h>
+#include <caf/events/sensor_data_aggregator_event.h>
+#include <zephyr/drivers/sensor.h>
+
+#define MODULE test_shared_receiver
+
+/* Second consumer of the shared aggregator. The test_data_receiver module releases every
+ * buffer immediately, this module holds the first buffer while new samples are submitted.
+ * The samples must be dropped, because the buffer is still used by this module.
+ */
+static struct sensor_value *held_samples;
+static size_t held_release_cnt;
+static size_t agg_event_cnt;
+
+
+static bool handle_sensor_data_aggregator_event(const struct sensor_data_aggregator_event *event)
+{
+	if (strcmp(event->sensor_descr, SHARED_TEST_AGG_DESCR)) {
+		return false;
+	}
+
+	zassert_equal(event->sample_cnt, SHARED_TEST_SAMPLES_IN_AGG_BUF, "Wrong sample count");
+	agg_event_cnt++;
+
+	if (agg_event_cnt == 1) {
+		uint8_t *event_data = (uint8_t *)&event->samples[0];
+
+		zassert_equal(*event_data, 0, "Wrong buffer data");
+		held_samples = event->samples;
+
+		/* No free buffer, the samples are dropped. */
+		submit_shared_samples(SHARED_TEST_DROPPED_VAL);
+
+		struct sensor_data_aggregator_release_buffer_event *release_evt =
+			new_sensor_data_aggregator_release_buffer_event();
+
+		release_evt->samples = event->samples;
+		release_evt->sensor_descr = event->sensor_descr;
+		APP_EVENT_SUBMIT(release_evt);
+	} else {
+		for (size_t i = 0; i < SHARED_TEST_SAMPLES_IN_AGG_BUF; i++) {
+			uint8_t *event_data = (uint8_t *)&event->samples[i];
+
+			zassert_equal(*event_data, SHARED_TEST_SENT_VAL + i,
+				      "Buffer reused before release by all consumers");
+		}
+
+		struct sensor_data_aggregator_release_buffer_event *release_evt =
+			new_sensor_data_aggregator_release_buffer_event();
+
+		release_evt->samples = event->samples;
+		release_evt->sensor_descr = event->sensor_descr;
+		APP_EVENT_SUBMIT(release_evt);
+
+		struct test_end_event *te = new_test_end_event();
+
+		zassert_not_null(te, "Failed to allocate event");
+		te->test_id = TEST_SHARED;
+		APP_EVENT_SUBMIT(te);
+	}
+
+	return false;
+}
+
+static bool handle_release_buffer_event(
+		const struct sensor_data_aggregator_release_buffer_event *event)
+{
+	if ((held_samples == NULL) || (event->samples != held_samples)) {
+		return false;
+	}
+
+	held_release_cnt++;
+	if (held_release_cnt == 2) {
+		/* The buffer is released by both consumers, it can be filled again. */
+		held_samples = NULL;
+		submit_shared_samples(SHARED_TEST_SENT_VAL);
+	}
+
+	return false;
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_sensor_data_aggregator_event(aeh)) {
+		return handle_sensor_data_aggregator_event(
+			cast_sensor_data_aggregator_event(aeh));
+	}
+
+	if (is_sensor_data_aggregator_release_buffer_event(aeh)) {
+		return handle_release_buffer_event(
+			cast_sensor_data_aggregator_release_buffer_event(aeh));
+	}
+
+	zassert_unreachable("Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, sensor_data_aggregator_event);
+APP_EVENT_SUBSCRIBE(MODULE, sensor_data_aggregator_release_buffer_event);
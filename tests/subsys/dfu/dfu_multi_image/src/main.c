@@ -267,4 +267,23 @@ ZTEST(dfu_multi_image_test, test_generated_dfu_package)
 		   "DFU failed");
 }
 
+ZTEST(dfu_multi_image_test, test_generated_dfu_package_sha256)
+{
+	uint8_t buffer[256];
+	uint8_t package[strlen(DFU_PACKAGE_SHA256_HEX) / 2];
+	size_t package_len;
+
+	/*
+	 * Test that a package with image digests in the header is parsed and written,
+	 * and that the digests match the images if their verification is enabled.
+	 */
+	package_len = hex2bin(DFU_PACKAGE_SHA256_HEX, strlen(DFU_PACKAGE_SHA256_HEX), package,
+			      sizeof(package));
+	zassert_true(package_len > 0, "Failed to convert package from hex string");
+
+	zassert_ok(comparison_test(package, package_len, &generated_dfu_package_expected, buffer,
+				   sizeof(buffer), 7),
+		   "DFU failed");
+}
+
 ZTEST_SUITE(dfu_multi_image_test, NULL, NULL, NULL, NULL, NULL);
@@ -273,6 +273,40 @@ ZTEST(emds_flash_tests, test_rd_wr_simple)
 	zassert_false(memcmp(data_out, data_in, sizeof(data_out)), "Retrived wrong value");
 }
 
+ZTEST(emds_flash_tests, test_cmp)
+{
+	/* Verifies that an entry is only reported as unchanged when the most recent copy
+	 * matches the data
+	 */
+	uint8_t data_in[21] = "Emergency data store";
+	uint8_t data_new[21] = "Emergency data saved";
+
+	flash_clear();
+	device_reset();
+
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+	zassert_false(emds_flash_prepare(&ctx, 2 * (sizeof(data_in) + ctx.ate_size)),
+		      "Prepare failed");
+	zassert_equal(1, emds_flash_cmp(&ctx, 1, data_in, sizeof(data_in)),
+		      "Entry not written should differ");
+
+	zassert_false(emds_flash_write(&ctx, 1, data_in, sizeof(data_in)) < 0, "Error when write");
+	zassert_equal(0, emds_flash_cmp(&ctx, 1, data_in, sizeof(data_in)), "Entry should match");
+	zassert_equal(1, emds_flash_cmp(&ctx, 1, data_new, sizeof(data_new)),
+		      "Entry should differ");
+	zassert_equal(1, emds_flash_cmp(&ctx, 1, data_in, sizeof(data_in) - 1),
+		      "Entry of other length should differ");
+	zassert_equal(1, emds_flash_cmp(&ctx, 2, data_in, sizeof(data_in)),
+		      "Other entry should differ");
+
+	zassert_false(emds_flash_write(&ctx, 1, data_new, sizeof(data_new)) < 0,
+		      "Error when write");
+	zassert_equal(0, emds_flash_cmp(&ctx, 1, data_new, sizeof(data_new)),
+		      "Latest entry should match");
+	zassert_equal(1, emds_flash_cmp(&ctx, 1, data_in, sizeof(data_in)),
+		      "Previous entry should differ");
+}
+
 ZTEST(emds_flash_tests, test_flash_recovery)
 {
 	char data_in1[9] = "Deadbeef";
@@ -477,6 +511,28 @@ ZTEST(emds_flash_tests, test_clear_on_strange_flash)
 	zassert_false(flash_cmp_const(m_test_fd.offset, 0xff, m_test_fd.size), "Flash not cleared");
 }
 
+ZTEST(emds_flash_tests, test_clear_on_written_free_space)
+{
+	uint8_t data[8];
+
+	flash_clear();
+	device_reset();
+
+	/* The free area is written after it has been recovered, expect it to be cleared on
+	 * prepare, so that the store never writes over a word that is not erased.
+	 */
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+	zassert_false(ctx.force_erase, "Force erase should be false");
+
+	memset(data, 69, sizeof(data));
+	zassert_false(flash_write(m_test_fd.fd, m_test_fd.offset + m_test_fd.size / 2, data,
+				  sizeof(data)),
+		      "Error when writing");
+
+	zassert_false(emds_flash_prepare(&ctx, 0), "Error when preparing");
+	zassert_false(flash_cmp_const(m_test_fd.offset, 0xff, m_test_fd.size), "Flash not cleared");
+}
+
 ZTEST(emds_flash_tests, test_permission)
 {
 	char data_in[8] = "Deadbeef";
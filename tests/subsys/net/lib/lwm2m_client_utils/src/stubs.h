@@ -46,6 +46,8 @@ DECLARE_FAKE_VALUE_FUNC(int, lwm2m_notify_observer, uint16_t, uint16_t, uint16_t
 DECLARE_FAKE_VALUE_FUNC(struct lwm2m_ctx *, lwm2m_rd_client_ctx);
 DECLARE_FAKE_VOID_FUNC(lwm2m_rd_client_update);
 DECLARE_FAKE_VOID_FUNC(lwm2m_register_obj, struct lwm2m_engine_obj *);
+DECLARE_FAKE_VOID_FUNC(lwm2m_registry_lock);
+DECLARE_FAKE_VOID_FUNC(lwm2m_registry_unlock);
 DECLARE_FAKE_VALUE_FUNC(int, modem_key_mgmt_exists, nrf_sec_tag_t, enum modem_key_mgmt_cred_type,
 			bool *);
 DECLARE_FAKE_VALUE_FUNC(int, modem_key_mgmt_write, nrf_sec_tag_t, enum modem_key_mgmt_cred_type,
@@ -134,6 +136,8 @@ DECLARE_FAKE_VOID_FUNC(lwm2m_utils_rai_event_cb, struct lwm2m_ctx *, enum lwm2m_
 	FUNC(lwm2m_engine_get_obj_inst)                 \
 	FUNC(lwm2m_notify_observer)                     \
 	FUNC(lwm2m_register_obj)                        \
+	FUNC(lwm2m_registry_lock)                       \
+	FUNC(lwm2m_registry_unlock)                     \
 	FUNC(lwm2m_rd_client_ctx)                       \
 	FUNC(lwm2m_rd_client_update)                    \
 	FUNC(modem_key_mgmt_exists)                     \
@@ -59,6 +59,10 @@ static K_SEM_DEFINE(puback_sem, 0, 1);
 static K_SEM_DEFINE(suback_sem, 0, 1);
 static K_SEM_DEFINE(publish_sem, 0, 1);
 static K_SEM_DEFINE(error_msg_size_sem, 0, 1);
+static K_SEM_DEFINE(publish_chunk_sem, 0, 1);
+
+/* Number of payload bytes received through the on_publish_chunk callback. */
+static size_t chunk_bytes_received;
 
 void setUp(void)
 {
@@ -180,6 +184,19 @@ static void cb_on_publish(struct mqtt_helper_buf topic, struct mqtt_helper_buf p
 	k_sem_give(&publish_sem);
 }
 
+static void cb_on_publish_chunk(struct mqtt_helper_buf topic, struct mqtt_helper_buf chunk,
+				size_t offset, size_t total_len)
+{
+	TEST_ASSERT_EQUAL(chunk_bytes_received, offset);
+	TEST_ASSERT_TRUE(chunk.size <= CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN);
+
+	chunk_bytes_received += chunk.size;
+
+	if (chunk_bytes_received == total_len) {
+		k_sem_give(&publish_chunk_sem);
+	}
+}
+
 static void cb_on_connack(enum mqtt_conn_return_code return_code, bool session_present)
 {
 	switch (return_code) {
@@ -599,6 +616,38 @@ void test_mqtt_helper_poll_loop_pollerr(void)
 	mqtt_helper_poll_loop();
 }
 
+/* The test registers the on_publish_chunk callback, so it must be the last test using
+ * the library callbacks.
+ */
+void test_on_publish_chunked_large_incoming_msg(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_publish_chunk = cb_on_publish_chunk,
+		},
+	};
+	struct mqtt_evt evt = {
+		.type = MQTT_EVT_PUBLISH,
+		.param.publish.message = {
+			.payload = {
+				.len = (2 * CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN) + 1,
+			},
+		}
+	};
+
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	/* The payload is expected to be read in three parts. */
+	__cmock_mqtt_readall_publish_payload_ExpectAnyArgsAndReturn(0);
+	__cmock_mqtt_readall_publish_payload_ExpectAnyArgsAndReturn(0);
+	__cmock_mqtt_readall_publish_payload_ExpectAnyArgsAndReturn(0);
+
+	chunk_bytes_received = 0;
+
+	mqtt_evt_handler(&mqtt_client, &evt);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&publish_chunk_sem, K_SECONDS(1)));
+}
+
 int main(void)
 {
 	(void)unity_main();
@@ -28,6 +28,19 @@ uint8_t aes_ciphertext[AES_PLAINTEXT_LENGTH] = {
 	0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
 };
 
+/* AES test values (taken from FIPS-197, Appendix B) */
+uint8_t aes_key_b[AES_KEY_LENGTH] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+uint8_t aes_plaintext_b[AES_PLAINTEXT_LENGTH] = {
+	0x32, 0x43, 0xf6, 0xa8, 0x88, 0x5a, 0x30, 0x8d,
+	0x31, 0x31, 0x98, 0xa2, 0xe0, 0x37, 0x07, 0x34
+};
+uint8_t aes_ciphertext_b[AES_PLAINTEXT_LENGTH] = {
+	0x39, 0x25, 0x84, 0x1d, 0x02, 0xdc, 0x09, 0xfb,
+	0xdc, 0x11, 0x85, 0x97, 0x19, 0x6a, 0x0b, 0x32
+};
 
 ZTEST_SUITE(nrf_osif_crypto_tests, NULL, NULL, NULL, NULL, NULL);
 
@@ -44,3 +57,22 @@ ZTEST(nrf_osif_crypto_tests, test_crypto)
 			      "Encrypted data mismatch at byte %d", i);
 	}
 }
+
+ZTEST(nrf_osif_crypto_tests, test_crypto_key_change)
+{
+	uint8_t aes_encrypted[AES_PLAINTEXT_LENGTH] = {};
+
+	zb_osif_aes_init();
+
+	zb_osif_aes128_hw_encrypt(aes_key_b, aes_plaintext_b, aes_encrypted);
+	zassert_mem_equal(aes_encrypted, aes_ciphertext_b, AES_PLAINTEXT_LENGTH,
+			  "Encrypted data mismatch with the first key");
+
+	zb_osif_aes128_hw_encrypt(aes_key, aes_plaintext, aes_encrypted);
+	zassert_mem_equal(aes_encrypted, aes_ciphertext, AES_PLAINTEXT_LENGTH,
+			  "Encrypted data mismatch after the key change");
+
+	zb_osif_aes128_hw_encrypt(aes_key_b, aes_plaintext_b, aes_encrypted);
+	zassert_mem_equal(aes_encrypted, aes_ciphertext_b, AES_PLAINTEXT_LENGTH,
+			  "Encrypted data mismatch after changing the key back");
+}